@@ -44,6 +44,10 @@ namespace phantom {
 
 		int64_t begin_time = utils::Timestamp::HighResolution();
 		const Json::Value &json_items = body["items"];
+
+		//build all the transactions first, so that their signatures are verified in batches
+		std::vector<TransactionFrm::pointer> txs;
+		std::vector<Result> tx_results;
 		for (size_t j = 0; j < json_items.size() && running; j++) {
 			const Json::Value &json_item = json_items[j];
 			Json::Value &result_item = results[results.size()];
@@ -139,8 +143,24 @@ namespace phantom {
 
 			} while (false);
 
-			TransactionFrm::pointer ptr = std::make_shared<TransactionFrm>(tran_env);
-			GlueManager::Instance().OnTransaction(ptr, result);
+			txs.push_back(std::make_shared<TransactionFrm>(tran_env, false));
+			tx_results.push_back(result);
+		}
+
+		TransactionFrm::VerifySignatures(txs);
+
+		for (size_t j = 0; j < txs.size() && running; j++) {
+			TransactionFrm::pointer ptr = txs[j];
+			Result &result = tx_results[j];
+			Json::Value &result_item = results[(Json::UInt)j];
+			if (GlueManager::Instance().IsAdmissionBusy()) {
+				//received transactions are backing up, let the client retry later
+				result.set_code(protocol::ERRCODE_OUT_OF_TXCACHE);
+				result.set_desc("Transaction admission is busy, try again later");
+			}
+			else {
+				GlueManager::Instance().OnTransaction(ptr, result);
+			}
 
 			if (result.code() == protocol::ERRCODE_SUCCESS) {
 				PeerManager::Instance().Broadcast(protocol::OVERLAY_MSGTYPE_TRANSACTION, ptr->GetFullData());
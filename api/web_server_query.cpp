@@ -35,7 +35,9 @@ namespace phantom {
 		Json::Value record = Json::Value(Json::arrayValue);
 		Json::Value &result = reply_json["result"];
 
-		if (!Environment::AccountFromDB(address, acc)) {
+		//read at the last written ledger, no ledger lock and no half written close
+		LedgerView::pointer view = LedgerManager::Instance().GetLedgerView();
+		if (!Environment::AccountFromDB(address, acc, view->account_snapshot_)) {
 			error_code = protocol::ERRCODE_NOT_EXIST;
 			LOG_TRACE("GetAccount fail, account(%s) not exist", address.c_str());
 		}
@@ -68,7 +70,8 @@ namespace phantom {
 		Json::Value record = Json::Value(Json::arrayValue);
 		Json::Value &result = reply_json["result"];
 
-		if (!Environment::AccountFromDB(address, acc)) {
+		LedgerView::pointer view = LedgerManager::Instance().GetLedgerView();
+		if (!Environment::AccountFromDB(address, acc, view->account_snapshot_)) {
 			error_code = protocol::ERRCODE_NOT_EXIST;
 			LOG_TRACE("GetAccount fail, account(%s) not exist", address.c_str());
 		}
@@ -77,13 +80,13 @@ namespace phantom {
 			Json::Value& metadatas = result["metadatas"];
 			if (!storagekey.empty()) {
 				protocol::KeyPair value_ptr;
-				if (acc->GetMetaData(storagekey, value_ptr)) {
+				if (acc->GetMetaData(storagekey, value_ptr, view->account_snapshot_)) {
 					metadatas[(Json::UInt)0] = phantom::Proto2Json(value_ptr);
 				}
 			}
 			else {
 				std::vector<protocol::KeyPair> metadata;
-				acc->GetAllMetaData(metadata);
+				acc->GetAllMetaData(metadata, view->account_snapshot_);
 
 				for (size_t i = 0; i < metadata.size(); i++) {
 					metadatas[i] = Proto2Json(metadata[i]);
@@ -97,13 +100,13 @@ namespace phantom {
 				p.set_code(code);
 				p.set_type(asset_type);
 				protocol::AssetStore asset;
-				if (acc->GetAsset(p, asset)) {
+				if (acc->GetAsset(p, asset, view->account_snapshot_)) {
 					jsonassets[(Json::UInt)0] = Proto2Json(asset);
 				}
 			}
 			else {
 				std::vector<protocol::AssetStore> assets;
-				acc->GetAllAssets(assets);
+				acc->GetAllAssets(assets, view->account_snapshot_);
 				for (size_t i = 0; i < assets.size(); i++) {
 					jsonassets[i] = Proto2Json(assets[i]);
 				}
@@ -133,20 +136,21 @@ namespace phantom {
 		Json::Value record = Json::Value(Json::arrayValue);
 		Json::Value &result = reply_json["result"];
 
-		if (!Environment::AccountFromDB(address, acc)) {
+		LedgerView::pointer view = LedgerManager::Instance().GetLedgerView();
+		if (!Environment::AccountFromDB(address, acc, view->account_snapshot_)) {
 			error_code = protocol::ERRCODE_NOT_EXIST;
 			LOG_TRACE("account(%s) not exist", address.c_str());
 		}
 		else {
 			if (!metadata_key.empty()) {
 				protocol::KeyPair value_ptr;
-				if (acc->GetMetaData(metadata_key, value_ptr)) {
+				if (acc->GetMetaData(metadata_key, value_ptr, view->account_snapshot_)) {
 					result[metadata_key] = phantom::Proto2Json(value_ptr);
 				}
 			}
 			else {
 				std::vector<protocol::KeyPair> metadata;
-				acc->GetAllMetaData(metadata);
+				acc->GetAllMetaData(metadata, view->account_snapshot_);
 				for (size_t i = 0; i < metadata.size(); i++) {
 					result[metadata[i].key()] = Proto2Json(metadata[i]);
 				}
@@ -164,8 +168,8 @@ namespace phantom {
 		auto x = LedgerManager::Instance().tree_->GetNode(location);
 		Json::Value ret;
 		ret["ret"] = phantom::Proto2Json(x);
-		ret["NEW"] = NodeFrm::NEWCOUNT;
-		ret["DEL"] = NodeFrm::DELCOUNT;
+		ret["NEW"] = (Json::Int64)NodeFrm::NEWCOUNT.load();
+		ret["DEL"] = (Json::Int64)NodeFrm::DELCOUNT.load();
 
 		reply = ret.toStyledString();
 	}
@@ -189,7 +193,8 @@ namespace phantom {
 		Json::Value record = Json::Value(Json::arrayValue);
 		Json::Value &result = reply_json["result"];
 
-		if (!Environment::AccountFromDB(address, acc)) {
+		LedgerView::pointer view = LedgerManager::Instance().GetLedgerView();
+		if (!Environment::AccountFromDB(address, acc, view->account_snapshot_)) {
 			error_code = protocol::ERRCODE_NOT_EXIST;
 			LOG_TRACE("GetAccount fail, account(%s) not exist", address.c_str());
 		}
@@ -201,13 +206,13 @@ namespace phantom {
 				p.set_code(code);
 				p.set_type(asset_type);
 				protocol::AssetStore asset;
-				if (acc->GetAsset(p, asset)) {
+				if (acc->GetAsset(p, asset, view->account_snapshot_)) {
 					result["asset"] = Proto2Json(asset);
 				}
 			}
 			else {
 				std::vector<protocol::AssetStore> assets;
-				acc->GetAllAssets(assets);
+				acc->GetAllAssets(assets, view->account_snapshot_);
 				for (size_t i = 0; i < assets.size(); i++) {
 					result[i] = Proto2Json(assets[i]);
 				}
@@ -327,7 +332,8 @@ namespace phantom {
 
 			protocol::EntryList list;
 			//avoid scan the whole table
-			protocol::LedgerHeader header = LedgerManager::Instance().GetLastClosedLedger();
+			LedgerView::pointer view = LedgerManager::Instance().GetLedgerView();
+			const protocol::LedgerHeader &header = view->header_;
 			if (!seq.empty()) {
 				std::string hashlist;
 				if (db->Get(ComposePrefix(General::LEDGER_TRANSACTION_PREFIX, seq), hashlist) <= 0) {
@@ -363,19 +369,24 @@ namespace phantom {
 				result["total_count"] = list.entry_size();
 			}
 
+			std::vector<std::string> hashes;
 			for (int32_t i = start_int;
 				i < list.entry_size() &&
-				error_code == protocol::ERRCODE_SUCCESS &&
 				i < start_int + limit_int;
 			i++) {
-				TransactionFrm txfrm;
-				if (txfrm.LoadFromDb(list.entry(i)) > 0) {
-					result["total_count"] = 0;
-					error_code = protocol::ERRCODE_NOT_EXIST;
-					break;
-				}
+				hashes.push_back(list.entry(i));
+			}
+
+			std::vector<TransactionFrm::pointer> txfrms;
+			if (TransactionFrm::LoadFromDb(hashes, txfrms) > 0) {
+				result["total_count"] = 0;
+				error_code = protocol::ERRCODE_NOT_EXIST;
+				break;
+			}
+
+			for (size_t i = 0; i < txfrms.size(); i++) {
 				Json::Value m;
-				txfrm.ToJson(m);
+				txfrms[i]->ToJson(m);
 				txs[txs.size()] = m;
 			}
 		} while (false);
@@ -523,9 +534,9 @@ namespace phantom {
 		Json::Value reply_json = Json::Value(Json::objectValue);
 		Json::Value &result = reply_json["result"];
 
-		const protocol::LedgerHeader &ledger = LedgerManager::Instance().GetLastClosedLedger();
-		result["transaction_count"] = ledger.tx_count();
-		result["account_count"] = LedgerManager::Instance().GetAccountNum();
+		LedgerView::pointer view = LedgerManager::Instance().GetLedgerView();
+		result["transaction_count"] = view->header_.tx_count();
+		result["account_count"] = view->account_count_;
 
 		reply_json["error_code"] = error_code;
 		reply = reply_json.toStyledString();
@@ -577,7 +588,7 @@ namespace phantom {
 
 		/// default last closed ledger
 		if (ledger_seq.empty())
-			ledger_seq = utils::String::ToString(LedgerManager::Instance().GetLastClosedLedger().seq());
+			ledger_seq = utils::String::ToString(LedgerManager::Instance().GetLedgerView()->header_.seq());
 
 
 		int32_t error_code = protocol::ERRCODE_SUCCESS;
@@ -789,7 +800,8 @@ namespace phantom {
 		Json::Value &result = reply_json["result"];
 
 		do {
-			if (!Environment::AccountFromDB(address, acc)) {
+			LedgerView::pointer view = LedgerManager::Instance().GetLedgerView();
+			if (!Environment::AccountFromDB(address, acc, view->account_snapshot_)) {
 				error_code = protocol::ERRCODE_NOT_EXIST;
 				error_desc = utils::String::Format("Account(%s) not exist", address.c_str());
 				LOG_ERROR("%s", error_desc.c_str());
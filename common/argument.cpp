@@ -31,7 +31,14 @@ namespace phantom {
 		clear_consensus_status_(false),
 		log_dest_(-1),
 		console_(false),
-		create_hardfork_(false){}
+		create_hardfork_(false),
+		check_account_index_(false),
+		migrate_column_families_(0),
+		bench_admission_(0),
+		bench_account_read_(0),
+		bench_trie_(0),
+		bench_top_transaction_(0),
+		crash_persist_(0){}
 	Argument::~Argument() {}
 
 	bool Argument::Parse(int argc, char *argv[]) {
@@ -149,6 +156,18 @@ namespace phantom {
 			else if (s == "--create-hardfork") {
 				create_hardfork_ = true;
 			}
+			else if (s == "--check-account-index") {
+				check_account_index_ = true;
+			}
+			else if (s == "--migrate-column-families") {
+				migrate_column_families_ = (argc > 2 && std::string(argv[2]) == "compare") ? 2 : 1;
+			}
+			else if (s == "--create-checkpoint" && argc > 2) {
+				create_checkpoint_ = argv[2];
+			}
+			else if (s == "--restore-checkpoint" && argc > 2) {
+				restore_checkpoint_ = argv[2];
+			}
 			else if (s == "--version") {
 #ifdef SVNVERSION
 				printf("%s,%u; " SVNVERSION "\n", General::PHANTOM_VERSION, General::LEDGER_VERSION);
@@ -165,6 +184,45 @@ namespace phantom {
 				printf("%s\n", PublicKey::Verify(utils::String::HexStringToBin(argv[2]), utils::String::HexStringToBin(argv[3]), argv[4]) ? "true" : "false");
 				return true;
 			}
+			else if (s == "--bench-verify") {
+				BenchVerify(argc, argv);
+				return true;
+			}
+			else if (s == "--bench-admission") {
+				bench_admission_ = argc > 2 ? utils::String::Stoi(argv[2]) : 10000;
+				if (bench_admission_ <= 0) {
+					printf("the count of transactions must be positive\n");
+					return true;
+				}
+			}
+			else if (s == "--bench-account-read") {
+				bench_account_read_ = argc > 2 ? utils::String::Stoi64(argv[2]) : 1000000;
+				if (bench_account_read_ <= 0) {
+					printf("the count of accounts must be positive\n");
+					return true;
+				}
+			}
+			else if (s == "--bench-trie") {
+				bench_trie_ = argc > 2 ? utils::String::Stoi64(argv[2]) : 1000000;
+				if (bench_trie_ <= 0) {
+					printf("the count of keys must be positive\n");
+					return true;
+				}
+			}
+			else if (s == "--bench-top-transaction") {
+				bench_top_transaction_ = argc > 2 ? utils::String::Stoi(argv[2]) : 50000;
+				if (bench_top_transaction_ <= 0) {
+					printf("the count of transactions must be positive\n");
+					return true;
+				}
+			}
+			else if (s == "--crash-persist") {
+				crash_persist_ = argc > 2 ? utils::String::Stoi(argv[2]) : 100;
+				if (crash_persist_ <= 0) {
+					printf("the count of rounds must be positive\n");
+					return true;
+				}
+			}
 			else if (s == "--check-address" && argc > 2) {
 				printf("%s\n", PublicKey::IsAddressValid(argv[2]) ? "ok" : "error");
 				return true;
@@ -396,18 +454,24 @@ namespace phantom {
 
 				printf("1:list all key and values\n");
 				printf("2:query one key\n");
+				printf("3:list key and values with a prefix\n");
 				char ch;
 				std::cin >> ch;
-				if (ch == '1'){
-#ifdef WIN32
-					auto it = (leveldb::Iterator*)ledger_db_->NewIterator();
-#else
-					auto it = (rocksdb::Iterator*)ledger_db_->NewIterator();
-#endif
+				if (ch == '1' || ch == '3'){
+					ReadRange range;
+					if (ch == '3') {
+						printf("\ninput prefix:");
+						std::string prefix;
+						std::cin >> prefix;
+						range = ReadRange::Prefix(prefix);
+					}
+					range.fill_cache_ = false;
+					KeyValueIterator *it = ledger_db_->NewIterator(range);
 					for (it->SeekToFirst(); it->Valid(); it->Next()){
 						printf("%s:%s\n", utils::String::BinToHexString(it->key().ToString()).c_str(),
 							utils::String::BinToHexString(it->value().ToString()).c_str());
 					}
+					delete it;
 				}
 				else if (ch == '2')
 					while (true){
@@ -445,6 +509,12 @@ namespace phantom {
 			"  --sign-data <node-priv-key> <blob data>                       sign blob data\n"
 			"  --check-signed-data <blob data> <signed data> <public key>    check signed data\n"
 			"  --check-address <address>                                     check address\n"
+			"  --bench-verify [count]                                        compare one by one and batch ed25519 verification\n"
+			"  --bench-admission [count]                                     transaction admission throughput by worker count\n"
+			"  --bench-account-read [count]                                  read latency of the account index and the account tree up to count accounts\n"
+			"  --bench-trie [count]                                          memory per node of a tree of count keys, in the node pools and the heap\n"
+			"  --bench-top-transaction [count]                               time of the proposed set of 10000 from count pooled transactions\n"
+			"  --crash-persist [rounds]                                      kill a process writing ledgers and check the dbs after each kill\n"
 			"  --hardware-address                                            get local hardware address\n"
 			"  --clear-consensus-status                                      delete consensus status\n"
 			"  --sm3 <arg>                                                   generate sm3 hash \n"
@@ -452,6 +522,10 @@ namespace phantom {
 			"  --aes-crypto <value>                                          crypto value\n"
 			"  --version                                                     display version information\n"
 			"  --create-hardfork                                             create hard fork ledger\n"
+			"  --check-account-index                                         rebuild the account index from the account tree\n"
+			"  --migrate-column-families [compare]                           move the ledger and account db into column families\n"
+			"  --create-checkpoint <dir>                                     link the dbs at the last closed ledger into dir\n"
+			"  --restore-checkpoint <dir>                                    start from the dbs of a checkpoint\n"
 			"  --clear-peer-addresses                                        clear peer list\n"
 			"  --create-keystore <password>                                  create key store\n"
 			"  --create-keystore-from-privatekey <private key> <password>    create key store from private key\n"
@@ -479,6 +553,62 @@ namespace phantom {
         printf("local peer address (%s)\n", private_key.GetEncAddress().c_str());
 	}
 
+	void Argument::BenchVerify(int argc, char *argv[]) {
+		int32_t count = 10000;
+		if (argc > 2) {
+			count = utils::String::Stoi(argv[2]);
+		}
+		if (count <= 0) {
+			printf("the count of signatures must be positive\n");
+			return;
+		}
+
+		//a few signers like a busy ledger, each signature on its own message
+		std::vector<std::string> public_keys, messages, signatures;
+		for (int32_t i = 0; i < 64 && i < count; i++) {
+			PrivateKey priv_key(SIGNTYPE_ED25519);
+			public_keys.push_back(priv_key.GetEncPublicKey());
+			for (int32_t j = i; j < count; j += 64) {
+				messages.push_back(utils::String::Format("bench verify message %d", j));
+				signatures.push_back(priv_key.Sign(messages.back()));
+			}
+		}
+
+		std::vector<SignatureItem> items(messages.size());
+		for (size_t i = 0, n = 0; i < public_keys.size(); i++) {
+			for (int32_t j = i; j < count; j += 64, n++) {
+				items[n].data_ = &messages[n];
+				items[n].sign_data_ = &signatures[n];
+				items[n].public_key_ = &public_keys[i];
+				items[n].valid_ = false;
+			}
+		}
+
+		int64_t t1 = utils::Timestamp::HighResolution();
+		size_t single_valid = 0;
+		for (size_t i = 0; i < items.size(); i++) {
+			if (PublicKey::Verify(*items[i].data_, *items[i].sign_data_, *items[i].public_key_)) {
+				single_valid++;
+			}
+		}
+		int64_t t2 = utils::Timestamp::HighResolution();
+		PublicKey::VerifyBatch(items);
+		int64_t t3 = utils::Timestamp::HighResolution();
+
+		size_t batch_valid = 0;
+		for (size_t i = 0; i < items.size(); i++) {
+			if (items[i].valid_) batch_valid++;
+		}
+
+		Json::Value result = Json::Value(Json::objectValue);
+		result["count"] = (Json::UInt64)items.size();
+		result["single_valid"] = (Json::UInt64)single_valid;
+		result["batch_valid"] = (Json::UInt64)batch_valid;
+		result["single_per_second"] = (Json::Int64)(items.size() * utils::MICRO_UNITS_PER_SEC / std::max<int64_t>(t2 - t1, 1));
+		result["batch_per_second"] = (Json::Int64)(items.size() * utils::MICRO_UNITS_PER_SEC / std::max<int64_t>(t3 - t2, 1));
+		printf("%s\n", result.toStyledString().c_str());
+	}
+
 	void Argument::ShowHardwareAddress() {
 		std::string hard_address = "";
 		utils::System system;
@@ -33,11 +33,21 @@ namespace phantom {
 		bool clear_peer_addresses_;
 		bool clear_consensus_status_;
 		bool create_hardfork_;
+		bool check_account_index_;
+		int32_t migrate_column_families_; //0 no, 1 migrate, 2 migrate and compare with the flat layout
+		std::string create_checkpoint_;
+		std::string restore_checkpoint_;
+		int32_t bench_admission_;
+		int64_t bench_account_read_;
+		int64_t bench_trie_;
+		int32_t bench_top_transaction_;
+		int32_t crash_persist_;
 
 		bool Parse(int argc, char *argv[]);
 		void Usage();
 		void ShowHardwareAddress();
 		void ShowNodeId(int argc, char *argv[]);
+		void BenchVerify(int argc, char *argv[]);
 		void RequestCert(int argc, char *argv[]);
 		void ShowRequest(int argc, char *argv[]);
 	};
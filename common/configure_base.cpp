@@ -26,6 +26,17 @@ namespace phantom {
 		tmp_path_ = "tmp";
 		async_write_sql_ = false; //default sync write sql
 		async_write_kv_ = false; //default sync write kv
+		column_families_ = false;
+		block_cache_size_ = 128;
+		memory_read_latency_ = 0;
+		memory_write_latency_ = 0;
+		history_path_ = "data/history";
+		history_depth_ = 0;
+		history_segment_ledgers_ = 10000;
+		keyvalue_durability_ = "sync";
+		ledger_durability_ = "sync";
+		account_durability_ = "sync";
+		group_sync_interval_ = 100;
 	}
 
 	DbConfigure::~DbConfigure() {}
@@ -40,6 +51,21 @@ namespace phantom {
 		ConfigureBase::GetValue(value, "tmp_path", tmp_path_);
 		ConfigureBase::GetValue(value, "async_write_sql", async_write_sql_);
 		ConfigureBase::GetValue(value, "async_write_kv", async_write_kv_);
+		ConfigureBase::GetValue(value, "column_families", column_families_);
+		ConfigureBase::GetValue(value, "block_cache_size", block_cache_size_);
+		ConfigureBase::GetValue(value, "engine", engine_);
+		ConfigureBase::GetValue(value, "memory_read_latency", memory_read_latency_);
+		ConfigureBase::GetValue(value, "memory_write_latency", memory_write_latency_);
+		ConfigureBase::GetValue(value, "history_path", history_path_);
+		ConfigureBase::GetValue(value, "history_depth", history_depth_);
+		ConfigureBase::GetValue(value, "history_segment_ledgers", history_segment_ledgers_);
+		if (history_segment_ledgers_ == 0) {
+			history_segment_ledgers_ = 10000;
+		}
+		ConfigureBase::GetValue(value, "keyvalue_durability", keyvalue_durability_);
+		ConfigureBase::GetValue(value, "ledger_durability", ledger_durability_);
+		ConfigureBase::GetValue(value, "account_durability", account_durability_);
+		ConfigureBase::GetValue(value, "group_sync_interval", group_sync_interval_);
 
 
 		std::string rational_decode;
@@ -69,6 +95,10 @@ namespace phantom {
 			account_db_path_ = utils::String::Format("%s/%s", utils::File::GetBinHome().c_str(), account_db_path_.c_str());
 		}
 
+		if (!utils::File::IsAbsolute(history_path_)) {
+			history_path_ = utils::String::Format("%s/%s", utils::File::GetBinHome().c_str(), history_path_.c_str());
+		}
+
 		if (!utils::File::IsAbsolute(tmp_path_)) {
 			tmp_path_ = utils::String::Format("%s/%s", utils::File::GetBinHome().c_str(), tmp_path_.c_str());
 		}
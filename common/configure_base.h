@@ -53,6 +53,18 @@ namespace phantom {
 		std::string tmp_path_;
 		bool async_write_sql_;
 		bool async_write_kv_;
+		bool column_families_; //create new ledger and account dbs with a column family per keyspace
+		uint32_t block_cache_size_; //MB of block cache shared by all dbs
+		std::string engine_; //"memory" keeps every db in memory, empty for the disk db
+		uint32_t memory_read_latency_; //us spent by each read of the memory db
+		uint32_t memory_write_latency_; //us spent by each synced write of the memory db
+		std::string history_path_; //segment files of the ledgers moved out of the ledger db
+		int64_t history_depth_; //ledgers kept in the ledger db below the last one, 0 to keep every ledger there
+		uint32_t history_segment_ledgers_; //ledgers per segment file
+		std::string keyvalue_durability_; //"sync" every write (default), "group" synced each group_sync_interval, "wal" left to the os
+		std::string ledger_durability_; //of the writes of the ledger db which are not closing a ledger
+		std::string account_durability_; //of the writes of the account db which are not closing a ledger
+		uint32_t group_sync_interval_; //ms a group write may wait for the sync of the log
 		bool Load(const Json::Value &value);
 	};
 
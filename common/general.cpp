@@ -72,8 +72,12 @@ namespace phantom {
 	const char *General::CONSENSUS_VALUE_PREFIX = "cosv";
 
 	const char *General::ACCOUNT_PREFIX = "acc";
+	const char *General::ACCOUNT_INDEX_PREFIX = "acci";
+	const char *General::KEY_ACCOUNT_INDEX = "account_index";
 	const char *General::ASSET_PREFIX = "ast";
 	const char *General::METADATA_PREFIX = "meta";
+	const char *General::STATE_SYNC_PREFIX = "sync";
+	const char *General::KEY_STATE_SYNC_INSTALL = "state_sync_install";
 
 	const char *General::CHECK_TIME_FUNCTION = "internal_check_time";
 
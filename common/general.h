@@ -88,8 +88,12 @@ namespace phantom {
 		const static char *VALIDATORS;
 
 		const static char *ACCOUNT_PREFIX;
+		const static char *ACCOUNT_INDEX_PREFIX;
+		const static char *KEY_ACCOUNT_INDEX;
 		const static char *ASSET_PREFIX;
 		const static char *METADATA_PREFIX;
+		const static char *STATE_SYNC_PREFIX;
+		const static char *KEY_STATE_SYNC_INSTALL;
 
 		const static char *CHECK_TIME_FUNCTION;
 
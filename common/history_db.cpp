@@ -0,0 +1,740 @@
+/*
+	phantom is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	phantom is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with phantom.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <algorithm>
+#include <zlib.h>
+#ifndef WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+#include <utils/logger.h>
+#include <utils/file.h>
+#include <proto/cpp/overlay.pb.h>
+#include "general.h"
+#include "history_db.h"
+
+//a seq index entry every this many ledgers
+#define HISTORY_SEQ_INDEX_INTERVAL 64
+#define HISTORY_SEGMENT_MAGIC 0x53485048
+#define HISTORY_FIELD_ABSENT 0xffffffff
+//ledger header, consensus value and transaction list, then the transactions
+#define HISTORY_LEDGER_FIELDS 3
+//sha256 and sm3 hashes, the only hash types of a chain
+#define HISTORY_HASH_SIZE 32
+
+namespace phantom {
+
+	//read-only view of a whole file
+	class MappedFile {
+	public:
+		MappedFile() :data_(NULL), size_(0) {}
+		~MappedFile() {
+#ifndef WIN32
+			if (data_ != NULL) {
+				munmap((void *)data_, size_);
+			}
+#endif
+		}
+
+		bool Open(const std::string &path) {
+#ifdef WIN32
+			utils::File file;
+			if (!file.Open(path, utils::File::FILE_M_READ | utils::File::FILE_M_BINARY)) {
+				return false;
+			}
+			size_t size = (size_t)utils::File::GetAttribue(path).size_;
+			if (file.ReadData(buffer_, size) != size) {
+				return false;
+			}
+			data_ = buffer_.data();
+			size_ = buffer_.size();
+			return true;
+#else
+			int fd = open(path.c_str(), O_RDONLY);
+			if (fd < 0) {
+				return false;
+			}
+
+			struct stat st;
+			if (fstat(fd, &st) != 0 || st.st_size == 0) {
+				close(fd);
+				return false;
+			}
+
+			void *data = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+			close(fd);
+			if (data == MAP_FAILED) {
+				return false;
+			}
+			//point reads of single records
+			madvise(data, (size_t)st.st_size, MADV_RANDOM);
+			data_ = (const char *)data;
+			size_ = (size_t)st.st_size;
+			return true;
+#endif
+		}
+
+		const char *data() const { return data_; }
+		size_t size() const { return size_; }
+
+	private:
+		const char *data_;
+		size_t size_;
+#ifdef WIN32
+		std::string buffer_;
+#endif
+	};
+
+	template<typename T>
+	static void PutFixed(std::string &out, T value) {
+		out.append((const char *)&value, sizeof(value));
+	}
+
+	template<typename T>
+	static bool GetFixed(const char *data, size_t size, size_t &pos, T &value) {
+		if (pos + sizeof(value) > size) {
+			return false;
+		}
+		memcpy(&value, data + pos, sizeof(value));
+		pos += sizeof(value);
+		return true;
+	}
+
+	//an archived ledger, fields absent from the ledger db are null
+	struct LedgerRecord {
+		std::vector<std::shared_ptr<std::string>> fields_;
+		protocol::EntryList hashes_;
+	};
+
+	class HistoryDb::Segment {
+	public:
+		Segment() :first_seq_(0), last_seq_(0), seq_index_offset_(0), tx_index_offset_(0), tx_count_(0), hash_size_(0) {}
+
+		bool Open(const std::string &path) {
+			path_ = path;
+			if (!file_.Open(path)) {
+				return false;
+			}
+
+			//footer: seq index offset, tx index offset, tx count, hash size, first seq, last seq, magic
+			size_t footer_size = 8 + 8 + 4 + 4 + 8 + 8 + 4;
+			if (file_.size() < footer_size) {
+				return false;
+			}
+			size_t pos = file_.size() - footer_size;
+			uint32_t magic = 0;
+			GetFixed(file_.data(), file_.size(), pos, seq_index_offset_);
+			GetFixed(file_.data(), file_.size(), pos, tx_index_offset_);
+			GetFixed(file_.data(), file_.size(), pos, tx_count_);
+			GetFixed(file_.data(), file_.size(), pos, hash_size_);
+			GetFixed(file_.data(), file_.size(), pos, first_seq_);
+			GetFixed(file_.data(), file_.size(), pos, last_seq_);
+			GetFixed(file_.data(), file_.size(), pos, magic);
+			if (magic != HISTORY_SEGMENT_MAGIC || first_seq_ > last_seq_ ||
+				seq_index_offset_ > tx_index_offset_ || tx_index_offset_ > file_.size() - footer_size) {
+				return false;
+			}
+
+			//the indexes are read without bound checks, so they must fit between their offsets
+			uint64_t seq_index_size = (uint64_t)((last_seq_ - first_seq_) / HISTORY_SEQ_INDEX_INTERVAL + 1) * sizeof(uint64_t);
+			uint64_t tx_index_size = (uint64_t)tx_count_ * (hash_size_ + sizeof(uint64_t));
+			return (hash_size_ == HISTORY_HASH_SIZE || (hash_size_ == 0 && tx_count_ == 0)) &&
+				seq_index_offset_ + seq_index_size <= tx_index_offset_ &&
+				tx_index_offset_ + tx_index_size <= file_.size() - footer_size;
+		}
+
+		bool ReadLedger(int64_t seq, LedgerRecord &record) const {
+			if (seq < first_seq_ || seq > last_seq_) {
+				return false;
+			}
+
+			//closest indexed record, then skip the records before seq
+			size_t pos = (size_t)seq_index_offset_ + (size_t)((seq - first_seq_) / HISTORY_SEQ_INDEX_INTERVAL) * sizeof(uint64_t);
+			uint64_t offset = 0;
+			if (!GetFixed(file_.data(), (size_t)tx_index_offset_, pos, offset)) {
+				return false;
+			}
+
+			while (offset < seq_index_offset_) {
+				size_t record_pos = (size_t)offset;
+				int64_t record_seq = 0;
+				uint32_t raw_size = 0, size = 0;
+				if (!GetFixed(file_.data(), (size_t)seq_index_offset_, record_pos, record_seq) ||
+					!GetFixed(file_.data(), (size_t)seq_index_offset_, record_pos, raw_size) ||
+					!GetFixed(file_.data(), (size_t)seq_index_offset_, record_pos, size)) {
+					return false;
+				}
+				if (record_seq == seq) {
+					return ReadRecord(offset, record);
+				}
+				offset = record_pos + size;
+			}
+			return false;
+		}
+
+		bool ReadRecord(uint64_t offset, LedgerRecord &record) const {
+			size_t pos = (size_t)offset;
+			int64_t seq = 0;
+			uint32_t raw_size = 0, size = 0;
+			if (!GetFixed(file_.data(), (size_t)seq_index_offset_, pos, seq) ||
+				!GetFixed(file_.data(), (size_t)seq_index_offset_, pos, raw_size) ||
+				!GetFixed(file_.data(), (size_t)seq_index_offset_, pos, size) ||
+				pos + size > seq_index_offset_) {
+				return false;
+			}
+
+			std::string raw;
+			raw.resize(raw_size);
+			uLongf dest_size = raw_size;
+			if (uncompress((Bytef *)&raw[0], &dest_size, (const Bytef *)file_.data() + pos, size) != Z_OK || dest_size != raw_size) {
+				return false;
+			}
+
+			record.fields_.clear();
+			size_t raw_pos = 0;
+			while (raw_pos < raw.size()) {
+				uint32_t length = 0;
+				if (!GetFixed(raw.data(), raw.size(), raw_pos, length)) {
+					return false;
+				}
+				if (length == HISTORY_FIELD_ABSENT) {
+					record.fields_.push_back(nullptr);
+					continue;
+				}
+				if (raw_pos + length > raw.size()) {
+					return false;
+				}
+				record.fields_.push_back(std::make_shared<std::string>(raw.data() + raw_pos, length));
+				raw_pos += length;
+			}
+
+			if (record.fields_.size() < HISTORY_LEDGER_FIELDS) {
+				return false;
+			}
+			record.hashes_.Clear();
+			return record.fields_[2] == nullptr || record.hashes_.ParseFromString(*record.fields_[2]);
+		}
+
+		//offset of the record of the ledger which has the transaction, -1 if it is not in the segment
+		int64_t FindTransaction(const std::string &hash) const {
+			if (hash.size() != hash_size_ || tx_count_ == 0) {
+				return -1;
+			}
+
+			size_t entry_size = hash_size_ + sizeof(uint64_t);
+			const char *index = file_.data() + tx_index_offset_;
+			uint32_t low = 0, high = tx_count_;
+			while (low < high) {
+				uint32_t mid = low + (high - low) / 2;
+				int cmp = memcmp(index + (size_t)mid * entry_size, hash.data(), hash_size_);
+				if (cmp == 0) {
+					uint64_t offset = 0;
+					memcpy(&offset, index + (size_t)mid * entry_size + hash_size_, sizeof(offset));
+					return (int64_t)offset;
+				}
+				if (cmp < 0) low = mid + 1;
+				else high = mid;
+			}
+			return -1;
+		}
+
+		size_t size() const { return file_.size(); }
+
+		int64_t first_seq_;
+		int64_t last_seq_;
+		std::string path_;
+
+	private:
+		MappedFile file_;
+		uint64_t seq_index_offset_;
+		uint64_t tx_index_offset_;
+		uint32_t tx_count_;
+		uint32_t hash_size_;
+	};
+
+	HistoryDb::HistoryDb(KeyValueDb *db) :db_(db), depth_(0), segment_ledgers_(0), thread_(NULL), enabled_(false), next_seq_(1),
+		archived_bytes_(0), history_reads_(0), history_hits_(0), last_archive_time_(0) {}
+
+	HistoryDb::~HistoryDb() {
+		if (thread_ != NULL) {
+			Close();
+		}
+		delete db_;
+	}
+
+	bool HistoryDb::Initialize(const std::string &path, int64_t depth, uint32_t segment_ledgers) {
+		path_ = path;
+		depth_ = depth;
+		segment_ledgers_ = segment_ledgers;
+
+		if (!utils::File::IsExist(path_) && !utils::File::CreateDir(path_)) {
+			LOG_ERROR_ERRNO("Create history path(%s) failed", path_.c_str(), STD_ERR_CODE, STD_ERR_DESC);
+			return false;
+		}
+
+		utils::FileAttributes files;
+		utils::File::GetFileList(path_, files, false);
+		for (auto iter = files.begin(); iter != files.end(); iter++) {
+			std::string file_path = utils::String::Format("%s/%s", path_.c_str(), iter->first.c_str());
+			//a segment which was not complete when the node stopped
+			if (utils::File::GetExtension(iter->first) == "tmp") {
+				utils::File::Delete(file_path);
+				continue;
+			}
+			if (utils::File::GetExtension(iter->first) != "seg") {
+				continue;
+			}
+
+			SegmentPointer segment = std::make_shared<Segment>();
+			if (!segment->Open(file_path)) {
+				LOG_ERROR("Open history segment(%s) failed", file_path.c_str());
+				return false;
+			}
+			segments_.push_back(segment);
+			archived_bytes_ += segment->size();
+		}
+
+		std::sort(segments_.begin(), segments_.end(), [](const SegmentPointer &a, const SegmentPointer &b) {
+			return a->first_seq_ < b->first_seq_;
+		});
+		for (size_t i = 0; i < segments_.size(); i++) {
+			if (segments_[i]->first_seq_ < next_seq_) {
+				LOG_ERROR("History segment(%s) overlaps seq(" FMT_I64 ")", segments_[i]->path_.c_str(), next_seq_ - 1);
+				return false;
+			}
+			next_seq_ = segments_[i]->last_seq_ + 1;
+		}
+
+		//the node may have stopped after the last segment was written and before its ledgers were deleted
+		if (!segments_.empty() && !DeleteArchived(segments_.back())) {
+			return false;
+		}
+
+		enabled_ = true;
+		thread_ = new utils::Thread(this);
+		if (!thread_->Start("history")) {
+			delete thread_;
+			thread_ = NULL;
+			return false;
+		}
+
+		LOG_INFO("History db %s, " FMT_SIZE " segments up to seq(" FMT_I64 "), depth(" FMT_I64 "), %u ledgers per segment",
+			path_.c_str(), segments_.size(), next_seq_ - 1, depth_, segment_ledgers_);
+		return true;
+	}
+
+	bool HistoryDb::Open(const std::string &db_path, int max_open_files) {
+		return Check(db_->Open(db_path, max_open_files) ? 1 : -1) >= 0;
+	}
+
+	bool HistoryDb::Close() {
+		enabled_ = false;
+		if (thread_ != NULL) {
+			thread_->JoinWithStop();
+			delete thread_;
+			thread_ = NULL;
+		}
+		return db_->Close();
+	}
+
+	int32_t HistoryDb::Check(int32_t ret) {
+		if (ret < 0) {
+			utils::MutexGuard guard(mutex_);
+			error_desc_ = db_->error_desc();
+		}
+		return ret;
+	}
+
+	int32_t HistoryDb::Get(const std::string &key, std::string &value) {
+		int32_t ret = Check(db_->Get(key, value));
+		return ret != 0 ? ret : ReadHistory(key, value);
+	}
+
+	int32_t HistoryDb::Get(const std::string &key, std::string &value, const SNAPSHOT *snapshot) {
+		int32_t ret = Check(db_->Get(key, value, snapshot));
+		return ret != 0 ? ret : ReadHistory(key, value);
+	}
+
+	bool HistoryDb::MultiGet(const std::vector<std::string> &keys, std::vector<std::string> &values, std::vector<int32_t> &statuses) {
+		bool ret = Check(db_->MultiGet(keys, values, statuses) ? 1 : -1) >= 0;
+		for (size_t i = 0; i < keys.size(); i++) {
+			if (statuses[i] == 0) {
+				statuses[i] = ReadHistory(keys[i], values[i]);
+			}
+		}
+		return ret;
+	}
+
+	int32_t HistoryDb::ReadHistory(const std::string &key, std::string &value) {
+		static const std::string ledger_prefix = ComposePrefix(General::LEDGER_PREFIX, "");
+		static const std::string consensus_prefix = ComposePrefix(General::CONSENSUS_VALUE_PREFIX, "");
+		static const std::string list_prefix = ComposePrefix(General::LEDGER_TRANSACTION_PREFIX, "");
+		static const std::string tx_prefix = ComposePrefix(General::TRANSACTION_PREFIX, "");
+
+		//fields of a ledger record by key prefix
+		int32_t field = -1;
+		std::string rest;
+		if (key.compare(0, ledger_prefix.size(), ledger_prefix) == 0) {
+			field = 0;
+			rest = key.substr(ledger_prefix.size());
+		}
+		else if (key.compare(0, consensus_prefix.size(), consensus_prefix) == 0) {
+			field = 1;
+			rest = key.substr(consensus_prefix.size());
+		}
+		else if (key.compare(0, list_prefix.size(), list_prefix) == 0) {
+			field = 2;
+			rest = key.substr(list_prefix.size());
+		}
+		else if (key.compare(0, tx_prefix.size(), tx_prefix) == 0) {
+			rest = key.substr(tx_prefix.size());
+		}
+		else {
+			return 0;
+		}
+
+		history_reads_++;
+		LedgerRecord record;
+		if (field >= 0) {
+			SegmentPointer segment = FindSegment(utils::String::Stoi64(rest));
+			if (segment == nullptr || !segment->ReadLedger(utils::String::Stoi64(rest), record) || record.fields_[field] == nullptr) {
+				return 0;
+			}
+			value = *record.fields_[field];
+			history_hits_++;
+			return 1;
+		}
+
+		std::vector<SegmentPointer> segments;
+		do {
+			utils::ReadLockGuard guard(segments_lock_);
+			segments = segments_;
+		} while (false);
+
+		//recent transactions are read more often
+		for (size_t i = segments.size(); i > 0; i--) {
+			int64_t offset = segments[i - 1]->FindTransaction(rest);
+			if (offset < 0 || !segments[i - 1]->ReadRecord((uint64_t)offset, record)) {
+				continue;
+			}
+
+			for (int32_t j = 0; j < record.hashes_.entry_size(); j++) {
+				size_t index = HISTORY_LEDGER_FIELDS + (size_t)j;
+				if (record.hashes_.entry(j) == rest && index < record.fields_.size() && record.fields_[index] != nullptr) {
+					value = *record.fields_[index];
+					history_hits_++;
+					return 1;
+				}
+			}
+		}
+		return 0;
+	}
+
+	HistoryDb::SegmentPointer HistoryDb::FindSegment(int64_t seq) {
+		utils::ReadLockGuard guard(segments_lock_);
+		auto iter = std::upper_bound(segments_.begin(), segments_.end(), seq, [](int64_t seq, const SegmentPointer &segment) {
+			return seq < segment->first_seq_;
+		});
+		if (iter == segments_.begin() || seq > (*(iter - 1))->last_seq_) {
+			return nullptr;
+		}
+		return *(iter - 1);
+	}
+
+	void HistoryDb::Run(utils::Thread *thread) {
+		while (enabled_) {
+			Archive();
+			for (int32_t i = 0; i < 100 && enabled_; i++) {
+				utils::Sleep(100);
+			}
+		}
+	}
+
+	void HistoryDb::Archive() {
+		//the last ledger in the wrapped db, those in the write pipeline are not there yet
+		std::string str_seq;
+		if (db_->Get(General::KEY_LEDGER_SEQ, str_seq) <= 0) {
+			return;
+		}
+		int64_t max_seq = utils::String::Stoi64(str_seq);
+
+		while (enabled_ && next_seq_ + segment_ledgers_ - 1 <= max_seq - depth_) {
+			int64_t first_seq = FirstLedger(next_seq_, max_seq);
+			if (first_seq <= 0) {
+				return;
+			}
+			if (first_seq != next_seq_) {
+				LOG_INFO("No ledgers [" FMT_I64 "," FMT_I64 "] in the ledger db, history goes on from ledger(" FMT_I64 ")",
+					next_seq_, first_seq - 1, first_seq);
+				next_seq_ = first_seq;
+				continue;
+			}
+
+			int64_t begin = utils::Timestamp::HighResolution();
+			int64_t last_seq = next_seq_ + segment_ledgers_ - 1;
+			if (!WriteSegment(next_seq_, last_seq)) {
+				return;
+			}
+			next_seq_ = last_seq + 1;
+			last_archive_time_ = utils::Timestamp::HighResolution() - begin;
+		}
+	}
+
+	int64_t HistoryDb::FirstLedger(int64_t seq, int64_t max_seq) {
+		std::string header;
+		int32_t ret = db_->Get(ComposePrefix(General::LEDGER_PREFIX, seq), header);
+		if (ret != 0) {
+			return ret > 0 ? seq : -1;
+		}
+		ret = db_->Get(ComposePrefix(General::LEDGER_PREFIX, max_seq), header);
+		if (ret <= 0) {
+			return ret;
+		}
+
+		//low is missing and high is there
+		int64_t low = seq, high = max_seq;
+		while (low + 1 < high) {
+			int64_t mid = low + (high - low) / 2;
+			ret = db_->Get(ComposePrefix(General::LEDGER_PREFIX, mid), header);
+			if (ret < 0) {
+				return -1;
+			}
+			if (ret > 0) high = mid;
+			else low = mid;
+		}
+		return high;
+	}
+
+	bool HistoryDb::WriteSegment(int64_t first_seq, int64_t &last_seq) {
+		std::string tmp_path = utils::String::Format("%s/" FMT_I64 "-" FMT_I64 ".tmp", path_.c_str(), first_seq, last_seq);
+
+		utils::File file;
+		if (!file.Open(tmp_path, utils::File::FILE_M_WRITE | utils::File::FILE_M_BINARY)) {
+			LOG_ERROR_ERRNO("Open history segment(%s) failed", tmp_path.c_str(), STD_ERR_CODE, STD_ERR_DESC);
+			return false;
+		}
+
+		bool ok = true;
+		uint64_t offset = 0;
+		std::string seq_index;
+		std::vector<std::pair<std::string, uint64_t>> tx_index;
+		for (int64_t seq = first_seq; seq <= last_seq && ok && enabled_; seq++) {
+			std::vector<std::string> keys;
+			keys.push_back(ComposePrefix(General::LEDGER_PREFIX, seq));
+			keys.push_back(ComposePrefix(General::CONSENSUS_VALUE_PREFIX, seq));
+			keys.push_back(ComposePrefix(General::LEDGER_TRANSACTION_PREFIX, seq));
+			std::vector<std::string> values;
+			std::vector<int32_t> statuses;
+			protocol::EntryList hashes;
+			bool read = db_->MultiGet(keys, values, statuses);
+			if (read && statuses[0] == 0 && seq > first_seq) {
+				//the gap left by a state sync install, the segment ends before it
+				last_seq = seq - 1;
+				break;
+			}
+			if (!read || statuses[0] <= 0 ||
+				(statuses[2] > 0 && !hashes.ParseFromString(values[2]))) {
+				LOG_ERROR("Read ledger(" FMT_I64 ") for history failed(%s)", seq, db_->error_desc().c_str());
+				ok = false;
+				break;
+			}
+
+			std::vector<std::string> tx_keys;
+			for (int32_t i = 0; i < hashes.entry_size(); i++) {
+				tx_keys.push_back(ComposePrefix(General::TRANSACTION_PREFIX, hashes.entry(i)));
+			}
+			std::vector<std::string> tx_values;
+			std::vector<int32_t> tx_statuses;
+			if (!db_->MultiGet(tx_keys, tx_values, tx_statuses)) {
+				LOG_ERROR("Read transactions of ledger(" FMT_I64 ") for history failed(%s)", seq, db_->error_desc().c_str());
+				ok = false;
+				break;
+			}
+			keys.insert(keys.end(), tx_keys.begin(), tx_keys.end());
+			values.insert(values.end(), tx_values.begin(), tx_values.end());
+			statuses.insert(statuses.end(), tx_statuses.begin(), tx_statuses.end());
+
+			std::string raw;
+			for (size_t i = 0; i < values.size(); i++) {
+				if (statuses[i] <= 0) {
+					PutFixed<uint32_t>(raw, HISTORY_FIELD_ABSENT);
+					continue;
+				}
+				PutFixed<uint32_t>(raw, (uint32_t)values[i].size());
+				raw += values[i];
+			}
+
+			std::string compressed;
+			uLongf size = compressBound(raw.size());
+			compressed.resize(size);
+			if (compress2((Bytef *)&compressed[0], &size, (const Bytef *)raw.data(), raw.size(), Z_DEFAULT_COMPRESSION) != Z_OK) {
+				LOG_ERROR("Compress ledger(" FMT_I64 ") for history failed", seq);
+				ok = false;
+				break;
+			}
+			compressed.resize(size);
+
+			std::string record;
+			PutFixed<int64_t>(record, seq);
+			PutFixed<uint32_t>(record, (uint32_t)raw.size());
+			PutFixed<uint32_t>(record, (uint32_t)compressed.size());
+			record += compressed;
+			if (file.Write(record.data(), 1, record.size()) != record.size()) {
+				LOG_ERROR_ERRNO("Write history segment(%s) failed", tmp_path.c_str(), STD_ERR_CODE, STD_ERR_DESC);
+				ok = false;
+				break;
+			}
+
+			if ((seq - first_seq) % HISTORY_SEQ_INDEX_INTERVAL == 0) {
+				PutFixed<uint64_t>(seq_index, offset);
+			}
+			for (int32_t i = 0; i < hashes.entry_size(); i++) {
+				tx_index.push_back(std::make_pair(hashes.entry(i), offset));
+			}
+			offset += record.size();
+		}
+
+		uint32_t hash_size = tx_index.empty() ? 0 : HISTORY_HASH_SIZE;
+		std::sort(tx_index.begin(), tx_index.end());
+		std::string tail = seq_index;
+		uint32_t tx_count = 0;
+		for (size_t i = 0; i < tx_index.size(); i++) {
+			if (tx_index[i].first.size() != hash_size) {
+				continue;
+			}
+			tail += tx_index[i].first;
+			PutFixed<uint64_t>(tail, tx_index[i].second);
+			tx_count++;
+		}
+		PutFixed<uint64_t>(tail, offset);
+		PutFixed<uint64_t>(tail, offset + seq_index.size());
+		PutFixed<uint32_t>(tail, tx_count);
+		PutFixed<uint32_t>(tail, hash_size);
+		PutFixed<int64_t>(tail, first_seq);
+		PutFixed<int64_t>(tail, last_seq);
+		PutFixed<uint32_t>(tail, HISTORY_SEGMENT_MAGIC);
+
+		ok = ok && enabled_ && file.Write(tail.data(), 1, tail.size()) == tail.size() && file.Flush();
+#ifndef WIN32
+		ok = ok && fsync(fileno(file.handle_)) == 0;
+#endif
+		file.Close();
+		std::string seg_path = utils::String::Format("%s/" FMT_I64 "-" FMT_I64 ".seg", path_.c_str(), first_seq, last_seq);
+		if (!ok || !utils::File::Move(tmp_path, seg_path)) {
+			utils::File::Delete(tmp_path);
+			return false;
+		}
+
+		SegmentPointer segment = std::make_shared<Segment>();
+		if (!segment->Open(seg_path)) {
+			LOG_ERROR("Open history segment(%s) failed", seg_path.c_str());
+			return false;
+		}
+
+		//readable from the segment before the ledgers leave the wrapped db
+		do {
+			utils::WriteLockGuard guard(segments_lock_);
+			segments_.push_back(segment);
+		} while (false);
+		archived_bytes_ += segment->size();
+
+		LOG_INFO("Moved ledgers [" FMT_I64 "," FMT_I64 "] to history segment(%s), " FMT_SIZE " bytes",
+			first_seq, last_seq, seg_path.c_str(), segment->size());
+		return DeleteArchived(segment);
+	}
+
+	bool HistoryDb::DeleteArchived(const SegmentPointer &segment) {
+		WRITE_BATCH batch;
+		size_t count = 0;
+		for (int64_t seq = segment->first_seq_; seq <= segment->last_seq_; seq++) {
+			LedgerRecord record;
+			if (!segment->ReadLedger(seq, record)) {
+				LOG_ERROR("Read ledger(" FMT_I64 ") of history segment(%s) failed", seq, segment->path_.c_str());
+				return false;
+			}
+
+			batch.Delete(ComposePrefix(General::LEDGER_PREFIX, seq));
+			batch.Delete(ComposePrefix(General::CONSENSUS_VALUE_PREFIX, seq));
+			batch.Delete(ComposePrefix(General::LEDGER_TRANSACTION_PREFIX, seq));
+			for (int32_t i = 0; i < record.hashes_.entry_size(); i++) {
+				batch.Delete(ComposePrefix(General::TRANSACTION_PREFIX, record.hashes_.entry(i)));
+			}
+
+			if (++count % 1000 == 0 || seq == segment->last_seq_) {
+				if (!db_->WriteBatch(batch)) {
+					LOG_ERROR("Delete archived ledgers failed(%s)", db_->error_desc().c_str());
+					return false;
+				}
+				batch.Clear();
+			}
+		}
+		return true;
+	}
+
+	bool HistoryDb::Put(const std::string &key, const std::string &value) {
+		return Check(db_->Put(key, value) ? 1 : -1) >= 0;
+	}
+
+	bool HistoryDb::Delete(const std::string &key) {
+		return Check(db_->Delete(key) ? 1 : -1) >= 0;
+	}
+
+	bool HistoryDb::WriteBatch(WRITE_BATCH &values) {
+		return Check(db_->WriteBatch(values) ? 1 : -1) >= 0;
+	}
+
+	bool HistoryDb::WriteBatch(WRITE_BATCH &values, WriteDurability durability) {
+		return Check(db_->WriteBatch(values, durability) ? 1 : -1) >= 0;
+	}
+
+	bool HistoryDb::WriteBatchUnsynced(WRITE_BATCH &values) {
+		return Check(db_->WriteBatchUnsynced(values) ? 1 : -1) >= 0;
+	}
+
+	bool HistoryDb::Flush() {
+		return Check(db_->Flush() ? 1 : -1) >= 0;
+	}
+
+	KeyValueIterator *HistoryDb::NewIterator(const ReadRange &range) {
+		return db_->NewIterator(range);
+	}
+
+	const SNAPSHOT *HistoryDb::GetSnapshot() {
+		return db_->GetSnapshot();
+	}
+
+	void HistoryDb::ReleaseSnapshot(const SNAPSHOT *snapshot) {
+		db_->ReleaseSnapshot(snapshot);
+	}
+
+	bool HistoryDb::GetOptions(Json::Value &options) {
+		bool ret = db_->GetOptions(options);
+		Json::Value &history = options["history"];
+		do {
+			utils::ReadLockGuard guard(segments_lock_);
+			history["segment_count"] = (Json::UInt64)segments_.size();
+			history["archived_seq"] = (Json::Int64)(segments_.empty() ? 0 : segments_.back()->last_seq_);
+		} while (false);
+		history["depth"] = (Json::Int64)depth_;
+		history["segment_ledgers"] = segment_ledgers_;
+		history["archived_bytes"] = (Json::Int64)archived_bytes_.load();
+		history["reads"] = (Json::Int64)history_reads_.load();
+		history["hits"] = (Json::Int64)history_hits_.load();
+		history["last_archive_us"] = (Json::Int64)last_archive_time_.load();
+		return ret;
+	}
+}
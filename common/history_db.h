@@ -0,0 +1,94 @@
+/*
+	phantom is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	phantom is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with phantom.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef HISTORY_DB_H_
+#define HISTORY_DB_H_
+
+#include <atomic>
+#include "storage.h"
+
+namespace phantom {
+
+	//Tiered ledger db. Ledgers deeper than depth below the last written one are moved, a segment of
+	//segment_ledgers at a time, out of the wrapped db into immutable append-only files: one zlib record
+	//per ledger with its header, consensus value, transaction list and transactions, a sparse seq index
+	//and a sorted tx hash index. Reads of ledger and transaction keys missing from the wrapped db are
+	//served from the memory-mapped segments, so the wrapped db only keeps and compacts the recent tail
+	class HistoryDb : public KeyValueDb, public utils::Runnable {
+	public:
+		HistoryDb(KeyValueDb *db);
+		~HistoryDb();
+
+		//load the segments in path and start moving ledgers
+		bool Initialize(const std::string &path, int64_t depth, uint32_t segment_ledgers);
+
+		virtual bool Open(const std::string &db_path, int max_open_files) override;
+		virtual bool Close() override;
+		virtual int32_t Get(const std::string &key, std::string &value) override;
+		virtual int32_t Get(const std::string &key, std::string &value, const SNAPSHOT *snapshot) override;
+		virtual bool MultiGet(const std::vector<std::string> &keys, std::vector<std::string> &values, std::vector<int32_t> &statuses) override;
+		virtual bool Put(const std::string &key, const std::string &value) override;
+		virtual bool Delete(const std::string &key) override;
+		virtual bool GetOptions(Json::Value &options) override;
+		virtual bool WriteBatch(WRITE_BATCH &values) override;
+		virtual bool WriteBatch(WRITE_BATCH &values, WriteDurability durability) override;
+		virtual bool WriteBatchUnsynced(WRITE_BATCH &values) override;
+		virtual bool Flush() override;
+		virtual KeyValueIterator *NewIterator(const ReadRange &range) override;
+		virtual const SNAPSHOT *GetSnapshot() override;
+		virtual void ReleaseSnapshot(const SNAPSHOT *snapshot) override;
+
+		virtual void Run(utils::Thread *thread) override;
+
+	private:
+		class Segment;
+		typedef std::shared_ptr<Segment> SegmentPointer;
+
+		//key read from the segments, 0 if it is not a history key or not archived
+		int32_t ReadHistory(const std::string &key, std::string &value);
+		//the segment holding seq, null if it is not archived
+		SegmentPointer FindSegment(int64_t seq);
+		//move every full segment deep enough
+		void Archive();
+		//first ledger from seq on in the wrapped db, 0 if max_seq is not there, -1 on error. A state sync
+		//install leaves a gap below the installed ledger and every ledger after it is there
+		int64_t FirstLedger(int64_t seq, int64_t max_seq);
+		//last_seq is set to the ledger before a gap if the segment ends there
+		bool WriteSegment(int64_t first_seq, int64_t &last_seq);
+		//remove the ledgers of segment from the wrapped db
+		bool DeleteArchived(const SegmentPointer &segment);
+		int32_t Check(int32_t ret);
+
+		KeyValueDb *db_;
+		std::string path_;
+		int64_t depth_;
+		uint32_t segment_ledgers_;
+
+		utils::Thread *thread_;
+		volatile bool enabled_;
+
+		//sorted by seq, contiguous but for the gaps of state sync installs
+		utils::ReadWriteLock segments_lock_;
+		std::vector<SegmentPointer> segments_;
+		int64_t next_seq_;
+
+		std::atomic<int64_t> archived_bytes_;
+		std::atomic<int64_t> history_reads_;
+		std::atomic<int64_t> history_hits_;
+		std::atomic<int64_t> last_archive_time_;
+	};
+}
+
+#endif
@@ -372,6 +372,75 @@ namespace phantom {
 		return false;
 	}
 
+	void PublicKey::VerifyBatch(std::vector<SignatureItem> &items) {
+		std::vector<size_t> batch_index;
+		std::vector<std::string> raw_pubkeys;
+		batch_index.reserve(items.size());
+		raw_pubkeys.reserve(items.size());
+
+		for (size_t i = 0; i < items.size(); i++) {
+			SignatureItem &item = items[i];
+			item.valid_ = false;
+
+			PrivateKeyPrefix prefix;
+			SignatureType sign_type;
+			std::string raw_pubkey;
+			bool valid = GetPublicKeyElement(*item.public_key_, prefix, sign_type, raw_pubkey);
+			if (!valid || prefix != PUBLICKEY_PREFIX || item.sign_data_->size() != 64) {
+				continue;
+			}
+
+			if (sign_type != SIGNTYPE_ED25519) {
+				item.valid_ = Verify(*item.data_, *item.sign_data_, *item.public_key_);
+				continue;
+			}
+
+			//ed25519_sign_open rejects these before any math, the batch does not look at them
+			const unsigned char *rs = (const unsigned char *)item.sign_data_->c_str();
+			if ((rs[63] & 224) != 0 || !IsCanonicalPoint(rs)) {
+				continue;
+			}
+
+			batch_index.push_back(i);
+			raw_pubkeys.push_back(raw_pubkey);
+		}
+
+		size_t num = batch_index.size();
+		if (num == 0) {
+			return;
+		}
+
+		std::vector<const unsigned char *> messages(num), pubkeys(num), signatures(num);
+		std::vector<size_t> message_lengths(num);
+		std::vector<int> valid(num, 0);
+		for (size_t n = 0; n < num; n++) {
+			const SignatureItem &item = items[batch_index[n]];
+			messages[n] = (const unsigned char *)item.data_->c_str();
+			message_lengths[n] = item.data_->size();
+			pubkeys[n] = (const unsigned char *)raw_pubkeys[n].c_str();
+			signatures[n] = (const unsigned char *)item.sign_data_->c_str();
+		}
+
+		ed25519_sign_open_batch(&messages[0], &message_lengths[0], &pubkeys[0], &signatures[0], num, &valid[0]);
+		for (size_t n = 0; n < num; n++) {
+			items[batch_index[n]].valid_ = (valid[n] == 1);
+		}
+	}
+
+	//the y coordinate of an encoded point is below 2^255 - 19, ed25519_sign_open compares R byte for byte
+	//with a canonical encoding, while the batch reduces it
+	bool PublicKey::IsCanonicalPoint(const unsigned char *point) {
+		if ((point[31] & 0x7f) != 0x7f) {
+			return true;
+		}
+		for (int i = 30; i > 0; i--) {
+			if (point[i] != 0xff) {
+				return true;
+			}
+		}
+		return point[0] < 0xed;
+	}
+
 	//Generate keypair according to signature type.
 	PrivateKey::PrivateKey(SignatureType type) {
 		std::string raw_pub_key = "";
@@ -62,6 +62,14 @@ namespace phantom {
 	SignatureType GetSignTypeByDesc(const std::string &desc);
 	
 
+	//one signature of PublicKey::VerifyBatch, the strings must outlive the call
+	struct SignatureItem {
+		const std::string *data_;
+		const std::string *sign_data_;
+		const std::string *public_key_; //encoded
+		bool valid_;
+	};
+
 	class PublicKey {
 		DISALLOW_COPY_AND_ASSIGN(PublicKey);
 		friend class PrivateKey;
@@ -84,8 +92,14 @@ namespace phantom {
 		SignatureType GetSignType() { return type_; };
 
 		static bool Verify(const std::string &data, const std::string &signature, const std::string &encode_public_key);
+
+		//verify ed25519 signatures together, a failed batch is checked one by one. other types use Verify.
+		//the batch equation is not cofactor exact, a crafted signature with a small order component may pass
+		//here and fail Verify, so use it to admit transactions, never for results that go into a ledger
+		static void VerifyBatch(std::vector<SignatureItem> &items);
 		static bool IsAddressValid(const std::string &encode_address);
 	private:
+		static bool IsCanonicalPoint(const unsigned char *point);
 		std::string raw_pub_key_;
 		bool valid_;
 		SignatureType type_;
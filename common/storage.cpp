@@ -18,14 +18,145 @@
 #include <utils/logger.h>
 #include <utils/file.h>
 #include "storage.h"
+#include "history_db.h"
 #include "general.h"
+#include <proto/cpp/chain.pb.h>
+#ifndef WIN32
+#include <unistd.h>
+#include <rocksdb/cache.h>
+#include <rocksdb/filter_policy.h>
+#include <rocksdb/perf_context.h>
+#include <rocksdb/statistics.h>
+#include <rocksdb/table.h>
+#include <rocksdb/utilities/checkpoint.h>
+#endif
+#include <thread>
 #define PHANTOM_ROCKSDB_MAX_OPEN_FILES 5000
 
 namespace phantom {
-	KeyValueDb::KeyValueDb() {}
+	KeyValueDb::KeyValueDb() :durability_(DURABILITY_SYNC), group_interval_(0), last_sync_time_(0), group_waiting_(0) {}
 
 	KeyValueDb::~KeyValueDb() {}
 
+	void KeyValueDb::SetDurability(WriteDurability durability, int64_t group_interval) {
+		durability_ = durability;
+		group_interval_ = group_interval;
+	}
+
+	bool KeyValueDb::NeedSync(WriteDurability durability, int64_t &waiting) {
+		waiting = group_waiting_;
+		if (durability == DURABILITY_GROUP) {
+			return utils::Timestamp::HighResolution() - last_sync_time_ >= group_interval_;
+		}
+		return durability == DURABILITY_SYNC;
+	}
+
+	bool KeyValueDb::Written(bool ok, WriteDurability durability, bool synced, int64_t waiting) {
+		if (!ok) {
+			return false;
+		}
+
+		//the group writes before a synced one are on disk with it
+		if (synced) {
+			group_waiting_ -= waiting;
+			last_sync_time_ = utils::Timestamp::HighResolution();
+		}
+		else if (durability == DURABILITY_GROUP) {
+			group_waiting_++;
+		}
+		return true;
+	}
+
+	bool KeyValueDb::SyncGroup(int64_t current_time) {
+		if (group_waiting_ == 0 || current_time - last_sync_time_ < group_interval_) {
+			return true;
+		}
+
+		//an empty synced write syncs the log with everything before it
+		WRITE_BATCH empty;
+		return WriteBatch(empty, DURABILITY_SYNC);
+	}
+
+	bool KeyValueDb::ParseDurability(const std::string &name, WriteDurability &durability) {
+		if (name == "sync") {
+			durability = DURABILITY_SYNC;
+		}
+		else if (name == "group") {
+			durability = DURABILITY_GROUP;
+		}
+		else if (name == "wal") {
+			durability = DURABILITY_WAL;
+		}
+		else {
+			return false;
+		}
+		return true;
+	}
+
+	const char *KeyValueDb::DurabilityName(WriteDurability durability) {
+		switch (durability) {
+		case DURABILITY_SYNC: return "sync";
+		case DURABILITY_GROUP: return "group";
+		case DURABILITY_WAL: return "wal";
+		default: break;
+		}
+		return "unknown";
+	}
+
+	ReadRange::ReadRange() :snapshot_(NULL), fill_cache_(true) {}
+
+	ReadRange ReadRange::Prefix(const std::string &prefix) {
+		ReadRange range;
+		range.prefix_ = prefix;
+		range.lower_ = prefix;
+
+		//the smallest key greater than every key with the prefix
+		range.upper_ = prefix;
+		while (!range.upper_.empty() && (uint8_t)range.upper_.back() == 0xff) {
+			range.upper_.pop_back();
+		}
+		if (!range.upper_.empty()) {
+			range.upper_.back() = (char)((uint8_t)range.upper_.back() + 1);
+		}
+		return range;
+	}
+
+	ReadRange ReadRange::Between(const std::string &lower, const std::string &upper) {
+		ReadRange range;
+		range.lower_ = lower;
+		range.upper_ = upper;
+		return range;
+	}
+
+	KeyValueIterator::KeyValueIterator(const ReadRange &range) :it_(NULL), lower_(range.lower_), upper_(range.upper_) {
+		upper_slice_ = SLICE(upper_);
+	}
+
+	KeyValueIterator::~KeyValueIterator() {
+		delete it_;
+	}
+
+	void KeyValueIterator::SeekToFirst() {
+		if (lower_.empty()) {
+			it_->SeekToFirst();
+		}
+		else {
+			it_->Seek(lower_);
+		}
+	}
+
+	void KeyValueIterator::Seek(const std::string &key) {
+		it_->Seek(key < lower_ ? lower_ : key);
+	}
+
+	bool KeyValueIterator::Valid() const {
+		return it_->Valid() && (upper_.empty() || it_->key().compare(upper_slice_) < 0);
+	}
+
+	void KeyValueIterator::Next() {
+		it_->Next();
+	}
+
 #ifdef WIN32
 	LevelDbDriver::LevelDbDriver() {
 		db_ = NULL;
@@ -60,14 +191,20 @@ namespace phantom {
 	}
 
 	int32_t LevelDbDriver::Get(const std::string &key, std::string &value) {
+		return Get(key, value, NULL);
+	}
+
+	int32_t LevelDbDriver::Get(const std::string &key, std::string &value, const SNAPSHOT *snapshot) {
 		assert(db_ != NULL);
+		leveldb::ReadOptions opt;
+		opt.snapshot = snapshot;
 
 		//retry 10s
 		size_t timers = 0;
 		int32_t ret = -1;
 		while (timers < 10) {
 
-			leveldb::Status status = db_->Get(leveldb::ReadOptions(), key, &value);
+			leveldb::Status status = db_->Get(opt, key, &value);
 			if (status.ok()) {
 				ret = 1;
 				break;
@@ -90,32 +227,62 @@ namespace phantom {
 		return ret;
 	}
 
+	bool LevelDbDriver::MultiGet(const std::vector<std::string> &keys, std::vector<std::string> &values, std::vector<int32_t> &statuses) {
+		//leveldb has no batched read
+		bool ret = true;
+		values.resize(keys.size());
+		statuses.resize(keys.size());
+		for (size_t i = 0; i < keys.size(); i++) {
+			statuses[i] = Get(keys[i], values[i]);
+			ret = ret && statuses[i] >= 0;
+		}
+		return ret;
+	}
+
 	bool LevelDbDriver::Put(const std::string &key, const std::string &value) {
+		WRITE_BATCH batch;
+		batch.Put(key, value);
+		return WriteBatch(batch, durability());
+	}
+
+	bool LevelDbDriver::Delete(const std::string &key) {
+		WRITE_BATCH batch;
+		batch.Delete(key);
+		return WriteBatch(batch, durability());
+	}
+
+	bool LevelDbDriver::WriteBatch(WRITE_BATCH &write_batch) {
+		return WriteBatch(write_batch, durability());
+	}
+
+	bool LevelDbDriver::WriteBatch(WRITE_BATCH &write_batch, WriteDurability durability) {
 		assert(db_ != NULL);
 		leveldb::WriteOptions opt;
-		opt.sync = true;
-		leveldb::Status status = db_->Put(opt, key, value);
+		int64_t waiting = 0;
+		opt.sync = NeedSync(durability, waiting);
+		leveldb::Status status = db_->Write(opt, &write_batch);
 		if (!status.ok()) {
 			utils::MutexGuard guard(mutex_);
 			error_desc_ = status.ToString();
 		}
-		return status.ok();
+		return Written(status.ok(), durability, opt.sync, waiting);
 	}
 
-	bool LevelDbDriver::Delete(const std::string &key) {
-		assert(db_ != NULL);
-		leveldb::Status status = db_->Delete(leveldb::WriteOptions(), key);
+	bool LevelDbDriver::WriteBatchUnsynced(WRITE_BATCH &write_batch) {
+		leveldb::Status status = db_->Write(leveldb::WriteOptions(), &write_batch);
 		if (!status.ok()) {
+			utils::MutexGuard guard(mutex_);
 			error_desc_ = status.ToString();
 		}
 		return status.ok();
 	}
 
-	bool LevelDbDriver::WriteBatch(WRITE_BATCH &write_batch) {
-
+	bool LevelDbDriver::Flush() {
+		//leveldb has no flush, a synced empty write syncs the log with everything before it
 		leveldb::WriteOptions opt;
 		opt.sync = true;
-		leveldb::Status status = db_->Write(opt, &write_batch);
+		leveldb::WriteBatch empty;
+		leveldb::Status status = db_->Write(opt, &empty);
 		if (!status.ok()) {
 			utils::MutexGuard guard(mutex_);
 			error_desc_ = status.ToString();
@@ -123,27 +290,202 @@ namespace phantom {
 		return status.ok();
 	}
 
-	void* LevelDbDriver::NewIterator() {
-		return db_->NewIterator(leveldb::ReadOptions());
+	KeyValueIterator *LevelDbDriver::NewIterator(const ReadRange &range) {
+		//leveldb has no upper bound, the iterator stops at it
+		leveldb::ReadOptions opt;
+		opt.snapshot = range.snapshot_;
+		opt.fill_cache = range.fill_cache_;
+		KeyValueIterator *it = new KeyValueIterator(range);
+		it->Attach(db_->NewIterator(opt));
+		return it;
+	}
+
+	const SNAPSHOT *LevelDbDriver::GetSnapshot() {
+		return db_->GetSnapshot();
+	}
+
+	void LevelDbDriver::ReleaseSnapshot(const SNAPSHOT *snapshot) {
+		db_->ReleaseSnapshot(snapshot);
 	}
 
 	bool LevelDbDriver::GetOptions(Json::Value &options) {
+		options["durability"] = DurabilityName(durability());
 		return true;
 	}
 
 #else
 
+	std::shared_ptr<rocksdb::Cache> RocksDbDriver::block_cache_;
+	bool RocksDbDriver::no_block_cache_ = false;
+
+	//iterator over the families of a db in key order, the families never share a key
+	class FamilyIterator : public rocksdb::Iterator {
+	public:
+		FamilyIterator(const std::vector<rocksdb::Iterator *> &children) :children_(children), current_(-1), forward_(true) {}
+		~FamilyIterator() {
+			for (size_t i = 0; i < children_.size(); i++) {
+				delete children_[i];
+			}
+		}
+
+		virtual bool Valid() const override {
+			return current_ >= 0;
+		}
+
+		virtual void SeekToFirst() override {
+			for (size_t i = 0; i < children_.size(); i++) {
+				children_[i]->SeekToFirst();
+			}
+			forward_ = true;
+			FindSmallest();
+		}
+
+		virtual void SeekToLast() override {
+			for (size_t i = 0; i < children_.size(); i++) {
+				children_[i]->SeekToLast();
+			}
+			forward_ = false;
+			FindLargest();
+		}
+
+		virtual void Seek(const rocksdb::Slice &target) override {
+			for (size_t i = 0; i < children_.size(); i++) {
+				children_[i]->Seek(target);
+			}
+			forward_ = true;
+			FindSmallest();
+		}
+
+		virtual void Next() override {
+			//after Prev the other children are before the current key
+			if (!forward_) {
+				std::string key = this->key().ToString();
+				for (int32_t i = 0; i < (int32_t)children_.size(); i++) {
+					if (i != current_) children_[i]->Seek(key);
+				}
+				forward_ = true;
+			}
+			children_[current_]->Next();
+			FindSmallest();
+		}
+
+		virtual void Prev() override {
+			if (forward_) {
+				std::string key = this->key().ToString();
+				for (int32_t i = 0; i < (int32_t)children_.size(); i++) {
+					if (i == current_) continue;
+					children_[i]->Seek(key);
+					if (children_[i]->Valid()) {
+						children_[i]->Prev();
+					}
+					else {
+						children_[i]->SeekToLast();
+					}
+				}
+				forward_ = false;
+			}
+			children_[current_]->Prev();
+			FindLargest();
+		}
+
+		virtual rocksdb::Slice key() const override {
+			return children_[current_]->key();
+		}
+
+		virtual rocksdb::Slice value() const override {
+			return children_[current_]->value();
+		}
+
+		virtual rocksdb::Status status() const override {
+			for (size_t i = 0; i < children_.size(); i++) {
+				if (!children_[i]->status().ok()) {
+					return children_[i]->status();
+				}
+			}
+			return rocksdb::Status::OK();
+		}
+
+	private:
+		void FindSmallest() {
+			current_ = -1;
+			for (int32_t i = 0; i < (int32_t)children_.size(); i++) {
+				if (children_[i]->Valid() && (current_ < 0 || children_[i]->key().compare(children_[current_]->key()) < 0)) {
+					current_ = i;
+				}
+			}
+		}
+
+		void FindLargest() {
+			current_ = -1;
+			for (int32_t i = 0; i < (int32_t)children_.size(); i++) {
+				if (children_[i]->Valid() && (current_ < 0 || children_[i]->key().compare(children_[current_]->key()) > 0)) {
+					current_ = i;
+				}
+			}
+		}
+
+		std::vector<rocksdb::Iterator *> children_;
+		int32_t current_;
+		bool forward_;
+	};
+
 	RocksDbDriver::RocksDbDriver() {
 		db_ = NULL;
 	}
 
 	RocksDbDriver::~RocksDbDriver() {
 		if (db_ != NULL) {
-			delete db_;
-			db_ = NULL;
+			Close();
 		}
 	}
 
+	const std::vector<ColumnFamilySpec> &RocksDbDriver::Families() {
+		static std::vector<ColumnFamilySpec> families;
+		if (families.empty()) {
+			//the account tree is "acc" followed by node locations, the other account keys are longer prefixes of it
+			families.push_back({ "account", "account", { General::ACCOUNT_PREFIX }, CF_PROFILE_POINT_LOOKUP });
+			families.push_back({ "account", "account_index", { ComposePrefix(General::ACCOUNT_INDEX_PREFIX, "") }, CF_PROFILE_POINT_LOOKUP });
+			families.push_back({ "account", rocksdb::kDefaultColumnFamilyName, { General::KEY_ACCOUNT_INDEX }, CF_PROFILE_DEFAULT });
+			families.push_back({ "account", "asset", { ComposePrefix(General::ASSET_PREFIX, "") }, CF_PROFILE_POINT_LOOKUP });
+			families.push_back({ "account", "metadata", { ComposePrefix(General::METADATA_PREFIX, "") }, CF_PROFILE_POINT_LOOKUP });
+			families.push_back({ "ledger", "ledger", { ComposePrefix(General::LEDGER_PREFIX, ""),
+				ComposePrefix(General::LEDGER_TRANSACTION_PREFIX, ""), ComposePrefix(General::CONSENSUS_VALUE_PREFIX, "") }, CF_PROFILE_ARCHIVE });
+			families.push_back({ "ledger", "transaction", { ComposePrefix(General::TRANSACTION_PREFIX, "") }, CF_PROFILE_ARCHIVE });
+		}
+		return families;
+	}
+
+	rocksdb::ColumnFamilyOptions RocksDbDriver::FamilyOptions(ColumnFamilyProfile profile) {
+		rocksdb::ColumnFamilyOptions options;
+		rocksdb::BlockBasedTableOptions table;
+		table.block_cache = block_cache_;
+		table.no_block_cache = no_block_cache_;
+		switch (profile) {
+		case CF_PROFILE_POINT_LOOKUP:
+			table.filter_policy.reset(rocksdb::NewBloomFilterPolicy(10, false));
+			table.block_size = 4 * 1024;
+			break;
+		case CF_PROFILE_ARCHIVE:
+			table.filter_policy.reset(rocksdb::NewBloomFilterPolicy(10, false));
+			table.block_size = 64 * 1024;
+			options.compression = rocksdb::kZlibCompression;
+			break;
+		default:
+			break;
+		}
+		options.table_factory.reset(rocksdb::NewBlockBasedTableFactory(table));
+		return options;
+	}
+
+	void RocksDbDriver::SetBlockCache(size_t size) {
+		block_cache_ = size > 0 ? rocksdb::NewLRUCache(size * utils::BYTES_PER_MEGA) : nullptr;
+		no_block_cache_ = size == 0;
+	}
+
+	void RocksDbDriver::SetNewFamilies(const std::string &db) {
+		new_families_db_ = db;
+	}
+
 	bool RocksDbDriver::Open(const std::string &db_path, int max_open_files) {
 		rocksdb::Options options;
 		if (max_open_files > 0)
@@ -151,7 +493,57 @@ namespace phantom {
 			options.max_open_files = max_open_files;
 		}
 		options.create_if_missing = true;
-		rocksdb::Status status = rocksdb::DB::Open(options, db_path, &db_);
+		options.statistics = statistics_;
+		static_cast<rocksdb::ColumnFamilyOptions &>(options) = FamilyOptions(CF_PROFILE_DEFAULT);
+
+		//an existing db is opened with the families it has, whatever the configure says
+		std::vector<std::string> names;
+		rocksdb::Status status = rocksdb::DB::ListColumnFamilies(options, db_path, &names);
+		if (!status.ok()) {
+			names.clear();
+			names.push_back(rocksdb::kDefaultColumnFamilyName);
+			const std::vector<ColumnFamilySpec> &families = Families();
+			for (size_t i = 0; i < families.size(); i++) {
+				if (families[i].db_ == new_families_db_ && families[i].name_ != rocksdb::kDefaultColumnFamilyName) {
+					names.push_back(families[i].name_);
+				}
+			}
+			options.create_missing_column_families = true;
+		}
+
+		if (names.size() <= 1) {
+			status = rocksdb::DB::Open(options, db_path, &db_);
+		}
+		else {
+			std::vector<rocksdb::ColumnFamilyDescriptor> descriptors;
+			for (size_t i = 0; i < names.size(); i++) {
+				ColumnFamilyProfile profile = CF_PROFILE_DEFAULT;
+				const std::vector<ColumnFamilySpec> &families = Families();
+				for (size_t j = 0; j < families.size(); j++) {
+					if (families[j].name_ == names[i]) profile = families[j].profile_;
+				}
+				descriptors.push_back(rocksdb::ColumnFamilyDescriptor(names[i], FamilyOptions(profile)));
+			}
+
+			status = rocksdb::DB::Open(options, db_path, descriptors, &handles_, &db_);
+			if (status.ok()) {
+				names_ = names;
+				const std::vector<ColumnFamilySpec> &families = Families();
+				for (size_t i = 0; i < handles_.size(); i++) {
+					for (size_t j = 0; j < families.size(); j++) {
+						if (families[j].name_ != names_[i]) continue;
+						for (size_t k = 0; k < families[j].prefixes_.size(); k++) {
+							routes_.push_back(std::make_pair(families[j].prefixes_[k], handles_[i]));
+						}
+					}
+				}
+				std::sort(routes_.begin(), routes_.end(), [](const std::pair<std::string, rocksdb::ColumnFamilyHandle *> &a,
+					const std::pair<std::string, rocksdb::ColumnFamilyHandle *> &b) {
+					return a.first.size() > b.first.size();
+				});
+			}
+		}
+
 		if (!status.ok()) {
 			utils::MutexGuard guard(mutex_);
 			error_desc_ = status.ToString();
@@ -160,14 +552,52 @@ namespace phantom {
 	}
 
 	bool RocksDbDriver::Close() {
+		for (size_t i = 0; i < handles_.size(); i++) {
+			delete handles_[i];
+		}
+		handles_.clear();
+		names_.clear();
+		routes_.clear();
 		delete db_;
 		db_ = NULL;
 		return true;
 	}
 
+	rocksdb::ColumnFamilyHandle *RocksDbDriver::Route(const SLICE &key) {
+		for (size_t i = 0; i < routes_.size(); i++) {
+			if (key.starts_with(routes_[i].first)) {
+				return routes_[i].second;
+			}
+		}
+		return db_->DefaultColumnFamily();
+	}
+
+	void RocksDbDriver::Route(WRITE_BATCH &values, WRITE_BATCH &routed) {
+		class Router : public WRITE_BATCH::Handler {
+		public:
+			Router(RocksDbDriver *driver, WRITE_BATCH &routed) :driver_(driver), routed_(routed) {}
+			virtual void Put(const SLICE &key, const SLICE &value) override {
+				routed_.Put(driver_->Route(key), key, value);
+			}
+			virtual void Delete(const SLICE &key) override {
+				routed_.Delete(driver_->Route(key), key);
+			}
+		private:
+			RocksDbDriver *driver_;
+			WRITE_BATCH &routed_;
+		} router(this, routed);
+		values.Iterate(&router);
+	}
+
 	int32_t RocksDbDriver::Get(const std::string &key, std::string &value) {
+		return Get(key, value, NULL);
+	}
+
+	int32_t RocksDbDriver::Get(const std::string &key, std::string &value, const SNAPSHOT *snapshot) {
 		assert(db_ != NULL);
-		rocksdb::Status status = db_->Get(rocksdb::ReadOptions(), key, &value);
+		rocksdb::ReadOptions opt;
+		opt.snapshot = snapshot;
+		rocksdb::Status status = db_->Get(opt, Route(key), key, &value);
 		if (status.ok()) {
 			return 1;
 		}
@@ -181,23 +611,72 @@ namespace phantom {
 		}
 	}
 
+	bool RocksDbDriver::MultiGet(const std::vector<std::string> &keys, std::vector<std::string> &values, std::vector<int32_t> &statuses) {
+		assert(db_ != NULL);
+		std::vector<rocksdb::ColumnFamilyHandle *> families;
+		std::vector<rocksdb::Slice> slices;
+		for (size_t i = 0; i < keys.size(); i++) {
+			slices.push_back(keys[i]);
+			families.push_back(Route(keys[i]));
+		}
+
+		bool ret = true;
+		std::vector<rocksdb::Status> status = db_->MultiGet(rocksdb::ReadOptions(), families, slices, &values);
+		statuses.resize(keys.size());
+		for (size_t i = 0; i < keys.size(); i++) {
+			if (status[i].ok()) {
+				statuses[i] = 1;
+			}
+			else if (status[i].IsNotFound()) {
+				statuses[i] = 0;
+			}
+			else {
+				statuses[i] = -1;
+				ret = false;
+				utils::MutexGuard guard(mutex_);
+				error_desc_ = status[i].ToString();
+			}
+		}
+		return ret;
+	}
+
 	bool RocksDbDriver::Put(const std::string &key, const std::string &value) {
 		assert(db_ != NULL);
 		rocksdb::WriteOptions opt;
-		opt.sync = true;
-		rocksdb::Status status = db_->Put(opt, key, value);
+		int64_t waiting = 0;
+		opt.sync = NeedSync(durability(), waiting);
+		rocksdb::Status status = db_->Put(opt, Route(key), key, value);
 		if (!status.ok()) {
 			utils::MutexGuard guard(mutex_);
 			error_desc_ = status.ToString();
 		}
-		return status.ok();
+		return Written(status.ok(), durability(), opt.sync, waiting);
 	}
 
 	bool RocksDbDriver::Delete(const std::string &key) {
 		assert(db_ != NULL);
 		rocksdb::WriteOptions opt;
-		opt.sync = true;
-		rocksdb::Status status = db_->Delete(opt, key);
+		int64_t waiting = 0;
+		opt.sync = NeedSync(durability(), waiting);
+		rocksdb::Status status = db_->Delete(opt, Route(key), key);
+		if (!status.ok()) {
+			utils::MutexGuard guard(mutex_);
+			error_desc_ = status.ToString();
+		}
+		return Written(status.ok(), durability(), opt.sync, waiting);
+	}
+
+	bool RocksDbDriver::Write(const rocksdb::WriteOptions &opt, WRITE_BATCH &write_batch) {
+		rocksdb::Status status;
+		if (routes_.empty()) {
+			status = db_->Write(opt, &write_batch);
+		}
+		else {
+			WRITE_BATCH routed;
+			Route(write_batch, routed);
+			status = db_->Write(opt, &routed);
+		}
+
 		if (!status.ok()) {
 			utils::MutexGuard guard(mutex_);
 			error_desc_ = status.ToString();
@@ -206,10 +685,120 @@ namespace phantom {
 	}
 
 	bool RocksDbDriver::WriteBatch(WRITE_BATCH &write_batch) {
+		return WriteBatch(write_batch, durability());
+	}
 
+	bool RocksDbDriver::WriteBatch(WRITE_BATCH &write_batch, WriteDurability durability) {
 		rocksdb::WriteOptions opt;
-		opt.sync = true;
-		rocksdb::Status status = db_->Write(opt, &write_batch);
+		int64_t waiting = 0;
+		opt.sync = NeedSync(durability, waiting);
+		return Written(Write(opt, write_batch), durability, opt.sync, waiting);
+	}
+
+	bool RocksDbDriver::WriteBatchUnsynced(WRITE_BATCH &write_batch) {
+		//Flush goes family by family, a crash between two would leave families of different ledgers
+		//without a log to replay. With families the log is kept, only its sync is skipped
+		rocksdb::WriteOptions opt;
+		opt.disableWAL = handles_.empty();
+		return Write(opt, write_batch);
+	}
+
+	bool RocksDbDriver::Flush() {
+		rocksdb::Status status;
+		if (handles_.empty()) {
+			status = db_->Flush(rocksdb::FlushOptions());
+		}
+		for (size_t i = 0; i < handles_.size() && status.ok(); i++) {
+			status = db_->Flush(rocksdb::FlushOptions(), handles_[i]);
+		}
+
+		if (!status.ok()) {
+			utils::MutexGuard guard(mutex_);
+			error_desc_ = status.ToString();
+		}
+		return status.ok();
+	}
+
+	KeyValueIterator *RocksDbDriver::NewIterator(const ReadRange &range) {
+		KeyValueIterator *it = new KeyValueIterator(range);
+		rocksdb::ReadOptions opt;
+		opt.snapshot = range.snapshot_;
+		opt.fill_cache = range.fill_cache_;
+		opt.iterate_upper_bound = it->upper_bound();
+		if (handles_.empty()) {
+			it->Attach(db_->NewIterator(opt));
+			return it;
+		}
+
+		//families keys with the prefix can be in, the family of the prefix and those of longer routes
+		std::vector<rocksdb::ColumnFamilyHandle *> handles;
+		if (range.prefix_.empty()) {
+			handles = handles_;
+		}
+		else {
+			handles.push_back(Route(range.prefix_));
+			for (size_t i = 0; i < routes_.size(); i++) {
+				if (SLICE(routes_[i].first).starts_with(range.prefix_) &&
+					std::find(handles.begin(), handles.end(), routes_[i].second) == handles.end()) {
+					handles.push_back(routes_[i].second);
+				}
+			}
+		}
+
+		if (handles.size() == 1) {
+			it->Attach(db_->NewIterator(opt, handles[0]));
+			return it;
+		}
+
+		std::vector<rocksdb::Iterator *> children;
+		rocksdb::Status status = db_->NewIterators(opt, handles, &children);
+		if (!status.ok()) {
+			utils::MutexGuard guard(mutex_);
+			error_desc_ = status.ToString();
+			it->Attach(rocksdb::NewErrorIterator(status));
+			return it;
+		}
+		it->Attach(new FamilyIterator(children));
+		return it;
+	}
+
+	const SNAPSHOT *RocksDbDriver::GetSnapshot() {
+		return db_->GetSnapshot();
+	}
+
+	void RocksDbDriver::ReleaseSnapshot(const SNAPSHOT *snapshot) {
+		db_->ReleaseSnapshot(snapshot);
+	}
+
+	void RocksDbDriver::GetFamilyProperty(const std::string &property, Json::Value &values) {
+		std::string out;
+		if (handles_.empty()) {
+			db_->GetProperty(property, &out);
+			values[rocksdb::kDefaultColumnFamilyName] = out;
+		}
+		for (size_t i = 0; i < handles_.size(); i++) {
+			db_->GetProperty(handles_[i], property, &out);
+			values[names_[i]] = out;
+		}
+	}
+
+	void RocksDbDriver::EnableStatistics() {
+		statistics_ = rocksdb::CreateDBStatistics();
+	}
+
+	uint64_t RocksDbDriver::GetTicker(uint32_t ticker) {
+		return statistics_ != nullptr ? statistics_->getTickerCount(ticker) : 0;
+	}
+
+	bool RocksDbDriver::CompactAll() {
+		rocksdb::Status status;
+		if (handles_.empty()) {
+			status = db_->CompactRange(NULL, NULL);
+		}
+		for (size_t i = 0; i < handles_.size() && status.ok(); i++) {
+			status = db_->CompactRange(handles_[i], NULL, NULL);
+		}
+
 		if (!status.ok()) {
 			utils::MutexGuard guard(mutex_);
 			error_desc_ = status.ToString();
@@ -217,8 +806,19 @@ namespace phantom {
 		return status.ok();
 	}
 
-	void* RocksDbDriver::NewIterator() {
-		return db_->NewIterator(rocksdb::ReadOptions());
+	bool RocksDbDriver::CreateCheckpoint(const std::string &dir) {
+		rocksdb::Checkpoint *checkpoint = NULL;
+		rocksdb::Status status = rocksdb::Checkpoint::Create(db_, &checkpoint);
+		if (status.ok()) {
+			status = checkpoint->CreateCheckpoint(dir);
+			delete checkpoint;
+		}
+
+		if (!status.ok()) {
+			utils::MutexGuard guard(mutex_);
+			error_desc_ = status.ToString();
+		}
+		return status.ok();
 	}
 
 	bool RocksDbDriver::GetOptions(Json::Value &options) {
@@ -231,10 +831,298 @@ namespace phantom {
 
 		db_->GetProperty("rocksdb.stats", &out);
 		options["rocksdb.stats"] = out;
+
+		GetFamilyProperty("rocksdb.estimate-num-keys", options["rocksdb.estimate-num-keys"]);
+		options["durability"] = DurabilityName(durability());
 		return true;
 	}
 #endif
 
+	class MemoryDbDriver::Snapshot : public SNAPSHOT {
+	public:
+		Snapshot(uint64_t seq) :seq_(seq) {}
+		~Snapshot() {}
+#ifndef WIN32
+		virtual rocksdb::SequenceNumber GetSequenceNumber() const override {
+			return seq_;
+		}
+#endif
+		uint64_t seq_;
+	};
+
+	//reads the map at seq, each step looks the current key up again so writes may go on meanwhile
+	class MemoryDbDriver::Iterator : public ITERATOR {
+	public:
+		Iterator(MemoryDbDriver *db, uint64_t seq) :db_(db), seq_(seq), valid_(false) {}
+		~Iterator() {
+			db_->Unpin(seq_);
+		}
+
+		virtual bool Valid() const override {
+			return valid_;
+		}
+
+		virtual void SeekToFirst() override {
+			utils::ReadLockGuard guard(db_->lock_);
+			Settle(db_->data_.begin(), true);
+		}
+
+		virtual void SeekToLast() override {
+			utils::ReadLockGuard guard(db_->lock_);
+			Settle(db_->data_.end(), false);
+		}
+
+		virtual void Seek(const SLICE &target) override {
+			utils::ReadLockGuard guard(db_->lock_);
+			Settle(db_->data_.lower_bound(target.ToString()), true);
+		}
+
+		virtual void Next() override {
+			utils::ReadLockGuard guard(db_->lock_);
+			Settle(db_->data_.upper_bound(key_), true);
+		}
+
+		virtual void Prev() override {
+			utils::ReadLockGuard guard(db_->lock_);
+			Settle(db_->data_.lower_bound(key_), false);
+		}
+
+		virtual SLICE key() const override {
+			return key_;
+		}
+
+		virtual SLICE value() const override {
+			return value_;
+		}
+
+		virtual KVDB::Status status() const override {
+			return KVDB::Status::OK();
+		}
+
+	private:
+		//the first key readable at seq from iter on, or before iter going backward
+		void Settle(VersionMap::const_iterator iter, bool forward) {
+			valid_ = false;
+			while (forward ? iter != db_->data_.end() : iter != db_->data_.begin()) {
+				if (!forward) iter--;
+				const Version *version = Find(iter->second, seq_);
+				if (version != NULL) {
+					key_ = iter->first;
+					value_ = version->value_;
+					valid_ = true;
+					return;
+				}
+				if (forward) iter++;
+			}
+		}
+
+		MemoryDbDriver *db_;
+		uint64_t seq_;
+		bool valid_;
+		std::string key_;
+		std::string value_;
+	};
+
+	MemoryDbDriver::MemoryDbDriver(uint32_t read_latency, uint32_t write_latency) :
+		seq_(0), read_latency_(read_latency), write_latency_(write_latency) {}
+
+	MemoryDbDriver::~MemoryDbDriver() {}
+
+	bool MemoryDbDriver::Open(const std::string &db_path, int max_open_files) {
+		return true;
+	}
+
+	bool MemoryDbDriver::Close() {
+		return true;
+	}
+
+	const MemoryDbDriver::Version *MemoryDbDriver::Find(const std::vector<Version> &versions, uint64_t seq) {
+		for (size_t i = versions.size(); i > 0; i--) {
+			if (versions[i - 1].seq_ <= seq) {
+				return versions[i - 1].exist_ ? &versions[i - 1] : NULL;
+			}
+		}
+		return NULL;
+	}
+
+	int32_t MemoryDbDriver::Get(const std::string &key, std::string &value) {
+		return Get(key, value, NULL);
+	}
+
+	int32_t MemoryDbDriver::Get(const std::string &key, std::string &value, const SNAPSHOT *snapshot) {
+		Wait(read_latency_);
+		utils::ReadLockGuard guard(lock_);
+		auto iter = data_.find(key);
+		if (iter == data_.end()) {
+			return 0;
+		}
+
+		const Version *version = Find(iter->second, snapshot != NULL ? ((const Snapshot *)snapshot)->seq_ : seq_);
+		if (version == NULL) {
+			return 0;
+		}
+		value = version->value_;
+		return 1;
+	}
+
+	bool MemoryDbDriver::MultiGet(const std::vector<std::string> &keys, std::vector<std::string> &values, std::vector<int32_t> &statuses) {
+		//one wait for the batch, as the reads of a batch are issued together
+		Wait(read_latency_);
+		utils::ReadLockGuard guard(lock_);
+		values.resize(keys.size());
+		statuses.resize(keys.size());
+		for (size_t i = 0; i < keys.size(); i++) {
+			auto iter = data_.find(keys[i]);
+			const Version *version = iter != data_.end() ? Find(iter->second, seq_) : NULL;
+			statuses[i] = version != NULL ? 1 : 0;
+			if (version != NULL) {
+				values[i] = version->value_;
+			}
+		}
+		return true;
+	}
+
+	void MemoryDbDriver::Apply(const std::string &key, bool exist, const std::string &value) {
+		auto iter = data_.find(key);
+		if (iter == data_.end()) {
+			if (exist) {
+				Version version = { seq_, true, value };
+				data_[key].push_back(version);
+			}
+			return;
+		}
+
+		std::vector<Version> &versions = iter->second;
+		if (pinned_.empty()) {
+			if (!exist) {
+				data_.erase(iter);
+				return;
+			}
+			versions.resize(1);
+			versions[0].seq_ = seq_;
+			versions[0].exist_ = true;
+			versions[0].value_ = value;
+			return;
+		}
+
+		//keep the version the oldest pinned seq reads and those after it
+		uint64_t oldest = *pinned_.begin();
+		size_t first = 0;
+		for (size_t i = 0; i < versions.size(); i++) {
+			if (versions[i].seq_ <= oldest) first = i;
+		}
+		versions.erase(versions.begin(), versions.begin() + first);
+		Version version = { seq_, exist, value };
+		versions.push_back(version);
+	}
+
+	bool MemoryDbDriver::Write(WRITE_BATCH &values, WriteDurability durability) {
+		class Applier : public WRITE_BATCH::Handler {
+		public:
+			Applier(MemoryDbDriver *db) :db_(db) {}
+			virtual void Put(const SLICE &key, const SLICE &value) override {
+				db_->Apply(key.ToString(), true, value.ToString());
+			}
+			virtual void Delete(const SLICE &key) override {
+				db_->Apply(key.ToString(), false, "");
+			}
+		private:
+			MemoryDbDriver *db_;
+		};
+
+		int64_t waiting = 0;
+		bool sync = NeedSync(durability, waiting);
+		if (sync) {
+			Wait(write_latency_);
+		}
+
+		utils::WriteLockGuard guard(lock_);
+		seq_++;
+		Applier applier(this);
+		KVDB::Status status = values.Iterate(&applier);
+		if (!status.ok()) {
+			utils::MutexGuard guard(mutex_);
+			error_desc_ = status.ToString();
+		}
+		return Written(status.ok(), durability, sync, waiting);
+	}
+
+	bool MemoryDbDriver::Put(const std::string &key, const std::string &value) {
+		WRITE_BATCH batch;
+		batch.Put(key, value);
+		return Write(batch, durability());
+	}
+
+	bool MemoryDbDriver::Delete(const std::string &key) {
+		WRITE_BATCH batch;
+		batch.Delete(key);
+		return Write(batch, durability());
+	}
+
+	bool MemoryDbDriver::WriteBatch(WRITE_BATCH &values) {
+		return Write(values, durability());
+	}
+
+	bool MemoryDbDriver::WriteBatch(WRITE_BATCH &values, WriteDurability durability) {
+		return Write(values, durability);
+	}
+
+	bool MemoryDbDriver::WriteBatchUnsynced(WRITE_BATCH &values) {
+		return Write(values, DURABILITY_WAL);
+	}
+
+	bool MemoryDbDriver::Flush() {
+		Wait(write_latency_);
+		return true;
+	}
+
+	KeyValueIterator *MemoryDbDriver::NewIterator(const ReadRange &range) {
+		KeyValueIterator *it = new KeyValueIterator(range);
+		utils::WriteLockGuard guard(lock_);
+		uint64_t seq = range.snapshot_ != NULL ? ((const Snapshot *)range.snapshot_)->seq_ : seq_;
+		pinned_.insert(seq);
+		it->Attach(new Iterator(this, seq));
+		return it;
+	}
+
+	const SNAPSHOT *MemoryDbDriver::GetSnapshot() {
+		utils::WriteLockGuard guard(lock_);
+		pinned_.insert(seq_);
+		return new Snapshot(seq_);
+	}
+
+	void MemoryDbDriver::ReleaseSnapshot(const SNAPSHOT *snapshot) {
+		const Snapshot *memory_snapshot = (const Snapshot *)snapshot;
+		Unpin(memory_snapshot->seq_);
+		delete memory_snapshot;
+	}
+
+	void MemoryDbDriver::Unpin(uint64_t seq) {
+		utils::WriteLockGuard guard(lock_);
+		pinned_.erase(pinned_.find(seq));
+	}
+
+	void MemoryDbDriver::Wait(uint32_t latency) {
+		if (latency > 0) {
+			std::this_thread::sleep_for(std::chrono::microseconds(latency));
+		}
+	}
+
+	bool MemoryDbDriver::GetOptions(Json::Value &options) {
+		utils::ReadLockGuard guard(lock_);
+		size_t versions = 0;
+		for (auto iter = data_.begin(); iter != data_.end(); iter++) {
+			versions += iter->second.size();
+		}
+		options["memory.keys"] = (Json::UInt64)data_.size();
+		options["memory.versions"] = (Json::UInt64)versions;
+		options["memory.pinned"] = (Json::UInt64)pinned_.size();
+		options["memory.read_latency"] = read_latency_;
+		options["memory.write_latency"] = write_latency_;
+		options["durability"] = DurabilityName(durability());
+		return true;
+	}
+
 	Storage::Storage() {
 		keyvalue_db_ = NULL;
 		ledger_db_ = NULL;
@@ -269,7 +1157,7 @@ namespace phantom {
 				do {
 					//check the db if opened only for linux or mac
 #ifndef WIN32
-					KeyValueDb *account_db = NewKeyValueDb(db_config);
+					KeyValueDb *account_db = NewKeyValueDb(db_config, "account");
 					if (!account_db->Open(db_config.account_db_path_, -1)) {
 						LOG_ERROR("Drop failed, error desc(%s)", account_db->error_desc().c_str());
 						delete account_db;
@@ -334,21 +1222,44 @@ namespace phantom {
 			LOG_INFO("mac os db file limited:%d, keyvaule:%d, ledger:%d, account:%d:",
 				max_open_files, keyvaule_max_open_files, ledger_max_open_files, account_max_open_files);
 #endif
-			keyvalue_db_ = NewKeyValueDb(db_config);
+#ifndef WIN32
+			RocksDbDriver::SetBlockCache(db_config.block_cache_size_);
+#endif
+			if (db_config.engine_ == "memory") {
+				LOG_WARN("Databases are kept in memory and lost at exit, read latency %u us, write latency %u us",
+					db_config.memory_read_latency_, db_config.memory_write_latency_);
+			}
+			//group writes wait for the timer at most one interval
+			if (db_config.group_sync_interval_ > 0) {
+				check_interval_ = MIN(check_interval_, (int64_t)db_config.group_sync_interval_ * utils::MICRO_UNITS_PER_MILLI);
+			}
+			keyvalue_db_ = NewKeyValueDb(db_config, "keyvalue");
+			drivers_.push_back(keyvalue_db_);
 			if (!keyvalue_db_->Open(db_config.keyvalue_db_path_, keyvaule_max_open_files)) {
 				LOG_ERROR("Keyvalue_db path(%s) open fail(%s)\n",
 					db_config.keyvalue_db_path_.c_str(), keyvalue_db_->error_desc().c_str());
 				break;
 			}
 
-			ledger_db_ = NewKeyValueDb(db_config);
+			ledger_db_ = NewKeyValueDb(db_config, "ledger");
+			drivers_.push_back(ledger_db_);
 			if (!ledger_db_->Open(db_config.ledger_db_path_, ledger_max_open_files)) {
 				LOG_ERROR("Ledger db path(%s) open fail(%s)\n",
 					db_config.ledger_db_path_.c_str(), ledger_db_->error_desc().c_str());
 				break;
 			}
 
-			account_db_ = NewKeyValueDb(db_config);
+			if (db_config.history_depth_ > 0) {
+				HistoryDb *history_db = new HistoryDb(ledger_db_);
+				ledger_db_ = history_db;
+				if (!history_db->Initialize(db_config.history_path_, db_config.history_depth_, db_config.history_segment_ledgers_)) {
+					LOG_ERROR("History db path(%s) open fail", db_config.history_path_.c_str());
+					break;
+				}
+			}
+
+			account_db_ = NewKeyValueDb(db_config, "account");
+			drivers_.push_back(account_db_);
 			if (!account_db_->Open(db_config.account_db_path_, account_max_open_files)) {
 				LOG_ERROR("Ledger db path(%s) open fail(%s)\n",
 					db_config.account_db_path_.c_str(), account_db_->error_desc().c_str());
@@ -367,6 +1278,7 @@ namespace phantom {
 
 	bool  Storage::CloseDb() {
 		bool ret1 = true, ret2 = true, ret3 = true;
+		drivers_.clear();
 		if (keyvalue_db_ != NULL) {
 			ret1 = keyvalue_db_->Close();
 			delete keyvalue_db_;
@@ -392,6 +1304,14 @@ namespace phantom {
 		return CloseDb();
 	}
 
+	void Storage::OnTimer(int64_t current_time) {
+		for (size_t i = 0; i < drivers_.size(); i++) {
+			if (!drivers_[i]->SyncGroup(current_time)) {
+				LOG_ERROR("Sync the group writes of db failed(%s)", drivers_[i]->error_desc().c_str());
+			}
+		}
+	}
+
 	void Storage::OnSlowTimer(int64_t current_time) {
 	}
 
@@ -407,14 +1327,359 @@ namespace phantom {
 		return account_db_;
 	}
 
-	KeyValueDb *Storage::NewKeyValueDb(const DbConfigure &db_config) {
-		KeyValueDb *db = NULL;
+	void Storage::set_ledger_db(KeyValueDb *db) {
+		ledger_db_ = db;
+	}
+
+	void Storage::set_account_db(KeyValueDb *db) {
+		account_db_ = db;
+	}
+
+	KeyValueDb *Storage::NewKeyValueDb(const DbConfigure &db_config, const std::string &db) {
+		KeyValueDb *driver = NULL;
+		if (db_config.engine_ == "memory") {
+			driver = new MemoryDbDriver(db_config.memory_read_latency_, db_config.memory_write_latency_);
+		}
+		else {
+#ifdef WIN32
+			driver = new LevelDbDriver();
+#else
+			RocksDbDriver *rocksdb_driver = new RocksDbDriver();
+			if (db_config.column_families_) {
+				rocksdb_driver->SetNewFamilies(db);
+			}
+			driver = rocksdb_driver;
+#endif
+		}
+
+		std::string name = db == "keyvalue" ? db_config.keyvalue_durability_ :
+			(db == "ledger" ? db_config.ledger_durability_ : db_config.account_durability_);
+		WriteDurability durability = DURABILITY_SYNC;
+		if (!KeyValueDb::ParseDurability(name, durability)) {
+			LOG_WARN("Unknown durability(%s) of %s db, every write is synced", name.c_str(), db.c_str());
+		}
+		driver->SetDurability(durability, (int64_t)db_config.group_sync_interval_ * utils::MICRO_UNITS_PER_MILLI);
+		return driver;
+	}
+
+#ifndef WIN32
+	//copy source into a new db at path, then measure it. families is the db whose layout is used, empty for flat
+	static bool LoadDb(RocksDbDriver &source, const std::string &path, const std::string &families,
+		std::vector<std::string> &samples, bool sample, Json::Value &result) {
+		RocksDbDriver target;
+		target.EnableStatistics();
+		if (!families.empty()) {
+			target.SetNewFamilies(families);
+		}
+		if (!target.Open(path, -1)) {
+			LOG_ERROR("Open db(%s) failed(%s)", path.c_str(), target.error_desc().c_str());
+			return false;
+		}
+
+		int64_t begin = utils::Timestamp::HighResolution();
+		int64_t keys = 0, bytes = 0;
+		WRITE_BATCH batch;
+		ReadRange range;
+		range.fill_cache_ = false;
+		KeyValueIterator *it = source.NewIterator(range);
+		for (it->SeekToFirst(); it->Valid(); it->Next()) {
+			batch.Put(it->key(), it->value());
+			bytes += it->key().size() + it->value().size();
+			if (sample && keys % 64 == 0 && samples.size() < 10000) {
+				samples.push_back(it->key().ToString());
+			}
+			if (++keys % 10000 == 0) {
+				if (!target.WriteBatchUnsynced(batch)) break;
+				batch.Clear();
+			}
+		}
+		bool ok = it->ok();
+		delete it;
+
+		//written without the log, the flush makes it durable. compacted to the last level as a settled db would be
+		if (!ok || !target.WriteBatchUnsynced(batch) || !target.Flush() || !target.CompactAll()) {
+			LOG_ERROR("Load db(%s) failed(%s)", path.c_str(), ok ? target.error_desc().c_str() : "read source failed");
+			return false;
+		}
+		int64_t load_time = utils::Timestamp::HighResolution() - begin;
+
+		rocksdb::SetPerfLevel(rocksdb::kEnableCount);
+		rocksdb::perf_context.Reset();
+		std::string value;
+		for (size_t i = 0; i < samples.size(); i++) {
+			target.Get(samples[i], value);
+		}
+		uint64_t block_reads = rocksdb::perf_context.block_read_count;
+		rocksdb::SetPerfLevel(rocksdb::kDisable);
+
+		uint64_t written = target.GetTicker(rocksdb::FLUSH_WRITE_BYTES) + target.GetTicker(rocksdb::COMPACT_WRITE_BYTES);
+		utils::FileAttributes files;
+		int64_t size = 0;
+		utils::File::GetFileList(path, files);
+		for (auto iter = files.begin(); iter != files.end(); iter++) {
+			size += iter->second.size_;
+		}
+
+		result["keys"] = (Json::Int64)keys;
+		result["bytes"] = (Json::Int64)bytes;
+		result["disk_bytes"] = (Json::Int64)size;
+		result["load_ms"] = (Json::Int64)(load_time / utils::MICRO_UNITS_PER_MILLI);
+		result["write_amplification"] = utils::String::Format("%.2f", bytes > 0 ? (double)written / bytes : 0.0);
+		result["read_amplification"] = utils::String::Format("%.2f", samples.size() > 0 ? (double)block_reads / samples.size() : 0.0);
+		target.GetFamilyProperty("rocksdb.estimate-num-keys", result["family_keys"]);
+		target.Close();
+		return true;
+	}
+#endif
+
+	bool Storage::MigrateColumnFamilies(const DbConfigure &db_config, bool compare) {
+#ifdef WIN32
+		LOG_ERROR("Column families are only supported with rocksdb");
+		return false;
+#else
+		//without a block cache every read counts the blocks it needs
+		RocksDbDriver::SetBlockCache(0);
+
+		Json::Value result = Json::Value(Json::objectValue);
+		const std::string dbs[2][2] = { { "ledger", db_config.ledger_db_path_ }, { "account", db_config.account_db_path_ } };
+		for (size_t i = 0; i < 2; i++) {
+			const std::string &name = dbs[i][0];
+			const std::string &path = dbs[i][1];
+			std::string cf_path = path + ".cf";
+			std::string flat_path = path + ".flat";
+			std::string compare_path = path + ".compare";
+
+			RocksDbDriver source;
+			if (!source.Open(path, -1)) {
+				LOG_ERROR("Open %s db(%s) failed(%s)", name.c_str(), path.c_str(), source.error_desc().c_str());
+				return false;
+			}
+			if (!source.GetFamilies().empty()) {
+				LOG_INFO("The %s db has column families already", name.c_str());
+				continue;
+			}
+			if (utils::File::IsExist(flat_path)) {
+				LOG_ERROR("The old %s db(%s) is still there, remove it first", name.c_str(), flat_path.c_str());
+				return false;
+			}
+			if (utils::File::IsExist(cf_path)) utils::File::DeleteFolder(cf_path);
+			if (utils::File::IsExist(compare_path)) utils::File::DeleteFolder(compare_path);
+
+			std::vector<std::string> samples;
+			Json::Value &item = result[name];
+			if (!LoadDb(source, cf_path, name, samples, true, item["column_families"])) {
+				return false;
+			}
+			//the same keys in the old layout, for the numbers only
+			if (compare) {
+				bool ret = LoadDb(source, compare_path, "", samples, false, item["flat"]);
+				utils::File::DeleteFolder(compare_path);
+				if (!ret) return false;
+			}
+			source.Close();
+
+			if (!utils::File::Move(path, flat_path) || !utils::File::Move(cf_path, path)) {
+				LOG_ERROR_ERRNO("Move %s db failed", name.c_str(), STD_ERR_CODE, STD_ERR_DESC);
+				return false;
+			}
+			LOG_INFO("Migrated %s db to column families, the old one is kept in %s", name.c_str(), flat_path.c_str());
+		}
+
+		printf("%s\n", result.toStyledString().c_str());
+		return true;
+#endif
+	}
+
+	//the header of the last closed ledger, the ledger and account db must both end at it
+	static bool LoadClosedHeader(KeyValueDb &ledger_db, KeyValueDb &account_db, protocol::LedgerHeader &header) {
+		std::string ledger_seq, account_seq, str_header;
+		if (ledger_db.Get(General::KEY_LEDGER_SEQ, ledger_seq) <= 0 || account_db.Get(General::KEY_LEDGER_SEQ, account_seq) <= 0) {
+			LOG_ERROR("Load the last ledger seq failed");
+			return false;
+		}
+		if (ledger_seq != account_seq) {
+			LOG_ERROR("The ledger db ends at ledger %s but the account db at %s", ledger_seq.c_str(), account_seq.c_str());
+			return false;
+		}
+		int64_t seq = utils::String::Stoi64(ledger_seq);
+		if (ledger_db.Get(ComposePrefix(General::LEDGER_PREFIX, seq), str_header) <= 0 || !header.ParseFromString(str_header)) {
+			LOG_ERROR("Load ledger(" FMT_I64 ") header failed(%s)", seq, ledger_db.error_desc().c_str());
+			return false;
+		}
+		return true;
+	}
+
+	//hard link every file of source into dest, copy where a link is not possible
+	static bool LinkFiles(const std::string &source, const std::string &dest) {
+		utils::FileAttributes files;
+		if (!utils::File::GetFileList(source, files)) {
+			LOG_ERROR_ERRNO("List dir(%s) failed", source.c_str(), STD_ERR_CODE, STD_ERR_DESC);
+			return false;
+		}
+		if (!utils::File::IsExist(dest) && !utils::File::CreateDir(dest)) {
+			LOG_ERROR_ERRNO("Create dir(%s) failed", dest.c_str(), STD_ERR_CODE, STD_ERR_DESC);
+			return false;
+		}
+		for (auto iter = files.begin(); iter != files.end(); iter++) {
+			if (iter->second.is_directory_) continue;
+			std::string from = source + "/" + iter->first;
+			std::string to = dest + "/" + iter->first;
+#ifndef WIN32
+			if (link(from.c_str(), to.c_str()) == 0) continue;
+#endif
+			if (!utils::File::Copy(from, to, false)) {
+				LOG_ERROR_ERRNO("Copy file(%s) failed", from.c_str(), STD_ERR_CODE, STD_ERR_DESC);
+				return false;
+			}
+		}
+		return true;
+	}
+
+	bool Storage::CreateCheckpoint(const DbConfigure &db_config, const std::string &dir) {
 #ifdef WIN32
-		db = new LevelDbDriver();
+		LOG_ERROR("Checkpoints are only supported with rocksdb");
+		return false;
 #else
-		db = new RocksDbDriver();
+		if (db_config.engine_ == "memory") {
+			LOG_ERROR("Checkpoints need a db on disk");
+			return false;
+		}
+		const std::string dbs[3][2] = { { "keyvalue", db_config.keyvalue_db_path_ },
+			{ "ledger", db_config.ledger_db_path_ }, { "account", db_config.account_db_path_ } };
+		for (size_t i = 0; i < 3; i++) {
+			if (!utils::File::IsExist(dbs[i][1])) {
+				LOG_ERROR("The %s db(%s) does not exist", dbs[i][0].c_str(), dbs[i][1].c_str());
+				return false;
+			}
+		}
+		if (utils::File::IsExist(dir)) {
+			LOG_ERROR("The checkpoint dir(%s) exists already", dir.c_str());
+			return false;
+		}
+
+		//the node is stopped, so the dbs hold whole ledgers only
+		RocksDbDriver drivers[3];
+		for (size_t i = 0; i < 3; i++) {
+			if (!drivers[i].Open(dbs[i][1], -1)) {
+				LOG_ERROR("Open %s db(%s) failed(%s)", dbs[i][0].c_str(), dbs[i][1].c_str(), drivers[i].error_desc().c_str());
+				return false;
+			}
+		}
+		protocol::LedgerHeader header;
+		if (!LoadClosedHeader(drivers[1], drivers[2], header)) {
+			return false;
+		}
+
+		if (!utils::File::CreateDir(dir)) {
+			LOG_ERROR_ERRNO("Create dir(%s) failed", dir.c_str(), STD_ERR_CODE, STD_ERR_DESC);
+			return false;
+		}
+		for (size_t i = 0; i < 3; i++) {
+			std::string path = utils::String::Format("%s/%s.db", dir.c_str(), dbs[i][0].c_str());
+			if (!drivers[i].CreateCheckpoint(path)) {
+				LOG_ERROR("Create checkpoint of %s db failed(%s)", dbs[i][0].c_str(), drivers[i].error_desc().c_str());
+				return false;
+			}
+		}
+		//the archived ledgers are not in the ledger db any more
+		bool history = db_config.history_depth_ > 0 && utils::File::IsExist(db_config.history_path_);
+		if (history && !LinkFiles(db_config.history_path_, dir + "/history")) {
+			return false;
+		}
+
+		Json::Value manifest;
+		manifest["ledger_seq"] = (Json::Int64)header.seq();
+		manifest["hash"] = utils::String::BinToHexString(header.hash());
+		manifest["account_tree_hash"] = utils::String::BinToHexString(header.account_tree_hash());
+		manifest["close_time"] = (Json::Int64)header.close_time();
+		manifest["create_time"] = (Json::Int64)utils::Timestamp::Now().timestamp();
+		manifest["history"] = history;
+		std::string content = manifest.toStyledString();
+		utils::File file;
+		if (!file.Open(dir + "/manifest.json", utils::File::FILE_M_WRITE | utils::File::FILE_M_TEXT) ||
+			file.Write(content.c_str(), 1, content.size()) != content.size() || !file.Flush()) {
+			LOG_ERROR_ERRNO("Write checkpoint manifest failed", STD_ERR_CODE, STD_ERR_DESC);
+			return false;
+		}
+		file.Close();
+
+		LOG_INFO("Created checkpoint(%s) at ledger(" FMT_I64 ")", dir.c_str(), header.seq());
+		printf("%s\n", content.c_str());
+		return true;
 #endif
+	}
+
+	bool Storage::RestoreCheckpoint(const DbConfigure &db_config, const std::string &dir) {
+#ifdef WIN32
+		LOG_ERROR("Checkpoints are only supported with rocksdb");
+		return false;
+#else
+		utils::File file;
+		std::string content;
+		Json::Value manifest;
+		if (!file.Open(dir + "/manifest.json", utils::File::FILE_M_READ | utils::File::FILE_M_TEXT)) {
+			LOG_ERROR_ERRNO("Open checkpoint manifest in dir(%s) failed", dir.c_str(), STD_ERR_CODE, STD_ERR_DESC);
+			return false;
+		}
+		file.ReadData(content, utils::BYTES_PER_MEGA);
+		file.Close();
+		if (!manifest.fromString(content)) {
+			LOG_ERROR("Parse checkpoint manifest failed");
+			return false;
+		}
 
-		return db;
+		const std::string dbs[3][2] = { { "keyvalue", db_config.keyvalue_db_path_ },
+			{ "ledger", db_config.ledger_db_path_ }, { "account", db_config.account_db_path_ } };
+		for (size_t i = 0; i < 3; i++) {
+			if (utils::File::IsExist(dbs[i][1])) {
+				LOG_ERROR("The %s db(%s) exists, remove it before restoring", dbs[i][0].c_str(), dbs[i][1].c_str());
+				return false;
+			}
+		}
+		bool history = manifest["history"].asBool();
+		if (history && db_config.history_depth_ <= 0) {
+			LOG_ERROR("The checkpoint has archived ledgers, set history_depth to read them");
+			return false;
+		}
+
+		for (size_t i = 0; i < 3; i++) {
+			if (!LinkFiles(utils::String::Format("%s/%s.db", dir.c_str(), dbs[i][0].c_str()), dbs[i][1])) {
+				return false;
+			}
+		}
+		if (history && !LinkFiles(dir + "/history", db_config.history_path_)) {
+			return false;
+		}
+
+		//the ledger manager checks the account tree root against this header when it starts
+		protocol::LedgerHeader header;
+		bool ret = false;
+		do {
+			RocksDbDriver ledger_db, account_db;
+			if (!ledger_db.Open(db_config.ledger_db_path_, -1) || !account_db.Open(db_config.account_db_path_, -1)) {
+				LOG_ERROR("Open the restored dbs failed(%s%s)", ledger_db.error_desc().c_str(), account_db.error_desc().c_str());
+				break;
+			}
+			if (!LoadClosedHeader(ledger_db, account_db, header)) {
+				break;
+			}
+			if (header.seq() != manifest["ledger_seq"].asInt64() ||
+				utils::String::BinToHexString(header.hash()) != manifest["hash"].asString() ||
+				utils::String::BinToHexString(header.account_tree_hash()) != manifest["account_tree_hash"].asString()) {
+				LOG_ERROR("The restored ledger(" FMT_I64 ") does not match the checkpoint manifest", header.seq());
+				break;
+			}
+			ret = true;
+		} while (false);
+
+		if (!ret) {
+			for (size_t i = 0; i < 3; i++) {
+				utils::File::DeleteFolder(dbs[i][1]);
+			}
+			return false;
+		}
+		LOG_INFO("Restored checkpoint(%s) at ledger(" FMT_I64 "), syncing on from there", dir.c_str(), header.seq());
+		return true;
+#endif
 	}
-}
\ No newline at end of file
+}
@@ -16,6 +16,8 @@
 #ifndef STORAGE_H_
 #define STORAGE_H_
 
+#include <set>
+#include <atomic>
 #include <unordered_map>
 #include <utils/headers.h>
 #include <utils/sqlparser.h>
@@ -35,24 +37,101 @@ namespace phantom {
 #define WRITE_BATCH_DATA(batch) (((std::string*)(&batch))->c_str())
 #define WRITE_BATCH_DATA_SIZE(batch) (((std::string*)(&batch))->size())
 #define SLICE       leveldb::Slice
+#define ITERATOR    leveldb::Iterator
+#define SNAPSHOT    leveldb::Snapshot
 #else 
 #define KVDB rocksdb
 #define WRITE_BATCH rocksdb::WriteBatch
 #define WRITE_BATCH_DATA(batch) (batch.Data().c_str())
 #define WRITE_BATCH_DATA_SIZE(batch) (batch.GetDataSize())
 #define SLICE       rocksdb::Slice
+#define ITERATOR    rocksdb::Iterator
+#define SNAPSHOT    rocksdb::Snapshot
 #endif
 
+	//keys and read options of an iterator
+	struct ReadRange {
+		ReadRange();
+		//keys starting with prefix
+		static ReadRange Prefix(const std::string &prefix);
+		//keys in [lower, upper), an empty upper has no bound
+		static ReadRange Between(const std::string &lower, const std::string &upper);
+
+		std::string prefix_;
+		std::string lower_;
+		std::string upper_;
+		//read a consistent view, null for the latest
+		const SNAPSHOT *snapshot_;
+		//false for scans which should not evict the blocks of point lookups
+		bool fill_cache_;
+	};
+
+	//forward iterator limited to a range
+	class KeyValueIterator {
+	public:
+		KeyValueIterator(const ReadRange &range);
+		~KeyValueIterator();
+
+		//the upper bound the native iterator can stop at, null if there is none
+		const SLICE *upper_bound() const { return upper_.empty() ? NULL : &upper_slice_; }
+		void Attach(ITERATOR *it) { it_ = it; }
+
+		void SeekToFirst();
+		//seek to key, not before the lower bound
+		void Seek(const std::string &key);
+		bool Valid() const;
+		void Next();
+		SLICE key() const { return it_->key(); }
+		SLICE value() const { return it_->value(); }
+		bool ok() const { return it_->status().ok(); }
+		std::string error_desc() const { return it_->status().ToString(); }
+
+	private:
+		ITERATOR *it_;
+		std::string lower_;
+		std::string upper_;
+		SLICE upper_slice_;
+	};
+
+	//how far a write is on disk when it returns. Through the log, a crash only loses the last writes
+	//of a db. WriteBatchUnsynced skips the log of a flat db, a later logged write may outlive it: the
+	//persister holds its slot from such a group to the flush of the db, so no write comes between
+	//them, and flushes the ledger db before the accounts of the group are written
+	enum WriteDurability {
+		DURABILITY_SYNC = 0, //the log is synced before the write returns
+		DURABILITY_GROUP = 1, //the log is written, and synced together with the others at most the group interval later
+		DURABILITY_WAL = 2 //the log is written and synced by the os only, for data which can be rebuilt
+	};
+
 	class KeyValueDb {
 	protected:
 		utils::Mutex mutex_;
 		std::string error_desc_;
+
+		//whether a write of durability syncs the log, a group write does once the last sync is one
+		//interval old. waiting gets the group writes the sync would cover
+		bool NeedSync(WriteDurability durability, int64_t &waiting);
+		//account a write done with NeedSync, returns ok
+		bool Written(bool ok, WriteDurability durability, bool synced, int64_t waiting);
 	public:
 		KeyValueDb();
-		~KeyValueDb();
+		virtual ~KeyValueDb();
+
+		//durability of Put, Delete and WriteBatch without a durability, group_interval in microseconds
+		void SetDurability(WriteDurability durability, int64_t group_interval);
+		WriteDurability durability() const { return durability_; }
+		//sync the log if group writes wait for longer than the group interval
+		bool SyncGroup(int64_t current_time);
+		//"sync", "group" or "wal"
+		static bool ParseDurability(const std::string &name, WriteDurability &durability);
+		static const char *DurabilityName(WriteDurability durability);
 		virtual bool Open(const std::string &db_path, int max_open_files) = 0;
 		virtual bool Close() = 0;
 		virtual int32_t Get(const std::string &key, std::string &value) = 0;
+		//read the db as it was when snapshot was taken
+		virtual int32_t Get(const std::string &key, std::string &value, const SNAPSHOT *snapshot) = 0;
+		//statuses are those of Get for each key, false if any read failed
+		virtual bool MultiGet(const std::vector<std::string> &keys, std::vector<std::string> &values, std::vector<int32_t> &statuses) = 0;
 		virtual bool Put(const std::string &key, const std::string &value) = 0;
 		virtual bool Delete(const std::string &key) = 0;
 		virtual bool GetOptions(Json::Value &options) = 0;
@@ -60,8 +139,23 @@ namespace phantom {
 			return error_desc_;
 		}
 		virtual bool WriteBatch(WRITE_BATCH &values) = 0;
+		//write with durability instead of the one of the db, for the batches which are a barrier
+		virtual bool WriteBatch(WRITE_BATCH &values, WriteDurability durability) = 0;
+		//write without syncing the log, not durable until Flush. A db of one family skips the log
+		virtual bool WriteBatchUnsynced(WRITE_BATCH &values) = 0;
+		virtual bool Flush() = 0;
+
+		//the caller deletes the iterator
+		virtual KeyValueIterator *NewIterator(const ReadRange &range) = 0;
+		//pin the current state of the db, until ReleaseSnapshot
+		virtual const SNAPSHOT *GetSnapshot() = 0;
+		virtual void ReleaseSnapshot(const SNAPSHOT *snapshot) = 0;
 
-		virtual void* NewIterator() = 0;
+	private:
+		WriteDurability durability_;
+		int64_t group_interval_;
+		std::atomic<int64_t> last_sync_time_;
+		std::atomic<int64_t> group_waiting_; //group writes since the last sync
 	};
 
 #ifdef WIN32
@@ -76,34 +170,148 @@ namespace phantom {
 		bool Open(const std::string &db_path, int max_open_files);
 		bool Close();
 		int32_t Get(const std::string &key, std::string &value);
+		int32_t Get(const std::string &key, std::string &value, const SNAPSHOT *snapshot);
+		bool MultiGet(const std::vector<std::string> &keys, std::vector<std::string> &values, std::vector<int32_t> &statuses);
 		bool Put(const std::string &key, const std::string &value);
 		bool Delete(const std::string &key);
 		bool GetOptions(Json::Value &options);
 		bool WriteBatch(WRITE_BATCH &values);
+		bool WriteBatch(WRITE_BATCH &values, WriteDurability durability);
+		bool WriteBatchUnsynced(WRITE_BATCH &values);
+		bool Flush();
 
-		void* NewIterator();
+		KeyValueIterator *NewIterator(const ReadRange &range);
+		const SNAPSHOT *GetSnapshot();
+		void ReleaseSnapshot(const SNAPSHOT *snapshot);
 	};
 #else
+	//tuning of a column family for the way its keys are used
+	enum ColumnFamilyProfile {
+		CF_PROFILE_DEFAULT = 0,
+		CF_PROFILE_POINT_LOOKUP = 1, //trie nodes and leaves, read by key, bloom filters and small blocks
+		CF_PROFILE_ARCHIVE = 2 //ledgers and transactions, written once, large compressed blocks
+	};
+
+	//a column family of the ledger or account db, keys go to the family with the longest matching prefix
+	struct ColumnFamilySpec {
+		std::string db_;
+		std::string name_;
+		std::vector<std::string> prefixes_;
+		ColumnFamilyProfile profile_;
+	};
+
 	class RocksDbDriver : public KeyValueDb {
 	private:
 		rocksdb::DB* db_;
+		//default family first, empty if the db has no other families
+		std::vector<rocksdb::ColumnFamilyHandle *> handles_;
+		std::vector<std::string> names_;
+		//prefix and family, longest prefix first
+		std::vector<std::pair<std::string, rocksdb::ColumnFamilyHandle *>> routes_;
+		//families a new db is created with
+		std::string new_families_db_;
+		std::shared_ptr<rocksdb::Statistics> statistics_;
+		static std::shared_ptr<rocksdb::Cache> block_cache_;
+		static bool no_block_cache_;
+
+		rocksdb::ColumnFamilyHandle *Route(const SLICE &key);
+		//values with every record moved to its family
+		void Route(WRITE_BATCH &values, WRITE_BATCH &routed);
+		bool Write(const rocksdb::WriteOptions &opt, WRITE_BATCH &values);
 
 	public:
 		RocksDbDriver();
 		~RocksDbDriver();
 
+		//the layout of the ledger and account db
+		static const std::vector<ColumnFamilySpec> &Families();
+		static rocksdb::ColumnFamilyOptions FamilyOptions(ColumnFamilyProfile profile);
+		//block cache shared by every db opened afterwards, in MB, 0 to read blocks from the files every time
+		static void SetBlockCache(size_t size);
+		//create the families of db ("ledger" or "account") if the db is new, before Open
+		void SetNewFamilies(const std::string &db);
+		//families the db is open with, empty if it is flat
+		const std::vector<std::string> &GetFamilies() { return names_; }
+		//property of every family, or of the db if it is flat
+		void GetFamilyProperty(const std::string &property, Json::Value &values);
+		//count flush and compaction bytes, before Open
+		void EnableStatistics();
+		uint64_t GetTicker(uint32_t ticker);
+		bool CompactAll();
+		//hard link the live files into a new db at dir, after flushing the memtables
+		bool CreateCheckpoint(const std::string &dir);
+
 		bool Open(const std::string &db_path, int max_open_files);
 		bool Close();
 		int32_t Get(const std::string &key, std::string &value);
+		int32_t Get(const std::string &key, std::string &value, const SNAPSHOT *snapshot);
+		bool MultiGet(const std::vector<std::string> &keys, std::vector<std::string> &values, std::vector<int32_t> &statuses);
 		bool Put(const std::string &key, const std::string &value);
 		bool Delete(const std::string &key);
 		bool GetOptions(Json::Value &options);
 		bool WriteBatch(WRITE_BATCH &values);
+		bool WriteBatch(WRITE_BATCH &values, WriteDurability durability);
+		bool WriteBatchUnsynced(WRITE_BATCH &values);
+		bool Flush();
 
-		void* NewIterator();
+		KeyValueIterator *NewIterator(const ReadRange &range);
+		const SNAPSHOT *GetSnapshot();
+		void ReleaseSnapshot(const SNAPSHOT *snapshot);
 	};
 #endif
 
+	//ordered map in memory, for profiling ledger close apart from the disk. Versions are kept only while a
+	//snapshot or an iterator may read them. Latencies in microseconds model a slow disk: read_latency is
+	//spent by each Get or MultiGet, write_latency by each synced write and Flush
+	class MemoryDbDriver : public KeyValueDb {
+	public:
+		MemoryDbDriver(uint32_t read_latency, uint32_t write_latency);
+		~MemoryDbDriver();
+
+		bool Open(const std::string &db_path, int max_open_files);
+		bool Close();
+		int32_t Get(const std::string &key, std::string &value);
+		int32_t Get(const std::string &key, std::string &value, const SNAPSHOT *snapshot);
+		bool MultiGet(const std::vector<std::string> &keys, std::vector<std::string> &values, std::vector<int32_t> &statuses);
+		bool Put(const std::string &key, const std::string &value);
+		bool Delete(const std::string &key);
+		bool GetOptions(Json::Value &options);
+		bool WriteBatch(WRITE_BATCH &values);
+		bool WriteBatch(WRITE_BATCH &values, WriteDurability durability);
+		bool WriteBatchUnsynced(WRITE_BATCH &values);
+		bool Flush();
+
+		KeyValueIterator *NewIterator(const ReadRange &range);
+		const SNAPSHOT *GetSnapshot();
+		void ReleaseSnapshot(const SNAPSHOT *snapshot);
+
+	private:
+		class Snapshot;
+		class Iterator;
+		struct Version {
+			uint64_t seq_;
+			bool exist_;
+			std::string value_;
+		};
+		typedef std::map<std::string, std::vector<Version>> VersionMap;
+
+		//the version of key read at seq, null if it does not exist then
+		static const Version *Find(const std::vector<Version> &versions, uint64_t seq);
+		//under the write lock, for the write of seq_
+		void Apply(const std::string &key, bool exist, const std::string &value);
+		bool Write(WRITE_BATCH &values, WriteDurability durability);
+		void Unpin(uint64_t seq);
+		void Wait(uint32_t latency);
+
+		utils::ReadWriteLock lock_;
+		VersionMap data_;
+		uint64_t seq_;
+		//seqs read by snapshots and iterators
+		std::multiset<uint64_t> pinned_;
+		uint32_t read_latency_;
+		uint32_t write_latency_;
+	};
+
 	class Storage : public utils::Singleton<phantom::Storage>, public TimerNotify {
 		friend class utils::Singleton<Storage>;
 	private:
@@ -113,13 +321,24 @@ namespace phantom {
 		KeyValueDb *keyvalue_db_;
 		KeyValueDb *ledger_db_;
 		KeyValueDb *account_db_;
+		//the dbs under any wrapper, whose group writes are synced by the timer
+		std::vector<KeyValueDb *> drivers_;
 
 		bool CloseDb();
 		bool DescribeTable(const std::string &name, const std::string &sql_create_table);
 		bool ManualDescribeTables();
 
-		KeyValueDb *NewKeyValueDb(const DbConfigure &db_config);
+		//db is "keyvalue", "ledger" or "account"
+		static KeyValueDb *NewKeyValueDb(const DbConfigure &db_config, const std::string &db);
 	public:
+		//copy a flat ledger and account db into column families, the flat ones are kept aside
+		//compare loads the keys once more in the flat layout, to report the amplification of both
+		static bool MigrateColumnFamilies(const DbConfigure &db_config, bool compare);
+		//link the three dbs, stopped at a closed ledger, into the new dir with a manifest of that ledger
+		static bool CreateCheckpoint(const DbConfigure &db_config, const std::string &dir);
+		//put the dbs of a checkpoint where the configure expects them, they must not exist yet
+		static bool RestoreCheckpoint(const DbConfigure &db_config, const std::string &dir);
+
 		bool Initialize(const DbConfigure &db_config, bool bdropdb);
 		bool Exit();
 
@@ -127,7 +346,11 @@ namespace phantom {
 		KeyValueDb *account_db();   //storage account tree
 		KeyValueDb *ledger_db();    //storage transaction and ledger
 
-		virtual void OnTimer(int64_t current_time) {};
+		//replace a db by a wrapper of it, the wrapper owns the old one
+		void set_ledger_db(KeyValueDb *db);
+		void set_account_db(KeyValueDb *db);
+
+		virtual void OnTimer(int64_t current_time);
 		virtual void OnSlowTimer(int64_t current_time);
 	};
 }
@@ -150,9 +150,12 @@ namespace phantom {
         return private_key_.GetEncAddress();
 	}
 
+	//the votes of a validator must survive a crash, whatever the durability of the db
 	bool Consensus::SaveValue(const std::string &name, const std::string &value) {
 		KeyValueDb *db = Storage::Instance().keyvalue_db();
-		return db->Put(utils::String::Format("%s_%s", phantom::General::CONSENSUS_PREFIX, name.c_str()), value);
+		WRITE_BATCH batch;
+		batch.Put(utils::String::Format("%s_%s", phantom::General::CONSENSUS_PREFIX, name.c_str()), value);
+		return db->WriteBatch(batch, DURABILITY_SYNC);
 	}
 
 	bool Consensus::SaveValue(const std::string &name, int64_t value) {
@@ -167,7 +170,9 @@ namespace phantom {
 
 	bool Consensus::DelValue(const std::string &name) {
 		KeyValueDb *db = Storage::Instance().keyvalue_db();
-		return db->Delete(utils::String::Format("%s_%s", phantom::General::CONSENSUS_PREFIX, name.c_str())) ? 1 : 0;
+		WRITE_BATCH batch;
+		batch.Delete(utils::String::Format("%s_%s", phantom::General::CONSENSUS_PREFIX, name.c_str()));
+		return db->WriteBatch(batch, DURABILITY_SYNC) ? 1 : 0;
 	}
 
 	int32_t Consensus::LoadValue(const std::string &name, int64_t &value) {
@@ -221,7 +226,7 @@ namespace phantom {
 		KeyValueDb *db = Storage::Instance().keyvalue_db();
 		bool ret = true;
 		if (write_size > 0) {
-			ret = db->WriteBatch(writes);
+			ret = db->WriteBatch(writes, DURABILITY_SYNC);
 			write_size = 0;
 		}
 
@@ -35,7 +35,14 @@ namespace phantom {
 
 	bool GlueManager::Initialize() {
 
-		tx_pool_ = std::make_shared<TransactionQueue>(Configure::Instance().ledger_configure_.queue_limit_,  Configure::Instance().ledger_configure_.queue_per_account_txs_limit_);
+		const LedgerConfigure &ledger_config = Configure::Instance().ledger_configure_;
+		tx_pool_ = std::make_shared<TransactionQueue>(ledger_config.queue_limit_, ledger_config.queue_per_account_txs_limit_,
+			(int64_t)ledger_config.queue_byte_limit_ * utils::BYTES_PER_MEGA, ledger_config.queue_shard_count_);
+		if (!admission_.Initialize(ledger_config.admission_thread_count_, ledger_config.admission_queue_size_, Global::Instance().GetIoService(),
+			[this](TransactionFrm::pointer tx, Result &err) { return OnTransaction(tx, err); })) {
+			LOG_ERROR("Initialize transaction admission failed");
+			return false;
+		}
 		process_uptime_ = time(NULL);
 		consensus_ = ConsensusManager::Instance().GetConsensus();
 		consensus_->SetNotify(this);
@@ -84,7 +91,7 @@ namespace phantom {
 	}
 
 	bool GlueManager::Exit() {
-		return true;
+		return admission_.Exit();
 	}
 
 	bool GlueManager::StartConsensus(const std::string &last_consavlue) {
@@ -98,8 +105,11 @@ namespace phantom {
 			LOG_INFO("Start consensus process, it is leader, just continue");
 		}
 
+		//no proof is made on a ledger which is not on disk
+		LedgerManager::Instance().WaitPersisted();
 		protocol::LedgerHeader lcl = LedgerManager::Instance().GetLastClosedLedger();
-		protocol::TransactionEnvSet txset_raw = tx_pool_->TopTransaction(Configure::Instance().ledger_configure_.max_trans_per_ledger_);
+		std::vector<TransactionFrm::pointer> top_txs;
+		tx_pool_->TopTransaction(Configure::Instance().ledger_configure_.max_trans_per_ledger_, top_txs);
 
 		int64_t next_close_time = utils::Timestamp::Now().timestamp();
 		if (next_close_time < lcl.close_time() + Configure::Instance().ledger_configure_.close_interval_) {
@@ -127,7 +137,12 @@ namespace phantom {
 
 		protocol::ConsensusValue propose_value;
 		do {
-			*propose_value.mutable_txset() = txset_raw;
+			protocol::TransactionEnvSet *txset = propose_value.mutable_txset();
+			txset->clear_txs();
+			txset->mutable_txs()->Reserve((int)top_txs.size());
+			for (std::size_t i = 0; i < top_txs.size(); i++) {
+				*txset->add_txs() = top_txs[i]->GetTransactionEnv();
+			}
 			propose_value.set_close_time(next_close_time);
 			propose_value.set_ledger_seq(lcl.seq() + 1);
 			propose_value.set_previous_ledger_hash(lcl.hash());
@@ -153,31 +168,24 @@ namespace phantom {
 			if (propose_result.block_timeout_) {
 				//remove the time out tx
 				//reduct to 1/2
-				protocol::TransactionEnvSet tmp_raw;
-				for (int32_t i = 0; i < txset_raw.txs_size() / 2; i ++) {
-					*tmp_raw.add_txs() = txset_raw.txs(i);
-				}
-
-				txset_raw = tmp_raw;
-
+				top_txs.resize(top_txs.size() / 2);
 				continue;
 			}
 
 			//need drop some tx
 			if (propose_result.need_dropped_tx_.size()) {
-				protocol::TransactionEnvSet *txs = propose_value.mutable_txset();
-				txs->clear_txs();
+				txset->clear_txs();
 
-				protocol::TransactionEnvSet tmp_raw;
-				for (int32_t i = 0; i < txset_raw.txs_size(); i++) {
-					if (propose_result.need_dropped_tx_.find(i) != propose_result.need_dropped_tx_.end()) {
+				std::vector<TransactionFrm::pointer> dropped_txs;
+				for (std::size_t i = 0; i < top_txs.size(); i++) {
+					if (propose_result.need_dropped_tx_.find((int32_t)i) != propose_result.need_dropped_tx_.end()) {
 						//remove from the cache
-						*tmp_raw.add_txs() = txset_raw.txs(i);
+						dropped_txs.push_back(top_txs[i]);
 					} else{
-						*txs->add_txs() = txset_raw.txs(i);
+						*txset->add_txs() = top_txs[i]->GetTransactionEnv();
 					}
 				}
-				tx_pool_->RemoveTxs(tmp_raw);
+				tx_pool_->RemoveTxs(dropped_txs);
 			} 
 
 			if (propose_result.cons_validation_.error_tx_ids_size() > 0 ||
@@ -197,6 +205,14 @@ namespace phantom {
 		return true;
 	}
 
+	bool GlueManager::SubmitTransaction(const std::string &blob, TransactionAdmission::Callback callback) {
+		return admission_.Submit(blob, callback);
+	}
+
+	bool GlueManager::IsAdmissionBusy() const {
+		return admission_.IsBusy();
+	}
+
 	bool GlueManager::OnTransaction(TransactionFrm::pointer tx, Result &err) {
 		TopicKey key(tx->GetSourceAddress(), tx->GetNonce());
 		std::string hash_value = tx->GetContentHash();
@@ -358,6 +374,10 @@ namespace phantom {
 			|| iter != hardfork_points_.end());
 	}
 
+	bool GlueManager::CheckProof(const protocol::ValidatorSet &validators, const std::string &consensus_value, const std::string &proof) {
+		return consensus_->CheckProof(validators, HashWrapper::Crypto(consensus_value), proof);
+	}
+
 	int32_t GlueManager::CheckValue(const std::string &value) {
 		protocol::ConsensusValue consensus_value;
 		if (!consensus_value.ParseFromString(value)) {
@@ -370,6 +390,9 @@ namespace phantom {
 			return check_helper_ret;
 		}
 
+		//the vote is part of the proof of the value, its parent is on disk first
+		LedgerManager::Instance().WaitPersisted();
+
 		ProposeTxsResult ignor_cons_validation;
 		if (!LedgerManager::Instance().context_manager_.SyncPreProcess(consensus_value,
 			false,
@@ -503,6 +526,8 @@ namespace phantom {
 		system_json["current_time"] = utils::Timestamp::Now().ToFormatString(false);
 		 
 		ledger_upgrade_.GetModuleStatus(data["ledger_upgrade"]);
+		admission_.GetModuleStatus(data["admission"]);
+		tx_pool_->GetModuleStatus(data["tx_pool"]);
 	}
 
 	int64_t GlueManager::GetIntervalTime(bool empty_block) {
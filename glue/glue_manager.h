@@ -24,6 +24,7 @@
 #include "transaction_set.h"
 #include "transaction_queue.h"
 #include "ledger_upgrade.h"
+#include "transaction_admission.h"
 
 namespace phantom {
 
@@ -56,6 +57,9 @@ namespace phantom {
 		//for ledger upgrade
 		LedgerUpgrade ledger_upgrade_;
 
+		//decodes and verifies received transactions before OnTransaction
+		TransactionAdmission admission_;
+
 		bool LoadLastLedger();
 		bool CreateGenesisLedger();
 		void StartLedgerCloseTimer();
@@ -73,6 +77,9 @@ namespace phantom {
 		int64_t GetIntervalTime(bool empty_block);
 
 		bool OnTransaction(TransactionFrm::pointer tx, Result &err);
+		//queue a serialized transaction for admission, false if the pipeline is full
+		bool SubmitTransaction(const std::string &blob, TransactionAdmission::Callback callback);
+		bool IsAdmissionBusy() const;
 		void OnConsensus(const ConsensusMsg &msg);
 		void NotifyErrTx(std::vector<TransactionFrm::pointer> &txs);
 
@@ -86,6 +93,8 @@ namespace phantom {
 
 		//should be called by ledger manager
 		bool CheckValueAndProof( const std::string &consensus_value, const std::string &proof);
+		//check only the proof, by the given validators, for a value beyond the last closed ledger
+		bool CheckProof(const protocol::ValidatorSet &validators, const std::string &consensus_value, const std::string &proof);
 		int32_t CheckValueHelper(const protocol::ConsensusValue &consensus_value, int64_t now);
 		size_t GetTransactionCacheSize();
 		void QueryTransactionCache(const uint32_t& num, std::vector<TransactionFrm::pointer>& txs);
@@ -0,0 +1,267 @@
+/*
+	phantom is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	phantom is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with phantom.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <utils/logger.h>
+#include <utils/system.h>
+#include <common/private_key.h>
+#include "transaction_admission.h"
+
+namespace phantom {
+
+	TransactionAdmission::TransactionAdmission() :
+		io_service_(NULL),
+		queue_size_(0),
+		enabled_(false),
+		next_seq_(0),
+		next_import_seq_(0),
+		pending_(0),
+		submit_count_(0),
+		reject_count_(0),
+		invalid_count_(0),
+		import_count_(0) {}
+
+	TransactionAdmission::~TransactionAdmission() {
+		Exit();
+	}
+
+	bool TransactionAdmission::Initialize(size_t thread_count, size_t queue_size, asio::io_service &io_service, ImportFunc import) {
+		io_service_ = &io_service;
+		import_ = import;
+		gate_ = std::make_shared<ImportGate>();
+		queue_size_ = std::max<size_t>(queue_size, 1);
+		if (thread_count == 0) {
+			thread_count = std::max<size_t>(utils::System::GetCpuCoreCount(), 1);
+		}
+
+		enabled_ = true;
+		for (size_t i = 0; i < thread_count; i++) {
+			utils::Thread *thread_p = new utils::Thread(this);
+			if (!thread_p->Start(utils::String::Format("admission-%d", (int32_t)i))) {
+				delete thread_p;
+				return false;
+			}
+			threads_.push_back(thread_p);
+		}
+
+		LOG_INFO("Transaction admission started with " FMT_SIZE " workers, queue size " FMT_SIZE, threads_.size(), queue_size_);
+		return true;
+	}
+
+	bool TransactionAdmission::Exit() {
+		//the imports still posted are dropped, and one running is waited for
+		if (gate_ != NULL) {
+			utils::MutexGuard guard(gate_->mutex_);
+			gate_->open_ = false;
+		}
+
+		if (threads_.empty()) {
+			return true;
+		}
+
+		enabled_ = false;
+		for (size_t i = 0; i < threads_.size(); i++) {
+			ingress_sem_.Signal();
+		}
+		for (size_t i = 0; i < threads_.size(); i++) {
+			threads_[i]->JoinWithStop();
+			delete threads_[i];
+		}
+		threads_.clear();
+		return true;
+	}
+
+	bool TransactionAdmission::Submit(const std::string &blob, Callback callback) {
+		if (!enabled_ || ++pending_ > (int64_t)queue_size_) {
+			pending_--;
+			reject_count_++;
+			return false;
+		}
+
+		do {
+			utils::MutexGuard guard(ingress_lock_);
+			Item item;
+			item.seq_ = next_seq_++;
+			item.blob_ = blob;
+			item.callback_ = callback;
+			ingress_.push_back(item);
+		} while (false);
+
+		submit_count_++;
+		ingress_sem_.Signal();
+		return true;
+	}
+
+	bool TransactionAdmission::IsBusy() const {
+		return !enabled_ || pending_ >= (int64_t)queue_size_;
+	}
+
+	void TransactionAdmission::Run(utils::Thread *thread) {
+		while (enabled_) {
+			ingress_sem_.Wait();
+
+			//take a batch so that the ingress lock and the import post are shared by its transactions
+			ItemVector items;
+			do {
+				utils::MutexGuard guard(ingress_lock_);
+				while (!ingress_.empty() && items.size() < BATCH_SIZE) {
+					items.push_back(ingress_.front());
+					ingress_.pop_front();
+				}
+			} while (false);
+
+			if (items.empty() || !enabled_) {
+				continue;
+			}
+
+			Decode(items);
+			Complete(items);
+		}
+	}
+
+	void TransactionAdmission::Decode(ItemVector &items) {
+		for (size_t i = 0; i < items.size(); i++) {
+			protocol::TransactionEnv env;
+			if (!env.ParseFromString(items[i].blob_)) {
+				invalid_count_++;
+				continue;
+			}
+
+			//verified one by one through the signature cache, so that consensus and apply find them there
+			items[i].tx_ = std::make_shared<TransactionFrm>(env, true);
+			items[i].blob_.clear();
+		}
+	}
+
+	void TransactionAdmission::Complete(ItemVector &items) {
+		utils::MutexGuard guard(reorder_lock_);
+		for (size_t i = 0; i < items.size(); i++) {
+			reorder_[items[i].seq_] = items[i];
+		}
+
+		std::shared_ptr<ItemVector> ready = std::make_shared<ItemVector>();
+		for (auto iter = reorder_.begin(); iter != reorder_.end() && iter->first == next_import_seq_;) {
+			ready->push_back(iter->second);
+			next_import_seq_++;
+			iter = reorder_.erase(iter);
+		}
+
+		//posted under the lock so that batches reach the import stage in order
+		if (!ready->empty()) {
+			std::shared_ptr<ImportGate> gate = gate_;
+			io_service_->post([this, gate, ready]() {
+				utils::MutexGuard guard(gate->mutex_);
+				if (gate->open_) {
+					Import(*ready);
+				}
+			});
+		}
+	}
+
+	void TransactionAdmission::Import(ItemVector &items) {
+		for (size_t i = 0; i < items.size(); i++) {
+			Item &item = items[i];
+			Result err;
+			if (item.tx_ == NULL) {
+				err.set_code(protocol::ERRCODE_INVALID_PARAMETER);
+				err.set_desc("Transaction can not be decoded");
+			}
+			else {
+				import_(item.tx_, err);
+				import_count_++;
+			}
+
+			if (item.callback_) {
+				item.callback_(item.tx_, err);
+			}
+		}
+		pending_ -= items.size();
+	}
+
+	void TransactionAdmission::GetModuleStatus(Json::Value &data) {
+		data["thread_count"] = (Json::UInt64)threads_.size();
+		data["queue_size"] = (Json::UInt64)queue_size_;
+		data["pending"] = (Json::Int64)pending_.load();
+		data["submit"] = (Json::Int64)submit_count_.load();
+		data["reject"] = (Json::Int64)reject_count_.load();
+		data["invalid"] = (Json::Int64)invalid_count_.load();
+		data["import"] = (Json::Int64)import_count_.load();
+	}
+
+	void TransactionAdmission::Bench(int32_t count) {
+		if (count <= 0) {
+			printf("the count of transactions must be positive\n");
+			return;
+		}
+
+		//a few senders like a busy network, each transaction signed on its own content
+		std::vector<std::string> blobs;
+		std::vector<PrivateKey *> keys;
+		for (int32_t i = 0; i < 64 && i < count; i++) {
+			keys.push_back(new PrivateKey(SIGNTYPE_ED25519));
+		}
+		for (int32_t i = 0; i < count; i++) {
+			PrivateKey *key = keys[i % keys.size()];
+			protocol::TransactionEnv env;
+			protocol::Transaction *tran = env.mutable_transaction();
+			tran->set_source_address(key->GetEncAddress());
+			tran->set_nonce(i / keys.size() + 1);
+			tran->set_fee_limit(1000000);
+			tran->set_gas_price(1000);
+			protocol::Operation *op = tran->add_operations();
+			op->set_type(protocol::Operation_Type_PAY_COIN);
+			op->mutable_pay_coin()->set_dest_address(keys[(i + 1) % keys.size()]->GetEncAddress());
+			op->mutable_pay_coin()->set_amount(1);
+
+			protocol::Signature *signature = env.add_signatures();
+			signature->set_sign_data(key->Sign(tran->SerializeAsString()));
+			signature->set_public_key(key->GetEncPublicKey());
+			blobs.push_back(env.SerializeAsString());
+		}
+		for (size_t i = 0; i < keys.size(); i++) {
+			delete keys[i];
+		}
+
+		Json::Value result = Json::Value(Json::objectValue);
+		result["count"] = count;
+		Json::Value &rounds = result["rounds"];
+		size_t cores = std::max<size_t>(utils::System::GetCpuCoreCount(), 1);
+		for (size_t threads = 1;; threads = std::min(threads * 2, cores)) {
+			asio::io_service io_service;
+			asio::io_service::work work(io_service);
+			int32_t done = 0;
+
+			TransactionAdmission admission;
+			admission.Initialize(threads, blobs.size(), io_service, [](TransactionFrm::pointer tx, Result &err) {
+				return true;
+			});
+
+			int64_t begin = utils::Timestamp::HighResolution();
+			for (size_t i = 0; i < blobs.size(); i++) {
+				admission.Submit(blobs[i], [&](TransactionFrm::pointer tx, const Result &err) {
+					if (++done == count) io_service.stop();
+				});
+			}
+			io_service.run();
+			int64_t used = utils::Timestamp::HighResolution() - begin;
+			admission.Exit();
+
+			Json::Value &round = rounds[rounds.size()];
+			round["threads"] = (Json::UInt64)threads;
+			round["per_second"] = (Json::Int64)(count * utils::MICRO_UNITS_PER_SEC / std::max<int64_t>(used, 1));
+			if (threads >= cores) break;
+		}
+		printf("%s\n", result.toStyledString().c_str());
+	}
+}
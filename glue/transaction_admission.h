@@ -0,0 +1,104 @@
+/*
+	phantom is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	phantom is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with phantom.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef TRANSACTION_ADMISSION_H_
+#define TRANSACTION_ADMISSION_H_
+
+#include <deque>
+#include <map>
+#include <atomic>
+#include <asio.hpp>
+#include <utils/thread.h>
+#include <ledger/transaction_frm.h>
+
+namespace phantom {
+
+	//Pipeline for transactions received as raw bytes. Submit puts them on a bounded queue,
+	//workers decode, hash and verify them in parallel, and the import stage runs on the given
+	//io_service in submit order. Submit fails when the pipeline is full, callers drop the
+	//transaction and tell the sender instead of queueing without limit
+	class TransactionAdmission : public utils::Runnable {
+	public:
+		//import stage, runs on the io_service thread
+		typedef std::function<bool(TransactionFrm::pointer tx, Result &err)> ImportFunc;
+		//called after import with the import result, tx is null if it could not be decoded
+		typedef std::function<void(TransactionFrm::pointer tx, const Result &err)> Callback;
+
+		TransactionAdmission();
+		~TransactionAdmission();
+
+		bool Initialize(size_t thread_count, size_t queue_size, asio::io_service &io_service, ImportFunc import);
+		bool Exit();
+
+		bool Submit(const std::string &blob, Callback callback);
+		//most of the pipeline is in use, new work should be refused
+		bool IsBusy() const;
+		void GetModuleStatus(Json::Value &data);
+
+		virtual void Run(utils::Thread *thread) override;
+
+		//ingest only throughput with 1, 2, 4 ... cores of workers
+		static void Bench(int32_t count);
+
+	private:
+		struct Item {
+			int64_t seq_;
+			std::string blob_;
+			TransactionFrm::pointer tx_;
+			Callback callback_;
+		};
+		typedef std::vector<Item> ItemVector;
+
+		//shared with the imports posted to the io_service, which only run while it is open
+		struct ImportGate {
+			ImportGate() :open_(true) {}
+			utils::Mutex mutex_;
+			bool open_;
+		};
+
+		static const size_t BATCH_SIZE = 64;
+
+		void Decode(ItemVector &items);
+		void Complete(ItemVector &items);
+		void Import(ItemVector &items);
+
+		std::vector<utils::Thread *> threads_;
+		asio::io_service *io_service_;
+		ImportFunc import_;
+		std::shared_ptr<ImportGate> gate_;
+		size_t queue_size_;
+		volatile bool enabled_;
+
+		//ingress, many producers and the workers
+		utils::Mutex ingress_lock_;
+		utils::Semaphore ingress_sem_;
+		std::deque<Item> ingress_;
+		int64_t next_seq_;
+
+		//decoded items wait here until all earlier ones are done
+		utils::Mutex reorder_lock_;
+		std::map<int64_t, Item> reorder_;
+		int64_t next_import_seq_;
+
+		//submitted and not yet imported
+		std::atomic<int64_t> pending_;
+		std::atomic<int64_t> submit_count_;
+		std::atomic<int64_t> reject_count_;
+		std::atomic<int64_t> invalid_count_;
+		std::atomic<int64_t> import_count_;
+	};
+}
+
+#endif
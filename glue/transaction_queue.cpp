@@ -14,92 +14,147 @@ along with phantom.  If not, see <http://www.gnu.org/licenses/>.
 */
 
 #include "transaction_queue.h"
+#include <utils/system.h>
 #include <ledger/ledger_manager.h>
 #include <algorithm>
+#include <queue>
+#include <google/protobuf/io/coded_stream.h>
 
 namespace phantom {
 
 	int64_t const QUEUE_TRANSACTION_TIMEOUT = 60 * utils::MICRO_UNITS_PER_SEC;
 
-	TransactionQueue::TransactionQueue(uint32_t queue_limit, uint32_t account_txs_limit)
-		: queue_(PriorityCompare{ *this }),
+	TransactionQueue::TransactionQueue(uint32_t queue_limit, uint32_t account_txs_limit, int64_t byte_limit, uint32_t shard_count)
+		: size_(0),
+		bytes_(0),
+		evicted_count_(0),
+		evicted_bytes_(0),
 		queue_limit_(queue_limit),
-		account_txs_limit_(account_txs_limit)
+		account_txs_limit_(account_txs_limit),
+		byte_limit_(byte_limit)
 	{
+		if (shard_count == 0) {
+			shard_count = (uint32_t)std::max<size_t>(utils::System::GetCpuCoreCount(), 1);
+		}
+		for (uint32_t i = 0; i < shard_count; i++) {
+			shards_.emplace_back(new Shard());
+		}
 	}
 
 	TransactionQueue::~TransactionQueue(){}
 
-	
-	std::pair<bool, TransactionFrm::pointer> TransactionQueue::Remove(QueueByAddressAndNonce::iterator& account_it, QueueByNonce::iterator& tx_it, bool del_empty){
-		TransactionFrm::pointer ptr = nullptr;
-		ptr = *tx_it->second.first;
-		queue_.erase(tx_it->second.first);
-		time_queue_.erase(tx_it->second.second);
-		account_it->second.erase(tx_it);
-		queue_by_hash_.erase(ptr->GetContentHash());
-
-		if (del_empty && account_it->second.empty()){
-			account_nonce_.erase(account_it->first);
-			queue_by_address_and_nonce_.erase(account_it);
+	int64_t TransactionQueue::TxBytes(const TransactionFrm::pointer &tx) {
+		//the full data is held three times: parsed in the env, serialized as the full data and as the
+		//transaction hashed for the content hash, each about the size of the serialization
+		return (int64_t)sizeof(TransactionFrm) + 3 * (int64_t)tx->GetFullData().size();
+	}
+
+	TransactionQueue::Shard &TransactionQueue::GetShard(const std::string& account_address) {
+		return *shards_[std::hash<std::string>()(account_address) % shards_.size()];
+	}
+
+	std::pair<bool, TransactionFrm::pointer> TransactionQueue::Remove(Shard &shard, QueueByAddress::iterator& account_it, QueueByNonce::iterator& tx_it, bool del_empty){
+		TransactionFrm::pointer ptr = tx_it->second.priority_->tx_;
+		shard.queue_.erase(tx_it->second.priority_);
+		shard.time_queue_.erase(tx_it->second.time_);
+		shard.price_queue_.erase(tx_it->second.price_);
+		account_it->second.txs_.erase(tx_it);
+		shard.queue_by_hash_.erase(ptr->GetContentHash());
+		size_--;
+
+		int64_t tx_bytes = TxBytes(ptr);
+		account_it->second.bytes_ -= tx_bytes;
+		shard.bytes_ -= tx_bytes;
+		bytes_ -= tx_bytes;
+
+		if (del_empty && account_it->second.txs_.empty()){
+			shard.accounts_.erase(account_it);
 		}
-		return std::move(std::make_pair(true, ptr));
+		return std::make_pair(true, ptr);
 	}
-	
 
-	std::pair<bool, TransactionFrm::pointer> TransactionQueue::Remove(const std::string& account_address,const int64_t& nonce){
-		TransactionFrm::pointer ptr = nullptr;
-		auto account_it =queue_by_address_and_nonce_.find(account_address);
-		if (account_it != queue_by_address_and_nonce_.end()){
-			auto tx_it = account_it->second.find(nonce);
-			if (tx_it != account_it->second.end()){
-				ptr = *tx_it->second.first;
-				queue_.erase(tx_it->second.first);
-				time_queue_.erase(tx_it->second.second);
-				account_it->second.erase(tx_it);
-				queue_by_hash_.erase(ptr->GetContentHash());
-
-				if (account_it->second.empty()){
-					queue_by_address_and_nonce_.erase(account_it);
-					account_nonce_.erase(account_address);
-				}
-				return std::move(std::make_pair(true, ptr));
+	std::pair<bool, TransactionFrm::pointer> TransactionQueue::Remove(Shard &shard, const std::string& account_address, const int64_t& nonce){
+		auto account_it = shard.accounts_.find(account_address);
+		if (account_it != shard.accounts_.end()){
+			auto tx_it = account_it->second.txs_.find(nonce);
+			if (tx_it != account_it->second.txs_.end()){
+				return Remove(shard, account_it, tx_it);
 			}
 		}
-		return std::move(std::make_pair(false, ptr));
+		return std::make_pair(false, TransactionFrm::pointer());
 	}
 	
-	void TransactionQueue::Insert(TransactionFrm::pointer const& tx){
+	void TransactionQueue::Insert(Shard &shard, Account &account, TransactionFrm::pointer const& tx){
 		// Insert into queue
-		auto inserted = queue_by_address_and_nonce_[tx->GetSourceAddress()].insert(std::make_pair(tx->GetNonce(), std::make_pair(PriorityQueue::iterator(), TimeQueue::iterator())));
-		PriorityQueue::iterator left = queue_.emplace(tx);
-		TimeQueue::iterator right = time_queue_.emplace(tx);
-		inserted.first->second.first = left;
-		inserted.first->second.second = right;
-		queue_by_hash_[tx->GetContentHash()]=tx;
+		auto inserted = account.txs_.insert(std::make_pair(tx->GetNonce(), QueueIters()));
+		inserted.first->second.priority_ = shard.queue_.emplace(tx->GetNonce() - account.nonce_, tx);
+		inserted.first->second.time_ = shard.time_queue_.emplace(tx);
+		inserted.first->second.price_ = shard.price_queue_.emplace(tx);
+		shard.queue_by_hash_[tx->GetContentHash()] = tx;
+		size_++;
+
+		int64_t tx_bytes = TxBytes(tx);
+		account.bytes_ += tx_bytes;
+		shard.bytes_ += tx_bytes;
+		bytes_ += tx_bytes;
 	}
 
-	bool TransactionQueue::Import(TransactionFrm::pointer tx, const int64_t& cur_source_nonce,Result &result){
-		utils::WriteLockGuard g(lock_);
-		bool inserted = false;
-		bool replace = false;
-		uint32_t account_txs_size = 0;
+	void TransactionQueue::EvictLowest(Shard &shard){
+		TransactionFrm::pointer lowest = *shard.price_queue_.begin();
+		auto account_it = shard.accounts_.find(lowest->GetSourceAddress());
+		if (account_it == shard.accounts_.end()) {
+			LOG_ERROR("Account(%s) of pooled transaction(%s) not found", lowest->GetSourceAddress().c_str(), utils::String::BinToHexString(lowest->GetContentHash()).c_str());
+			return;
+		}
 
-		account_nonce_[tx->GetSourceAddress()] = cur_source_nonce;
+		//from the last nonce down to the lowest priced one
+		bool last_one = false;
+		while (!last_one) {
+			auto tx_it = std::prev(account_it->second.txs_.end());
+			if (tx_it->first < lowest->GetNonce())
+				break;
 
-		LOG_TRACE("Import account(%s) transaction(%s) nonce(" FMT_I64 ") gas_price(" FMT_I64 ")", tx->GetSourceAddress().c_str(), utils::String::BinToHexString(tx->GetContentHash()).c_str(), tx->GetNonce(), tx->GetGasPrice());
-		auto account_it = queue_by_address_and_nonce_.find(tx->GetSourceAddress());
-		if (account_it != queue_by_address_and_nonce_.end()) {
+			last_one = account_it->second.txs_.size() == 1;
+			TransactionFrm::pointer t = Remove(shard, account_it, tx_it).second;
+			evicted_count_++;
+			evicted_bytes_ += TxBytes(t);
+			LOG_TRACE("Discard lowest transaction(%s) of account(%s) gas_price(" FMT_I64 ") nonce(" FMT_I64 ")  in queue", utils::String::BinToHexString(t->GetContentHash()).c_str(), t->GetSourceAddress().c_str(), t->GetGasPrice(), t->GetNonce());
+		}
+	}
+
+	void TransactionQueue::SetNonce(Shard &shard, Account &account, int64_t nonce){
+		if (account.nonce_ == nonce)
+			return;
+
+		account.nonce_ = nonce;
+		for (auto it = account.txs_.begin(); it != account.txs_.end(); it++) {
+			PriorityKey key = *it->second.priority_;
+			key.height_ = it->first - nonce;
+			shard.queue_.erase(it->second.priority_);
+			it->second.priority_ = shard.queue_.insert(key);
+		}
+	}
 
-			account_txs_size = account_it->second.size();
+	bool TransactionQueue::Import(TransactionFrm::pointer tx, const int64_t& cur_source_nonce,Result &result){
+		Shard &shard = GetShard(tx->GetSourceAddress());
+		bool inserted = false;
+		do {
+			utils::WriteLockGuard g(shard.lock_);
+			bool replace = false;
+
+			auto account_it = shard.accounts_.emplace(tx->GetSourceAddress(), Account()).first;
+			Account &account = account_it->second;
+			SetNonce(shard, account, cur_source_nonce);
+			uint32_t account_txs_size = account.txs_.size();
 
-			auto tx_it = account_it->second.find(tx->GetNonce());
-			if (tx_it != account_it->second.end()){
+			LOG_TRACE("Import account(%s) transaction(%s) nonce(" FMT_I64 ") gas_price(" FMT_I64 ")", tx->GetSourceAddress().c_str(), utils::String::BinToHexString(tx->GetContentHash()).c_str(), tx->GetNonce(), tx->GetGasPrice());
+			auto tx_it = account.txs_.find(tx->GetNonce());
+			if (tx_it != account.txs_.end()){
 
-				if (tx->GetGasPrice() > (*tx_it->second.first)->GetGasPrice()) {
+				if (tx->GetGasPrice() > tx_it->second.priority_->gas_price_) {
 					//remove transaction for replace ,and after insert
-					std::string drop_hash = (*tx_it->second.first)->GetContentHash();
-					Remove(account_it, tx_it);
+					std::string drop_hash = tx_it->second.priority_->tx_->GetContentHash();
+					Remove(shard, account_it, tx_it, false);
 					replace = true;
 					account_txs_size--;
 					LOG_TRACE("Remove transaction(%s) for replace by transaction(%s) of account(%s) gas_price(" FMT_I64 ") nonce(" FMT_I64 ") in queue", utils::String::BinToHexString(drop_hash).c_str(), utils::String::BinToHexString(tx->GetContentHash()).c_str(), tx->GetSourceAddress().c_str(), tx->GetGasPrice(), tx->GetNonce());
@@ -113,171 +168,254 @@ namespace phantom {
 					return inserted;
 				}
 			}
-		}
 
-		if (replace || account_txs_size < account_txs_limit_) {
-			Insert(tx);	
-			inserted = true;
-			//todo...
-			while (queue_.size() > queue_limit_) {
-				TransactionFrm::pointer t = *queue_.rbegin();
-				Remove(t->GetSourceAddress(), t->GetNonce());
-
-				std::string error_desc = utils::String::Format("Discard lowest transaction(%s) of account(%s) gas_price(" FMT_I64 ") nonce(" FMT_I64 ")  in queue", utils::String::BinToHexString(t->GetContentHash()).c_str(), t->GetSourceAddress().c_str(), t->GetGasPrice(), t->GetNonce());
-				LOG_TRACE("%s", error_desc.c_str());
-				if (t->GetContentHash() == tx->GetContentHash()){
-					result.set_code(protocol::ERRCODE_TX_INSERT_QUEUE_FAIL);
-					result.set_desc(error_desc);
-					LOG_ERROR("%s", error_desc.c_str());
-					inserted = false;
-				}
+			if (replace || account_txs_size < account_txs_limit_) {
+				Insert(shard, account, tx);
+				inserted = true;
+			}
+			else if (account.txs_.empty()) {
+				shard.accounts_.erase(account_it);
 			}
-		}
 
-		if (account_txs_size >= account_txs_limit_){
-			inserted = false;
-			std::string error_desc = utils::String::Format(" transaction(%s) of account(%s) gas_price(" FMT_I64 ") nonce(" FMT_I64 ") exceed txs limit of per account in queue", utils::String::BinToHexString(tx->GetContentHash()).c_str(), tx->GetSourceAddress().c_str(), tx->GetGasPrice(), tx->GetNonce());
-			result.set_code(protocol::ERRCODE_TX_INSERT_QUEUE_FAIL);
-			result.set_desc(error_desc);
-			LOG_ERROR("%s", error_desc.c_str());
+			if (account_txs_size >= account_txs_limit_){
+				inserted = false;
+				std::string error_desc = utils::String::Format(" transaction(%s) of account(%s) gas_price(" FMT_I64 ") nonce(" FMT_I64 ") exceed txs limit of per account in queue", utils::String::BinToHexString(tx->GetContentHash()).c_str(), tx->GetSourceAddress().c_str(), tx->GetGasPrice(), tx->GetNonce());
+				result.set_code(protocol::ERRCODE_TX_INSERT_QUEUE_FAIL);
+				result.set_desc(error_desc);
+				LOG_ERROR("%s", error_desc.c_str());
+				return inserted;
+			}
+		} while (false);
+
+		//the pool is over its limits, drop the lowest of the whole pool once the lock of the shard is released
+		if (inserted) {
+			EvictOverLimit();
+			utils::ReadLockGuard g(shard.lock_);
+			if (shard.queue_by_hash_.find(tx->GetContentHash()) == shard.queue_by_hash_.end()) {
+				std::string error_desc = utils::String::Format("Discard lowest transaction(%s) of account(%s) gas_price(" FMT_I64 ") nonce(" FMT_I64 ")  in queue", utils::String::BinToHexString(tx->GetContentHash()).c_str(), tx->GetSourceAddress().c_str(), tx->GetGasPrice(), tx->GetNonce());
+				result.set_code(protocol::ERRCODE_TX_INSERT_QUEUE_FAIL);
+				result.set_desc(error_desc);
+				LOG_ERROR("%s", error_desc.c_str());
+				inserted = false;
+			}
 		}
 
 		return inserted;
 	}
 
-	protocol::TransactionEnvSet TransactionQueue::TopTransaction(uint32_t limit){
-		protocol::TransactionEnvSet set;
-		std::unordered_map<std::string, int64_t> topic_seqs;
-		std::unordered_map<std::string, int64_t> break_nonce_accounts;
-		int64_t last_block_seq = LedgerManager::Instance().GetLastClosedLedger().seq();
-		utils::WriteLockGuard g(lock_);
-		uint32_t i = 0;
-		
-		for (auto t = queue_.begin(); set.txs().size() < limit && t != queue_.end(); ++t) {
-			const TransactionFrm::pointer& tx = *t;
-			if (set.ByteSize() + tx->GetTransactionEnv().ByteSize() >= General::TXSET_LIMIT_SIZE)
+	void TransactionQueue::EvictOverLimit(){
+		utils::MutexGuard guard(evict_lock_);
+		while (size_ > (int64_t)queue_limit_ || (byte_limit_ > 0 && bytes_ > byte_limit_)) {
+			//the shard holding the lowest priced tx, the locks are taken one at a time so none waits for another
+			Shard *lowest_shard = NULL;
+			TransactionFrm::pointer lowest;
+			for (size_t i = 0; i < shards_.size(); i++) {
+				Shard &shard = *shards_[i];
+				utils::ReadLockGuard g(shard.lock_);
+				if (!shard.price_queue_.empty() && (lowest == NULL || GasPriceCompare()(*shard.price_queue_.begin(), lowest))) {
+					lowest = *shard.price_queue_.begin();
+					lowest_shard = &shard;
+				}
+			}
+			if (lowest_shard == NULL)
 				break;
-			
-			if (break_nonce_accounts.find(tx->GetSourceAddress()) == break_nonce_accounts.end()) {
 
-				int64_t last_seq = 0;
-				do {
-					//find this cache
-					auto this_iter = topic_seqs.find(tx->GetSourceAddress());
-					if (this_iter != topic_seqs.end()) {
-						last_seq = this_iter->second;
-						break;
-					}
+			//look again if an import or removal changed the head meanwhile
+			utils::WriteLockGuard g(lowest_shard->lock_);
+			if (!lowest_shard->price_queue_.empty() && *lowest_shard->price_queue_.begin() == lowest)
+				EvictLowest(*lowest_shard);
+		}
+	}
 
-					last_seq = account_nonce_[tx->GetSourceAddress()];
+	void TransactionQueue::TopShard(Shard &shard, uint32_t limit, std::vector<PriorityKey> &keys){
+		//taken nonce of the accounts, keyed by their lane which is stable while the lock is held
+		std::unordered_map<const Account *, int64_t> topic_seqs;
+		std::unordered_set<const Account *> break_nonce_accounts;
+
+		utils::ReadLockGuard g(shard.lock_);
+		keys.reserve(std::min<size_t>(limit, shard.queue_.size()));
+		for (auto t = shard.queue_.begin(); keys.size() < limit && t != shard.queue_.end(); ++t) {
+			const TransactionFrm::pointer& tx = t->tx_;
+			auto account_it = shard.accounts_.find(tx->GetTransactionEnv().transaction().source_address());
+			if (account_it == shard.accounts_.end())
+				continue;
+			const Account *account = &account_it->second;
+			if (break_nonce_accounts.find(account) != break_nonce_accounts.end())
+				continue;
+
+			int64_t last_seq = account->nonce_;
+			auto this_iter = topic_seqs.find(account);
+			if (this_iter != topic_seqs.end()) {
+				last_seq = this_iter->second;
+			}
 
-				} while (false);
+			if (tx->GetNonce() > last_seq + 1) {
+				break_nonce_accounts.insert(account);
+				continue;
+			}
 
-				if (tx->GetNonce() > last_seq + 1) {
-					break_nonce_accounts[tx->GetSourceAddress()] = last_seq + 1;
-					continue;
-				}
+			topic_seqs[account] = tx->GetNonce();
+			keys.push_back(*t);
+		}
+	}
 
-				topic_seqs[tx->GetSourceAddress()] = tx->GetNonce();
+	void TransactionQueue::Merge(const std::vector<std::vector<PriorityKey>> &lists, const std::function<bool(const PriorityKey &)> &visit){
+		//heads of the lists, the best one on top
+		typedef std::pair<size_t, size_t> Cursor;
+		auto worse = [&lists](const Cursor &first, const Cursor &second) {
+			return lists[second.first][second.second] < lists[first.first][first.second];
+		};
+		std::priority_queue<Cursor, std::vector<Cursor>, decltype(worse)> heads(worse);
+		for (size_t i = 0; i < lists.size(); i++) {
+			if (!lists[i].empty())
+				heads.push(Cursor(i, 0));
+		}
 
-				*set.add_txs() = tx->GetProtoTxEnv();
+		while (!heads.empty()) {
+			Cursor cursor = heads.top();
+			heads.pop();
+			if (!visit(lists[cursor.first][cursor.second]))
+				break;
+			if (++cursor.second < lists[cursor.first].size())
+				heads.push(cursor);
+		}
+	}
 
-				i++;
-				//LOG_TRACE("top(%u) addr(%s) tx(%s) nonce(" FMT_I64 ") gas_price(" FMT_I64 ") last block seq(" FMT_I64 ")", i, tx->GetSourceAddress().c_str(), utils::String::BinToHexString(tx->GetContentHash()).c_str(), tx->GetNonce(), tx->GetGasPrice(), last_block_seq);
-			}
+	uint32_t TransactionQueue::TopTransaction(uint32_t limit, std::vector<TransactionFrm::pointer> &txs){
+		int64_t last_block_seq = LedgerManager::Instance().GetLastClosedLedger().seq();
+		txs.clear();
+		txs.reserve(limit);
+
+		std::vector<std::vector<PriorityKey>> lists(shards_.size());
+		for (size_t i = 0; i < shards_.size(); i++) {
+			TopShard(*shards_[i], limit, lists[i]);
 		}
-		LOG_TRACE("Take top size(%u) , last block seq(" FMT_I64 ") limit(%u) , txset byte size(%d)byte (%d)M", i, last_block_seq, limit, set.ByteSize() ,set.ByteSize() / utils::BYTES_PER_MEGA);
-		return std::move(set);
+
+		uint32_t byte_size = 0;
+		Merge(lists, [&](const PriorityKey &key) {
+			if (txs.size() >= limit)
+				return false;
+
+			//size the tx adds to the set as an element of its repeated field
+			uint32_t tx_size = (uint32_t)key.tx_->GetFullData().size();
+			tx_size += 1 + google::protobuf::io::CodedOutputStream::VarintSize32(tx_size);
+			if (byte_size + tx_size >= (uint32_t)General::TXSET_LIMIT_SIZE)
+				return false;
+
+			txs.push_back(key.tx_);
+			byte_size += tx_size;
+			return true;
+		});
+		LOG_TRACE("Take top size(" FMT_SIZE ") , last block seq(" FMT_I64 ") limit(%u) , txset byte size(%u)byte (%u)M", txs.size(), last_block_seq, limit, byte_size, byte_size / utils::BYTES_PER_MEGA);
+		return byte_size;
 	}
 
 	uint32_t TransactionQueue::RemoveTxs(const protocol::TransactionEnvSet& set, bool close_ledger){
 		
 		uint32_t ret = 0;
 		int64_t last_seq = LedgerManager::Instance().GetLastClosedLedger().seq();
-		utils::WriteLockGuard g(lock_);
-		for (int i = 0; i < set.txs_size(); i++) {
-			auto txproto = set.txs(i);
-			std::string source_address = txproto.transaction().source_address();
-			int64_t nonce = txproto.transaction().nonce();
-			std::pair<bool, TransactionFrm::pointer> result = Remove(source_address, nonce);
-			if (result.first)
-				++ret;
-			
-			//LOG_TRACE("RemoveTxs close_ledger_flag(%d) (%d) removed(%d) addr(%s) nonce(" FMT_I64 ") fee(" FMT_I64 ") last seq(" FMT_I64 ")",
-			//	(int)close_ledger, i, (int)result.first, source_address.c_str(), nonce, (int64_t)txproto.transaction().fee(), last_seq);
 
-			//update system account nonce
-			auto it = account_nonce_.find(source_address);
-			if (close_ledger && it != account_nonce_.end() && it->second < nonce)
-				it->second = nonce;
+		//group the txs by shard to take each lock once
+		std::vector<std::vector<int32_t>> shard_txs(shards_.size());
+		for (int32_t i = 0; i < set.txs_size(); i++) {
+			const std::string &source_address = set.txs(i).transaction().source_address();
+			shard_txs[std::hash<std::string>()(source_address) % shards_.size()].push_back(i);
 		}
 
-		LOG_TRACE("RemoveTxs close_ledger_flag(%d) set txs size(%d) real remove(%u) after queue size(%u) last block seq(" FMT_I64 ")", 
-			(int)close_ledger, set.txs_size(), ret, queue_.size(), last_seq);
+		for (size_t s = 0; s < shards_.size(); s++) {
+			if (shard_txs[s].empty())
+				continue;
+
+			Shard &shard = *shards_[s];
+			utils::WriteLockGuard g(shard.lock_);
+			for (size_t j = 0; j < shard_txs[s].size(); j++) {
+				const protocol::Transaction &txproto = set.txs(shard_txs[s][j]).transaction();
+				const std::string &source_address = txproto.source_address();
+				int64_t nonce = txproto.nonce();
+				std::pair<bool, TransactionFrm::pointer> result = Remove(shard, source_address, nonce);
+				if (result.first)
+					++ret;
+
+				//update system account nonce
+				auto it = shard.accounts_.find(source_address);
+				if (close_ledger && it != shard.accounts_.end() && it->second.nonce_ < nonce)
+					SetNonce(shard, it->second, nonce);
+			}
+		}
+
+		LOG_TRACE("RemoveTxs close_ledger_flag(%d) set txs size(%d) real remove(%u) after queue size(" FMT_I64 ") last block seq(" FMT_I64 ")", 
+			(int)close_ledger, set.txs_size(), ret, size_.load(), last_seq);
 		return ret;
 	}
 
 	void TransactionQueue::RemoveTxs(std::vector<TransactionFrm::pointer>& txs, bool close_ledger){
-		utils::WriteLockGuard g(lock_);
 		uint32_t i = 0;
 		int64_t last_seq = LedgerManager::Instance().GetLastClosedLedger().seq();
 		for (auto it = txs.begin(); it != txs.end(); it++){
 			std::string source_address = (*it)->GetSourceAddress();
 			int64_t nonce = (*it)->GetNonce();
 
-			auto result = Remove(source_address, nonce);
+			Shard &shard = GetShard(source_address);
+			utils::WriteLockGuard g(shard.lock_);
+			auto result = Remove(shard, source_address, nonce);
 			i++;
 			LOG_TRACE("RemoveTxs close_ledger_flag(%d) (%u) removed(%d) addr(%s) tx(%s), nonce(" FMT_I64 ") gas_price(" FMT_I64 ") last seq(" FMT_I64 ")", 
 				(int)close_ledger, i, (int)result.first, (*it)->GetSourceAddress().c_str(),
 				utils::String::BinToHexString((*it)->GetContentHash()).c_str(), (*it)->GetNonce(), (*it)->GetGasPrice(), last_seq);
 
 			//update system account nonce
-			auto iter = account_nonce_.find(source_address);
-			if (close_ledger && iter != account_nonce_.end() && iter->second < nonce)
-				iter->second = nonce;
+			auto iter = shard.accounts_.find(source_address);
+			if (close_ledger && iter != shard.accounts_.end() && iter->second.nonce_ < nonce)
+				SetNonce(shard, iter->second, nonce);
 		}
-		LOG_TRACE("RemoveTxs after queue size(%u)", queue_.size());
+		LOG_TRACE("RemoveTxs after queue size(" FMT_I64 ")", size_.load());
 	}
 
 	void TransactionQueue::SafeRemoveTx(const std::string& account_address, const int64_t& nonce) {
-		utils::WriteLockGuard g(lock_);
-		std::pair<bool, TransactionFrm::pointer> result = Remove(account_address, nonce);
+		Shard &shard = GetShard(account_address);
+		utils::WriteLockGuard g(shard.lock_);
+		Remove(shard, account_address, nonce);
 	}
 
 
 
 	void TransactionQueue::CheckTimeout(int64_t current_time, std::vector<TransactionFrm::pointer>& timeout_txs){
-		utils::ReadLockGuard g(lock_);
-		for (auto it = time_queue_.begin(); it != time_queue_.end();it++){
-			if (!(*it)->CheckTimeout(current_time - QUEUE_TRANSACTION_TIMEOUT))
-				break;
-			timeout_txs.emplace_back(*it);
+		for (size_t i = 0; i < shards_.size(); i++) {
+			Shard &shard = *shards_[i];
+			utils::ReadLockGuard g(shard.lock_);
+			for (auto it = shard.time_queue_.begin(); it != shard.time_queue_.end(); it++){
+				if (!(*it)->CheckTimeout(current_time - QUEUE_TRANSACTION_TIMEOUT))
+					break;
+				timeout_txs.emplace_back(*it);
+			}
 		}
 	}
 
 	void TransactionQueue::CheckTimeoutAndDel(int64_t current_time,std::vector<TransactionFrm::pointer>& timeout_txs){
-		utils::WriteLockGuard g(lock_);
-		int64_t last_seq = LedgerManager::Instance().GetLastClosedLedger().seq();		
-		while (!time_queue_.empty()){
-			auto it =time_queue_.begin();
-			if (!(*it)->CheckTimeout(current_time - QUEUE_TRANSACTION_TIMEOUT))
-				break;
-			timeout_txs.emplace_back(*it);
-			std::string account_address = (*it)->GetSourceAddress();
-			int64_t nonce = (*it)->GetNonce();
-			Remove(account_address, nonce);
+		int64_t last_seq = LedgerManager::Instance().GetLastClosedLedger().seq();
+		for (size_t i = 0; i < shards_.size(); i++) {
+			Shard &shard = *shards_[i];
+			utils::WriteLockGuard g(shard.lock_);
+			while (!shard.time_queue_.empty()){
+				auto it = shard.time_queue_.begin();
+				if (!(*it)->CheckTimeout(current_time - QUEUE_TRANSACTION_TIMEOUT))
+					break;
+				TransactionFrm::pointer tx = *it;
+				timeout_txs.emplace_back(tx);
+				Remove(shard, tx->GetSourceAddress(), tx->GetNonce());
+			}
 		}
-		LOG_TRACE("CheckTimeoutAndDel last seq(" FMT_I64 ") number(%u)", last_seq, timeout_txs.size());
+		LOG_TRACE("CheckTimeoutAndDel last seq(" FMT_I64 ") number(" FMT_SIZE ")", last_seq, timeout_txs.size());
 	}
 
 	bool TransactionQueue::IsExist(const TransactionFrm::pointer& tx){
-		utils::ReadLockGuard g(lock_);
-		auto account_it1 = queue_by_address_and_nonce_.find(tx->GetSourceAddress());
-		if (account_it1 != queue_by_address_and_nonce_.end()){
-			auto tx_it = account_it1->second.find(tx->GetNonce());
-			if (tx_it != account_it1->second.end()){
-				TransactionFrm::pointer t = *tx_it->second.first;
-				if (t->GetContentHash() == tx->GetContentHash()){
+		Shard &shard = GetShard(tx->GetSourceAddress());
+		utils::ReadLockGuard g(shard.lock_);
+		auto account_it1 = shard.accounts_.find(tx->GetSourceAddress());
+		if (account_it1 != shard.accounts_.end()){
+			auto tx_it = account_it1->second.txs_.find(tx->GetNonce());
+			if (tx_it != account_it1->second.txs_.end()){
+				if (tx_it->second.priority_->tx_->GetContentHash() == tx->GetContentHash()){
 					return true;
 				}
 			}
@@ -287,37 +425,185 @@ namespace phantom {
 	}
 
 	bool TransactionQueue::IsExist(const std::string& hash){
-		utils::ReadLockGuard g(lock_);
-		auto it = queue_by_hash_.find(hash);
-		if (it != queue_by_hash_.end()){
-			return true;
-		}
-		return false;
+		TransactionFrm::pointer tx;
+		return Query(hash, tx);
 	}
 
 	size_t TransactionQueue::Size() {
-		utils::ReadLockGuard g(lock_);
-		return queue_.size();
+		return (size_t)size_.load();
 	}
 
 	void TransactionQueue::Query(const uint32_t& num, std::vector<TransactionFrm::pointer>& txs){
-		utils::ReadLockGuard g(lock_);
-		uint32_t count = 0;
+		std::vector<std::vector<PriorityKey>> lists(shards_.size());
+		for (size_t i = 0; i < shards_.size(); i++) {
+			Shard &shard = *shards_[i];
+			utils::ReadLockGuard g(shard.lock_);
+			for (auto it = shard.queue_.begin(); it != shard.queue_.end() && lists[i].size() < num; it++) {
+				lists[i].push_back(*it);
+			}
+		}
 
-		for (auto it = queue_.begin(); it != queue_.end() && count < num; it++) {
-			txs.push_back(*it);
+		uint32_t count = 0;
+		Merge(lists, [&](const PriorityKey &key) {
+			if (count >= num)
+				return false;
+			txs.push_back(key.tx_);
 			count++;
-		}
+			return true;
+		});
 	}
 
 	bool TransactionQueue::Query(const std::string& hash, TransactionFrm::pointer& tx){
-		utils::ReadLockGuard g(lock_);
-		auto it = queue_by_hash_.find(hash);
-		if (it != queue_by_hash_.end()){
-			tx = it->second;
-			return true;
+		//the hash does not tell the account, look in every shard
+		for (size_t i = 0; i < shards_.size(); i++) {
+			Shard &shard = *shards_[i];
+			utils::ReadLockGuard g(shard.lock_);
+			auto it = shard.queue_by_hash_.find(hash);
+			if (it != shard.queue_by_hash_.end()){
+				tx = it->second;
+				return true;
+			}
 		}
 		return false;
 	}
-}
 
+	void TransactionQueue::GetModuleStatus(Json::Value &data){
+		//accounts holding the most memory
+		const size_t largest_count = 5;
+		std::vector<std::pair<int64_t, Json::Value>> largest;
+		int64_t account_count = 0;
+
+		for (size_t i = 0; i < shards_.size(); i++) {
+			Shard &shard = *shards_[i];
+			utils::ReadLockGuard g(shard.lock_);
+			account_count += shard.accounts_.size();
+			for (auto it = shard.accounts_.begin(); it != shard.accounts_.end(); it++) {
+				const Account &account = it->second;
+				if (largest.size() >= largest_count && account.bytes_ <= largest.back().first)
+					continue;
+
+				Json::Value item;
+				item["address"] = it->first;
+				item["nonce"] = account.nonce_;
+				item["transaction_size"] = (Json::UInt64)account.txs_.size();
+				item["bytes"] = account.bytes_;
+				largest.emplace_back(account.bytes_, item);
+				std::sort(largest.begin(), largest.end(), [](const std::pair<int64_t, Json::Value> &first, const std::pair<int64_t, Json::Value> &second) {
+					return first.first > second.first;
+				});
+				if (largest.size() > largest_count)
+					largest.pop_back();
+			}
+		}
+
+		data["transaction_size"] = size_.load();
+		data["transaction_limit"] = queue_limit_;
+		data["bytes"] = bytes_.load();
+		data["byte_limit"] = byte_limit_;
+		data["account_size"] = account_count;
+		data["account_txs_limit"] = account_txs_limit_;
+		data["shard_count"] = (Json::UInt64)shards_.size();
+		data["evicted_count"] = evicted_count_.load();
+		data["evicted_bytes"] = evicted_bytes_.load();
+		Json::Value &accounts = data["largest_accounts"];
+		accounts = Json::Value(Json::arrayValue);
+		for (size_t i = 0; i < largest.size(); i++) {
+			accounts.append(largest[i].second);
+		}
+	}
+
+	//imports of the bench from one thread, the accounts of index % step == first
+	class BenchImportTask : public utils::Runnable {
+	public:
+		BenchImportTask(TransactionQueue *queue, const std::vector<TransactionFrm::pointer> *txs, size_t first, size_t step, utils::Semaphore *done)
+			:queue_(queue), txs_(txs), first_(first), step_(step), done_(done) {}
+
+		virtual void Run(utils::Thread *this_thread) override {
+			//lanes of 10 nonces in a row, an account is imported by one thread in nonce order
+			for (size_t i = first_ * 10; i < txs_->size(); i += (i % 10 == 9) ? (step_ - 1) * 10 + 1 : 1) {
+				Result err;
+				queue_->Import((*txs_)[i], 0, err);
+			}
+			done_->Signal();
+		}
+
+	private:
+		TransactionQueue *queue_;
+		const std::vector<TransactionFrm::pointer> *txs_;
+		size_t first_;
+		size_t step_;
+		utils::Semaphore *done_;
+	};
+
+	void TransactionQueue::Bench(int32_t count, uint32_t limit) {
+		if (count <= 0 || limit == 0) {
+			printf("the count of transactions and the limit must be positive\n");
+			return;
+		}
+
+		//lanes of 10 nonces, prices spread so that the order is not the one of the imports
+		srand(1);
+		std::vector<TransactionFrm::pointer> pooled;
+		pooled.reserve(count);
+		for (int32_t i = 0; i < count; i++) {
+			protocol::TransactionEnv env;
+			protocol::Transaction *tran = env.mutable_transaction();
+			tran->set_source_address(utils::String::Format("bench_account_%d", i / 10));
+			tran->set_nonce(i % 10 + 1);
+			tran->set_fee_limit(1000000);
+			tran->set_gas_price(1000 + rand() % 1000);
+			protocol::Operation *op = tran->add_operations();
+			op->set_type(protocol::Operation_Type_PAY_COIN);
+			op->mutable_pay_coin()->set_dest_address(utils::String::Format("bench_account_%d", i / 10 + 1));
+			op->mutable_pay_coin()->set_amount(1);
+			pooled.push_back(std::make_shared<TransactionFrm>(env, false));
+		}
+
+		Json::Value result = Json::Value(Json::objectValue);
+		result["count"] = count;
+		result["limit"] = limit;
+		Json::Value &rounds = result["rounds"];
+		uint32_t cores = (uint32_t)std::max<size_t>(utils::System::GetCpuCoreCount(), 1);
+		for (uint32_t shards = 1;; shards = std::min(shards * 2, cores)) {
+			//as many importing threads as shards, over disjoint accounts
+			TransactionQueue queue((uint32_t)count, 10, 0, shards);
+			utils::ThreadPool pool;
+			if (!pool.Init("bench-import", shards)) {
+				printf("start the import threads failed\n");
+				return;
+			}
+			utils::Semaphore done;
+			std::vector<std::shared_ptr<BenchImportTask>> tasks;
+			int64_t begin = utils::Timestamp::HighResolution();
+			for (uint32_t i = 0; i < shards; i++) {
+				tasks.push_back(std::make_shared<BenchImportTask>(&queue, &pooled, i, shards, &done));
+				pool.AddTask(tasks.back().get());
+			}
+			for (uint32_t i = 0; i < shards; i++) {
+				done.Wait();
+			}
+			int64_t import_time = utils::Timestamp::HighResolution() - begin;
+			pool.Exit();
+
+			const int32_t times = 10;
+			std::vector<TransactionFrm::pointer> txs;
+			uint32_t byte_size = 0;
+			begin = utils::Timestamp::HighResolution();
+			for (int32_t i = 0; i < times; i++) {
+				byte_size = queue.TopTransaction(limit, txs);
+			}
+			int64_t top_time = (utils::Timestamp::HighResolution() - begin) / times;
+
+			Json::Value &round = rounds[rounds.size()];
+			round["shards"] = shards;
+			round["import_threads"] = shards;
+			round["import_us"] = (Json::Int64)import_time;
+			round["import_per_second"] = (Json::Int64)((int64_t)queue.Size() * utils::MICRO_UNITS_PER_SEC / std::max<int64_t>(import_time, 1));
+			round["top_us"] = (Json::Int64)top_time;
+			round["top_size"] = (Json::UInt64)txs.size();
+			round["top_bytes"] = byte_size;
+			if (shards >= cores) break;
+		}
+		printf("%s\n", result.toStyledString().c_str());
+	}
+}
@@ -24,16 +24,28 @@ along with phantom.  If not, see <http://www.gnu.org/licenses/>.
 #include <list>
 #include <unordered_map>
 #include <unordered_set>
+#include <atomic>
+#include <functional>
+#include <memory>
 
 namespace phantom {
 
+	//Pool of the transactions waiting for a ledger. Accounts are hashed by address to shards, each with
+	//its own lock, so imports, removals and sweeps of different accounts do not wait for each other.
+	//Inside a shard the txs of an account form a lane ordered by nonce, and the shard orders all its txs
+	//by their height above the account nonce, then by gas price. The proposed set is a merge of the
+	//shard orders. The pool is bounded by tx count and by the memory of its txs, over either the lowest
+	//priced tx of the whole pool is dropped with the later nonces of its account
 	class TransactionQueue{
 	public:
-		TransactionQueue(uint32_t queue_limit, uint32_t account_txs_limit);
+		//byte_limit 0 for no memory bound, shard_count 0 for one shard per core
+		TransactionQueue(uint32_t queue_limit, uint32_t account_txs_limit, int64_t byte_limit = 0, uint32_t shard_count = 1);
 		~TransactionQueue();
 
 		bool Import(TransactionFrm::pointer tx, const int64_t& cur_source_nonce, Result &result);
-		protocol::TransactionEnvSet TopTransaction(uint32_t limit);
+		//the txs to propose in priority order, at most limit and within the txset byte limit. Only pointers
+		//are taken under the read lock of each shard. Returns the byte size of their txset
+		uint32_t TopTransaction(uint32_t limit, std::vector<TransactionFrm::pointer> &txs);
 		uint32_t RemoveTxs(const protocol::TransactionEnvSet& set, bool close_ledger = false);
 		void RemoveTxs(std::vector<TransactionFrm::pointer>& txs, bool close_ledger = false);
 		void CheckTimeout(int64_t current_time, std::vector<TransactionFrm::pointer>& timeout_txs);
@@ -45,22 +57,30 @@ namespace phantom {
 
 		void Query(const uint32_t& num,std::vector<TransactionFrm::pointer>& txs);
 		bool Query(const std::string& hash,TransactionFrm::pointer& tx);
+
+		void GetModuleStatus(Json::Value &data);
+
+		//memory accounted for a pooled tx, its object and three times its full data
+		static int64_t TxBytes(const TransactionFrm::pointer &tx);
+		//import throughput of count txs and time to take the proposed set of at most limit, with 1, 2, 4 ...
+		//cores of shards and as many importing threads
+		static void Bench(int32_t count, uint32_t limit);
 	private:
 
-		struct PriorityCompare
+		/// Order transaction by nonce height and fee, the height is kept in the key since the account nonce moves.
+		struct PriorityKey
 		{
-			TransactionQueue& transaction_queue_;
-			/// Compare transaction by nonce height and fee.
-			bool operator()(TransactionFrm::pointer const& first, TransactionFrm::pointer const& second) const
+			PriorityKey(int64_t height, const TransactionFrm::pointer &tx) :height_(height), gas_price_(tx->GetGasPrice()), tx_(tx) {}
+			int64_t height_;
+			int64_t gas_price_;
+			TransactionFrm::pointer tx_;
+			bool operator<(const PriorityKey &other) const
 			{
-				int64_t const& height1 = first->GetNonce() - transaction_queue_.account_nonce_[first->GetSourceAddress()];
-				int64_t const& height2 = second->GetNonce() - transaction_queue_.account_nonce_[second->GetSourceAddress()];
-				return height1 < height2 || (height1 == height2 && first->GetGasPrice() > second->GetGasPrice());
+				return height_ < other.height_ || (height_ == other.height_ && gas_price_ > other.gas_price_);
 			}
 		};
 
-		using PriorityQueue = std::multiset<TransactionFrm::pointer, PriorityCompare>;
-		PriorityQueue queue_;
+		using PriorityQueue = std::multiset<PriorityKey>;
 
 
 		struct TimePriorityCompare
@@ -74,26 +94,76 @@ namespace phantom {
 
 		//time order
 		using TimeQueue = std::multiset<TransactionFrm::pointer, TimePriorityCompare>;
-		TimeQueue time_queue_;
 
-		using QueueIterPair = std::pair<PriorityQueue::iterator, TimeQueue::iterator>;
-		using QueueByNonce = std::map<int64_t, QueueIterPair>;
-		using QueueByAddressAndNonce = std::unordered_map<std::string, QueueByNonce>;
-		QueueByAddressAndNonce queue_by_address_and_nonce_;
+		struct GasPriceCompare
+		{
+			/// Compare transaction by gas price, the newest first among equal prices
+			bool operator()(TransactionFrm::pointer const& first, TransactionFrm::pointer const& second) const
+			{
+				return first->GetGasPrice() < second->GetGasPrice() ||
+					(first->GetGasPrice() == second->GetGasPrice() && first->GetInComingTime() > second->GetInComingTime());
+			}
+		};
 
-		std::unordered_map<std::string, TransactionFrm::pointer> queue_by_hash_;
-		//record account system nonce
-		std::unordered_map<std::string, int64_t> account_nonce_;
+		//eviction order
+		using PriceQueue = std::multiset<TransactionFrm::pointer, GasPriceCompare>;
+
+		struct QueueIters
+		{
+			PriorityQueue::iterator priority_;
+			TimeQueue::iterator time_;
+			PriceQueue::iterator price_;
+		};
+		using QueueByNonce = std::map<int64_t, QueueIters>;
+
+		//lane of an account
+		struct Account
+		{
+			Account() :nonce_(0), bytes_(0) {}
+			int64_t nonce_; //system nonce
+			int64_t bytes_;
+			QueueByNonce txs_;
+		};
+		using QueueByAddress = std::unordered_map<std::string, Account>;
+
+		struct Shard
+		{
+			Shard() :bytes_(0) {}
+			utils::ReadWriteLock lock_;
+			PriorityQueue queue_;
+			TimeQueue time_queue_;
+			PriceQueue price_queue_;
+			QueueByAddress accounts_;
+			std::unordered_map<std::string, TransactionFrm::pointer> queue_by_hash_;
+			int64_t bytes_;
+		};
+		std::vector<std::unique_ptr<Shard>> shards_;
+		std::atomic<int64_t> size_;
+		std::atomic<int64_t> bytes_;
+		std::atomic<int64_t> evicted_count_;
+		std::atomic<int64_t> evicted_bytes_;
+		//one eviction of the whole pool at a time, so that two imports do not drop for the same excess
+		utils::Mutex evict_lock_;
 
 		uint32_t queue_limit_;
 		//Maximum number of transaction per account
 		uint32_t account_txs_limit_;
-
-		std::pair<bool, TransactionFrm::pointer> Remove(const std::string& account_address,const int64_t& nonce);
-		std::pair<bool, TransactionFrm::pointer> Remove(QueueByAddressAndNonce::iterator& account_it, QueueByNonce::iterator& tx_it, bool del_empty = true);
-		void Insert(TransactionFrm::pointer const& tx);
-
-		utils::ReadWriteLock lock_;
+		int64_t byte_limit_;
+
+		Shard &GetShard(const std::string& account_address);
+		std::pair<bool, TransactionFrm::pointer> Remove(Shard &shard, const std::string& account_address, const int64_t& nonce);
+		std::pair<bool, TransactionFrm::pointer> Remove(Shard &shard, QueueByAddress::iterator& account_it, QueueByNonce::iterator& tx_it, bool del_empty = true);
+		void Insert(Shard &shard, Account &account, TransactionFrm::pointer const& tx);
+		//drop the lowest priced tx of the shard with the later nonces of its account, they cannot apply without it
+		void EvictLowest(Shard &shard);
+		//drop the lowest priced txs of the pool until it is within its limits, no shard lock may be held
+		void EvictOverLimit();
+		//move the account nonce and re-key the heights of its txs
+		void SetNonce(Shard &shard, Account &account, int64_t nonce);
+		//executable txs of the shard in its priority order, at most limit
+		void TopShard(Shard &shard, uint32_t limit, std::vector<PriorityKey> &keys);
+		//visit the keys of the shard lists in priority order until visit returns false
+		static void Merge(const std::vector<std::vector<PriorityKey>> &lists, const std::function<bool(const PriorityKey &)> &visit);
 	};
 }
 
@@ -20,6 +20,8 @@
 #include "kv_trie.h"
 
 namespace phantom {
+	std::atomic<int64_t> AccountFrm::sub_trie_open_count_(0);
+	std::atomic<int64_t> AccountFrm::sub_trie_avoided_count_(0);
 
 	//AccountFrm::AccountFrm() {
 	//	utils::AtomicInc(&bubi::General::account_new_count);
@@ -177,13 +179,19 @@ namespace phantom {
 		result = phantom::Proto2Json(account_info_);
 	}
 
-	void AccountFrm::GetAllAssets(std::vector<protocol::AssetStore>& assets){
-		KVTrie trie;
-		auto batch = std::make_shared<WRITE_BATCH>();
+	void AccountFrm::GetAllAssets(std::vector<protocol::AssetStore>& assets, const SNAPSHOT *snapshot){
 		std::string prefix = ComposePrefix(General::ASSET_PREFIX, DecodeAddress(account_info_.address()));
-		trie.Init(Storage::Instance().account_db(), batch, prefix, 1);
 		std::vector<std::string> values;
-		trie.GetAll("", values);
+		if (snapshot != NULL) {
+			KVTrie::GetValues(Storage::Instance().account_db(), prefix, values, snapshot);
+		}
+		else {
+			KVTrie trie;
+			auto batch = std::make_shared<WRITE_BATCH>();
+			trie.Init(Storage::Instance().account_db(), batch, prefix, 1);
+			sub_trie_open_count_++;
+			trie.GetAll("", values);
+		}
 		for (size_t i = 0; i < values.size(); i++){
 			protocol::AssetStore asset;
 			asset.ParseFromString(values[i]);
@@ -191,13 +199,19 @@ namespace phantom {
 		}
 	}
 
-	void AccountFrm::GetAllMetaData(std::vector<protocol::KeyPair>& metadata){
-		KVTrie trie;
-		auto batch = std::make_shared<WRITE_BATCH>();
+	void AccountFrm::GetAllMetaData(std::vector<protocol::KeyPair>& metadata, const SNAPSHOT *snapshot){
 		std::string prefix = ComposePrefix(General::METADATA_PREFIX, DecodeAddress(account_info_.address()));
-		trie.Init(Storage::Instance().account_db(), batch, prefix, 1);
 		std::vector<std::string> values;
-		trie.GetAll("", values);
+		if (snapshot != NULL) {
+			KVTrie::GetValues(Storage::Instance().account_db(), prefix, values, snapshot);
+		}
+		else {
+			KVTrie trie;
+			auto batch = std::make_shared<WRITE_BATCH>();
+			trie.Init(Storage::Instance().account_db(), batch, prefix, 1);
+			sub_trie_open_count_++;
+			trie.GetAll("", values);
+		}
 		for (size_t i = 0; i < values.size(); i++){
 			protocol::KeyPair asset;
 			asset.ParseFromString(values[i]);
@@ -205,7 +219,7 @@ namespace phantom {
 		}
 	}
 
-	bool AccountFrm::GetAsset(const protocol::AssetKey &asset_key, protocol::AssetStore& asset){
+	bool AccountFrm::GetAsset(const protocol::AssetKey &asset_key, protocol::AssetStore& asset, const SNAPSHOT *snapshot){
 		//LOG_INFO("%p GetAsset", this);
 		auto it = assets_.find(asset_key);
 		if (it != assets_.end()){
@@ -216,15 +230,12 @@ namespace phantom {
 			return true;
 		}
 
-		auto batch = std::make_shared<WRITE_BATCH>();
 		std::string asset_prefix = ComposePrefix(General::ASSET_PREFIX, DecodeAddress(account_info_.address()));
-		KVTrie trie;
-		trie.Init(Storage::Instance().account_db(), batch, asset_prefix, 1);
-
 		auto asset_key_str = asset_key.SerializeAsString();
 		std::string buff;
 	
-		if (!trie.Get(asset_key_str, buff)){
+		sub_trie_avoided_count_++;
+		if (!KVTrie::GetValue(Storage::Instance().account_db(), asset_prefix, asset_key_str, buff, snapshot)){
 			return false;
 		}
 
@@ -247,7 +258,7 @@ namespace phantom {
 	}
 
 	//
-	bool AccountFrm::GetMetaData(const std::string& binkey, protocol::KeyPair& keypair_ptr){
+	bool AccountFrm::GetMetaData(const std::string& binkey, protocol::KeyPair& keypair_ptr, const SNAPSHOT *snapshot){
 		//return assets_->GetEntry(asset_property, asset);
 		auto it = metadata_.find(binkey);
 		if (it != metadata_.end()){
@@ -258,13 +269,10 @@ namespace phantom {
 			return true;
 		}
 
-		auto batch = std::make_shared<WRITE_BATCH>();
-		KVTrie trie;
 		std::string prefix = ComposePrefix(General::METADATA_PREFIX, DecodeAddress(account_info_.address()));
-		trie.Init(Storage::Instance().account_db(), batch, prefix, 1);
-
 		std::string buff;
-		if (!trie.Get(binkey, buff)){
+		sub_trie_avoided_count_++;
+		if (!KVTrie::GetValue(Storage::Instance().account_db(), prefix, binkey, buff, snapshot)){
 			return false;
 		}
 		
@@ -295,59 +303,92 @@ namespace phantom {
 	}
 
 	void AccountFrm::UpdateHash(std::shared_ptr<WRITE_BATCH> batch){
-		KVTrie trie_asset;
-		std::string asset_prefix = ComposePrefix(General::ASSET_PREFIX, DecodeAddress(account_info_.address()));
-		trie_asset.Init(Storage::Instance().account_db(), batch, asset_prefix, 1);
-
-		KVTrie trie_metadata;
-		std::string meta_prefix = ComposePrefix(General::METADATA_PREFIX, DecodeAddress(account_info_.address()));
-		trie_metadata.Init(Storage::Instance().account_db(), batch, meta_prefix, 1);
-
+		//MOD entries were only read from the tree, setting them again does not change it.
+		//a tree without real changes keeps its hash and is not opened at all
+		//the keys are distinct, so applying the sets before the deletes gives the same tree
+		std::vector<Trie::KeyValue> sets;
+		std::vector<std::string> deletes;
+		bool changed = false;
 		auto& map = assets_;
 		for (auto it = map.begin(); it != map.end(); it++){
 			auto action = it->second.action_;
-			auto asset = it->second.data_;
-			Json::Value tmp = Proto2Json(asset);
+			const protocol::AssetStore &asset = it->second.data_;
 			switch (action)
 			{
 			case utils::ChangeAction::ADD:
 			case utils::ChangeAction::MOD:
-				if (asset.amount() == 0)
-					trie_asset.Delete(asset.key().SerializeAsString());
-				else
-					trie_asset.Set(asset.key().SerializeAsString(), asset.SerializeAsString());
+				if (asset.amount() == 0){
+					deletes.push_back(asset.key().SerializeAsString());
+					changed = true;
+				}
+				else{
+					sets.push_back(Trie::KeyValue(asset.key().SerializeAsString(), asset.SerializeAsString()));
+					changed |= (action == utils::ChangeAction::ADD);
+				}
 				break;
 			case utils::ChangeAction::DEL:
-				trie_asset.Delete(asset.key().SerializeAsString());
+				deletes.push_back(asset.key().SerializeAsString());
+				changed = true;
 				break;
 
 			default:
 				break;
 			}
 		}
-		trie_asset.UpdateHash();
-		account_info_.set_assets_hash(trie_asset.GetRootHash());
+
+		if (changed || account_info_.assets_hash().empty()){
+			KVTrie trie_asset;
+			std::string asset_prefix = ComposePrefix(General::ASSET_PREFIX, DecodeAddress(account_info_.address()));
+			trie_asset.Init(Storage::Instance().account_db(), batch, asset_prefix, 1);
+			sub_trie_open_count_++;
+
+			trie_asset.SetBatch(sets);
+			trie_asset.DeleteBatch(deletes);
+			trie_asset.UpdateHash();
+			account_info_.set_assets_hash(trie_asset.GetRootHash());
+		}
+		else{
+			sub_trie_avoided_count_++;
+		}
 		
+		sets.clear();
+		deletes.clear();
+		changed = false;
 		for (auto it = metadata_.begin(); it != metadata_.end(); it++){
 			auto action = it->second.action_;
-			auto kp = it->second.data_;
+			const protocol::KeyPair &kp = it->second.data_;
 
 			switch (action)
 			{
 			case utils::ADD:
 			case utils::MOD:
-				trie_metadata.Set(it->first, kp.SerializeAsString());
+				sets.push_back(Trie::KeyValue(it->first, kp.SerializeAsString()));
+				changed |= (action == utils::ADD);
 				break;
 			case utils::DEL:
-				trie_metadata.Delete(it->first);
+				deletes.push_back(it->first);
+				changed = true;
 				break;
 
 			default:
 				break;
 			}
 		}
-		trie_metadata.UpdateHash();
-		account_info_.set_metadatas_hash(trie_metadata.GetRootHash());
+
+		if (changed || account_info_.metadatas_hash().empty()){
+			KVTrie trie_metadata;
+			std::string meta_prefix = ComposePrefix(General::METADATA_PREFIX, DecodeAddress(account_info_.address()));
+			trie_metadata.Init(Storage::Instance().account_db(), batch, meta_prefix, 1);
+			sub_trie_open_count_++;
+
+			trie_metadata.SetBatch(sets);
+			trie_metadata.DeleteBatch(deletes);
+			trie_metadata.UpdateHash();
+			account_info_.set_metadatas_hash(trie_metadata.GetRootHash());
+		}
+		else{
+			sub_trie_avoided_count_++;
+		}
 	}
 
 	void AccountFrm::NonceIncrease(){
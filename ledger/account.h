@@ -16,6 +16,7 @@
 #ifndef BUBI_ACCOUNT_H_
 #define BUBI_ACCOUNT_H_
 
+#include <atomic>
 #include <utils/base_int.h>
 #include <utils/crypto.h>
 #include <utils/logger.h>
@@ -53,20 +54,21 @@ namespace phantom {
 
 		void ToJson(Json::Value &result);
 
-		void GetAllAssets(std::vector<protocol::AssetStore>& assets);
+		//snapshot reads them as they were when it was taken, null for the latest
+		void GetAllAssets(std::vector<protocol::AssetStore>& assets, const SNAPSHOT *snapshot = NULL);
 
-		void GetAllMetaData(std::vector<protocol::KeyPair>& metadata);
+		void GetAllMetaData(std::vector<protocol::KeyPair>& metadata, const SNAPSHOT *snapshot = NULL);
 
 		std::string	Serializer();
 		bool	UnSerializer(const std::string &str);
 
 		std::string GetAccountAddress()const;
 
-		bool GetAsset(const protocol::AssetKey &asset_key, protocol::AssetStore& result);
+		bool GetAsset(const protocol::AssetKey &asset_key, protocol::AssetStore& result, const SNAPSHOT *snapshot = NULL);
 
 		void SetAsset(const protocol::AssetStore& result);
 
-		bool GetMetaData(const std::string& binkey, protocol::KeyPair& result);
+		bool GetMetaData(const std::string& binkey, protocol::KeyPair& result, const SNAPSHOT *snapshot = NULL);
 
 		void SetMetaData(const protocol::KeyPair& result);
 
@@ -109,6 +111,10 @@ namespace phantom {
 		int64_t GetAccountBalance() const;
 		bool AddBalance(int64_t amount);
 		static AccountFrm::pointer CreatAccountFrm(const std::string& account_address, int64_t balance);
+
+		//asset and metadata tree opens, and the ones saved by leaf reads or by skipping unchanged trees
+		static std::atomic<int64_t> sub_trie_open_count_;
+		static std::atomic<int64_t> sub_trie_avoided_count_;
 	public:
 
 		template <class T>
@@ -94,12 +94,18 @@ namespace phantom{
 		return AccountFromDB(address, account_ptr);
 	}
 
-	bool Environment::AccountFromDB(const std::string &address, AccountFrm::pointer &account_ptr){
+	bool Environment::AccountFromDB(const std::string &address, AccountFrm::pointer &account_ptr, const SNAPSHOT *snapshot){
 
+		//the flat index is kept with the account tree in the same batch, one point lookup instead of a tree walk
 		auto db = Storage::Instance().account_db();
 		std::string index = DecodeAddress(address);
 		std::string buff;
-		if (!LedgerManager::Instance().tree_->Get(index, buff)){
+		std::string key = ComposePrefix(General::ACCOUNT_INDEX_PREFIX, index);
+		int32_t ret = snapshot != NULL ? db->Get(key, buff, snapshot) : db->Get(key, buff);
+		if (ret < 0){
+			PROCESS_EXIT("database read failed. %s", db->error_desc().c_str());
+		}
+		else if (ret == 0){
 			return false;
 		}
 
@@ -58,7 +58,8 @@ namespace phantom {
 		void ClearChangeBuf();
 
 		virtual bool GetFromDB(const std::string &address, AccountFrm::pointer &account_ptr);
-		static bool AccountFromDB(const std::string &address, AccountFrm::pointer &account_ptr);
+		//snapshot reads the account db as it was pinned, null for the latest
+		static bool AccountFromDB(const std::string &address, AccountFrm::pointer &account_ptr, const SNAPSHOT *snapshot = NULL);
 		std::shared_ptr<Environment> NewStackFrameEnv();
 	};
 }
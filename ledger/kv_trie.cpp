@@ -13,6 +13,9 @@
 	along with phantom.  If not, see <http://www.gnu.org/licenses/>.
 */
 
+#ifndef WIN32
+#include <malloc.h>
+#endif
 #include "kv_trie.h"
 
 namespace phantom{
@@ -32,11 +35,11 @@ namespace phantom{
 		batch_ = batch;
 		Location location;
 		location.push_back(0);
-		root_ = std::make_shared< NodeFrm>(location);
+		root_ = NodeFrm::Create(location);
 
 		protocol::Node info;
 		if (storage_load(location, info)){
-			root_->info_.CopyFrom(info);
+			root_->FromProto(info);
 			Load(root_, depth);
 		}
 		return true;
@@ -64,15 +67,16 @@ namespace phantom{
 		return b;
 	}
 
-	void KVTrie::StorageSaveNode(NodeFrm::POINTER node) {
-		std::string buff = node->info_.SerializeAsString();
+	void KVTrie::StorageSaveNode(NodeFrm::POINTER node, const std::string& buff) {
 		std::string key = Location2DBkey(node->location_, false);
+		utils::MutexGuard guard(batch_mutex_);
 		batch_->Put(key, buff);
 		//LOG_DEBUG("save INNER(%s)", utils::String::BinToHexString(key).c_str());
 	}
 
 	void  KVTrie::StorageSaveLeaf(NodeFrm::POINTER node){
 		std::string key = Location2DBkey(node->location_, true);
+		utils::MutexGuard guard(batch_mutex_);
 		batch_->Put(key, *node->leaf_);
 		//LOG_DEBUG("save LEAF(%s)", utils::String::BinToHexString(key).c_str());
 	}
@@ -101,12 +105,14 @@ namespace phantom{
 	void KVTrie::StorageDeleteNode(NodeFrm::POINTER node) {
 		std::string key = Location2DBkey(node->location_, false);
 		//LOG_DEBUG("DELETE INNER %s", utils::String::BinToHexString(key).c_str());
+		utils::MutexGuard guard(batch_mutex_);
 		batch_->Delete(key);
 	}
 
 	void KVTrie::StorageDeleteLeaf(NodeFrm::POINTER node){
 		std::string key = Location2DBkey(node->location_, true);
 		//LOG_DEBUG("DELETE LEAF %s", utils::String::BinToHexString(key).c_str());
+		utils::MutexGuard guard(batch_mutex_);
 		batch_->Delete(key);
 	}
 
@@ -125,6 +131,39 @@ namespace phantom{
 		}
 	}
 
+	bool KVTrie::GetValue(phantom::KeyValueDb* db, const std::string& prefix, const std::string& key, std::string& value, const SNAPSHOT *snapshot){
+		std::string dbkey = prefix;
+		dbkey.push_back(LEAF_PREFIX);
+		dbkey += key;
+		int32_t stat = snapshot != NULL ? db->Get(dbkey, value, snapshot) : db->Get(dbkey, value);
+		if (stat == 1){
+			return true;
+		}
+		else if (stat == 0){
+			return false;
+		}
+		else{
+			PROCESS_EXIT("storage read failed. %s", db->error_desc().c_str());
+		}
+	}
+
+	void KVTrie::GetValues(phantom::KeyValueDb* db, const std::string& prefix, std::vector<std::string>& values, const SNAPSHOT *snapshot){
+		std::string leaf_prefix = prefix;
+		leaf_prefix.push_back(LEAF_PREFIX);
+		ReadRange range = ReadRange::Prefix(leaf_prefix);
+		range.snapshot_ = snapshot;
+		KeyValueIterator *it = db->NewIterator(range);
+		for (it->SeekToFirst(); it->Valid(); it->Next()) {
+			values.push_back(it->value().ToString());
+		}
+		bool ok = it->ok();
+		std::string error_desc = ok ? "" : it->error_desc();
+		delete it;
+		if (!ok) {
+			PROCESS_EXIT("storage read failed. %s", error_desc.c_str());
+		}
+	}
+
 	std::string KVTrie::HashCrypto(const std::string& input){
 		return HashWrapper::Crypto(input);
 	}
@@ -136,5 +175,65 @@ namespace phantom{
 		}
 		return prefix_ + key;
 	}
-}
 
+	//bytes of the protobuf form of node and its loaded subtree
+	static int64_t ProtoBytes(const NodeFrm::POINTER &node){
+		protocol::Node info;
+		node->ToProto(info);
+		int64_t bytes = info.SpaceUsed();
+		for (int i = 0; i < 16; i++){
+			if (node->children_[i] != nullptr){
+				bytes += ProtoBytes(node->children_[i]);
+			}
+		}
+		return bytes;
+	}
+
+	static int64_t HeapBytes(){
+#ifdef WIN32
+		return 0;
+#else
+		return (int64_t)(uint32_t)mallinfo().uordblks;
+#endif
+	}
+
+	void KVTrie::Bench(int64_t count){
+		MemoryDbDriver db(0, 0);
+		int64_t nodes_before = NodeFrm::NEWCOUNT - NodeFrm::DELCOUNT;
+		int64_t heap_before = HeapBytes();
+
+		KVTrie tree;
+		tree.Init(&db, std::make_shared<WRITE_BATCH>(), "bench", 4);
+		const int64_t batch_keys = 100000;
+		for (int64_t added = 0; added < count;){
+			std::vector<KeyValue> items;
+			for (; added < count && (int64_t)items.size() < batch_keys; added++){
+				std::string key = HashWrapper::Crypto(utils::String::ToString(added)).substr(0, 20);
+				items.push_back(KeyValue(key, utils::String::ToString(added)));
+			}
+			tree.SetBatch(items);
+		}
+		tree.UpdateHash();
+		//the rows of the nodes are not part of them
+		tree.batch_ = std::make_shared<WRITE_BATCH>();
+
+		int64_t nodes = std::max<int64_t>(NodeFrm::NEWCOUNT - NodeFrm::DELCOUNT - nodes_before, 1);
+		int64_t heap = HeapBytes() - heap_before;
+		Json::Value result = Json::Value(Json::objectValue);
+		result["keys"] = (Json::Int64)count;
+		result["nodes"] = (Json::Int64)nodes;
+		result["bytes_per_node"] = (Json::Int64)(heap / nodes);
+		result["heap_bytes"] = (Json::Int64)heap;
+		result["proto_bytes_per_node"] = (Json::Int64)(ProtoBytes(tree.root_) / nodes);
+		Json::Value &pools = result["pools"];
+		pools = Json::Value(Json::arrayValue);
+		const std::vector<const PoolUsage *> &usages = PoolUsages();
+		for (size_t i = 0; i < usages.size(); i++){
+			Json::Value &pool = pools[pools.size()];
+			pool["block_size"] = (Json::UInt64)usages[i]->block_size_;
+			pool["used"] = (Json::UInt64)usages[i]->used_;
+			pool["reserved_bytes"] = (Json::UInt64)(usages[i]->reserved_ * usages[i]->block_size_);
+		}
+		printf("%s\n", result.toStyledString().c_str());
+	}
+}
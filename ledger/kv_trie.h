@@ -24,6 +24,7 @@ namespace phantom{
 	class KVTrie :public Trie{
 		KeyValueDb* mdb_;
 		std::string prefix_;
+		utils::Mutex batch_mutex_; //UpdateHash may save nodes from several threads
 	public:
 		std::shared_ptr<WRITE_BATCH> batch_;
 		int64_t time_;
@@ -34,11 +35,22 @@ namespace phantom{
 
 		//int LeafCount();
 		bool AddToDB();
+
+		//read a committed value from its leaf row, without loading the tree under prefix.
+		//a leaf row exists exactly while its key is in the tree, so it is the same as Get after Init
+		//snapshot reads it as it was when the snapshot was taken, null for the latest
+		static bool GetValue(phantom::KeyValueDb* db, const std::string& prefix, const std::string& key, std::string& value, const SNAPSHOT *snapshot = NULL);
+		//the values of every leaf under prefix as they were in snapshot, read by their rows in key order
+		static void GetValues(phantom::KeyValueDb* db, const std::string& prefix, std::vector<std::string>& values, const SNAPSHOT *snapshot);
+
+		//build a tree of count keys in a memory db and print the memory of its nodes, in the pools and
+		//in the heap, with the size of the protobuf form they are only materialized in to be hashed
+		static void Bench(int64_t count);
 	private:
 		void Load(NodeFrm::POINTER node, int depth);
 	    std::string Location2DBkey(const Location& location, bool leaf);
 	protected:
-		virtual void StorageSaveNode(NodeFrm::POINTER node) override;
+		virtual void StorageSaveNode(NodeFrm::POINTER node, const std::string& buff) override;
 		virtual void StorageSaveLeaf(NodeFrm::POINTER node) override;
 		
 		virtual void StorageDeleteNode(NodeFrm::POINTER node) override;
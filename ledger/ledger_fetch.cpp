@@ -0,0 +1,460 @@
+/*
+	phantom is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	phantom is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with phantom.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <utils/logger.h>
+#include <overlay/peer_manager.h>
+#include <glue/glue_manager.h>
+#include <main/configure.h>
+#include "ledger_fetch.h"
+
+//range size of a peer before its throughput is known, the most older peers serve
+#define LEDGER_FETCH_FIRST_RANGE 5
+//ranges in flight to one peer
+#define LEDGER_FETCH_PEER_RANGES 2
+//a range is sized to be replied in about this time
+#define LEDGER_FETCH_REPLY_TIME (1 * utils::MICRO_UNITS_PER_SEC)
+#define LEDGER_FETCH_TIMEOUT (10 * utils::MICRO_UNITS_PER_SEC)
+#define LEDGER_FETCH_PROBATION (60 * utils::MICRO_UNITS_PER_SEC)
+//nothing received or closed for this long, the peers are asked for their max seq
+#define LEDGER_FETCH_PROBE_INTERVAL (30 * utils::MICRO_UNITS_PER_SEC)
+
+namespace phantom {
+
+	LedgerFetch::LedgerFetch() :verify_pool_(NULL), next_(0), request_next_(0), verified_seq_(0), update_time_(0),
+		request_count_(0), timeout_count_(0), received_count_(0), duplicate_count_(0), verified_count_(0), verify_failed_count_(0) {}
+
+	LedgerFetch::~LedgerFetch() {
+		if (verify_pool_ != NULL) {
+			delete verify_pool_;
+			verify_pool_ = NULL;
+		}
+	}
+
+	bool LedgerFetch::Initialize(uint32_t verify_thread_count) {
+		if (verify_thread_count == 0) {
+			return true;
+		}
+
+		verify_pool_ = new utils::ThreadPool();
+		if (!verify_pool_->Init("verify", verify_thread_count)) {
+			LOG_ERROR("Init ledger verify thread pool failed");
+			return false;
+		}
+		LOG_INFO("Ledger proof verify thread count:%u", verify_thread_count);
+		return true;
+	}
+
+	bool LedgerFetch::Exit() {
+		if (verify_pool_ != NULL) {
+			verify_pool_->Exit();
+		}
+		return true;
+	}
+
+	void LedgerFetch::SetNext(int64_t next) {
+		utils::MutexGuard guard(mutex_);
+		next_ = next;
+		verified_seq_ = MAX(verified_seq_, next - 1);
+		buffer_.erase(buffer_.begin(), buffer_.lower_bound(next));
+		if (request_next_ < next) {
+			request_next_ = next;
+		}
+		for (auto iter = retry_.begin(); iter != retry_.end() && iter->first < next;) {
+			int64_t end = iter->second;
+			iter = retry_.erase(iter);
+			if (end >= next) {
+				Retry(next, end);
+			}
+		}
+	}
+
+	void LedgerFetch::SetValidators(const protocol::ValidatorSet &validators, const std::string &validators_hash) {
+		utils::MutexGuard guard(mutex_);
+		validators_ = validators;
+		validators_hash_ = validators_hash;
+	}
+
+	void LedgerFetch::Touch(int64_t current_time) {
+		utils::MutexGuard guard(mutex_);
+		update_time_ = current_time;
+	}
+
+	void LedgerFetch::OnTimer(int64_t current_time, const std::set<int64_t> &active_peers, std::vector<Request> &requests) {
+		utils::MutexGuard guard(mutex_);
+		for (auto iter = peers_.begin(); iter != peers_.end();) {
+			Peer &peer = iter->second;
+			bool gone = active_peers.find(iter->first) == active_peers.end();
+			for (auto range = peer.ranges_.begin(); range != peer.ranges_.end();) {
+				if (!gone && current_time - range->second.send_time_ <= LEDGER_FETCH_TIMEOUT) {
+					range++;
+					continue;
+				}
+				if (!range->second.probe_) {
+					Retry(range->first, range->second.end_);
+				}
+				//peers of older versions do not reply to a probe past their last ledger
+				if (!gone && !range->second.probe_) {
+					LOG_INFO("Ledgers[" FMT_I64 "," FMT_I64 "] from peer(" FMT_I64 ") timed out", range->first, range->second.end_, iter->first);
+					timeout_count_++;
+					peer.timeouts_++;
+					//a peer too slow for a single ledger waits, others get smaller ranges
+					if (peer.range_size_ <= 1) {
+						peer.probation_ = current_time + LEDGER_FETCH_PROBATION;
+					}
+					peer.range_size_ = MAX(peer.range_size_ / 2, 1);
+				}
+				range = peer.ranges_.erase(range);
+			}
+
+			if (gone) {
+				iter = peers_.erase(iter);
+			}
+			else {
+				iter++;
+			}
+		}
+		for (auto iter = active_peers.begin(); iter != active_peers.end(); iter++) {
+			Peer &peer = peers_[*iter];
+			if (peer.range_size_ == 0) {
+				peer.range_size_ = LEDGER_FETCH_FIRST_RANGE;
+			}
+		}
+
+		if (current_time - update_time_ > LEDGER_FETCH_PROBE_INTERVAL) {
+			update_time_ = current_time;
+			LOG_INFO("OnTimer. request max ledger seq from neighbours. BEGIN");
+			for (auto iter = peers_.begin(); iter != peers_.end(); iter++) {
+				Peer &peer = iter->second;
+				if (peer.probation_ > current_time || !peer.ranges_.empty()) {
+					continue;
+				}
+				AddRequest(iter->first, peer, next_, next_, true, current_time, requests);
+			}
+			LOG_INFO("OnTimer. request max ledger seq from neighbours. END");
+		}
+
+		Dispatch(current_time, requests);
+	}
+
+	bool LedgerFetch::OnReceive(const protocol::Ledgers &ledgers, int64_t peer_id, int64_t current_time) {
+		utils::MutexGuard guard(mutex_);
+		auto iter = peers_.find(peer_id);
+		if (iter == peers_.end()) {
+			LOG_ERROR("received unexpected ledgers from (" FMT_I64 ")", peer_id);
+			return false;
+		}
+		Peer &peer = iter->second;
+
+		//the ranges past the max seq of the peer are asked from others, with no penalty
+		if (ledgers.values_size() == 0) {
+			bool asked = false;
+			for (auto range = peer.ranges_.begin(); range != peer.ranges_.end();) {
+				if (range->second.end_ <= ledgers.max_seq()) {
+					range++;
+					continue;
+				}
+				if (!range->second.probe_) {
+					Retry(range->first, range->second.end_);
+				}
+				asked = true;
+				range = peer.ranges_.erase(range);
+			}
+			if (!asked) {
+				LOG_ERROR("received unexpected max seq(" FMT_I64 ") from peer(" FMT_I64 ")", ledgers.max_seq(), peer_id);
+				return false;
+			}
+			peer.max_seq_ = ledgers.max_seq();
+			return true;
+		}
+
+		//a reply may stop early at the byte limit of the peer, never go past the range
+		int64_t begin = ledgers.values(0).ledger_seq();
+		int64_t end = ledgers.values(ledgers.values_size() - 1).ledger_seq();
+		auto range = peer.ranges_.find(begin);
+		bool valid = range != peer.ranges_.end() && end <= range->second.end_ && end - begin + 1 == ledgers.values_size();
+		for (int32_t i = 1; valid && i < ledgers.values_size(); i++) {
+			valid = ledgers.values(i).ledger_seq() == begin + i;
+		}
+		if (!valid) {
+			LOG_ERROR("received unexpected ledgers[" FMT_I64 "," FMT_I64 "] from peer(" FMT_I64 ")", begin, end, peer_id);
+			Probation(peer, current_time);
+			return false;
+		}
+
+		Range asked = range->second;
+		peer.ranges_.erase(range);
+		if (!asked.probe_ && end < asked.end_) {
+			Retry(end + 1, asked.end_);
+		}
+
+		update_time_ = current_time;
+		peer.max_seq_ = MAX(ledgers.max_seq(), end);
+
+		//size the next ranges of the peer to its throughput, a probe says little about it
+		int64_t count = ledgers.values_size();
+		if (!asked.probe_) {
+			double rate = (double)count * utils::MICRO_UNITS_PER_SEC / MAX(current_time - asked.send_time_, 1000);
+			peer.rate_ = peer.rate_ == 0 ? rate : peer.rate_ * 0.7 + rate * 0.3;
+			int64_t max_range = MAX((int64_t)Configure::Instance().ledger_configure_.max_ledger_per_message_, 1);
+			int64_t size = (int64_t)(peer.rate_ * LEDGER_FETCH_REPLY_TIME / utils::MICRO_UNITS_PER_SEC);
+			peer.range_size_ = MIN(MAX(size, 1), max_range);
+		}
+		peer.received_ += count;
+		received_count_ += count;
+
+		for (int32_t i = 0; i < ledgers.values_size(); i++) {
+			int64_t seq = begin + i;
+			if (seq < next_ || buffer_.find(seq) != buffer_.end()) {
+				duplicate_count_++;
+				continue;
+			}
+
+			Entry &entry = buffer_[seq];
+			entry.value_ = ledgers.values(i);
+			entry.proof_ = i < ledgers.values_size() - 1 ? ledgers.values(i + 1).previous_proof() : ledgers.proof();
+			entry.peer_id_ = peer_id;
+			if (verify_pool_ != NULL && !validators_hash_.empty()) {
+				verify_queue_.push_back(seq);
+				verify_pool_->AddTask(this);
+			}
+		}
+		return true;
+	}
+
+	void LedgerFetch::Dispatch(int64_t current_time, std::vector<Request> &requests) {
+		utils::MutexGuard guard(mutex_);
+		int64_t window_end = next_ + MAX(Configure::Instance().ledger_configure_.sync_window_, 1) - 1;
+		bool progress = true;
+		while (progress) {
+			//one range per peer and round, so that all the peers share the window
+			progress = false;
+			for (auto iter = peers_.begin(); iter != peers_.end(); iter++) {
+				Peer &peer = iter->second;
+				bool probing = !peer.ranges_.empty() && peer.ranges_.begin()->second.probe_;
+				if (probing || peer.probation_ > current_time || peer.ranges_.size() >= LEDGER_FETCH_PEER_RANGES || peer.max_seq_ < next_) {
+					continue;
+				}
+
+				int64_t begin = 0, end = 0;
+				auto retry = retry_.begin();
+				if (retry != retry_.end() && retry->first <= peer.max_seq_) {
+					begin = retry->first;
+					end = MIN(MIN(retry->second, begin + peer.range_size_ - 1), peer.max_seq_);
+					int64_t retry_end = retry->second;
+					retry_.erase(retry);
+					if (end < retry_end) {
+						retry_[end + 1] = retry_end;
+					}
+				}
+				else {
+					int64_t limit = MIN(window_end, peer.max_seq_);
+					if (request_next_ > limit) {
+						continue;
+					}
+					begin = request_next_;
+					end = MIN(limit, begin + peer.range_size_ - 1);
+					request_next_ = end + 1;
+				}
+				AddRequest(iter->first, peer, begin, end, false, current_time, requests);
+				progress = true;
+			}
+		}
+	}
+
+	void LedgerFetch::Send(const std::vector<Request> &requests) {
+		for (size_t i = 0; i < requests.size(); i++) {
+			LOG_TRACE("RequestConsensusValues from peer(" FMT_I64 "), [" FMT_I64 "," FMT_I64 "]",
+				requests[i].first, requests[i].second.begin(), requests[i].second.end());
+			PeerManager::Instance().ConsensusNetwork().SendRequest(requests[i].first, protocol::OVERLAY_MSGTYPE_LEDGERS,
+				requests[i].second.SerializeAsString());
+		}
+	}
+
+	int64_t LedgerFetch::max_seq() {
+		utils::MutexGuard guard(mutex_);
+		std::vector<int64_t> claims;
+		for (auto iter = peers_.begin(); iter != peers_.end(); iter++) {
+			if (iter->second.max_seq_ > 0) {
+				claims.push_back(iter->second.max_seq_);
+			}
+		}
+		if (claims.empty()) {
+			return verified_seq_;
+		}
+
+		//more than half of the peers with a claim report at least this seq
+		size_t index = claims.size() / 2;
+		std::nth_element(claims.begin(), claims.begin() + index, claims.end(), std::greater<int64_t>());
+		return MAX(verified_seq_, claims[index]);
+	}
+
+	bool LedgerFetch::Pop(int64_t seq, Entry &entry) {
+		utils::MutexGuard guard(mutex_);
+		auto iter = buffer_.find(seq);
+		if (iter == buffer_.end()) {
+			return false;
+		}
+		entry = iter->second;
+		buffer_.erase(iter);
+		return true;
+	}
+
+	void LedgerFetch::Reject(int64_t seq, int64_t peer_id, int64_t current_time) {
+		utils::MutexGuard guard(mutex_);
+		Retry(seq, seq);
+		for (auto iter = buffer_.begin(); iter != buffer_.end();) {
+			if (iter->second.peer_id_ == peer_id) {
+				Retry(iter->first, iter->first);
+				iter = buffer_.erase(iter);
+			}
+			else {
+				iter++;
+			}
+		}
+
+		auto iter = peers_.find(peer_id);
+		if (iter != peers_.end()) {
+			Probation(iter->second, current_time);
+		}
+	}
+
+	void LedgerFetch::Retry(int64_t begin, int64_t end) {
+		begin = MAX(begin, next_);
+		if (end < begin) {
+			return;
+		}
+
+		//join a range that ends right before
+		auto iter = retry_.lower_bound(begin);
+		if (iter != retry_.begin()) {
+			auto prev = std::prev(iter);
+			if (prev->second + 1 >= begin) {
+				prev->second = MAX(prev->second, end);
+				return;
+			}
+		}
+		int64_t &retry_end = retry_[begin];
+		retry_end = MAX(retry_end, end);
+	}
+
+	void LedgerFetch::AddRequest(int64_t peer_id, Peer &peer, int64_t begin, int64_t end, bool probe, int64_t current_time, std::vector<Request> &requests) {
+		Range &range = peer.ranges_[begin];
+		range.end_ = end;
+		range.send_time_ = current_time;
+		range.probe_ = probe;
+		request_count_++;
+
+		protocol::GetLedgers gl;
+		gl.set_begin(begin);
+		gl.set_end(end);
+		gl.set_timestamp(current_time);
+		requests.push_back(Request(peer_id, gl));
+	}
+
+	void LedgerFetch::Probation(Peer &peer, int64_t current_time) {
+		peer.probation_ = current_time + LEDGER_FETCH_PROBATION;
+		peer.max_seq_ = 0;
+		for (auto iter = peer.ranges_.begin(); iter != peer.ranges_.end(); iter++) {
+			if (!iter->second.probe_) {
+				Retry(iter->first, iter->second.end_);
+			}
+		}
+		peer.ranges_.clear();
+	}
+
+	void LedgerFetch::Run(utils::Thread *thread) {
+		int64_t seq = 0;
+		std::string value, proof, validators_hash;
+		protocol::ValidatorSet validators;
+		do {
+			utils::MutexGuard guard(mutex_);
+			if (verify_queue_.empty()) {
+				return;
+			}
+			seq = verify_queue_.front();
+			verify_queue_.pop_front();
+			auto iter = buffer_.find(seq);
+			if (iter == buffer_.end()) {
+				return;
+			}
+			value = iter->second.value_.SerializeAsString();
+			proof = iter->second.proof_;
+			validators = validators_;
+			validators_hash = validators_hash_;
+		} while (false);
+
+		//the ledgers before seq are not closed yet, their validator set is assumed to be the current one
+		bool valid = GlueManager::Instance().CheckProof(validators, value, proof);
+
+		utils::MutexGuard guard(mutex_);
+		auto iter = buffer_.find(seq);
+		if (iter == buffer_.end() || iter->second.proof_ != proof) {
+			return;
+		}
+		if (valid) {
+			verified_seq_ = MAX(verified_seq_, seq);
+			iter->second.verified_ = true;
+			iter->second.validators_hash_ = validators_hash;
+			verified_count_++;
+		}
+		else {
+			verify_failed_count_++;
+		}
+	}
+
+	Json::Value LedgerFetch::ToJson() {
+		utils::MutexGuard guard(mutex_);
+		Json::Value v;
+		v["update_time"] = (Json::Int64)update_time_;
+		v["next"] = (Json::Int64)next_;
+		v["request_next"] = (Json::Int64)request_next_;
+		v["verified_seq"] = (Json::Int64)verified_seq_;
+		v["buffered"] = (Json::UInt64)buffer_.size();
+		v["verify_queue"] = (Json::UInt64)verify_queue_.size();
+		int64_t retry_count = 0;
+		for (auto iter = retry_.begin(); iter != retry_.end(); iter++) {
+			retry_count += iter->second - iter->first + 1;
+		}
+		v["retry"] = (Json::Int64)retry_count;
+		v["requests"] = (Json::Int64)request_count_;
+		v["timeouts"] = (Json::Int64)timeout_count_;
+		v["received"] = (Json::Int64)received_count_;
+		v["duplicates"] = (Json::Int64)duplicate_count_;
+		v["verified"] = (Json::Int64)verified_count_;
+		v["verify_failed"] = (Json::Int64)verify_failed_count_;
+
+		int64_t in_flight = 0;
+		Json::Value &peers = v["peers"];
+		for (auto iter = peers_.begin(); iter != peers_.end(); iter++) {
+			const Peer &peer = iter->second;
+			Json::Value &item = peers[peers.size()];
+			item["pid"] = (Json::Int64)iter->first;
+			item["max_seq"] = (Json::Int64)peer.max_seq_;
+			item["probation"] = (Json::Int64)peer.probation_;
+			item["range_size"] = (Json::Int64)peer.range_size_;
+			item["rate"] = utils::String::Format("%.1f", peer.rate_);
+			item["received"] = (Json::Int64)peer.received_;
+			item["timeouts"] = (Json::Int64)peer.timeouts_;
+			Json::Value &ranges = item["ranges"];
+			ranges = Json::Value(Json::arrayValue);
+			for (auto range = peer.ranges_.begin(); range != peer.ranges_.end(); range++) {
+				ranges[ranges.size()] = utils::String::Format(FMT_I64 "-" FMT_I64, range->first, range->second.end_);
+				in_flight += range->second.end_ - range->first + 1;
+			}
+		}
+		v["in_flight"] = (Json::Int64)in_flight;
+		return v;
+	}
+}
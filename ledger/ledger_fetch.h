@@ -0,0 +1,125 @@
+/*
+	phantom is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	phantom is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with phantom.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef LEDGER_FETCH_H_
+#define LEDGER_FETCH_H_
+
+#include <deque>
+#include <utils/thread.h>
+#include <proto/cpp/overlay.pb.h>
+
+namespace phantom {
+
+	//Download scheduler of the ledgers replayed to catch up. A window of ledgers after the last closed one
+	//is split into ranges asked from all the active peers at once, the range size of each peer following
+	//its measured throughput. Replies may come in any order, their values wait in a reorder buffer and
+	//are handed out in seq order. The proofs of buffered values are checked on worker threads with the
+	//current validator set ahead of the apply cursor, a value checked with the set of its previous
+	//ledger is not checked again when it is closed
+	class LedgerFetch : public utils::Runnable {
+	public:
+		typedef std::pair<int64_t, protocol::GetLedgers> Request;
+
+		//a received value and the proof of it
+		struct Entry {
+			Entry() :peer_id_(0), verified_(false) {}
+			protocol::ConsensusValue value_;
+			std::string proof_;
+			int64_t peer_id_;
+			bool verified_;
+			std::string validators_hash_; //of the set the proof was checked with
+		};
+
+		LedgerFetch();
+		~LedgerFetch();
+
+		//verify_thread_count 0 leaves every check to the apply
+		bool Initialize(uint32_t verify_thread_count);
+		bool Exit();
+
+		//the apply cursor moved to next, the buffered values before it are dropped
+		void SetNext(int64_t next);
+		//the validators of the last closed ledger, which the proofs are checked with ahead
+		void SetValidators(const protocol::ValidatorSet &validators, const std::string &validators_hash);
+		//a ledger was closed by consensus, no probe needed for a while
+		void Touch(int64_t current_time);
+
+		//expire the late ranges, probe the peers if nothing came for long, and fill the window
+		void OnTimer(int64_t current_time, const std::set<int64_t> &active_peers, std::vector<Request> &requests);
+		//buffer the values of a reply, false if it was not asked for. A reply without values is from a peer
+		//which does not have the ledgers asked for and only tells its max seq
+		bool OnReceive(const protocol::Ledgers &ledgers, int64_t peer_id, int64_t current_time);
+		//fill the window after a reply
+		void Dispatch(int64_t current_time, std::vector<Request> &requests);
+		static void Send(const std::vector<Request> &requests);
+
+		//take the value of seq out of the buffer, false if it did not come yet
+		bool Pop(int64_t seq, Entry &entry);
+		//the value of seq from peer_id failed to close, drop what the peer sent and ask again
+		void Reject(int64_t seq, int64_t peer_id, int64_t current_time);
+
+		//the highest of the last seq with a checked proof and the max seq reported by a majority of the
+		//peers which reported one, a few peers claiming more move nothing
+		int64_t max_seq();
+		Json::Value ToJson();
+
+		virtual void Run(utils::Thread *thread) override;
+
+	private:
+		struct Range {
+			Range() :end_(0), send_time_(0), probe_(false) {}
+			int64_t end_;
+			int64_t send_time_;
+			bool probe_; //asks for the next ledger only to learn the max seq of the peer
+		};
+		struct Peer {
+			Peer() :max_seq_(0), probation_(0), range_size_(0), rate_(0), received_(0), timeouts_(0) {}
+			int64_t max_seq_; //last reported, 0 after a probation until it reports again
+			int64_t probation_;
+			int64_t range_size_;
+			double rate_; //ledgers per second of the replies
+			int64_t received_;
+			int64_t timeouts_;
+			std::map<int64_t, Range> ranges_; //in flight, by begin
+		};
+
+		//take [begin, end] back to be asked from another peer
+		void Retry(int64_t begin, int64_t end);
+		void AddRequest(int64_t peer_id, Peer &peer, int64_t begin, int64_t end, bool probe, int64_t current_time, std::vector<Request> &requests);
+		void Probation(Peer &peer, int64_t current_time);
+
+		utils::Mutex mutex_;
+		utils::ThreadPool *verify_pool_;
+		std::map<int64_t, Peer> peers_;
+		std::map<int64_t, int64_t> retry_; //ranges to ask again, begin to end
+		std::map<int64_t, Entry> buffer_;
+		std::deque<int64_t> verify_queue_;
+		int64_t next_; //apply cursor
+		int64_t request_next_; //first seq never asked for
+		int64_t verified_seq_; //last closed or with a checked proof
+		int64_t update_time_; //of the last reply or closed ledger
+		protocol::ValidatorSet validators_;
+		std::string validators_hash_;
+
+		int64_t request_count_;
+		int64_t timeout_count_;
+		int64_t received_count_;
+		int64_t duplicate_count_;
+		int64_t verified_count_;
+		int64_t verify_failed_count_;
+	};
+}
+
+#endif
@@ -23,6 +23,7 @@
 #include "ledger_frm.h"
 #include "ledgercontext_manager.h"
 #include "contract_manager.h"
+#include "parallel_executor.h"
 
 namespace phantom {
 
@@ -70,6 +71,16 @@ namespace phantom {
 
 
 	bool LedgerFrm::AddToDb(WRITE_BATCH &batch) {
+		AddToBatch(batch);
+
+		KeyValueDb *db = Storage::Instance().ledger_db();
+		if (!db->WriteBatch(batch, DURABILITY_SYNC)){
+			PROCESS_EXIT("Write ledger and transaction failed(%s)", db->error_desc().c_str());
+		}
+		return true;
+	}
+
+	void LedgerFrm::AddToBatch(WRITE_BATCH &batch) {
 		KeyValueDb *db = Storage::Instance().ledger_db();
 
 		batch.Put(phantom::General::KEY_LEDGER_SEQ, utils::String::ToString(ledger_.header().seq()));
@@ -140,11 +151,6 @@ namespace phantom {
 
 			batch.Put(General::LAST_TX_HASHS, new_last_hashs.SerializeAsString());
 		}
-
-		if (!db->WriteBatch(batch)){
-			PROCESS_EXIT("Write ledger and transaction failed(%s)", db->error_desc().c_str());
-		}
-		return true;
 	}
 
 	bool LedgerFrm::Cancel() {
@@ -235,35 +241,43 @@ namespace phantom {
 			return false;
 		}
 
+		std::shared_ptr<ParallelExecutor> executor = CreateExecutor(std::set<int32_t>(), true);
 		for (int i = 0; i < request.txset().txs_size() && enabled_; i++) {
 			const protocol::TransactionEnv &txproto = request.txset().txs(i);
 
-			TransactionFrm::pointer tx_frm = std::make_shared<TransactionFrm>(txproto);
+			ParallelExecutor::Speculation speculation;
+			bool adopted = executor != NULL && executor->Adopt(i, environment_, total_fee_, speculation);
+			TransactionFrm::pointer tx_frm = adopted ? speculation.tx_ : std::make_shared<TransactionFrm>(txproto);
+			bool ret = speculation.ret_;
+			bool expire = speculation.expire_;
+			std::string error_info = speculation.error_info_;
+			if (!adopted) {
+				if (!tx_frm->ValidForApply(environment_, !IsTestMode())) {
+					dropped_tx_frms_.push_back(tx_frm);
+					proposed_result.need_dropped_tx_.insert(i); //for drop
+					continue;
+				}
 
-			if (!tx_frm->ValidForApply(environment_, !IsTestMode())) {
-				dropped_tx_frms_.push_back(tx_frm);
-				proposed_result.need_dropped_tx_.insert(i); //for drop
-				continue;
-			}
+				//pay fee
+				if (!tx_frm->PayFee(environment_, total_fee_)) {
+					dropped_tx_frms_.push_back(tx_frm);
+					proposed_result.need_dropped_tx_.insert(i);//for drop
+					continue;
+				}
 
-			//pay fee
-			if (!tx_frm->PayFee(environment_, total_fee_)) {
-				dropped_tx_frms_.push_back(tx_frm);
-				proposed_result.need_dropped_tx_.insert(i);//for drop
-				continue;
-			}
+				ledger_context->transaction_stack_.push_back(tx_frm);
+				tx_frm->NonceIncrease(this, environment_);
+				if (environment_->useAtomMap_) environment_->Commit();
 
-			ledger_context->transaction_stack_.push_back(tx_frm);
-			tx_frm->NonceIncrease(this, environment_);
-			if (environment_->useAtomMap_) environment_->Commit();
+				tx_frm->EnableChecked();
+				tx_frm->SetMaxEndTime(utils::Timestamp::HighResolution() + General::TX_EXECUTE_TIME_OUT);
+
+				ret = tx_frm->Apply(this, environment_);
+				expire = tx_frm->IsExpire(error_info);
+			}
 
-			tx_frm->EnableChecked();
-			tx_frm->SetMaxEndTime(utils::Timestamp::HighResolution() + General::TX_EXECUTE_TIME_OUT);
-			
-			bool ret = tx_frm->Apply(this, environment_);
 			//caculate byte fee ,do not store when fee not enough 
-			std::string error_info;
-			if (tx_frm->IsExpire(error_info)) {
+			if (expire) {
 				LOG_ERROR("transaction(%s) apply failed. %s, %s",
 					utils::String::BinToHexString(tx_frm->GetContentHash()).c_str(), tx_frm->GetResult().desc().c_str(),
 					error_info.c_str());
@@ -275,7 +289,7 @@ namespace phantom {
 						utils::String::BinToHexString(tx_frm->GetContentHash()).c_str(), tx_frm->GetResult().desc().c_str());
 					error_txs.insert(i - proposed_result.need_dropped_tx_.size());//for check
 				}
-				else {
+				else if (!adopted) {
 					tx_frm->ReturnFee(total_fee_);
 					tx_frm->environment_->Commit();
 				}
@@ -284,7 +298,7 @@ namespace phantom {
 			environment_->ClearChangeBuf();
 			apply_tx_frms_.push_back(tx_frm);
 			ledger_.add_transaction_envs()->CopyFrom(txproto);
-			ledger_context->transaction_stack_.pop_back();
+			if (!adopted) ledger_context->transaction_stack_.pop_back();
 
 			if ( utils::Timestamp::HighResolution() - start_time > General::BLOCK_EXECUTE_TIME_OUT) {
 				LOG_ERROR("Block apply time timeout(" FMT_I64 ") ", utils::Timestamp::HighResolution() - start_time);
@@ -319,33 +333,41 @@ namespace phantom {
 			return false;
 		}
 
+		std::shared_ptr<ParallelExecutor> executor = CreateExecutor(std::set<int32_t>(), true);
 		for (int i = 0; i < request.txset().txs_size() && enabled_; i++) {
 			auto txproto = request.txset().txs(i);
 
-			TransactionFrm::pointer tx_frm = std::make_shared<TransactionFrm>(txproto);
+			ParallelExecutor::Speculation speculation;
+			bool adopted = executor != NULL && executor->Adopt(i, environment_, total_fee_, speculation);
+			TransactionFrm::pointer tx_frm = adopted ? speculation.tx_ : std::make_shared<TransactionFrm>(txproto);
+			bool ret = speculation.ret_;
+			bool expire = speculation.expire_;
+			std::string error_info = speculation.error_info_;
+			if (!adopted) {
+				if (!tx_frm->ValidForApply(environment_, !IsTestMode())) {
+					LOG_ERROR("Check consensus value failed, valid for apply failed, seq(" FMT_I64 ")", request.ledger_seq());
+					return false;
+				}
 
-			if (!tx_frm->ValidForApply(environment_, !IsTestMode())) {
-				LOG_ERROR("Check consensus value failed, valid for apply failed, seq(" FMT_I64 ")", request.ledger_seq());
-				return false;
-			}
+				//pay fee
+				if (!tx_frm->PayFee(environment_, total_fee_)) {
+					LOG_ERROR("Check consensus value failed, pay fee failed, seq(" FMT_I64 ")", request.ledger_seq());
+					return false;
+				}
 
-			//pay fee
-			if (!tx_frm->PayFee(environment_, total_fee_)) {
-				LOG_ERROR("Check consensus value failed, pay fee failed, seq(" FMT_I64 ")", request.ledger_seq());
-				return false;
-			}
+				ledger_context->transaction_stack_.push_back(tx_frm);
+				tx_frm->NonceIncrease(this, environment_);
+				if (environment_->useAtomMap_) environment_->Commit();
 
-			ledger_context->transaction_stack_.push_back(tx_frm);
-			tx_frm->NonceIncrease(this, environment_);
-			if (environment_->useAtomMap_) environment_->Commit();
+				tx_frm->EnableChecked();
+				tx_frm->SetMaxEndTime(utils::Timestamp::HighResolution() + General::TX_EXECUTE_TIME_OUT);
 
-			tx_frm->EnableChecked();
-			tx_frm->SetMaxEndTime(utils::Timestamp::HighResolution() + General::TX_EXECUTE_TIME_OUT);
+				ret = tx_frm->Apply(this, environment_);
+				expire = tx_frm->IsExpire(error_info);
+			}
 
-			bool ret = tx_frm->Apply(this, environment_);
 			//caculate byte fee ,do not store when fee not enough 
-			std::string error_info;
-			if (tx_frm->IsExpire(error_info)) {
+			if (expire) {
 				LOG_ERROR("transaction(%s) apply failed. %s, %s",
 					utils::String::BinToHexString(tx_frm->GetContentHash()).c_str(), tx_frm->GetResult().desc().c_str(),
 					error_info.c_str());
@@ -357,7 +379,7 @@ namespace phantom {
 						utils::String::BinToHexString(tx_frm->GetContentHash()).c_str(), tx_frm->GetResult().desc().c_str());
 					error_txs.insert(i);//for check
 				}
-				else {
+				else if (!adopted) {
 					tx_frm->ReturnFee(total_fee_);
 					tx_frm->environment_->Commit();
 				}
@@ -366,7 +388,7 @@ namespace phantom {
 			environment_->ClearChangeBuf();
 			apply_tx_frms_.push_back(tx_frm);
 			ledger_.add_transaction_envs()->CopyFrom(txproto);
-			ledger_context->transaction_stack_.pop_back();
+			if (!adopted) ledger_context->transaction_stack_.pop_back();
 
 			if (utils::Timestamp::HighResolution() - start_time > General::BLOCK_EXECUTE_TIME_OUT) {
 				LOG_ERROR("Block apply time timeout(" FMT_I64 ") ", utils::Timestamp::HighResolution() - start_time);
@@ -404,9 +426,24 @@ namespace phantom {
 			return false;
 		}
 
+		//the expired ones follow the consensus value without apply, they stay in order
+		std::shared_ptr<ParallelExecutor> executor = CreateExecutor(expire_txs_check, false);
 		for (int i = 0; i < request.txset().txs_size() && enabled_; i++) {
 			auto txproto = request.txset().txs(i);
-			
+
+			ParallelExecutor::Speculation speculation;
+			if (executor != NULL && executor->Adopt(i, environment_, total_fee_, speculation)) {
+				TransactionFrm::pointer tx_frm = speculation.tx_;
+				if (!speculation.ret_) {
+					LOG_ERROR("transaction(%s) apply failed. %s",
+						utils::String::BinToHexString(tx_frm->GetContentHash()).c_str(), tx_frm->GetResult().desc().c_str());
+					error_txs.insert(i);//for check
+				}
+				apply_tx_frms_.push_back(tx_frm);
+				ledger_.add_transaction_envs()->CopyFrom(txproto);
+				continue;
+			}
+
 			TransactionFrm::pointer tx_frm = std::make_shared<TransactionFrm>(txproto);
 
 			if (!tx_frm->ValidForApply(environment_,!IsTestMode())){
@@ -466,6 +503,17 @@ namespace phantom {
 		//check
 	}
 
+	std::shared_ptr<ParallelExecutor> LedgerFrm::CreateExecutor(const std::set<int32_t> &skip, bool check_expire) {
+		utils::ThreadPool *pool = LedgerManager::Instance().GetExecutePool();
+		if (pool == NULL || IsTestMode() || value_->txset().txs_size() < 2) {
+			return NULL;
+		}
+
+		std::shared_ptr<ParallelExecutor> executor = std::make_shared<ParallelExecutor>(this);
+		executor->Speculate(pool, *value_, skip, check_expire);
+		return executor;
+	}
+
 	bool LedgerFrm::CheckValidation() {
 		return true;
 	}
@@ -481,9 +529,12 @@ namespace phantom {
 	bool LedgerFrm::Commit(KVTrie* trie, int64_t& new_count, int64_t& change_count) {
 		auto batch = trie->batch_;
 
+		//collect the accounts first, the tree takes them in one sorted walk
+		std::vector<Trie::KeyValue> items;
 		if (environment_->useAtomMap_)
 		{
 			auto entries = environment_->GetData();
+			items.reserve(entries.size());
 
 			for (auto it = entries.begin(); it != entries.end(); it++){
 
@@ -492,32 +543,25 @@ namespace phantom {
 
 				std::shared_ptr<AccountFrm> account = it->second.value_;
 				account->UpdateHash(batch);
-				std::string ss = account->Serializer();
-				std::string index = DecodeAddress(it->first);
-				bool is_new = trie->Set(index, ss);
-				if (is_new){
-					new_count++;
-				}
-				else{
-					change_count++;
-				}
+				items.push_back(Trie::KeyValue(DecodeAddress(it->first), account->Serializer()));
 			}
-			return true;
 		}
-
-		for (auto it = environment_->entries_.begin(); it != environment_->entries_.end(); it++){
-			std::shared_ptr<AccountFrm> account = it->second;
-			account->UpdateHash(batch);
-			std::string ss = account->Serializer();
-			std::string index = DecodeAddress(it->first);
-			bool is_new = trie->Set(index, ss);
-			if (is_new){
-				new_count++;
-			}
-			else{
-				change_count++;
+		else {
+			items.reserve(environment_->entries_.size());
+			for (auto it = environment_->entries_.begin(); it != environment_->entries_.end(); it++){
+				std::shared_ptr<AccountFrm> account = it->second;
+				account->UpdateHash(batch);
+				items.push_back(Trie::KeyValue(DecodeAddress(it->first), account->Serializer()));
 			}
 		}
+
+		for (size_t i = 0; i < items.size(); i++){
+			batch->Put(ComposePrefix(General::ACCOUNT_INDEX_PREFIX, items[i].first), items[i].second);
+		}
+
+		size_t count = trie->SetBatch(items);
+		new_count += count;
+		change_count += items.size() - count;
 		return true;
 	}
 
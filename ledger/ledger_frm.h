@@ -40,6 +40,7 @@ namespace phantom {
 
 	class AccountEntry;
 	class LedgerContext;
+	class ParallelExecutor;
 	class LedgerFrm {
 	public:
 		typedef std::shared_ptr <LedgerFrm>	pointer;
@@ -75,6 +76,8 @@ namespace phantom {
 		// void GetSqlTx(std::string &sqltx, std::string &sql_account_tx);
 
 		bool AddToDb(WRITE_BATCH& batch);
+		//put the ledger and its transactions into batch without writing it
+		void AddToBatch(WRITE_BATCH& batch);
 
 		bool LoadFromDb(int64_t seq);
 
@@ -111,6 +114,9 @@ namespace phantom {
 		bool IsTestMode();
 
 	private:
+		//speculate the txset on the execute pool, null when parallel execution is off
+		std::shared_ptr<ParallelExecutor> CreateExecutor(const std::set<int32_t> &skip, bool check_expire);
+
 		protocol::Ledger ledger_;
 		bool is_test_mode_;
 	public:
@@ -20,12 +20,16 @@
 #include "ledger_manager.h"
 #include "contract_manager.h"
 #include "fee_compulate.h"
+#include "signature_cache.h"
+#include "parallel_executor.h"
 
 namespace phantom {
-	LedgerManager::LedgerManager() : tree_(NULL) {
+	LedgerManager::LedgerManager() : tree_(NULL), hash_pool_(NULL), execute_pool_(NULL) {
 		check_interval_ = 500 * utils::MICRO_UNITS_PER_MILLI;
 		timer_name_ = "Ledger Mananger";
 		chain_max_ledger_probaly_ = 0;
+		sub_trie_open_mark_ = sub_trie_avoided_mark_ = 0;
+		sub_trie_open_ledger_ = sub_trie_avoided_ledger_ = 0;
 	}
 
 	LedgerManager::~LedgerManager() {
@@ -33,6 +37,15 @@ namespace phantom {
 			delete tree_;
 			tree_ = NULL;
 		}
+
+		if (hash_pool_) {
+			delete hash_pool_;
+			hash_pool_ = NULL;
+		}
+		if (execute_pool_) {
+			delete execute_pool_;
+			execute_pool_ = NULL;
+		}
 	}
 
 	bool LedgerManager::GetValidators(int64_t seq, protocol::ValidatorSet& validators_set) {
@@ -53,23 +66,85 @@ namespace phantom {
 
 	bool LedgerManager::Initialize() {
 		HashWrapper::SetLedgerHashType(Configure::Instance().ledger_configure_.hash_type_);
+		SignatureCache::Instance().Initialize(Configure::Instance().ledger_configure_.signature_cache_size_);
 
 		tree_ = new KVTrie();
+		uint32_t trie_cache_size = Configure::Instance().ledger_configure_.trie_cache_size_;
+		if (trie_cache_size > 0) {
+			node_cache_ = std::make_shared<NodeCache>((size_t)trie_cache_size * utils::BYTES_PER_MEGA);
+			tree_->SetNodeCache(node_cache_);
+		}
+		//before anything reads the dbs, they are wrapped to see the ledgers being written
+		const LedgerConfigure &ledger_config = Configure::Instance().ledger_configure_;
+		if (!persister_.Initialize(ledger_config.persist_pipeline_, ledger_config.catch_up_group_size_, ledger_config.catch_up_unsynced_,
+			[this](int64_t seq) { PublishLedgerView(seq); })) {
+			LOG_ERROR("Init ledger persistence failed");
+			return false;
+		}
+
 		auto batch = std::make_shared<WRITE_BATCH>();
 		tree_->Init(Storage::Instance().account_db(), batch, General::ACCOUNT_PREFIX, 4);
 
+		uint32_t hash_thread_count = Configure::Instance().ledger_configure_.hash_thread_count_;
+		if (hash_thread_count > 1) {
+			hash_pool_ = new utils::ThreadPool();
+			if (!hash_pool_->Init("hash", hash_thread_count)) {
+				LOG_ERROR("Init hash thread pool failed");
+				return false;
+			}
+			LOG_INFO("Account tree hash thread count:%u", hash_thread_count);
+		}
+
+		uint32_t execute_thread_count = Configure::Instance().ledger_configure_.execute_thread_count_;
+		if (execute_thread_count > 1) {
+			if (!Configure::Instance().ledger_configure_.use_atom_map_) {
+				LOG_WARN("Parallel transaction execution needs use_atom_map, transactions are executed serially");
+			}
+			else {
+				execute_pool_ = new utils::ThreadPool();
+				if (!execute_pool_->Init("execute", execute_thread_count)) {
+					LOG_ERROR("Init execute thread pool failed");
+					return false;
+				}
+				LOG_INFO("Transaction execute thread count:%u", execute_thread_count);
+			}
+		}
+
+		if (!sync_.Initialize(Configure::Instance().ledger_configure_.sync_verify_thread_count_)) {
+			return false;
+		}
+
 		context_manager_.Initialize();
 
 		auto kvdb = Storage::Instance().account_db();
+		std::string str_install;
+		if (kvdb->Get(General::KEY_STATE_SYNC_INSTALL, str_install) > 0) {
+			Json::Value install;
+			LOG_INFO("Finish the state sync install stopped by the last exit");
+			if (!install.fromString(str_install) || !WriteAccountState(install)) {
+				LOG_ERROR("Finish the state sync install failed");
+				return false;
+			}
+		}
+
 		std::string str_max_seq;
 		int64_t seq_kvdb = 0;
 		if (kvdb->Get(General::KEY_LEDGER_SEQ, str_max_seq)) {
 			seq_kvdb = utils::String::Stoi64(str_max_seq);
 			int64_t seq_rational = GetMaxLedger();
-			if (seq_kvdb != seq_rational) {
+			if (seq_kvdb > seq_rational) {
 				LOG_ERROR("fatal error:ledger_seq from kvdb(" FMT_I64 ") != ledger_seq from rational db(" FMT_I64 ")",
 					seq_kvdb, seq_rational);
 			}
+			//a ledger is synced to the ledger db before the account db, a crash between them leaves
+			//ledgers the accounts do not have. Go back to the last one of both, the rest is replayed
+			else if (seq_kvdb < seq_rational) {
+				LOG_WARN("Ledger db goes back from ledger(" FMT_I64 ") to ledger(" FMT_I64 ") of the account db", seq_rational, seq_kvdb);
+				if (!RollbackLedgers(Storage::Instance().ledger_db(), seq_kvdb, seq_rational)) {
+					return false;
+				}
+				seq_rational = seq_kvdb;
+			}
 
 			LOG_INFO("max closed ledger seq=" FMT_I64, seq_rational);
 			last_closed_ledger_ = std::make_shared<LedgerFrm>();
@@ -85,10 +160,24 @@ namespace phantom {
 			seq_kvdb = 1;
 		}
 
+		//databases created before the flat account index need it built once
+		std::string str_index;
+		if (kvdb->Get(General::KEY_ACCOUNT_INDEX, str_index) <= 0) {
+			LOG_INFO("Account index not exist, build it from the account tree");
+			if (CheckAccountIndex(true) < 0) {
+				LOG_ERROR("Build account index failed");
+				return false;
+			}
+		}
+
 		std::string str;
 		if (kvdb->Get(General::STATISTICS, str)) {
 			statistics_.fromString(str);
 		}
+		//everything loaded is on disk
+		AddLedgerView(last_closed_ledger_->GetProtoHeader());
+		PublishLedgerView(last_closed_ledger_->GetProtoHeader().seq());
+
 		//avoid dead lock
 		utils::WriteLockGuard guard(lcl_header_mutex_);
 		lcl_header_ = last_closed_ledger_->GetProtoHeader();
@@ -100,6 +189,8 @@ namespace phantom {
 			LOG_ERROR("Get validators failed!");
 			return false;
 		}
+		sync_.SetValidators(validators_, HashWrapper::Crypto(validators_.SerializeAsString()));
+		sync_.SetNext(lclheader.seq() + 1);
 
 		//fee
 		std::string fees_hash = lclheader.fees_hash();
@@ -138,10 +229,32 @@ namespace phantom {
 	bool LedgerManager::Exit() {
 		LOG_INFO("Ledger manager stoping...");
 
+		sync_.Exit();
+
+		//the last closed ledger must be on disk before the dbs are closed
+		persister_.Exit();
+
+		do {
+			utils::MutexGuard guard(views_mutex_);
+			unwritten_views_.clear();
+			std::atomic_store(&view_, LedgerView::pointer());
+		} while (false);
+
 		if (tree_) {
 			delete tree_;
 			tree_ = NULL;
 		}
+
+		if (hash_pool_) {
+			hash_pool_->Exit();
+			delete hash_pool_;
+			hash_pool_ = NULL;
+		}
+		if (execute_pool_) {
+			execute_pool_->Exit();
+			delete execute_pool_;
+			execute_pool_ = NULL;
+		}
 		LOG_INFO("Ledger manager stop [OK]");
 		return true;
 	}
@@ -152,67 +265,82 @@ namespace phantom {
 	}
 
 	void LedgerManager::OnTimer(int64_t current_time) {
-		int64_t next_seq = 0;
 		std::set<int64_t> active_peers = PeerManager::Instance().ConsensusNetwork().GetActivePeerIds();
-		std::set<int64_t> enable_peers;
-		protocol::GetLedgers gl;
+		std::vector<LedgerFetch::Request> requests;
+		state_sync_.OnTimer(current_time);
 
 		do {
 			utils::MutexGuard guard(gmutex_);
-			if (current_time - sync_.update_time_ <= 30 * 1000000) {
-				return;
+			//catch-up stalled, do not keep the replayed ledgers in memory only
+			int64_t group_begin_time = persister_.group_begin_time();
+			if (group_begin_time > 0 && current_time - group_begin_time > 5 * utils::MICRO_UNITS_PER_SEC) {
+				persister_.FlushGroup();
 			}
 
-			for (auto it = sync_.peers_.begin(); it != sync_.peers_.end();) {
-				int64_t pid = it->first;
-				if (active_peers.find(pid) == active_peers.end()) {
-					it = sync_.peers_.erase(it);
-				}
-				else {
-					it++;
-				}
+			//replay waits for the account state being fetched
+			if (state_sync_.active()) {
+				return;
 			}
+		} while (false);
 
-			next_seq = last_closed_ledger_->GetProtoHeader().seq() + 1;
+		sync_.OnTimer(current_time, active_peers, requests);
+		LedgerFetch::Send(requests);
+	}
 
-			sync_.update_time_ = current_time;
-			LOG_INFO("OnTimer. request max ledger seq from neighbours. BEGIN");
+	void LedgerManager::OnSlowTimer(int64_t current_time) {
 
-			gl.set_begin(next_seq);
-			gl.set_end(next_seq);
-			gl.set_timestamp(current_time);
+	}
 
-			for (std::set<int64_t>::iterator it = active_peers.begin(); it != active_peers.end(); it++) {
-				int64_t pid = *it;
-				auto iter = sync_.peers_.find(pid);
-				if (iter != sync_.peers_.end()) {
-					SyncStat& st = iter->second;
-					if (current_time - st.send_time_ > 30 * utils::MICRO_UNITS_PER_SEC) {
-						st.send_time_ = 0;
-					}
-					if (st.probation_ > current_time) {
-						continue;
-					}
-					if (st.send_time_ != 0) {
-						continue;
-					}
-				}
-				enable_peers.insert(pid);
+	protocol::LedgerHeader LedgerManager::GetLastClosedLedger() {
+		utils::ReadLockGuard guard(lcl_header_mutex_);
+		return lcl_header_;
+	}
+
+	LedgerView::pointer LedgerManager::GetLedgerView() {
+		return std::atomic_load(&view_);
+	}
+
+	void LedgerManager::AddLedgerView(const protocol::LedgerHeader &header) {
+		utils::MutexGuard guard(views_mutex_);
+		unwritten_views_[header.seq()] = std::make_shared<LedgerView>(header, statistics_["account_count"].asInt64());
+	}
+
+	void LedgerManager::PublishLedgerView(int64_t seq) {
+		std::shared_ptr<LedgerView> view;
+		do {
+			utils::MutexGuard guard(views_mutex_);
+			auto iter = unwritten_views_.upper_bound(seq);
+			if (iter == unwritten_views_.begin()) {
+				return;
 			}
-			LOG_INFO("OnTimer. request max ledger seq from neighbours. END");
+			view = std::prev(iter)->second;
+			unwritten_views_.erase(unwritten_views_.begin(), iter);
 		} while (false);
 
-		for (auto it = enable_peers.begin(); it != enable_peers.end(); it++)
-			RequestConsensusValues(*it, gl, current_time);
+		//the previous view goes with its last query
+		view->Pin();
+		std::atomic_store(&view_, LedgerView::pointer(view));
+		state_sync_.OnLedgerView(view);
 	}
 
-	void LedgerManager::OnSlowTimer(int64_t current_time) {
+	LedgerView::LedgerView(const protocol::LedgerHeader &header, int64_t account_count) :
+		header_(header), account_count_(account_count), ledger_db_(NULL), account_db_(NULL),
+		ledger_snapshot_(NULL), account_snapshot_(NULL) {}
 
+	LedgerView::~LedgerView() {
+		if (ledger_snapshot_ != NULL) {
+			ledger_db_->ReleaseSnapshot(ledger_snapshot_);
+		}
+		if (account_snapshot_ != NULL) {
+			account_db_->ReleaseSnapshot(account_snapshot_);
+		}
 	}
 
-	protocol::LedgerHeader LedgerManager::GetLastClosedLedger() {
-		utils::ReadLockGuard guard(lcl_header_mutex_);
-		return lcl_header_;
+	void LedgerView::Pin() {
+		ledger_db_ = Storage::Instance().ledger_db();
+		account_db_ = Storage::Instance().account_db();
+		ledger_snapshot_ = ledger_db_->GetSnapshot();
+		account_snapshot_ = account_db_->GetSnapshot();
 	}
 
 	void LedgerManager::ValidatorsSet(std::shared_ptr<WRITE_BATCH> batch, const protocol::ValidatorSet& validators) {
@@ -254,6 +382,7 @@ namespace phantom {
 		//create account of genesis
 		AccountFrm::pointer acc_frm =AccountFrm::CreatAccountFrm(Configure::Instance().genesis_configure_.account_, 100000000000000000);
 		tree_->Set(DecodeAddress(acc_frm->GetAccountAddress()), acc_frm->Serializer());
+		tree_->batch_->Put(ComposePrefix(General::ACCOUNT_INDEX_PREFIX, DecodeAddress(acc_frm->GetAccountAddress())), acc_frm->Serializer());
 		account_count++;
 
 		//load validators config,create account of validators
@@ -265,6 +394,7 @@ namespace phantom {
 
 			AccountFrm::pointer acc_frm = AccountFrm::CreatAccountFrm(*iter, 0);
 			tree_->Set(DecodeAddress(acc_frm->GetAccountAddress()), acc_frm->Serializer());
+			tree_->batch_->Put(ComposePrefix(General::ACCOUNT_INDEX_PREFIX, DecodeAddress(acc_frm->GetAccountAddress())), acc_frm->Serializer());
 			account_count++;
 		}
 		statistics_["account_count"] = account_count;
@@ -303,6 +433,7 @@ namespace phantom {
 		auto batch = tree_->batch_;
 		batch->Put(phantom::General::KEY_LEDGER_SEQ, "1");
 		batch->Put(phantom::General::KEY_GENE_ACCOUNT, Configure::Instance().genesis_configure_.account_);
+		batch->Put(phantom::General::KEY_ACCOUNT_INDEX, "1");
 		ValidatorsSet(batch, validators_);
 		FeesConfigSet(batch, fees_);
 
@@ -312,7 +443,7 @@ namespace phantom {
 		}
 
 		batch->Put(General::STATISTICS, statistics_.toFastString());
-		if (!Storage::Instance().account_db()->WriteBatch(*batch)) {
+		if (!Storage::Instance().account_db()->WriteBatch(*batch, DURABILITY_SYNC)) {
 			PROCESS_EXIT("Write account batch failed, %s", Storage::Instance().account_db()->error_desc().c_str());
 		}
 
@@ -407,7 +538,7 @@ namespace phantom {
 
 			//write account db
 			auto batch_account = LedgerManager::GetInstance()->tree_->batch_;
-			if (!Storage::Instance().account_db()->WriteBatch(*batch_account)) {
+			if (!Storage::Instance().account_db()->WriteBatch(*batch_account, DURABILITY_SYNC)) {
 				PROCESS_EXIT("Write account batch failed, %s", Storage::Instance().account_db()->error_desc().c_str());
 			}
 
@@ -424,12 +555,12 @@ namespace phantom {
 			batch_ledger.Put(phantom::General::KEY_LEDGER_SEQ, utils::String::ToString(header->seq()));
 			batch_ledger.Put(ComposePrefix(General::LEDGER_PREFIX, header->seq()), header->SerializeAsString());
 			batch_ledger.Put(ComposePrefix(General::CONSENSUS_VALUE_PREFIX, header->seq()), request.SerializeAsString());
-			if (!ledger_db->WriteBatch(batch_ledger)) {
+			if (!ledger_db->WriteBatch(batch_ledger, DURABILITY_SYNC)) {
 				PROCESS_EXIT("Write ledger and transaction failed(%s)", ledger_db->error_desc().c_str());
 			}
 
 			//write acount db
-			if (!Storage::Instance().account_db()->WriteBatch(*batch)) {
+			if (!Storage::Instance().account_db()->WriteBatch(*batch, DURABILITY_SYNC)) {
 				PROCESS_EXIT("Write account batch failed, %s", Storage::Instance().account_db()->error_desc().c_str());
 			}
 
@@ -441,6 +572,78 @@ namespace phantom {
 	}
 
 
+	int64_t LedgerManager::CheckAccountIndex(bool repair) {
+		KeyValueDb *account_db = Storage::Instance().account_db();
+		int64_t account_count = 0, mismatch_count = 0, stale_count = 0;
+		size_t pending = 0;
+		bool db_error = false;
+		WRITE_BATCH batch;
+
+		//every account in the tree must have an identical index entry
+		tree_->ForEach([&](const std::string &value) {
+			protocol::Account account;
+			if (db_error || !account.ParseFromString(value)) {
+				return;
+			}
+			account_count++;
+
+			std::string key = ComposePrefix(General::ACCOUNT_INDEX_PREFIX, DecodeAddress(account.address()));
+			std::string index_value;
+			int32_t ret = account_db->Get(key, index_value);
+			if (ret < 0) {
+				db_error = true;
+				return;
+			}
+
+			if (ret == 0 || index_value != value) {
+				mismatch_count++;
+				LOG_TRACE("Account index of %s mismatch", account.address().c_str());
+				if (repair) {
+					batch.Put(key, value);
+					pending++;
+				}
+			}
+
+			if (pending >= 10000) {
+				db_error = !account_db->WriteBatch(batch);
+				batch.Clear();
+				pending = 0;
+			}
+		});
+
+		if (db_error) {
+			LOG_ERROR("Check account index failed, %s", account_db->error_desc().c_str());
+			return -1;
+		}
+
+		//index entries of accounts which are not in the tree any more
+		std::string prefix = ComposePrefix(General::ACCOUNT_INDEX_PREFIX, "");
+		ReadRange range = ReadRange::Prefix(prefix);
+		range.fill_cache_ = false;
+		KeyValueIterator *it = account_db->NewIterator(range);
+		for (it->SeekToFirst(); it->Valid(); it->Next()) {
+			std::string index = it->key().ToString().substr(prefix.size());
+			std::string value;
+			if (!tree_->Get(index, value)) {
+				stale_count++;
+				if (repair) batch.Delete(it->key());
+			}
+		}
+		delete it;
+
+		if (repair) {
+			batch.Put(General::KEY_ACCOUNT_INDEX, "1");
+			if (!account_db->WriteBatch(batch)) {
+				LOG_ERROR("Write account index failed, %s", account_db->error_desc().c_str());
+				return -1;
+			}
+		}
+
+		LOG_INFO("Check account index: account(" FMT_I64 ") mismatch(" FMT_I64 ") stale(" FMT_I64 ")%s",
+			account_count, mismatch_count, stale_count, repair ? ", repaired" : "");
+		return mismatch_count + stale_count;
+	}
+
 	bool LedgerManager::ConsensusValueFromDB(int64_t seq, protocol::ConsensusValue& consensus_value) {
 		KeyValueDb *ledger_db = Storage::Instance().ledger_db();
 		std::string str_cons;
@@ -451,6 +654,31 @@ namespace phantom {
 		return consensus_value.ParseFromString(str_cons);
 	}
 
+	bool LedgerManager::ConsensusValuesFromDB(int64_t begin, int64_t end, std::vector<protocol::ConsensusValue> &values) {
+		KeyValueDb *ledger_db = Storage::Instance().ledger_db();
+		std::vector<std::string> keys;
+		for (int64_t seq = begin; seq <= end; seq++) {
+			keys.push_back(ComposePrefix(General::CONSENSUS_VALUE_PREFIX, seq));
+		}
+
+		values.clear();
+		std::vector<std::string> str_cons;
+		std::vector<int32_t> statuses;
+		if (!ledger_db->MultiGet(keys, str_cons, statuses)) {
+			LOG_ERROR("Get consensus values [" FMT_I64 "," FMT_I64 "] failed, %s", begin, end, ledger_db->error_desc().c_str());
+			return false;
+		}
+
+		for (size_t i = 0; i < keys.size(); i++) {
+			protocol::ConsensusValue value;
+			if (statuses[i] <= 0 || !value.ParseFromString(str_cons[i])) {
+				return false;
+			}
+			values.push_back(value);
+		}
+		return true;
+	}
+
 	protocol::FeeConfig LedgerManager::GetCurFeeConfig() {
 		utils::ReadLockGuard guard(fee_config_mutex_);
 		return fees_;
@@ -459,6 +687,8 @@ namespace phantom {
 	int LedgerManager::OnConsent(const protocol::ConsensusValue &consensus_value, const std::string& proof) {
 		LOG_INFO("OnConsent Ledger consensus_value seq(" FMT_I64 ")", consensus_value.ledger_seq());
 
+		//the parent is durable before the value agreed on it is committed
+		persister_.Wait();
 		utils::MutexGuard guard(gmutex_);
 		if (last_closed_ledger_->GetProtoHeader().seq() >= consensus_value.ledger_seq()) {
 			LOG_ERROR("received duplicated consensus, max closed ledger seq(" FMT_I64 ")>= received request(" FMT_I64 ")",
@@ -468,12 +698,17 @@ namespace phantom {
 		}
 
 		if (last_closed_ledger_->GetProtoHeader().seq() + 1 == consensus_value.ledger_seq()) {
-			sync_.update_time_ = utils::Timestamp::HighResolution();
-			CloseLedger(consensus_value, proof);
+			sync_.Touch(utils::Timestamp::HighResolution());
+			CloseLedger(consensus_value, proof, false);
+			sync_.SetNext(last_closed_ledger_->GetProtoHeader().seq() + 1);
 		}
 		return 0;
 	}
 
+	void LedgerManager::WaitPersisted() {
+		persister_.Wait();
+	}
+
 	int64_t LedgerManager::GetMaxLedger() {
 		KeyValueDb *ledger_db = Storage::Instance().ledger_db();
 		std::string str_value;
@@ -488,25 +723,215 @@ namespace phantom {
 		return utils::String::Stoi64(str_value);
 	}
 
+	bool LedgerManager::RollbackLedgers(KeyValueDb *ledger_db, int64_t seq, int64_t max_seq) {
+		WRITE_BATCH batch;
+		for (int64_t i = seq + 1; i <= max_seq; i++) {
+			std::string str_list;
+			protocol::EntryList list;
+			int32_t ret = ledger_db->Get(ComposePrefix(General::LEDGER_TRANSACTION_PREFIX, i), str_list);
+			if (ret < 0 || (ret > 0 && !list.ParseFromString(str_list))) {
+				LOG_ERROR("Read transactions of ledger(" FMT_I64 ") failed(%s)", i, ledger_db->error_desc().c_str());
+				return false;
+			}
+
+			for (int32_t j = 0; j < list.entry_size(); j++) {
+				batch.Delete(ComposePrefix(General::TRANSACTION_PREFIX, list.entry(j)));
+			}
+			batch.Delete(ComposePrefix(General::LEDGER_PREFIX, i));
+			batch.Delete(ComposePrefix(General::CONSENSUS_VALUE_PREFIX, i));
+			batch.Delete(ComposePrefix(General::LEDGER_TRANSACTION_PREFIX, i));
+		}
+
+		//the last tx hashes as closing seq left them, newest first, from the lists still in the ledger db
+		protocol::EntryList last_hashs;
+		for (int64_t i = seq; i > 0 && last_hashs.entry_size() < General::LAST_TX_HASHS_LIMIT; i--) {
+			std::string str_list;
+			protocol::EntryList list;
+			int32_t ret = ledger_db->Get(ComposePrefix(General::LEDGER_TRANSACTION_PREFIX, i), str_list);
+			if (ret < 0 || (ret > 0 && !list.ParseFromString(str_list))) {
+				LOG_ERROR("Read transactions of ledger(" FMT_I64 ") failed(%s)", i, ledger_db->error_desc().c_str());
+				return false;
+			}
+			else if (ret == 0) {
+				break;
+			}
+
+			for (int32_t j = list.entry_size() - 1; j >= 0 && last_hashs.entry_size() < General::LAST_TX_HASHS_LIMIT; j--) {
+				*last_hashs.add_entry() = list.entry(j);
+			}
+		}
+
+		if (last_hashs.entry_size() > 0) {
+			batch.Put(General::LAST_TX_HASHS, last_hashs.SerializeAsString());
+		}
+		else {
+			batch.Delete(General::LAST_TX_HASHS);
+		}
+		batch.Put(General::KEY_LEDGER_SEQ, utils::String::ToString(seq));
+		if (!ledger_db->WriteBatch(batch, DURABILITY_SYNC)) {
+			LOG_ERROR("Roll back the ledger db to ledger(" FMT_I64 ") failed(%s)", seq, ledger_db->error_desc().c_str());
+			return false;
+		}
+		return true;
+	}
+
+	void LedgerManager::BenchAccountRead(int64_t count) {
+		std::string path = utils::String::Format("%s/bench_account_read", utils::File::GetBinHome().c_str());
+		if (utils::File::IsExist(path) && !utils::File::DeleteFolder(path)) {
+			printf("delete %s failed\n", path.c_str());
+			return;
+		}
+		utils::File::CreateDir(path);
+		DbConfigure db_config;
+		db_config.keyvalue_db_path_ = path + "/keyvalue.db";
+		db_config.ledger_db_path_ = path + "/ledger.db";
+		db_config.account_db_path_ = path + "/account.db";
+		db_config.account_durability_ = "wal";
+		Storage &storage = Storage::Instance();
+		if (!storage.Initialize(db_config, false)) {
+			printf("open the dbs of the bench failed\n");
+			return;
+		}
+
+		//accounts are added like ledgers of 100000 accounts, the tree keeps the depth a closed ledger keeps
+		const int64_t ledger_accounts = 100000;
+		const int32_t reads = 10000;
+		KeyValueDb *account_db = storage.account_db();
+		KVTrie tree;
+		tree.Init(account_db, std::make_shared<WRITE_BATCH>(), General::ACCOUNT_PREFIX, 4);
+		auto key_of = [](int64_t i) {
+			return HashWrapper::Crypto(utils::String::ToString(i)).substr(0, 20);
+		};
+
+		Json::Value result = Json::Value(Json::objectValue);
+		Json::Value &rounds = result["rounds"];
+		srand(1);
+		int64_t next_round = std::min<int64_t>(ledger_accounts, count);
+		for (int64_t added = 0; added < count;) {
+			std::vector<Trie::KeyValue> items;
+			for (; added < count && (int64_t)items.size() < ledger_accounts; added++) {
+				protocol::Account account;
+				account.set_address(utils::String::Format("bench_account_" FMT_I64, added));
+				account.set_balance(added);
+				std::string key = key_of(added);
+				std::string value = account.SerializeAsString();
+				tree.batch_->Put(ComposePrefix(General::ACCOUNT_INDEX_PREFIX, key), value);
+				items.push_back(Trie::KeyValue(key, value));
+			}
+			tree.SetBatch(items);
+			tree.UpdateHash();
+			if (!account_db->WriteBatch(*tree.batch_)) {
+				printf("write accounts failed(%s)\n", account_db->error_desc().c_str());
+				return;
+			}
+			tree.batch_->Clear();
+			tree.FreeMemory(4);
+			if (added < next_round) {
+				continue;
+			}
+			next_round = std::min(next_round * 10, count);
+
+			std::vector<std::string> keys;
+			for (int32_t i = 0; i < reads; i++) {
+				keys.push_back(key_of(((int64_t)rand() * RAND_MAX + rand()) % added));
+			}
+
+			std::string value;
+			int64_t begin = utils::Timestamp::HighResolution();
+			for (size_t i = 0; i < keys.size(); i++) {
+				account_db->Get(ComposePrefix(General::ACCOUNT_INDEX_PREFIX, keys[i]), value);
+			}
+			int64_t index_time = utils::Timestamp::HighResolution() - begin;
+
+			//nodes below the kept depth are loaded by the walk, released again as after a close
+			begin = utils::Timestamp::HighResolution();
+			for (size_t i = 0; i < keys.size(); i++) {
+				tree.Get(keys[i], value);
+			}
+			int64_t tree_time = utils::Timestamp::HighResolution() - begin;
+			tree.FreeMemory(4);
+
+			Json::Value &round = rounds[rounds.size()];
+			round["accounts"] = (Json::Int64)added;
+			round["index_read_us"] = (double)index_time / keys.size();
+			round["tree_read_us"] = (double)tree_time / keys.size();
+		}
+		printf("%s\n", result.toStyledString().c_str());
+
+		storage.Exit();
+		utils::File::DeleteFolder(path);
+	}
+
 	void LedgerManager::GetModuleStatus(Json::Value &data) {
 		utils::MutexGuard guard(gmutex_);
 		int64_t begin_time = utils::Timestamp::HighResolution();
 		data["name"] = "ledger_manager";
 		data["tx_count"] = GetLastClosedLedger().tx_count();
-		data["account_count"] = GetAccountNum();
+		data["account_count"] = statistics_["account_count"].asInt64();
 		data["ledger_sequence"] = GetLastClosedLedger().seq();
 		data["time"] = utils::String::Format(FMT_I64 " ms",
 			(utils::Timestamp::HighResolution() - begin_time) / utils::MICRO_UNITS_PER_MILLI);
 		data["hash_type"] = HashWrapper::GetLedgerHashType() == HashWrapper::HASH_TYPE_SM3 ? "sm3" : "sha256";
 		data["sync"] = sync_.ToJson();
+
+		Json::Value &calc_hash = data["calc_hash"];
+		calc_hash["thread_count"] = hash_pool_ != NULL ? (Json::UInt)hash_pool_->Size() : 1;
+		if (tree_ != NULL) {
+			calc_hash["task_count"] = (Json::UInt64)tree_->hash_task_count_;
+			calc_hash["wall_time"] = tree_->hash_wall_time_;
+			calc_hash["work_time"] = tree_->hash_work_time_;
+			//hashing time of the workers per wall time, the average count of them busy, not a gain over serial
+			calc_hash["parallelism"] = utils::String::Format("%.2f",
+				tree_->hash_wall_time_ > 0 ? (double)tree_->hash_work_time_ / tree_->hash_wall_time_ : 1.0);
+		}
+		if (node_cache_ != nullptr) {
+			Json::Value &trie_cache = data["trie_cache"];
+			trie_cache["capacity"] = (Json::UInt64)node_cache_->capacity();
+			trie_cache["usage"] = (Json::UInt64)node_cache_->usage();
+			trie_cache["count"] = (Json::UInt64)node_cache_->size();
+			trie_cache["hit"] = node_cache_->hit_count();
+			trie_cache["miss"] = node_cache_->miss_count();
+			trie_cache["eviction"] = node_cache_->evict_count();
+		}
+		if (SignatureCache::GetInstance() != NULL) {
+			SignatureCache &cache = SignatureCache::Instance();
+			Json::Value &signature_cache = data["signature_cache"];
+			signature_cache["capacity"] = (Json::UInt64)cache.capacity();
+			signature_cache["count"] = (Json::UInt64)cache.size();
+			signature_cache["hit"] = (Json::Int64)cache.hit_count();
+			signature_cache["miss"] = (Json::Int64)cache.miss_count();
+			int64_t lookups = cache.hit_count() + cache.miss_count();
+			signature_cache["hit_rate"] = lookups > 0 ? (double)cache.hit_count() / lookups : 0.0;
+		}
+		Json::Value &execute = data["parallel_execute"];
+		int64_t speculated = ParallelExecutor::speculate_count_;
+		int64_t conflicted = ParallelExecutor::conflict_count_;
+		execute["thread_count"] = execute_pool_ != NULL ? (Json::UInt)execute_pool_->Size() : 1;
+		execute["speculated"] = (Json::Int64)speculated;
+		execute["adopted"] = (Json::Int64)ParallelExecutor::adopt_count_.load();
+		execute["conflict"] = (Json::Int64)conflicted;
+		execute["serial"] = (Json::Int64)ParallelExecutor::serial_count_.load();
+		execute["conflict_rate"] = utils::String::Format("%.2f", speculated > 0 ? (double)conflicted / speculated : 0.0);
+		persister_.GetModuleStatus(data["persist"]);
+		state_sync_.GetModuleStatus(data["state_sync"]);
+		Json::Value &sub_trie = data["sub_trie"];
+		sub_trie["open"] = (Json::Int64)AccountFrm::sub_trie_open_count_.load();
+		sub_trie["avoided"] = (Json::Int64)AccountFrm::sub_trie_avoided_count_.load();
+		sub_trie["last_ledger_open"] = sub_trie_open_ledger_;
+		sub_trie["last_ledger_avoided"] = sub_trie_avoided_ledger_;
+		Json::Value &trie_node = data["trie_node"];
+		trie_node["size"] = (Json::UInt)sizeof(NodeFrm);
+		trie_node["live"] = (Json::Int64)(NodeFrm::NEWCOUNT.load() - NodeFrm::DELCOUNT.load());
 		context_manager_.GetModuleStatus(data["ledger_context"]);
 
 		data["chain_max_ledger_seq"] = chain_max_ledger_probaly_ > data["ledger_sequence"].asInt64() ?
 		chain_max_ledger_probaly_ : data["ledger_sequence"].asInt64();
 	}
 
-	bool LedgerManager::CloseLedger(const protocol::ConsensusValue& consensus_value, const std::string& proof) {
-		if (!GlueManager::Instance().CheckValueAndProof(consensus_value.SerializeAsString(), proof)) {
+	bool LedgerManager::CloseLedger(const protocol::ConsensusValue& consensus_value, const std::string& proof, bool catch_up, bool proof_checked) {
+		bool valid = proof_checked ? GlueManager::Instance().CheckValueHelper(consensus_value, -1) == Consensus::CHECK_VALUE_VALID :
+			GlueManager::Instance().CheckValueAndProof(consensus_value.SerializeAsString(), proof);
+		if (!valid) {
 
 			protocol::PbftProof proof_proto;
 			proof_proto.ParseFromString(proof);
@@ -541,7 +966,7 @@ namespace phantom {
 
 		int64_t time1 = utils::Timestamp().HighResolution();
 
-		tree_->UpdateHash();
+		tree_->UpdateHash(hash_pool_, Configure::Instance().ledger_configure_.hash_thread_count_);
 		int64_t time2 = utils::Timestamp().HighResolution();
 
 		header->set_account_tree_hash(tree_->GetRootHash());
@@ -597,16 +1022,14 @@ namespace phantom {
 		proof_ = proof;
 
 		//consensus value
-		WRITE_BATCH ledger_db_batch;
-		ledger_db_batch.Put(ComposePrefix(General::CONSENSUS_VALUE_PREFIX, consensus_value.ledger_seq()), consensus_value.SerializeAsString());
+		std::shared_ptr<WRITE_BATCH> ledger_db_batch = std::make_shared<WRITE_BATCH>();
+		ledger_db_batch->Put(ComposePrefix(General::CONSENSUS_VALUE_PREFIX, consensus_value.ledger_seq()), consensus_value.SerializeAsString());
+		closing_ledger->AddToBatch(*ledger_db_batch);
 
-		if (!closing_ledger->AddToDb(ledger_db_batch)) {
-			PROCESS_EXIT("AddToDb failed");
-		}
-
-		if (!Storage::Instance().account_db()->WriteBatch(*account_db_batch)) {
-			PROCESS_EXIT("Write batch failed: %s", Storage::Instance().account_db()->error_desc().c_str());
-		}
+		//written at once, or by the persistence stage after the last ledger is on disk.
+		//reads see the batches from here on either way, queries once they are written
+		AddLedgerView(*header);
+		persister_.Persist(ledger_seq, ledger_db_batch, account_db_batch, catch_up);
 
 		//write successful, then update the variable
 		last_closed_ledger_ = closing_ledger;
@@ -614,14 +1037,23 @@ namespace phantom {
 		int64_t time3 = utils::Timestamp().HighResolution();
 		tree_->batch_ = std::make_shared<WRITE_BATCH>();
 		tree_->FreeMemory(4);
+
+		int64_t sub_trie_open = AccountFrm::sub_trie_open_count_.load();
+		int64_t sub_trie_avoided = AccountFrm::sub_trie_avoided_count_.load();
+		sub_trie_open_ledger_ = sub_trie_open - sub_trie_open_mark_;
+		sub_trie_avoided_ledger_ = sub_trie_avoided - sub_trie_avoided_mark_;
+		sub_trie_open_mark_ = sub_trie_open;
+		sub_trie_avoided_mark_ = sub_trie_avoided;
 		LOG_INFO("ledger(" FMT_I64 ") closed txcount(" FMT_SIZE ") hash(%s) apply="  FMT_I64_EX(-8) " calc_hash="  FMT_I64_EX(-8) " addtodb=" FMT_I64_EX(-8)
-			" total=" FMT_I64_EX(-8) " LoadValue=" FMT_I64 " tsize=" FMT_SIZE,
+			" persist_wait=" FMT_I64_EX(-8) " persist=" FMT_I64_EX(-8) " total=" FMT_I64_EX(-8) " LoadValue=" FMT_I64 " tsize=" FMT_SIZE,
 			closing_ledger->GetProtoHeader().seq(),
 			closing_ledger->GetTxOpeCount(),
 			utils::String::Bin4ToHexString(closing_ledger->GetProtoHeader().hash()).c_str(),
 			time1 - time0 + closing_ledger->apply_time_,
 			time2 - time1,
 			time3 - time2,
+			persister_.last_wait_time(),
+			persister_.last_write_time(),
 			time3 - time0 + closing_ledger->apply_time_,
 			tree_->time_,
 			closing_ledger->GetTxCount());
@@ -705,8 +1137,9 @@ namespace phantom {
 		do {
 			utils::MutexGuard guard(gmutex_);
 			LOG_TRACE("OnRequestLedgers pid(" FMT_I64 "),[" FMT_I64 ", " FMT_I64 "]", peer_id, message.begin(), message.end());
-			if (message.end() - message.begin() + 1 > 5) {
-				LOG_ERROR("Only 5 blocks can be requested at a time while try to (" FMT_I64 ")", message.end() - message.begin());
+			int64_t max_count = MAX((int64_t)Configure::Instance().ledger_configure_.max_ledger_per_message_, 5);
+			if (message.end() - message.begin() + 1 > max_count) {
+				LOG_ERROR("Only " FMT_I64 " blocks can be requested at a time while try to (" FMT_I64 ")", max_count, message.end() - message.begin() + 1);
 				return;
 			}
 
@@ -715,34 +1148,46 @@ namespace phantom {
 				return;
 			}
 
+			//the max seq alone tells the peer to ask others, rather than wait for a timeout
 			if (last_closed_ledger_->GetProtoHeader().seq() < message.end()) {
 				LOG_INFO("peer(" FMT_I64 ") request [" FMT_I64 "," FMT_I64 "] while the max consensus_value is (" FMT_I64 ")",
 					peer_id, message.begin(), message.end(), last_closed_ledger_->GetProtoHeader().seq());
-				return;
+				ledgers.set_sync_code(protocol::Ledgers::OUT_OF_SYNC);
+				ledgers.set_max_seq(last_closed_ledger_->GetProtoHeader().seq());
+				break;
 			}
 
-
 			ledgers.set_max_seq(last_closed_ledger_->GetProtoHeader().seq());
 
-			for (int64_t i = message.begin(); i <= message.end(); i++) {
-				protocol::ConsensusValue item;
-				if (!ConsensusValueFromDB(i, item)) {
-					ret = false;
-					LOG_ERROR("ConsensusValueFromDB failed seq=" FMT_I64, i);
+			//the value after end carries the proof of end, read it in the same batch
+			int64_t seq = message.end();
+			bool is_last = (seq == last_closed_ledger_->GetProtoHeader().seq());
+			std::vector<protocol::ConsensusValue> values;
+			ConsensusValuesFromDB(message.begin(), is_last ? seq : seq + 1, values);
+			if ((int64_t)values.size() < seq - message.begin() + 1) {
+				ret = false;
+				LOG_ERROR("ConsensusValueFromDB failed seq=" FMT_I64, message.begin() + (int64_t)values.size());
+				break;
+			}
+
+			//a long range stops at the byte limit, the requester asks for the rest again
+			int64_t reply_bytes = 0;
+			for (int64_t i = 0; i <= seq - message.begin(); i++) {
+				ledgers.add_values()->CopyFrom(values[i]);
+				reply_bytes += values[i].ByteSize();
+				if (i < seq - message.begin() && reply_bytes >= General::TXSET_LIMIT_SIZE) {
+					seq = message.begin() + i;
+					is_last = false;
 					break;
 				}
-				ledgers.add_values()->CopyFrom(item);
 			}
 
-			int64_t seq = message.end();
-			protocol::ConsensusValue next;
-
-			if (seq == last_closed_ledger_->GetProtoHeader().seq())
+			if (is_last)
 				ledgers.set_proof(proof_);
-			else if (ConsensusValueFromDB(seq + 1, next))
-				ledgers.set_proof(next.previous_proof());
+			else if ((int64_t)values.size() > seq - message.begin() + 1)
+				ledgers.set_proof(values[seq - message.begin() + 1].previous_proof());
 			else {
-				LOG_ERROR("");
+				LOG_ERROR("Get proof of ledger(" FMT_I64 ") failed", seq);
 			}
 		} while (false);
 		if (ret) {
@@ -756,91 +1201,240 @@ namespace phantom {
 	}
 
 	void LedgerManager::OnReceiveLedgers(const protocol::Ledgers &ledgers, int64_t peer_id) {
+		if (ledgers.values_size() == 0) {
+			LOG_INFO("OnReceiveLedgers max seq(" FMT_I64 ") from peer(" FMT_I64 ")", ledgers.max_seq(), peer_id);
+		}
+		else {
+			LOG_INFO("OnReceiveLedgers [" FMT_I64 "," FMT_I64 "] from peer(" FMT_I64 ")",
+				ledgers.values(0).ledger_seq(), ledgers.values(ledgers.values_size() - 1).ledger_seq(), peer_id);
+		}
 
-		bool valid = false;
-		int64_t next = 0;
+		int64_t current_time = utils::Timestamp::HighResolution();
+		if (!sync_.OnReceive(ledgers, peer_id, current_time)) {
+			return;
+		}
+		ApplyLedgers(current_time);
+
+		int64_t next = GetLastClosedLedger().seq() + 1;
+		int64_t max_seq = sync_.max_seq();
+		int64_t state_sync_distance = Configure::Instance().ledger_configure_.state_sync_distance_;
+		if (state_sync_distance > 0 && max_seq - next >= state_sync_distance) {
+			state_sync_.Start(peer_id);
+		}
+		else if (!state_sync_.active()) {
+			std::vector<LedgerFetch::Request> requests;
+			sync_.Dispatch(current_time, requests);
+			LedgerFetch::Send(requests);
+		}
 
 		do {
 			utils::MutexGuard guard(gmutex_);
-			if (ledgers.values_size() == 0) {
-				LOG_ERROR("received empty Ledgers from(" FMT_I64 ")", peer_id);
-				break;
-			}
-			int64_t begin = ledgers.values(0).ledger_seq();
-			int64_t end = ledgers.values(ledgers.values_size() - 1).ledger_seq();
-
-			LOG_INFO("OnReceiveLedgers [" FMT_I64 "," FMT_I64 "] from peer(" FMT_I64 ")", begin, end, peer_id);
+			chain_max_ledger_probaly_ = max_seq;
+		} while (false);
+	}
 
-			if (sync_.peers_.find(peer_id) == sync_.peers_.end()) {
-				LOG_ERROR("received unexpected ledgers [" FMT_I64 "," FMT_I64 "] from (" FMT_I64 ")",
-					begin, end, peer_id);
+	void LedgerManager::ApplyLedgers(int64_t current_time) {
+		utils::MutexGuard guard(gmutex_);
+		int64_t max_seq = sync_.max_seq();
+		std::string validators_hash = HashWrapper::Crypto(validators_.SerializeAsString());
+		LedgerFetch::Entry entry;
+		while (!state_sync_.active() && sync_.Pop(last_closed_ledger_->GetProtoHeader().seq() + 1, entry)) {
+			int64_t seq = entry.value_.ledger_seq();
+			//far behind the network, the ledger may be written together with the next ones
+			bool catch_up = max_seq - seq > Configure::Instance().ledger_configure_.catch_up_distance_;
+			bool proof_checked = entry.verified_ && entry.validators_hash_ == validators_hash;
+			if (!CloseLedger(entry.value_, entry.proof_, catch_up, proof_checked)) {
+				sync_.Reject(seq, entry.peer_id_, current_time);
 				break;
 			}
 
-			auto& itm = sync_.peers_[peer_id];
-			itm.send_time_ = 0;
-
-			if (begin != itm.gl_.begin() || end != itm.gl_.end()) {
-				LOG_ERROR("received unexpected ledgers[" FMT_I64 "," FMT_I64 "] while expect[" FMT_I64 "," FMT_I64 "]",
-					begin, end, itm.gl_.begin(), itm.gl_.end());
-				itm.probation_ = utils::Timestamp::HighResolution() + 60 * utils::MICRO_UNITS_PER_SEC;
-				itm.gl_.set_begin(0);
-				itm.gl_.set_end(0);
-				break;
+			//the proofs checked ahead with the former set are checked again on close
+			std::string new_hash = HashWrapper::Crypto(validators_.SerializeAsString());
+			if (new_hash != validators_hash) {
+				validators_hash = new_hash;
+				sync_.SetValidators(validators_, validators_hash);
 			}
+		}
+		sync_.SetNext(last_closed_ledger_->GetProtoHeader().seq() + 1);
+	}
 
-			itm.gl_.set_begin(0);
-			itm.gl_.set_end(0);
+	void LedgerManager::OnRequestAccountTree(const protocol::GetAccountTree &message, int64_t peer_id) {
+		state_sync_.OnRequest(message, peer_id);
+	}
 
-			for (int i = 0; i < ledgers.values_size(); i++) {
-				const protocol::ConsensusValue& consensus_value = ledgers.values(i);
-				std::string proof;
-				if (i < ledgers.values_size() - 1) {
-					proof = ledgers.values(i + 1).previous_proof();
-				}
-				else {
-					proof = ledgers.proof();
-				}
-				if (consensus_value.ledger_seq() == last_closed_ledger_->GetProtoHeader().seq() + 1) {
-					if (!CloseLedger(consensus_value, proof)) {
-						valid = false;
-						itm.probation_ = utils::Timestamp::HighResolution() + 60 * utils::MICRO_UNITS_PER_SEC;
-						break;
+	void LedgerManager::OnReceiveAccountTree(const protocol::AccountTree &message, int64_t peer_id) {
+		state_sync_.OnResponse(message, peer_id);
+	}
+
+	bool LedgerManager::WriteAccountState(Json::Value &install) {
+		KeyValueDb *account_db = Storage::Instance().account_db();
+		KeyValueDb *ledger_db = Storage::Instance().ledger_db();
+		int64_t seq = install["seq"].asInt64();
+		WRITE_BATCH batch;
+		size_t pending = 0;
+
+		//the old rows of the trees go first, the account index is built again from the new tree
+		if (!install["copying"].asBool()) {
+			std::string tree_begin = General::ACCOUNT_PREFIX, tree_end = General::ACCOUNT_PREFIX;
+			tree_begin.push_back(Trie::EVEN_PREFIX);
+			tree_end.push_back(Trie::LEAF_PREFIX + 1);
+			ReadRange ranges[3] = { ReadRange::Between(tree_begin, tree_end), ReadRange::Prefix(ComposePrefix(General::ASSET_PREFIX, "")),
+				ReadRange::Prefix(ComposePrefix(General::METADATA_PREFIX, "")) };
+			for (size_t i = 0; i < 3; i++) {
+				ranges[i].fill_cache_ = false;
+				bool ok = true;
+				KeyValueIterator *it = account_db->NewIterator(ranges[i]);
+				for (it->SeekToFirst(); it->Valid() && ok; it->Next()) {
+					batch.Delete(it->key());
+					if (++pending >= 10000) {
+						ok = account_db->WriteBatch(batch);
+						batch.Clear();
+						pending = 0;
 					}
-					valid = true;
+				}
+				ok = ok && it->ok();
+				delete it;
+				if (!ok) {
+					LOG_ERROR("Delete the account trees failed(%s)", account_db->error_desc().c_str());
+					return false;
 				}
 			}
-			next = last_closed_ledger_->GetProtoHeader().seq() + 1;
-		} while (false);
-
-
-		if (valid) {
-			int64_t current_time = utils::Timestamp::HighResolution();
-			if (next <= ledgers.max_seq()) {
-				protocol::GetLedgers gl;
-				gl.set_begin(next);
-				gl.set_end(MIN(ledgers.max_seq(), next + 4));
-				gl.set_timestamp(current_time);
-				RequestConsensusValues(peer_id, gl, current_time);
+			install["copying"] = true;
+			batch.Put(General::KEY_STATE_SYNC_INSTALL, install.toFastString());
+			batch.Delete(General::KEY_ACCOUNT_INDEX);
+			if (!account_db->WriteBatch(batch, DURABILITY_SYNC)) {
+				LOG_ERROR("Write the state sync install failed(%s)", account_db->error_desc().c_str());
+				return false;
 			}
+			batch.Clear();
+			pending = 0;
+		}
 
-			if (ledgers.max_seq() > chain_max_ledger_probaly_) {
-				chain_max_ledger_probaly_ = ledgers.max_seq();
+		//each batch moves its rows out of the staging area, so a restart goes on with the rest
+		std::string staged_prefix = ComposePrefix(General::STATE_SYNC_PREFIX, "");
+		ReadRange range = ReadRange::Prefix(staged_prefix);
+		range.fill_cache_ = false;
+		bool ok = true;
+		KeyValueIterator *it = account_db->NewIterator(range);
+		for (it->SeekToFirst(); it->Valid() && ok; it->Next()) {
+			batch.Put(it->key().ToString().substr(staged_prefix.size()), it->value());
+			batch.Delete(it->key());
+			if (++pending >= 10000) {
+				ok = account_db->WriteBatch(batch);
+				batch.Clear();
+				pending = 0;
 			}
 		}
+		ok = ok && it->ok();
+		delete it;
+		if (!ok) {
+			LOG_ERROR("Move the staged account state failed(%s)", account_db->error_desc().c_str());
+			return false;
+		}
+
+		protocol::LedgerHeader header;
+		if (!header.ParseFromString(utils::String::HexStringToBin(install["header"].asString()))) {
+			LOG_ERROR("Parse the header of the state sync install failed");
+			return false;
+		}
+		WRITE_BATCH ledger_batch;
+		ledger_batch.Put(General::KEY_LEDGER_SEQ, utils::String::ToString(seq));
+		ledger_batch.Put(ComposePrefix(General::LEDGER_PREFIX, seq), header.SerializeAsString());
+		ledger_batch.Put(ComposePrefix(General::CONSENSUS_VALUE_PREFIX, seq), utils::String::HexStringToBin(install["consensus_value"].asString()));
+		batch.Put(General::KEY_LEDGER_SEQ, utils::String::ToString(seq));
+		batch.Put(General::LAST_PROOF, utils::String::HexStringToBin(install["proof"].asString()));
+		batch.Put(General::STATISTICS, install["statistics"].asString());
+		batch.Put(utils::String::Format("fees-%s", utils::String::BinToHexString(header.fees_hash()).c_str()),
+			utils::String::HexStringToBin(install["fees"].asString()));
+		batch.Delete(General::KEY_STATE_SYNC_INSTALL);
+		if (!ledger_db->WriteBatch(ledger_batch, DURABILITY_SYNC) || !account_db->WriteBatch(batch, DURABILITY_SYNC)) {
+			LOG_ERROR("Write the account state of ledger(" FMT_I64 ") failed(%s%s)", seq,
+				ledger_db->error_desc().c_str(), account_db->error_desc().c_str());
+			return false;
+		}
+		return true;
 	}
 
-	void LedgerManager::RequestConsensusValues(int64_t pid, protocol::GetLedgers& gl, int64_t time) {
-		LOG_TRACE("RequestConsensusValues from peer(" FMT_I64 "), [" FMT_I64 "," FMT_I64 "]", pid, gl.begin(), gl.end());
+	bool LedgerManager::InstallAccountState(const protocol::LedgerHeader &header, const std::string &consensus_value, const std::string &proof,
+		const std::string &fees, int64_t account_count) {
+		utils::MutexGuard guard(gmutex_);
+		int64_t seq = header.seq();
+		if (seq <= last_closed_ledger_->GetProtoHeader().seq()) {
+			LOG_INFO("Replay reached ledger(" FMT_I64 ") first, the fetched account state is dropped", seq);
+			return false;
+		}
+		protocol::FeeConfig new_fees;
+		if (!new_fees.ParseFromString(fees)) {
+			LOG_ERROR("Parse the fee config of ledger(" FMT_I64 ") failed", seq);
+			return false;
+		}
+
+		//every closed ledger is on disk before the trees are replaced
+		persister_.FlushGroup();
+		persister_.Wait();
+
+		//the install is recorded before the trees change, a restart finishes it
+		statistics_["account_count"] = (Json::Int64)account_count;
+		Json::Value install;
+		install["seq"] = (Json::Int64)seq;
+		install["header"] = utils::String::BinToHexString(header.SerializeAsString());
+		install["consensus_value"] = utils::String::BinToHexString(consensus_value);
+		install["proof"] = utils::String::BinToHexString(proof);
+		install["fees"] = utils::String::BinToHexString(fees);
+		install["statistics"] = statistics_.toFastString();
+		install["copying"] = false;
+		KeyValueDb *account_db = Storage::Instance().account_db();
+		WRITE_BATCH batch;
+		batch.Put(General::KEY_STATE_SYNC_INSTALL, install.toFastString());
+		if (!account_db->WriteBatch(batch, DURABILITY_SYNC) || !WriteAccountState(install)) {
+			PROCESS_EXIT("Write the account state of ledger(" FMT_I64 ") failed(%s%s)", seq,
+				Storage::Instance().ledger_db()->error_desc().c_str(), account_db->error_desc().c_str());
+		}
+
+		delete tree_;
+		tree_ = new KVTrie();
+		if (node_cache_ != nullptr) {
+			node_cache_->Clear();
+			tree_->SetNodeCache(node_cache_);
+		}
+		tree_->Init(account_db, std::make_shared<WRITE_BATCH>(), General::ACCOUNT_PREFIX, 4);
+		tree_->UpdateHash();
+		tree_->batch_ = std::make_shared<WRITE_BATCH>();
+		if (tree_->GetRootHash() != header.account_tree_hash()) {
+			PROCESS_EXIT("Account tree hash(%s) of the fetched state is not ledger(" FMT_I64 ") account_tree_hash(%s)",
+				utils::String::Bin4ToHexString(tree_->GetRootHash()).c_str(), seq,
+				utils::String::Bin4ToHexString(header.account_tree_hash()).c_str());
+		}
+		if (CheckAccountIndex(true) < 0) {
+			PROCESS_EXIT("Build account index of ledger(" FMT_I64 ") failed", seq);
+		}
+
+		last_closed_ledger_ = std::make_shared<LedgerFrm>();
+		*last_closed_ledger_->ProtoLedger().mutable_header() = header;
+		proof_ = proof;
 		do {
-			utils::MutexGuard guard(gmutex_);
-			auto &peer = sync_.peers_[pid];
-			peer.gl_.CopyFrom(gl);
-			peer.send_time_ = time;
-			sync_.update_time_ = time;
+			utils::WriteLockGuard guard(fee_config_mutex_);
+			fees_ = new_fees;
+		} while (false);
+		do {
+			utils::WriteLockGuard guard(lcl_header_mutex_);
+			lcl_header_ = header;
 		} while (false);
+		AddLedgerView(header);
+		PublishLedgerView(seq);
+		context_manager_.RemoveCompleted(seq);
 
-		PeerManager::Instance().ConsensusNetwork().SendRequest(pid, protocol::OVERLAY_MSGTYPE_LEDGERS, gl.SerializeAsString());
+		protocol::ValidatorSet tmp_v = validators_;
+		std::string tmp_proof = proof_;
+		Global::Instance().GetIoService().post([tmp_v, tmp_proof]() {
+			GlueManager::Instance().UpdateValidators(tmp_v, tmp_proof);
+		});
+
+		//replay goes on from here at once
+		sync_.SetNext(seq + 1);
+		sync_.Touch(0);
+		LOG_INFO("Installed the account state of ledger(" FMT_I64 "), " FMT_I64 " accounts", seq, account_count);
+		return true;
 	}
 
 	Result LedgerManager::DoTransaction(protocol::TransactionEnv& env, LedgerContext *ledger_context) {
@@ -28,6 +28,9 @@
 #include "ledgercontext_manager.h"
 #include "environment.h"
 #include "kv_trie.h"
+#include "ledger_persister.h"
+#include "ledger_fetch.h"
+#include "state_sync.h"
 #include "proto/cpp/consensus.pb.h"
 
 #ifdef WIN32
@@ -39,6 +42,26 @@
 #endif
 
 namespace phantom {
+	//a closed ledger which is on disk and the dbs pinned at it, read by queries without any ledger lock.
+	//the snapshots are released with the last reference
+	class LedgerView {
+	public:
+		typedef std::shared_ptr<const LedgerView> pointer;
+
+		LedgerView(const protocol::LedgerHeader &header, int64_t account_count);
+		~LedgerView();
+
+		//take the snapshots, once the batches of the ledger are written
+		void Pin();
+
+		protocol::LedgerHeader header_;
+		int64_t account_count_;
+		KeyValueDb *ledger_db_;
+		KeyValueDb *account_db_;
+		const SNAPSHOT *ledger_snapshot_;
+		const SNAPSHOT *account_snapshot_;
+	};
+
 	class LedgerFetch;
 	class ContractManager;
 	class LedgerManager : public utils::Singleton<phantom::LedgerManager>,
@@ -46,14 +69,19 @@ namespace phantom {
 		public phantom::StatusModule {
 		friend class utils::Singleton<phantom::LedgerManager>;
 		friend class LedgerFetch;
+		friend class StateSync;
 	public:
 
 		bool Initialize();
 		bool Exit();
 
 		int OnConsent(const protocol::ConsensusValue &value, const std::string& proof);
+		//returns when every closed ledger is on disk, before a node proposes or votes for the next one
+		void WaitPersisted();
 
 		protocol::LedgerHeader GetLastClosedLedger();
+		//the last closed ledger which is on disk, null before Initialize
+		LedgerView::pointer GetLedgerView();
 
 		int GetAccountNum();
 
@@ -61,6 +89,10 @@ namespace phantom {
 
 		void OnReceiveLedgers(const protocol::Ledgers &message, int64_t peer_id);
 
+		void OnRequestAccountTree(const protocol::GetAccountTree &message, int64_t peer_id);
+
+		void OnReceiveAccountTree(const protocol::AccountTree &message, int64_t peer_id);
+
 		bool GetValidators(int64_t seq, protocol::ValidatorSet& validators_set);
 		const protocol::ValidatorSet& Validators()
 		{
@@ -69,7 +101,11 @@ namespace phantom {
 
 		static bool FeesConfigGet(const std::string& hash, protocol::FeeConfig &fee);
 		bool ConsensusValueFromDB(int64_t seq, protocol::ConsensusValue& request);
+		//read [begin, end] with one batched read, values stops before the first missing seq
+		bool ConsensusValuesFromDB(int64_t begin, int64_t end, std::vector<protocol::ConsensusValue> &values);
 		protocol::FeeConfig GetCurFeeConfig();
+		//workers for speculative transaction execution, null if txs are executed serially
+		utils::ThreadPool *GetExecutePool() { return execute_pool_; }
 
 		Result DoTransaction(protocol::TransactionEnv& env, LedgerContext *ledger_context); // -1: false, 0 : successs, > 0 exception
 		void NotifyLedgerClose(LedgerFrm::pointer closing_ledger, bool has_upgrade);
@@ -79,24 +115,49 @@ namespace phantom {
 		virtual void GetModuleStatus(Json::Value &data);
 
 		static void CreateHardforkLedger();
+		//delete the ledgers and transactions after seq up to max_seq and make seq the last ledger of
+		//the ledger db again, in one synced write
+		static bool RollbackLedgers(KeyValueDb *ledger_db, int64_t seq, int64_t max_seq);
+
+		//compare the flat account index with the account tree, rewrite it from the tree if repair,
+		//return the count of inconsistent entries or -1 if failed
+		int64_t CheckAccountIndex(bool repair);
+		//read latency of accounts by the flat index and by the account tree, at each power of ten
+		//from 100000 accounts up to count, in a disk db of its own
+		static void BenchAccountRead(int64_t count);
 	public:
 		utils::Mutex gmutex_;
 		Json::Value statistics_;
 		KVTrie* tree_;
+		utils::ThreadPool *hash_pool_;
+		utils::ThreadPool *execute_pool_;
+		LedgerPersister persister_;
+		StateSync state_sync_;
+		std::shared_ptr<NodeCache> node_cache_;
 
 		LedgerContextManager context_manager_;
 	private:
 		LedgerManager();
 		~LedgerManager();
 
-		void RequestConsensusValues(int64_t pid, protocol::GetLedgers& gl, int64_t time);
+		//close the downloaded ledgers in seq order, as far as they came
+		void ApplyLedgers(int64_t current_time);
 
 		int64_t GetMaxLedger();
 
-		bool CloseLedger(const protocol::ConsensusValue& request, const std::string& proof);
+		//catch_up ledgers are replayed far behind the network and may be written in a group
+		//proof_checked skips the proof, checked ahead with the validators of the previous ledger
+		bool CloseLedger(const protocol::ConsensusValue& request, const std::string& proof, bool catch_up, bool proof_checked = false);
 
 		bool CreateGenesisAccount();
 
+		//replace the account trees by the rows state sync staged in the account db and go on from header
+		bool InstallAccountState(const protocol::LedgerHeader &header, const std::string &consensus_value, const std::string &proof,
+			const std::string &fees, int64_t account_count);
+		//move the staged rows into the account trees in bounded batches, install is the record which lets
+		//a restart go on with an interrupted install
+		static bool WriteAccountState(Json::Value &install);
+
 		static void ValidatorsSet(std::shared_ptr<WRITE_BATCH> batch, const protocol::ValidatorSet& validators);
 		static bool ValidatorsGet(const std::string& hash, protocol::ValidatorSet& vlidators_set);
 
@@ -108,49 +169,26 @@ namespace phantom {
 
 		utils::ReadWriteLock lcl_header_mutex_;
 		protocol::LedgerHeader lcl_header_;
+
+		//views of closed ledgers waiting for their writes, and the published one
+		void AddLedgerView(const protocol::LedgerHeader &header);
+		void PublishLedgerView(int64_t seq);
+		utils::Mutex views_mutex_;
+		std::map<int64_t, std::shared_ptr<LedgerView>> unwritten_views_;
+		std::shared_ptr<const LedgerView> view_;
 		int64_t chain_max_ledger_probaly_;
 
 		utils::ReadWriteLock fee_config_mutex_;
 		protocol::FeeConfig fees_;
 
-		struct SyncStat{
-			int64_t send_time_;
-			protocol::GetLedgers gl_;
-			int64_t probation_; //
-			SyncStat(){
-				send_time_ = 0;
-				probation_ = 0;
-			}
-			Json::Value ToJson(){
-				Json::Value v;
-				v["send_time"] = send_time_;
-				v["probation"] = probation_;
-				v["gl"] = Proto2Json(gl_);
-				return v;
-			}
-		};
-		
-		struct Sync{
-			int64_t update_time_;
-			/*std::map<int64_t, int> buffer_;*/
-			std::map<int64_t, SyncStat> peers_;
-			Sync(){
-				update_time_ = 0;
-			}
-			Json::Value ToJson(){
-				Json::Value v;
-				v["update_time"] = update_time_;
-				Json::Value& peers = v["peers"];
-				for (auto it = peers_.begin(); it != peers_.end(); it++){
-					Json::Value tmp = it->second.ToJson();
-					tmp["pid"] = it->first;
-					peers[peers.size()] = tmp;
-				}
-				return v;
-			}
-		};
-
-		Sync sync_;
+		//asset and metadata tree opens done and avoided by the last closed ledger
+		int64_t sub_trie_open_mark_;
+		int64_t sub_trie_avoided_mark_;
+		int64_t sub_trie_open_ledger_;
+		int64_t sub_trie_avoided_ledger_;
+
+		//ledgers downloaded to catch up
+		LedgerFetch sync_;
 	};
 }
 #endif
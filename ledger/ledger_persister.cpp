@@ -0,0 +1,718 @@
+/*
+	phantom is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	phantom is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with phantom.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <unordered_map>
+#ifndef WIN32
+#include <unistd.h>
+#include <signal.h>
+#include <sys/wait.h>
+#endif
+#include <utils/logger.h>
+#include <utils/file.h>
+#include <common/general.h>
+#include "ledger_persister.h"
+#include "ledger_manager.h"
+
+namespace phantom {
+
+	//copies the records of a batch to the end of another
+	class BatchMerger : public WRITE_BATCH::Handler {
+	public:
+		BatchMerger(WRITE_BATCH &target) :target_(target) {}
+		virtual void Put(const SLICE &key, const SLICE &value) override {
+			target_.Put(key, value);
+		}
+		virtual void Delete(const SLICE &key) override {
+			target_.Delete(key);
+		}
+	private:
+		WRITE_BATCH &target_;
+	};
+
+	//A db whose reads see the batches not written by the persistence stage yet. Other writes and
+	//iterators wait for the write in flight, so they are ordered after it
+	class LedgerPersister::PendingDb : public KeyValueDb {
+	public:
+		PendingDb(KeyValueDb *db, utils::Semaphore &slot) :db_(db), slot_(slot) {}
+		~PendingDb() {
+			delete db_;
+		}
+
+		virtual bool Open(const std::string &db_path, int max_open_files) override {
+			return db_->Open(db_path, max_open_files);
+		}
+
+		virtual bool Close() override {
+			return db_->Close();
+		}
+
+		virtual int32_t Get(const std::string &key, std::string &value) override {
+			do {
+				utils::ReadLockGuard guard(pending_lock_);
+				auto iter = pending_.find(key);
+				if (iter == pending_.end()) {
+					break;
+				}
+
+				if (!iter->second.exist_) {
+					return 0;
+				}
+				value = iter->second.value_;
+				return 1;
+			} while (false);
+
+			int32_t ret = db_->Get(key, value);
+			if (ret < 0) {
+				CopyError();
+			}
+			return ret;
+		}
+
+		//the snapshot is taken by the wrapped db, pending batches are not in it
+		virtual int32_t Get(const std::string &key, std::string &value, const SNAPSHOT *snapshot) override {
+			int32_t ret = db_->Get(key, value, snapshot);
+			if (ret < 0) {
+				CopyError();
+			}
+			return ret;
+		}
+
+		virtual bool MultiGet(const std::vector<std::string> &keys, std::vector<std::string> &values, std::vector<int32_t> &statuses) override {
+			values.resize(keys.size());
+			statuses.resize(keys.size());
+			std::vector<size_t> misses;
+			std::vector<std::string> miss_keys;
+			do {
+				utils::ReadLockGuard guard(pending_lock_);
+				for (size_t i = 0; i < keys.size(); i++) {
+					auto iter = pending_.find(keys[i]);
+					if (iter == pending_.end()) {
+						misses.push_back(i);
+						miss_keys.push_back(keys[i]);
+						continue;
+					}
+
+					statuses[i] = iter->second.exist_ ? 1 : 0;
+					values[i] = iter->second.value_;
+				}
+			} while (false);
+
+			if (miss_keys.empty()) {
+				return true;
+			}
+
+			std::vector<std::string> miss_values;
+			std::vector<int32_t> miss_statuses;
+			bool ret = Check(db_->MultiGet(miss_keys, miss_values, miss_statuses));
+			for (size_t i = 0; i < misses.size(); i++) {
+				statuses[misses[i]] = miss_statuses[i];
+				values[misses[i]].swap(miss_values[i]);
+			}
+			return ret;
+		}
+
+		virtual bool Put(const std::string &key, const std::string &value) override {
+			slot_.Wait();
+			bool ret = Check(db_->Put(key, value));
+			Forget(key);
+			slot_.Signal();
+			return ret;
+		}
+
+		virtual bool Delete(const std::string &key) override {
+			slot_.Wait();
+			bool ret = Check(db_->Delete(key));
+			Forget(key);
+			slot_.Signal();
+			return ret;
+		}
+
+		virtual bool GetOptions(Json::Value &options) override {
+			return db_->GetOptions(options);
+		}
+
+		virtual bool WriteBatch(WRITE_BATCH &values) override {
+			slot_.Wait();
+			bool ret = Check(db_->WriteBatch(values));
+			Forget(values);
+			slot_.Signal();
+			return ret;
+		}
+
+		virtual bool WriteBatch(WRITE_BATCH &values, WriteDurability durability) override {
+			slot_.Wait();
+			bool ret = Check(db_->WriteBatch(values, durability));
+			Forget(values);
+			slot_.Signal();
+			return ret;
+		}
+
+		virtual bool WriteBatchUnsynced(WRITE_BATCH &values) override {
+			slot_.Wait();
+			bool ret = Check(db_->WriteBatchUnsynced(values));
+			Forget(values);
+			slot_.Signal();
+			return ret;
+		}
+
+		virtual bool Flush() override {
+			return Check(db_->Flush());
+		}
+
+		virtual KeyValueIterator *NewIterator(const ReadRange &range) override {
+			slot_.Wait();
+			slot_.Signal();
+			return db_->NewIterator(range);
+		}
+
+		virtual const SNAPSHOT *GetSnapshot() override {
+			return db_->GetSnapshot();
+		}
+
+		virtual void ReleaseSnapshot(const SNAPSHOT *snapshot) override {
+			db_->ReleaseSnapshot(snapshot);
+		}
+
+		//make the batch of ledger seq visible to reads, before it is queued
+		void SetPending(const WRITE_BATCH &batch, int64_t seq) {
+			utils::WriteLockGuard guard(pending_lock_);
+			Collector collector(pending_, seq);
+			batch.Iterate(&collector);
+		}
+
+		//write the batch of ledgers up to seq, then reads of them go to the db. A ledger closing batch is
+		//synced whatever the durability of the db, a group of them is flushed after it
+		bool Write(WRITE_BATCH &batch, int64_t seq, bool unsynced) {
+			bool ret = Check(unsynced ? db_->WriteBatchUnsynced(batch) : db_->WriteBatch(batch, DURABILITY_SYNC));
+			utils::WriteLockGuard guard(pending_lock_);
+			for (auto iter = pending_.begin(); iter != pending_.end();) {
+				if (iter->second.seq_ <= seq) {
+					iter = pending_.erase(iter);
+				}
+				else {
+					iter++;
+				}
+			}
+			return ret;
+		}
+
+	private:
+		struct PendingValue {
+			int64_t seq_; //the ledger which wrote it last
+			bool exist_; //false if deleted
+			std::string value_;
+		};
+		typedef std::unordered_map<std::string, PendingValue> PendingMap;
+
+		class Collector : public WRITE_BATCH::Handler {
+		public:
+			Collector(PendingMap &pending, int64_t seq) :pending_(pending), seq_(seq) {}
+			virtual void Put(const SLICE &key, const SLICE &value) override {
+				PendingValue &pending = pending_[key.ToString()];
+				pending.seq_ = seq_;
+				pending.exist_ = true;
+				pending.value_ = value.ToString();
+			}
+			virtual void Delete(const SLICE &key) override {
+				PendingValue &pending = pending_[key.ToString()];
+				pending.seq_ = seq_;
+				pending.exist_ = false;
+				pending.value_.clear();
+			}
+		private:
+			PendingMap &pending_;
+			int64_t seq_;
+		};
+
+		//a direct write is newer than what an open group holds for the same keys
+		void Forget(const std::string &key) {
+			utils::WriteLockGuard guard(pending_lock_);
+			pending_.erase(key);
+		}
+
+		void Forget(const WRITE_BATCH &batch) {
+			class Forgetter : public WRITE_BATCH::Handler {
+			public:
+				Forgetter(PendingDb *db) :db_(db) {}
+				virtual void Put(const SLICE &key, const SLICE &value) override {
+					db_->Forget(key.ToString());
+				}
+				virtual void Delete(const SLICE &key) override {
+					db_->Forget(key.ToString());
+				}
+			private:
+				PendingDb *db_;
+			} forgetter(this);
+			batch.Iterate(&forgetter);
+		}
+
+		bool Check(bool ret) {
+			if (!ret) {
+				CopyError();
+			}
+			return ret;
+		}
+
+		void CopyError() {
+			utils::MutexGuard guard(mutex_);
+			error_desc_ = db_->error_desc();
+		}
+
+		KeyValueDb *db_;
+		utils::Semaphore &slot_;
+		utils::ReadWriteLock pending_lock_;
+		PendingMap pending_;
+	};
+
+
+	LedgerPersister::LedgerPersister() :
+		thread_(NULL),
+		enabled_(false),
+		ledger_db_(NULL),
+		account_db_(NULL),
+		slot_(1),
+		group_size_(0),
+		group_unsynced_(false),
+		group_begin_time_(0),
+		persisted_seq_(0),
+		persist_count_(0),
+		write_count_(0),
+		group_count_(0),
+		last_wait_time_(0),
+		last_write_time_(0),
+		last_ledger_write_time_(0),
+		last_account_write_time_(0),
+		last_flush_time_(0),
+		total_wait_time_(0),
+		total_write_time_(0) {}
+
+	LedgerPersister::~LedgerPersister() {
+		Exit();
+	}
+
+	bool LedgerPersister::Initialize(bool pipeline, uint32_t group_size, bool group_unsynced, std::function<void(int64_t)> on_durable) {
+		ledger_db_ = new PendingDb(Storage::Instance().ledger_db(), slot_);
+		account_db_ = new PendingDb(Storage::Instance().account_db(), slot_);
+		Storage::Instance().set_ledger_db(ledger_db_);
+		Storage::Instance().set_account_db(account_db_);
+		group_size_ = group_size;
+		group_unsynced_ = group_unsynced;
+		on_durable_ = on_durable;
+		enabled_ = true;
+
+		if (pipeline) {
+			thread_ = new utils::Thread(this);
+			if (!thread_->Start("persist")) {
+				delete thread_;
+				thread_ = NULL;
+				return false;
+			}
+		}
+
+		LOG_INFO("Ledger persistence %s, catch-up group size %u%s", pipeline ? "pipelined" : "serial",
+			group_size_, group_unsynced_ ? " unsynced" : "");
+		return true;
+	}
+
+	bool LedgerPersister::Exit() {
+		if (!enabled_) {
+			return true;
+		}
+
+		FlushGroup();
+		Wait();
+		enabled_ = false;
+		if (thread_ != NULL) {
+			work_.Signal();
+			thread_->JoinWithStop();
+			delete thread_;
+			thread_ = NULL;
+		}
+		return true;
+	}
+
+	void LedgerPersister::Persist(int64_t seq, std::shared_ptr<WRITE_BATCH> ledger_batch, std::shared_ptr<WRITE_BATCH> account_batch, bool catch_up) {
+		Job job;
+		job.seq_ = seq;
+		job.ledger_count_ = 1;
+		job.ledger_batch_ = ledger_batch;
+		job.account_batch_ = account_batch;
+		if (group_size_ <= 1 || (!catch_up && group_.ledger_count_ == 0)) {
+			Submit(job, false);
+			return;
+		}
+
+		//the ledger joins the group, also when catch-up is over, so that the group is written before it
+		if (group_.ledger_count_ == 0) {
+			group_.ledger_batch_ = std::make_shared<WRITE_BATCH>();
+			group_.account_batch_ = std::make_shared<WRITE_BATCH>();
+			group_begin_time_ = utils::Timestamp::HighResolution();
+		}
+		BatchMerger ledger_merger(*group_.ledger_batch_);
+		ledger_batch->Iterate(&ledger_merger);
+		BatchMerger account_merger(*group_.account_batch_);
+		account_batch->Iterate(&account_merger);
+		ledger_db_->SetPending(*ledger_batch, seq);
+		account_db_->SetPending(*account_batch, seq);
+		group_.seq_ = seq;
+		group_.ledger_count_++;
+
+		if (!catch_up || group_.ledger_count_ >= (int64_t)group_size_) {
+			FlushGroup();
+		}
+	}
+
+	void LedgerPersister::FlushGroup() {
+		if (group_.ledger_count_ == 0) {
+			return;
+		}
+
+		Job job = group_;
+		job.unsynced_ = group_unsynced_;
+		group_ = Job();
+		group_begin_time_ = 0;
+		group_count_++;
+		Submit(job, true);
+	}
+
+	void LedgerPersister::Submit(const Job &job, bool pending) {
+		//the slot also orders the direct writes after a serial one, none comes between a group and its flush
+		if (thread_ == NULL) {
+			slot_.Wait();
+			Write(job);
+			slot_.Signal();
+			return;
+		}
+
+		int64_t begin = utils::Timestamp::HighResolution();
+		slot_.Wait();
+		last_wait_time_ = utils::Timestamp::HighResolution() - begin;
+		total_wait_time_ += last_wait_time_;
+
+		if (!pending) {
+			ledger_db_->SetPending(*job.ledger_batch_, job.seq_);
+			account_db_->SetPending(*job.account_batch_, job.seq_);
+		}
+		job_ = job;
+		work_.Signal();
+	}
+
+	void LedgerPersister::Write(const Job &job) {
+		int64_t time0 = utils::Timestamp::HighResolution();
+		if (!ledger_db_->Write(*job.ledger_batch_, job.seq_, job.unsynced_)) {
+			PROCESS_EXIT("Write ledger and transaction failed(%s)", ledger_db_->error_desc().c_str());
+		}
+		//checkpoint of a group before the accounts are written, a flush of the account db by itself
+		//must not bring them to disk ahead of their ledgers
+		int64_t flush_time = utils::Timestamp::HighResolution();
+		if (job.unsynced_ && !ledger_db_->Flush()) {
+			PROCESS_EXIT("Flush ledger db failed(%s)", ledger_db_->error_desc().c_str());
+		}
+		int64_t time1 = utils::Timestamp::HighResolution();
+		flush_time = time1 - flush_time;
+
+		if (!account_db_->Write(*job.account_batch_, job.seq_, job.unsynced_)) {
+			PROCESS_EXIT("Write batch failed: %s", account_db_->error_desc().c_str());
+		}
+		int64_t time2 = utils::Timestamp::HighResolution();
+		if (job.unsynced_ && !account_db_->Flush()) {
+			PROCESS_EXIT("Flush account db failed(%s)", account_db_->error_desc().c_str());
+		}
+		int64_t time3 = utils::Timestamp::HighResolution();
+
+		last_ledger_write_time_ = time1 - time0 - flush_time;
+		last_account_write_time_ = time2 - time1;
+		last_flush_time_ = time3 - time2 + flush_time;
+		last_write_time_ = time3 - time0;
+		total_write_time_ += time3 - time0;
+		persisted_seq_ = job.seq_;
+		persist_count_ += job.ledger_count_;
+		write_count_++;
+		if (on_durable_) {
+			on_durable_(job.seq_);
+		}
+	}
+
+	void LedgerPersister::Wait() {
+		if (thread_ == NULL) {
+			return;
+		}
+
+		slot_.Wait();
+		slot_.Signal();
+	}
+
+	void LedgerPersister::Run(utils::Thread *thread) {
+		while (true) {
+			work_.Wait();
+			if (!enabled_) {
+				break;
+			}
+
+			Write(job_);
+			job_ = Job();
+			slot_.Signal();
+		}
+	}
+
+	void LedgerPersister::GetModuleStatus(Json::Value &data) {
+		int64_t count = std::max<int64_t>(write_count_, 1);
+		data["pipelined"] = thread_ != NULL;
+		data["group_size"] = group_size_;
+		data["group_unsynced"] = group_unsynced_;
+		data["group_open"] = (Json::Int64)group_.ledger_count_;
+		data["persisted_seq"] = (Json::Int64)persisted_seq_.load();
+		data["ledger_count"] = (Json::Int64)persist_count_.load();
+		data["write_count"] = (Json::Int64)write_count_.load();
+		data["group_count"] = (Json::Int64)group_count_.load();
+		data["last_wait_us"] = (Json::Int64)last_wait_time_.load();
+		data["last_ledger_write_us"] = (Json::Int64)last_ledger_write_time_.load();
+		data["last_account_write_us"] = (Json::Int64)last_account_write_time_.load();
+		data["last_flush_us"] = (Json::Int64)last_flush_time_.load();
+		data["avg_wait_us"] = (Json::Int64)(total_wait_time_ / count);
+		data["avg_write_us"] = (Json::Int64)(total_write_time_ / count);
+	}
+
+	//accounts of the crash test, ledger seq writes account seq % count
+	static const int64_t CRASH_TEST_ACCOUNTS = 64;
+	//durability of the dbs in the crash test rounds, in turn
+	static const char *CRASH_TEST_DURABILITY[] = { "sync", "group", "wal" };
+
+	//keys of the account and asset families when the db has them
+	static std::string CrashTestAccount(int64_t index) {
+		return ComposePrefix(General::ACCOUNT_PREFIX, utils::String::Format("crash_" FMT_I64, index));
+	}
+
+	static std::string CrashTestAsset(int64_t index) {
+		return ComposePrefix(General::ASSET_PREFIX, utils::String::Format("crash_" FMT_I64, index));
+	}
+
+	//the one transaction of each ledger
+	static std::string CrashTestTx(int64_t seq) {
+		return utils::String::Format("crash_tx_" FMT_I64, seq);
+	}
+
+	static int64_t CrashTestSeq(KeyValueDb *db) {
+		std::string value;
+		return db->Get(General::KEY_LEDGER_SEQ, value) > 0 ? utils::String::Stoi64(value) : 0;
+	}
+
+	void LedgerPersister::CrashWrite(const DbConfigure &db_config) {
+		Storage &storage = Storage::Instance();
+		LedgerPersister persister;
+		if (!storage.Initialize(db_config, false) || !persister.Initialize(true, 8, true, std::function<void(int64_t)>())) {
+			printf("open the dbs of the crash test failed\n");
+			return;
+		}
+
+		//like a restart, replay goes on after the ledger of the accounts, runs of ledgers are catch-up groups
+		int64_t seq = CrashTestSeq(storage.account_db());
+		while (true) {
+			seq++;
+			std::string value = utils::String::ToString(seq);
+			protocol::EntryList list;
+			list.add_entry(CrashTestTx(seq));
+			protocol::EntryList last_hashs;
+			for (int64_t i = seq; i > 0 && last_hashs.entry_size() < General::LAST_TX_HASHS_LIMIT; i--) {
+				last_hashs.add_entry(CrashTestTx(i));
+			}
+
+			auto ledger_batch = std::make_shared<WRITE_BATCH>();
+			ledger_batch->Put(ComposePrefix(General::LEDGER_PREFIX, seq), value);
+			ledger_batch->Put(ComposePrefix(General::CONSENSUS_VALUE_PREFIX, seq), value);
+			ledger_batch->Put(ComposePrefix(General::LEDGER_TRANSACTION_PREFIX, seq), list.SerializeAsString());
+			ledger_batch->Put(ComposePrefix(General::TRANSACTION_PREFIX, CrashTestTx(seq)), value);
+			ledger_batch->Put(General::LAST_TX_HASHS, last_hashs.SerializeAsString());
+			ledger_batch->Put(General::KEY_LEDGER_SEQ, value);
+			auto account_batch = std::make_shared<WRITE_BATCH>();
+			account_batch->Put(CrashTestAccount(seq % CRASH_TEST_ACCOUNTS), value);
+			account_batch->Put(CrashTestAsset(seq % CRASH_TEST_ACCOUNTS), value);
+			account_batch->Put(General::KEY_LEDGER_SEQ, value);
+			persister.Persist(seq, ledger_batch, account_batch, (seq / 32) % 2 == 0);
+
+			//writes of the durability of the db come between the ledgers, like the peer table
+			if (!storage.keyvalue_db()->Put("crash_peer", value) || !storage.ledger_db()->Put("crash_note", value)) {
+				printf("write of the crash test failed\n");
+				return;
+			}
+			storage.OnTimer(utils::Timestamp::HighResolution());
+		}
+	}
+
+	int32_t LedgerPersister::CrashCheck(const DbConfigure &db_config, int64_t &account_seq) {
+		Storage &storage = Storage::Instance();
+		if (!storage.Initialize(db_config, false)) {
+			printf("open the dbs of the crash test failed\n");
+			return 2;
+		}
+
+		KeyValueDb *ledger_db = storage.ledger_db();
+		KeyValueDb *account_db = storage.account_db();
+		int64_t ledger_seq = CrashTestSeq(ledger_db);
+		account_seq = CrashTestSeq(account_db);
+		if (account_seq > ledger_seq) {
+			printf("the accounts are at ledger " FMT_I64 " after the ledger db at " FMT_I64 "\n", account_seq, ledger_seq);
+			return 1;
+		}
+
+		//as a restarting node does
+		if (account_seq < ledger_seq && !LedgerManager::RollbackLedgers(ledger_db, account_seq, ledger_seq)) {
+			printf("roll back the ledger db from " FMT_I64 " to " FMT_I64 " failed\n", ledger_seq, account_seq);
+			return 2;
+		}
+		if (CrashTestSeq(ledger_db) != account_seq) {
+			printf("the ledger db is at ledger " FMT_I64 " after the rollback to " FMT_I64 "\n", CrashTestSeq(ledger_db), account_seq);
+			return 1;
+		}
+
+		std::string value;
+		for (int64_t seq = 1; seq <= account_seq; seq++) {
+			if (ledger_db->Get(ComposePrefix(General::LEDGER_PREFIX, seq), value) <= 0 ||
+				ledger_db->Get(ComposePrefix(General::TRANSACTION_PREFIX, CrashTestTx(seq)), value) <= 0) {
+				printf("ledger " FMT_I64 " is missing below the accounts at ledger " FMT_I64 "\n", seq, account_seq);
+				return 1;
+			}
+		}
+
+		//one past the ledger db before the rollback, a group is written at once
+		for (int64_t seq = account_seq + 1; seq <= ledger_seq + 1; seq++) {
+			if (ledger_db->Get(ComposePrefix(General::LEDGER_PREFIX, seq), value) != 0 ||
+				ledger_db->Get(ComposePrefix(General::CONSENSUS_VALUE_PREFIX, seq), value) != 0 ||
+				ledger_db->Get(ComposePrefix(General::LEDGER_TRANSACTION_PREFIX, seq), value) != 0 ||
+				ledger_db->Get(ComposePrefix(General::TRANSACTION_PREFIX, CrashTestTx(seq)), value) != 0) {
+				printf("ledger " FMT_I64 " is left above the accounts at ledger " FMT_I64 "\n", seq, account_seq);
+				return 1;
+			}
+		}
+
+		protocol::EntryList last_hashs;
+		int32_t ret = ledger_db->Get(General::LAST_TX_HASHS, value);
+		if (account_seq > 0 ? (ret <= 0 || !last_hashs.ParseFromString(value) || last_hashs.entry_size() == 0 ||
+			last_hashs.entry(0) != CrashTestTx(account_seq)) : ret != 0) {
+			printf("the last tx hashes are not the ones of ledger " FMT_I64 "\n", account_seq);
+			return 1;
+		}
+
+		for (int64_t i = 0; i < CRASH_TEST_ACCOUNTS; i++) {
+			//written last by the highest seq up to account_seq with that remainder
+			int64_t expect = account_seq - ((account_seq - i) % CRASH_TEST_ACCOUNTS + CRASH_TEST_ACCOUNTS) % CRASH_TEST_ACCOUNTS;
+			std::string asset;
+			ret = account_db->Get(CrashTestAccount(i), value);
+			int32_t asset_ret = account_db->Get(CrashTestAsset(i), asset);
+			if (expect > 0 ? (ret <= 0 || utils::String::Stoi64(value) != expect || asset_ret <= 0 || asset != value) :
+				(ret != 0 || asset_ret != 0)) {
+				printf("account " FMT_I64 " is not the one of ledger " FMT_I64 "\n", i, account_seq);
+				return 1;
+			}
+		}
+
+		storage.Exit();
+		return 0;
+	}
+
+	void LedgerPersister::CrashTest(int32_t rounds) {
+#ifdef WIN32
+		printf("the crash test needs fork\n");
+#else
+		std::string path = utils::String::Format("%s/crash_test", utils::File::GetBinHome().c_str());
+		if (utils::File::IsExist(path) && !utils::File::DeleteFolder(path)) {
+			printf("delete %s failed\n", path.c_str());
+			return;
+		}
+		utils::File::CreateDir(path);
+
+		//flat dbs and dbs with a column family per keyspace take turns, each in a folder of its own
+		DbConfigure configs[2];
+		int64_t last_seqs[2] = { 0, 0 };
+		for (int32_t i = 0; i < 2; i++) {
+			std::string layout = utils::String::Format("%s/%s", path.c_str(), i == 0 ? "flat" : "families");
+			utils::File::CreateDir(layout);
+			configs[i].keyvalue_db_path_ = layout + "/keyvalue.db";
+			configs[i].ledger_db_path_ = layout + "/ledger.db";
+			configs[i].account_db_path_ = layout + "/account.db";
+			configs[i].column_families_ = i == 1;
+			configs[i].group_sync_interval_ = 20;
+		}
+
+		srand((uint32_t)time(NULL));
+		int32_t failed = 0;
+		for (int32_t round = 0; round < rounds; round++) {
+			DbConfigure &db_config = configs[round % 2];
+			int64_t &last_seq = last_seqs[round % 2];
+			const char *durability = CRASH_TEST_DURABILITY[round % (sizeof(CRASH_TEST_DURABILITY) / sizeof(CRASH_TEST_DURABILITY[0]))];
+			db_config.keyvalue_durability_ = durability;
+			db_config.ledger_durability_ = durability;
+			db_config.account_durability_ = durability;
+
+			pid_t writer = fork();
+			if (writer == 0) {
+				CrashWrite(db_config);
+				_exit(2);
+			}
+			utils::Sleep(50 + rand() % 500);
+			kill(writer, SIGKILL);
+			waitpid(writer, NULL, 0);
+
+			//checked in a process of its own, as a restarted node would
+			int fds[2];
+			if (pipe(fds) != 0) {
+				printf("create pipe failed\n");
+				return;
+			}
+			pid_t checker = fork();
+			if (checker == 0) {
+				close(fds[0]);
+				int64_t seq = 0;
+				int32_t ret = CrashCheck(db_config, seq);
+				if (write(fds[1], &seq, sizeof(seq)) != sizeof(seq)) {
+					ret = 2;
+				}
+				_exit(ret);
+			}
+			close(fds[1]);
+			int64_t seq = 0;
+			if (read(fds[0], &seq, sizeof(seq)) != sizeof(seq)) {
+				seq = -1;
+			}
+			close(fds[0]);
+			int status = 0;
+			waitpid(checker, &status, 0);
+
+			bool ok = WIFEXITED(status) && WEXITSTATUS(status) == 0;
+			if (ok && seq < last_seq) {
+				printf("round %d: the ledger went back from " FMT_I64 " to " FMT_I64 "\n", round, last_seq, seq);
+				ok = false;
+			}
+			if (!ok) {
+				printf("round %d failed with %s durability%s\n", round, durability, db_config.column_families_ ? " and column families" : "");
+				failed++;
+				continue;
+			}
+			last_seq = seq;
+		}
+
+		Json::Value result;
+		result["rounds"] = rounds;
+		result["failed"] = failed;
+		result["ledger_seq"] = last_seqs[0];
+		result["families_ledger_seq"] = last_seqs[1];
+		printf("%s\n", result.toStyledString().c_str());
+		//the dbs of a failure are kept to look into
+		if (failed == 0) {
+			utils::File::DeleteFolder(path);
+		}
+#endif
+	}
+}
@@ -0,0 +1,117 @@
+/*
+	phantom is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	phantom is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with phantom.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef LEDGER_PERSISTER_H_
+#define LEDGER_PERSISTER_H_
+
+#include <atomic>
+#include <functional>
+#include <utils/thread.h>
+#include <common/storage.h>
+
+namespace phantom {
+
+	//Persistence stage of closed ledgers. The ledger and account db of Storage are wrapped so that
+	//reads see the batches of ledgers that are not on disk yet. If pipelined, the batches are written
+	//on a dedicated thread while the ledger thread goes on with the next ledger. At most one write
+	//is in flight: Persist waits until the previous one is durable, so the proof of a ledger never
+	//reaches disk before its parent, and consensus waits for it before voting on the next value.
+	//Ledgers replayed during catch-up are gathered into groups, written as one batch per db
+	class LedgerPersister : public utils::Runnable {
+	public:
+		LedgerPersister();
+		~LedgerPersister();
+
+		//wrap the ledger and account db of Storage, must be called before they are used.
+		//group_unsynced writes groups without syncing the log and flushes the dbs after each group.
+		//on_durable gets the last seq of each write once it is in the dbs, on the writing thread
+		bool Initialize(bool pipeline, uint32_t group_size, bool group_unsynced, std::function<void(int64_t)> on_durable);
+		//write everything queued and stop the thread
+		bool Exit();
+
+		//write the batches of ledger seq, a catch_up ledger may wait in the open group
+		void Persist(int64_t seq, std::shared_ptr<WRITE_BATCH> ledger_batch, std::shared_ptr<WRITE_BATCH> account_batch, bool catch_up);
+		//write the open group now
+		void FlushGroup();
+		//durability barrier, returns when every queued write is on disk
+		void Wait();
+
+		//when the open group got its first ledger, 0 if there is no open group
+		int64_t group_begin_time() const { return group_begin_time_; }
+		//time spent by the last ledger thread wait and by the last write, in microseconds
+		int64_t last_wait_time() const { return last_wait_time_; }
+		int64_t last_write_time() const { return last_write_time_; }
+		void GetModuleStatus(Json::Value &data);
+
+		virtual void Run(utils::Thread *thread) override;
+
+		//kill a process writing ledgers through the persister at random points, rounds times, with each
+		//durability in turn, on flat dbs and on dbs with column families. After each kill the ledger db is rolled back as on a restart, then it must
+		//hold the ledgers up to the one of the accounts and none above, and the accounts of that ledger
+		static void CrashTest(int32_t rounds);
+
+	private:
+		class PendingDb;
+		struct Job {
+			Job() :seq_(0), ledger_count_(0), unsynced_(false) {}
+			int64_t seq_;
+			int64_t ledger_count_;
+			bool unsynced_;
+			std::shared_ptr<WRITE_BATCH> ledger_batch_;
+			std::shared_ptr<WRITE_BATCH> account_batch_;
+		};
+
+		//write now or hand to the thread, pending tells whether reads already see the batches
+		void Submit(const Job &job, bool pending);
+		void Write(const Job &job);
+
+		//the processes of the crash test, the writer never returns
+		static void CrashWrite(const DbConfigure &db_config);
+		//0 if the dbs are consistent, account_seq gets the ledger of the accounts
+		static int32_t CrashCheck(const DbConfigure &db_config, int64_t &account_seq);
+
+		utils::Thread *thread_;
+		volatile bool enabled_;
+		PendingDb *ledger_db_;
+		PendingDb *account_db_;
+
+		//one free slot while nothing is being written
+		utils::Semaphore slot_;
+		utils::Semaphore work_;
+		//the write in flight
+		Job job_;
+
+		//catch-up ledgers not written yet, on the ledger thread only
+		uint32_t group_size_;
+		bool group_unsynced_;
+		std::function<void(int64_t)> on_durable_;
+		Job group_;
+		int64_t group_begin_time_;
+
+		std::atomic<int64_t> persisted_seq_;
+		std::atomic<int64_t> persist_count_;
+		std::atomic<int64_t> write_count_;
+		std::atomic<int64_t> group_count_;
+		std::atomic<int64_t> last_wait_time_;
+		std::atomic<int64_t> last_write_time_;
+		std::atomic<int64_t> last_ledger_write_time_;
+		std::atomic<int64_t> last_account_write_time_;
+		std::atomic<int64_t> last_flush_time_;
+		std::atomic<int64_t> total_wait_time_;
+		std::atomic<int64_t> total_write_time_;
+	};
+}
+
+#endif
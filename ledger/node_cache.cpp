@@ -0,0 +1,98 @@
+/*
+	phantom is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	phantom is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with phantom.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "node_cache.h"
+
+namespace phantom{
+
+	NodeCache::NodeCache(size_t capacity)
+		:capacity_(capacity), usage_(0), hit_count_(0), miss_count_(0), evict_count_(0){
+	}
+
+	NodeCache::~NodeCache(){
+	}
+
+	bool NodeCache::Get(const std::string& location, protocol::Node& info){
+		utils::MutexGuard guard(mutex_);
+		auto it = index_.find(location);
+		if (it == index_.end()){
+			miss_count_++;
+			return false;
+		}
+
+		hit_count_++;
+		lru_.splice(lru_.begin(), lru_, it->second);
+		info.CopyFrom(it->second->info_);
+		return true;
+	}
+
+	void NodeCache::Put(const std::string& location, const protocol::Node& info){
+		//decoded node: the entry, the location in list and map, 17 children and their strings
+		size_t charge = sizeof(Entry) + location.size() * 2 + 17 * sizeof(protocol::Child) + info.ByteSize();
+		if (charge > capacity_){
+			return;
+		}
+
+		utils::MutexGuard guard(mutex_);
+		auto it = index_.find(location);
+		if (it != index_.end()){
+			EraseEntry(it->second);
+		}
+
+		lru_.push_front(Entry());
+		Entry &entry = lru_.front();
+		entry.location_ = location;
+		entry.info_.CopyFrom(info);
+		entry.charge_ = charge;
+		index_[location] = lru_.begin();
+		usage_ += charge;
+
+		while (usage_ > capacity_ && !lru_.empty()){
+			EraseEntry(--lru_.end());
+			evict_count_++;
+		}
+	}
+
+	void NodeCache::Erase(const std::string& location){
+		utils::MutexGuard guard(mutex_);
+		auto it = index_.find(location);
+		if (it != index_.end()){
+			EraseEntry(it->second);
+		}
+	}
+
+	void NodeCache::Clear(){
+		utils::MutexGuard guard(mutex_);
+		index_.clear();
+		lru_.clear();
+		usage_ = 0;
+	}
+
+	size_t NodeCache::usage(){
+		utils::MutexGuard guard(mutex_);
+		return usage_;
+	}
+
+	size_t NodeCache::size(){
+		utils::MutexGuard guard(mutex_);
+		return index_.size();
+	}
+
+	void NodeCache::EraseEntry(EntryList::iterator it){
+		usage_ -= it->charge_;
+		index_.erase(it->location_);
+		lru_.erase(it);
+	}
+}
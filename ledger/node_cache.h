@@ -0,0 +1,67 @@
+/*
+	phantom is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	phantom is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with phantom.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef NODE_CACHE_H_
+#define NODE_CACHE_H_
+
+#include <atomic>
+#include <list>
+#include <unordered_map>
+#include <utils/thread.h>
+#include "proto/cpp/merkeltrie.pb.h"
+
+namespace phantom{
+
+	//LRU cache of clean trie nodes keyed by location, bounded by an estimate of the decoded size.
+	//It lives longer than the NodeFrm tree, which is released after every ledger
+	class NodeCache{
+		struct Entry{
+			std::string location_;
+			protocol::Node info_;
+			size_t charge_;
+		};
+		typedef std::list<Entry> EntryList;
+
+		EntryList lru_; //most recently used first
+		std::unordered_map<std::string, EntryList::iterator> index_;
+		size_t capacity_;
+		size_t usage_;
+
+		//changed under the mutex, read by the status without it
+		std::atomic<int64_t> hit_count_;
+		std::atomic<int64_t> miss_count_;
+		std::atomic<int64_t> evict_count_;
+		utils::Mutex mutex_;
+
+		void EraseEntry(EntryList::iterator it);
+	public:
+		NodeCache(size_t capacity);
+		~NodeCache();
+
+		bool Get(const std::string& location, protocol::Node& info);
+		void Put(const std::string& location, const protocol::Node& info);
+		void Erase(const std::string& location);
+		void Clear();
+
+		size_t capacity() const{ return capacity_; }
+		size_t usage();
+		size_t size();
+		int64_t hit_count() const{ return hit_count_; }
+		int64_t miss_count() const{ return miss_count_; }
+		int64_t evict_count() const{ return evict_count_; }
+	};
+}
+
+#endif
@@ -0,0 +1,139 @@
+/*
+	phantom is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	phantom is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with phantom.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef NODE_POOL_H_
+#define NODE_POOL_H_
+
+#include <vector>
+#include <utils/thread.h>
+
+namespace phantom{
+
+	//blocks of one pool, read by the trie bench
+	struct PoolUsage{
+		size_t block_size_;
+		size_t used_;
+		size_t reserved_;
+	};
+
+	//the usage of every pool created so far
+	inline std::vector<const PoolUsage *> &PoolUsages(){
+		static std::vector<const PoolUsage *> *usages = new std::vector<const PoolUsage *>();
+		return *usages;
+	}
+
+	//Free list of fixed size blocks carved from large chunks. Trie nodes are created and released
+	//every ledger, reusing their blocks avoids the general allocator. Chunks are never returned,
+	//and the pool is never destroyed so that nodes released during exit stay valid
+	template<size_t SIZE>
+	class FixedPool{
+		union Block{
+			Block *next_;
+			char data_[SIZE];
+		};
+		static const size_t CHUNK_BLOCKS = 4096;
+
+		utils::SpinLock lock_;
+		Block *free_;
+		std::vector<Block *> chunks_;
+		size_t used_;
+		PoolUsage usage_;
+
+		FixedPool() :free_(NULL), used_(0){
+			usage_.block_size_ = sizeof(Block);
+			usage_.used_ = 0;
+			usage_.reserved_ = 0;
+		}
+	public:
+		static FixedPool &Instance(){
+			static FixedPool *pool = Register(new FixedPool());
+			return *pool;
+		}
+
+		static FixedPool *Register(FixedPool *pool){
+			static utils::Mutex mutex;
+			utils::MutexGuard guard(mutex);
+			PoolUsages().push_back(&pool->usage_);
+			return pool;
+		}
+
+		void *Alloc(){
+			lock_.Lock();
+			if (free_ == NULL){
+				Block *chunk = static_cast<Block *>(::operator new(sizeof(Block) * CHUNK_BLOCKS));
+				chunks_.push_back(chunk);
+				for (size_t i = 0; i < CHUNK_BLOCKS; i++){
+					chunk[i].next_ = free_;
+					free_ = &chunk[i];
+				}
+			}
+			Block *block = free_;
+			free_ = block->next_;
+			used_++;
+			usage_.used_ = used_;
+			usage_.reserved_ = chunks_.size() * CHUNK_BLOCKS;
+			lock_.Unlock();
+			return block;
+		}
+
+		void Free(void *p){
+			Block *block = static_cast<Block *>(p);
+			lock_.Lock();
+			block->next_ = free_;
+			free_ = block;
+			used_--;
+			usage_.used_ = used_;
+			lock_.Unlock();
+		}
+
+		size_t used() const{ return used_; }
+		size_t reserved() const{ return chunks_.size() * CHUNK_BLOCKS; }
+		static size_t block_size(){ return sizeof(Block); }
+	};
+
+	//allocator for std::allocate_shared, the node and its control block share one pooled block
+	template<typename T>
+	class PoolAllocator{
+	public:
+		typedef T value_type;
+
+		PoolAllocator(){}
+		template<typename U>
+		PoolAllocator(const PoolAllocator<U> &){}
+
+		T *allocate(size_t n){
+			if (n != 1){
+				return static_cast<T *>(::operator new(n * sizeof(T)));
+			}
+			return static_cast<T *>(FixedPool<sizeof(T)>::Instance().Alloc());
+		}
+
+		void deallocate(T *p, size_t n){
+			if (n != 1){
+				::operator delete(p);
+				return;
+			}
+			FixedPool<sizeof(T)>::Instance().Free(p);
+		}
+	};
+
+	template<typename T, typename U>
+	bool operator==(const PoolAllocator<T> &, const PoolAllocator<U> &){ return true; }
+
+	template<typename T, typename U>
+	bool operator!=(const PoolAllocator<T> &, const PoolAllocator<U> &){ return false; }
+}
+
+#endif
@@ -0,0 +1,202 @@
+/*
+	phantom is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	phantom is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with phantom.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "ledgercontext_manager.h"
+#include "parallel_executor.h"
+
+namespace phantom {
+
+	std::atomic<int64_t> ParallelExecutor::speculate_count_(0);
+	std::atomic<int64_t> ParallelExecutor::adopt_count_(0);
+	std::atomic<int64_t> ParallelExecutor::conflict_count_(0);
+	std::atomic<int64_t> ParallelExecutor::serial_count_(0);
+
+	class ParallelExecutor::Task : public utils::Runnable {
+	public:
+		Task(const protocol::TransactionEnv &txproto, std::shared_ptr<protocol::ConsensusValue> value, bool check_expire, utils::Semaphore *done)
+			:txproto_(txproto), check_expire_(check_expire), done_(done), valid_(false), fee_(0),
+			context_(std::string(), protocol::ConsensusValue()) {
+			context_.closing_ledger_->lpledger_context_ = &context_;
+			context_.closing_ledger_->value_ = value;
+		}
+
+		virtual void Run(utils::Thread *this_thread) override {
+			valid_ = Execute();
+			done_->Signal();
+		}
+
+		//the accounts the tx may read or write, false if it may run a contract
+		bool CollectAccounts(std::vector<std::string> &dests) {
+			const protocol::Transaction &tran = txproto_.transaction();
+			accounts_.insert(tran.source_address());
+			for (int32_t i = 0; i < tran.operations_size(); i++) {
+				const protocol::Operation &ope = tran.operations(i);
+				if (!ope.source_address().empty()) {
+					accounts_.insert(ope.source_address());
+				}
+
+				switch (ope.type()) {
+				case protocol::Operation_Type_CREATE_ACCOUNT:
+					if (!ope.create_account().contract().payload().empty()) {
+						return false;
+					}
+					accounts_.insert(ope.create_account().dest_address());
+					break;
+				case protocol::Operation_Type_PAYMENT:
+					accounts_.insert(ope.payment().dest_address());
+					dests.push_back(ope.payment().dest_address());
+					break;
+				case protocol::Operation_Type_PAY_COIN:
+					accounts_.insert(ope.pay_coin().dest_address());
+					dests.push_back(ope.pay_coin().dest_address());
+					break;
+				case protocol::Operation_Type_ISSUE_ASSET:
+				case protocol::Operation_Type_SET_METADATA:
+				case protocol::Operation_Type_SET_SIGNER_WEIGHT:
+				case protocol::Operation_Type_SET_THRESHOLD:
+				case protocol::Operation_Type_LOG:
+					break;
+				default:
+					return false;
+				}
+			}
+			return true;
+		}
+
+		//the same steps as the serial loop of LedgerFrm, against a fresh environment
+		bool Execute() {
+			std::vector<std::string> dests;
+			if (!CollectAccounts(dests)) {
+				return false;
+			}
+
+			//a contract on a destination would run on this thread, leave it to the ledger thread.
+			//read around the environment, so that it loads accounts in the same order as the serial loop
+			for (size_t i = 0; i < dests.size(); i++) {
+				AccountFrm::pointer account;
+				if (Environment::AccountFromDB(dests[i], account) && !account->GetProtoAccount().contract().payload().empty()) {
+					return false;
+				}
+			}
+
+			TransactionFrm::pointer tx = std::make_shared<TransactionFrm>(txproto_);
+			environment_ = std::make_shared<Environment>(nullptr);
+			if (!environment_->useAtomMap_) {
+				return false;
+			}
+
+			//a dropped tx is decided in order, together with the drop bookkeeping
+			if (!tx->ValidForApply(environment_, true) || !tx->PayFee(environment_, fee_)) {
+				return false;
+			}
+
+			LedgerFrm *shadow = context_.closing_ledger_.get();
+			context_.transaction_stack_.push_back(tx);
+			tx->NonceIncrease(shadow, environment_);
+			environment_->Commit();
+
+			if (check_expire_) {
+				tx->EnableChecked();
+				tx->SetMaxEndTime(utils::Timestamp::HighResolution() + General::TX_EXECUTE_TIME_OUT);
+			}
+			speculation_.ret_ = tx->Apply(shadow, environment_);
+			speculation_.expire_ = check_expire_ && tx->IsExpire(speculation_.error_info_);
+			if (!speculation_.expire_ && speculation_.ret_) {
+				tx->ReturnFee(fee_);
+				tx->environment_->Commit();
+			}
+			environment_->ClearChangeBuf();
+			context_.transaction_stack_.pop_back();
+			speculation_.tx_ = tx;
+
+			//every account touched must have been predicted, or the conflict check is not sound
+			const Environment::mapKV &data = environment_->GetData();
+			for (auto iter = data.begin(); iter != data.end(); iter++) {
+				if (accounts_.find(iter->first) == accounts_.end()) {
+					LOG_ERROR("Transaction(%s) touched unexpected account(%s) in speculation",
+						utils::String::BinToHexString(tx->GetContentHash()).c_str(), iter->first.c_str());
+					return false;
+				}
+			}
+			return true;
+		}
+
+		protocol::TransactionEnv txproto_;
+		bool check_expire_;
+		utils::Semaphore *done_;
+
+		bool valid_;
+		int64_t fee_;
+		std::set<std::string> accounts_;
+		std::shared_ptr<Environment> environment_;
+		Speculation speculation_;
+		LedgerContext context_;
+	};
+
+	ParallelExecutor::ParallelExecutor(LedgerFrm *ledger) :ledger_(ledger) {}
+
+	ParallelExecutor::~ParallelExecutor() {}
+
+	void ParallelExecutor::Speculate(utils::ThreadPool *pool, const protocol::ConsensusValue &value, const std::set<int32_t> &skip, bool check_expire) {
+		utils::Semaphore done;
+		size_t count = 0;
+		tasks_.resize(value.txset().txs_size());
+		for (int32_t i = 0; i < value.txset().txs_size(); i++) {
+			if (skip.find(i) != skip.end()) {
+				continue;
+			}
+
+			tasks_[i] = std::make_shared<Task>(value.txset().txs(i), ledger_->value_, check_expire, &done);
+			pool->AddTask(tasks_[i].get());
+			count++;
+		}
+
+		for (size_t i = 0; i < count; i++) {
+			done.Wait();
+		}
+	}
+
+	bool ParallelExecutor::Adopt(int32_t index, std::shared_ptr<Environment> environment, int64_t &total_fee, Speculation &speculation) {
+		Task *task = (size_t)index < tasks_.size() ? tasks_[index].get() : NULL;
+		if (task == NULL || !task->valid_) {
+			serial_count_++;
+			return false;
+		}
+		speculate_count_++;
+
+		//anything an earlier tx loaded may differ from the last closed state
+		const Environment::mapKV &data = environment->GetData();
+		Environment::mapKV &action = environment->GetActionBuf();
+		for (auto iter = task->accounts_.begin(); iter != task->accounts_.end(); iter++) {
+			if (data.find(*iter) != data.end() || action.find(*iter) != action.end()) {
+				conflict_count_++;
+				return false;
+			}
+		}
+
+		const Environment::mapKV &result = task->environment_->GetData();
+		for (auto iter = result.begin(); iter != result.end(); iter++) {
+			action[iter->first] = iter->second;
+		}
+		environment->Commit();
+
+		speculation = task->speculation_;
+		speculation.tx_->ledger_ = ledger_;
+		speculation.tx_->environment_ = environment;
+		total_fee += task->fee_;
+		adopt_count_++;
+		return true;
+	}
+}
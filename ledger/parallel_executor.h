@@ -0,0 +1,63 @@
+/*
+	phantom is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	phantom is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with phantom.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef PARALLEL_EXECUTOR_H_
+#define PARALLEL_EXECUTOR_H_
+
+#include <atomic>
+#include <utils/thread.h>
+#include "transaction_frm.h"
+
+namespace phantom {
+
+	class LedgerFrm;
+
+	//Optimistic executor for the txset of one ledger. Every transaction is first executed on the
+	//pool against the last closed state, each with its own Environment. The ledger then walks the
+	//txset in order and adopts a speculative result only when no earlier transaction touched any
+	//account it may access, otherwise the transaction is executed again in order, so the result
+	//is always the same as serial execution. Transactions that can run contracts are not speculated
+	class ParallelExecutor {
+	public:
+		struct Speculation {
+			Speculation() :ret_(false), expire_(false) {}
+			TransactionFrm::pointer tx_;
+			bool ret_;
+			bool expire_;
+			std::string error_info_;
+		};
+
+		ParallelExecutor(LedgerFrm *ledger);
+		~ParallelExecutor();
+
+		//speculate the txs of value, except the indexes in skip. check_expire as ApplyPropose and ApplyCheck do
+		void Speculate(utils::ThreadPool *pool, const protocol::ConsensusValue &value, const std::set<int32_t> &skip, bool check_expire);
+
+		//merge the result of tx index into environment if it does not conflict with what is already there
+		bool Adopt(int32_t index, std::shared_ptr<Environment> environment, int64_t &total_fee, Speculation &speculation);
+
+		static std::atomic<int64_t> speculate_count_; //txs executed speculatively
+		static std::atomic<int64_t> adopt_count_; //speculative results used as they are
+		static std::atomic<int64_t> conflict_count_; //speculative results dropped because of an earlier tx, executed again
+		static std::atomic<int64_t> serial_count_; //txs that could not be speculated, executed in order only
+
+	private:
+		class Task;
+		LedgerFrm *ledger_;
+		std::vector<std::shared_ptr<Task>> tasks_;
+	};
+}
+
+#endif
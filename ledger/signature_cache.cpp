@@ -0,0 +1,98 @@
+/*
+	phantom is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	phantom is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with phantom.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <common/general.h>
+#include <common/private_key.h>
+#include "signature_cache.h"
+
+namespace phantom{
+
+	SignatureCache::SignatureCache() :shard_capacity_(0), hit_count_(0), miss_count_(0){}
+
+	SignatureCache::~SignatureCache(){}
+
+	void SignatureCache::Initialize(size_t capacity){
+		shard_capacity_ = (capacity + SHARD_COUNT - 1) / SHARD_COUNT;
+	}
+
+	std::string SignatureCache::MakeKey(const std::string &content_hash, const std::string &sign_data, const std::string &public_key){
+		return HashWrapper::Crypto(content_hash + sign_data + public_key);
+	}
+
+	SignatureCache::Shard &SignatureCache::GetShard(const std::string &key){
+		return shards_[(uint8_t)key[0] % SHARD_COUNT];
+	}
+
+	bool SignatureCache::Get(const std::string &content_hash, const std::string &sign_data, const std::string &public_key){
+		if (shard_capacity_ == 0){
+			return false;
+		}
+
+		std::string key = MakeKey(content_hash, sign_data, public_key);
+		Shard &shard = GetShard(key);
+		utils::MutexGuard guard(shard.mutex_);
+		auto it = shard.index_.find(key);
+		if (it == shard.index_.end()){
+			miss_count_++;
+			return false;
+		}
+
+		hit_count_++;
+		shard.lru_.splice(shard.lru_.begin(), shard.lru_, it->second);
+		return true;
+	}
+
+	void SignatureCache::Put(const std::string &content_hash, const std::string &sign_data, const std::string &public_key){
+		if (shard_capacity_ == 0){
+			return;
+		}
+
+		std::string key = MakeKey(content_hash, sign_data, public_key);
+		Shard &shard = GetShard(key);
+		utils::MutexGuard guard(shard.mutex_);
+		if (shard.index_.find(key) != shard.index_.end()){
+			return;
+		}
+
+		shard.lru_.push_front(key);
+		shard.index_[key] = shard.lru_.begin();
+		while (shard.lru_.size() > shard_capacity_){
+			shard.index_.erase(shard.lru_.back());
+			shard.lru_.pop_back();
+		}
+	}
+
+	bool SignatureCache::Verify(const std::string &content_hash, const std::string &data, const std::string &sign_data, const std::string &public_key){
+		if (Get(content_hash, sign_data, public_key)){
+			return true;
+		}
+
+		if (!PublicKey::Verify(data, sign_data, public_key)){
+			return false;
+		}
+
+		Put(content_hash, sign_data, public_key);
+		return true;
+	}
+
+	size_t SignatureCache::size(){
+		size_t count = 0;
+		for (size_t i = 0; i < SHARD_COUNT; i++){
+			utils::MutexGuard guard(shards_[i].mutex_);
+			count += shards_[i].lru_.size();
+		}
+		return count;
+	}
+}
@@ -0,0 +1,68 @@
+/*
+	phantom is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	phantom is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with phantom.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef SIGNATURE_CACHE_H_
+#define SIGNATURE_CACHE_H_
+
+#include <atomic>
+#include <list>
+#include <unordered_map>
+#include <utils/singleton.h>
+#include <utils/thread.h>
+
+namespace phantom{
+
+	//Signatures that passed PublicKey::Verify, keyed by (content hash, public key, signature).
+	//A transaction admitted to the pool is not verified again when it is proposed and applied.
+	//Only exact results are put here, never the ones of a passed batch
+	class SignatureCache : public utils::Singleton<SignatureCache>{
+		friend class utils::Singleton<SignatureCache>;
+
+		static const size_t SHARD_COUNT = 16;
+		struct Shard{
+			std::list<std::string> lru_; //most recently used first
+			std::unordered_map<std::string, std::list<std::string>::iterator> index_;
+			utils::Mutex mutex_;
+		};
+
+		Shard shards_[SHARD_COUNT];
+		size_t shard_capacity_;
+
+		std::atomic<int64_t> hit_count_;
+		std::atomic<int64_t> miss_count_;
+
+		SignatureCache();
+		~SignatureCache();
+
+		static std::string MakeKey(const std::string &content_hash, const std::string &sign_data, const std::string &public_key);
+		Shard &GetShard(const std::string &key);
+	public:
+		//count of signatures kept, 0 to disable
+		void Initialize(size_t capacity);
+
+		bool Get(const std::string &content_hash, const std::string &sign_data, const std::string &public_key);
+		void Put(const std::string &content_hash, const std::string &sign_data, const std::string &public_key);
+
+		//Get, or PublicKey::Verify and Put if valid
+		bool Verify(const std::string &content_hash, const std::string &data, const std::string &sign_data, const std::string &public_key);
+
+		size_t capacity() const{ return shard_capacity_ * SHARD_COUNT; }
+		size_t size();
+		int64_t hit_count() const{ return hit_count_; }
+		int64_t miss_count() const{ return miss_count_; }
+	};
+}
+
+#endif
@@ -0,0 +1,592 @@
+/*
+	phantom is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	phantom is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with phantom.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <utils/logger.h>
+#include <common/private_key.h>
+#include <overlay/peer_manager.h>
+#include <glue/glue_manager.h>
+#include "ledger_manager.h"
+#include "state_sync.h"
+
+//rows asked from a peer at a time, and the most bytes of rows it replies with
+#define STATE_SYNC_ROWS_PER_REQUEST 512
+#define STATE_SYNC_REPLY_BYTES (4 * utils::BYTES_PER_MEGA)
+//verified rows kept in memory before they are staged in the account db
+#define STATE_SYNC_STAGE_BYTES (16 * utils::BYTES_PER_MEGA)
+//newest checkpoints always pinned, and the most pinned while older ones are in use
+#define STATE_SYNC_CHECKPOINTS 2
+#define STATE_SYNC_MAX_PINNED 4
+#define STATE_SYNC_PIN_TIME (300 * utils::MICRO_UNITS_PER_SEC)
+#define STATE_SYNC_TIMEOUT (30 * utils::MICRO_UNITS_PER_SEC)
+#define STATE_SYNC_PROBATION (60 * utils::MICRO_UNITS_PER_SEC)
+#define STATE_SYNC_RETRY (5 * utils::MICRO_UNITS_PER_SEC)
+//no row received for this long, the sync is given up and replay goes on
+#define STATE_SYNC_STALL (300 * utils::MICRO_UNITS_PER_SEC)
+
+namespace phantom {
+
+	StateSync::StateSync() :served_rows_(0), active_(false), seq_(0), staged_bytes_(0), row_count_(0), account_count_(0), byte_count_(0),
+		begin_time_(0), update_time_(0), last_timer_(0), sync_count_(0) {}
+
+	StateSync::~StateSync() {}
+
+	std::string StateSync::Row::Key() const {
+		if (!leaf_) {
+			return prefix_ + location_;
+		}
+		std::string key = prefix_;
+		key.push_back(Trie::LEAF_PREFIX);
+		return key + location_.substr(1);
+	}
+
+	void StateSync::OnLedgerView(const std::shared_ptr<const LedgerView> &view) {
+		uint32_t interval = Configure::Instance().ledger_configure_.state_sync_interval_;
+		if (interval == 0 || view == nullptr) {
+			return;
+		}
+
+		int64_t seq = view->header_.seq();
+		int64_t current_time = utils::Timestamp::HighResolution();
+		utils::MutexGuard guard(pinned_mutex_);
+		//the first view at or after each multiple of interval, groups of catch-up publish their last ledger only
+		int64_t last_seq = pinned_.empty() ? 0 : pinned_.rbegin()->first;
+		if (seq / interval <= last_seq / interval) {
+			return;
+		}
+		Pinned &pinned = pinned_[seq];
+		pinned.view_ = view;
+		pinned.use_time_ = current_time;
+
+		size_t index = 0;
+		for (auto iter = pinned_.begin(); iter != pinned_.end(); index++) {
+			bool newest = index + STATE_SYNC_CHECKPOINTS >= pinned_.size();
+			if (!newest && (pinned_.size() > STATE_SYNC_MAX_PINNED || current_time - iter->second.use_time_ > STATE_SYNC_PIN_TIME)) {
+				iter = pinned_.erase(iter);
+			}
+			else {
+				iter++;
+			}
+		}
+	}
+
+	std::shared_ptr<const LedgerView> StateSync::FindView(int64_t seq, int64_t current_time) {
+		int64_t lcl_seq = LedgerManager::Instance().GetLastClosedLedger().seq();
+		utils::MutexGuard guard(pinned_mutex_);
+		auto iter = pinned_.end();
+		if (seq != 0) {
+			iter = pinned_.find(seq);
+		}
+		else {
+			//the proof of the next ledger is in the one after it
+			for (auto riter = pinned_.rbegin(); riter != pinned_.rend(); riter++) {
+				if (riter->first + 2 <= lcl_seq) {
+					iter = pinned_.find(riter->first);
+					break;
+				}
+			}
+		}
+
+		if (iter == pinned_.end()) {
+			return nullptr;
+		}
+		iter->second.use_time_ = current_time;
+		return iter->second.view_;
+	}
+
+	void StateSync::OnRequest(const protocol::GetAccountTree &message, int64_t peer_id) {
+		protocol::AccountTree reply;
+		std::shared_ptr<const LedgerView> view = FindView(message.ledger_seq(), utils::Timestamp::HighResolution());
+		if (view == nullptr) {
+			//no checkpoint is proven yet, or the one asked for is gone
+			reply.set_sync_code(message.ledger_seq() == 0 ? protocol::AccountTree::NOT_READY : protocol::AccountTree::NOT_PINNED);
+			reply.set_ledger_seq(message.ledger_seq());
+		}
+		else {
+			reply.set_ledger_seq(view->header_.seq());
+			if (message.keys_size() == 0) {
+				FillLedger(*view, reply);
+			}
+			else {
+				FillRows(*view, message, reply);
+			}
+		}
+
+		WsMessagePointer ws = std::make_shared<protocol::WsMessage>();
+		ws->set_data(reply.SerializeAsString());
+		ws->set_type(protocol::OVERLAY_MSGTYPE_ACCOUNT_TREE);
+		ws->set_request(false);
+		PeerManager::Instance().ConsensusNetwork().SendMsgToPeer(peer_id, ws);
+	}
+
+	void StateSync::FillLedger(const LedgerView &view, protocol::AccountTree &reply) {
+		int64_t seq = view.header_.seq();
+		KeyValueDb *ledger_db = view.ledger_db_;
+		std::string tx_list, value, next_value, after_next_value;
+		protocol::EntryList hashes;
+		protocol::ConsensusValue after_next;
+		protocol::FeeConfig fees;
+		//the ledgers after the view are closed already and never change
+		if (ledger_db->Get(ComposePrefix(General::LEDGER_TRANSACTION_PREFIX, seq), tx_list, view.ledger_snapshot_) < 0 ||
+			!hashes.ParseFromString(tx_list) ||
+			ledger_db->Get(ComposePrefix(General::CONSENSUS_VALUE_PREFIX, seq), value, view.ledger_snapshot_) <= 0 ||
+			ledger_db->Get(ComposePrefix(General::CONSENSUS_VALUE_PREFIX, seq + 1), next_value) <= 0 ||
+			ledger_db->Get(ComposePrefix(General::CONSENSUS_VALUE_PREFIX, seq + 2), after_next_value) <= 0 ||
+			!after_next.ParseFromString(after_next_value) ||
+			!LedgerManager::FeesConfigGet(view.header_.fees_hash(), fees)) {
+			LOG_ERROR("Load ledger(" FMT_I64 ") for state sync failed(%s)", seq, ledger_db->error_desc().c_str());
+			reply.set_sync_code(protocol::AccountTree::INTERNAL);
+			return;
+		}
+
+		std::vector<std::string> keys, txs;
+		std::vector<int32_t> statuses;
+		for (int32_t i = 0; i < hashes.entry_size(); i++) {
+			keys.push_back(ComposePrefix(General::TRANSACTION_PREFIX, hashes.entry(i)));
+		}
+		if (!ledger_db->MultiGet(keys, txs, statuses)) {
+			LOG_ERROR("Load transactions of ledger(" FMT_I64 ") failed(%s)", seq, ledger_db->error_desc().c_str());
+			reply.set_sync_code(protocol::AccountTree::INTERNAL);
+			return;
+		}
+
+		protocol::Ledger *ledger = reply.mutable_ledger();
+		*ledger->mutable_header() = view.header_;
+		for (size_t i = 0; i < txs.size(); i++) {
+			//the transactions triggered by contracts are stored with their hash, they are not in the ledger
+			protocol::TransactionEnvStore store;
+			if (statuses[i] <= 0 || !store.ParseFromString(txs[i])) {
+				LOG_ERROR("Load transactions of ledger(" FMT_I64 ") failed", seq);
+				reply.set_sync_code(protocol::AccountTree::INTERNAL);
+				return;
+			}
+			if (store.hash().empty()) {
+				*ledger->add_transaction_envs() = store.transaction_env();
+			}
+		}
+
+		reply.set_consensus_value(value);
+		reply.set_next_value(next_value);
+		reply.set_next_proof(after_next.previous_proof());
+		reply.set_fees(fees.SerializeAsString());
+	}
+
+	void StateSync::FillRows(const LedgerView &view, const protocol::GetAccountTree &message, protocol::AccountTree &reply) {
+		const std::string prefixes[3] = { General::ACCOUNT_PREFIX, ComposePrefix(General::ASSET_PREFIX, ""),
+			ComposePrefix(General::METADATA_PREFIX, "") };
+		int64_t bytes = 0;
+		for (int32_t i = 0; i < message.keys_size() && i < STATE_SYNC_ROWS_PER_REQUEST && bytes < STATE_SYNC_REPLY_BYTES; i++) {
+			const std::string &key = message.keys(i);
+			bool tree_key = false;
+			for (size_t j = 0; j < 3; j++) {
+				tree_key |= key.compare(0, prefixes[j].size(), prefixes[j]) == 0;
+			}
+
+			std::string value;
+			if (!tree_key || view.account_db_->Get(key, value, view.account_snapshot_) <= 0) {
+				LOG_ERROR("Row(%s) of ledger(" FMT_I64 ") asked by state sync is not in the account trees",
+					utils::String::BinToHexString(key).c_str(), view.header_.seq());
+				reply.set_sync_code(protocol::AccountTree::INTERNAL);
+				break;
+			}
+			bytes += value.size();
+			reply.add_values(value);
+		}
+		served_rows_ += reply.values_size();
+	}
+
+	void StateSync::Start(int64_t peer_id) {
+		if (active_) {
+			return;
+		}
+
+		std::vector<Request> requests;
+		do {
+			utils::MutexGuard guard(mutex_);
+			if (active_) {
+				return;
+			}
+			Reset();
+			active_ = true;
+			sync_count_++;
+			begin_time_ = update_time_ = utils::Timestamp::HighResolution();
+			peers_[peer_id];
+			Dispatch(begin_time_, requests);
+		} while (false);
+
+		LOG_INFO("Far behind the network, fetch the account state of a checkpoint ledger from peer(" FMT_I64 ")", peer_id);
+		Send(requests);
+	}
+
+	void StateSync::OnResponse(const protocol::AccountTree &message, int64_t peer_id) {
+		std::vector<Request> requests;
+		protocol::LedgerHeader header;
+		std::string consensus_value, proof, fees;
+		int64_t account_count = 0;
+		bool complete = false;
+
+		do {
+			utils::MutexGuard guard(mutex_);
+			auto iter = peers_.find(peer_id);
+			if (!active_ || iter == peers_.end() || iter->second.send_time_ == 0) {
+				LOG_ERROR("Received unexpected account tree of ledger(" FMT_I64 ") from peer(" FMT_I64 ")", message.ledger_seq(), peer_id);
+				return;
+			}
+
+			int64_t current_time = utils::Timestamp::HighResolution();
+			PeerStat &peer = iter->second;
+			std::vector<Row> asked;
+			asked.swap(peer.rows_);
+			peer.send_time_ = 0;
+
+			if (seq_ == 0) {
+				if (message.sync_code() == protocol::AccountTree::NOT_READY) {
+					peer.probation_ = current_time + STATE_SYNC_RETRY;
+				}
+				else if (message.sync_code() != protocol::AccountTree::OK || !VerifyLedger(message)) {
+					peer.probation_ = current_time + STATE_SYNC_PROBATION;
+				}
+				else {
+					Row root;
+					root.prefix_ = General::ACCOUNT_PREFIX;
+					root.location_ = Trie::Key2Location("");
+					root.hash_ = header_.account_tree_hash();
+					root.leaf_ = false;
+					root.account_ = true;
+					queue_.push_back(root);
+					update_time_ = current_time;
+					LOG_INFO("Fetch the account state of ledger(" FMT_I64 ")", seq_);
+				}
+			}
+			else {
+				int32_t count = message.ledger_seq() == seq_ ? std::min<int32_t>(message.values_size(), (int32_t)asked.size()) : 0;
+				int32_t verified = 0;
+				while (verified < count && VerifyRow(asked[verified], message.values(verified))) {
+					verified++;
+				}
+				if (verified < count || message.sync_code() != protocol::AccountTree::OK) {
+					LOG_ERROR("Peer(" FMT_I64 ") failed to serve the account tree of ledger(" FMT_I64 "), code(%d)",
+						peer_id, seq_, message.sync_code());
+					peer.probation_ = current_time + STATE_SYNC_PROBATION;
+				}
+				if (verified > 0) {
+					update_time_ = current_time;
+				}
+				peer.row_count_ += verified;
+				queue_.insert(queue_.begin(), asked.begin() + verified, asked.end());
+				if (staged_bytes_ >= STATE_SYNC_STAGE_BYTES && !Stage()) {
+					Reset();
+					return;
+				}
+			}
+
+			bool waiting = false;
+			for (auto piter = peers_.begin(); piter != peers_.end(); piter++) {
+				waiting |= piter->second.send_time_ != 0;
+			}
+			if (seq_ != 0 && queue_.empty() && !waiting) {
+				if (!Stage()) {
+					Reset();
+					return;
+				}
+				complete = true;
+				header = header_;
+				consensus_value.swap(consensus_value_);
+				proof.swap(proof_);
+				fees.swap(fees_);
+				account_count = account_count_;
+				LOG_INFO("Fetched the account state of ledger(" FMT_I64 "), " FMT_I64 " accounts and " FMT_I64 " rows in " FMT_I64 " ms",
+					seq_, account_count_, row_count_, (current_time - begin_time_) / utils::MICRO_UNITS_PER_MILLI);
+				break;
+			}
+			Dispatch(current_time, requests);
+		} while (false);
+
+		Send(requests);
+		if (complete) {
+			LedgerManager::Instance().InstallAccountState(header, consensus_value, proof, fees, account_count);
+			utils::MutexGuard guard(mutex_);
+			Reset();
+		}
+	}
+
+	bool StateSync::VerifyLedger(const protocol::AccountTree &message) {
+		const protocol::LedgerHeader &header = message.ledger().header();
+		protocol::ConsensusValue next;
+		if (!next.ParseFromString(message.next_value()) || next.ledger_seq() != header.seq() + 1 ||
+			next.previous_ledger_hash() != header.hash()) {
+			LOG_ERROR("The value of ledger(" FMT_I64 ") does not follow the ledger", header.seq() + 1);
+			return false;
+		}
+
+		//the header hash covers the transactions and the header without its hash
+		protocol::Ledger ledger = message.ledger();
+		ledger.mutable_header()->set_hash("");
+		if (HashWrapper::Crypto(ledger.SerializeAsString()) != header.hash() ||
+			HashWrapper::Crypto(message.consensus_value()) != header.consensus_value_hash() ||
+			HashWrapper::Crypto(message.fees()) != header.fees_hash()) {
+			LOG_ERROR("Ledger(" FMT_I64 ") does not match its hash", header.seq());
+			return false;
+		}
+
+		if (header.seq() <= LedgerManager::Instance().GetLastClosedLedger().seq() || header.version() > General::LEDGER_VERSION) {
+			LOG_ERROR("Ledger(" FMT_I64 ") version(" FMT_I64 ") can not be synced", header.seq(), header.version());
+			return false;
+		}
+
+		//the next value is signed by the validators of the ledger, which must be the known ones.
+		//a changed validator set is followed by replay
+		protocol::ValidatorSet validators = LedgerManager::Instance().Validators();
+		if (HashWrapper::Crypto(validators.SerializeAsString()) != header.validators_hash()) {
+			LOG_WARN("The validators of ledger(" FMT_I64 ") changed, catch up by replay", header.seq());
+			return false;
+		}
+		if (!GlueManager::Instance().CheckProof(validators, message.next_value(), message.next_proof())) {
+			LOG_ERROR("Check the proof of ledger(" FMT_I64 ") failed", header.seq() + 1);
+			return false;
+		}
+
+		seq_ = header.seq();
+		header_ = header;
+		consensus_value_ = message.consensus_value();
+		proof_ = next.previous_proof();
+		fees_ = message.fees();
+		return true;
+	}
+
+	bool StateSync::VerifyRow(const Row &row, const std::string &value) {
+		if (HashWrapper::Crypto(value) != row.hash_) {
+			LOG_ERROR("Row(%s) of ledger(" FMT_I64 ") does not match its hash", utils::String::BinToHexString(row.Key()).c_str(), seq_);
+			return false;
+		}
+
+		if (!row.leaf_) {
+			protocol::Node node;
+			if (!node.ParseFromString(value)) {
+				return false;
+			}
+			for (int32_t i = 0; i < node.children_size(); i++) {
+				const protocol::Child &child = node.children(i);
+				if (child.childtype() == protocol::NONE) {
+					continue;
+				}
+				Row next;
+				next.prefix_ = row.prefix_;
+				next.location_ = child.sublocation();
+				next.hash_ = child.hash();
+				next.leaf_ = child.childtype() == protocol::LEAF;
+				next.account_ = row.account_;
+				if (next.location_.empty()) {
+					return false;
+				}
+				queue_.push_back(next);
+			}
+		}
+		else if (row.account_) {
+			protocol::Account account;
+			if (!account.ParseFromString(value)) {
+				return false;
+			}
+			account_count_++;
+
+			const std::string sub_trees[2][2] = { { General::ASSET_PREFIX, account.assets_hash() },
+				{ General::METADATA_PREFIX, account.metadatas_hash() } };
+			for (size_t i = 0; i < 2; i++) {
+				if (sub_trees[i][1].empty()) {
+					continue;
+				}
+				Row root;
+				root.prefix_ = ComposePrefix(sub_trees[i][0], DecodeAddress(account.address()));
+				root.location_ = Trie::Key2Location("");
+				root.hash_ = sub_trees[i][1];
+				root.leaf_ = false;
+				root.account_ = false;
+				queue_.push_back(root);
+			}
+		}
+
+		std::string key = ComposePrefix(General::STATE_SYNC_PREFIX, row.Key());
+		staged_.Put(key, value);
+		staged_bytes_ += key.size() + value.size();
+		row_count_++;
+		byte_count_ += value.size();
+		return true;
+	}
+
+	void StateSync::OnTimer(int64_t current_time) {
+		if (!active_ || current_time - last_timer_ < utils::MICRO_UNITS_PER_SEC) {
+			return;
+		}
+		last_timer_ = current_time;
+
+		std::set<int64_t> active_peers = PeerManager::Instance().ConsensusNetwork().GetActivePeerIds();
+		std::vector<Request> requests;
+		do {
+			utils::MutexGuard guard(mutex_);
+			if (!active_) {
+				return;
+			}
+			if (current_time - update_time_ > STATE_SYNC_STALL) {
+				LOG_ERROR("State sync of ledger(" FMT_I64 ") stalled, catch up by replay", seq_);
+				Reset();
+				return;
+			}
+
+			for (auto iter = peers_.begin(); iter != peers_.end();) {
+				PeerStat &peer = iter->second;
+				bool gone = active_peers.find(iter->first) == active_peers.end();
+				if (peer.send_time_ != 0 && (gone || current_time - peer.send_time_ > STATE_SYNC_TIMEOUT)) {
+					queue_.insert(queue_.begin(), peer.rows_.begin(), peer.rows_.end());
+					peer.rows_.clear();
+					peer.send_time_ = 0;
+					peer.probation_ = current_time + STATE_SYNC_PROBATION;
+				}
+				if (gone) {
+					iter = peers_.erase(iter);
+				}
+				else {
+					iter++;
+				}
+			}
+			for (auto iter = active_peers.begin(); iter != active_peers.end(); iter++) {
+				peers_[*iter];
+			}
+			Dispatch(current_time, requests);
+		} while (false);
+
+		Send(requests);
+	}
+
+	void StateSync::Dispatch(int64_t current_time, std::vector<Request> &requests) {
+		bool asking = false;
+		for (auto iter = peers_.begin(); iter != peers_.end(); iter++) {
+			asking |= seq_ == 0 && iter->second.send_time_ != 0;
+		}
+
+		for (auto iter = peers_.begin(); iter != peers_.end() && !asking; iter++) {
+			PeerStat &peer = iter->second;
+			if (peer.send_time_ != 0 || peer.probation_ > current_time) {
+				continue;
+			}
+
+			protocol::GetAccountTree message;
+			message.set_ledger_seq(seq_);
+			message.set_timestamp(current_time);
+			if (seq_ == 0) {
+				//one peer at a time proves the checkpoint
+				asking = true;
+			}
+			else {
+				if (queue_.empty()) {
+					break;
+				}
+				while (!queue_.empty() && peer.rows_.size() < STATE_SYNC_ROWS_PER_REQUEST) {
+					peer.rows_.push_back(queue_.front());
+					message.add_keys(queue_.front().Key());
+					queue_.pop_front();
+				}
+			}
+			peer.send_time_ = current_time;
+			requests.push_back(Request(iter->first, message));
+		}
+	}
+
+	void StateSync::Send(const std::vector<Request> &requests) {
+		for (size_t i = 0; i < requests.size(); i++) {
+			PeerManager::Instance().ConsensusNetwork().SendRequest(requests[i].first, protocol::OVERLAY_MSGTYPE_ACCOUNT_TREE,
+				requests[i].second.SerializeAsString());
+		}
+	}
+
+	bool StateSync::Stage() {
+		KeyValueDb *account_db = Storage::Instance().account_db();
+		if (staged_bytes_ > 0 && !account_db->WriteBatch(staged_)) {
+			LOG_ERROR("Stage the account state of ledger(" FMT_I64 ") failed(%s)", seq_, account_db->error_desc().c_str());
+			return false;
+		}
+		staged_.Clear();
+		staged_bytes_ = 0;
+		return true;
+	}
+
+	void StateSync::ClearStaged() {
+		KeyValueDb *account_db = Storage::Instance().account_db();
+		ReadRange range = ReadRange::Prefix(ComposePrefix(General::STATE_SYNC_PREFIX, ""));
+		range.fill_cache_ = false;
+		WRITE_BATCH batch;
+		size_t pending = 0;
+		bool ok = true;
+		KeyValueIterator *it = account_db->NewIterator(range);
+		for (it->SeekToFirst(); it->Valid() && ok; it->Next()) {
+			batch.Delete(it->key());
+			if (++pending >= 10000) {
+				ok = account_db->WriteBatch(batch);
+				batch.Clear();
+				pending = 0;
+			}
+		}
+		ok = ok && it->ok() && (pending == 0 || account_db->WriteBatch(batch));
+		delete it;
+		if (!ok) {
+			LOG_ERROR("Clear the staged account state failed(%s)", account_db->error_desc().c_str());
+		}
+	}
+
+	void StateSync::Reset() {
+		active_ = false;
+		seq_ = 0;
+		header_.Clear();
+		consensus_value_.clear();
+		proof_.clear();
+		fees_.clear();
+		peers_.clear();
+		queue_.clear();
+		staged_.Clear();
+		staged_bytes_ = 0;
+		ClearStaged();
+		row_count_ = 0;
+		account_count_ = 0;
+		byte_count_ = 0;
+	}
+
+	void StateSync::GetModuleStatus(Json::Value &data) {
+		do {
+			utils::MutexGuard guard(pinned_mutex_);
+			Json::Value &pinned = data["pinned"];
+			pinned = Json::Value(Json::arrayValue);
+			for (auto iter = pinned_.begin(); iter != pinned_.end(); iter++) {
+				pinned[pinned.size()] = (Json::Int64)iter->first;
+			}
+		} while (false);
+		data["served_rows"] = (Json::Int64)served_rows_.load();
+
+		utils::MutexGuard guard(mutex_);
+		data["active"] = active_.load();
+		data["sync_count"] = (Json::Int64)sync_count_;
+		if (active_) {
+			data["ledger_seq"] = (Json::Int64)seq_;
+			data["queued"] = (Json::UInt64)queue_.size();
+			data["rows"] = (Json::Int64)row_count_;
+			data["bytes"] = (Json::Int64)byte_count_;
+			data["accounts"] = (Json::Int64)account_count_;
+			Json::Value &peers = data["peers"];
+			for (auto iter = peers_.begin(); iter != peers_.end(); iter++) {
+				Json::Value &peer = peers[peers.size()];
+				peer["pid"] = (Json::Int64)iter->first;
+				peer["rows"] = (Json::Int64)iter->second.row_count_;
+				peer["probation"] = (Json::Int64)iter->second.probation_;
+			}
+		}
+	}
+}
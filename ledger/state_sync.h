@@ -0,0 +1,122 @@
+/*
+	phantom is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	phantom is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with phantom.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef STATE_SYNC_H_
+#define STATE_SYNC_H_
+
+#include <atomic>
+#include <deque>
+#include <utils/thread.h>
+#include <common/storage.h>
+#include <proto/cpp/overlay.pb.h>
+
+namespace phantom {
+
+	class LedgerView;
+
+	//Catch-up by account state instead of replay. A node far behind fetches the account tree of a recent
+	//ledger, with the asset and metadata trees of its accounts, row by row from several peers. The ledger
+	//is proven by the proof of the next one, each row by the hash in its parent row up to the
+	//account_tree_hash of the ledger. Once complete the rows replace the local trees and replay goes on
+	//from that ledger. Every node pins the view of a checkpoint ledger each interval ledgers and serves
+	//the rows from it, so that the peers of a syncing node agree on the ledger
+	class StateSync {
+	public:
+		StateSync();
+		~StateSync();
+
+		//a ledger view is published, pinned if it is a checkpoint
+		void OnLedgerView(const std::shared_ptr<const LedgerView> &view);
+		//serve a peer, on the network thread
+		void OnRequest(const protocol::GetAccountTree &message, int64_t peer_id);
+
+		//fetch the state of a recent ledger of peer, nothing if a sync is running
+		void Start(int64_t peer_id);
+		void OnResponse(const protocol::AccountTree &message, int64_t peer_id);
+		void OnTimer(int64_t current_time);
+		//replay waits while the state is fetched
+		bool active() const { return active_; }
+		void GetModuleStatus(Json::Value &data);
+
+	private:
+		//a row to fetch, the root of a tree or a child of a verified row
+		struct Row {
+			std::string prefix_;
+			std::string location_;
+			std::string hash_;
+			bool leaf_;
+			bool account_; //in the account tree, its leaves root the sub trees
+			std::string Key() const;
+		};
+		struct PeerStat {
+			PeerStat() :send_time_(0), probation_(0), row_count_(0) {}
+			int64_t send_time_;
+			int64_t probation_;
+			int64_t row_count_;
+			std::vector<Row> rows_;
+		};
+		struct Pinned {
+			std::shared_ptr<const LedgerView> view_;
+			int64_t use_time_;
+		};
+		typedef std::pair<int64_t, protocol::GetAccountTree> Request;
+
+		//the checkpoint a request asks for, 0 for the newest one which has the proof of its next ledger.
+		//null if it is not pinned
+		std::shared_ptr<const LedgerView> FindView(int64_t seq, int64_t current_time);
+		void FillLedger(const LedgerView &view, protocol::AccountTree &reply);
+		void FillRows(const LedgerView &view, const protocol::GetAccountTree &message, protocol::AccountTree &reply);
+
+		//check the ledger of a reply against the known validators
+		bool VerifyLedger(const protocol::AccountTree &message);
+		//check value against row and queue the rows it refers to
+		bool VerifyRow(const Row &row, const std::string &value);
+		//hand the queued rows to the idle peers
+		void Dispatch(int64_t current_time, std::vector<Request> &requests);
+		void Send(const std::vector<Request> &requests);
+		//write the verified rows to the staging area of the account db
+		bool Stage();
+		//drop the staged rows of a sync which did not finish
+		void ClearStaged();
+		void Reset();
+
+		//serving side
+		utils::Mutex pinned_mutex_;
+		std::map<int64_t, Pinned> pinned_;
+		std::atomic<int64_t> served_rows_;
+
+		//fetching side
+		utils::Mutex mutex_;
+		std::atomic<bool> active_;
+		int64_t seq_; //0 while the ledger is asked for
+		protocol::LedgerHeader header_;
+		std::string consensus_value_;
+		std::string proof_;
+		std::string fees_;
+		std::map<int64_t, PeerStat> peers_;
+		std::deque<Row> queue_;
+		WRITE_BATCH staged_;
+		size_t staged_bytes_;
+		int64_t row_count_;
+		int64_t account_count_;
+		int64_t byte_count_;
+		int64_t begin_time_;
+		int64_t update_time_;
+		int64_t last_timer_;
+		int64_t sync_count_;
+	};
+}
+
+#endif
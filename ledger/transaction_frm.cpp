@@ -21,6 +21,7 @@
 #include "transaction_frm.h"
 #include "contract_manager.h"
 #include "fee_compulate.h"
+#include "signature_cache.h"
 
 #include "ledger_frm.h"
 namespace phantom {
@@ -48,7 +49,7 @@ namespace phantom {
 	}
 
 
-	TransactionFrm::TransactionFrm(const protocol::TransactionEnv &env) :
+	TransactionFrm::TransactionFrm(const protocol::TransactionEnv &env, bool verify_signature) :
 		apply_time_(0),
 		ledger_seq_(0),
 		result_(),
@@ -63,7 +64,7 @@ namespace phantom {
 		contract_stack_usage_(0),
 		enable_check_(false), apply_start_time_(0), apply_use_time_(0),
 		incoming_time_(utils::Timestamp::HighResolution()) {
-		Initialize();
+		Initialize(verify_signature);
 		utils::AtomicInc(&phantom::General::tx_new_count);
 	}
 
@@ -89,13 +90,17 @@ namespace phantom {
 		result["hash"] = utils::String::BinToHexString(hash_);
 	}
 
-	void TransactionFrm::Initialize() {
+	void TransactionFrm::Initialize(bool verify_signature) {
 		const protocol::Transaction &tran = transaction_env_.transaction();
 		data_ = tran.SerializeAsString();
 		hash_ = HashWrapper::Crypto(data_);
 		full_data_ = transaction_env_.SerializeAsString();
 		full_hash_ = HashWrapper::Crypto(full_data_);
 
+		if (!verify_signature) {
+			return;
+		}
+
 		for (int32_t i = 0; i < transaction_env_.signatures_size(); i++) {
 			const protocol::Signature &signature = transaction_env_.signatures(i);
 			PublicKey pubkey(signature.public_key());
@@ -104,7 +109,10 @@ namespace phantom {
 				LOG_ERROR("Invalid publickey(%s)", signature.public_key().c_str());
 				continue;
 			}
-			if (!PublicKey::Verify(data_, signature.sign_data(), signature.public_key())) {
+			SignatureCache *cache = SignatureCache::GetInstance();
+			bool valid = cache != NULL ? cache->Verify(hash_, data_, signature.sign_data(), signature.public_key()) :
+				PublicKey::Verify(data_, signature.sign_data(), signature.public_key());
+			if (!valid) {
 				LOG_ERROR("Invalid signature data(%s)", utils::String::BinToHexString(signature.SerializeAsString()).c_str());
 				continue;
 			}
@@ -112,6 +120,47 @@ namespace phantom {
 		}
 	}
 
+	void TransactionFrm::VerifySignatures(const std::vector<TransactionFrm::pointer> &txs) {
+		//signatures verified before skip the batch. A passed batch is not exact, so nothing is cached from it
+		SignatureCache *cache = SignatureCache::GetInstance();
+		std::vector<SignatureItem> items;
+		std::vector<TransactionFrm *> owners;
+		for (size_t i = 0; i < txs.size(); i++) {
+			TransactionFrm *tx = txs[i].get();
+			for (int32_t j = 0; j < tx->transaction_env_.signatures_size(); j++) {
+				const protocol::Signature &signature = tx->transaction_env_.signatures(j);
+				if (cache != NULL && cache->Get(tx->hash_, signature.sign_data(), signature.public_key())) {
+					PublicKey pubkey(signature.public_key());
+					tx->valid_signature_.insert(pubkey.GetEncAddress());
+					continue;
+				}
+
+				SignatureItem item;
+				item.data_ = &tx->data_;
+				item.sign_data_ = &signature.sign_data();
+				item.public_key_ = &signature.public_key();
+				item.valid_ = false;
+				items.push_back(item);
+				owners.push_back(tx);
+			}
+		}
+
+		PublicKey::VerifyBatch(items);
+
+		for (size_t i = 0; i < items.size(); i++) {
+			PublicKey pubkey(*items[i].public_key_);
+			if (!pubkey.IsValid()) {
+				LOG_ERROR("Invalid publickey(%s)", items[i].public_key_->c_str());
+				continue;
+			}
+			if (!items[i].valid_) {
+				LOG_ERROR("Invalid signature data(%s)", utils::String::BinToHexString(*items[i].sign_data_).c_str());
+				continue;
+			}
+			owners[i]->valid_signature_.insert(pubkey.GetEncAddress());
+		}
+	}
+
 	std::string TransactionFrm::GetContentHash() const {
 		return hash_;
 	}
@@ -641,6 +690,42 @@ namespace phantom {
 			return protocol::ERRCODE_NOT_EXIST;
 		}
 
+		return FromStore(hash, txenv_store);
+	}
+
+	uint32_t TransactionFrm::LoadFromDb(const std::vector<std::string> &hashes, std::vector<pointer> &txs) {
+		KeyValueDb *db = Storage::Instance().ledger_db();
+
+		std::vector<std::string> keys;
+		for (size_t i = 0; i < hashes.size(); i++) {
+			keys.push_back(ComposePrefix(General::TRANSACTION_PREFIX, hashes[i]));
+		}
+
+		std::vector<std::string> values;
+		std::vector<int32_t> statuses;
+		if (!db->MultiGet(keys, values, statuses)) {
+			LOG_ERROR("Get transactions failed, %s", db->error_desc().c_str());
+			return protocol::ERRCODE_INTERNAL_ERROR;
+		}
+
+		txs.clear();
+		for (size_t i = 0; i < hashes.size(); i++) {
+			if (statuses[i] == 0) {
+				LOG_TRACE("Tx(%s) not exist", utils::String::BinToHexString(hashes[i]).c_str());
+				return protocol::ERRCODE_NOT_EXIST;
+			}
+
+			pointer tx = std::make_shared<TransactionFrm>();
+			uint32_t ret = tx->FromStore(hashes[i], values[i]);
+			if (ret != 0) {
+				return ret;
+			}
+			txs.push_back(tx);
+		}
+		return 0;
+	}
+
+	uint32_t TransactionFrm::FromStore(const std::string &hash, const std::string &txenv_store) {
 		protocol::TransactionEnvStore envstor;
 		if (!envstor.ParseFromString(txenv_store)) {
 			LOG_ERROR("Decode tx(%s) body failed", utils::String::BinToHexString(hash).c_str());
@@ -41,7 +41,7 @@ namespace phantom {
 	public:
 		//only valid when the transaction belongs to a txset
 		TransactionFrm();
-		TransactionFrm(const protocol::TransactionEnv &env);
+		TransactionFrm(const protocol::TransactionEnv &env, bool verify_signature = true);
 		
 		virtual ~TransactionFrm();
 		
@@ -68,9 +68,15 @@ namespace phantom {
 
 		Result GetResult() const;
 
-		void Initialize();
+		void Initialize(bool verify_signature = true);
+
+		//verify the signatures of transactions built without verify_signature, ed25519 ones in batches.
+		//only for admission, the results are not put in the signature cache
+		static void VerifySignatures(const std::vector<pointer> &txs);
 
 		uint32_t LoadFromDb(const std::string &hash);
+		//load the transactions of hashes with one batched read, txs follows the order of hashes
+		static uint32_t LoadFromDb(const std::vector<std::string> &hashes, std::vector<pointer> &txs);
 
 		bool CheckTimeout(int64_t expire_time);
 		void NonceIncrease(LedgerFrm* ledger_frm, std::shared_ptr<Environment> env);
@@ -140,6 +146,8 @@ namespace phantom {
 		bool enable_check_;
 		int64_t apply_start_time_;
 		int64_t apply_use_time_;
+
+		uint32_t FromStore(const std::string &hash, const std::string &txenv_store);
 	};
 };
 
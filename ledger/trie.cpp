@@ -13,14 +13,16 @@
 	along with phantom.  If not, see <http://www.gnu.org/licenses/>.
 */
 
+#include <algorithm>
 #include <utils/logger.h>
+#include <utils/timestamp.h>
 #include "utils/strings.h"
 #include "trie.h"
 
 namespace phantom{
 
-	int NodeFrm::NEWCOUNT;
-	int NodeFrm::DELCOUNT;
+	std::atomic<int64_t> NodeFrm::NEWCOUNT(0);
+	std::atomic<int64_t> NodeFrm::DELCOUNT(0);
 	/*
 	-----------------------------
 	old\new |  add  | mod  | del
@@ -30,48 +32,104 @@ namespace phantom{
 	-----------------------------
 	*/
 
+	void ChildSlot::Clear(){
+		sublocation_.clear();
+		hash_.clear();
+		type_ = protocol::NONE;
+	}
+
+	void ChildSlot::ToProto(protocol::Child& child) const{
+		child.set_sublocation(sublocation_);
+		child.set_hash(hash_);
+		child.set_childtype(type_);
+	}
+
+	void ChildSlot::FromProto(const protocol::Child& child){
+		sublocation_ = child.sublocation();
+		hash_ = child.hash();
+		type_ = child.childtype();
+	}
+
 	NodeFrm::NodeFrm(const Location& location)
 		:leaf_(nullptr),  /*indb_(false),leaf_indb_(false),*/ leaf_deleted_(false), modified_(true), location_(location){
-		for (int i = 0; i <= 16; i++){
-			protocol::Child* ch = info_.add_children();
-			if (i != 16)
-				children_[i] = nullptr;
-		}
 		NEWCOUNT++;
 	}
 
+	NodeFrm::POINTER NodeFrm::Create(const Location& location){
+		return std::allocate_shared<NodeFrm>(PoolAllocator<NodeFrm>(), location);
+	}
+
 	void NodeFrm::SetValue(const std::string& v){
 		modified_ = true;
 		leaf_deleted_ = false;
 		leaf_ = std::make_shared<std::string>(v);
-		protocol::Child* ch16 = info_.mutable_children(16);
-		ch16->set_childtype(protocol::LEAF);
-		ch16->set_sublocation(location_);
+		slots_[16].type_ = protocol::LEAF;
+		slots_[16].sublocation_ = location_;
 	}
 
 	void NodeFrm::MarkRemove(){
 		modified_ = true;
 		leaf_deleted_ = true;
 		leaf_ = nullptr;
-		protocol::Child* ch16 = info_.mutable_children(16);
-		ch16->Clear();
+		slots_[16].Clear();
 	}
 
 	void NodeFrm::SetChild(int branch, POINTER child){
 		assert(branch < 16);
 		modified_ = true;
 		children_[branch] = child;
-		info_.mutable_children(branch)->set_sublocation(child->location_);
-		//info_.mutable_children(branch)->set_childtype();
+		slots_[branch].sublocation_ = child->location_;
+	}
+
+	//all 17 children are always present, so the serialized node is the same as before the slots
+	void NodeFrm::ToProto(protocol::Node& info) const{
+		info.Clear();
+		for (int i = 0; i <= 16; i++){
+			slots_[i].ToProto(*info.add_children());
+		}
+	}
+
+	void NodeFrm::FromProto(const protocol::Node& info){
+		for (int i = 0; i <= 16; i++){
+			if (i < info.children_size()){
+				slots_[i].FromProto(info.children(i));
+			}
+			else{
+				slots_[i].Clear();
+			}
+		}
 	}
 
 	NodeFrm::~NodeFrm(){
 		DELCOUNT++;
 	}
 
+	class Trie::HashTask : public utils::Runnable{
+	public:
+		HashTask(Trie *trie, NodeFrm::POINTER parent, int branch, utils::Semaphore *done)
+			:trie_(trie), parent_(parent), branch_(branch), done_(done), time_(0){}
+
+		virtual void Run(utils::Thread *this_thread) override{
+			int64_t t1 = utils::Timestamp::HighResolution();
+			result_ = trie_->update_hash(parent_->children_[branch_]);
+			time_ = utils::Timestamp::HighResolution() - t1;
+			done_->Signal();
+		}
+
+		Trie *trie_;
+		NodeFrm::POINTER parent_;
+		int branch_;
+		utils::Semaphore *done_;
+		ChildSlot result_;
+		int64_t time_;
+	};
+
 	Trie::Trie(){
 		rootl = "";
 		rootl.push_back(0);
+		hash_wall_time_ = 0;
+		hash_work_time_ = 0;
+		hash_task_count_ = 0;
 	}
 
 
@@ -83,6 +141,10 @@ namespace phantom{
 		Release(root_, depth);
 	}
 
+	void Trie::SetNodeCache(std::shared_ptr<NodeCache> cache){
+		node_cache_ = cache;
+	}
+
 	void Trie::Release(NodeFrm::POINTER node, int depth){
 		for (int i = 0; i < 16; i++){
 			auto child = node->children_[i];
@@ -98,22 +160,29 @@ namespace phantom{
 	NodeFrm::POINTER Trie::ChildMayFromDB(NodeFrm::POINTER node, int branch) {
 		if (node->children_[branch] == nullptr){
 			NodeFrm::POINTER frm = nullptr;
-			const protocol::Child& chd = node->info_.children(branch);
-			if (chd.childtype() == protocol::NONE){
+			const ChildSlot& chd = node->slots_[branch];
+			if (chd.type_ == protocol::NONE){
 				return nullptr;
 			}
 
-			frm = std::make_shared<NodeFrm>(chd.sublocation());
+			frm = NodeFrm::Create(chd.sublocation_);
 			frm->modified_ = false;
 
-			if (chd.childtype() == protocol::LEAF){
-				frm->info_.mutable_children(16)->CopyFrom(node->info_.children(branch));
+			if (chd.type_ == protocol::LEAF){
+				frm->slots_[16] = chd;
 
 			}
-			else if (chd.childtype() == protocol::INNER){
-				if (!storage_load(chd.sublocation(), frm->info_)){
-					PROCESS_EXIT("load:%s failed", utils::String::BinToHexString(chd.sublocation()).c_str());
+			else if (chd.type_ == protocol::INNER){
+				protocol::Node info;
+				if (node_cache_ == nullptr || !node_cache_->Get(chd.sublocation_, info)){
+					if (!storage_load(chd.sublocation_, info)){
+						PROCESS_EXIT("load:%s failed", utils::String::BinToHexString(chd.sublocation_).c_str());
+					}
+					if (node_cache_ != nullptr){
+						node_cache_->Put(chd.sublocation_, info);
+					}
 				}
+				frm->FromProto(info);
 			}
 			node->children_[branch] = frm;
 		}
@@ -179,78 +248,65 @@ namespace phantom{
 		return location + key;
 	}
 
-	protocol::Child Trie::update_hash(NodeFrm::POINTER node){
+	ChildSlot Trie::update_hash(NodeFrm::POINTER node){
 
 		int branch_count = 0;
 		int onlybranch = -1;
-		int64_t children_count = 0;
 
 		//////////////////////////////////////////////////////////////
 		if (!node->leaf_deleted_){
 			if (node->leaf_ != nullptr){
-				protocol::Child* this_child = node->info_.mutable_children(16);
-#ifdef COUNT
-				this_child->set_count(1);
-#endif
-				this_child->set_sublocation(node->location_);
-				this_child->set_hash(HashCrypto(*(node->leaf_)));
-				this_child->set_childtype(protocol::LEAF);
+				ChildSlot& this_child = node->slots_[16];
+				this_child.sublocation_ = node->location_;
+				this_child.hash_ = HashCrypto(*(node->leaf_));
+				this_child.type_ = protocol::LEAF;
 				StorageSaveLeaf(node);
 			}
 		}
 		else{
-			protocol::Child* ch = node->info_.mutable_children(16);
-			ch->Clear();
+			node->slots_[16].Clear();
 			StorageDeleteLeaf(node);
 		}
 
-		if (node->info_.children(16).childtype() != protocol::CHILDTYPE::NONE){
+		if (node->slots_[16].type_ != protocol::CHILDTYPE::NONE){
 			branch_count++;
 			onlybranch = 16;
-			children_count++;
 		}
 
 		for (int i = 0; i < 16; i++){
 			NodeFrm::POINTER child = node->children_[i];
 			if ((child != nullptr) && (child->modified_)){
-				protocol::Child childresult = update_hash(child);
-				node->info_.mutable_children(i)->CopyFrom(childresult);
+				node->slots_[i] = update_hash(child);
 			}
 
-			if (node->info_.children(i).childtype() != protocol::CHILDTYPE::NONE){
+			if (node->slots_[i].type_ != protocol::CHILDTYPE::NONE){
 				branch_count++;
 				onlybranch = i;
-#ifdef COUNT
-				if (node->info_.children(i).count() == 0){
-					printf("fatel error");
-				}
-				children_count += node->info_.children(i).count();
-#endif
 			}
 		}
 
 
-		protocol::Child result;
-#ifdef COUNT
-		result.set_count(children_count);
-#endif		
+		ChildSlot result;
 		if (branch_count == 0 && node->location_ != rootl){
 			StorageDeleteNode(node);
+			if (node_cache_ != nullptr) node_cache_->Erase(node->location_);
 			//node->indb_ = false;
 		}
 		else if (branch_count == 1 && node->location_ != rootl){
 			StorageDeleteNode(node);
+			if (node_cache_ != nullptr) node_cache_->Erase(node->location_);
 			//node->indb_ = false;
-			result.CopyFrom(node->info_.children(onlybranch));
+			result = node->slots_[onlybranch];
 		}
 		else {
-			StorageSaveNode(node);
-			result.set_hash(HashCrypto(node->info_.SerializeAsString()));
-			result.set_sublocation(node->location_);
-			result.set_childtype(protocol::CHILDTYPE::INNER);
-#ifdef COUNT
-			result.set_count(children_count);
-#endif
+			protocol::Node info;
+			node->ToProto(info);
+			std::string buff = info.SerializeAsString();
+			StorageSaveNode(node, buff);
+			if (node_cache_ != nullptr) node_cache_->Put(node->location_, info);
+			result.hash_ = HashCrypto(buff);
+			result.sublocation_ = node->location_;
+			result.type_ = protocol::CHILDTYPE::INNER;
 		}
 		node->modified_ = false;
 		return result;
@@ -270,13 +326,13 @@ namespace phantom{
 		int branch = NextBranch(common, location);
 
 		NodeFrm::POINTER node2 = ChildMayFromDB(node, branch);
-		protocol::Child child2 = node->info_.children(branch);
+		ChildSlot child2 = node->slots_[branch];
 		if (node2 == nullptr){
-			NodeFrm::POINTER newnode = std::make_shared<NodeFrm>(location);
+			NodeFrm::POINTER newnode = NodeFrm::Create(location);
 			newnode->SetValue(data);
 
 			node->SetChild(branch, newnode);
-			node->info_.mutable_children(branch)->set_childtype(protocol::LEAF);
+			node->slots_[branch].type_ = protocol::LEAF;
 			
 			return true;
 		}
@@ -298,14 +354,14 @@ namespace phantom{
 				|
 				node2
 				*/
-			NodeFrm::POINTER newnode = std::make_shared< NodeFrm>(location);
+			NodeFrm::POINTER newnode = NodeFrm::Create(location);
 			newnode->SetValue(data);
 			int b1 = NextBranch(newcommon, location2);
 			newnode->SetChild(b1, node2);
-			newnode->info_.mutable_children(b1)->CopyFrom(child2);
+			newnode->slots_[b1] = child2;
 
 			node->SetChild(branch, newnode);
-			node->info_.mutable_children(branch)->set_childtype(protocol::INNER);
+			node->slots_[branch].type_ = protocol::INNER;
 			return true;
 		}
 		else {
@@ -323,15 +379,15 @@ namespace phantom{
 						  */
 			/************************************************************************/
 
-			NodeFrm::POINTER mnode = std::make_shared< NodeFrm>(newcommon);
-			NodeFrm::POINTER newnode = std::make_shared< NodeFrm>(location);
+			NodeFrm::POINTER mnode = NodeFrm::Create(newcommon);
+			NodeFrm::POINTER newnode = NodeFrm::Create(location);
 			newnode->SetValue(data);
 
 			int b1 = NextBranch(newcommon, location);
 			int b2 = NextBranch(newcommon, location2);
 			mnode->SetChild(b1, newnode);
 			mnode->SetChild(b2, node2);
-			mnode->info_.mutable_children(b2)->CopyFrom(child2);
+			mnode->slots_[b2] = child2;
 			node->SetChild(branch, mnode);
 			return true;
 		}
@@ -406,11 +462,11 @@ namespace phantom{
 		auto common = CommonPrefix(node->location_, key);
 		int branch = NextBranch(common, key);
 
-		if (node->info_.children(branch).childtype() == protocol::CHILDTYPE::NONE){
+		if (node->slots_[branch].type_ == protocol::CHILDTYPE::NONE){
 			return false;
 		}
 
-		Location location2 = node->info_.children(branch).sublocation();
+		Location location2 = node->slots_[branch].sublocation_;
 
 		auto common2 = CommonPrefix(location2, key);
 		if (common2 != location2){
@@ -431,8 +487,82 @@ namespace phantom{
 		return root_hash_;
 	}
 
-	void Trie::UpdateHash(){
-		root_hash_ = update_hash(root_).hash();
+	void Trie::UpdateHash(utils::ThreadPool *pool, size_t worker_count){
+		int64_t t1 = utils::Timestamp::HighResolution();
+		if (pool == NULL || worker_count <= 1){
+			root_hash_ = update_hash(root_).hash_;
+			hash_wall_time_ = hash_work_time_ = utils::Timestamp::HighResolution() - t1;
+			hash_task_count_ = 0;
+			return;
+		}
+
+		update_hash_parallel(pool, worker_count);
+		hash_wall_time_ = utils::Timestamp::HighResolution() - t1;
+	}
+
+	void Trie::update_hash_parallel(utils::ThreadPool *pool, size_t worker_count){
+		//split the modified nodes into independent subtrees, go deeper while there are
+		//too few of them, e.g. when all dirty accounts fall under the same root branch
+		static const int max_split_depth = 4;
+		typedef std::pair<NodeFrm::POINTER, int> Slot; //parent, branch
+		std::vector<Slot> frontier;
+		for (int i = 0; i < 16; i++){
+			NodeFrm::POINTER child = root_->children_[i];
+			if (child != nullptr && child->modified_){
+				frontier.push_back(Slot(root_, i));
+			}
+		}
+
+		for (int depth = 0; depth < max_split_depth && frontier.size() < worker_count * 4; depth++){
+			std::vector<Slot> next;
+			bool expanded = false;
+			for (size_t n = 0; n < frontier.size(); n++){
+				NodeFrm::POINTER node = frontier[n].first->children_[frontier[n].second];
+				size_t before = next.size();
+				for (int i = 0; i < 16; i++){
+					NodeFrm::POINTER child = node->children_[i];
+					if (child != nullptr && child->modified_){
+						next.push_back(Slot(node, i));
+					}
+				}
+
+				//the expanded node stays modified, the serial pass below finishes it
+				if (next.size() == before){
+					next.push_back(frontier[n]);
+				}
+				else{
+					expanded = true;
+				}
+			}
+
+			if (!expanded){
+				break;
+			}
+			frontier.swap(next);
+		}
+
+		utils::Semaphore done;
+		std::vector<std::shared_ptr<HashTask>> tasks;
+		for (size_t n = 0; n < frontier.size(); n++){
+			tasks.push_back(std::make_shared<HashTask>(this, frontier[n].first, frontier[n].second, &done));
+			pool->AddTask(tasks.back().get());
+		}
+
+		for (size_t n = 0; n < tasks.size(); n++){
+			done.Wait();
+		}
+
+		hash_work_time_ = 0;
+		for (size_t n = 0; n < tasks.size(); n++){
+			HashTask *task = tasks[n].get();
+			task->parent_->slots_[task->branch_] = task->result_;
+			hash_work_time_ += task->time_;
+		}
+		hash_task_count_ = tasks.size();
+
+		int64_t t1 = utils::Timestamp::HighResolution();
+		root_hash_ = update_hash(root_).hash_;
+		hash_work_time_ += utils::Timestamp::HighResolution() - t1;
 	}
 
 	bool Trie::Delete(const std::string& key){
@@ -441,7 +571,135 @@ namespace phantom{
 	}
 
 
+	size_t Trie::SetBatch(std::vector<KeyValue> &items){
+		std::stable_sort(items.begin(), items.end(), [](const KeyValue &a, const KeyValue &b){
+			return a.first < b.first;
+		});
+
+		std::vector<BatchItem> batch(items.size());
+		for (size_t i = 0; i < items.size(); i++){
+			batch[i].location_ = Key2Location(items[i].first);
+			batch[i].value_ = &items[i].second;
+		}
+		return SetItems(root_, batch, 0, batch.size());
+	}
+
+	size_t Trie::DeleteBatch(std::vector<std::string> &keys){
+		std::sort(keys.begin(), keys.end());
+
+		std::vector<BatchItem> batch(keys.size());
+		for (size_t i = 0; i < keys.size(); i++){
+			batch[i].location_ = Key2Location(keys[i]);
+			batch[i].value_ = NULL;
+		}
+		return DeleteItems(root_, batch, 0, batch.size());
+	}
+
+	//items are sorted and all under node, so the one at node comes first
+	//and the rest fall into runs of the same branch
+	size_t Trie::SetItems(NodeFrm::POINTER node, const std::vector<BatchItem> &items, size_t begin, size_t end){
+		node->modified_ = true;
+
+		size_t new_count = 0;
+		for (; begin < end && items[begin].location_ == node->location_; begin++){
+			if (node->leaf_ == nullptr && node->slots_[16].type_ == protocol::CHILDTYPE::NONE){
+				new_count++;
+			}
+			node->SetValue(*items[begin].value_);
+		}
+
+		while (begin < end){
+			int branch = NextBranch(node->location_, items[begin].location_);
+			size_t next = begin + 1;
+			while (next < end && NextBranch(node->location_, items[next].location_) == branch){
+				next++;
+			}
+			new_count += SetBranch(node, branch, items, begin, next);
+			begin = next;
+		}
+		return new_count;
+	}
+
+	size_t Trie::SetBranch(NodeFrm::POINTER node, int branch, const std::vector<BatchItem> &items, size_t begin, size_t end){
+		//the deepest location shared by the run, the first and the last item are enough as they are sorted
+		Location common = CommonPrefix(items[begin].location_, items[end - 1].location_);
+
+		NodeFrm::POINTER node2 = ChildMayFromDB(node, branch);
+		if (node2 == nullptr){
+			NodeFrm::POINTER newnode = NodeFrm::Create(common);
+			node->SetChild(branch, newnode);
+			node->slots_[branch].type_ = (end - begin == 1) ? protocol::LEAF : protocol::INNER;
+			return SetItems(newnode, items, begin, end);
+		}
+
+		Location location2 = node2->location_;
+		Location newcommon = CommonPrefix(common, location2);
+		if (newcommon == location2){
+			return SetItems(node2, items, begin, end);
+		}
+
+		//the run leaves the path of node2 above it, split there as SetItem does
+		ChildSlot child2 = node->slots_[branch];
+		NodeFrm::POINTER mnode = NodeFrm::Create(newcommon);
+		int b2 = NextBranch(newcommon, location2);
+		mnode->SetChild(b2, node2);
+		mnode->slots_[b2] = child2;
+
+		node->SetChild(branch, mnode);
+		node->slots_[branch].type_ = protocol::INNER;
+		return SetItems(mnode, items, begin, end);
+	}
+
+	size_t Trie::DeleteItems(NodeFrm::POINTER node, const std::vector<BatchItem> &items, size_t begin, size_t end){
+		size_t count = 0;
+		for (; begin < end && items[begin].location_ == node->location_; begin++){
+			node->MarkRemove();
+			count++;
+		}
+
+		while (begin < end){
+			int branch = NextBranch(node->location_, items[begin].location_);
+			size_t next = begin + 1;
+			while (next < end && NextBranch(node->location_, items[next].location_) == branch){
+				next++;
+			}
+
+			NodeFrm::POINTER node2 = ChildMayFromDB(node, branch);
+			if (node2 != nullptr){
+				//only the keys under node2 can exist, they are contiguous
+				const Location &location2 = node2->location_;
+				size_t first = begin;
+				while (first < next && CommonPrefix(location2, items[first].location_) != location2){
+					first++;
+				}
+				size_t last = first;
+				while (last < next && CommonPrefix(location2, items[last].location_) == location2){
+					last++;
+				}
+				if (first < last){
+					count += DeleteItems(node2, items, first, last);
+				}
+			}
+			begin = next;
+		}
+
+		if (count > 0){
+			node->modified_ = true;
+		}
+		return count;
+	}
+
+	void Trie::ForEach(const std::function<void(const std::string&)> &visit){
+		StorageForEach(Key2Location(""), visit);
+	}
+
 	void Trie::StorageAssociated(const Location& location, std::vector<std::string>& result){
+		StorageForEach(location, [&result](const std::string &value){
+			result.push_back(value);
+		});
+	}
+
+	void Trie::StorageForEach(const Location& location, const std::function<void(const std::string&)> &visit){
 		protocol::Node info;
 		if (!storage_load(location, info)){
 			return;
@@ -449,7 +707,7 @@ namespace phantom{
 		if (info.children(16).childtype() == protocol::CHILDTYPE::LEAF){
 			std::string v;
 			StorageGetLeaf(location, v);
-			result.push_back(v);
+			visit(v);
 		}
 
 		for (int i = 0; i < 16; i++){
@@ -460,12 +718,12 @@ namespace phantom{
 			case protocol::NONE:
 				break;
 			case protocol::INNER:
-				StorageAssociated(chd.sublocation(), result);
+				StorageForEach(chd.sublocation(), visit);
 				break;
 			case protocol::LEAF:
 				std::string value;
 				StorageGetLeaf(chd.sublocation(), value);
-				result.push_back(value);
+				visit(value);
 				break;
 			}
 		}
@@ -507,7 +765,9 @@ namespace phantom{
 
 	protocol::Node Trie::getNode(NodeFrm::POINTER node, const Location& location){
 		if (node->location_ == location){
-			return node->info_;
+			protocol::Node info;
+			node->ToProto(info);
+			return info;
 		}
 
 		Location common = CommonPrefix(location, node->location_);
@@ -16,57 +16,92 @@
 #ifndef TRIE_H_
 #define TRIE_H_
 
+#include <atomic>
 #include <utils/sm3.h>
+#include <utils/thread.h>
 #include "proto/cpp/merkeltrie.pb.h"
+#include "node_cache.h"
+#include "node_pool.h"
 
 namespace phantom{
 	typedef std::string Location;
 	typedef std::string HASH;
 
+	//in-memory form of protocol::Child
+	struct ChildSlot{
+		Location sublocation_;
+		HASH hash_;
+		protocol::CHILDTYPE type_;
+
+		ChildSlot() :type_(protocol::NONE){}
+		void Clear();
+		void ToProto(protocol::Child& child) const;
+		void FromProto(const protocol::Child& child);
+	};
+
 	class NodeFrm{
 	public:
 		typedef std::shared_ptr<NodeFrm> POINTER;
 		Location location_;
 		POINTER children_[16];
 		
-		protocol::Node info_;
+		//the 16 branches and the leaf of this node, protocol::Node is only built to be hashed or persisted
+		ChildSlot slots_[17];
 		
 		bool modified_;
 		bool leaf_deleted_;
 		std::shared_ptr<std::string> leaf_;//nullptr default
 
-		static int NEWCOUNT;
-		static int DELCOUNT;
+		static std::atomic<int64_t> NEWCOUNT;
+		static std::atomic<int64_t> DELCOUNT;
 	public:
 		NodeFrm(const Location& location);
 
 		~NodeFrm();
 
+		//allocate from the node pool
+		static POINTER Create(const Location& location);
+
 		void SetValue(const std::string& v);
 		void MarkRemove();
 		void SetChild(int branch, POINTER child);
+
+		void ToProto(protocol::Node& info) const;
+		void FromProto(const protocol::Node& info);
 	};
 
 	class Trie
 	{
+		class HashTask;
+
+		struct BatchItem{
+			Location location_;
+			const std::string *value_;
+		};
 
 		bool SetItem(NodeFrm::POINTER node, const Location &key, const std::string &value, int depth);
 		bool DeleteItem(NodeFrm::POINTER node, const Location& key);
-		protocol::Child update_hash(NodeFrm::POINTER node);
+		size_t SetItems(NodeFrm::POINTER node, const std::vector<BatchItem> &items, size_t begin, size_t end);
+		size_t SetBranch(NodeFrm::POINTER node, int branch, const std::vector<BatchItem> &items, size_t begin, size_t end);
+		size_t DeleteItems(NodeFrm::POINTER node, const std::vector<BatchItem> &items, size_t begin, size_t end);
+		ChildSlot update_hash(NodeFrm::POINTER node);
+		void update_hash_parallel(utils::ThreadPool *pool, size_t worker_count);
 
 		void Release(NodeFrm::POINTER node, int depth);
 		
 		void GetAllItem(const Location& node, const Location& location, std::vector<std::string>& result);
 		void StorageAssociated(const Location& location, std::vector<std::string>& result);
+		void StorageForEach(const Location& location, const std::function<void(const std::string&)> &visit);
 	protected:
 		NodeFrm::POINTER root_;
 		HASH root_hash_;
 		Location rootl ;
+		std::shared_ptr<NodeCache> node_cache_;
 		NodeFrm::POINTER ChildMayFromDB(NodeFrm::POINTER node, int branch);
 
 		virtual bool storage_load(const Location& location, protocol::Node& info) = 0;
 
-		virtual void StorageSaveNode(NodeFrm::POINTER node) = 0;
+		virtual void StorageSaveNode(NodeFrm::POINTER node, const std::string& buff) = 0;
 		virtual void StorageSaveLeaf(NodeFrm::POINTER node) = 0;
 		virtual	void StorageDeleteNode(NodeFrm::POINTER node) = 0;
 		virtual void StorageDeleteLeaf(NodeFrm::POINTER node) = 0;
@@ -76,6 +111,8 @@ namespace phantom{
 		
 		protocol::Node getNode(NodeFrm::POINTER node, const Location& location);
 	public:
+		typedef std::pair<std::string, std::string> KeyValue;
+
 		static const char EVEN_PREFIX = 0x00;
 		static const char ODD_PREFIX = 0x01;
 		static const char LEAF_PREFIX = 0x02;
@@ -95,14 +132,33 @@ namespace phantom{
 
 		void GetAll(const std::string& key, std::vector<std::string>& values);
 
+		//visit every leaf value stored in db, without loading them all into memory
+		void ForEach(const std::function<void(const std::string&)> &visit);
+
 		//return false if not exists else return true
 		bool Delete(const std::string& key);
 
+		//same as Set for every item but in one walk from the root, items are sorted by key here.
+		//return the count of keys that were not in the trie
+		size_t SetBatch(std::vector<KeyValue> &items);
+
+		//same as Delete for every key in one walk from the root, keys are sorted here
+		size_t DeleteBatch(std::vector<std::string> &keys);
+
 		HASH GetRootHash();
 
-		void UpdateHash();
+		//hash the modified subtrees on the pool if not NULL, the root is identical to the serial one
+		void UpdateHash(utils::ThreadPool *pool = NULL, size_t worker_count = 0);
+
+		//statistics of the last UpdateHash, in microseconds
+		int64_t hash_wall_time_;
+		int64_t hash_work_time_;
+		size_t hash_task_count_;
 
 		void FreeMemory(int depth);
+
+		//keep decoded nodes across FreeMemory, only for a trie whose locations are unique in the cache
+		void SetNodeCache(std::shared_ptr<NodeCache> cache);
 	
 		protocol::Node GetNode(const Location& key);
 
@@ -122,6 +122,22 @@ namespace phantom {
 		hash_type_ = 0; // 0 : SHA256, 1 :SM2
 		queue_limit_ = 10240;
 		queue_per_account_txs_limit_ = 64;
+		queue_shard_count_ = 0;
+		queue_byte_limit_ = 256;
+		hash_thread_count_ = 0;
+		execute_thread_count_ = 0;
+		persist_pipeline_ = false;
+		catch_up_group_size_ = 16;
+		catch_up_distance_ = 5;
+		catch_up_unsynced_ = false;
+		state_sync_distance_ = 0;
+		state_sync_interval_ = 100;
+		sync_window_ = 256;
+		sync_verify_thread_count_ = 2;
+		trie_cache_size_ = 256;
+		signature_cache_size_ = 100000;
+		admission_thread_count_ = 0;
+		admission_queue_size_ = 10240;
 	}
 
 	LedgerConfigure::~LedgerConfigure() {
@@ -138,9 +154,25 @@ namespace phantom {
 		Configure::GetValue(value, "max_trans_in_memory", max_trans_in_memory_);
 		Configure::GetValue(value, "hardfork_points", hardfork_points_);
 		Configure::GetValue(value, "use_atom_map", use_atom_map_);
+		Configure::GetValue(value, "hash_thread_count", hash_thread_count_);
+		Configure::GetValue(value, "execute_thread_count", execute_thread_count_);
+		Configure::GetValue(value, "persist_pipeline", persist_pipeline_);
+		Configure::GetValue(value, "catch_up_group_size", catch_up_group_size_);
+		Configure::GetValue(value, "catch_up_distance", catch_up_distance_);
+		Configure::GetValue(value, "catch_up_unsynced", catch_up_unsynced_);
+		Configure::GetValue(value, "state_sync_distance", state_sync_distance_);
+		Configure::GetValue(value, "state_sync_interval", state_sync_interval_);
+		Configure::GetValue(value, "sync_window", sync_window_);
+		Configure::GetValue(value, "sync_verify_thread_count", sync_verify_thread_count_);
+		Configure::GetValue(value, "trie_cache_size", trie_cache_size_);
+		Configure::GetValue(value, "signature_cache_size", signature_cache_size_);
 
 		Configure::GetValue(value["tx_pool"], "queue_limit", queue_limit_);
         Configure::GetValue(value["tx_pool"], "queue_per_account_txs_limit", queue_per_account_txs_limit_);
+		Configure::GetValue(value["tx_pool"], "queue_shard_count", queue_shard_count_);
+		Configure::GetValue(value["tx_pool"], "queue_byte_limit", queue_byte_limit_);
+		Configure::GetValue(value["tx_pool"], "admission_thread_count", admission_thread_count_);
+		Configure::GetValue(value["tx_pool"], "admission_queue_size", admission_queue_size_);
 
 		if (validation_privatekey_.empty()) {
 			PrivateKey tmp_priv(SIGNTYPE_ED25519);
@@ -88,8 +88,24 @@ namespace phantom {
 		uint32_t max_apply_ledger_per_round_;
 		uint32_t queue_limit_;
 		uint32_t queue_per_account_txs_limit_;
+		uint32_t queue_shard_count_; //shards of the transaction pool locked on their own, 0 for one per core
+		uint32_t queue_byte_limit_; //MB of transactions the pool holds before the lowest priced are dropped, 0 for no bound. A tx counts three times its full data, held parsed and serialized
 		utils::StringList hardfork_points_;
 		bool use_atom_map_;
+		uint32_t hash_thread_count_; //0 or 1 for serial account tree hashing
+		uint32_t execute_thread_count_; //0 or 1 for serial transaction execution
+		bool persist_pipeline_; //write closed ledgers on their own thread while the next one executes
+		uint32_t catch_up_group_size_; //ledgers replayed during catch-up written in one batch, 0 or 1 to write each
+		int64_t catch_up_distance_; //ledgers behind the network below which each ledger is written on its own
+		bool catch_up_unsynced_; //write catch-up groups without syncing the log and flush the dbs after each group
+		int64_t state_sync_distance_; //ledgers behind the network from which the account state is fetched instead of replayed, 0 to always replay
+		uint32_t state_sync_interval_; //ledgers between the checkpoints pinned to serve state sync, 0 to not serve it
+		int64_t sync_window_; //ledgers after the last closed one asked from the peers at once during catch-up
+		uint32_t sync_verify_thread_count_; //workers checking the proofs of downloaded ledgers ahead of replay, 0 to check on replay
+		uint32_t trie_cache_size_; //MB of decoded account tree nodes kept across ledgers, 0 to disable
+		uint32_t signature_cache_size_; //count of verified transaction signatures remembered, 0 to disable
+		uint32_t admission_thread_count_; //workers decoding and verifying received transactions, 0 for one per core
+		uint32_t admission_queue_size_; //received transactions waiting for admission before new ones are refused
 		bool Load(const Json::Value &value);
 	};
 
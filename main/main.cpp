@@ -27,6 +27,8 @@
 #include <api/websocket_server.h>
 #include <api/console.h>
 #include <ledger/contract_manager.h>
+#include <ledger/signature_cache.h>
+#include <glue/transaction_admission.h>
 #include <monitor/monitor_manager.h>
 #include "configure.h"
 
@@ -47,6 +49,7 @@ int main(int argc, char *argv[]){
 	phantom::Console::InitInstance();
 	phantom::PeerManager::InitInstance();
 	phantom::LedgerManager::InitInstance();
+	phantom::SignatureCache::InitInstance();
 	phantom::ConsensusManager::InitInstance();
 	phantom::GlueManager::InitInstance();
 	phantom::WebSocketServer::InitInstance();
@@ -59,6 +62,31 @@ int main(int argc, char *argv[]){
 		return 1;
 	}
 
+	if (arg.bench_admission_ > 0){
+		phantom::TransactionAdmission::Bench(arg.bench_admission_);
+		return 1;
+	}
+
+	if (arg.bench_account_read_ > 0){
+		phantom::LedgerManager::BenchAccountRead(arg.bench_account_read_);
+		return 1;
+	}
+
+	if (arg.bench_trie_ > 0){
+		phantom::KVTrie::Bench(arg.bench_trie_);
+		return 1;
+	}
+
+	if (arg.bench_top_transaction_ > 0){
+		phantom::TransactionQueue::Bench(arg.bench_top_transaction_, 10000);
+		return 1;
+	}
+
+	if (arg.crash_persist_ > 0){
+		phantom::LedgerPersister::CrashTest(arg.crash_persist_);
+		return 1;
+	}
+
 	do {
 		utils::ObjectExit object_exit;
 		phantom::InstallSignal();
@@ -112,6 +140,16 @@ int main(int argc, char *argv[]){
 		LOG_INFO("Initialize logger successful");
 
 		// end run command
+		if (arg.migrate_column_families_ > 0) {
+			return phantom::Storage::MigrateColumnFamilies(config.db_configure_, arg.migrate_column_families_ > 1) ? 1 : -1;
+		}
+		if (!arg.create_checkpoint_.empty()) {
+			return phantom::Storage::CreateCheckpoint(config.db_configure_, arg.create_checkpoint_) ? 1 : -1;
+		}
+		if (!arg.restore_checkpoint_.empty() && !phantom::Storage::RestoreCheckpoint(config.db_configure_, arg.restore_checkpoint_)) {
+			break;
+		}
+
 		phantom::Storage &storage = phantom::Storage::Instance();
 		LOG_INFO("keyvalue(%s),account(%s),ledger(%s)", 
 			config.db_configure_.keyvalue_db_path_.c_str(),
@@ -153,6 +191,19 @@ int main(int argc, char *argv[]){
 			return 1;
 		}
 
+		if (arg.check_account_index_) {
+			phantom::LedgerManager &ledgermanger = phantom::LedgerManager::Instance();
+			if (!ledgermanger.Initialize()) {
+				LOG_ERROR("legder manger init error!!!");
+				return -1;
+			}
+			if (ledgermanger.CheckAccountIndex(true) < 0) {
+				LOG_ERROR("Check account index failed");
+				return -1;
+			}
+			return 1;
+		}
+
 		phantom::Global &global = phantom::Global::Instance();
 		if (!phantom::g_enable_ || !global.Initialize()){
 			LOG_ERROR_ERRNO("Initialize global variable failed", STD_ERR_CODE, STD_ERR_DESC);
@@ -249,6 +300,7 @@ int main(int argc, char *argv[]){
 	phantom::SlowTimer::ExitInstance();
 	phantom::GlueManager::ExitInstance();
 	phantom::LedgerManager::ExitInstance();
+	phantom::SignatureCache::ExitInstance();
 	phantom::PeerManager::ExitInstance();
 	phantom::WebSocketServer::ExitInstance();
 	phantom::WebServer::ExitInstance();
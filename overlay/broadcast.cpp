@@ -79,6 +79,21 @@ namespace phantom{
 		}
 	}
 
+	void Broadcast::Remove(const std::string &data) {
+		std::string hash = HashWrapper::Crypto(data);
+		utils::MutexGuard guard(mutex_msg_sending_);
+		BroadcastRecordMap::iterator result = records_.find(hash);
+		if (result == records_.end()){
+			return;
+		}
+
+		BroadcastRecordCoupleMap::iterator couple = records_couple_.find(result->second->time_stamp_);
+		if (couple != records_couple_.end() && couple->second == hash){
+			records_couple_.erase(couple);
+		}
+		records_.erase(result);
+	}
+
 	void Broadcast::OnTimer(){
 		utils::MutexGuard guard(mutex_msg_sending_);
 		int64_t current_time = utils::Timestamp::HighResolution();
@@ -56,6 +56,8 @@ namespace phantom{
 
 		bool Add(int64_t type, const std::string &data, int64_t peer_id);
 		void Send(int64_t type, const std::string &data);
+		//forget a message added but not handled, so that it is taken again when it comes next
+		void Remove(const std::string &data);
 		void OnTimer();
 		size_t GetRecordSize() const { return records_.size(); };
 	};
@@ -43,10 +43,12 @@ namespace phantom {
 		request_methods_[protocol::OVERLAY_MSGTYPE_LEDGERS] = std::bind(&PeerNetwork::OnMethodGetLedgers, this, std::placeholders::_1, std::placeholders::_2);
 		request_methods_[protocol::OVERLAY_MSGTYPE_PBFT] = std::bind(&PeerNetwork::OnMethodPbft, this, std::placeholders::_1, std::placeholders::_2);
 		request_methods_[protocol::OVERLAY_MSGTYPE_LEDGER_UPGRADE_NOTIFY] = std::bind(&PeerNetwork::OnMethodLedgerUpNotify, this, std::placeholders::_1, std::placeholders::_2);
+		request_methods_[protocol::OVERLAY_MSGTYPE_ACCOUNT_TREE] = std::bind(&PeerNetwork::OnMethodGetAccountTree, this, std::placeholders::_1, std::placeholders::_2);
 
 
 		response_methods_[protocol::OVERLAY_MSGTYPE_LEDGERS] = std::bind(&PeerNetwork::OnMethodLedgers, this, std::placeholders::_1, std::placeholders::_2);
 		response_methods_[protocol::OVERLAY_MSGTYPE_HELLO] = std::bind(&PeerNetwork::OnMethodHelloResponse, this, std::placeholders::_1, std::placeholders::_2);
+		response_methods_[protocol::OVERLAY_MSGTYPE_ACCOUNT_TREE] = std::bind(&PeerNetwork::OnMethodAccountTree, this, std::placeholders::_1, std::placeholders::_2);
 		last_update_peercache_time_ = 0;
 	}
 
@@ -234,17 +236,27 @@ namespace phantom {
 			return false;
 		}
 
+		//refuse before marking it received, so the transaction can come again from other peers
+		GlueManager &glue = GlueManager::Instance();
+		if (glue.IsAdmissionBusy()) {
+			LOG_WARN("Transaction admission is busy, drop the transaction from peer(" FMT_I64 ")", conn_id);
+			return true;
+		}
+
 		if (ReceiveBroadcastMsg(protocol::OVERLAY_MSGTYPE_TRANSACTION, message.data(), conn_id)) {
-			protocol::TransactionEnv tran;
-			tran.ParseFromString(message.data());
-			TransactionFrm::pointer tran_ptr = std::make_shared<TransactionFrm>(tran);
-			//switch to main thread
-			Global::Instance().GetIoService().post([tran_ptr, message, this]() {
-				Result ig_err;
-				if (GlueManager::Instance().OnTransaction(tran_ptr, ig_err)) {
-					BroadcastMsg(message.type(), message.data());
+			//decoded and verified by the admission workers, imported and relayed on main thread
+			int64_t type = message.type();
+			std::string data = message.data();
+			bool submitted = glue.SubmitTransaction(data, [type, data, this](TransactionFrm::pointer tx, const Result &err) {
+				if (err.code() == protocol::ERRCODE_SUCCESS) {
+					BroadcastMsg(type, data);
 				}
 			});
+			//the admission filled up since the check above
+			if (!submitted) {
+				LOG_WARN("Transaction admission is busy, drop the transaction from peer(" FMT_I64 ")", conn_id);
+				ForgetBroadcastMsg(data);
+			}
 		}
 		return true;
 	}
@@ -263,6 +275,20 @@ namespace phantom {
 		return true;
 	}
 
+	bool PeerNetwork::OnMethodGetAccountTree(protocol::WsMessage &message, int64_t conn_id) {
+		protocol::GetAccountTree get_account_tree;
+		get_account_tree.ParseFromString(message.data());
+		LedgerManager::Instance().OnRequestAccountTree(get_account_tree, conn_id);
+		return true;
+	}
+
+	bool PeerNetwork::OnMethodAccountTree(protocol::WsMessage &message, int64_t conn_id) {
+		protocol::AccountTree account_tree;
+		account_tree.ParseFromString(message.data());
+		LedgerManager::Instance().OnReceiveAccountTree(account_tree, conn_id);
+		return true;
+	}
+
 	bool PeerNetwork::OnMethodHelloResponse(protocol::WsMessage &message, int64_t conn_id) {
 		utils::MutexGuard guard(conns_list_lock_);
 		Peer *peer = (Peer *)GetConnection(conn_id);
@@ -772,6 +798,10 @@ namespace phantom {
 		return broadcast_.Add(type, data, peer_id);
 	}
 
+	void PeerNetwork::ForgetBroadcastMsg(const std::string &data) {
+		broadcast_.Remove(data);
+	}
+
 	bool PeerNetwork::SendMsgToPeer(int64_t peer_id, WsMessagePointer message) {
 		utils::MutexGuard guard(conns_list_lock_);
 		Peer *peer = (Peer *)GetConnection(peer_id);
@@ -77,6 +77,8 @@ namespace phantom {
 		bool OnMethodTransaction(protocol::WsMessage &message, int64_t conn_id);
 		bool OnMethodGetLedgers(protocol::WsMessage &message, int64_t conn_id);
 		bool OnMethodLedgers(protocol::WsMessage &message, int64_t conn_id);
+		bool OnMethodGetAccountTree(protocol::WsMessage &message, int64_t conn_id);
+		bool OnMethodAccountTree(protocol::WsMessage &message, int64_t conn_id);
 		bool OnMethodPbft(protocol::WsMessage &message, int64_t conn_id);
 		bool OnMethodLedgerUpNotify(protocol::WsMessage &message, int64_t conn_id);
 		bool OnMethodHelloResponse(protocol::WsMessage &message, int64_t conn_id);
@@ -102,6 +104,7 @@ namespace phantom {
 		void AddReceivedPeers(const utils::StringMap &item);
 		void BroadcastMsg(int64_t type, const std::string &data);
 		bool ReceiveBroadcastMsg(int64_t type, const std::string &data, int64_t peer_id);
+		void ForgetBroadcastMsg(const std::string &data);
 
 		void GetPeers(Json::Value &peers);
 
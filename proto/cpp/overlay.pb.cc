@@ -40,6 +40,13 @@ const ::google::protobuf::Descriptor* Ledgers_descriptor_ = NULL;
 const ::google::protobuf::internal::GeneratedMessageReflection*
   Ledgers_reflection_ = NULL;
 const ::google::protobuf::EnumDescriptor* Ledgers_SyncCode_descriptor_ = NULL;
+const ::google::protobuf::Descriptor* GetAccountTree_descriptor_ = NULL;
+const ::google::protobuf::internal::GeneratedMessageReflection*
+  GetAccountTree_reflection_ = NULL;
+const ::google::protobuf::Descriptor* AccountTree_descriptor_ = NULL;
+const ::google::protobuf::internal::GeneratedMessageReflection*
+  AccountTree_reflection_ = NULL;
+const ::google::protobuf::EnumDescriptor* AccountTree_SyncCode_descriptor_ = NULL;
 const ::google::protobuf::Descriptor* DontHave_descriptor_ = NULL;
 const ::google::protobuf::internal::GeneratedMessageReflection*
   DontHave_reflection_ = NULL;
@@ -189,7 +196,47 @@ void protobuf_AssignDesc_overlay_2eproto() {
       GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Ledgers, _internal_metadata_),
       GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Ledgers, _is_default_instance_));
   Ledgers_SyncCode_descriptor_ = Ledgers_descriptor_->enum_type(0);
-  DontHave_descriptor_ = file->message_type(6);
+  GetAccountTree_descriptor_ = file->message_type(6);
+  static const int GetAccountTree_offsets_[3] = {
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(GetAccountTree, ledger_seq_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(GetAccountTree, keys_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(GetAccountTree, timestamp_),
+  };
+  GetAccountTree_reflection_ =
+    ::google::protobuf::internal::GeneratedMessageReflection::NewGeneratedMessageReflection(
+      GetAccountTree_descriptor_,
+      GetAccountTree::default_instance_,
+      GetAccountTree_offsets_,
+      -1,
+      -1,
+      -1,
+      sizeof(GetAccountTree),
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(GetAccountTree, _internal_metadata_),
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(GetAccountTree, _is_default_instance_));
+  AccountTree_descriptor_ = file->message_type(7);
+  static const int AccountTree_offsets_[8] = {
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(AccountTree, sync_code_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(AccountTree, ledger_seq_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(AccountTree, values_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(AccountTree, ledger_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(AccountTree, consensus_value_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(AccountTree, next_value_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(AccountTree, next_proof_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(AccountTree, fees_),
+  };
+  AccountTree_reflection_ =
+    ::google::protobuf::internal::GeneratedMessageReflection::NewGeneratedMessageReflection(
+      AccountTree_descriptor_,
+      AccountTree::default_instance_,
+      AccountTree_offsets_,
+      -1,
+      -1,
+      -1,
+      sizeof(AccountTree),
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(AccountTree, _internal_metadata_),
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(AccountTree, _is_default_instance_));
+  AccountTree_SyncCode_descriptor_ = AccountTree_descriptor_->enum_type(0);
+  DontHave_descriptor_ = file->message_type(8);
   static const int DontHave_offsets_[2] = {
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(DontHave, type_),
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(DontHave, hash_),
@@ -205,7 +252,7 @@ void protobuf_AssignDesc_overlay_2eproto() {
       sizeof(DontHave),
       GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(DontHave, _internal_metadata_),
       GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(DontHave, _is_default_instance_));
-  LedgerUpgradeNotify_descriptor_ = file->message_type(7);
+  LedgerUpgradeNotify_descriptor_ = file->message_type(9);
   static const int LedgerUpgradeNotify_offsets_[3] = {
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(LedgerUpgradeNotify, nonce_),
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(LedgerUpgradeNotify, upgrade_),
@@ -222,7 +269,7 @@ void protobuf_AssignDesc_overlay_2eproto() {
       sizeof(LedgerUpgradeNotify),
       GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(LedgerUpgradeNotify, _internal_metadata_),
       GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(LedgerUpgradeNotify, _is_default_instance_));
-  EntryList_descriptor_ = file->message_type(8);
+  EntryList_descriptor_ = file->message_type(10);
   static const int EntryList_offsets_[1] = {
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(EntryList, entry_),
   };
@@ -237,7 +284,7 @@ void protobuf_AssignDesc_overlay_2eproto() {
       sizeof(EntryList),
       GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(EntryList, _internal_metadata_),
       GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(EntryList, _is_default_instance_));
-  ChainHello_descriptor_ = file->message_type(9);
+  ChainHello_descriptor_ = file->message_type(11);
   static const int ChainHello_offsets_[2] = {
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ChainHello, api_list_),
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ChainHello, timestamp_),
@@ -253,7 +300,7 @@ void protobuf_AssignDesc_overlay_2eproto() {
       sizeof(ChainHello),
       GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ChainHello, _internal_metadata_),
       GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ChainHello, _is_default_instance_));
-  ChainStatus_descriptor_ = file->message_type(10);
+  ChainStatus_descriptor_ = file->message_type(12);
   static const int ChainStatus_offsets_[5] = {
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ChainStatus, self_addr_),
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ChainStatus, ledger_version_),
@@ -272,7 +319,7 @@ void protobuf_AssignDesc_overlay_2eproto() {
       sizeof(ChainStatus),
       GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ChainStatus, _internal_metadata_),
       GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ChainStatus, _is_default_instance_));
-  ChainPeerMessage_descriptor_ = file->message_type(11);
+  ChainPeerMessage_descriptor_ = file->message_type(13);
   static const int ChainPeerMessage_offsets_[3] = {
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ChainPeerMessage, src_peer_addr_),
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ChainPeerMessage, des_peer_addrs_),
@@ -289,7 +336,7 @@ void protobuf_AssignDesc_overlay_2eproto() {
       sizeof(ChainPeerMessage),
       GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ChainPeerMessage, _internal_metadata_),
       GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ChainPeerMessage, _is_default_instance_));
-  ChainSubscribeTx_descriptor_ = file->message_type(12);
+  ChainSubscribeTx_descriptor_ = file->message_type(14);
   static const int ChainSubscribeTx_offsets_[1] = {
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ChainSubscribeTx, address_),
   };
@@ -304,7 +351,7 @@ void protobuf_AssignDesc_overlay_2eproto() {
       sizeof(ChainSubscribeTx),
       GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ChainSubscribeTx, _internal_metadata_),
       GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ChainSubscribeTx, _is_default_instance_));
-  ChainResponse_descriptor_ = file->message_type(13);
+  ChainResponse_descriptor_ = file->message_type(15);
   static const int ChainResponse_offsets_[2] = {
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ChainResponse, error_code_),
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ChainResponse, error_desc_),
@@ -320,7 +367,7 @@ void protobuf_AssignDesc_overlay_2eproto() {
       sizeof(ChainResponse),
       GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ChainResponse, _internal_metadata_),
       GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ChainResponse, _is_default_instance_));
-  ChainTxStatus_descriptor_ = file->message_type(14);
+  ChainTxStatus_descriptor_ = file->message_type(16);
   static const int ChainTxStatus_offsets_[9] = {
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ChainTxStatus, status_),
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ChainTxStatus, tx_hash_),
@@ -371,6 +418,10 @@ void protobuf_RegisterTypes(const ::std::string&) {
       GetLedgers_descriptor_, &GetLedgers::default_instance());
   ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
       Ledgers_descriptor_, &Ledgers::default_instance());
+  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
+      GetAccountTree_descriptor_, &GetAccountTree::default_instance());
+  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
+      AccountTree_descriptor_, &AccountTree::default_instance());
   ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
       DontHave_descriptor_, &DontHave::default_instance());
   ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
@@ -406,6 +457,10 @@ void protobuf_ShutdownFile_overlay_2eproto() {
   delete GetLedgers_reflection_;
   delete Ledgers::default_instance_;
   delete Ledgers_reflection_;
+  delete GetAccountTree::default_instance_;
+  delete GetAccountTree_reflection_;
+  delete AccountTree::default_instance_;
+  delete AccountTree_reflection_;
   delete DontHave::default_instance_;
   delete DontHave_reflection_;
   delete LedgerUpgradeNotify::default_instance_;
@@ -454,44 +509,54 @@ void protobuf_AddDesc_overlay_2eproto() {
     "2\032.protocol.Ledgers.SyncCode\022\017\n\007max_seq\030"
     "\003 \001(\003\022\r\n\005proof\030\004 \001(\014\"[\n\010SyncCode\022\006\n\002OK\020\000"
     "\022\017\n\013OUT_OF_SYNC\020\001\022\022\n\016OUT_OF_LEDGERS\020\002\022\010\n"
-    "\004BUSY\020\003\022\n\n\006REFUSE\020\004\022\014\n\010INTERNAL\020\005\"&\n\010Don"
-    "tHave\022\014\n\004type\030\001 \001(\003\022\014\n\004hash\030\002 \001(\014\"v\n\023Led"
-    "gerUpgradeNotify\022\r\n\005nonce\030\001 \001(\003\022(\n\007upgra"
-    "de\030\002 \001(\0132\027.protocol.LedgerUpgrade\022&\n\tsig"
-    "nature\030\003 \001(\0132\023.protocol.Signature\"\032\n\tEnt"
-    "ryList\022\r\n\005entry\030\001 \003(\014\"M\n\nChainHello\022,\n\010a"
-    "pi_list\030\001 \003(\0162\032.protocol.ChainMessageTyp"
-    "e\022\021\n\ttimestamp\030\002 \001(\003\"}\n\013ChainStatus\022\021\n\ts"
-    "elf_addr\030\001 \001(\t\022\026\n\016ledger_version\030\002 \001(\003\022\027"
-    "\n\017monitor_version\030\003 \001(\003\022\027\n\017phantom_versi"
-    "on\030\004 \001(\t\022\021\n\ttimestamp\030\005 \001(\003\"O\n\020ChainPeer"
-    "Message\022\025\n\rsrc_peer_addr\030\001 \001(\t\022\026\n\016des_pe"
-    "er_addrs\030\002 \003(\t\022\014\n\004data\030\003 \001(\014\"#\n\020ChainSub"
-    "scribeTx\022\017\n\007address\030\001 \003(\t\"7\n\rChainRespon"
-    "se\022\022\n\nerror_code\030\001 \001(\005\022\022\n\nerror_desc\030\002 \001"
-    "(\t\"\325\002\n\rChainTxStatus\0220\n\006status\030\001 \001(\0162 .p"
-    "rotocol.ChainTxStatus.TxStatus\022\017\n\007tx_has"
-    "h\030\002 \001(\t\022\026\n\016source_address\030\003 \001(\t\022\032\n\022sourc"
-    "e_account_seq\030\004 \001(\003\022\022\n\nledger_seq\030\005 \001(\003\022"
-    "\027\n\017new_account_seq\030\006 \001(\003\022\'\n\nerror_code\030\007"
-    " \001(\0162\023.protocol.ERRORCODE\022\022\n\nerror_desc\030"
-    "\010 \001(\t\022\021\n\ttimestamp\030\t \001(\003\"P\n\010TxStatus\022\r\n\t"
-    "UNDEFINED\020\000\022\r\n\tCONFIRMED\020\001\022\013\n\007PENDING\020\002\022"
-    "\014\n\010COMPLETE\020\003\022\013\n\007FAILURE\020\004*\203\002\n\024OVERLAY_M"
-    "ESSAGE_TYPE\022\030\n\024OVERLAY_MSGTYPE_NONE\020\000\022\030\n"
-    "\024OVERLAY_MSGTYPE_PING\020\001\022\031\n\025OVERLAY_MSGTY"
-    "PE_HELLO\020\002\022\031\n\025OVERLAY_MSGTYPE_PEERS\020\003\022\037\n"
-    "\033OVERLAY_MSGTYPE_TRANSACTION\020\004\022\033\n\027OVERLA"
-    "Y_MSGTYPE_LEDGERS\020\005\022\030\n\024OVERLAY_MSGTYPE_P"
-    "BFT\020\006\022)\n%OVERLAY_MSGTYPE_LEDGER_UPGRADE_"
-    "NOTIFY\020\007*\372\001\n\020ChainMessageType\022\023\n\017CHAIN_T"
-    "YPE_NONE\020\000\022\017\n\013CHAIN_HELLO\020\n\022\023\n\017CHAIN_TX_"
-    "STATUS\020\013\022\025\n\021CHAIN_PEER_ONLINE\020\014\022\026\n\022CHAIN"
-    "_PEER_OFFLINE\020\r\022\026\n\022CHAIN_PEER_MESSAGE\020\016\022"
-    "\033\n\027CHAIN_SUBMITTRANSACTION\020\017\022\027\n\023CHAIN_LE"
-    "DGER_HEADER\020\020\022\026\n\022CHAIN_SUBSCRIBE_TX\020\021\022\026\n"
-    "\022CHAIN_TX_ENV_STORE\020\022B&\n$org.phantom.sdk"
-    ".core.extend.protobufb\006proto3", 2229);
+    "\004BUSY\020\003\022\n\n\006REFUSE\020\004\022\014\n\010INTERNAL\020\005\"E\n\016Get"
+    "AccountTree\022\022\n\nledger_seq\030\001 \001(\003\022\014\n\004keys\030"
+    "\002 \003(\014\022\021\n\ttimestamp\030\003 \001(\003\"\226\002\n\013AccountTree"
+    "\0221\n\tsync_code\030\001 \001(\0162\036.protocol.AccountTr"
+    "ee.SyncCode\022\022\n\nledger_seq\030\002 \001(\003\022\016\n\006value"
+    "s\030\003 \003(\014\022 \n\006ledger\030\004 \001(\0132\020.protocol.Ledge"
+    "r\022\027\n\017consensus_value\030\005 \001(\014\022\022\n\nnext_value"
+    "\030\006 \001(\014\022\022\n\nnext_proof\030\007 \001(\014\022\014\n\004fees\030\010 \001(\014"
+    "\"\?\n\010SyncCode\022\006\n\002OK\020\000\022\r\n\tNOT_READY\020\001\022\016\n\nN"
+    "OT_PINNED\020\002\022\014\n\010INTERNAL\020\003\"&\n\010DontHave\022\014\n"
+    "\004type\030\001 \001(\003\022\014\n\004hash\030\002 \001(\014\"v\n\023LedgerUpgra"
+    "deNotify\022\r\n\005nonce\030\001 \001(\003\022(\n\007upgrade\030\002 \001(\013"
+    "2\027.protocol.LedgerUpgrade\022&\n\tsignature\030\003"
+    " \001(\0132\023.protocol.Signature\"\032\n\tEntryList\022\r"
+    "\n\005entry\030\001 \003(\014\"M\n\nChainHello\022,\n\010api_list\030"
+    "\001 \003(\0162\032.protocol.ChainMessageType\022\021\n\ttim"
+    "estamp\030\002 \001(\003\"}\n\013ChainStatus\022\021\n\tself_addr"
+    "\030\001 \001(\t\022\026\n\016ledger_version\030\002 \001(\003\022\027\n\017monito"
+    "r_version\030\003 \001(\003\022\027\n\017phantom_version\030\004 \001(\t"
+    "\022\021\n\ttimestamp\030\005 \001(\003\"O\n\020ChainPeerMessage\022"
+    "\025\n\rsrc_peer_addr\030\001 \001(\t\022\026\n\016des_peer_addrs"
+    "\030\002 \003(\t\022\014\n\004data\030\003 \001(\014\"#\n\020ChainSubscribeTx"
+    "\022\017\n\007address\030\001 \003(\t\"7\n\rChainResponse\022\022\n\ner"
+    "ror_code\030\001 \001(\005\022\022\n\nerror_desc\030\002 \001(\t\"\325\002\n\rC"
+    "hainTxStatus\0220\n\006status\030\001 \001(\0162 .protocol."
+    "ChainTxStatus.TxStatus\022\017\n\007tx_hash\030\002 \001(\t\022"
+    "\026\n\016source_address\030\003 \001(\t\022\032\n\022source_accoun"
+    "t_seq\030\004 \001(\003\022\022\n\nledger_seq\030\005 \001(\003\022\027\n\017new_a"
+    "ccount_seq\030\006 \001(\003\022\'\n\nerror_code\030\007 \001(\0162\023.p"
+    "rotocol.ERRORCODE\022\022\n\nerror_desc\030\010 \001(\t\022\021\n"
+    "\ttimestamp\030\t \001(\003\"P\n\010TxStatus\022\r\n\tUNDEFINE"
+    "D\020\000\022\r\n\tCONFIRMED\020\001\022\013\n\007PENDING\020\002\022\014\n\010COMPL"
+    "ETE\020\003\022\013\n\007FAILURE\020\004*\245\002\n\024OVERLAY_MESSAGE_T"
+    "YPE\022\030\n\024OVERLAY_MSGTYPE_NONE\020\000\022\030\n\024OVERLAY"
+    "_MSGTYPE_PING\020\001\022\031\n\025OVERLAY_MSGTYPE_HELLO"
+    "\020\002\022\031\n\025OVERLAY_MSGTYPE_PEERS\020\003\022\037\n\033OVERLAY"
+    "_MSGTYPE_TRANSACTION\020\004\022\033\n\027OVERLAY_MSGTYP"
+    "E_LEDGERS\020\005\022\030\n\024OVERLAY_MSGTYPE_PBFT\020\006\022)\n"
+    "%OVERLAY_MSGTYPE_LEDGER_UPGRADE_NOTIFY\020\007"
+    "\022 \n\034OVERLAY_MSGTYPE_ACCOUNT_TREE\020\010*\372\001\n\020C"
+    "hainMessageType\022\023\n\017CHAIN_TYPE_NONE\020\000\022\017\n\013"
+    "CHAIN_HELLO\020\n\022\023\n\017CHAIN_TX_STATUS\020\013\022\025\n\021CH"
+    "AIN_PEER_ONLINE\020\014\022\026\n\022CHAIN_PEER_OFFLINE\020"
+    "\r\022\026\n\022CHAIN_PEER_MESSAGE\020\016\022\033\n\027CHAIN_SUBMI"
+    "TTRANSACTION\020\017\022\027\n\023CHAIN_LEDGER_HEADER\020\020\022"
+    "\026\n\022CHAIN_SUBSCRIBE_TX\020\021\022\026\n\022CHAIN_TX_ENV_"
+    "STORE\020\022B&\n$org.phantom.sdk.core.extend.p"
+    "rotobufb\006proto3", 2615);
   ::google::protobuf::MessageFactory::InternalRegisterGeneratedFile(
     "overlay.proto", &protobuf_RegisterTypes);
   Hello::default_instance_ = new Hello();
@@ -500,6 +565,8 @@ void protobuf_AddDesc_overlay_2eproto() {
   Peers::default_instance_ = new Peers();
   GetLedgers::default_instance_ = new GetLedgers();
   Ledgers::default_instance_ = new Ledgers();
+  GetAccountTree::default_instance_ = new GetAccountTree();
+  AccountTree::default_instance_ = new AccountTree();
   DontHave::default_instance_ = new DontHave();
   LedgerUpgradeNotify::default_instance_ = new LedgerUpgradeNotify();
   EntryList::default_instance_ = new EntryList();
@@ -515,6 +582,8 @@ void protobuf_AddDesc_overlay_2eproto() {
   Peers::default_instance_->InitAsDefaultInstance();
   GetLedgers::default_instance_->InitAsDefaultInstance();
   Ledgers::default_instance_->InitAsDefaultInstance();
+  GetAccountTree::default_instance_->InitAsDefaultInstance();
+  AccountTree::default_instance_->InitAsDefaultInstance();
   DontHave::default_instance_->InitAsDefaultInstance();
   LedgerUpgradeNotify::default_instance_->InitAsDefaultInstance();
   EntryList::default_instance_->InitAsDefaultInstance();
@@ -547,6 +616,7 @@ bool OVERLAY_MESSAGE_TYPE_IsValid(int value) {
     case 5:
     case 6:
     case 7:
+    case 8:
       return true;
     default:
       return false;
@@ -3292,6 +3362,1226 @@ void Ledgers::clear_proof() {
 
 // ===================================================================
 
+#if !defined(_MSC_VER) || _MSC_VER >= 1900
+const int GetAccountTree::kLedgerSeqFieldNumber;
+const int GetAccountTree::kKeysFieldNumber;
+const int GetAccountTree::kTimestampFieldNumber;
+#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+
+GetAccountTree::GetAccountTree()
+  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
+  SharedCtor();
+  // @@protoc_insertion_point(constructor:protocol.GetAccountTree)
+}
+
+void GetAccountTree::InitAsDefaultInstance() {
+  _is_default_instance_ = true;
+}
+
+GetAccountTree::GetAccountTree(const GetAccountTree& from)
+  : ::google::protobuf::Message(),
+    _internal_metadata_(NULL) {
+  SharedCtor();
+  MergeFrom(from);
+  // @@protoc_insertion_point(copy_constructor:protocol.GetAccountTree)
+}
+
+void GetAccountTree::SharedCtor() {
+    _is_default_instance_ = false;
+  ::google::protobuf::internal::GetEmptyString();
+  _cached_size_ = 0;
+  ledger_seq_ = GOOGLE_LONGLONG(0);
+  timestamp_ = GOOGLE_LONGLONG(0);
+}
+
+GetAccountTree::~GetAccountTree() {
+  // @@protoc_insertion_point(destructor:protocol.GetAccountTree)
+  SharedDtor();
+}
+
+void GetAccountTree::SharedDtor() {
+  if (this != default_instance_) {
+  }
+}
+
+void GetAccountTree::SetCachedSize(int size) const {
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+}
+const ::google::protobuf::Descriptor* GetAccountTree::descriptor() {
+  protobuf_AssignDescriptorsOnce();
+  return GetAccountTree_descriptor_;
+}
+
+const GetAccountTree& GetAccountTree::default_instance() {
+  if (default_instance_ == NULL) protobuf_AddDesc_overlay_2eproto();
+  return *default_instance_;
+}
+
+GetAccountTree* GetAccountTree::default_instance_ = NULL;
+
+GetAccountTree* GetAccountTree::New(::google::protobuf::Arena* arena) const {
+  GetAccountTree* n = new GetAccountTree;
+  if (arena != NULL) {
+    arena->Own(n);
+  }
+  return n;
+}
+
+void GetAccountTree::Clear() {
+// @@protoc_insertion_point(message_clear_start:protocol.GetAccountTree)
+  ledger_seq_ = GOOGLE_LONGLONG(0);
+  timestamp_ = GOOGLE_LONGLONG(0);
+  keys_.Clear();
+}
+
+bool GetAccountTree::MergePartialFromCodedStream(
+    ::google::protobuf::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
+  ::google::protobuf::uint32 tag;
+  // @@protoc_insertion_point(parse_start:protocol.GetAccountTree)
+  for (;;) {
+    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoff(127);
+    tag = p.first;
+    if (!p.second) goto handle_unusual;
+    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // optional int64 ledger_seq = 1;
+      case 1: {
+        if (tag == 8) {
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::int64, ::google::protobuf::internal::WireFormatLite::TYPE_INT64>(
+                 input, &ledger_seq_)));
+
+        } else {
+          goto handle_unusual;
+        }
+        if (input->ExpectTag(18)) goto parse_keys;
+        break;
+      }
+
+      // repeated bytes keys = 2;
+      case 2: {
+        if (tag == 18) {
+         parse_keys:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadBytes(
+                input, this->add_keys()));
+        } else {
+          goto handle_unusual;
+        }
+        if (input->ExpectTag(18)) goto parse_keys;
+        if (input->ExpectTag(24)) goto parse_timestamp;
+        break;
+      }
+
+      // optional int64 timestamp = 3;
+      case 3: {
+        if (tag == 24) {
+         parse_timestamp:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::int64, ::google::protobuf::internal::WireFormatLite::TYPE_INT64>(
+                 input, &timestamp_)));
+
+        } else {
+          goto handle_unusual;
+        }
+        if (input->ExpectAtEnd()) goto success;
+        break;
+      }
+
+      default: {
+      handle_unusual:
+        if (tag == 0 ||
+            ::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
+          goto success;
+        }
+        DO_(::google::protobuf::internal::WireFormatLite::SkipField(input, tag));
+        break;
+      }
+    }
+  }
+success:
+  // @@protoc_insertion_point(parse_success:protocol.GetAccountTree)
+  return true;
+failure:
+  // @@protoc_insertion_point(parse_failure:protocol.GetAccountTree)
+  return false;
+#undef DO_
+}
+
+void GetAccountTree::SerializeWithCachedSizes(
+    ::google::protobuf::io::CodedOutputStream* output) const {
+  // @@protoc_insertion_point(serialize_start:protocol.GetAccountTree)
+  // optional int64 ledger_seq = 1;
+  if (this->ledger_seq() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteInt64(1, this->ledger_seq(), output);
+  }
+
+  // repeated bytes keys = 2;
+  for (int i = 0; i < this->keys_size(); i++) {
+    ::google::protobuf::internal::WireFormatLite::WriteBytes(
+      2, this->keys(i), output);
+  }
+
+  // optional int64 timestamp = 3;
+  if (this->timestamp() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteInt64(3, this->timestamp(), output);
+  }
+
+  // @@protoc_insertion_point(serialize_end:protocol.GetAccountTree)
+}
+
+::google::protobuf::uint8* GetAccountTree::InternalSerializeWithCachedSizesToArray(
+    bool deterministic, ::google::protobuf::uint8* target) const {
+  // @@protoc_insertion_point(serialize_to_array_start:protocol.GetAccountTree)
+  // optional int64 ledger_seq = 1;
+  if (this->ledger_seq() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteInt64ToArray(1, this->ledger_seq(), target);
+  }
+
+  // repeated bytes keys = 2;
+  for (int i = 0; i < this->keys_size(); i++) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteBytesToArray(2, this->keys(i), target);
+  }
+
+  // optional int64 timestamp = 3;
+  if (this->timestamp() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteInt64ToArray(3, this->timestamp(), target);
+  }
+
+  // @@protoc_insertion_point(serialize_to_array_end:protocol.GetAccountTree)
+  return target;
+}
+
+int GetAccountTree::ByteSize() const {
+// @@protoc_insertion_point(message_byte_size_start:protocol.GetAccountTree)
+  int total_size = 0;
+
+  // optional int64 ledger_seq = 1;
+  if (this->ledger_seq() != 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::Int64Size(
+        this->ledger_seq());
+  }
+
+  // optional int64 timestamp = 3;
+  if (this->timestamp() != 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::Int64Size(
+        this->timestamp());
+  }
+
+  // repeated bytes keys = 2;
+  total_size += 1 * this->keys_size();
+  for (int i = 0; i < this->keys_size(); i++) {
+    total_size += ::google::protobuf::internal::WireFormatLite::BytesSize(
+      this->keys(i));
+  }
+
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = total_size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  return total_size;
+}
+
+void GetAccountTree::MergeFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:protocol.GetAccountTree)
+  if (GOOGLE_PREDICT_FALSE(&from == this)) {
+    ::google::protobuf::internal::MergeFromFail(__FILE__, __LINE__);
+  }
+  const GetAccountTree* source = 
+      ::google::protobuf::internal::DynamicCastToGenerated<const GetAccountTree>(
+          &from);
+  if (source == NULL) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:protocol.GetAccountTree)
+    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:protocol.GetAccountTree)
+    MergeFrom(*source);
+  }
+}
+
+void GetAccountTree::MergeFrom(const GetAccountTree& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:protocol.GetAccountTree)
+  if (GOOGLE_PREDICT_FALSE(&from == this)) {
+    ::google::protobuf::internal::MergeFromFail(__FILE__, __LINE__);
+  }
+  keys_.MergeFrom(from.keys_);
+  if (from.ledger_seq() != 0) {
+    set_ledger_seq(from.ledger_seq());
+  }
+  if (from.timestamp() != 0) {
+    set_timestamp(from.timestamp());
+  }
+}
+
+void GetAccountTree::CopyFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:protocol.GetAccountTree)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void GetAccountTree::CopyFrom(const GetAccountTree& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:protocol.GetAccountTree)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool GetAccountTree::IsInitialized() const {
+
+  return true;
+}
+
+void GetAccountTree::Swap(GetAccountTree* other) {
+  if (other == this) return;
+  InternalSwap(other);
+}
+void GetAccountTree::InternalSwap(GetAccountTree* other) {
+  std::swap(ledger_seq_, other->ledger_seq_);
+  keys_.UnsafeArenaSwap(&other->keys_);
+  std::swap(timestamp_, other->timestamp_);
+  _internal_metadata_.Swap(&other->_internal_metadata_);
+  std::swap(_cached_size_, other->_cached_size_);
+}
+
+::google::protobuf::Metadata GetAccountTree::GetMetadata() const {
+  protobuf_AssignDescriptorsOnce();
+  ::google::protobuf::Metadata metadata;
+  metadata.descriptor = GetAccountTree_descriptor_;
+  metadata.reflection = GetAccountTree_reflection_;
+  return metadata;
+}
+
+#if PROTOBUF_INLINE_NOT_IN_HEADERS
+// GetAccountTree
+
+// optional int64 ledger_seq = 1;
+void GetAccountTree::clear_ledger_seq() {
+  ledger_seq_ = GOOGLE_LONGLONG(0);
+}
+ ::google::protobuf::int64 GetAccountTree::ledger_seq() const {
+  // @@protoc_insertion_point(field_get:protocol.GetAccountTree.ledger_seq)
+  return ledger_seq_;
+}
+ void GetAccountTree::set_ledger_seq(::google::protobuf::int64 value) {
+  
+  ledger_seq_ = value;
+  // @@protoc_insertion_point(field_set:protocol.GetAccountTree.ledger_seq)
+}
+
+// repeated bytes keys = 2;
+int GetAccountTree::keys_size() const {
+  return keys_.size();
+}
+void GetAccountTree::clear_keys() {
+  keys_.Clear();
+}
+ const ::std::string& GetAccountTree::keys(int index) const {
+  // @@protoc_insertion_point(field_get:protocol.GetAccountTree.keys)
+  return keys_.Get(index);
+}
+ ::std::string* GetAccountTree::mutable_keys(int index) {
+  // @@protoc_insertion_point(field_mutable:protocol.GetAccountTree.keys)
+  return keys_.Mutable(index);
+}
+ void GetAccountTree::set_keys(int index, const ::std::string& value) {
+  // @@protoc_insertion_point(field_set:protocol.GetAccountTree.keys)
+  keys_.Mutable(index)->assign(value);
+}
+ void GetAccountTree::set_keys(int index, const char* value) {
+  keys_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:protocol.GetAccountTree.keys)
+}
+ void GetAccountTree::set_keys(int index, const void* value, size_t size) {
+  keys_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:protocol.GetAccountTree.keys)
+}
+ ::std::string* GetAccountTree::add_keys() {
+  // @@protoc_insertion_point(field_add_mutable:protocol.GetAccountTree.keys)
+  return keys_.Add();
+}
+ void GetAccountTree::add_keys(const ::std::string& value) {
+  keys_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:protocol.GetAccountTree.keys)
+}
+ void GetAccountTree::add_keys(const char* value) {
+  keys_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:protocol.GetAccountTree.keys)
+}
+ void GetAccountTree::add_keys(const void* value, size_t size) {
+  keys_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:protocol.GetAccountTree.keys)
+}
+ const ::google::protobuf::RepeatedPtrField< ::std::string>&
+GetAccountTree::keys() const {
+  // @@protoc_insertion_point(field_list:protocol.GetAccountTree.keys)
+  return keys_;
+}
+ ::google::protobuf::RepeatedPtrField< ::std::string>*
+GetAccountTree::mutable_keys() {
+  // @@protoc_insertion_point(field_mutable_list:protocol.GetAccountTree.keys)
+  return &keys_;
+}
+
+// optional int64 timestamp = 3;
+void GetAccountTree::clear_timestamp() {
+  timestamp_ = GOOGLE_LONGLONG(0);
+}
+ ::google::protobuf::int64 GetAccountTree::timestamp() const {
+  // @@protoc_insertion_point(field_get:protocol.GetAccountTree.timestamp)
+  return timestamp_;
+}
+ void GetAccountTree::set_timestamp(::google::protobuf::int64 value) {
+  
+  timestamp_ = value;
+  // @@protoc_insertion_point(field_set:protocol.GetAccountTree.timestamp)
+}
+
+#endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
+
+// ===================================================================
+
+const ::google::protobuf::EnumDescriptor* AccountTree_SyncCode_descriptor() {
+  protobuf_AssignDescriptorsOnce();
+  return AccountTree_SyncCode_descriptor_;
+}
+bool AccountTree_SyncCode_IsValid(int value) {
+  switch(value) {
+    case 0:
+    case 1:
+    case 2:
+    case 3:
+      return true;
+    default:
+      return false;
+  }
+}
+
+#if !defined(_MSC_VER) || _MSC_VER >= 1900
+const AccountTree_SyncCode AccountTree::OK;
+const AccountTree_SyncCode AccountTree::NOT_READY;
+const AccountTree_SyncCode AccountTree::NOT_PINNED;
+const AccountTree_SyncCode AccountTree::INTERNAL;
+const AccountTree_SyncCode AccountTree::SyncCode_MIN;
+const AccountTree_SyncCode AccountTree::SyncCode_MAX;
+const int AccountTree::SyncCode_ARRAYSIZE;
+#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+#if !defined(_MSC_VER) || _MSC_VER >= 1900
+const int AccountTree::kSyncCodeFieldNumber;
+const int AccountTree::kLedgerSeqFieldNumber;
+const int AccountTree::kValuesFieldNumber;
+const int AccountTree::kLedgerFieldNumber;
+const int AccountTree::kConsensusValueFieldNumber;
+const int AccountTree::kNextValueFieldNumber;
+const int AccountTree::kNextProofFieldNumber;
+const int AccountTree::kFeesFieldNumber;
+#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+
+AccountTree::AccountTree()
+  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
+  SharedCtor();
+  // @@protoc_insertion_point(constructor:protocol.AccountTree)
+}
+
+void AccountTree::InitAsDefaultInstance() {
+  _is_default_instance_ = true;
+  ledger_ = const_cast< ::protocol::Ledger*>(&::protocol::Ledger::default_instance());
+}
+
+AccountTree::AccountTree(const AccountTree& from)
+  : ::google::protobuf::Message(),
+    _internal_metadata_(NULL) {
+  SharedCtor();
+  MergeFrom(from);
+  // @@protoc_insertion_point(copy_constructor:protocol.AccountTree)
+}
+
+void AccountTree::SharedCtor() {
+    _is_default_instance_ = false;
+  ::google::protobuf::internal::GetEmptyString();
+  _cached_size_ = 0;
+  sync_code_ = 0;
+  ledger_seq_ = GOOGLE_LONGLONG(0);
+  ledger_ = NULL;
+  consensus_value_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  next_value_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  next_proof_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  fees_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+
+AccountTree::~AccountTree() {
+  // @@protoc_insertion_point(destructor:protocol.AccountTree)
+  SharedDtor();
+}
+
+void AccountTree::SharedDtor() {
+  consensus_value_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  next_value_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  next_proof_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  fees_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  if (this != default_instance_) {
+    delete ledger_;
+  }
+}
+
+void AccountTree::SetCachedSize(int size) const {
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+}
+const ::google::protobuf::Descriptor* AccountTree::descriptor() {
+  protobuf_AssignDescriptorsOnce();
+  return AccountTree_descriptor_;
+}
+
+const AccountTree& AccountTree::default_instance() {
+  if (default_instance_ == NULL) protobuf_AddDesc_overlay_2eproto();
+  return *default_instance_;
+}
+
+AccountTree* AccountTree::default_instance_ = NULL;
+
+AccountTree* AccountTree::New(::google::protobuf::Arena* arena) const {
+  AccountTree* n = new AccountTree;
+  if (arena != NULL) {
+    arena->Own(n);
+  }
+  return n;
+}
+
+void AccountTree::Clear() {
+// @@protoc_insertion_point(message_clear_start:protocol.AccountTree)
+  sync_code_ = 0;
+  ledger_seq_ = GOOGLE_LONGLONG(0);
+  if (GetArenaNoVirtual() == NULL && ledger_ != NULL) delete ledger_;
+  ledger_ = NULL;
+  consensus_value_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  next_value_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  next_proof_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  fees_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  values_.Clear();
+}
+
+bool AccountTree::MergePartialFromCodedStream(
+    ::google::protobuf::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
+  ::google::protobuf::uint32 tag;
+  // @@protoc_insertion_point(parse_start:protocol.AccountTree)
+  for (;;) {
+    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoff(127);
+    tag = p.first;
+    if (!p.second) goto handle_unusual;
+    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // optional .protocol.AccountTree.SyncCode sync_code = 1;
+      case 1: {
+        if (tag == 8) {
+          int value;
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   int, ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>(
+                 input, &value)));
+          set_sync_code(static_cast< ::protocol::AccountTree_SyncCode >(value));
+        } else {
+          goto handle_unusual;
+        }
+        if (input->ExpectTag(16)) goto parse_ledger_seq;
+        break;
+      }
+
+      // optional int64 ledger_seq = 2;
+      case 2: {
+        if (tag == 16) {
+         parse_ledger_seq:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::int64, ::google::protobuf::internal::WireFormatLite::TYPE_INT64>(
+                 input, &ledger_seq_)));
+
+        } else {
+          goto handle_unusual;
+        }
+        if (input->ExpectTag(26)) goto parse_values;
+        break;
+      }
+
+      // repeated bytes values = 3;
+      case 3: {
+        if (tag == 26) {
+         parse_values:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadBytes(
+                input, this->add_values()));
+        } else {
+          goto handle_unusual;
+        }
+        if (input->ExpectTag(26)) goto parse_values;
+        if (input->ExpectTag(34)) goto parse_ledger;
+        break;
+      }
+
+      // optional .protocol.Ledger ledger = 4;
+      case 4: {
+        if (tag == 34) {
+         parse_ledger:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
+               input, mutable_ledger()));
+        } else {
+          goto handle_unusual;
+        }
+        if (input->ExpectTag(42)) goto parse_consensus_value;
+        break;
+      }
+
+      // optional bytes consensus_value = 5;
+      case 5: {
+        if (tag == 42) {
+         parse_consensus_value:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadBytes(
+                input, this->mutable_consensus_value()));
+        } else {
+          goto handle_unusual;
+        }
+        if (input->ExpectTag(50)) goto parse_next_value;
+        break;
+      }
+
+      // optional bytes next_value = 6;
+      case 6: {
+        if (tag == 50) {
+         parse_next_value:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadBytes(
+                input, this->mutable_next_value()));
+        } else {
+          goto handle_unusual;
+        }
+        if (input->ExpectTag(58)) goto parse_next_proof;
+        break;
+      }
+
+      // optional bytes next_proof = 7;
+      case 7: {
+        if (tag == 58) {
+         parse_next_proof:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadBytes(
+                input, this->mutable_next_proof()));
+        } else {
+          goto handle_unusual;
+        }
+        if (input->ExpectTag(66)) goto parse_fees;
+        break;
+      }
+
+      // optional bytes fees = 8;
+      case 8: {
+        if (tag == 66) {
+         parse_fees:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadBytes(
+                input, this->mutable_fees()));
+        } else {
+          goto handle_unusual;
+        }
+        if (input->ExpectAtEnd()) goto success;
+        break;
+      }
+
+      default: {
+      handle_unusual:
+        if (tag == 0 ||
+            ::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
+          goto success;
+        }
+        DO_(::google::protobuf::internal::WireFormatLite::SkipField(input, tag));
+        break;
+      }
+    }
+  }
+success:
+  // @@protoc_insertion_point(parse_success:protocol.AccountTree)
+  return true;
+failure:
+  // @@protoc_insertion_point(parse_failure:protocol.AccountTree)
+  return false;
+#undef DO_
+}
+
+void AccountTree::SerializeWithCachedSizes(
+    ::google::protobuf::io::CodedOutputStream* output) const {
+  // @@protoc_insertion_point(serialize_start:protocol.AccountTree)
+  // optional .protocol.AccountTree.SyncCode sync_code = 1;
+  if (this->sync_code() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteEnum(
+      1, this->sync_code(), output);
+  }
+
+  // optional int64 ledger_seq = 2;
+  if (this->ledger_seq() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteInt64(2, this->ledger_seq(), output);
+  }
+
+  // repeated bytes values = 3;
+  for (int i = 0; i < this->values_size(); i++) {
+    ::google::protobuf::internal::WireFormatLite::WriteBytes(
+      3, this->values(i), output);
+  }
+
+  // optional .protocol.Ledger ledger = 4;
+  if (this->has_ledger()) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      4, *this->ledger_, output);
+  }
+
+  // optional bytes consensus_value = 5;
+  if (this->consensus_value().size() > 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteBytesMaybeAliased(
+      5, this->consensus_value(), output);
+  }
+
+  // optional bytes next_value = 6;
+  if (this->next_value().size() > 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteBytesMaybeAliased(
+      6, this->next_value(), output);
+  }
+
+  // optional bytes next_proof = 7;
+  if (this->next_proof().size() > 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteBytesMaybeAliased(
+      7, this->next_proof(), output);
+  }
+
+  // optional bytes fees = 8;
+  if (this->fees().size() > 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteBytesMaybeAliased(
+      8, this->fees(), output);
+  }
+
+  // @@protoc_insertion_point(serialize_end:protocol.AccountTree)
+}
+
+::google::protobuf::uint8* AccountTree::InternalSerializeWithCachedSizesToArray(
+    bool deterministic, ::google::protobuf::uint8* target) const {
+  // @@protoc_insertion_point(serialize_to_array_start:protocol.AccountTree)
+  // optional .protocol.AccountTree.SyncCode sync_code = 1;
+  if (this->sync_code() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteEnumToArray(
+      1, this->sync_code(), target);
+  }
+
+  // optional int64 ledger_seq = 2;
+  if (this->ledger_seq() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteInt64ToArray(2, this->ledger_seq(), target);
+  }
+
+  // repeated bytes values = 3;
+  for (int i = 0; i < this->values_size(); i++) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteBytesToArray(3, this->values(i), target);
+  }
+
+  // optional .protocol.Ledger ledger = 4;
+  if (this->has_ledger()) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      InternalWriteMessageNoVirtualToArray(
+        4, *this->ledger_, false, target);
+  }
+
+  // optional bytes consensus_value = 5;
+  if (this->consensus_value().size() > 0) {
+    target =
+      ::google::protobuf::internal::WireFormatLite::WriteBytesToArray(
+        5, this->consensus_value(), target);
+  }
+
+  // optional bytes next_value = 6;
+  if (this->next_value().size() > 0) {
+    target =
+      ::google::protobuf::internal::WireFormatLite::WriteBytesToArray(
+        6, this->next_value(), target);
+  }
+
+  // optional bytes next_proof = 7;
+  if (this->next_proof().size() > 0) {
+    target =
+      ::google::protobuf::internal::WireFormatLite::WriteBytesToArray(
+        7, this->next_proof(), target);
+  }
+
+  // optional bytes fees = 8;
+  if (this->fees().size() > 0) {
+    target =
+      ::google::protobuf::internal::WireFormatLite::WriteBytesToArray(
+        8, this->fees(), target);
+  }
+
+  // @@protoc_insertion_point(serialize_to_array_end:protocol.AccountTree)
+  return target;
+}
+
+int AccountTree::ByteSize() const {
+// @@protoc_insertion_point(message_byte_size_start:protocol.AccountTree)
+  int total_size = 0;
+
+  // optional .protocol.AccountTree.SyncCode sync_code = 1;
+  if (this->sync_code() != 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::EnumSize(this->sync_code());
+  }
+
+  // optional int64 ledger_seq = 2;
+  if (this->ledger_seq() != 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::Int64Size(
+        this->ledger_seq());
+  }
+
+  // optional .protocol.Ledger ledger = 4;
+  if (this->has_ledger()) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+        *this->ledger_);
+  }
+
+  // optional bytes consensus_value = 5;
+  if (this->consensus_value().size() > 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::BytesSize(
+        this->consensus_value());
+  }
+
+  // optional bytes next_value = 6;
+  if (this->next_value().size() > 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::BytesSize(
+        this->next_value());
+  }
+
+  // optional bytes next_proof = 7;
+  if (this->next_proof().size() > 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::BytesSize(
+        this->next_proof());
+  }
+
+  // optional bytes fees = 8;
+  if (this->fees().size() > 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::BytesSize(
+        this->fees());
+  }
+
+  // repeated bytes values = 3;
+  total_size += 1 * this->values_size();
+  for (int i = 0; i < this->values_size(); i++) {
+    total_size += ::google::protobuf::internal::WireFormatLite::BytesSize(
+      this->values(i));
+  }
+
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = total_size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  return total_size;
+}
+
+void AccountTree::MergeFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:protocol.AccountTree)
+  if (GOOGLE_PREDICT_FALSE(&from == this)) {
+    ::google::protobuf::internal::MergeFromFail(__FILE__, __LINE__);
+  }
+  const AccountTree* source = 
+      ::google::protobuf::internal::DynamicCastToGenerated<const AccountTree>(
+          &from);
+  if (source == NULL) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:protocol.AccountTree)
+    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:protocol.AccountTree)
+    MergeFrom(*source);
+  }
+}
+
+void AccountTree::MergeFrom(const AccountTree& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:protocol.AccountTree)
+  if (GOOGLE_PREDICT_FALSE(&from == this)) {
+    ::google::protobuf::internal::MergeFromFail(__FILE__, __LINE__);
+  }
+  values_.MergeFrom(from.values_);
+  if (from.sync_code() != 0) {
+    set_sync_code(from.sync_code());
+  }
+  if (from.ledger_seq() != 0) {
+    set_ledger_seq(from.ledger_seq());
+  }
+  if (from.has_ledger()) {
+    mutable_ledger()->::protocol::Ledger::MergeFrom(from.ledger());
+  }
+  if (from.consensus_value().size() > 0) {
+
+    consensus_value_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.consensus_value_);
+  }
+  if (from.next_value().size() > 0) {
+
+    next_value_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.next_value_);
+  }
+  if (from.next_proof().size() > 0) {
+
+    next_proof_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.next_proof_);
+  }
+  if (from.fees().size() > 0) {
+
+    fees_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.fees_);
+  }
+}
+
+void AccountTree::CopyFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:protocol.AccountTree)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void AccountTree::CopyFrom(const AccountTree& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:protocol.AccountTree)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool AccountTree::IsInitialized() const {
+
+  return true;
+}
+
+void AccountTree::Swap(AccountTree* other) {
+  if (other == this) return;
+  InternalSwap(other);
+}
+void AccountTree::InternalSwap(AccountTree* other) {
+  std::swap(sync_code_, other->sync_code_);
+  std::swap(ledger_seq_, other->ledger_seq_);
+  values_.UnsafeArenaSwap(&other->values_);
+  std::swap(ledger_, other->ledger_);
+  consensus_value_.Swap(&other->consensus_value_);
+  next_value_.Swap(&other->next_value_);
+  next_proof_.Swap(&other->next_proof_);
+  fees_.Swap(&other->fees_);
+  _internal_metadata_.Swap(&other->_internal_metadata_);
+  std::swap(_cached_size_, other->_cached_size_);
+}
+
+::google::protobuf::Metadata AccountTree::GetMetadata() const {
+  protobuf_AssignDescriptorsOnce();
+  ::google::protobuf::Metadata metadata;
+  metadata.descriptor = AccountTree_descriptor_;
+  metadata.reflection = AccountTree_reflection_;
+  return metadata;
+}
+
+#if PROTOBUF_INLINE_NOT_IN_HEADERS
+// AccountTree
+
+// optional .protocol.AccountTree.SyncCode sync_code = 1;
+void AccountTree::clear_sync_code() {
+  sync_code_ = 0;
+}
+ ::protocol::AccountTree_SyncCode AccountTree::sync_code() const {
+  // @@protoc_insertion_point(field_get:protocol.AccountTree.sync_code)
+  return static_cast< ::protocol::AccountTree_SyncCode >(sync_code_);
+}
+ void AccountTree::set_sync_code(::protocol::AccountTree_SyncCode value) {
+  
+  sync_code_ = value;
+  // @@protoc_insertion_point(field_set:protocol.AccountTree.sync_code)
+}
+
+// optional int64 ledger_seq = 2;
+void AccountTree::clear_ledger_seq() {
+  ledger_seq_ = GOOGLE_LONGLONG(0);
+}
+ ::google::protobuf::int64 AccountTree::ledger_seq() const {
+  // @@protoc_insertion_point(field_get:protocol.AccountTree.ledger_seq)
+  return ledger_seq_;
+}
+ void AccountTree::set_ledger_seq(::google::protobuf::int64 value) {
+  
+  ledger_seq_ = value;
+  // @@protoc_insertion_point(field_set:protocol.AccountTree.ledger_seq)
+}
+
+// repeated bytes values = 3;
+int AccountTree::values_size() const {
+  return values_.size();
+}
+void AccountTree::clear_values() {
+  values_.Clear();
+}
+ const ::std::string& AccountTree::values(int index) const {
+  // @@protoc_insertion_point(field_get:protocol.AccountTree.values)
+  return values_.Get(index);
+}
+ ::std::string* AccountTree::mutable_values(int index) {
+  // @@protoc_insertion_point(field_mutable:protocol.AccountTree.values)
+  return values_.Mutable(index);
+}
+ void AccountTree::set_values(int index, const ::std::string& value) {
+  // @@protoc_insertion_point(field_set:protocol.AccountTree.values)
+  values_.Mutable(index)->assign(value);
+}
+ void AccountTree::set_values(int index, const char* value) {
+  values_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:protocol.AccountTree.values)
+}
+ void AccountTree::set_values(int index, const void* value, size_t size) {
+  values_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:protocol.AccountTree.values)
+}
+ ::std::string* AccountTree::add_values() {
+  // @@protoc_insertion_point(field_add_mutable:protocol.AccountTree.values)
+  return values_.Add();
+}
+ void AccountTree::add_values(const ::std::string& value) {
+  values_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:protocol.AccountTree.values)
+}
+ void AccountTree::add_values(const char* value) {
+  values_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:protocol.AccountTree.values)
+}
+ void AccountTree::add_values(const void* value, size_t size) {
+  values_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:protocol.AccountTree.values)
+}
+ const ::google::protobuf::RepeatedPtrField< ::std::string>&
+AccountTree::values() const {
+  // @@protoc_insertion_point(field_list:protocol.AccountTree.values)
+  return values_;
+}
+ ::google::protobuf::RepeatedPtrField< ::std::string>*
+AccountTree::mutable_values() {
+  // @@protoc_insertion_point(field_mutable_list:protocol.AccountTree.values)
+  return &values_;
+}
+
+// optional .protocol.Ledger ledger = 4;
+bool AccountTree::has_ledger() const {
+  return !_is_default_instance_ && ledger_ != NULL;
+}
+void AccountTree::clear_ledger() {
+  if (GetArenaNoVirtual() == NULL && ledger_ != NULL) delete ledger_;
+  ledger_ = NULL;
+}
+const ::protocol::Ledger& AccountTree::ledger() const {
+  // @@protoc_insertion_point(field_get:protocol.AccountTree.ledger)
+  return ledger_ != NULL ? *ledger_ : *default_instance_->ledger_;
+}
+::protocol::Ledger* AccountTree::mutable_ledger() {
+  
+  if (ledger_ == NULL) {
+    ledger_ = new ::protocol::Ledger;
+  }
+  // @@protoc_insertion_point(field_mutable:protocol.AccountTree.ledger)
+  return ledger_;
+}
+::protocol::Ledger* AccountTree::release_ledger() {
+  // @@protoc_insertion_point(field_release:protocol.AccountTree.ledger)
+  
+  ::protocol::Ledger* temp = ledger_;
+  ledger_ = NULL;
+  return temp;
+}
+void AccountTree::set_allocated_ledger(::protocol::Ledger* ledger) {
+  delete ledger_;
+  ledger_ = ledger;
+  if (ledger) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_set_allocated:protocol.AccountTree.ledger)
+}
+
+// optional bytes consensus_value = 5;
+void AccountTree::clear_consensus_value() {
+  consensus_value_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+ const ::std::string& AccountTree::consensus_value() const {
+  // @@protoc_insertion_point(field_get:protocol.AccountTree.consensus_value)
+  return consensus_value_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+ void AccountTree::set_consensus_value(const ::std::string& value) {
+  
+  consensus_value_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:protocol.AccountTree.consensus_value)
+}
+ void AccountTree::set_consensus_value(const char* value) {
+  
+  consensus_value_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:protocol.AccountTree.consensus_value)
+}
+ void AccountTree::set_consensus_value(const void* value, size_t size) {
+  
+  consensus_value_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:protocol.AccountTree.consensus_value)
+}
+ ::std::string* AccountTree::mutable_consensus_value() {
+  
+  // @@protoc_insertion_point(field_mutable:protocol.AccountTree.consensus_value)
+  return consensus_value_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+ ::std::string* AccountTree::release_consensus_value() {
+  // @@protoc_insertion_point(field_release:protocol.AccountTree.consensus_value)
+  
+  return consensus_value_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+ void AccountTree::set_allocated_consensus_value(::std::string* consensus_value) {
+  if (consensus_value != NULL) {
+    
+  } else {
+    
+  }
+  consensus_value_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), consensus_value);
+  // @@protoc_insertion_point(field_set_allocated:protocol.AccountTree.consensus_value)
+}
+
+// optional bytes next_value = 6;
+void AccountTree::clear_next_value() {
+  next_value_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+ const ::std::string& AccountTree::next_value() const {
+  // @@protoc_insertion_point(field_get:protocol.AccountTree.next_value)
+  return next_value_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+ void AccountTree::set_next_value(const ::std::string& value) {
+  
+  next_value_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:protocol.AccountTree.next_value)
+}
+ void AccountTree::set_next_value(const char* value) {
+  
+  next_value_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:protocol.AccountTree.next_value)
+}
+ void AccountTree::set_next_value(const void* value, size_t size) {
+  
+  next_value_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:protocol.AccountTree.next_value)
+}
+ ::std::string* AccountTree::mutable_next_value() {
+  
+  // @@protoc_insertion_point(field_mutable:protocol.AccountTree.next_value)
+  return next_value_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+ ::std::string* AccountTree::release_next_value() {
+  // @@protoc_insertion_point(field_release:protocol.AccountTree.next_value)
+  
+  return next_value_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+ void AccountTree::set_allocated_next_value(::std::string* next_value) {
+  if (next_value != NULL) {
+    
+  } else {
+    
+  }
+  next_value_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), next_value);
+  // @@protoc_insertion_point(field_set_allocated:protocol.AccountTree.next_value)
+}
+
+// optional bytes next_proof = 7;
+void AccountTree::clear_next_proof() {
+  next_proof_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+ const ::std::string& AccountTree::next_proof() const {
+  // @@protoc_insertion_point(field_get:protocol.AccountTree.next_proof)
+  return next_proof_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+ void AccountTree::set_next_proof(const ::std::string& value) {
+  
+  next_proof_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:protocol.AccountTree.next_proof)
+}
+ void AccountTree::set_next_proof(const char* value) {
+  
+  next_proof_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:protocol.AccountTree.next_proof)
+}
+ void AccountTree::set_next_proof(const void* value, size_t size) {
+  
+  next_proof_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:protocol.AccountTree.next_proof)
+}
+ ::std::string* AccountTree::mutable_next_proof() {
+  
+  // @@protoc_insertion_point(field_mutable:protocol.AccountTree.next_proof)
+  return next_proof_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+ ::std::string* AccountTree::release_next_proof() {
+  // @@protoc_insertion_point(field_release:protocol.AccountTree.next_proof)
+  
+  return next_proof_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+ void AccountTree::set_allocated_next_proof(::std::string* next_proof) {
+  if (next_proof != NULL) {
+    
+  } else {
+    
+  }
+  next_proof_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), next_proof);
+  // @@protoc_insertion_point(field_set_allocated:protocol.AccountTree.next_proof)
+}
+
+// optional bytes fees = 8;
+void AccountTree::clear_fees() {
+  fees_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+ const ::std::string& AccountTree::fees() const {
+  // @@protoc_insertion_point(field_get:protocol.AccountTree.fees)
+  return fees_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+ void AccountTree::set_fees(const ::std::string& value) {
+  
+  fees_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:protocol.AccountTree.fees)
+}
+ void AccountTree::set_fees(const char* value) {
+  
+  fees_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:protocol.AccountTree.fees)
+}
+ void AccountTree::set_fees(const void* value, size_t size) {
+  
+  fees_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:protocol.AccountTree.fees)
+}
+ ::std::string* AccountTree::mutable_fees() {
+  
+  // @@protoc_insertion_point(field_mutable:protocol.AccountTree.fees)
+  return fees_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+ ::std::string* AccountTree::release_fees() {
+  // @@protoc_insertion_point(field_release:protocol.AccountTree.fees)
+  
+  return fees_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+ void AccountTree::set_allocated_fees(::std::string* fees) {
+  if (fees != NULL) {
+    
+  } else {
+    
+  }
+  fees_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), fees);
+  // @@protoc_insertion_point(field_set_allocated:protocol.AccountTree.fees)
+}
+
+#endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
+
+// ===================================================================
+
 #if !defined(_MSC_VER) || _MSC_VER >= 1900
 const int DontHave::kTypeFieldNumber;
 const int DontHave::kHashFieldNumber;
@@ -39,6 +39,7 @@ void protobuf_AddDesc_overlay_2eproto();
 void protobuf_AssignDesc_overlay_2eproto();
 void protobuf_ShutdownFile_overlay_2eproto();
 
+class AccountTree;
 class ChainHello;
 class ChainPeerMessage;
 class ChainResponse;
@@ -47,6 +48,7 @@ class ChainSubscribeTx;
 class ChainTxStatus;
 class DontHave;
 class EntryList;
+class GetAccountTree;
 class GetLedgers;
 class Hello;
 class HelloResponse;
@@ -80,6 +82,29 @@ inline bool Ledgers_SyncCode_Parse(
   return ::google::protobuf::internal::ParseNamedEnum<Ledgers_SyncCode>(
     Ledgers_SyncCode_descriptor(), name, value);
 }
+enum AccountTree_SyncCode {
+  AccountTree_SyncCode_OK = 0,
+  AccountTree_SyncCode_NOT_READY = 1,
+  AccountTree_SyncCode_NOT_PINNED = 2,
+  AccountTree_SyncCode_INTERNAL = 3,
+  AccountTree_SyncCode_AccountTree_SyncCode_INT_MIN_SENTINEL_DO_NOT_USE_ = ::google::protobuf::kint32min,
+  AccountTree_SyncCode_AccountTree_SyncCode_INT_MAX_SENTINEL_DO_NOT_USE_ = ::google::protobuf::kint32max
+};
+bool AccountTree_SyncCode_IsValid(int value);
+const AccountTree_SyncCode AccountTree_SyncCode_SyncCode_MIN = AccountTree_SyncCode_OK;
+const AccountTree_SyncCode AccountTree_SyncCode_SyncCode_MAX = AccountTree_SyncCode_INTERNAL;
+const int AccountTree_SyncCode_SyncCode_ARRAYSIZE = AccountTree_SyncCode_SyncCode_MAX + 1;
+
+const ::google::protobuf::EnumDescriptor* AccountTree_SyncCode_descriptor();
+inline const ::std::string& AccountTree_SyncCode_Name(AccountTree_SyncCode value) {
+  return ::google::protobuf::internal::NameOfEnum(
+    AccountTree_SyncCode_descriptor(), value);
+}
+inline bool AccountTree_SyncCode_Parse(
+    const ::std::string& name, AccountTree_SyncCode* value) {
+  return ::google::protobuf::internal::ParseNamedEnum<AccountTree_SyncCode>(
+    AccountTree_SyncCode_descriptor(), name, value);
+}
 enum ChainTxStatus_TxStatus {
   ChainTxStatus_TxStatus_UNDEFINED = 0,
   ChainTxStatus_TxStatus_CONFIRMED = 1,
@@ -113,12 +138,13 @@ enum OVERLAY_MESSAGE_TYPE {
   OVERLAY_MSGTYPE_LEDGERS = 5,
   OVERLAY_MSGTYPE_PBFT = 6,
   OVERLAY_MSGTYPE_LEDGER_UPGRADE_NOTIFY = 7,
+  OVERLAY_MSGTYPE_ACCOUNT_TREE = 8,
   OVERLAY_MESSAGE_TYPE_INT_MIN_SENTINEL_DO_NOT_USE_ = ::google::protobuf::kint32min,
   OVERLAY_MESSAGE_TYPE_INT_MAX_SENTINEL_DO_NOT_USE_ = ::google::protobuf::kint32max
 };
 bool OVERLAY_MESSAGE_TYPE_IsValid(int value);
 const OVERLAY_MESSAGE_TYPE OVERLAY_MESSAGE_TYPE_MIN = OVERLAY_MSGTYPE_NONE;
-const OVERLAY_MESSAGE_TYPE OVERLAY_MESSAGE_TYPE_MAX = OVERLAY_MSGTYPE_LEDGER_UPGRADE_NOTIFY;
+const OVERLAY_MESSAGE_TYPE OVERLAY_MESSAGE_TYPE_MAX = OVERLAY_MSGTYPE_ACCOUNT_TREE;
 const int OVERLAY_MESSAGE_TYPE_ARRAYSIZE = OVERLAY_MESSAGE_TYPE_MAX + 1;
 
 const ::google::protobuf::EnumDescriptor* OVERLAY_MESSAGE_TYPE_descriptor();
@@ -849,6 +875,306 @@ class Ledgers : public ::google::protobuf::Message /* @@protoc_insertion_point(c
 };
 // -------------------------------------------------------------------
 
+class GetAccountTree : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:protocol.GetAccountTree) */ {
+ public:
+  GetAccountTree();
+  virtual ~GetAccountTree();
+
+  GetAccountTree(const GetAccountTree& from);
+
+  inline GetAccountTree& operator=(const GetAccountTree& from) {
+    CopyFrom(from);
+    return *this;
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor();
+  static const GetAccountTree& default_instance();
+
+  void Swap(GetAccountTree* other);
+
+  // implements Message ----------------------------------------------
+
+  inline GetAccountTree* New() const { return New(NULL); }
+
+  GetAccountTree* New(::google::protobuf::Arena* arena) const;
+  void CopyFrom(const ::google::protobuf::Message& from);
+  void MergeFrom(const ::google::protobuf::Message& from);
+  void CopyFrom(const GetAccountTree& from);
+  void MergeFrom(const GetAccountTree& from);
+  void Clear();
+  bool IsInitialized() const;
+
+  int ByteSize() const;
+  bool MergePartialFromCodedStream(
+      ::google::protobuf::io::CodedInputStream* input);
+  void SerializeWithCachedSizes(
+      ::google::protobuf::io::CodedOutputStream* output) const;
+  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
+      bool deterministic, ::google::protobuf::uint8* output) const;
+  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const {
+    return InternalSerializeWithCachedSizesToArray(false, output);
+  }
+  int GetCachedSize() const { return _cached_size_; }
+  private:
+  void SharedCtor();
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  void InternalSwap(GetAccountTree* other);
+  private:
+  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
+    return _internal_metadata_.arena();
+  }
+  inline void* MaybeArenaPtr() const {
+    return _internal_metadata_.raw_arena_ptr();
+  }
+  public:
+
+  ::google::protobuf::Metadata GetMetadata() const;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // optional int64 ledger_seq = 1;
+  void clear_ledger_seq();
+  static const int kLedgerSeqFieldNumber = 1;
+  ::google::protobuf::int64 ledger_seq() const;
+  void set_ledger_seq(::google::protobuf::int64 value);
+
+  // repeated bytes keys = 2;
+  int keys_size() const;
+  void clear_keys();
+  static const int kKeysFieldNumber = 2;
+  const ::std::string& keys(int index) const;
+  ::std::string* mutable_keys(int index);
+  void set_keys(int index, const ::std::string& value);
+  void set_keys(int index, const char* value);
+  void set_keys(int index, const void* value, size_t size);
+  ::std::string* add_keys();
+  void add_keys(const ::std::string& value);
+  void add_keys(const char* value);
+  void add_keys(const void* value, size_t size);
+  const ::google::protobuf::RepeatedPtrField< ::std::string>& keys() const;
+  ::google::protobuf::RepeatedPtrField< ::std::string>* mutable_keys();
+
+  // optional int64 timestamp = 3;
+  void clear_timestamp();
+  static const int kTimestampFieldNumber = 3;
+  ::google::protobuf::int64 timestamp() const;
+  void set_timestamp(::google::protobuf::int64 value);
+
+  // @@protoc_insertion_point(class_scope:protocol.GetAccountTree)
+ private:
+
+  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
+  bool _is_default_instance_;
+  ::google::protobuf::int64 ledger_seq_;
+  ::google::protobuf::RepeatedPtrField< ::std::string> keys_;
+  ::google::protobuf::int64 timestamp_;
+  mutable int _cached_size_;
+  friend void  protobuf_AddDesc_overlay_2eproto();
+  friend void protobuf_AssignDesc_overlay_2eproto();
+  friend void protobuf_ShutdownFile_overlay_2eproto();
+
+  void InitAsDefaultInstance();
+  static GetAccountTree* default_instance_;
+};
+// -------------------------------------------------------------------
+
+class AccountTree : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:protocol.AccountTree) */ {
+ public:
+  AccountTree();
+  virtual ~AccountTree();
+
+  AccountTree(const AccountTree& from);
+
+  inline AccountTree& operator=(const AccountTree& from) {
+    CopyFrom(from);
+    return *this;
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor();
+  static const AccountTree& default_instance();
+
+  void Swap(AccountTree* other);
+
+  // implements Message ----------------------------------------------
+
+  inline AccountTree* New() const { return New(NULL); }
+
+  AccountTree* New(::google::protobuf::Arena* arena) const;
+  void CopyFrom(const ::google::protobuf::Message& from);
+  void MergeFrom(const ::google::protobuf::Message& from);
+  void CopyFrom(const AccountTree& from);
+  void MergeFrom(const AccountTree& from);
+  void Clear();
+  bool IsInitialized() const;
+
+  int ByteSize() const;
+  bool MergePartialFromCodedStream(
+      ::google::protobuf::io::CodedInputStream* input);
+  void SerializeWithCachedSizes(
+      ::google::protobuf::io::CodedOutputStream* output) const;
+  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
+      bool deterministic, ::google::protobuf::uint8* output) const;
+  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const {
+    return InternalSerializeWithCachedSizesToArray(false, output);
+  }
+  int GetCachedSize() const { return _cached_size_; }
+  private:
+  void SharedCtor();
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  void InternalSwap(AccountTree* other);
+  private:
+  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
+    return _internal_metadata_.arena();
+  }
+  inline void* MaybeArenaPtr() const {
+    return _internal_metadata_.raw_arena_ptr();
+  }
+  public:
+
+  ::google::protobuf::Metadata GetMetadata() const;
+
+  // nested types ----------------------------------------------------
+
+  typedef AccountTree_SyncCode SyncCode;
+  static const SyncCode OK =
+    AccountTree_SyncCode_OK;
+  static const SyncCode NOT_READY =
+    AccountTree_SyncCode_NOT_READY;
+  static const SyncCode NOT_PINNED =
+    AccountTree_SyncCode_NOT_PINNED;
+  static const SyncCode INTERNAL =
+    AccountTree_SyncCode_INTERNAL;
+  static inline bool SyncCode_IsValid(int value) {
+    return AccountTree_SyncCode_IsValid(value);
+  }
+  static const SyncCode SyncCode_MIN =
+    AccountTree_SyncCode_SyncCode_MIN;
+  static const SyncCode SyncCode_MAX =
+    AccountTree_SyncCode_SyncCode_MAX;
+  static const int SyncCode_ARRAYSIZE =
+    AccountTree_SyncCode_SyncCode_ARRAYSIZE;
+  static inline const ::google::protobuf::EnumDescriptor*
+  SyncCode_descriptor() {
+    return AccountTree_SyncCode_descriptor();
+  }
+  static inline const ::std::string& SyncCode_Name(SyncCode value) {
+    return AccountTree_SyncCode_Name(value);
+  }
+  static inline bool SyncCode_Parse(const ::std::string& name,
+      SyncCode* value) {
+    return AccountTree_SyncCode_Parse(name, value);
+  }
+
+  // accessors -------------------------------------------------------
+
+  // optional .protocol.AccountTree.SyncCode sync_code = 1;
+  void clear_sync_code();
+  static const int kSyncCodeFieldNumber = 1;
+  ::protocol::AccountTree_SyncCode sync_code() const;
+  void set_sync_code(::protocol::AccountTree_SyncCode value);
+
+  // optional int64 ledger_seq = 2;
+  void clear_ledger_seq();
+  static const int kLedgerSeqFieldNumber = 2;
+  ::google::protobuf::int64 ledger_seq() const;
+  void set_ledger_seq(::google::protobuf::int64 value);
+
+  // repeated bytes values = 3;
+  int values_size() const;
+  void clear_values();
+  static const int kValuesFieldNumber = 3;
+  const ::std::string& values(int index) const;
+  ::std::string* mutable_values(int index);
+  void set_values(int index, const ::std::string& value);
+  void set_values(int index, const char* value);
+  void set_values(int index, const void* value, size_t size);
+  ::std::string* add_values();
+  void add_values(const ::std::string& value);
+  void add_values(const char* value);
+  void add_values(const void* value, size_t size);
+  const ::google::protobuf::RepeatedPtrField< ::std::string>& values() const;
+  ::google::protobuf::RepeatedPtrField< ::std::string>* mutable_values();
+
+  // optional .protocol.Ledger ledger = 4;
+  bool has_ledger() const;
+  void clear_ledger();
+  static const int kLedgerFieldNumber = 4;
+  const ::protocol::Ledger& ledger() const;
+  ::protocol::Ledger* mutable_ledger();
+  ::protocol::Ledger* release_ledger();
+  void set_allocated_ledger(::protocol::Ledger* ledger);
+
+  // optional bytes consensus_value = 5;
+  void clear_consensus_value();
+  static const int kConsensusValueFieldNumber = 5;
+  const ::std::string& consensus_value() const;
+  void set_consensus_value(const ::std::string& value);
+  void set_consensus_value(const char* value);
+  void set_consensus_value(const void* value, size_t size);
+  ::std::string* mutable_consensus_value();
+  ::std::string* release_consensus_value();
+  void set_allocated_consensus_value(::std::string* consensus_value);
+
+  // optional bytes next_value = 6;
+  void clear_next_value();
+  static const int kNextValueFieldNumber = 6;
+  const ::std::string& next_value() const;
+  void set_next_value(const ::std::string& value);
+  void set_next_value(const char* value);
+  void set_next_value(const void* value, size_t size);
+  ::std::string* mutable_next_value();
+  ::std::string* release_next_value();
+  void set_allocated_next_value(::std::string* next_value);
+
+  // optional bytes next_proof = 7;
+  void clear_next_proof();
+  static const int kNextProofFieldNumber = 7;
+  const ::std::string& next_proof() const;
+  void set_next_proof(const ::std::string& value);
+  void set_next_proof(const char* value);
+  void set_next_proof(const void* value, size_t size);
+  ::std::string* mutable_next_proof();
+  ::std::string* release_next_proof();
+  void set_allocated_next_proof(::std::string* next_proof);
+
+  // optional bytes fees = 8;
+  void clear_fees();
+  static const int kFeesFieldNumber = 8;
+  const ::std::string& fees() const;
+  void set_fees(const ::std::string& value);
+  void set_fees(const char* value);
+  void set_fees(const void* value, size_t size);
+  ::std::string* mutable_fees();
+  ::std::string* release_fees();
+  void set_allocated_fees(::std::string* fees);
+
+  // @@protoc_insertion_point(class_scope:protocol.AccountTree)
+ private:
+
+  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
+  bool _is_default_instance_;
+  ::google::protobuf::int64 ledger_seq_;
+  ::google::protobuf::RepeatedPtrField< ::std::string> values_;
+  ::protocol::Ledger* ledger_;
+  ::google::protobuf::internal::ArenaStringPtr consensus_value_;
+  ::google::protobuf::internal::ArenaStringPtr next_value_;
+  ::google::protobuf::internal::ArenaStringPtr next_proof_;
+  ::google::protobuf::internal::ArenaStringPtr fees_;
+  int sync_code_;
+  mutable int _cached_size_;
+  friend void  protobuf_AddDesc_overlay_2eproto();
+  friend void protobuf_AssignDesc_overlay_2eproto();
+  friend void protobuf_ShutdownFile_overlay_2eproto();
+
+  void InitAsDefaultInstance();
+  static AccountTree* default_instance_;
+};
+// -------------------------------------------------------------------
+
 class DontHave : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:protocol.DontHave) */ {
  public:
   DontHave();
@@ -2400,6 +2726,394 @@ inline void Ledgers::set_allocated_proof(::std::string* proof) {
 
 // -------------------------------------------------------------------
 
+// GetAccountTree
+
+// optional int64 ledger_seq = 1;
+inline void GetAccountTree::clear_ledger_seq() {
+  ledger_seq_ = GOOGLE_LONGLONG(0);
+}
+inline ::google::protobuf::int64 GetAccountTree::ledger_seq() const {
+  // @@protoc_insertion_point(field_get:protocol.GetAccountTree.ledger_seq)
+  return ledger_seq_;
+}
+inline void GetAccountTree::set_ledger_seq(::google::protobuf::int64 value) {
+  
+  ledger_seq_ = value;
+  // @@protoc_insertion_point(field_set:protocol.GetAccountTree.ledger_seq)
+}
+
+// repeated bytes keys = 2;
+inline int GetAccountTree::keys_size() const {
+  return keys_.size();
+}
+inline void GetAccountTree::clear_keys() {
+  keys_.Clear();
+}
+inline const ::std::string& GetAccountTree::keys(int index) const {
+  // @@protoc_insertion_point(field_get:protocol.GetAccountTree.keys)
+  return keys_.Get(index);
+}
+inline ::std::string* GetAccountTree::mutable_keys(int index) {
+  // @@protoc_insertion_point(field_mutable:protocol.GetAccountTree.keys)
+  return keys_.Mutable(index);
+}
+inline void GetAccountTree::set_keys(int index, const ::std::string& value) {
+  // @@protoc_insertion_point(field_set:protocol.GetAccountTree.keys)
+  keys_.Mutable(index)->assign(value);
+}
+inline void GetAccountTree::set_keys(int index, const char* value) {
+  keys_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:protocol.GetAccountTree.keys)
+}
+inline void GetAccountTree::set_keys(int index, const void* value, size_t size) {
+  keys_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:protocol.GetAccountTree.keys)
+}
+inline ::std::string* GetAccountTree::add_keys() {
+  // @@protoc_insertion_point(field_add_mutable:protocol.GetAccountTree.keys)
+  return keys_.Add();
+}
+inline void GetAccountTree::add_keys(const ::std::string& value) {
+  keys_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:protocol.GetAccountTree.keys)
+}
+inline void GetAccountTree::add_keys(const char* value) {
+  keys_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:protocol.GetAccountTree.keys)
+}
+inline void GetAccountTree::add_keys(const void* value, size_t size) {
+  keys_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:protocol.GetAccountTree.keys)
+}
+inline const ::google::protobuf::RepeatedPtrField< ::std::string>&
+GetAccountTree::keys() const {
+  // @@protoc_insertion_point(field_list:protocol.GetAccountTree.keys)
+  return keys_;
+}
+inline ::google::protobuf::RepeatedPtrField< ::std::string>*
+GetAccountTree::mutable_keys() {
+  // @@protoc_insertion_point(field_mutable_list:protocol.GetAccountTree.keys)
+  return &keys_;
+}
+
+// optional int64 timestamp = 3;
+inline void GetAccountTree::clear_timestamp() {
+  timestamp_ = GOOGLE_LONGLONG(0);
+}
+inline ::google::protobuf::int64 GetAccountTree::timestamp() const {
+  // @@protoc_insertion_point(field_get:protocol.GetAccountTree.timestamp)
+  return timestamp_;
+}
+inline void GetAccountTree::set_timestamp(::google::protobuf::int64 value) {
+  
+  timestamp_ = value;
+  // @@protoc_insertion_point(field_set:protocol.GetAccountTree.timestamp)
+}
+
+// -------------------------------------------------------------------
+
+// AccountTree
+
+// optional .protocol.AccountTree.SyncCode sync_code = 1;
+inline void AccountTree::clear_sync_code() {
+  sync_code_ = 0;
+}
+inline ::protocol::AccountTree_SyncCode AccountTree::sync_code() const {
+  // @@protoc_insertion_point(field_get:protocol.AccountTree.sync_code)
+  return static_cast< ::protocol::AccountTree_SyncCode >(sync_code_);
+}
+inline void AccountTree::set_sync_code(::protocol::AccountTree_SyncCode value) {
+  
+  sync_code_ = value;
+  // @@protoc_insertion_point(field_set:protocol.AccountTree.sync_code)
+}
+
+// optional int64 ledger_seq = 2;
+inline void AccountTree::clear_ledger_seq() {
+  ledger_seq_ = GOOGLE_LONGLONG(0);
+}
+inline ::google::protobuf::int64 AccountTree::ledger_seq() const {
+  // @@protoc_insertion_point(field_get:protocol.AccountTree.ledger_seq)
+  return ledger_seq_;
+}
+inline void AccountTree::set_ledger_seq(::google::protobuf::int64 value) {
+  
+  ledger_seq_ = value;
+  // @@protoc_insertion_point(field_set:protocol.AccountTree.ledger_seq)
+}
+
+// repeated bytes values = 3;
+inline int AccountTree::values_size() const {
+  return values_.size();
+}
+inline void AccountTree::clear_values() {
+  values_.Clear();
+}
+inline const ::std::string& AccountTree::values(int index) const {
+  // @@protoc_insertion_point(field_get:protocol.AccountTree.values)
+  return values_.Get(index);
+}
+inline ::std::string* AccountTree::mutable_values(int index) {
+  // @@protoc_insertion_point(field_mutable:protocol.AccountTree.values)
+  return values_.Mutable(index);
+}
+inline void AccountTree::set_values(int index, const ::std::string& value) {
+  // @@protoc_insertion_point(field_set:protocol.AccountTree.values)
+  values_.Mutable(index)->assign(value);
+}
+inline void AccountTree::set_values(int index, const char* value) {
+  values_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:protocol.AccountTree.values)
+}
+inline void AccountTree::set_values(int index, const void* value, size_t size) {
+  values_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:protocol.AccountTree.values)
+}
+inline ::std::string* AccountTree::add_values() {
+  // @@protoc_insertion_point(field_add_mutable:protocol.AccountTree.values)
+  return values_.Add();
+}
+inline void AccountTree::add_values(const ::std::string& value) {
+  values_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:protocol.AccountTree.values)
+}
+inline void AccountTree::add_values(const char* value) {
+  values_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:protocol.AccountTree.values)
+}
+inline void AccountTree::add_values(const void* value, size_t size) {
+  values_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:protocol.AccountTree.values)
+}
+inline const ::google::protobuf::RepeatedPtrField< ::std::string>&
+AccountTree::values() const {
+  // @@protoc_insertion_point(field_list:protocol.AccountTree.values)
+  return values_;
+}
+inline ::google::protobuf::RepeatedPtrField< ::std::string>*
+AccountTree::mutable_values() {
+  // @@protoc_insertion_point(field_mutable_list:protocol.AccountTree.values)
+  return &values_;
+}
+
+// optional .protocol.Ledger ledger = 4;
+inline bool AccountTree::has_ledger() const {
+  return !_is_default_instance_ && ledger_ != NULL;
+}
+inline void AccountTree::clear_ledger() {
+  if (GetArenaNoVirtual() == NULL && ledger_ != NULL) delete ledger_;
+  ledger_ = NULL;
+}
+inline const ::protocol::Ledger& AccountTree::ledger() const {
+  // @@protoc_insertion_point(field_get:protocol.AccountTree.ledger)
+  return ledger_ != NULL ? *ledger_ : *default_instance_->ledger_;
+}
+inline ::protocol::Ledger* AccountTree::mutable_ledger() {
+  
+  if (ledger_ == NULL) {
+    ledger_ = new ::protocol::Ledger;
+  }
+  // @@protoc_insertion_point(field_mutable:protocol.AccountTree.ledger)
+  return ledger_;
+}
+inline ::protocol::Ledger* AccountTree::release_ledger() {
+  // @@protoc_insertion_point(field_release:protocol.AccountTree.ledger)
+  
+  ::protocol::Ledger* temp = ledger_;
+  ledger_ = NULL;
+  return temp;
+}
+inline void AccountTree::set_allocated_ledger(::protocol::Ledger* ledger) {
+  delete ledger_;
+  ledger_ = ledger;
+  if (ledger) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_set_allocated:protocol.AccountTree.ledger)
+}
+
+// optional bytes consensus_value = 5;
+inline void AccountTree::clear_consensus_value() {
+  consensus_value_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline const ::std::string& AccountTree::consensus_value() const {
+  // @@protoc_insertion_point(field_get:protocol.AccountTree.consensus_value)
+  return consensus_value_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline void AccountTree::set_consensus_value(const ::std::string& value) {
+  
+  consensus_value_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:protocol.AccountTree.consensus_value)
+}
+inline void AccountTree::set_consensus_value(const char* value) {
+  
+  consensus_value_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:protocol.AccountTree.consensus_value)
+}
+inline void AccountTree::set_consensus_value(const void* value, size_t size) {
+  
+  consensus_value_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:protocol.AccountTree.consensus_value)
+}
+inline ::std::string* AccountTree::mutable_consensus_value() {
+  
+  // @@protoc_insertion_point(field_mutable:protocol.AccountTree.consensus_value)
+  return consensus_value_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline ::std::string* AccountTree::release_consensus_value() {
+  // @@protoc_insertion_point(field_release:protocol.AccountTree.consensus_value)
+  
+  return consensus_value_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline void AccountTree::set_allocated_consensus_value(::std::string* consensus_value) {
+  if (consensus_value != NULL) {
+    
+  } else {
+    
+  }
+  consensus_value_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), consensus_value);
+  // @@protoc_insertion_point(field_set_allocated:protocol.AccountTree.consensus_value)
+}
+
+// optional bytes next_value = 6;
+inline void AccountTree::clear_next_value() {
+  next_value_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline const ::std::string& AccountTree::next_value() const {
+  // @@protoc_insertion_point(field_get:protocol.AccountTree.next_value)
+  return next_value_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline void AccountTree::set_next_value(const ::std::string& value) {
+  
+  next_value_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:protocol.AccountTree.next_value)
+}
+inline void AccountTree::set_next_value(const char* value) {
+  
+  next_value_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:protocol.AccountTree.next_value)
+}
+inline void AccountTree::set_next_value(const void* value, size_t size) {
+  
+  next_value_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:protocol.AccountTree.next_value)
+}
+inline ::std::string* AccountTree::mutable_next_value() {
+  
+  // @@protoc_insertion_point(field_mutable:protocol.AccountTree.next_value)
+  return next_value_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline ::std::string* AccountTree::release_next_value() {
+  // @@protoc_insertion_point(field_release:protocol.AccountTree.next_value)
+  
+  return next_value_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline void AccountTree::set_allocated_next_value(::std::string* next_value) {
+  if (next_value != NULL) {
+    
+  } else {
+    
+  }
+  next_value_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), next_value);
+  // @@protoc_insertion_point(field_set_allocated:protocol.AccountTree.next_value)
+}
+
+// optional bytes next_proof = 7;
+inline void AccountTree::clear_next_proof() {
+  next_proof_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline const ::std::string& AccountTree::next_proof() const {
+  // @@protoc_insertion_point(field_get:protocol.AccountTree.next_proof)
+  return next_proof_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline void AccountTree::set_next_proof(const ::std::string& value) {
+  
+  next_proof_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:protocol.AccountTree.next_proof)
+}
+inline void AccountTree::set_next_proof(const char* value) {
+  
+  next_proof_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:protocol.AccountTree.next_proof)
+}
+inline void AccountTree::set_next_proof(const void* value, size_t size) {
+  
+  next_proof_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:protocol.AccountTree.next_proof)
+}
+inline ::std::string* AccountTree::mutable_next_proof() {
+  
+  // @@protoc_insertion_point(field_mutable:protocol.AccountTree.next_proof)
+  return next_proof_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline ::std::string* AccountTree::release_next_proof() {
+  // @@protoc_insertion_point(field_release:protocol.AccountTree.next_proof)
+  
+  return next_proof_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline void AccountTree::set_allocated_next_proof(::std::string* next_proof) {
+  if (next_proof != NULL) {
+    
+  } else {
+    
+  }
+  next_proof_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), next_proof);
+  // @@protoc_insertion_point(field_set_allocated:protocol.AccountTree.next_proof)
+}
+
+// optional bytes fees = 8;
+inline void AccountTree::clear_fees() {
+  fees_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline const ::std::string& AccountTree::fees() const {
+  // @@protoc_insertion_point(field_get:protocol.AccountTree.fees)
+  return fees_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline void AccountTree::set_fees(const ::std::string& value) {
+  
+  fees_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:protocol.AccountTree.fees)
+}
+inline void AccountTree::set_fees(const char* value) {
+  
+  fees_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:protocol.AccountTree.fees)
+}
+inline void AccountTree::set_fees(const void* value, size_t size) {
+  
+  fees_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:protocol.AccountTree.fees)
+}
+inline ::std::string* AccountTree::mutable_fees() {
+  
+  // @@protoc_insertion_point(field_mutable:protocol.AccountTree.fees)
+  return fees_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline ::std::string* AccountTree::release_fees() {
+  // @@protoc_insertion_point(field_release:protocol.AccountTree.fees)
+  
+  return fees_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline void AccountTree::set_allocated_fees(::std::string* fees) {
+  if (fees != NULL) {
+    
+  } else {
+    
+  }
+  fees_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), fees);
+  // @@protoc_insertion_point(field_set_allocated:protocol.AccountTree.fees)
+}
+
+// -------------------------------------------------------------------
+
 // DontHave
 
 // optional int64 type = 1;
@@ -3312,6 +4026,10 @@ inline void ChainTxStatus::set_timestamp(::google::protobuf::int64 value) {
 
 // -------------------------------------------------------------------
 
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
 
 // @@protoc_insertion_point(namespace_scope)
 
@@ -3326,6 +4044,11 @@ template <>
 inline const EnumDescriptor* GetEnumDescriptor< ::protocol::Ledgers_SyncCode>() {
   return ::protocol::Ledgers_SyncCode_descriptor();
 }
+template <> struct is_proto_enum< ::protocol::AccountTree_SyncCode> : ::google::protobuf::internal::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::protocol::AccountTree_SyncCode>() {
+  return ::protocol::AccountTree_SyncCode_descriptor();
+}
 template <> struct is_proto_enum< ::protocol::ChainTxStatus_TxStatus> : ::google::protobuf::internal::true_type {};
 template <>
 inline const EnumDescriptor* GetEnumDescriptor< ::protocol::ChainTxStatus_TxStatus>() {
@@ -29,6 +29,7 @@ const (
 	OVERLAY_MESSAGE_TYPE_OVERLAY_MSGTYPE_LEDGERS               OVERLAY_MESSAGE_TYPE = 5
 	OVERLAY_MESSAGE_TYPE_OVERLAY_MSGTYPE_PBFT                  OVERLAY_MESSAGE_TYPE = 6
 	OVERLAY_MESSAGE_TYPE_OVERLAY_MSGTYPE_LEDGER_UPGRADE_NOTIFY OVERLAY_MESSAGE_TYPE = 7
+	OVERLAY_MESSAGE_TYPE_OVERLAY_MSGTYPE_ACCOUNT_TREE          OVERLAY_MESSAGE_TYPE = 8
 )
 
 var OVERLAY_MESSAGE_TYPE_name = map[int32]string{
@@ -40,6 +41,7 @@ var OVERLAY_MESSAGE_TYPE_name = map[int32]string{
 	5: "OVERLAY_MSGTYPE_LEDGERS",
 	6: "OVERLAY_MSGTYPE_PBFT",
 	7: "OVERLAY_MSGTYPE_LEDGER_UPGRADE_NOTIFY",
+	8: "OVERLAY_MSGTYPE_ACCOUNT_TREE",
 }
 var OVERLAY_MESSAGE_TYPE_value = map[string]int32{
 	"OVERLAY_MSGTYPE_NONE":                  0,
@@ -50,13 +52,14 @@ var OVERLAY_MESSAGE_TYPE_value = map[string]int32{
 	"OVERLAY_MSGTYPE_LEDGERS":               5,
 	"OVERLAY_MSGTYPE_PBFT":                  6,
 	"OVERLAY_MSGTYPE_LEDGER_UPGRADE_NOTIFY": 7,
+	"OVERLAY_MSGTYPE_ACCOUNT_TREE":          8,
 }
 
 func (x OVERLAY_MESSAGE_TYPE) String() string {
 	return proto.EnumName(OVERLAY_MESSAGE_TYPE_name, int32(x))
 }
 func (OVERLAY_MESSAGE_TYPE) EnumDescriptor() ([]byte, []int) {
-	return fileDescriptor_overlay_026c4eb10906066d, []int{0}
+	return fileDescriptor_overlay_9f518ec24d883c8a, []int{0}
 }
 
 // message interfaces for java
@@ -104,7 +107,7 @@ func (x ChainMessageType) String() string {
 	return proto.EnumName(ChainMessageType_name, int32(x))
 }
 func (ChainMessageType) EnumDescriptor() ([]byte, []int) {
-	return fileDescriptor_overlay_026c4eb10906066d, []int{1}
+	return fileDescriptor_overlay_9f518ec24d883c8a, []int{1}
 }
 
 type Ledgers_SyncCode int32
@@ -139,7 +142,36 @@ func (x Ledgers_SyncCode) String() string {
 	return proto.EnumName(Ledgers_SyncCode_name, int32(x))
 }
 func (Ledgers_SyncCode) EnumDescriptor() ([]byte, []int) {
-	return fileDescriptor_overlay_026c4eb10906066d, []int{5, 0}
+	return fileDescriptor_overlay_9f518ec24d883c8a, []int{5, 0}
+}
+
+type AccountTree_SyncCode int32
+
+const (
+	AccountTree_OK         AccountTree_SyncCode = 0
+	AccountTree_NOT_READY  AccountTree_SyncCode = 1
+	AccountTree_NOT_PINNED AccountTree_SyncCode = 2
+	AccountTree_INTERNAL   AccountTree_SyncCode = 3
+)
+
+var AccountTree_SyncCode_name = map[int32]string{
+	0: "OK",
+	1: "NOT_READY",
+	2: "NOT_PINNED",
+	3: "INTERNAL",
+}
+var AccountTree_SyncCode_value = map[string]int32{
+	"OK":         0,
+	"NOT_READY":  1,
+	"NOT_PINNED": 2,
+	"INTERNAL":   3,
+}
+
+func (x AccountTree_SyncCode) String() string {
+	return proto.EnumName(AccountTree_SyncCode_name, int32(x))
+}
+func (AccountTree_SyncCode) EnumDescriptor() ([]byte, []int) {
+	return fileDescriptor_overlay_9f518ec24d883c8a, []int{7, 0}
 }
 
 type ChainTxStatus_TxStatus int32
@@ -171,14 +203,14 @@ func (x ChainTxStatus_TxStatus) String() string {
 	return proto.EnumName(ChainTxStatus_TxStatus_name, int32(x))
 }
 func (ChainTxStatus_TxStatus) EnumDescriptor() ([]byte, []int) {
-	return fileDescriptor_overlay_026c4eb10906066d, []int{14, 0}
+	return fileDescriptor_overlay_9f518ec24d883c8a, []int{16, 0}
 }
 
 type Hello struct {
 	NetworkId            int64    `protobuf:"varint,1,opt,name=network_id,json=networkId" json:"network_id,omitempty"`
 	LedgerVersion        int64    `protobuf:"varint,2,opt,name=ledger_version,json=ledgerVersion" json:"ledger_version,omitempty"`
 	OverlayVersion       int64    `protobuf:"varint,3,opt,name=overlay_version,json=overlayVersion" json:"overlay_version,omitempty"`
-	PhantomVersion          string   `protobuf:"bytes,4,opt,name=phantom_version,json=phantomVersion" json:"phantom_version,omitempty"`
+	PhantomVersion       string   `protobuf:"bytes,4,opt,name=phantom_version,json=phantomVersion" json:"phantom_version,omitempty"`
 	ListeningPort        int64    `protobuf:"varint,5,opt,name=listening_port,json=listeningPort" json:"listening_port,omitempty"`
 	NodeAddress          string   `protobuf:"bytes,6,opt,name=node_address,json=nodeAddress" json:"node_address,omitempty"`
 	NodeRand             string   `protobuf:"bytes,7,opt,name=node_rand,json=nodeRand" json:"node_rand,omitempty"`
@@ -191,7 +223,7 @@ func (m *Hello) Reset()         { *m = Hello{} }
 func (m *Hello) String() string { return proto.CompactTextString(m) }
 func (*Hello) ProtoMessage()    {}
 func (*Hello) Descriptor() ([]byte, []int) {
-	return fileDescriptor_overlay_026c4eb10906066d, []int{0}
+	return fileDescriptor_overlay_9f518ec24d883c8a, []int{0}
 }
 func (m *Hello) XXX_Unmarshal(b []byte) error {
 	return xxx_messageInfo_Hello.Unmarshal(m, b)
@@ -272,7 +304,7 @@ func (m *HelloResponse) Reset()         { *m = HelloResponse{} }
 func (m *HelloResponse) String() string { return proto.CompactTextString(m) }
 func (*HelloResponse) ProtoMessage()    {}
 func (*HelloResponse) Descriptor() ([]byte, []int) {
-	return fileDescriptor_overlay_026c4eb10906066d, []int{1}
+	return fileDescriptor_overlay_9f518ec24d883c8a, []int{1}
 }
 func (m *HelloResponse) XXX_Unmarshal(b []byte) error {
 	return xxx_messageInfo_HelloResponse.Unmarshal(m, b)
@@ -323,7 +355,7 @@ func (m *Peer) Reset()         { *m = Peer{} }
 func (m *Peer) String() string { return proto.CompactTextString(m) }
 func (*Peer) ProtoMessage()    {}
 func (*Peer) Descriptor() ([]byte, []int) {
-	return fileDescriptor_overlay_026c4eb10906066d, []int{2}
+	return fileDescriptor_overlay_9f518ec24d883c8a, []int{2}
 }
 func (m *Peer) XXX_Unmarshal(b []byte) error {
 	return xxx_messageInfo_Peer.Unmarshal(m, b)
@@ -396,7 +428,7 @@ func (m *Peers) Reset()         { *m = Peers{} }
 func (m *Peers) String() string { return proto.CompactTextString(m) }
 func (*Peers) ProtoMessage()    {}
 func (*Peers) Descriptor() ([]byte, []int) {
-	return fileDescriptor_overlay_026c4eb10906066d, []int{3}
+	return fileDescriptor_overlay_9f518ec24d883c8a, []int{3}
 }
 func (m *Peers) XXX_Unmarshal(b []byte) error {
 	return xxx_messageInfo_Peers.Unmarshal(m, b)
@@ -437,7 +469,7 @@ func (m *GetLedgers) Reset()         { *m = GetLedgers{} }
 func (m *GetLedgers) String() string { return proto.CompactTextString(m) }
 func (*GetLedgers) ProtoMessage()    {}
 func (*GetLedgers) Descriptor() ([]byte, []int) {
-	return fileDescriptor_overlay_026c4eb10906066d, []int{4}
+	return fileDescriptor_overlay_9f518ec24d883c8a, []int{4}
 }
 func (m *GetLedgers) XXX_Unmarshal(b []byte) error {
 	return xxx_messageInfo_GetLedgers.Unmarshal(m, b)
@@ -493,7 +525,7 @@ func (m *Ledgers) Reset()         { *m = Ledgers{} }
 func (m *Ledgers) String() string { return proto.CompactTextString(m) }
 func (*Ledgers) ProtoMessage()    {}
 func (*Ledgers) Descriptor() ([]byte, []int) {
-	return fileDescriptor_overlay_026c4eb10906066d, []int{5}
+	return fileDescriptor_overlay_9f518ec24d883c8a, []int{5}
 }
 func (m *Ledgers) XXX_Unmarshal(b []byte) error {
 	return xxx_messageInfo_Ledgers.Unmarshal(m, b)
@@ -541,6 +573,156 @@ func (m *Ledgers) GetProof() []byte {
 	return nil
 }
 
+// for state sync, rows of the account tree and of the asset and metadata trees of its accounts
+type GetAccountTree struct {
+	LedgerSeq            int64    `protobuf:"varint,1,opt,name=ledger_seq,json=ledgerSeq" json:"ledger_seq,omitempty"`
+	Keys                 [][]byte `protobuf:"bytes,2,rep,name=keys,proto3" json:"keys,omitempty"`
+	Timestamp            int64    `protobuf:"varint,3,opt,name=timestamp" json:"timestamp,omitempty"`
+	XXX_NoUnkeyedLiteral struct{} `json:"-"`
+	XXX_unrecognized     []byte   `json:"-"`
+	XXX_sizecache        int32    `json:"-"`
+}
+
+func (m *GetAccountTree) Reset()         { *m = GetAccountTree{} }
+func (m *GetAccountTree) String() string { return proto.CompactTextString(m) }
+func (*GetAccountTree) ProtoMessage()    {}
+func (*GetAccountTree) Descriptor() ([]byte, []int) {
+	return fileDescriptor_overlay_9f518ec24d883c8a, []int{6}
+}
+func (m *GetAccountTree) XXX_Unmarshal(b []byte) error {
+	return xxx_messageInfo_GetAccountTree.Unmarshal(m, b)
+}
+func (m *GetAccountTree) XXX_Marshal(b []byte, deterministic bool) ([]byte, error) {
+	return xxx_messageInfo_GetAccountTree.Marshal(b, m, deterministic)
+}
+func (dst *GetAccountTree) XXX_Merge(src proto.Message) {
+	xxx_messageInfo_GetAccountTree.Merge(dst, src)
+}
+func (m *GetAccountTree) XXX_Size() int {
+	return xxx_messageInfo_GetAccountTree.Size(m)
+}
+func (m *GetAccountTree) XXX_DiscardUnknown() {
+	xxx_messageInfo_GetAccountTree.DiscardUnknown(m)
+}
+
+var xxx_messageInfo_GetAccountTree proto.InternalMessageInfo
+
+func (m *GetAccountTree) GetLedgerSeq() int64 {
+	if m != nil {
+		return m.LedgerSeq
+	}
+	return 0
+}
+
+func (m *GetAccountTree) GetKeys() [][]byte {
+	if m != nil {
+		return m.Keys
+	}
+	return nil
+}
+
+func (m *GetAccountTree) GetTimestamp() int64 {
+	if m != nil {
+		return m.Timestamp
+	}
+	return 0
+}
+
+type AccountTree struct {
+	SyncCode  AccountTree_SyncCode `protobuf:"varint,1,opt,name=sync_code,json=syncCode,enum=protocol.AccountTree_SyncCode" json:"sync_code,omitempty"`
+	LedgerSeq int64                `protobuf:"varint,2,opt,name=ledger_seq,json=ledgerSeq" json:"ledger_seq,omitempty"`
+	Values    [][]byte             `protobuf:"bytes,3,rep,name=values,proto3" json:"values,omitempty"`
+	// for a request without keys
+	Ledger               *Ledger  `protobuf:"bytes,4,opt,name=ledger" json:"ledger,omitempty"`
+	ConsensusValue       []byte   `protobuf:"bytes,5,opt,name=consensus_value,json=consensusValue,proto3" json:"consensus_value,omitempty"`
+	NextValue            []byte   `protobuf:"bytes,6,opt,name=next_value,json=nextValue,proto3" json:"next_value,omitempty"`
+	NextProof            []byte   `protobuf:"bytes,7,opt,name=next_proof,json=nextProof,proto3" json:"next_proof,omitempty"`
+	Fees                 []byte   `protobuf:"bytes,8,opt,name=fees,proto3" json:"fees,omitempty"`
+	XXX_NoUnkeyedLiteral struct{} `json:"-"`
+	XXX_unrecognized     []byte   `json:"-"`
+	XXX_sizecache        int32    `json:"-"`
+}
+
+func (m *AccountTree) Reset()         { *m = AccountTree{} }
+func (m *AccountTree) String() string { return proto.CompactTextString(m) }
+func (*AccountTree) ProtoMessage()    {}
+func (*AccountTree) Descriptor() ([]byte, []int) {
+	return fileDescriptor_overlay_9f518ec24d883c8a, []int{7}
+}
+func (m *AccountTree) XXX_Unmarshal(b []byte) error {
+	return xxx_messageInfo_AccountTree.Unmarshal(m, b)
+}
+func (m *AccountTree) XXX_Marshal(b []byte, deterministic bool) ([]byte, error) {
+	return xxx_messageInfo_AccountTree.Marshal(b, m, deterministic)
+}
+func (dst *AccountTree) XXX_Merge(src proto.Message) {
+	xxx_messageInfo_AccountTree.Merge(dst, src)
+}
+func (m *AccountTree) XXX_Size() int {
+	return xxx_messageInfo_AccountTree.Size(m)
+}
+func (m *AccountTree) XXX_DiscardUnknown() {
+	xxx_messageInfo_AccountTree.DiscardUnknown(m)
+}
+
+var xxx_messageInfo_AccountTree proto.InternalMessageInfo
+
+func (m *AccountTree) GetSyncCode() AccountTree_SyncCode {
+	if m != nil {
+		return m.SyncCode
+	}
+	return AccountTree_OK
+}
+
+func (m *AccountTree) GetLedgerSeq() int64 {
+	if m != nil {
+		return m.LedgerSeq
+	}
+	return 0
+}
+
+func (m *AccountTree) GetValues() [][]byte {
+	if m != nil {
+		return m.Values
+	}
+	return nil
+}
+
+func (m *AccountTree) GetLedger() *Ledger {
+	if m != nil {
+		return m.Ledger
+	}
+	return nil
+}
+
+func (m *AccountTree) GetConsensusValue() []byte {
+	if m != nil {
+		return m.ConsensusValue
+	}
+	return nil
+}
+
+func (m *AccountTree) GetNextValue() []byte {
+	if m != nil {
+		return m.NextValue
+	}
+	return nil
+}
+
+func (m *AccountTree) GetNextProof() []byte {
+	if m != nil {
+		return m.NextProof
+	}
+	return nil
+}
+
+func (m *AccountTree) GetFees() []byte {
+	if m != nil {
+		return m.Fees
+	}
+	return nil
+}
+
 // for dont have
 type DontHave struct {
 	Type                 int64    `protobuf:"varint,1,opt,name=type" json:"type,omitempty"`
@@ -554,7 +736,7 @@ func (m *DontHave) Reset()         { *m = DontHave{} }
 func (m *DontHave) String() string { return proto.CompactTextString(m) }
 func (*DontHave) ProtoMessage()    {}
 func (*DontHave) Descriptor() ([]byte, []int) {
-	return fileDescriptor_overlay_026c4eb10906066d, []int{6}
+	return fileDescriptor_overlay_9f518ec24d883c8a, []int{8}
 }
 func (m *DontHave) XXX_Unmarshal(b []byte) error {
 	return xxx_messageInfo_DontHave.Unmarshal(m, b)
@@ -602,7 +784,7 @@ func (m *LedgerUpgradeNotify) Reset()         { *m = LedgerUpgradeNotify{} }
 func (m *LedgerUpgradeNotify) String() string { return proto.CompactTextString(m) }
 func (*LedgerUpgradeNotify) ProtoMessage()    {}
 func (*LedgerUpgradeNotify) Descriptor() ([]byte, []int) {
-	return fileDescriptor_overlay_026c4eb10906066d, []int{7}
+	return fileDescriptor_overlay_9f518ec24d883c8a, []int{9}
 }
 func (m *LedgerUpgradeNotify) XXX_Unmarshal(b []byte) error {
 	return xxx_messageInfo_LedgerUpgradeNotify.Unmarshal(m, b)
@@ -655,7 +837,7 @@ func (m *EntryList) Reset()         { *m = EntryList{} }
 func (m *EntryList) String() string { return proto.CompactTextString(m) }
 func (*EntryList) ProtoMessage()    {}
 func (*EntryList) Descriptor() ([]byte, []int) {
-	return fileDescriptor_overlay_026c4eb10906066d, []int{8}
+	return fileDescriptor_overlay_9f518ec24d883c8a, []int{10}
 }
 func (m *EntryList) XXX_Unmarshal(b []byte) error {
 	return xxx_messageInfo_EntryList.Unmarshal(m, b)
@@ -695,7 +877,7 @@ func (m *ChainHello) Reset()         { *m = ChainHello{} }
 func (m *ChainHello) String() string { return proto.CompactTextString(m) }
 func (*ChainHello) ProtoMessage()    {}
 func (*ChainHello) Descriptor() ([]byte, []int) {
-	return fileDescriptor_overlay_026c4eb10906066d, []int{9}
+	return fileDescriptor_overlay_9f518ec24d883c8a, []int{11}
 }
 func (m *ChainHello) XXX_Unmarshal(b []byte) error {
 	return xxx_messageInfo_ChainHello.Unmarshal(m, b)
@@ -735,7 +917,7 @@ type ChainStatus struct {
 	SelfAddr             string   `protobuf:"bytes,1,opt,name=self_addr,json=selfAddr" json:"self_addr,omitempty"`
 	LedgerVersion        int64    `protobuf:"varint,2,opt,name=ledger_version,json=ledgerVersion" json:"ledger_version,omitempty"`
 	MonitorVersion       int64    `protobuf:"varint,3,opt,name=monitor_version,json=monitorVersion" json:"monitor_version,omitempty"`
-	PhantomVersion          string   `protobuf:"bytes,4,opt,name=phantom_version,json=phantomVersion" json:"phantom_version,omitempty"`
+	PhantomVersion       string   `protobuf:"bytes,4,opt,name=phantom_version,json=phantomVersion" json:"phantom_version,omitempty"`
 	Timestamp            int64    `protobuf:"varint,5,opt,name=timestamp" json:"timestamp,omitempty"`
 	XXX_NoUnkeyedLiteral struct{} `json:"-"`
 	XXX_unrecognized     []byte   `json:"-"`
@@ -746,7 +928,7 @@ func (m *ChainStatus) Reset()         { *m = ChainStatus{} }
 func (m *ChainStatus) String() string { return proto.CompactTextString(m) }
 func (*ChainStatus) ProtoMessage()    {}
 func (*ChainStatus) Descriptor() ([]byte, []int) {
-	return fileDescriptor_overlay_026c4eb10906066d, []int{10}
+	return fileDescriptor_overlay_9f518ec24d883c8a, []int{12}
 }
 func (m *ChainStatus) XXX_Unmarshal(b []byte) error {
 	return xxx_messageInfo_ChainStatus.Unmarshal(m, b)
@@ -814,7 +996,7 @@ func (m *ChainPeerMessage) Reset()         { *m = ChainPeerMessage{} }
 func (m *ChainPeerMessage) String() string { return proto.CompactTextString(m) }
 func (*ChainPeerMessage) ProtoMessage()    {}
 func (*ChainPeerMessage) Descriptor() ([]byte, []int) {
-	return fileDescriptor_overlay_026c4eb10906066d, []int{11}
+	return fileDescriptor_overlay_9f518ec24d883c8a, []int{13}
 }
 func (m *ChainPeerMessage) XXX_Unmarshal(b []byte) error {
 	return xxx_messageInfo_ChainPeerMessage.Unmarshal(m, b)
@@ -866,7 +1048,7 @@ func (m *ChainSubscribeTx) Reset()         { *m = ChainSubscribeTx{} }
 func (m *ChainSubscribeTx) String() string { return proto.CompactTextString(m) }
 func (*ChainSubscribeTx) ProtoMessage()    {}
 func (*ChainSubscribeTx) Descriptor() ([]byte, []int) {
-	return fileDescriptor_overlay_026c4eb10906066d, []int{12}
+	return fileDescriptor_overlay_9f518ec24d883c8a, []int{14}
 }
 func (m *ChainSubscribeTx) XXX_Unmarshal(b []byte) error {
 	return xxx_messageInfo_ChainSubscribeTx.Unmarshal(m, b)
@@ -905,7 +1087,7 @@ func (m *ChainResponse) Reset()         { *m = ChainResponse{} }
 func (m *ChainResponse) String() string { return proto.CompactTextString(m) }
 func (*ChainResponse) ProtoMessage()    {}
 func (*ChainResponse) Descriptor() ([]byte, []int) {
-	return fileDescriptor_overlay_026c4eb10906066d, []int{13}
+	return fileDescriptor_overlay_9f518ec24d883c8a, []int{15}
 }
 func (m *ChainResponse) XXX_Unmarshal(b []byte) error {
 	return xxx_messageInfo_ChainResponse.Unmarshal(m, b)
@@ -958,7 +1140,7 @@ func (m *ChainTxStatus) Reset()         { *m = ChainTxStatus{} }
 func (m *ChainTxStatus) String() string { return proto.CompactTextString(m) }
 func (*ChainTxStatus) ProtoMessage()    {}
 func (*ChainTxStatus) Descriptor() ([]byte, []int) {
-	return fileDescriptor_overlay_026c4eb10906066d, []int{14}
+	return fileDescriptor_overlay_9f518ec24d883c8a, []int{16}
 }
 func (m *ChainTxStatus) XXX_Unmarshal(b []byte) error {
 	return xxx_messageInfo_ChainTxStatus.Unmarshal(m, b)
@@ -1048,6 +1230,8 @@ func init() {
 	proto.RegisterType((*Peers)(nil), "protocol.Peers")
 	proto.RegisterType((*GetLedgers)(nil), "protocol.GetLedgers")
 	proto.RegisterType((*Ledgers)(nil), "protocol.Ledgers")
+	proto.RegisterType((*GetAccountTree)(nil), "protocol.GetAccountTree")
+	proto.RegisterType((*AccountTree)(nil), "protocol.AccountTree")
 	proto.RegisterType((*DontHave)(nil), "protocol.DontHave")
 	proto.RegisterType((*LedgerUpgradeNotify)(nil), "protocol.LedgerUpgradeNotify")
 	proto.RegisterType((*EntryList)(nil), "protocol.EntryList")
@@ -1060,95 +1244,106 @@ func init() {
 	proto.RegisterEnum("protocol.OVERLAY_MESSAGE_TYPE", OVERLAY_MESSAGE_TYPE_name, OVERLAY_MESSAGE_TYPE_value)
 	proto.RegisterEnum("protocol.ChainMessageType", ChainMessageType_name, ChainMessageType_value)
 	proto.RegisterEnum("protocol.Ledgers_SyncCode", Ledgers_SyncCode_name, Ledgers_SyncCode_value)
+	proto.RegisterEnum("protocol.AccountTree_SyncCode", AccountTree_SyncCode_name, AccountTree_SyncCode_value)
 	proto.RegisterEnum("protocol.ChainTxStatus_TxStatus", ChainTxStatus_TxStatus_name, ChainTxStatus_TxStatus_value)
 }
 
-func init() { proto.RegisterFile("overlay.proto", fileDescriptor_overlay_026c4eb10906066d) }
-
-var fileDescriptor_overlay_026c4eb10906066d = []byte{
-	// 1336 bytes of a gzipped FileDescriptorProto
-	0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0x9c, 0x55, 0x4b, 0x6f, 0xdb, 0xc6,
-	0x16, 0x8e, 0x24, 0xeb, 0x75, 0xf4, 0x30, 0x33, 0x4e, 0xae, 0x75, 0x93, 0x1b, 0xc4, 0xd1, 0x4d,
-	0xee, 0x75, 0x83, 0x54, 0x68, 0x5c, 0x14, 0xed, 0x56, 0x96, 0x28, 0x5b, 0xa8, 0x4c, 0x09, 0x43,
-	0xca, 0x88, 0xd1, 0x05, 0x41, 0x93, 0x63, 0x9b, 0x88, 0x34, 0xc3, 0x70, 0x46, 0x8e, 0xb4, 0x2b,
-	0xd0, 0x5f, 0xd0, 0xdf, 0xd3, 0x45, 0xd1, 0xbf, 0xd5, 0x55, 0x31, 0x0f, 0x5a, 0xb2, 0xea, 0x4d,
-	0xba, 0xe2, 0x99, 0xef, 0x7c, 0x3c, 0x3c, 0xaf, 0xf9, 0x08, 0x0d, 0x76, 0x4b, 0xd2, 0x59, 0xb0,
-	0xea, 0x24, 0x29, 0x13, 0x0c, 0x55, 0xd4, 0x23, 0x64, 0xb3, 0x67, 0xf5, 0x90, 0xcd, 0xe7, 0x8c,
-	0x6a, 0xfc, 0x59, 0x2d, 0xbc, 0x09, 0x62, 0x73, 0x68, 0xff, 0x9c, 0x87, 0xe2, 0x29, 0x99, 0xcd,
-	0x18, 0x7a, 0x01, 0x40, 0x89, 0xf8, 0xcc, 0xd2, 0x8f, 0x7e, 0x1c, 0xb5, 0x72, 0x07, 0xb9, 0xc3,
-	0x02, 0xae, 0x1a, 0x64, 0x18, 0xa1, 0x37, 0xd0, 0x9c, 0x91, 0xe8, 0x9a, 0xa4, 0xfe, 0x2d, 0x49,
-	0x79, 0xcc, 0x68, 0x2b, 0xaf, 0x28, 0x0d, 0x8d, 0x9e, 0x6b, 0x10, 0xfd, 0x1f, 0x76, 0x4d, 0x16,
-	0x77, 0xbc, 0x82, 0xe2, 0x35, 0x0d, 0x9c, 0x11, 0x5f, 0x41, 0xfd, 0x72, 0x31, 0x67, 0x77, 0xac,
-	0x9d, 0x83, 0xdc, 0x61, 0x15, 0xd7, 0x24, 0x96, 0x51, 0xe4, 0x27, 0x63, 0x2e, 0x08, 0x8d, 0xe9,
-	0xb5, 0x9f, 0xb0, 0x54, 0xb4, 0x8a, 0xe6, 0x93, 0x19, 0x3a, 0x61, 0xa9, 0x90, 0x91, 0x28, 0x8b,
-	0x88, 0x1f, 0x44, 0x51, 0x4a, 0x38, 0x6f, 0x95, 0x74, 0x24, 0x89, 0x75, 0x35, 0x84, 0x9e, 0x43,
-	0x55, 0x51, 0xd2, 0x80, 0x46, 0xad, 0xb2, 0xf2, 0x57, 0x24, 0x80, 0x03, 0x1a, 0xb5, 0x2f, 0xa1,
-	0xa1, 0x3a, 0x80, 0x09, 0x4f, 0x18, 0xe5, 0x04, 0x1d, 0x01, 0x90, 0x34, 0x65, 0xa9, 0x1f, 0xb2,
-	0x88, 0xa8, 0x4e, 0x34, 0x8f, 0xf6, 0x3a, 0x59, 0x37, 0x3b, 0x36, 0xc6, 0x63, 0xdc, 0x1b, 0xf7,
-	0x6d, 0x5c, 0x55, 0xb4, 0x1e, 0x8b, 0x88, 0xec, 0x9e, 0x7e, 0x27, 0x22, 0x3c, 0x54, 0xad, 0xa9,
-	0x1a, 0x77, 0x9f, 0xf0, 0xb0, 0xfd, 0x7b, 0x0e, 0x76, 0x26, 0x84, 0xa4, 0xa8, 0x09, 0xf9, 0x38,
-	0x51, 0x31, 0xab, 0x38, 0x1f, 0x27, 0x08, 0xc1, 0x8e, 0xaa, 0x4c, 0x37, 0x53, 0xd9, 0xaa, 0xa0,
-	0xc5, 0xdc, 0xbf, 0x0a, 0xe2, 0xd9, 0x22, 0x25, 0xdc, 0x34, 0xb0, 0x46, 0x17, 0xf3, 0x81, 0x81,
-	0xd0, 0x5b, 0x78, 0x4c, 0xc9, 0x52, 0xf8, 0x81, 0x10, 0x64, 0x9e, 0x08, 0x5f, 0xc4, 0x73, 0xa2,
-	0x5a, 0x58, 0xc0, 0xbb, 0xd2, 0xd1, 0xd5, 0xb8, 0x17, 0xcf, 0x09, 0x7a, 0x09, 0xb5, 0x20, 0x14,
-	0xf1, 0x2d, 0xd1, 0x2c, 0xdd, 0x43, 0xd0, 0x90, 0x22, 0xfc, 0x17, 0x1a, 0x21, 0xa3, 0x94, 0x84,
-	0x22, 0x66, 0x54, 0x0e, 0xbf, 0xa4, 0x28, 0xf5, 0x35, 0x38, 0x8c, 0xda, 0x5f, 0x43, 0x51, 0x16,
-	0xc0, 0xd1, 0x6b, 0x28, 0x26, 0xd2, 0x68, 0xe5, 0x0e, 0x0a, 0x87, 0xb5, 0xa3, 0xe6, 0xba, 0x31,
-	0xd2, 0x8f, 0xb5, 0xb3, 0x8d, 0x01, 0x4e, 0x88, 0x18, 0xa9, 0xdd, 0xe0, 0xe8, 0x09, 0x14, 0x2f,
-	0xc9, 0x75, 0x4c, 0xcd, 0x5a, 0xe9, 0x03, 0xb2, 0xa0, 0x40, 0x68, 0x64, 0x4a, 0x97, 0x26, 0xfa,
-	0x0f, 0x54, 0x65, 0x8e, 0x5c, 0x04, 0xf3, 0xc4, 0x94, 0xbd, 0x06, 0xe4, 0xae, 0x96, 0xb3, 0x88,
-	0xdf, 0x40, 0xe9, 0x36, 0x98, 0x2d, 0x48, 0x96, 0x46, 0x6b, 0x9d, 0x46, 0x4f, 0x0e, 0x91, 0xf2,
-	0x05, 0x3f, 0x97, 0x04, 0x6c, 0x78, 0xe8, 0x7b, 0xa8, 0xf2, 0x15, 0x0d, 0xf5, 0x50, 0xf3, 0x6a,
-	0xa8, 0xcf, 0xd6, 0x2f, 0x99, 0xb8, 0x1d, 0x77, 0x45, 0x43, 0x39, 0x50, 0x5c, 0xe1, 0xc6, 0x42,
-	0xfb, 0x50, 0x9e, 0x07, 0x4b, 0x9f, 0x93, 0x4f, 0x26, 0xa5, 0xd2, 0x3c, 0x58, 0xba, 0xe4, 0x93,
-	0xac, 0x2a, 0x49, 0x19, 0xbb, 0x52, 0x8d, 0xaf, 0x63, 0x7d, 0x68, 0xff, 0x04, 0x95, 0x2c, 0x08,
-	0x2a, 0x41, 0x7e, 0xfc, 0xa3, 0xf5, 0x08, 0xed, 0x42, 0x6d, 0x3c, 0xf5, 0xfc, 0xf1, 0xc0, 0x77,
-	0x2f, 0x9c, 0x9e, 0x95, 0x43, 0x08, 0x9a, 0x06, 0x18, 0xd9, 0xfd, 0x13, 0x1b, 0xbb, 0x56, 0x1e,
-	0x55, 0x60, 0xe7, 0x78, 0xea, 0x5e, 0x58, 0x05, 0x04, 0x50, 0xc2, 0xf6, 0x60, 0xea, 0xda, 0xd6,
-	0x0e, 0xaa, 0x43, 0x65, 0xe8, 0x78, 0x36, 0x76, 0xba, 0x23, 0xab, 0xd8, 0x3e, 0x82, 0x4a, 0x9f,
-	0x51, 0x71, 0x1a, 0xdc, 0x12, 0xb9, 0x3a, 0x62, 0x95, 0x10, 0xd3, 0x53, 0x65, 0x4b, 0xec, 0x26,
-	0xe0, 0x37, 0xaa, 0xbe, 0x3a, 0x56, 0x76, 0xfb, 0xd7, 0x1c, 0xec, 0xe9, 0xf2, 0xa6, 0xc9, 0x75,
-	0x1a, 0x44, 0xc4, 0x61, 0x22, 0xbe, 0x5a, 0xc9, 0xf4, 0x29, 0xa3, 0x61, 0x16, 0x40, 0x1f, 0xd0,
-	0x7b, 0x28, 0x2f, 0x34, 0x4d, 0x05, 0xa9, 0x1d, 0xed, 0x6f, 0x37, 0xc9, 0x44, 0xc1, 0x19, 0x0f,
-	0xbd, 0x87, 0x2a, 0x8f, 0xaf, 0x69, 0x20, 0x16, 0x29, 0x51, 0x2d, 0xaa, 0x6d, 0x5e, 0x17, 0x37,
-	0x73, 0xe1, 0x35, 0xab, 0xfd, 0x0a, 0xaa, 0x36, 0x15, 0xe9, 0x6a, 0x14, 0x73, 0x21, 0x13, 0x21,
-	0xf2, 0xa0, 0x46, 0x59, 0xc7, 0xfa, 0xd0, 0x0e, 0x00, 0x7a, 0x52, 0xa8, 0xb4, 0x3a, 0x7d, 0x07,
-	0x95, 0x20, 0x89, 0x7d, 0x79, 0xf3, 0x15, 0xed, 0xde, 0xf0, 0x14, 0xef, 0x8c, 0x70, 0x1e, 0x5c,
-	0x13, 0x6f, 0x95, 0x10, 0x5c, 0x0e, 0x92, 0x58, 0x85, 0xbe, 0xb7, 0x50, 0xf9, 0xed, 0x85, 0xfa,
-	0x2d, 0x07, 0x35, 0xf5, 0xae, 0x2b, 0x02, 0xb1, 0x50, 0x32, 0xc1, 0xc9, 0xec, 0x4a, 0x29, 0x89,
-	0xb9, 0xa3, 0x15, 0x09, 0x48, 0x19, 0xf9, 0x02, 0x01, 0x9c, 0x33, 0x1a, 0x0b, 0x96, 0x6e, 0x0b,
-	0xa0, 0x81, 0xbf, 0x40, 0x00, 0xef, 0x65, 0x5f, 0xdc, 0xce, 0x3e, 0x01, 0x4b, 0x25, 0x2f, 0xaf,
-	0x9d, 0x29, 0x1e, 0xb5, 0xa1, 0xc1, 0xd3, 0xd0, 0x97, 0x77, 0x70, 0xb3, 0x8a, 0x1a, 0x4f, 0x43,
-	0x49, 0x53, 0x85, 0xbc, 0x86, 0x66, 0x44, 0xf8, 0x9a, 0xc3, 0x5b, 0xf9, 0x83, 0xc2, 0x61, 0x15,
-	0xd7, 0x23, 0xc2, 0x33, 0x12, 0x97, 0x9b, 0x14, 0x05, 0x22, 0x50, 0xc9, 0xd7, 0xb1, 0xb2, 0xdb,
-	0xef, 0xcc, 0x17, 0xdd, 0xc5, 0x25, 0x0f, 0xd3, 0xf8, 0x92, 0x78, 0x4b, 0xd4, 0x82, 0x72, 0x26,
-	0xbc, 0x39, 0x15, 0x26, 0x3b, 0xb6, 0xcf, 0xa0, 0xa1, 0xd8, 0x77, 0xba, 0xfa, 0xe2, 0x6f, 0xba,
-	0x5a, 0xfc, 0x02, 0x09, 0xfd, 0xa3, 0x60, 0xe2, 0x79, 0x4b, 0x33, 0xae, 0x1f, 0xa0, 0xc4, 0x95,
-	0x65, 0x34, 0xfa, 0x60, 0x6b, 0x23, 0x32, 0x62, 0x27, 0x33, 0xb0, 0xe1, 0xcb, 0x2b, 0x2d, 0x96,
-	0xfe, 0xdd, 0x4d, 0xa9, 0xe2, 0x92, 0x58, 0x9e, 0x06, 0xfc, 0x46, 0x0e, 0x99, 0xb3, 0x45, 0x1a,
-	0xae, 0xff, 0x26, 0x05, 0xe5, 0x6f, 0x68, 0x34, 0xfb, 0x9f, 0xbc, 0x03, 0x94, 0xd1, 0xc2, 0x90,
-	0x2d, 0xa8, 0x50, 0xea, 0xa0, 0xf5, 0xd7, 0x32, 0x54, 0xed, 0x90, 0x3a, 0xf1, 0x02, 0xc0, 0x6c,
-	0x8e, 0x64, 0x99, 0x39, 0x6a, 0x44, 0xba, 0xff, 0x07, 0xbb, 0x94, 0x7c, 0xbe, 0x17, 0x49, 0x0b,
-	0x70, 0x83, 0x92, 0xcf, 0x1b, 0x61, 0xee, 0xff, 0x96, 0xca, 0xff, 0xe0, 0xb7, 0x54, 0xd9, 0xea,
-	0xe9, 0xfd, 0x05, 0xab, 0x6e, 0x2f, 0xd8, 0x04, 0x2a, 0x77, 0xbd, 0x6e, 0x40, 0x75, 0xea, 0xf4,
-	0xed, 0xc1, 0xd0, 0xb1, 0xfb, 0xd6, 0x23, 0x79, 0xec, 0x8d, 0x9d, 0xc1, 0x10, 0x9f, 0xd9, 0x7d,
-	0x2b, 0x87, 0x6a, 0x50, 0x9e, 0xd8, 0x4e, 0x7f, 0xe8, 0x9c, 0x58, 0x79, 0xa9, 0x58, 0xbd, 0xf1,
-	0xd9, 0x64, 0x64, 0x7b, 0xb6, 0x55, 0x90, 0xae, 0x41, 0x77, 0x38, 0x9a, 0x62, 0xdb, 0xda, 0x79,
-	0xfb, 0x4b, 0x1e, 0x9e, 0x8c, 0xcf, 0x6d, 0x3c, 0xea, 0x5e, 0xf8, 0x67, 0xb6, 0xeb, 0x76, 0x4f,
-	0x6c, 0xdf, 0xbb, 0x98, 0xd8, 0xa8, 0xb5, 0x81, 0xbb, 0x27, 0x12, 0xf2, 0x9d, 0xb1, 0x63, 0x5b,
-	0x8f, 0x1e, 0xf2, 0x4c, 0xe4, 0x77, 0x72, 0xe8, 0xdf, 0xf0, 0x74, 0xdb, 0x73, 0x6a, 0x8f, 0x46,
-	0x63, 0x2b, 0xff, 0x90, 0x6b, 0x62, 0x4b, 0x95, 0x2d, 0xa0, 0x97, 0xf0, 0x7c, 0xdb, 0xe5, 0xe1,
-	0xae, 0xe3, 0x76, 0x7b, 0xde, 0x70, 0xec, 0x58, 0x3b, 0xe8, 0x39, 0xec, 0x6f, 0x13, 0x32, 0x8d,
-	0x2e, 0x3e, 0x98, 0xcd, 0xf1, 0xc0, 0xb3, 0x4a, 0xe8, 0x2b, 0x78, 0xf3, 0xf0, 0x6b, 0xfe, 0x74,
-	0x72, 0x82, 0xbb, 0x7d, 0x59, 0x90, 0x37, 0x1c, 0x5c, 0x58, 0xe5, 0xb7, 0x7f, 0xe6, 0xcc, 0x3d,
-	0xda, 0x90, 0x2c, 0xb4, 0x07, 0xbb, 0xbd, 0xd3, 0xee, 0xd0, 0xf1, 0x37, 0x8b, 0xdf, 0x85, 0x9a,
-	0x06, 0x75, 0x61, 0xb0, 0xc1, 0xfa, 0xe0, 0xbb, 0x5e, 0xd7, 0x9b, 0xba, 0x56, 0x0d, 0x3d, 0x85,
-	0xc7, 0x1a, 0x94, 0x35, 0xfa, 0x63, 0x67, 0x34, 0x74, 0x6c, 0xab, 0x8e, 0xfe, 0x05, 0x68, 0x13,
-	0x1e, 0x0c, 0x14, 0xde, 0xd8, 0xc2, 0xcd, 0x18, 0xac, 0xa6, 0x2c, 0x5c, 0xe3, 0xee, 0xf4, 0xf8,
-	0x6c, 0xe8, 0x6d, 0x76, 0x65, 0x17, 0xed, 0xc3, 0x9e, 0x76, 0x9a, 0xa2, 0x4e, 0xed, 0x6e, 0xdf,
-	0xc6, 0x96, 0xb5, 0x8e, 0xe6, 0x4e, 0x8f, 0xdd, 0x1e, 0x1e, 0x1e, 0xdb, 0xbe, 0xf7, 0xc1, 0x7a,
-	0xbc, 0xc6, 0xbd, 0x0f, 0xbe, 0xed, 0x9c, 0xfb, 0xae, 0x37, 0xc6, 0xb6, 0x85, 0x8e, 0xdb, 0x70,
-	0x10, 0xb3, 0x8e, 0x54, 0xb9, 0x0e, 0x8f, 0x3e, 0x76, 0x42, 0x96, 0x92, 0x0e, 0x59, 0x0a, 0x42,
-	0x23, 0xbd, 0xca, 0x97, 0x8b, 0xab, 0xcb, 0x92, 0xb2, 0xbe, 0xfd, 0x2b, 0x00, 0x00, 0xff, 0xff,
-	0xfa, 0xc6, 0x07, 0x01, 0xd1, 0x0a, 0x00, 0x00,
+func init() { proto.RegisterFile("overlay.proto", fileDescriptor_overlay_9f518ec24d883c8a) }
+
+var fileDescriptor_overlay_9f518ec24d883c8a = []byte{
+	// 1496 bytes of a gzipped FileDescriptorProto
+	0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x9d, 0x56, 0x4b, 0x6f, 0xdb, 0x46,
+	0x10, 0xae, 0x24, 0xeb, 0x35, 0x7a, 0x98, 0x59, 0x27, 0x8d, 0x9b, 0x47, 0x9b, 0xb0, 0x49, 0x9a,
+	0x06, 0xa9, 0xd0, 0xba, 0x28, 0x5a, 0xa0, 0x87, 0x42, 0x96, 0x28, 0x5b, 0xa8, 0x4c, 0x0a, 0x4b,
+	0xca, 0x88, 0xd1, 0x03, 0x41, 0x53, 0x6b, 0x9b, 0x88, 0x44, 0x2a, 0x24, 0x95, 0xd8, 0xb7, 0x9e,
+	0x7a, 0xef, 0x8f, 0xe8, 0xef, 0x28, 0xf2, 0x6b, 0xfa, 0x1f, 0x7a, 0xea, 0xec, 0x83, 0x96, 0xc4,
+	0x1a, 0x28, 0xd2, 0x13, 0x77, 0xbf, 0xf9, 0x76, 0x76, 0x5e, 0x3b, 0x43, 0x68, 0x45, 0x6f, 0x59,
+	0x3c, 0xf3, 0xae, 0x3a, 0x8b, 0x38, 0x4a, 0x23, 0x52, 0x13, 0x1f, 0x3f, 0x9a, 0xdd, 0x6b, 0xfa,
+	0xd1, 0x7c, 0x1e, 0x85, 0x12, 0xbf, 0xd7, 0xf0, 0x2f, 0xbc, 0x40, 0x6d, 0xf4, 0xdf, 0x8a, 0x50,
+	0x3e, 0x64, 0xb3, 0x59, 0x44, 0x1e, 0x02, 0x84, 0x2c, 0x7d, 0x17, 0xc5, 0xaf, 0xdd, 0x60, 0xba,
+	0x5b, 0x78, 0x54, 0x78, 0x5e, 0xa2, 0x75, 0x85, 0x0c, 0xa7, 0xe4, 0x29, 0xb4, 0x67, 0x6c, 0x7a,
+	0xce, 0x62, 0x17, 0x2f, 0x49, 0x82, 0x28, 0xdc, 0x2d, 0x0a, 0x4a, 0x4b, 0xa2, 0xc7, 0x12, 0x24,
+	0x5f, 0xc0, 0xb6, 0xb2, 0xe2, 0x9a, 0x57, 0x12, 0xbc, 0xb6, 0x82, 0xd7, 0x88, 0x8b, 0x0b, 0x2f,
+	0x4c, 0xa3, 0xf9, 0x35, 0x71, 0x0b, 0x89, 0x75, 0xda, 0x56, 0x70, 0x46, 0xe4, 0x17, 0x07, 0x49,
+	0xca, 0xc2, 0x20, 0x3c, 0x77, 0x17, 0x51, 0x9c, 0xee, 0x96, 0xd5, 0xc5, 0x19, 0x3a, 0x46, 0x90,
+	0x3c, 0x86, 0x66, 0x18, 0x4d, 0x99, 0xeb, 0x4d, 0xa7, 0x31, 0x4b, 0x92, 0xdd, 0x8a, 0x50, 0xd6,
+	0xe0, 0x58, 0x57, 0x42, 0xe4, 0x3e, 0xd4, 0x05, 0x25, 0xf6, 0xc2, 0xe9, 0x6e, 0x55, 0xc8, 0x6b,
+	0x1c, 0xa0, 0xb8, 0xd7, 0x4f, 0xa1, 0x25, 0xe2, 0x40, 0x59, 0xb2, 0x88, 0xc2, 0x84, 0x91, 0x3d,
+	0x00, 0x16, 0xc7, 0x51, 0xec, 0xfa, 0x48, 0x11, 0xf1, 0x68, 0xef, 0xed, 0x74, 0xb2, 0x98, 0x76,
+	0x0c, 0x4a, 0x2d, 0xda, 0xb3, 0xfa, 0x06, 0xad, 0x0b, 0x5a, 0x0f, 0x59, 0x3c, 0x86, 0xf2, 0xcc,
+	0x94, 0x25, 0xbe, 0x08, 0x50, 0x5d, 0x89, 0xfb, 0x08, 0xe8, 0x7f, 0x16, 0x60, 0x6b, 0xcc, 0x58,
+	0x4c, 0xda, 0x50, 0x0c, 0x16, 0x42, 0x67, 0x9d, 0xe2, 0x8a, 0x10, 0xd8, 0x12, 0x9e, 0xc9, 0x90,
+	0x8a, 0xb5, 0x70, 0x68, 0x39, 0x77, 0xcf, 0xbc, 0x60, 0xb6, 0x44, 0xf3, 0x55, 0x18, 0x1b, 0x88,
+	0x0d, 0x14, 0x44, 0x5e, 0xc0, 0xad, 0x90, 0x5d, 0xa6, 0xae, 0x97, 0xa6, 0x6c, 0xbe, 0x48, 0xdd,
+	0x34, 0x98, 0x33, 0x11, 0xc5, 0x12, 0xdd, 0xe6, 0x82, 0xae, 0xc4, 0x1d, 0x84, 0xc9, 0x67, 0xd0,
+	0xf0, 0xfc, 0x34, 0x78, 0xcb, 0x24, 0x4b, 0xc6, 0x10, 0x24, 0x24, 0x08, 0x9f, 0x43, 0xcb, 0x8f,
+	0xc2, 0x90, 0x21, 0x12, 0x85, 0xbc, 0x04, 0x2a, 0x82, 0xd2, 0x5c, 0x81, 0xc3, 0xa9, 0xfe, 0x15,
+	0x94, 0xb9, 0x03, 0x09, 0x79, 0x02, 0xe5, 0x05, 0x5f, 0xa0, 0x13, 0xa5, 0xe7, 0x8d, 0xbd, 0xf6,
+	0x2a, 0x30, 0x5c, 0x4e, 0xa5, 0x50, 0xa7, 0x00, 0x07, 0x2c, 0x1d, 0x89, 0x0a, 0x49, 0xc8, 0x6d,
+	0x28, 0x9f, 0xb2, 0xf3, 0x20, 0x54, 0xc5, 0x25, 0x37, 0x44, 0x83, 0x12, 0xc3, 0x7c, 0x48, 0xd7,
+	0xf9, 0x92, 0x3c, 0x80, 0x3a, 0xb7, 0x31, 0x49, 0xbd, 0xf9, 0x42, 0xb9, 0xbd, 0x02, 0xf4, 0x5f,
+	0x8b, 0x50, 0xcd, 0x34, 0x7e, 0x0d, 0x95, 0xb7, 0xde, 0x6c, 0xc9, 0x32, 0x33, 0x76, 0x57, 0x66,
+	0xf4, 0x78, 0x12, 0xc3, 0x64, 0x99, 0x1c, 0x73, 0x02, 0x55, 0x3c, 0xf2, 0x3d, 0xd4, 0x93, 0xab,
+	0xd0, 0x97, 0x49, 0x2d, 0x8a, 0xa4, 0xde, 0x5b, 0x1d, 0x52, 0x7a, 0x3b, 0x36, 0x52, 0x78, 0x42,
+	0x69, 0x2d, 0x51, 0x2b, 0x72, 0x17, 0xaa, 0x73, 0xef, 0xd2, 0x4d, 0xd8, 0x1b, 0x65, 0x52, 0x05,
+	0xb7, 0x36, 0x7b, 0xc3, 0xbd, 0xc2, 0xf3, 0xd1, 0x99, 0x08, 0x7c, 0x93, 0xca, 0x8d, 0xfe, 0x0b,
+	0xd4, 0x32, 0x25, 0xa4, 0x02, 0x45, 0xeb, 0x67, 0xed, 0x23, 0xb2, 0x0d, 0x0d, 0x6b, 0xe2, 0xb8,
+	0xd6, 0xc0, 0xb5, 0x4f, 0xcc, 0x9e, 0x56, 0xc0, 0xb4, 0xb7, 0x15, 0x30, 0x32, 0xfa, 0x07, 0x06,
+	0xb5, 0xb5, 0x22, 0xa9, 0xc1, 0xd6, 0xfe, 0xc4, 0x3e, 0xd1, 0x4a, 0x04, 0xa0, 0x42, 0x8d, 0xc1,
+	0xc4, 0x36, 0xb4, 0x2d, 0xd2, 0x84, 0xda, 0xd0, 0x74, 0x0c, 0x6a, 0x76, 0x47, 0x5a, 0x59, 0xf7,
+	0xa0, 0x8d, 0x61, 0xed, 0xfa, 0x7e, 0xb4, 0x0c, 0x53, 0x27, 0x66, 0xa2, 0xf0, 0xd4, 0xeb, 0xe4,
+	0x06, 0xaa, 0xc7, 0x2b, 0x11, 0x6e, 0x23, 0xd6, 0xd7, 0x6b, 0x76, 0x95, 0xa0, 0xc3, 0x25, 0x34,
+	0x51, 0xac, 0xff, 0x23, 0xca, 0x7f, 0x15, 0xa1, 0xb1, 0x7e, 0xc1, 0x8f, 0xeb, 0x71, 0x93, 0x8f,
+	0xe1, 0xd3, 0x55, 0xdc, 0xd6, 0x98, 0x37, 0xc5, 0x6e, 0xd3, 0xba, 0x62, 0xde, 0xba, 0x8f, 0xaf,
+	0xb3, 0x58, 0x12, 0xf6, 0x65, 0xb9, 0x7a, 0x0e, 0x15, 0x49, 0x12, 0xa1, 0x6d, 0xec, 0x69, 0xf9,
+	0x44, 0x51, 0x25, 0xe7, 0xcd, 0xc4, 0xcf, 0xf2, 0xed, 0x8a, 0xd3, 0xa2, 0xc0, 0x9b, 0xb4, 0xed,
+	0x6f, 0x94, 0x81, 0x6c, 0x72, 0xf8, 0x62, 0x24, 0xa7, 0x22, 0x38, 0x75, 0x8e, 0x6c, 0x8a, 0x65,
+	0x42, 0xab, 0x2b, 0xf1, 0x98, 0x03, 0x3c, 0x8c, 0x67, 0x0c, 0xcd, 0xac, 0x09, 0x81, 0x58, 0xeb,
+	0x3f, 0xdd, 0x90, 0xe8, 0x16, 0xd4, 0x4d, 0xcb, 0x71, 0xa9, 0xd1, 0xed, 0x9f, 0x60, 0x9a, 0xdb,
+	0x00, 0x7c, 0x3b, 0x1e, 0x9a, 0xa6, 0xd1, 0xc7, 0x14, 0xaf, 0x27, 0xb3, 0xa4, 0xef, 0x41, 0xad,
+	0x1f, 0x85, 0xe9, 0xa1, 0xf7, 0x96, 0xf1, 0x0b, 0xd2, 0xab, 0x05, 0x53, 0x09, 0x14, 0x6b, 0x8e,
+	0x5d, 0x78, 0xc9, 0x85, 0x08, 0x1b, 0x5e, 0xca, 0xd7, 0xfa, 0xef, 0x05, 0xd8, 0x91, 0x21, 0x98,
+	0x2c, 0xce, 0x63, 0x6f, 0xca, 0xcc, 0x28, 0x0d, 0xce, 0xae, 0x78, 0x2d, 0x86, 0x51, 0xe8, 0x67,
+	0x0a, 0xe4, 0x86, 0x7c, 0x03, 0xd5, 0xa5, 0xa4, 0x09, 0x25, 0x8d, 0xbd, 0xbb, 0xf9, 0x40, 0x2a,
+	0x2d, 0x34, 0xe3, 0xe1, 0x91, 0x7a, 0x12, 0x9c, 0x87, 0x5e, 0x8a, 0x7d, 0x46, 0x14, 0x47, 0x63,
+	0xbd, 0xf7, 0xd9, 0x99, 0x88, 0xae, 0x58, 0xfa, 0x63, 0xa8, 0x1b, 0x61, 0x1a, 0x5f, 0x8d, 0xb0,
+	0x2d, 0x73, 0x43, 0x18, 0xdf, 0x88, 0x77, 0x89, 0x8f, 0x42, 0x6c, 0xb0, 0x6e, 0xa1, 0xc7, 0x67,
+	0x8f, 0x1c, 0x38, 0xdf, 0x41, 0xcd, 0x5b, 0x04, 0x2e, 0x6f, 0xe3, 0x82, 0xb6, 0xf1, 0x12, 0x05,
+	0xef, 0x08, 0xbb, 0xb6, 0x77, 0xce, 0x1c, 0x0c, 0x03, 0xad, 0x22, 0x57, 0xa8, 0xde, 0xa8, 0xdb,
+	0x62, 0xbe, 0x6e, 0xdf, 0x17, 0xa0, 0x21, 0xce, 0xda, 0x29, 0x9a, 0x25, 0x7a, 0x7e, 0xc2, 0x66,
+	0x67, 0x62, 0x2c, 0xa8, 0x86, 0x5b, 0xe3, 0x00, 0x9f, 0x09, 0x1f, 0x30, 0xd3, 0x70, 0x7a, 0x06,
+	0x69, 0x14, 0xe7, 0x67, 0x9a, 0x82, 0x3f, 0x78, 0xa6, 0x6d, 0xf8, 0x50, 0xce, 0xfb, 0xb0, 0x00,
+	0x4d, 0xb8, 0xc0, 0x3b, 0xa9, 0x0a, 0x01, 0xd1, 0xa1, 0x95, 0xc4, 0xbe, 0xcb, 0xdb, 0xea, 0xba,
+	0x2f, 0x0d, 0x04, 0x39, 0x4d, 0xb8, 0xf3, 0x04, 0xda, 0x38, 0x77, 0x56, 0x1c, 0xf9, 0xde, 0xeb,
+	0xb4, 0x89, 0x68, 0x46, 0x4a, 0x78, 0x3d, 0x4d, 0xbd, 0xd4, 0x13, 0x2e, 0x60, 0x3d, 0xf1, 0xb5,
+	0xfe, 0x52, 0xdd, 0x68, 0x2f, 0x4f, 0x13, 0x3f, 0x0e, 0x4e, 0x99, 0x73, 0x49, 0x76, 0xa1, 0x9a,
+	0xcd, 0xd2, 0x82, 0x50, 0x93, 0x6d, 0xf5, 0x23, 0x68, 0x09, 0xf6, 0xf5, 0xa8, 0x7c, 0xf8, 0xaf,
+	0x51, 0x59, 0xfe, 0x80, 0xa9, 0xf8, 0xbe, 0xa4, 0xf4, 0x39, 0x97, 0x2a, 0x69, 0x3f, 0x40, 0x25,
+	0x11, 0x2b, 0xd5, 0x69, 0x1e, 0xe5, 0xea, 0x22, 0x23, 0x76, 0xb2, 0x05, 0x55, 0x7c, 0xde, 0xa5,
+	0xd3, 0x4b, 0xf7, 0xfa, 0xbd, 0xd4, 0x69, 0x25, 0xbd, 0x3c, 0xc4, 0x1d, 0x4f, 0x75, 0x12, 0x2d,
+	0x63, 0x7f, 0xf5, 0x83, 0x50, 0x12, 0xf2, 0x96, 0x44, 0xb3, 0x5f, 0x84, 0x97, 0x40, 0x32, 0x9a,
+	0x6c, 0x69, 0xa2, 0x63, 0xc9, 0x91, 0xaa, 0x29, 0xaa, 0x14, 0xf0, 0xc6, 0xb5, 0xd9, 0xd7, 0xca,
+	0xf9, 0xbe, 0xf6, 0x0c, 0x70, 0x0a, 0xbf, 0xdb, 0xd0, 0x24, 0x67, 0x6a, 0x0b, 0xe1, 0x35, 0x35,
+	0x9b, 0x7f, 0x1a, 0xd5, 0xff, 0xf1, 0xa7, 0x51, 0xcb, 0xc5, 0x74, 0xb3, 0xc0, 0xea, 0xf9, 0x02,
+	0x1b, 0x43, 0xed, 0x3a, 0xd6, 0xd8, 0xab, 0x26, 0x66, 0xdf, 0x18, 0x0c, 0x79, 0x6f, 0x12, 0xad,
+	0xab, 0x67, 0x99, 0x83, 0x21, 0x3d, 0xc2, 0x6d, 0x81, 0x34, 0xa0, 0x3a, 0x36, 0xcc, 0xfe, 0xd0,
+	0x3c, 0x90, 0x7d, 0xab, 0x67, 0x1d, 0x8d, 0x47, 0x86, 0x63, 0xe0, 0x78, 0x42, 0xd1, 0xa0, 0x3b,
+	0x1c, 0x4d, 0x28, 0xce, 0xa7, 0x17, 0x7f, 0x14, 0xe1, 0xb6, 0x75, 0x6c, 0xd0, 0x51, 0xf7, 0xc4,
+	0x3d, 0x32, 0x6c, 0xbb, 0x7b, 0x60, 0xb8, 0xce, 0xc9, 0xd8, 0xc0, 0x2a, 0x5a, 0xe1, 0xf6, 0x01,
+	0x87, 0x5c, 0xd3, 0x32, 0x0d, 0xbc, 0xe9, 0x06, 0xc9, 0x98, 0xdf, 0x53, 0x20, 0x9f, 0xc0, 0x9d,
+	0xbc, 0xe4, 0xd0, 0x18, 0x8d, 0x2c, 0x34, 0xe1, 0x06, 0xd1, 0xd8, 0xe0, 0x83, 0xb3, 0x84, 0x3f,
+	0x38, 0xf7, 0xf3, 0x22, 0x87, 0x76, 0x4d, 0xbb, 0xdb, 0x73, 0x86, 0x96, 0x89, 0x33, 0xf4, 0x3e,
+	0xdc, 0xcd, 0x13, 0xb2, 0xb1, 0x5b, 0xbe, 0xd1, 0x9a, 0xfd, 0x81, 0xa3, 0x55, 0xc8, 0x97, 0xf0,
+	0xf4, 0xe6, 0x63, 0xee, 0x64, 0x7c, 0x40, 0xbb, 0x7d, 0xee, 0x90, 0x33, 0x1c, 0x9c, 0x68, 0x55,
+	0xf2, 0x08, 0x1e, 0xe4, 0xa9, 0xdd, 0x5e, 0xcf, 0x9a, 0x98, 0x0e, 0x9a, 0x62, 0x18, 0x5a, 0xed,
+	0xc5, 0xdf, 0x05, 0xf5, 0xd2, 0xd6, 0x5a, 0x1b, 0xd9, 0x81, 0xed, 0xde, 0x61, 0x77, 0x68, 0xba,
+	0xeb, 0xe1, 0xc1, 0x9f, 0x05, 0x09, 0x4a, 0xd7, 0x61, 0x8d, 0xf5, 0xca, 0xb5, 0x9d, 0xae, 0x33,
+	0xb1, 0xb5, 0x06, 0xb9, 0x03, 0xb7, 0x24, 0xc8, 0xa3, 0xe0, 0x5a, 0xe6, 0x08, 0xd3, 0xa8, 0x35,
+	0x71, 0xa2, 0x92, 0x75, 0x78, 0x30, 0x10, 0x78, 0x2b, 0x87, 0xab, 0x44, 0x69, 0x6d, 0x1e, 0x1a,
+	0x89, 0xdb, 0x93, 0xfd, 0xa3, 0xa1, 0xb3, 0x1e, 0xb7, 0x6d, 0x7c, 0x53, 0x3b, 0x52, 0xa8, 0xdc,
+	0x3e, 0xc4, 0xb1, 0x66, 0x50, 0x4d, 0x5b, 0x69, 0xc3, 0x53, 0x76, 0x8f, 0x0e, 0xf7, 0x31, 0xe2,
+	0xaf, 0xb4, 0x5b, 0x2b, 0x1c, 0x2d, 0x35, 0xcc, 0x63, 0xb4, 0xd6, 0xc2, 0x22, 0x21, 0xfb, 0xcf,
+	0xe0, 0x49, 0x14, 0x9f, 0x77, 0x54, 0x2f, 0xec, 0x24, 0xd3, 0xd7, 0x1d, 0x3f, 0x8a, 0x59, 0x07,
+	0xe7, 0x2b, 0xfe, 0xf6, 0xc9, 0x82, 0x3f, 0x5d, 0x9e, 0x9d, 0x56, 0xc4, 0xea, 0xdb, 0x7f, 0x00,
+	0x8c, 0x9a, 0x3a, 0xb8, 0xd0, 0x0c, 0x00, 0x00,
 }
@@ -55,6 +55,14 @@ public final class Overlay {
      * <code>OVERLAY_MSGTYPE_LEDGER_UPGRADE_NOTIFY = 7;</code>
      */
     OVERLAY_MSGTYPE_LEDGER_UPGRADE_NOTIFY(7),
+    /**
+     * <pre>
+     *state sync, rows of the account trees at a ledger
+     * </pre>
+     *
+     * <code>OVERLAY_MSGTYPE_ACCOUNT_TREE = 8;</code>
+     */
+    OVERLAY_MSGTYPE_ACCOUNT_TREE(8),
     UNRECOGNIZED(-1),
     ;
 
@@ -94,6 +102,14 @@ public final class Overlay {
      * <code>OVERLAY_MSGTYPE_LEDGER_UPGRADE_NOTIFY = 7;</code>
      */
     public static final int OVERLAY_MSGTYPE_LEDGER_UPGRADE_NOTIFY_VALUE = 7;
+    /**
+     * <pre>
+     *state sync, rows of the account trees at a ledger
+     * </pre>
+     *
+     * <code>OVERLAY_MSGTYPE_ACCOUNT_TREE = 8;</code>
+     */
+    public static final int OVERLAY_MSGTYPE_ACCOUNT_TREE_VALUE = 8;
 
 
     public final int getNumber() {
@@ -122,6 +138,7 @@ public final class Overlay {
         case 5: return OVERLAY_MSGTYPE_LEDGERS;
         case 6: return OVERLAY_MSGTYPE_PBFT;
         case 7: return OVERLAY_MSGTYPE_LEDGER_UPGRADE_NOTIFY;
+        case 8: return OVERLAY_MSGTYPE_ACCOUNT_TREE;
         default: return null;
       }
     }
@@ -377,51 +394,51 @@ public final class Overlay {
       com.google.protobuf.MessageOrBuilder {
 
     /**
-     * <code>int64 network_id = 1;</code>
+     * <code>optional int64 network_id = 1;</code>
      */
     long getNetworkId();
 
     /**
-     * <code>int64 ledger_version = 2;</code>
+     * <code>optional int64 ledger_version = 2;</code>
      */
     long getLedgerVersion();
 
     /**
-     * <code>int64 overlay_version = 3;</code>
+     * <code>optional int64 overlay_version = 3;</code>
      */
     long getOverlayVersion();
 
     /**
-     * <code>string phantom_version = 4;</code>
+     * <code>optional string phantom_version = 4;</code>
      */
     java.lang.String getPhantomVersion();
     /**
-     * <code>string phantom_version = 4;</code>
+     * <code>optional string phantom_version = 4;</code>
      */
     com.google.protobuf.ByteString
         getPhantomVersionBytes();
 
     /**
-     * <code>int64 listening_port = 5;</code>
+     * <code>optional int64 listening_port = 5;</code>
      */
     long getListeningPort();
 
     /**
-     * <code>string node_address = 6;</code>
+     * <code>optional string node_address = 6;</code>
      */
     java.lang.String getNodeAddress();
     /**
-     * <code>string node_address = 6;</code>
+     * <code>optional string node_address = 6;</code>
      */
     com.google.protobuf.ByteString
         getNodeAddressBytes();
 
     /**
-     * <code>string node_rand = 7;</code>
+     * <code>optional string node_rand = 7;</code>
      */
     java.lang.String getNodeRand();
     /**
-     * <code>string node_rand = 7;</code>
+     * <code>optional string node_rand = 7;</code>
      */
     com.google.protobuf.ByteString
         getNodeRandBytes();
@@ -433,7 +450,6 @@ public final class Overlay {
       com.google.protobuf.GeneratedMessageV3 implements
       // @@protoc_insertion_point(message_implements:protocol.Hello)
       HelloOrBuilder {
-  private static final long serialVersionUID = 0L;
     // Use Hello.newBuilder() to construct.
     private Hello(com.google.protobuf.GeneratedMessageV3.Builder<?> builder) {
       super(builder);
@@ -451,19 +467,14 @@ public final class Overlay {
     @java.lang.Override
     public final com.google.protobuf.UnknownFieldSet
     getUnknownFields() {
-      return this.unknownFields;
+      return com.google.protobuf.UnknownFieldSet.getDefaultInstance();
     }
     private Hello(
         com.google.protobuf.CodedInputStream input,
         com.google.protobuf.ExtensionRegistryLite extensionRegistry)
         throws com.google.protobuf.InvalidProtocolBufferException {
       this();
-      if (extensionRegistry == null) {
-        throw new java.lang.NullPointerException();
-      }
       int mutable_bitField0_ = 0;
-      com.google.protobuf.UnknownFieldSet.Builder unknownFields =
-          com.google.protobuf.UnknownFieldSet.newBuilder();
       try {
         boolean done = false;
         while (!done) {
@@ -473,8 +484,7 @@ public final class Overlay {
               done = true;
               break;
             default: {
-              if (!parseUnknownFieldProto3(
-                  input, unknownFields, extensionRegistry, tag)) {
+              if (!input.skipField(tag)) {
                 done = true;
               }
               break;
@@ -525,7 +535,6 @@ public final class Overlay {
         throw new com.google.protobuf.InvalidProtocolBufferException(
             e).setUnfinishedMessage(this);
       } finally {
-        this.unknownFields = unknownFields.build();
         makeExtensionsImmutable();
       }
     }
@@ -544,7 +553,7 @@ public final class Overlay {
     public static final int NETWORK_ID_FIELD_NUMBER = 1;
     private long networkId_;
     /**
-     * <code>int64 network_id = 1;</code>
+     * <code>optional int64 network_id = 1;</code>
      */
     public long getNetworkId() {
       return networkId_;
@@ -553,7 +562,7 @@ public final class Overlay {
     public static final int LEDGER_VERSION_FIELD_NUMBER = 2;
     private long ledgerVersion_;
     /**
-     * <code>int64 ledger_version = 2;</code>
+     * <code>optional int64 ledger_version = 2;</code>
      */
     public long getLedgerVersion() {
       return ledgerVersion_;
@@ -562,7 +571,7 @@ public final class Overlay {
     public static final int OVERLAY_VERSION_FIELD_NUMBER = 3;
     private long overlayVersion_;
     /**
-     * <code>int64 overlay_version = 3;</code>
+     * <code>optional int64 overlay_version = 3;</code>
      */
     public long getOverlayVersion() {
       return overlayVersion_;
@@ -571,7 +580,7 @@ public final class Overlay {
     public static final int PHANTOM_VERSION_FIELD_NUMBER = 4;
     private volatile java.lang.Object phantomVersion_;
     /**
-     * <code>string phantom_version = 4;</code>
+     * <code>optional string phantom_version = 4;</code>
      */
     public java.lang.String getPhantomVersion() {
       java.lang.Object ref = phantomVersion_;
@@ -586,7 +595,7 @@ public final class Overlay {
       }
     }
     /**
-     * <code>string phantom_version = 4;</code>
+     * <code>optional string phantom_version = 4;</code>
      */
     public com.google.protobuf.ByteString
         getPhantomVersionBytes() {
@@ -605,7 +614,7 @@ public final class Overlay {
     public static final int LISTENING_PORT_FIELD_NUMBER = 5;
     private long listeningPort_;
     /**
-     * <code>int64 listening_port = 5;</code>
+     * <code>optional int64 listening_port = 5;</code>
      */
     public long getListeningPort() {
       return listeningPort_;
@@ -614,7 +623,7 @@ public final class Overlay {
     public static final int NODE_ADDRESS_FIELD_NUMBER = 6;
     private volatile java.lang.Object nodeAddress_;
     /**
-     * <code>string node_address = 6;</code>
+     * <code>optional string node_address = 6;</code>
      */
     public java.lang.String getNodeAddress() {
       java.lang.Object ref = nodeAddress_;
@@ -629,7 +638,7 @@ public final class Overlay {
       }
     }
     /**
-     * <code>string node_address = 6;</code>
+     * <code>optional string node_address = 6;</code>
      */
     public com.google.protobuf.ByteString
         getNodeAddressBytes() {
@@ -648,7 +657,7 @@ public final class Overlay {
     public static final int NODE_RAND_FIELD_NUMBER = 7;
     private volatile java.lang.Object nodeRand_;
     /**
-     * <code>string node_rand = 7;</code>
+     * <code>optional string node_rand = 7;</code>
      */
     public java.lang.String getNodeRand() {
       java.lang.Object ref = nodeRand_;
@@ -663,7 +672,7 @@ public final class Overlay {
       }
     }
     /**
-     * <code>string node_rand = 7;</code>
+     * <code>optional string node_rand = 7;</code>
      */
     public com.google.protobuf.ByteString
         getNodeRandBytes() {
@@ -712,7 +721,6 @@ public final class Overlay {
       if (!getNodeRandBytes().isEmpty()) {
         com.google.protobuf.GeneratedMessageV3.writeString(output, 7, nodeRand_);
       }
-      unknownFields.writeTo(output);
     }
 
     public int getSerializedSize() {
@@ -745,11 +753,11 @@ public final class Overlay {
       if (!getNodeRandBytes().isEmpty()) {
         size += com.google.protobuf.GeneratedMessageV3.computeStringSize(7, nodeRand_);
       }
-      size += unknownFields.getSerializedSize();
       memoizedSize = size;
       return size;
     }
 
+    private static final long serialVersionUID = 0L;
     @java.lang.Override
     public boolean equals(final java.lang.Object obj) {
       if (obj == this) {
@@ -775,7 +783,6 @@ public final class Overlay {
           .equals(other.getNodeAddress());
       result = result && getNodeRand()
           .equals(other.getNodeRand());
-      result = result && unknownFields.equals(other.unknownFields);
       return result;
     }
 
@@ -785,7 +792,7 @@ public final class Overlay {
         return memoizedHashCode;
       }
       int hash = 41;
-      hash = (19 * hash) + getDescriptor().hashCode();
+      hash = (19 * hash) + getDescriptorForType().hashCode();
       hash = (37 * hash) + NETWORK_ID_FIELD_NUMBER;
       hash = (53 * hash) + com.google.protobuf.Internal.hashLong(
           getNetworkId());
@@ -809,17 +816,6 @@ public final class Overlay {
       return hash;
     }
 
-    public static io.phantom.sdk.core.extend.protobuf.Overlay.Hello parseFrom(
-        java.nio.ByteBuffer data)
-        throws com.google.protobuf.InvalidProtocolBufferException {
-      return PARSER.parseFrom(data);
-    }
-    public static io.phantom.sdk.core.extend.protobuf.Overlay.Hello parseFrom(
-        java.nio.ByteBuffer data,
-        com.google.protobuf.ExtensionRegistryLite extensionRegistry)
-        throws com.google.protobuf.InvalidProtocolBufferException {
-      return PARSER.parseFrom(data, extensionRegistry);
-    }
     public static io.phantom.sdk.core.extend.protobuf.Overlay.Hello parseFrom(
         com.google.protobuf.ByteString data)
         throws com.google.protobuf.InvalidProtocolBufferException {
@@ -985,7 +981,7 @@ public final class Overlay {
       }
       public Builder setField(
           com.google.protobuf.Descriptors.FieldDescriptor field,
-          java.lang.Object value) {
+          Object value) {
         return (Builder) super.setField(field, value);
       }
       public Builder clearField(
@@ -998,12 +994,12 @@ public final class Overlay {
       }
       public Builder setRepeatedField(
           com.google.protobuf.Descriptors.FieldDescriptor field,
-          int index, java.lang.Object value) {
+          int index, Object value) {
         return (Builder) super.setRepeatedField(field, index, value);
       }
       public Builder addRepeatedField(
           com.google.protobuf.Descriptors.FieldDescriptor field,
-          java.lang.Object value) {
+          Object value) {
         return (Builder) super.addRepeatedField(field, value);
       }
       public Builder mergeFrom(com.google.protobuf.Message other) {
@@ -1041,7 +1037,6 @@ public final class Overlay {
           nodeRand_ = other.nodeRand_;
           onChanged();
         }
-        this.mergeUnknownFields(other.unknownFields);
         onChanged();
         return this;
       }
@@ -1070,13 +1065,13 @@ public final class Overlay {
 
       private long networkId_ ;
       /**
-       * <code>int64 network_id = 1;</code>
+       * <code>optional int64 network_id = 1;</code>
        */
       public long getNetworkId() {
         return networkId_;
       }
       /**
-       * <code>int64 network_id = 1;</code>
+       * <code>optional int64 network_id = 1;</code>
        */
       public Builder setNetworkId(long value) {
         
@@ -1085,7 +1080,7 @@ public final class Overlay {
         return this;
       }
       /**
-       * <code>int64 network_id = 1;</code>
+       * <code>optional int64 network_id = 1;</code>
        */
       public Builder clearNetworkId() {
         
@@ -1096,13 +1091,13 @@ public final class Overlay {
 
       private long ledgerVersion_ ;
       /**
-       * <code>int64 ledger_version = 2;</code>
+       * <code>optional int64 ledger_version = 2;</code>
        */
       public long getLedgerVersion() {
         return ledgerVersion_;
       }
       /**
-       * <code>int64 ledger_version = 2;</code>
+       * <code>optional int64 ledger_version = 2;</code>
        */
       public Builder setLedgerVersion(long value) {
         
@@ -1111,7 +1106,7 @@ public final class Overlay {
         return this;
       }
       /**
-       * <code>int64 ledger_version = 2;</code>
+       * <code>optional int64 ledger_version = 2;</code>
        */
       public Builder clearLedgerVersion() {
         
@@ -1122,13 +1117,13 @@ public final class Overlay {
 
       private long overlayVersion_ ;
       /**
-       * <code>int64 overlay_version = 3;</code>
+       * <code>optional int64 overlay_version = 3;</code>
        */
       public long getOverlayVersion() {
         return overlayVersion_;
       }
       /**
-       * <code>int64 overlay_version = 3;</code>
+       * <code>optional int64 overlay_version = 3;</code>
        */
       public Builder setOverlayVersion(long value) {
         
@@ -1137,7 +1132,7 @@ public final class Overlay {
         return this;
       }
       /**
-       * <code>int64 overlay_version = 3;</code>
+       * <code>optional int64 overlay_version = 3;</code>
        */
       public Builder clearOverlayVersion() {
         
@@ -1148,7 +1143,7 @@ public final class Overlay {
 
       private java.lang.Object phantomVersion_ = "";
       /**
-       * <code>string phantom_version = 4;</code>
+       * <code>optional string phantom_version = 4;</code>
        */
       public java.lang.String getPhantomVersion() {
         java.lang.Object ref = phantomVersion_;
@@ -1163,7 +1158,7 @@ public final class Overlay {
         }
       }
       /**
-       * <code>string phantom_version = 4;</code>
+       * <code>optional string phantom_version = 4;</code>
        */
       public com.google.protobuf.ByteString
           getPhantomVersionBytes() {
@@ -1179,7 +1174,7 @@ public final class Overlay {
         }
       }
       /**
-       * <code>string phantom_version = 4;</code>
+       * <code>optional string phantom_version = 4;</code>
        */
       public Builder setPhantomVersion(
           java.lang.String value) {
@@ -1192,7 +1187,7 @@ public final class Overlay {
         return this;
       }
       /**
-       * <code>string phantom_version = 4;</code>
+       * <code>optional string phantom_version = 4;</code>
        */
       public Builder clearPhantomVersion() {
         
@@ -1201,7 +1196,7 @@ public final class Overlay {
         return this;
       }
       /**
-       * <code>string phantom_version = 4;</code>
+       * <code>optional string phantom_version = 4;</code>
        */
       public Builder setPhantomVersionBytes(
           com.google.protobuf.ByteString value) {
@@ -1217,13 +1212,13 @@ public final class Overlay {
 
       private long listeningPort_ ;
       /**
-       * <code>int64 listening_port = 5;</code>
+       * <code>optional int64 listening_port = 5;</code>
        */
       public long getListeningPort() {
         return listeningPort_;
       }
       /**
-       * <code>int64 listening_port = 5;</code>
+       * <code>optional int64 listening_port = 5;</code>
        */
       public Builder setListeningPort(long value) {
         
@@ -1232,7 +1227,7 @@ public final class Overlay {
         return this;
       }
       /**
-       * <code>int64 listening_port = 5;</code>
+       * <code>optional int64 listening_port = 5;</code>
        */
       public Builder clearListeningPort() {
         
@@ -1243,7 +1238,7 @@ public final class Overlay {
 
       private java.lang.Object nodeAddress_ = "";
       /**
-       * <code>string node_address = 6;</code>
+       * <code>optional string node_address = 6;</code>
        */
       public java.lang.String getNodeAddress() {
         java.lang.Object ref = nodeAddress_;
@@ -1258,7 +1253,7 @@ public final class Overlay {
         }
       }
       /**
-       * <code>string node_address = 6;</code>
+       * <code>optional string node_address = 6;</code>
        */
       public com.google.protobuf.ByteString
           getNodeAddressBytes() {
@@ -1274,7 +1269,7 @@ public final class Overlay {
         }
       }
       /**
-       * <code>string node_address = 6;</code>
+       * <code>optional string node_address = 6;</code>
        */
       public Builder setNodeAddress(
           java.lang.String value) {
@@ -1287,7 +1282,7 @@ public final class Overlay {
         return this;
       }
       /**
-       * <code>string node_address = 6;</code>
+       * <code>optional string node_address = 6;</code>
        */
       public Builder clearNodeAddress() {
         
@@ -1296,7 +1291,7 @@ public final class Overlay {
         return this;
       }
       /**
-       * <code>string node_address = 6;</code>
+       * <code>optional string node_address = 6;</code>
        */
       public Builder setNodeAddressBytes(
           com.google.protobuf.ByteString value) {
@@ -1312,7 +1307,7 @@ public final class Overlay {
 
       private java.lang.Object nodeRand_ = "";
       /**
-       * <code>string node_rand = 7;</code>
+       * <code>optional string node_rand = 7;</code>
        */
       public java.lang.String getNodeRand() {
         java.lang.Object ref = nodeRand_;
@@ -1327,7 +1322,7 @@ public final class Overlay {
         }
       }
       /**
-       * <code>string node_rand = 7;</code>
+       * <code>optional string node_rand = 7;</code>
        */
       public com.google.protobuf.ByteString
           getNodeRandBytes() {
@@ -1343,7 +1338,7 @@ public final class Overlay {
         }
       }
       /**
-       * <code>string node_rand = 7;</code>
+       * <code>optional string node_rand = 7;</code>
        */
       public Builder setNodeRand(
           java.lang.String value) {
@@ -1356,7 +1351,7 @@ public final class Overlay {
         return this;
       }
       /**
-       * <code>string node_rand = 7;</code>
+       * <code>optional string node_rand = 7;</code>
        */
       public Builder clearNodeRand() {
         
@@ -1365,7 +1360,7 @@ public final class Overlay {
         return this;
       }
       /**
-       * <code>string node_rand = 7;</code>
+       * <code>optional string node_rand = 7;</code>
        */
       public Builder setNodeRandBytes(
           com.google.protobuf.ByteString value) {
@@ -1380,12 +1375,12 @@ public final class Overlay {
       }
       public final Builder setUnknownFields(
           final com.google.protobuf.UnknownFieldSet unknownFields) {
-        return super.setUnknownFieldsProto3(unknownFields);
+        return this;
       }
 
       public final Builder mergeUnknownFields(
           final com.google.protobuf.UnknownFieldSet unknownFields) {
-        return super.mergeUnknownFields(unknownFields);
+        return this;
       }
 
 
@@ -1408,7 +1403,7 @@ public final class Overlay {
           com.google.protobuf.CodedInputStream input,
           com.google.protobuf.ExtensionRegistryLite extensionRegistry)
           throws com.google.protobuf.InvalidProtocolBufferException {
-        return new Hello(input, extensionRegistry);
+          return new Hello(input, extensionRegistry);
       }
     };
 
@@ -1432,20 +1427,20 @@ public final class Overlay {
       com.google.protobuf.MessageOrBuilder {
 
     /**
-     * <code>.protocol.ERRORCODE error_code = 1;</code>
+     * <code>optional .protocol.ERRORCODE error_code = 1;</code>
      */
     int getErrorCodeValue();
     /**
-     * <code>.protocol.ERRORCODE error_code = 1;</code>
+     * <code>optional .protocol.ERRORCODE error_code = 1;</code>
      */
     io.phantom.sdk.core.extend.protobuf.Common.ERRORCODE getErrorCode();
 
     /**
-     * <code>string error_desc = 2;</code>
+     * <code>optional string error_desc = 2;</code>
      */
     java.lang.String getErrorDesc();
     /**
-     * <code>string error_desc = 2;</code>
+     * <code>optional string error_desc = 2;</code>
      */
     com.google.protobuf.ByteString
         getErrorDescBytes();
@@ -1457,7 +1452,6 @@ public final class Overlay {
       com.google.protobuf.GeneratedMessageV3 implements
       // @@protoc_insertion_point(message_implements:protocol.HelloResponse)
       HelloResponseOrBuilder {
-  private static final long serialVersionUID = 0L;
     // Use HelloResponse.newBuilder() to construct.
     private HelloResponse(com.google.protobuf.GeneratedMessageV3.Builder<?> builder) {
       super(builder);
@@ -1470,19 +1464,14 @@ public final class Overlay {
     @java.lang.Override
     public final com.google.protobuf.UnknownFieldSet
     getUnknownFields() {
-      return this.unknownFields;
+      return com.google.protobuf.UnknownFieldSet.getDefaultInstance();
     }
     private HelloResponse(
         com.google.protobuf.CodedInputStream input,
         com.google.protobuf.ExtensionRegistryLite extensionRegistry)
         throws com.google.protobuf.InvalidProtocolBufferException {
       this();
-      if (extensionRegistry == null) {
-        throw new java.lang.NullPointerException();
-      }
       int mutable_bitField0_ = 0;
-      com.google.protobuf.UnknownFieldSet.Builder unknownFields =
-          com.google.protobuf.UnknownFieldSet.newBuilder();
       try {
         boolean done = false;
         while (!done) {
@@ -1492,8 +1481,7 @@ public final class Overlay {
               done = true;
               break;
             default: {
-              if (!parseUnknownFieldProto3(
-                  input, unknownFields, extensionRegistry, tag)) {
+              if (!input.skipField(tag)) {
                 done = true;
               }
               break;
@@ -1518,7 +1506,6 @@ public final class Overlay {
         throw new com.google.protobuf.InvalidProtocolBufferException(
             e).setUnfinishedMessage(this);
       } finally {
-        this.unknownFields = unknownFields.build();
         makeExtensionsImmutable();
       }
     }
@@ -1537,13 +1524,13 @@ public final class Overlay {
     public static final int ERROR_CODE_FIELD_NUMBER = 1;
     private int errorCode_;
     /**
-     * <code>.protocol.ERRORCODE error_code = 1;</code>
+     * <code>optional .protocol.ERRORCODE error_code = 1;</code>
      */
     public int getErrorCodeValue() {
       return errorCode_;
     }
     /**
-     * <code>.protocol.ERRORCODE error_code = 1;</code>
+     * <code>optional .protocol.ERRORCODE error_code = 1;</code>
      */
     public io.phantom.sdk.core.extend.protobuf.Common.ERRORCODE getErrorCode() {
       io.phantom.sdk.core.extend.protobuf.Common.ERRORCODE result = io.phantom.sdk.core.extend.protobuf.Common.ERRORCODE.valueOf(errorCode_);
@@ -1553,7 +1540,7 @@ public final class Overlay {
     public static final int ERROR_DESC_FIELD_NUMBER = 2;
     private volatile java.lang.Object errorDesc_;
     /**
-     * <code>string error_desc = 2;</code>
+     * <code>optional string error_desc = 2;</code>
      */
     public java.lang.String getErrorDesc() {
       java.lang.Object ref = errorDesc_;
@@ -1568,7 +1555,7 @@ public final class Overlay {
       }
     }
     /**
-     * <code>string error_desc = 2;</code>
+     * <code>optional string error_desc = 2;</code>
      */
     public com.google.protobuf.ByteString
         getErrorDescBytes() {
@@ -1602,7 +1589,6 @@ public final class Overlay {
       if (!getErrorDescBytes().isEmpty()) {
         com.google.protobuf.GeneratedMessageV3.writeString(output, 2, errorDesc_);
       }
-      unknownFields.writeTo(output);
     }
 
     public int getSerializedSize() {
@@ -1617,11 +1603,11 @@ public final class Overlay {
       if (!getErrorDescBytes().isEmpty()) {
         size += com.google.protobuf.GeneratedMessageV3.computeStringSize(2, errorDesc_);
       }
-      size += unknownFields.getSerializedSize();
       memoizedSize = size;
       return size;
     }
 
+    private static final long serialVersionUID = 0L;
     @java.lang.Override
     public boolean equals(final java.lang.Object obj) {
       if (obj == this) {
@@ -1636,7 +1622,6 @@ public final class Overlay {
       result = result && errorCode_ == other.errorCode_;
       result = result && getErrorDesc()
           .equals(other.getErrorDesc());
-      result = result && unknownFields.equals(other.unknownFields);
       return result;
     }
 
@@ -1646,7 +1631,7 @@ public final class Overlay {
         return memoizedHashCode;
       }
       int hash = 41;
-      hash = (19 * hash) + getDescriptor().hashCode();
+      hash = (19 * hash) + getDescriptorForType().hashCode();
       hash = (37 * hash) + ERROR_CODE_FIELD_NUMBER;
       hash = (53 * hash) + errorCode_;
       hash = (37 * hash) + ERROR_DESC_FIELD_NUMBER;
@@ -1656,17 +1641,6 @@ public final class Overlay {
       return hash;
     }
 
-    public static io.phantom.sdk.core.extend.protobuf.Overlay.HelloResponse parseFrom(
-        java.nio.ByteBuffer data)
-        throws com.google.protobuf.InvalidProtocolBufferException {
-      return PARSER.parseFrom(data);
-    }
-    public static io.phantom.sdk.core.extend.protobuf.Overlay.HelloResponse parseFrom(
-        java.nio.ByteBuffer data,
-        com.google.protobuf.ExtensionRegistryLite extensionRegistry)
-        throws com.google.protobuf.InvalidProtocolBufferException {
-      return PARSER.parseFrom(data, extensionRegistry);
-    }
     public static io.phantom.sdk.core.extend.protobuf.Overlay.HelloResponse parseFrom(
         com.google.protobuf.ByteString data)
         throws com.google.protobuf.InvalidProtocolBufferException {
@@ -1817,7 +1791,7 @@ public final class Overlay {
       }
       public Builder setField(
           com.google.protobuf.Descriptors.FieldDescriptor field,
-          java.lang.Object value) {
+          Object value) {
         return (Builder) super.setField(field, value);
       }
       public Builder clearField(
@@ -1830,12 +1804,12 @@ public final class Overlay {
       }
       public Builder setRepeatedField(
           com.google.protobuf.Descriptors.FieldDescriptor field,
-          int index, java.lang.Object value) {
+          int index, Object value) {
         return (Builder) super.setRepeatedField(field, index, value);
       }
       public Builder addRepeatedField(
           com.google.protobuf.Descriptors.FieldDescriptor field,
-          java.lang.Object value) {
+          Object value) {
         return (Builder) super.addRepeatedField(field, value);
       }
       public Builder mergeFrom(com.google.protobuf.Message other) {
@@ -1856,7 +1830,6 @@ public final class Overlay {
           errorDesc_ = other.errorDesc_;
           onChanged();
         }
-        this.mergeUnknownFields(other.unknownFields);
         onChanged();
         return this;
       }
@@ -1885,13 +1858,13 @@ public final class Overlay {
 
       private int errorCode_ = 0;
       /**
-       * <code>.protocol.ERRORCODE error_code = 1;</code>
+       * <code>optional .protocol.ERRORCODE error_code = 1;</code>
        */
       public int getErrorCodeValue() {
         return errorCode_;
       }
       /**
-       * <code>.protocol.ERRORCODE error_code = 1;</code>
+       * <code>optional .protocol.ERRORCODE error_code = 1;</code>
        */
       public Builder setErrorCodeValue(int value) {
         errorCode_ = value;
@@ -1899,14 +1872,14 @@ public final class Overlay {
         return this;
       }
       /**
-       * <code>.protocol.ERRORCODE error_code = 1;</code>
+       * <code>optional .protocol.ERRORCODE error_code = 1;</code>
        */
       public io.phantom.sdk.core.extend.protobuf.Common.ERRORCODE getErrorCode() {
         io.phantom.sdk.core.extend.protobuf.Common.ERRORCODE result = io.phantom.sdk.core.extend.protobuf.Common.ERRORCODE.valueOf(errorCode_);
         return result == null ? io.phantom.sdk.core.extend.protobuf.Common.ERRORCODE.UNRECOGNIZED : result;
       }
       /**
-       * <code>.protocol.ERRORCODE error_code = 1;</code>
+       * <code>optional .protocol.ERRORCODE error_code = 1;</code>
        */
       public Builder setErrorCode(io.phantom.sdk.core.extend.protobuf.Common.ERRORCODE value) {
         if (value == null) {
@@ -1918,7 +1891,7 @@ public final class Overlay {
         return this;
       }
       /**
-       * <code>.protocol.ERRORCODE error_code = 1;</code>
+       * <code>optional .protocol.ERRORCODE error_code = 1;</code>
        */
       public Builder clearErrorCode() {
         
@@ -1929,7 +1902,7 @@ public final class Overlay {
 
       private java.lang.Object errorDesc_ = "";
       /**
-       * <code>string error_desc = 2;</code>
+       * <code>optional string error_desc = 2;</code>
        */
       public java.lang.String getErrorDesc() {
         java.lang.Object ref = errorDesc_;
@@ -1944,7 +1917,7 @@ public final class Overlay {
         }
       }
       /**
-       * <code>string error_desc = 2;</code>
+       * <code>optional string error_desc = 2;</code>
        */
       public com.google.protobuf.ByteString
           getErrorDescBytes() {
@@ -1960,7 +1933,7 @@ public final class Overlay {
         }
       }
       /**
-       * <code>string error_desc = 2;</code>
+       * <code>optional string error_desc = 2;</code>
        */
       public Builder setErrorDesc(
           java.lang.String value) {
@@ -1973,7 +1946,7 @@ public final class Overlay {
         return this;
       }
       /**
-       * <code>string error_desc = 2;</code>
+       * <code>optional string error_desc = 2;</code>
        */
       public Builder clearErrorDesc() {
         
@@ -1982,7 +1955,7 @@ public final class Overlay {
         return this;
       }
       /**
-       * <code>string error_desc = 2;</code>
+       * <code>optional string error_desc = 2;</code>
        */
       public Builder setErrorDescBytes(
           com.google.protobuf.ByteString value) {
@@ -1997,12 +1970,12 @@ public final class Overlay {
       }
       public final Builder setUnknownFields(
           final com.google.protobuf.UnknownFieldSet unknownFields) {
-        return super.setUnknownFieldsProto3(unknownFields);
+        return this;
       }
 
       public final Builder mergeUnknownFields(
           final com.google.protobuf.UnknownFieldSet unknownFields) {
-        return super.mergeUnknownFields(unknownFields);
+        return this;
       }
 
 
@@ -2025,7 +1998,7 @@ public final class Overlay {
           com.google.protobuf.CodedInputStream input,
           com.google.protobuf.ExtensionRegistryLite extensionRegistry)
           throws com.google.protobuf.InvalidProtocolBufferException {
-        return new HelloResponse(input, extensionRegistry);
+          return new HelloResponse(input, extensionRegistry);
       }
     };
 
@@ -2049,37 +2022,37 @@ public final class Overlay {
       com.google.protobuf.MessageOrBuilder {
 
     /**
-     * <code>string ip = 1;</code>
+     * <code>optional string ip = 1;</code>
      */
     java.lang.String getIp();
     /**
-     * <code>string ip = 1;</code>
+     * <code>optional string ip = 1;</code>
      */
     com.google.protobuf.ByteString
         getIpBytes();
 
     /**
-     * <code>int64 port = 2;</code>
+     * <code>optional int64 port = 2;</code>
      */
     long getPort();
 
     /**
-     * <code>int64 num_failures = 3;</code>
+     * <code>optional int64 num_failures = 3;</code>
      */
     long getNumFailures();
 
     /**
-     * <code>int64 next_attempt_time = 4;</code>
+     * <code>optional int64 next_attempt_time = 4;</code>
      */
     long getNextAttemptTime();
 
     /**
-     * <code>int64 active_time = 5;</code>
+     * <code>optional int64 active_time = 5;</code>
      */
     long getActiveTime();
 
     /**
-     * <code>int64 connection_id = 6;</code>
+     * <code>optional int64 connection_id = 6;</code>
      */
     long getConnectionId();
   }
@@ -2094,7 +2067,6 @@ public final class Overlay {
       com.google.protobuf.GeneratedMessageV3 implements
       // @@protoc_insertion_point(message_implements:protocol.Peer)
       PeerOrBuilder {
-  private static final long serialVersionUID = 0L;
     // Use Peer.newBuilder() to construct.
     private Peer(com.google.protobuf.GeneratedMessageV3.Builder<?> builder) {
       super(builder);
@@ -2111,19 +2083,14 @@ public final class Overlay {
     @java.lang.Override
     public final com.google.protobuf.UnknownFieldSet
     getUnknownFields() {
-      return this.unknownFields;
+      return com.google.protobuf.UnknownFieldSet.getDefaultInstance();
     }
     private Peer(
         com.google.protobuf.CodedInputStream input,
         com.google.protobuf.ExtensionRegistryLite extensionRegistry)
         throws com.google.protobuf.InvalidProtocolBufferException {
       this();
-      if (extensionRegistry == null) {
-        throw new java.lang.NullPointerException();
-      }
       int mutable_bitField0_ = 0;
-      com.google.protobuf.UnknownFieldSet.Builder unknownFields =
-          com.google.protobuf.UnknownFieldSet.newBuilder();
       try {
         boolean done = false;
         while (!done) {
@@ -2133,8 +2100,7 @@ public final class Overlay {
               done = true;
               break;
             default: {
-              if (!parseUnknownFieldProto3(
-                  input, unknownFields, extensionRegistry, tag)) {
+              if (!input.skipField(tag)) {
                 done = true;
               }
               break;
@@ -2178,7 +2144,6 @@ public final class Overlay {
         throw new com.google.protobuf.InvalidProtocolBufferException(
             e).setUnfinishedMessage(this);
       } finally {
-        this.unknownFields = unknownFields.build();
         makeExtensionsImmutable();
       }
     }
@@ -2197,7 +2162,7 @@ public final class Overlay {
     public static final int IP_FIELD_NUMBER = 1;
     private volatile java.lang.Object ip_;
     /**
-     * <code>string ip = 1;</code>
+     * <code>optional string ip = 1;</code>
      */
     public java.lang.String getIp() {
       java.lang.Object ref = ip_;
@@ -2212,7 +2177,7 @@ public final class Overlay {
       }
     }
     /**
-     * <code>string ip = 1;</code>
+     * <code>optional string ip = 1;</code>
      */
     public com.google.protobuf.ByteString
         getIpBytes() {
@@ -2231,7 +2196,7 @@ public final class Overlay {
     public static final int PORT_FIELD_NUMBER = 2;
     private long port_;
     /**
-     * <code>int64 port = 2;</code>
+     * <code>optional int64 port = 2;</code>
      */
     public long getPort() {
       return port_;
@@ -2240,7 +2205,7 @@ public final class Overlay {
     public static final int NUM_FAILURES_FIELD_NUMBER = 3;
     private long numFailures_;
     /**
-     * <code>int64 num_failures = 3;</code>
+     * <code>optional int64 num_failures = 3;</code>
      */
     public long getNumFailures() {
       return numFailures_;
@@ -2249,7 +2214,7 @@ public final class Overlay {
     public static final int NEXT_ATTEMPT_TIME_FIELD_NUMBER = 4;
     private long nextAttemptTime_;
     /**
-     * <code>int64 next_attempt_time = 4;</code>
+     * <code>optional int64 next_attempt_time = 4;</code>
      */
     public long getNextAttemptTime() {
       return nextAttemptTime_;
@@ -2258,7 +2223,7 @@ public final class Overlay {
     public static final int ACTIVE_TIME_FIELD_NUMBER = 5;
     private long activeTime_;
     /**
-     * <code>int64 active_time = 5;</code>
+     * <code>optional int64 active_time = 5;</code>
      */
     public long getActiveTime() {
       return activeTime_;
@@ -2267,7 +2232,7 @@ public final class Overlay {
     public static final int CONNECTION_ID_FIELD_NUMBER = 6;
     private long connectionId_;
     /**
-     * <code>int64 connection_id = 6;</code>
+     * <code>optional int64 connection_id = 6;</code>
      */
     public long getConnectionId() {
       return connectionId_;
@@ -2303,7 +2268,6 @@ public final class Overlay {
       if (connectionId_ != 0L) {
         output.writeInt64(6, connectionId_);
       }
-      unknownFields.writeTo(output);
     }
 
     public int getSerializedSize() {
@@ -2334,11 +2298,11 @@ public final class Overlay {
         size += com.google.protobuf.CodedOutputStream
           .computeInt64Size(6, connectionId_);
       }
-      size += unknownFields.getSerializedSize();
       memoizedSize = size;
       return size;
     }
 
+    private static final long serialVersionUID = 0L;
     @java.lang.Override
     public boolean equals(final java.lang.Object obj) {
       if (obj == this) {
@@ -2362,7 +2326,6 @@ public final class Overlay {
           == other.getActiveTime());
       result = result && (getConnectionId()
           == other.getConnectionId());
-      result = result && unknownFields.equals(other.unknownFields);
       return result;
     }
 
@@ -2372,7 +2335,7 @@ public final class Overlay {
         return memoizedHashCode;
       }
       int hash = 41;
-      hash = (19 * hash) + getDescriptor().hashCode();
+      hash = (19 * hash) + getDescriptorForType().hashCode();
       hash = (37 * hash) + IP_FIELD_NUMBER;
       hash = (53 * hash) + getIp().hashCode();
       hash = (37 * hash) + PORT_FIELD_NUMBER;
@@ -2395,17 +2358,6 @@ public final class Overlay {
       return hash;
     }
 
-    public static io.phantom.sdk.core.extend.protobuf.Overlay.Peer parseFrom(
-        java.nio.ByteBuffer data)
-        throws com.google.protobuf.InvalidProtocolBufferException {
-      return PARSER.parseFrom(data);
-    }
-    public static io.phantom.sdk.core.extend.protobuf.Overlay.Peer parseFrom(
-        java.nio.ByteBuffer data,
-        com.google.protobuf.ExtensionRegistryLite extensionRegistry)
-        throws com.google.protobuf.InvalidProtocolBufferException {
-      return PARSER.parseFrom(data, extensionRegistry);
-    }
     public static io.phantom.sdk.core.extend.protobuf.Overlay.Peer parseFrom(
         com.google.protobuf.ByteString data)
         throws com.google.protobuf.InvalidProtocolBufferException {
@@ -2572,7 +2524,7 @@ public final class Overlay {
       }
       public Builder setField(
           com.google.protobuf.Descriptors.FieldDescriptor field,
-          java.lang.Object value) {
+          Object value) {
         return (Builder) super.setField(field, value);
       }
       public Builder clearField(
@@ -2585,12 +2537,12 @@ public final class Overlay {
       }
       public Builder setRepeatedField(
           com.google.protobuf.Descriptors.FieldDescriptor field,
-          int index, java.lang.Object value) {
+          int index, Object value) {
         return (Builder) super.setRepeatedField(field, index, value);
       }
       public Builder addRepeatedField(
           com.google.protobuf.Descriptors.FieldDescriptor field,
-          java.lang.Object value) {
+          Object value) {
         return (Builder) super.addRepeatedField(field, value);
       }
       public Builder mergeFrom(com.google.protobuf.Message other) {
@@ -2623,7 +2575,6 @@ public final class Overlay {
         if (other.getConnectionId() != 0L) {
           setConnectionId(other.getConnectionId());
         }
-        this.mergeUnknownFields(other.unknownFields);
         onChanged();
         return this;
       }
@@ -2652,7 +2603,7 @@ public final class Overlay {
 
       private java.lang.Object ip_ = "";
       /**
-       * <code>string ip = 1;</code>
+       * <code>optional string ip = 1;</code>
        */
       public java.lang.String getIp() {
         java.lang.Object ref = ip_;
@@ -2667,7 +2618,7 @@ public final class Overlay {
         }
       }
       /**
-       * <code>string ip = 1;</code>
+       * <code>optional string ip = 1;</code>
        */
       public com.google.protobuf.ByteString
           getIpBytes() {
@@ -2683,7 +2634,7 @@ public final class Overlay {
         }
       }
       /**
-       * <code>string ip = 1;</code>
+       * <code>optional string ip = 1;</code>
        */
       public Builder setIp(
           java.lang.String value) {
@@ -2696,7 +2647,7 @@ public final class Overlay {
         return this;
       }
       /**
-       * <code>string ip = 1;</code>
+       * <code>optional string ip = 1;</code>
        */
       public Builder clearIp() {
         
@@ -2705,7 +2656,7 @@ public final class Overlay {
         return this;
       }
       /**
-       * <code>string ip = 1;</code>
+       * <code>optional string ip = 1;</code>
        */
       public Builder setIpBytes(
           com.google.protobuf.ByteString value) {
@@ -2721,13 +2672,13 @@ public final class Overlay {
 
       private long port_ ;
       /**
-       * <code>int64 port = 2;</code>
+       * <code>optional int64 port = 2;</code>
        */
       public long getPort() {
         return port_;
       }
       /**
-       * <code>int64 port = 2;</code>
+       * <code>optional int64 port = 2;</code>
        */
       public Builder setPort(long value) {
         
@@ -2736,7 +2687,7 @@ public final class Overlay {
         return this;
       }
       /**
-       * <code>int64 port = 2;</code>
+       * <code>optional int64 port = 2;</code>
        */
       public Builder clearPort() {
         
@@ -2747,13 +2698,13 @@ public final class Overlay {
 
       private long numFailures_ ;
       /**
-       * <code>int64 num_failures = 3;</code>
+       * <code>optional int64 num_failures = 3;</code>
        */
       public long getNumFailures() {
         return numFailures_;
       }
       /**
-       * <code>int64 num_failures = 3;</code>
+       * <code>optional int64 num_failures = 3;</code>
        */
       public Builder setNumFailures(long value) {
         
@@ -2762,7 +2713,7 @@ public final class Overlay {
         return this;
       }
       /**
-       * <code>int64 num_failures = 3;</code>
+       * <code>optional int64 num_failures = 3;</code>
        */
       public Builder clearNumFailures() {
         
@@ -2773,13 +2724,13 @@ public final class Overlay {
 
       private long nextAttemptTime_ ;
       /**
-       * <code>int64 next_attempt_time = 4;</code>
+       * <code>optional int64 next_attempt_time = 4;</code>
        */
       public long getNextAttemptTime() {
         return nextAttemptTime_;
       }
       /**
-       * <code>int64 next_attempt_time = 4;</code>
+       * <code>optional int64 next_attempt_time = 4;</code>
        */
       public Builder setNextAttemptTime(long value) {
         
@@ -2788,7 +2739,7 @@ public final class Overlay {
         return this;
       }
       /**
-       * <code>int64 next_attempt_time = 4;</code>
+       * <code>optional int64 next_attempt_time = 4;</code>
        */
       public Builder clearNextAttemptTime() {
         
@@ -2799,13 +2750,13 @@ public final class Overlay {
 
       private long activeTime_ ;
       /**
-       * <code>int64 active_time = 5;</code>
+       * <code>optional int64 active_time = 5;</code>
        */
       public long getActiveTime() {
         return activeTime_;
       }
       /**
-       * <code>int64 active_time = 5;</code>
+       * <code>optional int64 active_time = 5;</code>
        */
       public Builder setActiveTime(long value) {
         
@@ -2814,7 +2765,7 @@ public final class Overlay {
         return this;
       }
       /**
-       * <code>int64 active_time = 5;</code>
+       * <code>optional int64 active_time = 5;</code>
        */
       public Builder clearActiveTime() {
         
@@ -2825,13 +2776,13 @@ public final class Overlay {
 
       private long connectionId_ ;
       /**
-       * <code>int64 connection_id = 6;</code>
+       * <code>optional int64 connection_id = 6;</code>
        */
       public long getConnectionId() {
         return connectionId_;
       }
       /**
-       * <code>int64 connection_id = 6;</code>
+       * <code>optional int64 connection_id = 6;</code>
        */
       public Builder setConnectionId(long value) {
         
@@ -2840,7 +2791,7 @@ public final class Overlay {
         return this;
       }
       /**
-       * <code>int64 connection_id = 6;</code>
+       * <code>optional int64 connection_id = 6;</code>
        */
       public Builder clearConnectionId() {
         
@@ -2850,12 +2801,12 @@ public final class Overlay {
       }
       public final Builder setUnknownFields(
           final com.google.protobuf.UnknownFieldSet unknownFields) {
-        return super.setUnknownFieldsProto3(unknownFields);
+        return this;
       }
 
       public final Builder mergeUnknownFields(
           final com.google.protobuf.UnknownFieldSet unknownFields) {
-        return super.mergeUnknownFields(unknownFields);
+        return this;
       }
 
 
@@ -2878,7 +2829,7 @@ public final class Overlay {
           com.google.protobuf.CodedInputStream input,
           com.google.protobuf.ExtensionRegistryLite extensionRegistry)
           throws com.google.protobuf.InvalidProtocolBufferException {
-        return new Peer(input, extensionRegistry);
+          return new Peer(input, extensionRegistry);
       }
     };
 
@@ -2932,7 +2883,6 @@ public final class Overlay {
       com.google.protobuf.GeneratedMessageV3 implements
       // @@protoc_insertion_point(message_implements:protocol.Peers)
       PeersOrBuilder {
-  private static final long serialVersionUID = 0L;
     // Use Peers.newBuilder() to construct.
     private Peers(com.google.protobuf.GeneratedMessageV3.Builder<?> builder) {
       super(builder);
@@ -2944,19 +2894,14 @@ public final class Overlay {
     @java.lang.Override
     public final com.google.protobuf.UnknownFieldSet
     getUnknownFields() {
-      return this.unknownFields;
+      return com.google.protobuf.UnknownFieldSet.getDefaultInstance();
     }
     private Peers(
         com.google.protobuf.CodedInputStream input,
         com.google.protobuf.ExtensionRegistryLite extensionRegistry)
         throws com.google.protobuf.InvalidProtocolBufferException {
       this();
-      if (extensionRegistry == null) {
-        throw new java.lang.NullPointerException();
-      }
       int mutable_bitField0_ = 0;
-      com.google.protobuf.UnknownFieldSet.Builder unknownFields =
-          com.google.protobuf.UnknownFieldSet.newBuilder();
       try {
         boolean done = false;
         while (!done) {
@@ -2966,8 +2911,7 @@ public final class Overlay {
               done = true;
               break;
             default: {
-              if (!parseUnknownFieldProto3(
-                  input, unknownFields, extensionRegistry, tag)) {
+              if (!input.skipField(tag)) {
                 done = true;
               }
               break;
@@ -2992,7 +2936,6 @@ public final class Overlay {
         if (((mutable_bitField0_ & 0x00000001) == 0x00000001)) {
           peers_ = java.util.Collections.unmodifiableList(peers_);
         }
-        this.unknownFields = unknownFields.build();
         makeExtensionsImmutable();
       }
     }
@@ -3058,7 +3001,6 @@ public final class Overlay {
       for (int i = 0; i < peers_.size(); i++) {
         output.writeMessage(1, peers_.get(i));
       }
-      unknownFields.writeTo(output);
     }
 
     public int getSerializedSize() {
@@ -3070,11 +3012,11 @@ public final class Overlay {
         size += com.google.protobuf.CodedOutputStream
           .computeMessageSize(1, peers_.get(i));
       }
-      size += unknownFields.getSerializedSize();
       memoizedSize = size;
       return size;
     }
 
+    private static final long serialVersionUID = 0L;
     @java.lang.Override
     public boolean equals(final java.lang.Object obj) {
       if (obj == this) {
@@ -3088,7 +3030,6 @@ public final class Overlay {
       boolean result = true;
       result = result && getPeersList()
           .equals(other.getPeersList());
-      result = result && unknownFields.equals(other.unknownFields);
       return result;
     }
 
@@ -3098,7 +3039,7 @@ public final class Overlay {
         return memoizedHashCode;
       }
       int hash = 41;
-      hash = (19 * hash) + getDescriptor().hashCode();
+      hash = (19 * hash) + getDescriptorForType().hashCode();
       if (getPeersCount() > 0) {
         hash = (37 * hash) + PEERS_FIELD_NUMBER;
         hash = (53 * hash) + getPeersList().hashCode();
@@ -3108,17 +3049,6 @@ public final class Overlay {
       return hash;
     }
 
-    public static io.phantom.sdk.core.extend.protobuf.Overlay.Peers parseFrom(
-        java.nio.ByteBuffer data)
-        throws com.google.protobuf.InvalidProtocolBufferException {
-      return PARSER.parseFrom(data);
-    }
-    public static io.phantom.sdk.core.extend.protobuf.Overlay.Peers parseFrom(
-        java.nio.ByteBuffer data,
-        com.google.protobuf.ExtensionRegistryLite extensionRegistry)
-        throws com.google.protobuf.InvalidProtocolBufferException {
-      return PARSER.parseFrom(data, extensionRegistry);
-    }
     public static io.phantom.sdk.core.extend.protobuf.Overlay.Peers parseFrom(
         com.google.protobuf.ByteString data)
         throws com.google.protobuf.InvalidProtocolBufferException {
@@ -3280,7 +3210,7 @@ public final class Overlay {
       }
       public Builder setField(
           com.google.protobuf.Descriptors.FieldDescriptor field,
-          java.lang.Object value) {
+          Object value) {
         return (Builder) super.setField(field, value);
       }
       public Builder clearField(
@@ -3293,12 +3223,12 @@ public final class Overlay {
       }
       public Builder setRepeatedField(
           com.google.protobuf.Descriptors.FieldDescriptor field,
-          int index, java.lang.Object value) {
+          int index, Object value) {
         return (Builder) super.setRepeatedField(field, index, value);
       }
       public Builder addRepeatedField(
           com.google.protobuf.Descriptors.FieldDescriptor field,
-          java.lang.Object value) {
+          Object value) {
         return (Builder) super.addRepeatedField(field, value);
       }
       public Builder mergeFrom(com.google.protobuf.Message other) {
@@ -3338,7 +3268,6 @@ public final class Overlay {
             }
           }
         }
-        this.mergeUnknownFields(other.unknownFields);
         onChanged();
         return this;
       }
@@ -3607,12 +3536,12 @@ public final class Overlay {
       }
       public final Builder setUnknownFields(
           final com.google.protobuf.UnknownFieldSet unknownFields) {
-        return super.setUnknownFieldsProto3(unknownFields);
+        return this;
       }
 
       public final Builder mergeUnknownFields(
           final com.google.protobuf.UnknownFieldSet unknownFields) {
-        return super.mergeUnknownFields(unknownFields);
+        return this;
       }
 
 
@@ -3635,7 +3564,7 @@ public final class Overlay {
           com.google.protobuf.CodedInputStream input,
           com.google.protobuf.ExtensionRegistryLite extensionRegistry)
           throws com.google.protobuf.InvalidProtocolBufferException {
-        return new Peers(input, extensionRegistry);
+          return new Peers(input, extensionRegistry);
       }
     };
 
@@ -3659,17 +3588,17 @@ public final class Overlay {
       com.google.protobuf.MessageOrBuilder {
 
     /**
-     * <code>int64 begin = 1;</code>
+     * <code>optional int64 begin = 1;</code>
      */
     long getBegin();
 
     /**
-     * <code>int64 end = 2;</code>
+     * <code>optional int64 end = 2;</code>
      */
     long getEnd();
 
     /**
-     * <code>int64 timestamp = 3;</code>
+     * <code>optional int64 timestamp = 3;</code>
      */
     long getTimestamp();
   }
@@ -3684,7 +3613,6 @@ public final class Overlay {
       com.google.protobuf.GeneratedMessageV3 implements
       // @@protoc_insertion_point(message_implements:protocol.GetLedgers)
       GetLedgersOrBuilder {
-  private static final long serialVersionUID = 0L;
     // Use GetLedgers.newBuilder() to construct.
     private GetLedgers(com.google.protobuf.GeneratedMessageV3.Builder<?> builder) {
       super(builder);
@@ -3698,19 +3626,14 @@ public final class Overlay {
     @java.lang.Override
     public final com.google.protobuf.UnknownFieldSet
     getUnknownFields() {
-      return this.unknownFields;
+      return com.google.protobuf.UnknownFieldSet.getDefaultInstance();
     }
     private GetLedgers(
         com.google.protobuf.CodedInputStream input,
         com.google.protobuf.ExtensionRegistryLite extensionRegistry)
         throws com.google.protobuf.InvalidProtocolBufferException {
       this();
-      if (extensionRegistry == null) {
-        throw new java.lang.NullPointerException();
-      }
       int mutable_bitField0_ = 0;
-      com.google.protobuf.UnknownFieldSet.Builder unknownFields =
-          com.google.protobuf.UnknownFieldSet.newBuilder();
       try {
         boolean done = false;
         while (!done) {
@@ -3720,8 +3643,7 @@ public final class Overlay {
               done = true;
               break;
             default: {
-              if (!parseUnknownFieldProto3(
-                  input, unknownFields, extensionRegistry, tag)) {
+              if (!input.skipField(tag)) {
                 done = true;
               }
               break;
@@ -3749,7 +3671,6 @@ public final class Overlay {
         throw new com.google.protobuf.InvalidProtocolBufferException(
             e).setUnfinishedMessage(this);
       } finally {
-        this.unknownFields = unknownFields.build();
         makeExtensionsImmutable();
       }
     }
@@ -3768,7 +3689,7 @@ public final class Overlay {
     public static final int BEGIN_FIELD_NUMBER = 1;
     private long begin_;
     /**
-     * <code>int64 begin = 1;</code>
+     * <code>optional int64 begin = 1;</code>
      */
     public long getBegin() {
       return begin_;
@@ -3777,7 +3698,7 @@ public final class Overlay {
     public static final int END_FIELD_NUMBER = 2;
     private long end_;
     /**
-     * <code>int64 end = 2;</code>
+     * <code>optional int64 end = 2;</code>
      */
     public long getEnd() {
       return end_;
@@ -3786,7 +3707,7 @@ public final class Overlay {
     public static final int TIMESTAMP_FIELD_NUMBER = 3;
     private long timestamp_;
     /**
-     * <code>int64 timestamp = 3;</code>
+     * <code>optional int64 timestamp = 3;</code>
      */
     public long getTimestamp() {
       return timestamp_;
@@ -3813,7 +3734,6 @@ public final class Overlay {
       if (timestamp_ != 0L) {
         output.writeInt64(3, timestamp_);
       }
-      unknownFields.writeTo(output);
     }
 
     public int getSerializedSize() {
@@ -3833,11 +3753,11 @@ public final class Overlay {
         size += com.google.protobuf.CodedOutputStream
           .computeInt64Size(3, timestamp_);
       }
-      size += unknownFields.getSerializedSize();
       memoizedSize = size;
       return size;
     }
 
+    private static final long serialVersionUID = 0L;
     @java.lang.Override
     public boolean equals(final java.lang.Object obj) {
       if (obj == this) {
@@ -3855,7 +3775,6 @@ public final class Overlay {
           == other.getEnd());
       result = result && (getTimestamp()
           == other.getTimestamp());
-      result = result && unknownFields.equals(other.unknownFields);
       return result;
     }
 
@@ -3865,7 +3784,7 @@ public final class Overlay {
         return memoizedHashCode;
       }
       int hash = 41;
-      hash = (19 * hash) + getDescriptor().hashCode();
+      hash = (19 * hash) + getDescriptorForType().hashCode();
       hash = (37 * hash) + BEGIN_FIELD_NUMBER;
       hash = (53 * hash) + com.google.protobuf.Internal.hashLong(
           getBegin());
@@ -3880,17 +3799,6 @@ public final class Overlay {
       return hash;
     }
 
-    public static io.phantom.sdk.core.extend.protobuf.Overlay.GetLedgers parseFrom(
-        java.nio.ByteBuffer data)
-        throws com.google.protobuf.InvalidProtocolBufferException {
-      return PARSER.parseFrom(data);
-    }
-    public static io.phantom.sdk.core.extend.protobuf.Overlay.GetLedgers parseFrom(
-        java.nio.ByteBuffer data,
-        com.google.protobuf.ExtensionRegistryLite extensionRegistry)
-        throws com.google.protobuf.InvalidProtocolBufferException {
-      return PARSER.parseFrom(data, extensionRegistry);
-    }
     public static io.phantom.sdk.core.extend.protobuf.Overlay.GetLedgers parseFrom(
         com.google.protobuf.ByteString data)
         throws com.google.protobuf.InvalidProtocolBufferException {
@@ -4048,7 +3956,7 @@ public final class Overlay {
       }
       public Builder setField(
           com.google.protobuf.Descriptors.FieldDescriptor field,
-          java.lang.Object value) {
+          Object value) {
         return (Builder) super.setField(field, value);
       }
       public Builder clearField(
@@ -4061,12 +3969,12 @@ public final class Overlay {
       }
       public Builder setRepeatedField(
           com.google.protobuf.Descriptors.FieldDescriptor field,
-          int index, java.lang.Object value) {
+          int index, Object value) {
         return (Builder) super.setRepeatedField(field, index, value);
       }
       public Builder addRepeatedField(
           com.google.protobuf.Descriptors.FieldDescriptor field,
-          java.lang.Object value) {
+          Object value) {
         return (Builder) super.addRepeatedField(field, value);
       }
       public Builder mergeFrom(com.google.protobuf.Message other) {
@@ -4089,7 +3997,6 @@ public final class Overlay {
         if (other.getTimestamp() != 0L) {
           setTimestamp(other.getTimestamp());
         }
-        this.mergeUnknownFields(other.unknownFields);
         onChanged();
         return this;
       }
@@ -4118,13 +4025,13 @@ public final class Overlay {
 
       private long begin_ ;
       /**
-       * <code>int64 begin = 1;</code>
+       * <code>optional int64 begin = 1;</code>
        */
       public long getBegin() {
         return begin_;
       }
       /**
-       * <code>int64 begin = 1;</code>
+       * <code>optional int64 begin = 1;</code>
        */
       public Builder setBegin(long value) {
         
@@ -4133,7 +4040,7 @@ public final class Overlay {
         return this;
       }
       /**
-       * <code>int64 begin = 1;</code>
+       * <code>optional int64 begin = 1;</code>
        */
       public Builder clearBegin() {
         
@@ -4144,13 +4051,13 @@ public final class Overlay {
 
       private long end_ ;
       /**
-       * <code>int64 end = 2;</code>
+       * <code>optional int64 end = 2;</code>
        */
       public long getEnd() {
         return end_;
       }
       /**
-       * <code>int64 end = 2;</code>
+       * <code>optional int64 end = 2;</code>
        */
       public Builder setEnd(long value) {
         
@@ -4159,7 +4066,7 @@ public final class Overlay {
         return this;
       }
       /**
-       * <code>int64 end = 2;</code>
+       * <code>optional int64 end = 2;</code>
        */
       public Builder clearEnd() {
         
@@ -4170,13 +4077,13 @@ public final class Overlay {
 
       private long timestamp_ ;
       /**
-       * <code>int64 timestamp = 3;</code>
+       * <code>optional int64 timestamp = 3;</code>
        */
       public long getTimestamp() {
         return timestamp_;
       }
       /**
-       * <code>int64 timestamp = 3;</code>
+       * <code>optional int64 timestamp = 3;</code>
        */
       public Builder setTimestamp(long value) {
         
@@ -4185,7 +4092,7 @@ public final class Overlay {
         return this;
       }
       /**
-       * <code>int64 timestamp = 3;</code>
+       * <code>optional int64 timestamp = 3;</code>
        */
       public Builder clearTimestamp() {
         
@@ -4195,12 +4102,12 @@ public final class Overlay {
       }
       public final Builder setUnknownFields(
           final com.google.protobuf.UnknownFieldSet unknownFields) {
-        return super.setUnknownFieldsProto3(unknownFields);
+        return this;
       }
 
       public final Builder mergeUnknownFields(
           final com.google.protobuf.UnknownFieldSet unknownFields) {
-        return super.mergeUnknownFields(unknownFields);
+        return this;
       }
 
 
@@ -4223,7 +4130,7 @@ public final class Overlay {
           com.google.protobuf.CodedInputStream input,
           com.google.protobuf.ExtensionRegistryLite extensionRegistry)
           throws com.google.protobuf.InvalidProtocolBufferException {
-        return new GetLedgers(input, extensionRegistry);
+          return new GetLedgers(input, extensionRegistry);
       }
     };
 
@@ -4271,21 +4178,21 @@ public final class Overlay {
         int index);
 
     /**
-     * <code>.protocol.Ledgers.SyncCode sync_code = 2;</code>
+     * <code>optional .protocol.Ledgers.SyncCode sync_code = 2;</code>
      */
     int getSyncCodeValue();
     /**
-     * <code>.protocol.Ledgers.SyncCode sync_code = 2;</code>
+     * <code>optional .protocol.Ledgers.SyncCode sync_code = 2;</code>
      */
     io.phantom.sdk.core.extend.protobuf.Overlay.Ledgers.SyncCode getSyncCode();
 
     /**
-     * <code>int64 max_seq = 3;</code>
+     * <code>optional int64 max_seq = 3;</code>
      */
     long getMaxSeq();
 
     /**
-     * <code>bytes proof = 4;</code>
+     * <code>optional bytes proof = 4;</code>
      */
     com.google.protobuf.ByteString getProof();
   }
@@ -4300,7 +4207,6 @@ public final class Overlay {
       com.google.protobuf.GeneratedMessageV3 implements
       // @@protoc_insertion_point(message_implements:protocol.Ledgers)
       LedgersOrBuilder {
-  private static final long serialVersionUID = 0L;
     // Use Ledgers.newBuilder() to construct.
     private Ledgers(com.google.protobuf.GeneratedMessageV3.Builder<?> builder) {
       super(builder);
@@ -4315,19 +4221,14 @@ public final class Overlay {
     @java.lang.Override
     public final com.google.protobuf.UnknownFieldSet
     getUnknownFields() {
-      return this.unknownFields;
+      return com.google.protobuf.UnknownFieldSet.getDefaultInstance();
     }
     private Ledgers(
         com.google.protobuf.CodedInputStream input,
         com.google.protobuf.ExtensionRegistryLite extensionRegistry)
         throws com.google.protobuf.InvalidProtocolBufferException {
       this();
-      if (extensionRegistry == null) {
-        throw new java.lang.NullPointerException();
-      }
       int mutable_bitField0_ = 0;
-      com.google.protobuf.UnknownFieldSet.Builder unknownFields =
-          com.google.protobuf.UnknownFieldSet.newBuilder();
       try {
         boolean done = false;
         while (!done) {
@@ -4337,8 +4238,7 @@ public final class Overlay {
               done = true;
               break;
             default: {
-              if (!parseUnknownFieldProto3(
-                  input, unknownFields, extensionRegistry, tag)) {
+              if (!input.skipField(tag)) {
                 done = true;
               }
               break;
@@ -4379,7 +4279,6 @@ public final class Overlay {
         if (((mutable_bitField0_ & 0x00000001) == 0x00000001)) {
           values_ = java.util.Collections.unmodifiableList(values_);
         }
-        this.unknownFields = unknownFields.build();
         makeExtensionsImmutable();
       }
     }
@@ -4616,13 +4515,13 @@ public final class Overlay {
     public static final int SYNC_CODE_FIELD_NUMBER = 2;
     private int syncCode_;
     /**
-     * <code>.protocol.Ledgers.SyncCode sync_code = 2;</code>
+     * <code>optional .protocol.Ledgers.SyncCode sync_code = 2;</code>
      */
     public int getSyncCodeValue() {
       return syncCode_;
     }
     /**
-     * <code>.protocol.Ledgers.SyncCode sync_code = 2;</code>
+     * <code>optional .protocol.Ledgers.SyncCode sync_code = 2;</code>
      */
     public io.phantom.sdk.core.extend.protobuf.Overlay.Ledgers.SyncCode getSyncCode() {
       io.phantom.sdk.core.extend.protobuf.Overlay.Ledgers.SyncCode result = io.phantom.sdk.core.extend.protobuf.Overlay.Ledgers.SyncCode.valueOf(syncCode_);
@@ -4632,7 +4531,7 @@ public final class Overlay {
     public static final int MAX_SEQ_FIELD_NUMBER = 3;
     private long maxSeq_;
     /**
-     * <code>int64 max_seq = 3;</code>
+     * <code>optional int64 max_seq = 3;</code>
      */
     public long getMaxSeq() {
       return maxSeq_;
@@ -4641,7 +4540,7 @@ public final class Overlay {
     public static final int PROOF_FIELD_NUMBER = 4;
     private com.google.protobuf.ByteString proof_;
     /**
-     * <code>bytes proof = 4;</code>
+     * <code>optional bytes proof = 4;</code>
      */
     public com.google.protobuf.ByteString getProof() {
       return proof_;
@@ -4671,7 +4570,6 @@ public final class Overlay {
       if (!proof_.isEmpty()) {
         output.writeBytes(4, proof_);
       }
-      unknownFields.writeTo(output);
     }
 
     public int getSerializedSize() {
@@ -4695,11 +4593,11 @@ public final class Overlay {
         size += com.google.protobuf.CodedOutputStream
           .computeBytesSize(4, proof_);
       }
-      size += unknownFields.getSerializedSize();
       memoizedSize = size;
       return size;
     }
 
+    private static final long serialVersionUID = 0L;
     @java.lang.Override
     public boolean equals(final java.lang.Object obj) {
       if (obj == this) {
@@ -4718,7 +4616,6 @@ public final class Overlay {
           == other.getMaxSeq());
       result = result && getProof()
           .equals(other.getProof());
-      result = result && unknownFields.equals(other.unknownFields);
       return result;
     }
 
@@ -4728,7 +4625,7 @@ public final class Overlay {
         return memoizedHashCode;
       }
       int hash = 41;
-      hash = (19 * hash) + getDescriptor().hashCode();
+      hash = (19 * hash) + getDescriptorForType().hashCode();
       if (getValuesCount() > 0) {
         hash = (37 * hash) + VALUES_FIELD_NUMBER;
         hash = (53 * hash) + getValuesList().hashCode();
@@ -4745,17 +4642,6 @@ public final class Overlay {
       return hash;
     }
 
-    public static io.phantom.sdk.core.extend.protobuf.Overlay.Ledgers parseFrom(
-        java.nio.ByteBuffer data)
-        throws com.google.protobuf.InvalidProtocolBufferException {
-      return PARSER.parseFrom(data);
-    }
-    public static io.phantom.sdk.core.extend.protobuf.Overlay.Ledgers parseFrom(
-        java.nio.ByteBuffer data,
-        com.google.protobuf.ExtensionRegistryLite extensionRegistry)
-        throws com.google.protobuf.InvalidProtocolBufferException {
-      return PARSER.parseFrom(data, extensionRegistry);
-    }
     public static io.phantom.sdk.core.extend.protobuf.Overlay.Ledgers parseFrom(
         com.google.protobuf.ByteString data)
         throws com.google.protobuf.InvalidProtocolBufferException {
@@ -4932,7 +4818,7 @@ public final class Overlay {
       }
       public Builder setField(
           com.google.protobuf.Descriptors.FieldDescriptor field,
-          java.lang.Object value) {
+          Object value) {
         return (Builder) super.setField(field, value);
       }
       public Builder clearField(
@@ -4945,12 +4831,12 @@ public final class Overlay {
       }
       public Builder setRepeatedField(
           com.google.protobuf.Descriptors.FieldDescriptor field,
-          int index, java.lang.Object value) {
+          int index, Object value) {
         return (Builder) super.setRepeatedField(field, index, value);
       }
       public Builder addRepeatedField(
           com.google.protobuf.Descriptors.FieldDescriptor field,
-          java.lang.Object value) {
+          Object value) {
         return (Builder) super.addRepeatedField(field, value);
       }
       public Builder mergeFrom(com.google.protobuf.Message other) {
@@ -4999,7 +4885,6 @@ public final class Overlay {
         if (other.getProof() != com.google.protobuf.ByteString.EMPTY) {
           setProof(other.getProof());
         }
-        this.mergeUnknownFields(other.unknownFields);
         onChanged();
         return this;
       }
@@ -5233,182 +5118,2358 @@ public final class Overlay {
       /**
        * <code>repeated .protocol.ConsensusValue values = 1;</code>
        */
-      public io.phantom.sdk.core.extend.protobuf.Chain.ConsensusValue.Builder addValuesBuilder() {
-        return getValuesFieldBuilder().addBuilder(
-            io.phantom.sdk.core.extend.protobuf.Chain.ConsensusValue.getDefaultInstance());
+      public io.phantom.sdk.core.extend.protobuf.Chain.ConsensusValue.Builder addValuesBuilder() {
+        return getValuesFieldBuilder().addBuilder(
+            io.phantom.sdk.core.extend.protobuf.Chain.ConsensusValue.getDefaultInstance());
+      }
+      /**
+       * <code>repeated .protocol.ConsensusValue values = 1;</code>
+       */
+      public io.phantom.sdk.core.extend.protobuf.Chain.ConsensusValue.Builder addValuesBuilder(
+          int index) {
+        return getValuesFieldBuilder().addBuilder(
+            index, io.phantom.sdk.core.extend.protobuf.Chain.ConsensusValue.getDefaultInstance());
+      }
+      /**
+       * <code>repeated .protocol.ConsensusValue values = 1;</code>
+       */
+      public java.util.List<io.phantom.sdk.core.extend.protobuf.Chain.ConsensusValue.Builder> 
+           getValuesBuilderList() {
+        return getValuesFieldBuilder().getBuilderList();
+      }
+      private com.google.protobuf.RepeatedFieldBuilderV3<
+          io.phantom.sdk.core.extend.protobuf.Chain.ConsensusValue, io.phantom.sdk.core.extend.protobuf.Chain.ConsensusValue.Builder, io.phantom.sdk.core.extend.protobuf.Chain.ConsensusValueOrBuilder> 
+          getValuesFieldBuilder() {
+        if (valuesBuilder_ == null) {
+          valuesBuilder_ = new com.google.protobuf.RepeatedFieldBuilderV3<
+              io.phantom.sdk.core.extend.protobuf.Chain.ConsensusValue, io.phantom.sdk.core.extend.protobuf.Chain.ConsensusValue.Builder, io.phantom.sdk.core.extend.protobuf.Chain.ConsensusValueOrBuilder>(
+                  values_,
+                  ((bitField0_ & 0x00000001) == 0x00000001),
+                  getParentForChildren(),
+                  isClean());
+          values_ = null;
+        }
+        return valuesBuilder_;
+      }
+
+      private int syncCode_ = 0;
+      /**
+       * <code>optional .protocol.Ledgers.SyncCode sync_code = 2;</code>
+       */
+      public int getSyncCodeValue() {
+        return syncCode_;
+      }
+      /**
+       * <code>optional .protocol.Ledgers.SyncCode sync_code = 2;</code>
+       */
+      public Builder setSyncCodeValue(int value) {
+        syncCode_ = value;
+        onChanged();
+        return this;
+      }
+      /**
+       * <code>optional .protocol.Ledgers.SyncCode sync_code = 2;</code>
+       */
+      public io.phantom.sdk.core.extend.protobuf.Overlay.Ledgers.SyncCode getSyncCode() {
+        io.phantom.sdk.core.extend.protobuf.Overlay.Ledgers.SyncCode result = io.phantom.sdk.core.extend.protobuf.Overlay.Ledgers.SyncCode.valueOf(syncCode_);
+        return result == null ? io.phantom.sdk.core.extend.protobuf.Overlay.Ledgers.SyncCode.UNRECOGNIZED : result;
+      }
+      /**
+       * <code>optional .protocol.Ledgers.SyncCode sync_code = 2;</code>
+       */
+      public Builder setSyncCode(io.phantom.sdk.core.extend.protobuf.Overlay.Ledgers.SyncCode value) {
+        if (value == null) {
+          throw new NullPointerException();
+        }
+        
+        syncCode_ = value.getNumber();
+        onChanged();
+        return this;
+      }
+      /**
+       * <code>optional .protocol.Ledgers.SyncCode sync_code = 2;</code>
+       */
+      public Builder clearSyncCode() {
+        
+        syncCode_ = 0;
+        onChanged();
+        return this;
+      }
+
+      private long maxSeq_ ;
+      /**
+       * <code>optional int64 max_seq = 3;</code>
+       */
+      public long getMaxSeq() {
+        return maxSeq_;
+      }
+      /**
+       * <code>optional int64 max_seq = 3;</code>
+       */
+      public Builder setMaxSeq(long value) {
+        
+        maxSeq_ = value;
+        onChanged();
+        return this;
+      }
+      /**
+       * <code>optional int64 max_seq = 3;</code>
+       */
+      public Builder clearMaxSeq() {
+        
+        maxSeq_ = 0L;
+        onChanged();
+        return this;
+      }
+
+      private com.google.protobuf.ByteString proof_ = com.google.protobuf.ByteString.EMPTY;
+      /**
+       * <code>optional bytes proof = 4;</code>
+       */
+      public com.google.protobuf.ByteString getProof() {
+        return proof_;
+      }
+      /**
+       * <code>optional bytes proof = 4;</code>
+       */
+      public Builder setProof(com.google.protobuf.ByteString value) {
+        if (value == null) {
+    throw new NullPointerException();
+  }
+  
+        proof_ = value;
+        onChanged();
+        return this;
+      }
+      /**
+       * <code>optional bytes proof = 4;</code>
+       */
+      public Builder clearProof() {
+        
+        proof_ = getDefaultInstance().getProof();
+        onChanged();
+        return this;
+      }
+      public final Builder setUnknownFields(
+          final com.google.protobuf.UnknownFieldSet unknownFields) {
+        return this;
+      }
+
+      public final Builder mergeUnknownFields(
+          final com.google.protobuf.UnknownFieldSet unknownFields) {
+        return this;
+      }
+
+
+      // @@protoc_insertion_point(builder_scope:protocol.Ledgers)
+    }
+
+    // @@protoc_insertion_point(class_scope:protocol.Ledgers)
+    private static final io.phantom.sdk.core.extend.protobuf.Overlay.Ledgers DEFAULT_INSTANCE;
+    static {
+      DEFAULT_INSTANCE = new io.phantom.sdk.core.extend.protobuf.Overlay.Ledgers();
+    }
+
+    public static io.phantom.sdk.core.extend.protobuf.Overlay.Ledgers getDefaultInstance() {
+      return DEFAULT_INSTANCE;
+    }
+
+    private static final com.google.protobuf.Parser<Ledgers>
+        PARSER = new com.google.protobuf.AbstractParser<Ledgers>() {
+      public Ledgers parsePartialFrom(
+          com.google.protobuf.CodedInputStream input,
+          com.google.protobuf.ExtensionRegistryLite extensionRegistry)
+          throws com.google.protobuf.InvalidProtocolBufferException {
+          return new Ledgers(input, extensionRegistry);
+      }
+    };
+
+    public static com.google.protobuf.Parser<Ledgers> parser() {
+      return PARSER;
+    }
+
+    @java.lang.Override
+    public com.google.protobuf.Parser<Ledgers> getParserForType() {
+      return PARSER;
+    }
+
+    public io.phantom.sdk.core.extend.protobuf.Overlay.Ledgers getDefaultInstanceForType() {
+      return DEFAULT_INSTANCE;
+    }
+
+  }
+
+  public interface GetAccountTreeOrBuilder extends
+      // @@protoc_insertion_point(interface_extends:protocol.GetAccountTree)
+      com.google.protobuf.MessageOrBuilder {
+
+    /**
+     * <pre>
+     *0 for the ledger the peer serves now
+     * </pre>
+     *
+     * <code>optional int64 ledger_seq = 1;</code>
+     */
+    long getLedgerSeq();
+
+    /**
+     * <pre>
+     *account db keys, none to get the ledger itself
+     * </pre>
+     *
+     * <code>repeated bytes keys = 2;</code>
+     */
+    java.util.List<com.google.protobuf.ByteString> getKeysList();
+    /**
+     * <pre>
+     *account db keys, none to get the ledger itself
+     * </pre>
+     *
+     * <code>repeated bytes keys = 2;</code>
+     */
+    int getKeysCount();
+    /**
+     * <pre>
+     *account db keys, none to get the ledger itself
+     * </pre>
+     *
+     * <code>repeated bytes keys = 2;</code>
+     */
+    com.google.protobuf.ByteString getKeys(int index);
+
+    /**
+     * <code>optional int64 timestamp = 3;</code>
+     */
+    long getTimestamp();
+  }
+  /**
+   * <pre>
+   *for state sync, rows of the account tree and of the asset and metadata trees of its accounts
+   * </pre>
+   *
+   * Protobuf type {@code protocol.GetAccountTree}
+   */
+  public  static final class GetAccountTree extends
+      com.google.protobuf.GeneratedMessageV3 implements
+      // @@protoc_insertion_point(message_implements:protocol.GetAccountTree)
+      GetAccountTreeOrBuilder {
+    // Use GetAccountTree.newBuilder() to construct.
+    private GetAccountTree(com.google.protobuf.GeneratedMessageV3.Builder<?> builder) {
+      super(builder);
+    }
+    private GetAccountTree() {
+      ledgerSeq_ = 0L;
+      keys_ = java.util.Collections.emptyList();
+      timestamp_ = 0L;
+    }
+
+    @java.lang.Override
+    public final com.google.protobuf.UnknownFieldSet
+    getUnknownFields() {
+      return com.google.protobuf.UnknownFieldSet.getDefaultInstance();
+    }
+    private GetAccountTree(
+        com.google.protobuf.CodedInputStream input,
+        com.google.protobuf.ExtensionRegistryLite extensionRegistry)
+        throws com.google.protobuf.InvalidProtocolBufferException {
+      this();
+      int mutable_bitField0_ = 0;
+      try {
+        boolean done = false;
+        while (!done) {
+          int tag = input.readTag();
+          switch (tag) {
+            case 0:
+              done = true;
+              break;
+            default: {
+              if (!input.skipField(tag)) {
+                done = true;
+              }
+              break;
+            }
+            case 8: {
+
+              ledgerSeq_ = input.readInt64();
+              break;
+            }
+            case 18: {
+              if (!((mutable_bitField0_ & 0x00000002) == 0x00000002)) {
+                keys_ = new java.util.ArrayList<com.google.protobuf.ByteString>();
+                mutable_bitField0_ |= 0x00000002;
+              }
+              keys_.add(input.readBytes());
+              break;
+            }
+            case 24: {
+
+              timestamp_ = input.readInt64();
+              break;
+            }
+          }
+        }
+      } catch (com.google.protobuf.InvalidProtocolBufferException e) {
+        throw e.setUnfinishedMessage(this);
+      } catch (java.io.IOException e) {
+        throw new com.google.protobuf.InvalidProtocolBufferException(
+            e).setUnfinishedMessage(this);
+      } finally {
+        if (((mutable_bitField0_ & 0x00000002) == 0x00000002)) {
+          keys_ = java.util.Collections.unmodifiableList(keys_);
+        }
+        makeExtensionsImmutable();
+      }
+    }
+    public static final com.google.protobuf.Descriptors.Descriptor
+        getDescriptor() {
+      return io.phantom.sdk.core.extend.protobuf.Overlay.internal_static_protocol_GetAccountTree_descriptor;
+    }
+
+    protected com.google.protobuf.GeneratedMessageV3.FieldAccessorTable
+        internalGetFieldAccessorTable() {
+      return io.phantom.sdk.core.extend.protobuf.Overlay.internal_static_protocol_GetAccountTree_fieldAccessorTable
+          .ensureFieldAccessorsInitialized(
+              io.phantom.sdk.core.extend.protobuf.Overlay.GetAccountTree.class, io.phantom.sdk.core.extend.protobuf.Overlay.GetAccountTree.Builder.class);
+    }
+
+    private int bitField0_;
+    public static final int LEDGER_SEQ_FIELD_NUMBER = 1;
+    private long ledgerSeq_;
+    /**
+     * <pre>
+     *0 for the ledger the peer serves now
+     * </pre>
+     *
+     * <code>optional int64 ledger_seq = 1;</code>
+     */
+    public long getLedgerSeq() {
+      return ledgerSeq_;
+    }
+
+    public static final int KEYS_FIELD_NUMBER = 2;
+    private java.util.List<com.google.protobuf.ByteString> keys_;
+    /**
+     * <pre>
+     *account db keys, none to get the ledger itself
+     * </pre>
+     *
+     * <code>repeated bytes keys = 2;</code>
+     */
+    public java.util.List<com.google.protobuf.ByteString>
+        getKeysList() {
+      return keys_;
+    }
+    /**
+     * <pre>
+     *account db keys, none to get the ledger itself
+     * </pre>
+     *
+     * <code>repeated bytes keys = 2;</code>
+     */
+    public int getKeysCount() {
+      return keys_.size();
+    }
+    /**
+     * <pre>
+     *account db keys, none to get the ledger itself
+     * </pre>
+     *
+     * <code>repeated bytes keys = 2;</code>
+     */
+    public com.google.protobuf.ByteString getKeys(int index) {
+      return keys_.get(index);
+    }
+
+    public static final int TIMESTAMP_FIELD_NUMBER = 3;
+    private long timestamp_;
+    /**
+     * <code>optional int64 timestamp = 3;</code>
+     */
+    public long getTimestamp() {
+      return timestamp_;
+    }
+
+    private byte memoizedIsInitialized = -1;
+    public final boolean isInitialized() {
+      byte isInitialized = memoizedIsInitialized;
+      if (isInitialized == 1) return true;
+      if (isInitialized == 0) return false;
+
+      memoizedIsInitialized = 1;
+      return true;
+    }
+
+    public void writeTo(com.google.protobuf.CodedOutputStream output)
+                        throws java.io.IOException {
+      if (ledgerSeq_ != 0L) {
+        output.writeInt64(1, ledgerSeq_);
+      }
+      for (int i = 0; i < keys_.size(); i++) {
+        output.writeBytes(2, keys_.get(i));
+      }
+      if (timestamp_ != 0L) {
+        output.writeInt64(3, timestamp_);
+      }
+    }
+
+    public int getSerializedSize() {
+      int size = memoizedSize;
+      if (size != -1) return size;
+
+      size = 0;
+      if (ledgerSeq_ != 0L) {
+        size += com.google.protobuf.CodedOutputStream
+          .computeInt64Size(1, ledgerSeq_);
+      }
+      {
+        int dataSize = 0;
+        for (int i = 0; i < keys_.size(); i++) {
+          dataSize += com.google.protobuf.CodedOutputStream
+            .computeBytesSizeNoTag(keys_.get(i));
+        }
+        size += dataSize;
+        size += 1 * getKeysList().size();
+      }
+      if (timestamp_ != 0L) {
+        size += com.google.protobuf.CodedOutputStream
+          .computeInt64Size(3, timestamp_);
+      }
+      memoizedSize = size;
+      return size;
+    }
+
+    private static final long serialVersionUID = 0L;
+    @java.lang.Override
+    public boolean equals(final java.lang.Object obj) {
+      if (obj == this) {
+       return true;
+      }
+      if (!(obj instanceof io.phantom.sdk.core.extend.protobuf.Overlay.GetAccountTree)) {
+        return super.equals(obj);
+      }
+      io.phantom.sdk.core.extend.protobuf.Overlay.GetAccountTree other = (io.phantom.sdk.core.extend.protobuf.Overlay.GetAccountTree) obj;
+
+      boolean result = true;
+      result = result && (getLedgerSeq()
+          == other.getLedgerSeq());
+      result = result && getKeysList()
+          .equals(other.getKeysList());
+      result = result && (getTimestamp()
+          == other.getTimestamp());
+      return result;
+    }
+
+    @java.lang.Override
+    public int hashCode() {
+      if (memoizedHashCode != 0) {
+        return memoizedHashCode;
+      }
+      int hash = 41;
+      hash = (19 * hash) + getDescriptorForType().hashCode();
+      hash = (37 * hash) + LEDGER_SEQ_FIELD_NUMBER;
+      hash = (53 * hash) + com.google.protobuf.Internal.hashLong(
+          getLedgerSeq());
+      if (getKeysCount() > 0) {
+        hash = (37 * hash) + KEYS_FIELD_NUMBER;
+        hash = (53 * hash) + getKeysList().hashCode();
+      }
+      hash = (37 * hash) + TIMESTAMP_FIELD_NUMBER;
+      hash = (53 * hash) + com.google.protobuf.Internal.hashLong(
+          getTimestamp());
+      hash = (29 * hash) + unknownFields.hashCode();
+      memoizedHashCode = hash;
+      return hash;
+    }
+
+    public static io.phantom.sdk.core.extend.protobuf.Overlay.GetAccountTree parseFrom(
+        com.google.protobuf.ByteString data)
+        throws com.google.protobuf.InvalidProtocolBufferException {
+      return PARSER.parseFrom(data);
+    }
+    public static io.phantom.sdk.core.extend.protobuf.Overlay.GetAccountTree parseFrom(
+        com.google.protobuf.ByteString data,
+        com.google.protobuf.ExtensionRegistryLite extensionRegistry)
+        throws com.google.protobuf.InvalidProtocolBufferException {
+      return PARSER.parseFrom(data, extensionRegistry);
+    }
+    public static io.phantom.sdk.core.extend.protobuf.Overlay.GetAccountTree parseFrom(byte[] data)
+        throws com.google.protobuf.InvalidProtocolBufferException {
+      return PARSER.parseFrom(data);
+    }
+    public static io.phantom.sdk.core.extend.protobuf.Overlay.GetAccountTree parseFrom(
+        byte[] data,
+        com.google.protobuf.ExtensionRegistryLite extensionRegistry)
+        throws com.google.protobuf.InvalidProtocolBufferException {
+      return PARSER.parseFrom(data, extensionRegistry);
+    }
+    public static io.phantom.sdk.core.extend.protobuf.Overlay.GetAccountTree parseFrom(java.io.InputStream input)
+        throws java.io.IOException {
+      return com.google.protobuf.GeneratedMessageV3
+          .parseWithIOException(PARSER, input);
+    }
+    public static io.phantom.sdk.core.extend.protobuf.Overlay.GetAccountTree parseFrom(
+        java.io.InputStream input,
+        com.google.protobuf.ExtensionRegistryLite extensionRegistry)
+        throws java.io.IOException {
+      return com.google.protobuf.GeneratedMessageV3
+          .parseWithIOException(PARSER, input, extensionRegistry);
+    }
+    public static io.phantom.sdk.core.extend.protobuf.Overlay.GetAccountTree parseDelimitedFrom(java.io.InputStream input)
+        throws java.io.IOException {
+      return com.google.protobuf.GeneratedMessageV3
+          .parseDelimitedWithIOException(PARSER, input);
+    }
+    public static io.phantom.sdk.core.extend.protobuf.Overlay.GetAccountTree parseDelimitedFrom(
+        java.io.InputStream input,
+        com.google.protobuf.ExtensionRegistryLite extensionRegistry)
+        throws java.io.IOException {
+      return com.google.protobuf.GeneratedMessageV3
+          .parseDelimitedWithIOException(PARSER, input, extensionRegistry);
+    }
+    public static io.phantom.sdk.core.extend.protobuf.Overlay.GetAccountTree parseFrom(
+        com.google.protobuf.CodedInputStream input)
+        throws java.io.IOException {
+      return com.google.protobuf.GeneratedMessageV3
+          .parseWithIOException(PARSER, input);
+    }
+    public static io.phantom.sdk.core.extend.protobuf.Overlay.GetAccountTree parseFrom(
+        com.google.protobuf.CodedInputStream input,
+        com.google.protobuf.ExtensionRegistryLite extensionRegistry)
+        throws java.io.IOException {
+      return com.google.protobuf.GeneratedMessageV3
+          .parseWithIOException(PARSER, input, extensionRegistry);
+    }
+
+    public Builder newBuilderForType() { return newBuilder(); }
+    public static Builder newBuilder() {
+      return DEFAULT_INSTANCE.toBuilder();
+    }
+    public static Builder newBuilder(io.phantom.sdk.core.extend.protobuf.Overlay.GetAccountTree prototype) {
+      return DEFAULT_INSTANCE.toBuilder().mergeFrom(prototype);
+    }
+    public Builder toBuilder() {
+      return this == DEFAULT_INSTANCE
+          ? new Builder() : new Builder().mergeFrom(this);
+    }
+
+    @java.lang.Override
+    protected Builder newBuilderForType(
+        com.google.protobuf.GeneratedMessageV3.BuilderParent parent) {
+      Builder builder = new Builder(parent);
+      return builder;
+    }
+    /**
+     * <pre>
+     *for state sync, rows of the account tree and of the asset and metadata trees of its accounts
+     * </pre>
+     *
+     * Protobuf type {@code protocol.GetAccountTree}
+     */
+    public static final class Builder extends
+        com.google.protobuf.GeneratedMessageV3.Builder<Builder> implements
+        // @@protoc_insertion_point(builder_implements:protocol.GetAccountTree)
+        io.phantom.sdk.core.extend.protobuf.Overlay.GetAccountTreeOrBuilder {
+      public static final com.google.protobuf.Descriptors.Descriptor
+          getDescriptor() {
+        return io.phantom.sdk.core.extend.protobuf.Overlay.internal_static_protocol_GetAccountTree_descriptor;
+      }
+
+      protected com.google.protobuf.GeneratedMessageV3.FieldAccessorTable
+          internalGetFieldAccessorTable() {
+        return io.phantom.sdk.core.extend.protobuf.Overlay.internal_static_protocol_GetAccountTree_fieldAccessorTable
+            .ensureFieldAccessorsInitialized(
+                io.phantom.sdk.core.extend.protobuf.Overlay.GetAccountTree.class, io.phantom.sdk.core.extend.protobuf.Overlay.GetAccountTree.Builder.class);
+      }
+
+      // Construct using io.phantom.sdk.core.extend.protobuf.Overlay.GetAccountTree.newBuilder()
+      private Builder() {
+        maybeForceBuilderInitialization();
+      }
+
+      private Builder(
+          com.google.protobuf.GeneratedMessageV3.BuilderParent parent) {
+        super(parent);
+        maybeForceBuilderInitialization();
+      }
+      private void maybeForceBuilderInitialization() {
+        if (com.google.protobuf.GeneratedMessageV3
+                .alwaysUseFieldBuilders) {
+        }
+      }
+      public Builder clear() {
+        super.clear();
+        ledgerSeq_ = 0L;
+
+        keys_ = java.util.Collections.emptyList();
+        bitField0_ = (bitField0_ & ~0x00000002);
+        timestamp_ = 0L;
+
+        return this;
+      }
+
+      public com.google.protobuf.Descriptors.Descriptor
+          getDescriptorForType() {
+        return io.phantom.sdk.core.extend.protobuf.Overlay.internal_static_protocol_GetAccountTree_descriptor;
+      }
+
+      public io.phantom.sdk.core.extend.protobuf.Overlay.GetAccountTree getDefaultInstanceForType() {
+        return io.phantom.sdk.core.extend.protobuf.Overlay.GetAccountTree.getDefaultInstance();
+      }
+
+      public io.phantom.sdk.core.extend.protobuf.Overlay.GetAccountTree build() {
+        io.phantom.sdk.core.extend.protobuf.Overlay.GetAccountTree result = buildPartial();
+        if (!result.isInitialized()) {
+          throw newUninitializedMessageException(result);
+        }
+        return result;
+      }
+
+      public io.phantom.sdk.core.extend.protobuf.Overlay.GetAccountTree buildPartial() {
+        io.phantom.sdk.core.extend.protobuf.Overlay.GetAccountTree result = new io.phantom.sdk.core.extend.protobuf.Overlay.GetAccountTree(this);
+        int from_bitField0_ = bitField0_;
+        int to_bitField0_ = 0;
+        result.ledgerSeq_ = ledgerSeq_;
+        if (((bitField0_ & 0x00000002) == 0x00000002)) {
+          keys_ = java.util.Collections.unmodifiableList(keys_);
+          bitField0_ = (bitField0_ & ~0x00000002);
+        }
+        result.keys_ = keys_;
+        result.timestamp_ = timestamp_;
+        result.bitField0_ = to_bitField0_;
+        onBuilt();
+        return result;
+      }
+
+      public Builder clone() {
+        return (Builder) super.clone();
+      }
+      public Builder setField(
+          com.google.protobuf.Descriptors.FieldDescriptor field,
+          Object value) {
+        return (Builder) super.setField(field, value);
+      }
+      public Builder clearField(
+          com.google.protobuf.Descriptors.FieldDescriptor field) {
+        return (Builder) super.clearField(field);
+      }
+      public Builder clearOneof(
+          com.google.protobuf.Descriptors.OneofDescriptor oneof) {
+        return (Builder) super.clearOneof(oneof);
+      }
+      public Builder setRepeatedField(
+          com.google.protobuf.Descriptors.FieldDescriptor field,
+          int index, Object value) {
+        return (Builder) super.setRepeatedField(field, index, value);
+      }
+      public Builder addRepeatedField(
+          com.google.protobuf.Descriptors.FieldDescriptor field,
+          Object value) {
+        return (Builder) super.addRepeatedField(field, value);
+      }
+      public Builder mergeFrom(com.google.protobuf.Message other) {
+        if (other instanceof io.phantom.sdk.core.extend.protobuf.Overlay.GetAccountTree) {
+          return mergeFrom((io.phantom.sdk.core.extend.protobuf.Overlay.GetAccountTree)other);
+        } else {
+          super.mergeFrom(other);
+          return this;
+        }
+      }
+
+      public Builder mergeFrom(io.phantom.sdk.core.extend.protobuf.Overlay.GetAccountTree other) {
+        if (other == io.phantom.sdk.core.extend.protobuf.Overlay.GetAccountTree.getDefaultInstance()) return this;
+        if (other.getLedgerSeq() != 0L) {
+          setLedgerSeq(other.getLedgerSeq());
+        }
+        if (!other.keys_.isEmpty()) {
+          if (keys_.isEmpty()) {
+            keys_ = other.keys_;
+            bitField0_ = (bitField0_ & ~0x00000002);
+          } else {
+            ensureKeysIsMutable();
+            keys_.addAll(other.keys_);
+          }
+          onChanged();
+        }
+        if (other.getTimestamp() != 0L) {
+          setTimestamp(other.getTimestamp());
+        }
+        onChanged();
+        return this;
+      }
+
+      public final boolean isInitialized() {
+        return true;
+      }
+
+      public Builder mergeFrom(
+          com.google.protobuf.CodedInputStream input,
+          com.google.protobuf.ExtensionRegistryLite extensionRegistry)
+          throws java.io.IOException {
+        io.phantom.sdk.core.extend.protobuf.Overlay.GetAccountTree parsedMessage = null;
+        try {
+          parsedMessage = PARSER.parsePartialFrom(input, extensionRegistry);
+        } catch (com.google.protobuf.InvalidProtocolBufferException e) {
+          parsedMessage = (io.phantom.sdk.core.extend.protobuf.Overlay.GetAccountTree) e.getUnfinishedMessage();
+          throw e.unwrapIOException();
+        } finally {
+          if (parsedMessage != null) {
+            mergeFrom(parsedMessage);
+          }
+        }
+        return this;
+      }
+      private int bitField0_;
+
+      private long ledgerSeq_ ;
+      /**
+       * <pre>
+       *0 for the ledger the peer serves now
+       * </pre>
+       *
+       * <code>optional int64 ledger_seq = 1;</code>
+       */
+      public long getLedgerSeq() {
+        return ledgerSeq_;
+      }
+      /**
+       * <pre>
+       *0 for the ledger the peer serves now
+       * </pre>
+       *
+       * <code>optional int64 ledger_seq = 1;</code>
+       */
+      public Builder setLedgerSeq(long value) {
+        
+        ledgerSeq_ = value;
+        onChanged();
+        return this;
+      }
+      /**
+       * <pre>
+       *0 for the ledger the peer serves now
+       * </pre>
+       *
+       * <code>optional int64 ledger_seq = 1;</code>
+       */
+      public Builder clearLedgerSeq() {
+        
+        ledgerSeq_ = 0L;
+        onChanged();
+        return this;
+      }
+
+      private java.util.List<com.google.protobuf.ByteString> keys_ = java.util.Collections.emptyList();
+      private void ensureKeysIsMutable() {
+        if (!((bitField0_ & 0x00000002) == 0x00000002)) {
+          keys_ = new java.util.ArrayList<com.google.protobuf.ByteString>(keys_);
+          bitField0_ |= 0x00000002;
+         }
+      }
+      /**
+       * <pre>
+       *account db keys, none to get the ledger itself
+       * </pre>
+       *
+       * <code>repeated bytes keys = 2;</code>
+       */
+      public java.util.List<com.google.protobuf.ByteString>
+          getKeysList() {
+        return java.util.Collections.unmodifiableList(keys_);
+      }
+      /**
+       * <pre>
+       *account db keys, none to get the ledger itself
+       * </pre>
+       *
+       * <code>repeated bytes keys = 2;</code>
+       */
+      public int getKeysCount() {
+        return keys_.size();
+      }
+      /**
+       * <pre>
+       *account db keys, none to get the ledger itself
+       * </pre>
+       *
+       * <code>repeated bytes keys = 2;</code>
+       */
+      public com.google.protobuf.ByteString getKeys(int index) {
+        return keys_.get(index);
+      }
+      /**
+       * <pre>
+       *account db keys, none to get the ledger itself
+       * </pre>
+       *
+       * <code>repeated bytes keys = 2;</code>
+       */
+      public Builder setKeys(
+          int index, com.google.protobuf.ByteString value) {
+        if (value == null) {
+    throw new NullPointerException();
+  }
+  ensureKeysIsMutable();
+        keys_.set(index, value);
+        onChanged();
+        return this;
+      }
+      /**
+       * <pre>
+       *account db keys, none to get the ledger itself
+       * </pre>
+       *
+       * <code>repeated bytes keys = 2;</code>
+       */
+      public Builder addKeys(com.google.protobuf.ByteString value) {
+        if (value == null) {
+    throw new NullPointerException();
+  }
+  ensureKeysIsMutable();
+        keys_.add(value);
+        onChanged();
+        return this;
+      }
+      /**
+       * <pre>
+       *account db keys, none to get the ledger itself
+       * </pre>
+       *
+       * <code>repeated bytes keys = 2;</code>
+       */
+      public Builder addAllKeys(
+          java.lang.Iterable<? extends com.google.protobuf.ByteString> values) {
+        ensureKeysIsMutable();
+        com.google.protobuf.AbstractMessageLite.Builder.addAll(
+            values, keys_);
+        onChanged();
+        return this;
+      }
+      /**
+       * <pre>
+       *account db keys, none to get the ledger itself
+       * </pre>
+       *
+       * <code>repeated bytes keys = 2;</code>
+       */
+      public Builder clearKeys() {
+        keys_ = java.util.Collections.emptyList();
+        bitField0_ = (bitField0_ & ~0x00000002);
+        onChanged();
+        return this;
+      }
+
+      private long timestamp_ ;
+      /**
+       * <code>optional int64 timestamp = 3;</code>
+       */
+      public long getTimestamp() {
+        return timestamp_;
+      }
+      /**
+       * <code>optional int64 timestamp = 3;</code>
+       */
+      public Builder setTimestamp(long value) {
+        
+        timestamp_ = value;
+        onChanged();
+        return this;
+      }
+      /**
+       * <code>optional int64 timestamp = 3;</code>
+       */
+      public Builder clearTimestamp() {
+        
+        timestamp_ = 0L;
+        onChanged();
+        return this;
+      }
+      public final Builder setUnknownFields(
+          final com.google.protobuf.UnknownFieldSet unknownFields) {
+        return this;
+      }
+
+      public final Builder mergeUnknownFields(
+          final com.google.protobuf.UnknownFieldSet unknownFields) {
+        return this;
+      }
+
+
+      // @@protoc_insertion_point(builder_scope:protocol.GetAccountTree)
+    }
+
+    // @@protoc_insertion_point(class_scope:protocol.GetAccountTree)
+    private static final io.phantom.sdk.core.extend.protobuf.Overlay.GetAccountTree DEFAULT_INSTANCE;
+    static {
+      DEFAULT_INSTANCE = new io.phantom.sdk.core.extend.protobuf.Overlay.GetAccountTree();
+    }
+
+    public static io.phantom.sdk.core.extend.protobuf.Overlay.GetAccountTree getDefaultInstance() {
+      return DEFAULT_INSTANCE;
+    }
+
+    private static final com.google.protobuf.Parser<GetAccountTree>
+        PARSER = new com.google.protobuf.AbstractParser<GetAccountTree>() {
+      public GetAccountTree parsePartialFrom(
+          com.google.protobuf.CodedInputStream input,
+          com.google.protobuf.ExtensionRegistryLite extensionRegistry)
+          throws com.google.protobuf.InvalidProtocolBufferException {
+          return new GetAccountTree(input, extensionRegistry);
+      }
+    };
+
+    public static com.google.protobuf.Parser<GetAccountTree> parser() {
+      return PARSER;
+    }
+
+    @java.lang.Override
+    public com.google.protobuf.Parser<GetAccountTree> getParserForType() {
+      return PARSER;
+    }
+
+    public io.phantom.sdk.core.extend.protobuf.Overlay.GetAccountTree getDefaultInstanceForType() {
+      return DEFAULT_INSTANCE;
+    }
+
+  }
+
+  public interface AccountTreeOrBuilder extends
+      // @@protoc_insertion_point(interface_extends:protocol.AccountTree)
+      com.google.protobuf.MessageOrBuilder {
+
+    /**
+     * <code>optional .protocol.AccountTree.SyncCode sync_code = 1;</code>
+     */
+    int getSyncCodeValue();
+    /**
+     * <code>optional .protocol.AccountTree.SyncCode sync_code = 1;</code>
+     */
+    io.phantom.sdk.core.extend.protobuf.Overlay.AccountTree.SyncCode getSyncCode();
+
+    /**
+     * <code>optional int64 ledger_seq = 2;</code>
+     */
+    long getLedgerSeq();
+
+    /**
+     * <pre>
+     *values of the first keys requested, in order
+     * </pre>
+     *
+     * <code>repeated bytes values = 3;</code>
+     */
+    java.util.List<com.google.protobuf.ByteString> getValuesList();
+    /**
+     * <pre>
+     *values of the first keys requested, in order
+     * </pre>
+     *
+     * <code>repeated bytes values = 3;</code>
+     */
+    int getValuesCount();
+    /**
+     * <pre>
+     *values of the first keys requested, in order
+     * </pre>
+     *
+     * <code>repeated bytes values = 3;</code>
+     */
+    com.google.protobuf.ByteString getValues(int index);
+
+    /**
+     * <pre>
+     *for a request without keys
+     * </pre>
+     *
+     * <code>optional .protocol.Ledger ledger = 4;</code>
+     */
+    boolean hasLedger();
+    /**
+     * <pre>
+     *for a request without keys
+     * </pre>
+     *
+     * <code>optional .protocol.Ledger ledger = 4;</code>
+     */
+    io.phantom.sdk.core.extend.protobuf.Chain.Ledger getLedger();
+    /**
+     * <pre>
+     *for a request without keys
+     * </pre>
+     *
+     * <code>optional .protocol.Ledger ledger = 4;</code>
+     */
+    io.phantom.sdk.core.extend.protobuf.Chain.LedgerOrBuilder getLedgerOrBuilder();
+
+    /**
+     * <pre>
+     *of the ledger
+     * </pre>
+     *
+     * <code>optional bytes consensus_value = 5;</code>
+     */
+    com.google.protobuf.ByteString getConsensusValue();
+
+    /**
+     * <pre>
+     *its previous ledger hash is the ledger hash
+     * </pre>
+     *
+     * <code>optional bytes next_value = 6;</code>
+     */
+    com.google.protobuf.ByteString getNextValue();
+
+    /**
+     * <code>optional bytes next_proof = 7;</code>
+     */
+    com.google.protobuf.ByteString getNextProof();
+
+    /**
+     * <pre>
+     *fee config of the ledger
+     * </pre>
+     *
+     * <code>optional bytes fees = 8;</code>
+     */
+    com.google.protobuf.ByteString getFees();
+  }
+  /**
+   * Protobuf type {@code protocol.AccountTree}
+   */
+  public  static final class AccountTree extends
+      com.google.protobuf.GeneratedMessageV3 implements
+      // @@protoc_insertion_point(message_implements:protocol.AccountTree)
+      AccountTreeOrBuilder {
+    // Use AccountTree.newBuilder() to construct.
+    private AccountTree(com.google.protobuf.GeneratedMessageV3.Builder<?> builder) {
+      super(builder);
+    }
+    private AccountTree() {
+      syncCode_ = 0;
+      ledgerSeq_ = 0L;
+      values_ = java.util.Collections.emptyList();
+      consensusValue_ = com.google.protobuf.ByteString.EMPTY;
+      nextValue_ = com.google.protobuf.ByteString.EMPTY;
+      nextProof_ = com.google.protobuf.ByteString.EMPTY;
+      fees_ = com.google.protobuf.ByteString.EMPTY;
+    }
+
+    @java.lang.Override
+    public final com.google.protobuf.UnknownFieldSet
+    getUnknownFields() {
+      return com.google.protobuf.UnknownFieldSet.getDefaultInstance();
+    }
+    private AccountTree(
+        com.google.protobuf.CodedInputStream input,
+        com.google.protobuf.ExtensionRegistryLite extensionRegistry)
+        throws com.google.protobuf.InvalidProtocolBufferException {
+      this();
+      int mutable_bitField0_ = 0;
+      try {
+        boolean done = false;
+        while (!done) {
+          int tag = input.readTag();
+          switch (tag) {
+            case 0:
+              done = true;
+              break;
+            default: {
+              if (!input.skipField(tag)) {
+                done = true;
+              }
+              break;
+            }
+            case 8: {
+              int rawValue = input.readEnum();
+
+              syncCode_ = rawValue;
+              break;
+            }
+            case 16: {
+
+              ledgerSeq_ = input.readInt64();
+              break;
+            }
+            case 26: {
+              if (!((mutable_bitField0_ & 0x00000004) == 0x00000004)) {
+                values_ = new java.util.ArrayList<com.google.protobuf.ByteString>();
+                mutable_bitField0_ |= 0x00000004;
+              }
+              values_.add(input.readBytes());
+              break;
+            }
+            case 34: {
+              io.phantom.sdk.core.extend.protobuf.Chain.Ledger.Builder subBuilder = null;
+              if (ledger_ != null) {
+                subBuilder = ledger_.toBuilder();
+              }
+              ledger_ = input.readMessage(io.phantom.sdk.core.extend.protobuf.Chain.Ledger.parser(), extensionRegistry);
+              if (subBuilder != null) {
+                subBuilder.mergeFrom(ledger_);
+                ledger_ = subBuilder.buildPartial();
+              }
+
+              break;
+            }
+            case 42: {
+
+              consensusValue_ = input.readBytes();
+              break;
+            }
+            case 50: {
+
+              nextValue_ = input.readBytes();
+              break;
+            }
+            case 58: {
+
+              nextProof_ = input.readBytes();
+              break;
+            }
+            case 66: {
+
+              fees_ = input.readBytes();
+              break;
+            }
+          }
+        }
+      } catch (com.google.protobuf.InvalidProtocolBufferException e) {
+        throw e.setUnfinishedMessage(this);
+      } catch (java.io.IOException e) {
+        throw new com.google.protobuf.InvalidProtocolBufferException(
+            e).setUnfinishedMessage(this);
+      } finally {
+        if (((mutable_bitField0_ & 0x00000004) == 0x00000004)) {
+          values_ = java.util.Collections.unmodifiableList(values_);
+        }
+        makeExtensionsImmutable();
+      }
+    }
+    public static final com.google.protobuf.Descriptors.Descriptor
+        getDescriptor() {
+      return io.phantom.sdk.core.extend.protobuf.Overlay.internal_static_protocol_AccountTree_descriptor;
+    }
+
+    protected com.google.protobuf.GeneratedMessageV3.FieldAccessorTable
+        internalGetFieldAccessorTable() {
+      return io.phantom.sdk.core.extend.protobuf.Overlay.internal_static_protocol_AccountTree_fieldAccessorTable
+          .ensureFieldAccessorsInitialized(
+              io.phantom.sdk.core.extend.protobuf.Overlay.AccountTree.class, io.phantom.sdk.core.extend.protobuf.Overlay.AccountTree.Builder.class);
+    }
+
+    /**
+     * Protobuf enum {@code protocol.AccountTree.SyncCode}
+     */
+    public enum SyncCode
+        implements com.google.protobuf.ProtocolMessageEnum {
+      /**
+       * <code>OK = 0;</code>
+       */
+      OK(0),
+      /**
+       * <pre>
+       *the proof of the ledger is not closed yet, ask again
+       * </pre>
+       *
+       * <code>NOT_READY = 1;</code>
+       */
+      NOT_READY(1),
+      /**
+       * <pre>
+       *the ledger is not served any more
+       * </pre>
+       *
+       * <code>NOT_PINNED = 2;</code>
+       */
+      NOT_PINNED(2),
+      /**
+       * <code>INTERNAL = 3;</code>
+       */
+      INTERNAL(3),
+      UNRECOGNIZED(-1),
+      ;
+
+      /**
+       * <code>OK = 0;</code>
+       */
+      public static final int OK_VALUE = 0;
+      /**
+       * <pre>
+       *the proof of the ledger is not closed yet, ask again
+       * </pre>
+       *
+       * <code>NOT_READY = 1;</code>
+       */
+      public static final int NOT_READY_VALUE = 1;
+      /**
+       * <pre>
+       *the ledger is not served any more
+       * </pre>
+       *
+       * <code>NOT_PINNED = 2;</code>
+       */
+      public static final int NOT_PINNED_VALUE = 2;
+      /**
+       * <code>INTERNAL = 3;</code>
+       */
+      public static final int INTERNAL_VALUE = 3;
+
+
+      public final int getNumber() {
+        if (this == UNRECOGNIZED) {
+          throw new java.lang.IllegalArgumentException(
+              "Can't get the number of an unknown enum value.");
+        }
+        return value;
+      }
+
+      /**
+       * @deprecated Use {@link #forNumber(int)} instead.
+       */
+      @java.lang.Deprecated
+      public static SyncCode valueOf(int value) {
+        return forNumber(value);
+      }
+
+      public static SyncCode forNumber(int value) {
+        switch (value) {
+          case 0: return OK;
+          case 1: return NOT_READY;
+          case 2: return NOT_PINNED;
+          case 3: return INTERNAL;
+          default: return null;
+        }
+      }
+
+      public static com.google.protobuf.Internal.EnumLiteMap<SyncCode>
+          internalGetValueMap() {
+        return internalValueMap;
+      }
+      private static final com.google.protobuf.Internal.EnumLiteMap<
+          SyncCode> internalValueMap =
+            new com.google.protobuf.Internal.EnumLiteMap<SyncCode>() {
+              public SyncCode findValueByNumber(int number) {
+                return SyncCode.forNumber(number);
+              }
+            };
+
+      public final com.google.protobuf.Descriptors.EnumValueDescriptor
+          getValueDescriptor() {
+        return getDescriptor().getValues().get(ordinal());
+      }
+      public final com.google.protobuf.Descriptors.EnumDescriptor
+          getDescriptorForType() {
+        return getDescriptor();
+      }
+      public static final com.google.protobuf.Descriptors.EnumDescriptor
+          getDescriptor() {
+        return io.phantom.sdk.core.extend.protobuf.Overlay.AccountTree.getDescriptor().getEnumTypes().get(0);
+      }
+
+      private static final SyncCode[] VALUES = values();
+
+      public static SyncCode valueOf(
+          com.google.protobuf.Descriptors.EnumValueDescriptor desc) {
+        if (desc.getType() != getDescriptor()) {
+          throw new java.lang.IllegalArgumentException(
+            "EnumValueDescriptor is not for this type.");
+        }
+        if (desc.getIndex() == -1) {
+          return UNRECOGNIZED;
+        }
+        return VALUES[desc.getIndex()];
+      }
+
+      private final int value;
+
+      private SyncCode(int value) {
+        this.value = value;
+      }
+
+      // @@protoc_insertion_point(enum_scope:protocol.AccountTree.SyncCode)
+    }
+
+    private int bitField0_;
+    public static final int SYNC_CODE_FIELD_NUMBER = 1;
+    private int syncCode_;
+    /**
+     * <code>optional .protocol.AccountTree.SyncCode sync_code = 1;</code>
+     */
+    public int getSyncCodeValue() {
+      return syncCode_;
+    }
+    /**
+     * <code>optional .protocol.AccountTree.SyncCode sync_code = 1;</code>
+     */
+    public io.phantom.sdk.core.extend.protobuf.Overlay.AccountTree.SyncCode getSyncCode() {
+      io.phantom.sdk.core.extend.protobuf.Overlay.AccountTree.SyncCode result = io.phantom.sdk.core.extend.protobuf.Overlay.AccountTree.SyncCode.valueOf(syncCode_);
+      return result == null ? io.phantom.sdk.core.extend.protobuf.Overlay.AccountTree.SyncCode.UNRECOGNIZED : result;
+    }
+
+    public static final int LEDGER_SEQ_FIELD_NUMBER = 2;
+    private long ledgerSeq_;
+    /**
+     * <code>optional int64 ledger_seq = 2;</code>
+     */
+    public long getLedgerSeq() {
+      return ledgerSeq_;
+    }
+
+    public static final int VALUES_FIELD_NUMBER = 3;
+    private java.util.List<com.google.protobuf.ByteString> values_;
+    /**
+     * <pre>
+     *values of the first keys requested, in order
+     * </pre>
+     *
+     * <code>repeated bytes values = 3;</code>
+     */
+    public java.util.List<com.google.protobuf.ByteString>
+        getValuesList() {
+      return values_;
+    }
+    /**
+     * <pre>
+     *values of the first keys requested, in order
+     * </pre>
+     *
+     * <code>repeated bytes values = 3;</code>
+     */
+    public int getValuesCount() {
+      return values_.size();
+    }
+    /**
+     * <pre>
+     *values of the first keys requested, in order
+     * </pre>
+     *
+     * <code>repeated bytes values = 3;</code>
+     */
+    public com.google.protobuf.ByteString getValues(int index) {
+      return values_.get(index);
+    }
+
+    public static final int LEDGER_FIELD_NUMBER = 4;
+    private io.phantom.sdk.core.extend.protobuf.Chain.Ledger ledger_;
+    /**
+     * <pre>
+     *for a request without keys
+     * </pre>
+     *
+     * <code>optional .protocol.Ledger ledger = 4;</code>
+     */
+    public boolean hasLedger() {
+      return ledger_ != null;
+    }
+    /**
+     * <pre>
+     *for a request without keys
+     * </pre>
+     *
+     * <code>optional .protocol.Ledger ledger = 4;</code>
+     */
+    public io.phantom.sdk.core.extend.protobuf.Chain.Ledger getLedger() {
+      return ledger_ == null ? io.phantom.sdk.core.extend.protobuf.Chain.Ledger.getDefaultInstance() : ledger_;
+    }
+    /**
+     * <pre>
+     *for a request without keys
+     * </pre>
+     *
+     * <code>optional .protocol.Ledger ledger = 4;</code>
+     */
+    public io.phantom.sdk.core.extend.protobuf.Chain.LedgerOrBuilder getLedgerOrBuilder() {
+      return getLedger();
+    }
+
+    public static final int CONSENSUS_VALUE_FIELD_NUMBER = 5;
+    private com.google.protobuf.ByteString consensusValue_;
+    /**
+     * <pre>
+     *of the ledger
+     * </pre>
+     *
+     * <code>optional bytes consensus_value = 5;</code>
+     */
+    public com.google.protobuf.ByteString getConsensusValue() {
+      return consensusValue_;
+    }
+
+    public static final int NEXT_VALUE_FIELD_NUMBER = 6;
+    private com.google.protobuf.ByteString nextValue_;
+    /**
+     * <pre>
+     *its previous ledger hash is the ledger hash
+     * </pre>
+     *
+     * <code>optional bytes next_value = 6;</code>
+     */
+    public com.google.protobuf.ByteString getNextValue() {
+      return nextValue_;
+    }
+
+    public static final int NEXT_PROOF_FIELD_NUMBER = 7;
+    private com.google.protobuf.ByteString nextProof_;
+    /**
+     * <code>optional bytes next_proof = 7;</code>
+     */
+    public com.google.protobuf.ByteString getNextProof() {
+      return nextProof_;
+    }
+
+    public static final int FEES_FIELD_NUMBER = 8;
+    private com.google.protobuf.ByteString fees_;
+    /**
+     * <pre>
+     *fee config of the ledger
+     * </pre>
+     *
+     * <code>optional bytes fees = 8;</code>
+     */
+    public com.google.protobuf.ByteString getFees() {
+      return fees_;
+    }
+
+    private byte memoizedIsInitialized = -1;
+    public final boolean isInitialized() {
+      byte isInitialized = memoizedIsInitialized;
+      if (isInitialized == 1) return true;
+      if (isInitialized == 0) return false;
+
+      memoizedIsInitialized = 1;
+      return true;
+    }
+
+    public void writeTo(com.google.protobuf.CodedOutputStream output)
+                        throws java.io.IOException {
+      if (syncCode_ != io.phantom.sdk.core.extend.protobuf.Overlay.AccountTree.SyncCode.OK.getNumber()) {
+        output.writeEnum(1, syncCode_);
+      }
+      if (ledgerSeq_ != 0L) {
+        output.writeInt64(2, ledgerSeq_);
+      }
+      for (int i = 0; i < values_.size(); i++) {
+        output.writeBytes(3, values_.get(i));
+      }
+      if (ledger_ != null) {
+        output.writeMessage(4, getLedger());
+      }
+      if (!consensusValue_.isEmpty()) {
+        output.writeBytes(5, consensusValue_);
+      }
+      if (!nextValue_.isEmpty()) {
+        output.writeBytes(6, nextValue_);
+      }
+      if (!nextProof_.isEmpty()) {
+        output.writeBytes(7, nextProof_);
+      }
+      if (!fees_.isEmpty()) {
+        output.writeBytes(8, fees_);
+      }
+    }
+
+    public int getSerializedSize() {
+      int size = memoizedSize;
+      if (size != -1) return size;
+
+      size = 0;
+      if (syncCode_ != io.phantom.sdk.core.extend.protobuf.Overlay.AccountTree.SyncCode.OK.getNumber()) {
+        size += com.google.protobuf.CodedOutputStream
+          .computeEnumSize(1, syncCode_);
+      }
+      if (ledgerSeq_ != 0L) {
+        size += com.google.protobuf.CodedOutputStream
+          .computeInt64Size(2, ledgerSeq_);
+      }
+      {
+        int dataSize = 0;
+        for (int i = 0; i < values_.size(); i++) {
+          dataSize += com.google.protobuf.CodedOutputStream
+            .computeBytesSizeNoTag(values_.get(i));
+        }
+        size += dataSize;
+        size += 1 * getValuesList().size();
+      }
+      if (ledger_ != null) {
+        size += com.google.protobuf.CodedOutputStream
+          .computeMessageSize(4, getLedger());
+      }
+      if (!consensusValue_.isEmpty()) {
+        size += com.google.protobuf.CodedOutputStream
+          .computeBytesSize(5, consensusValue_);
+      }
+      if (!nextValue_.isEmpty()) {
+        size += com.google.protobuf.CodedOutputStream
+          .computeBytesSize(6, nextValue_);
+      }
+      if (!nextProof_.isEmpty()) {
+        size += com.google.protobuf.CodedOutputStream
+          .computeBytesSize(7, nextProof_);
+      }
+      if (!fees_.isEmpty()) {
+        size += com.google.protobuf.CodedOutputStream
+          .computeBytesSize(8, fees_);
+      }
+      memoizedSize = size;
+      return size;
+    }
+
+    private static final long serialVersionUID = 0L;
+    @java.lang.Override
+    public boolean equals(final java.lang.Object obj) {
+      if (obj == this) {
+       return true;
+      }
+      if (!(obj instanceof io.phantom.sdk.core.extend.protobuf.Overlay.AccountTree)) {
+        return super.equals(obj);
+      }
+      io.phantom.sdk.core.extend.protobuf.Overlay.AccountTree other = (io.phantom.sdk.core.extend.protobuf.Overlay.AccountTree) obj;
+
+      boolean result = true;
+      result = result && syncCode_ == other.syncCode_;
+      result = result && (getLedgerSeq()
+          == other.getLedgerSeq());
+      result = result && getValuesList()
+          .equals(other.getValuesList());
+      result = result && (hasLedger() == other.hasLedger());
+      if (hasLedger()) {
+        result = result && getLedger()
+            .equals(other.getLedger());
+      }
+      result = result && getConsensusValue()
+          .equals(other.getConsensusValue());
+      result = result && getNextValue()
+          .equals(other.getNextValue());
+      result = result && getNextProof()
+          .equals(other.getNextProof());
+      result = result && getFees()
+          .equals(other.getFees());
+      return result;
+    }
+
+    @java.lang.Override
+    public int hashCode() {
+      if (memoizedHashCode != 0) {
+        return memoizedHashCode;
+      }
+      int hash = 41;
+      hash = (19 * hash) + getDescriptorForType().hashCode();
+      hash = (37 * hash) + SYNC_CODE_FIELD_NUMBER;
+      hash = (53 * hash) + syncCode_;
+      hash = (37 * hash) + LEDGER_SEQ_FIELD_NUMBER;
+      hash = (53 * hash) + com.google.protobuf.Internal.hashLong(
+          getLedgerSeq());
+      if (getValuesCount() > 0) {
+        hash = (37 * hash) + VALUES_FIELD_NUMBER;
+        hash = (53 * hash) + getValuesList().hashCode();
+      }
+      if (hasLedger()) {
+        hash = (37 * hash) + LEDGER_FIELD_NUMBER;
+        hash = (53 * hash) + getLedger().hashCode();
+      }
+      hash = (37 * hash) + CONSENSUS_VALUE_FIELD_NUMBER;
+      hash = (53 * hash) + getConsensusValue().hashCode();
+      hash = (37 * hash) + NEXT_VALUE_FIELD_NUMBER;
+      hash = (53 * hash) + getNextValue().hashCode();
+      hash = (37 * hash) + NEXT_PROOF_FIELD_NUMBER;
+      hash = (53 * hash) + getNextProof().hashCode();
+      hash = (37 * hash) + FEES_FIELD_NUMBER;
+      hash = (53 * hash) + getFees().hashCode();
+      hash = (29 * hash) + unknownFields.hashCode();
+      memoizedHashCode = hash;
+      return hash;
+    }
+
+    public static io.phantom.sdk.core.extend.protobuf.Overlay.AccountTree parseFrom(
+        com.google.protobuf.ByteString data)
+        throws com.google.protobuf.InvalidProtocolBufferException {
+      return PARSER.parseFrom(data);
+    }
+    public static io.phantom.sdk.core.extend.protobuf.Overlay.AccountTree parseFrom(
+        com.google.protobuf.ByteString data,
+        com.google.protobuf.ExtensionRegistryLite extensionRegistry)
+        throws com.google.protobuf.InvalidProtocolBufferException {
+      return PARSER.parseFrom(data, extensionRegistry);
+    }
+    public static io.phantom.sdk.core.extend.protobuf.Overlay.AccountTree parseFrom(byte[] data)
+        throws com.google.protobuf.InvalidProtocolBufferException {
+      return PARSER.parseFrom(data);
+    }
+    public static io.phantom.sdk.core.extend.protobuf.Overlay.AccountTree parseFrom(
+        byte[] data,
+        com.google.protobuf.ExtensionRegistryLite extensionRegistry)
+        throws com.google.protobuf.InvalidProtocolBufferException {
+      return PARSER.parseFrom(data, extensionRegistry);
+    }
+    public static io.phantom.sdk.core.extend.protobuf.Overlay.AccountTree parseFrom(java.io.InputStream input)
+        throws java.io.IOException {
+      return com.google.protobuf.GeneratedMessageV3
+          .parseWithIOException(PARSER, input);
+    }
+    public static io.phantom.sdk.core.extend.protobuf.Overlay.AccountTree parseFrom(
+        java.io.InputStream input,
+        com.google.protobuf.ExtensionRegistryLite extensionRegistry)
+        throws java.io.IOException {
+      return com.google.protobuf.GeneratedMessageV3
+          .parseWithIOException(PARSER, input, extensionRegistry);
+    }
+    public static io.phantom.sdk.core.extend.protobuf.Overlay.AccountTree parseDelimitedFrom(java.io.InputStream input)
+        throws java.io.IOException {
+      return com.google.protobuf.GeneratedMessageV3
+          .parseDelimitedWithIOException(PARSER, input);
+    }
+    public static io.phantom.sdk.core.extend.protobuf.Overlay.AccountTree parseDelimitedFrom(
+        java.io.InputStream input,
+        com.google.protobuf.ExtensionRegistryLite extensionRegistry)
+        throws java.io.IOException {
+      return com.google.protobuf.GeneratedMessageV3
+          .parseDelimitedWithIOException(PARSER, input, extensionRegistry);
+    }
+    public static io.phantom.sdk.core.extend.protobuf.Overlay.AccountTree parseFrom(
+        com.google.protobuf.CodedInputStream input)
+        throws java.io.IOException {
+      return com.google.protobuf.GeneratedMessageV3
+          .parseWithIOException(PARSER, input);
+    }
+    public static io.phantom.sdk.core.extend.protobuf.Overlay.AccountTree parseFrom(
+        com.google.protobuf.CodedInputStream input,
+        com.google.protobuf.ExtensionRegistryLite extensionRegistry)
+        throws java.io.IOException {
+      return com.google.protobuf.GeneratedMessageV3
+          .parseWithIOException(PARSER, input, extensionRegistry);
+    }
+
+    public Builder newBuilderForType() { return newBuilder(); }
+    public static Builder newBuilder() {
+      return DEFAULT_INSTANCE.toBuilder();
+    }
+    public static Builder newBuilder(io.phantom.sdk.core.extend.protobuf.Overlay.AccountTree prototype) {
+      return DEFAULT_INSTANCE.toBuilder().mergeFrom(prototype);
+    }
+    public Builder toBuilder() {
+      return this == DEFAULT_INSTANCE
+          ? new Builder() : new Builder().mergeFrom(this);
+    }
+
+    @java.lang.Override
+    protected Builder newBuilderForType(
+        com.google.protobuf.GeneratedMessageV3.BuilderParent parent) {
+      Builder builder = new Builder(parent);
+      return builder;
+    }
+    /**
+     * Protobuf type {@code protocol.AccountTree}
+     */
+    public static final class Builder extends
+        com.google.protobuf.GeneratedMessageV3.Builder<Builder> implements
+        // @@protoc_insertion_point(builder_implements:protocol.AccountTree)
+        io.phantom.sdk.core.extend.protobuf.Overlay.AccountTreeOrBuilder {
+      public static final com.google.protobuf.Descriptors.Descriptor
+          getDescriptor() {
+        return io.phantom.sdk.core.extend.protobuf.Overlay.internal_static_protocol_AccountTree_descriptor;
+      }
+
+      protected com.google.protobuf.GeneratedMessageV3.FieldAccessorTable
+          internalGetFieldAccessorTable() {
+        return io.phantom.sdk.core.extend.protobuf.Overlay.internal_static_protocol_AccountTree_fieldAccessorTable
+            .ensureFieldAccessorsInitialized(
+                io.phantom.sdk.core.extend.protobuf.Overlay.AccountTree.class, io.phantom.sdk.core.extend.protobuf.Overlay.AccountTree.Builder.class);
+      }
+
+      // Construct using io.phantom.sdk.core.extend.protobuf.Overlay.AccountTree.newBuilder()
+      private Builder() {
+        maybeForceBuilderInitialization();
+      }
+
+      private Builder(
+          com.google.protobuf.GeneratedMessageV3.BuilderParent parent) {
+        super(parent);
+        maybeForceBuilderInitialization();
+      }
+      private void maybeForceBuilderInitialization() {
+        if (com.google.protobuf.GeneratedMessageV3
+                .alwaysUseFieldBuilders) {
+        }
+      }
+      public Builder clear() {
+        super.clear();
+        syncCode_ = 0;
+
+        ledgerSeq_ = 0L;
+
+        values_ = java.util.Collections.emptyList();
+        bitField0_ = (bitField0_ & ~0x00000004);
+        if (ledgerBuilder_ == null) {
+          ledger_ = null;
+        } else {
+          ledger_ = null;
+          ledgerBuilder_ = null;
+        }
+        consensusValue_ = com.google.protobuf.ByteString.EMPTY;
+
+        nextValue_ = com.google.protobuf.ByteString.EMPTY;
+
+        nextProof_ = com.google.protobuf.ByteString.EMPTY;
+
+        fees_ = com.google.protobuf.ByteString.EMPTY;
+
+        return this;
+      }
+
+      public com.google.protobuf.Descriptors.Descriptor
+          getDescriptorForType() {
+        return io.phantom.sdk.core.extend.protobuf.Overlay.internal_static_protocol_AccountTree_descriptor;
+      }
+
+      public io.phantom.sdk.core.extend.protobuf.Overlay.AccountTree getDefaultInstanceForType() {
+        return io.phantom.sdk.core.extend.protobuf.Overlay.AccountTree.getDefaultInstance();
+      }
+
+      public io.phantom.sdk.core.extend.protobuf.Overlay.AccountTree build() {
+        io.phantom.sdk.core.extend.protobuf.Overlay.AccountTree result = buildPartial();
+        if (!result.isInitialized()) {
+          throw newUninitializedMessageException(result);
+        }
+        return result;
+      }
+
+      public io.phantom.sdk.core.extend.protobuf.Overlay.AccountTree buildPartial() {
+        io.phantom.sdk.core.extend.protobuf.Overlay.AccountTree result = new io.phantom.sdk.core.extend.protobuf.Overlay.AccountTree(this);
+        int from_bitField0_ = bitField0_;
+        int to_bitField0_ = 0;
+        result.syncCode_ = syncCode_;
+        result.ledgerSeq_ = ledgerSeq_;
+        if (((bitField0_ & 0x00000004) == 0x00000004)) {
+          values_ = java.util.Collections.unmodifiableList(values_);
+          bitField0_ = (bitField0_ & ~0x00000004);
+        }
+        result.values_ = values_;
+        if (ledgerBuilder_ == null) {
+          result.ledger_ = ledger_;
+        } else {
+          result.ledger_ = ledgerBuilder_.build();
+        }
+        result.consensusValue_ = consensusValue_;
+        result.nextValue_ = nextValue_;
+        result.nextProof_ = nextProof_;
+        result.fees_ = fees_;
+        result.bitField0_ = to_bitField0_;
+        onBuilt();
+        return result;
+      }
+
+      public Builder clone() {
+        return (Builder) super.clone();
+      }
+      public Builder setField(
+          com.google.protobuf.Descriptors.FieldDescriptor field,
+          Object value) {
+        return (Builder) super.setField(field, value);
+      }
+      public Builder clearField(
+          com.google.protobuf.Descriptors.FieldDescriptor field) {
+        return (Builder) super.clearField(field);
+      }
+      public Builder clearOneof(
+          com.google.protobuf.Descriptors.OneofDescriptor oneof) {
+        return (Builder) super.clearOneof(oneof);
+      }
+      public Builder setRepeatedField(
+          com.google.protobuf.Descriptors.FieldDescriptor field,
+          int index, Object value) {
+        return (Builder) super.setRepeatedField(field, index, value);
+      }
+      public Builder addRepeatedField(
+          com.google.protobuf.Descriptors.FieldDescriptor field,
+          Object value) {
+        return (Builder) super.addRepeatedField(field, value);
+      }
+      public Builder mergeFrom(com.google.protobuf.Message other) {
+        if (other instanceof io.phantom.sdk.core.extend.protobuf.Overlay.AccountTree) {
+          return mergeFrom((io.phantom.sdk.core.extend.protobuf.Overlay.AccountTree)other);
+        } else {
+          super.mergeFrom(other);
+          return this;
+        }
+      }
+
+      public Builder mergeFrom(io.phantom.sdk.core.extend.protobuf.Overlay.AccountTree other) {
+        if (other == io.phantom.sdk.core.extend.protobuf.Overlay.AccountTree.getDefaultInstance()) return this;
+        if (other.syncCode_ != 0) {
+          setSyncCodeValue(other.getSyncCodeValue());
+        }
+        if (other.getLedgerSeq() != 0L) {
+          setLedgerSeq(other.getLedgerSeq());
+        }
+        if (!other.values_.isEmpty()) {
+          if (values_.isEmpty()) {
+            values_ = other.values_;
+            bitField0_ = (bitField0_ & ~0x00000004);
+          } else {
+            ensureValuesIsMutable();
+            values_.addAll(other.values_);
+          }
+          onChanged();
+        }
+        if (other.hasLedger()) {
+          mergeLedger(other.getLedger());
+        }
+        if (other.getConsensusValue() != com.google.protobuf.ByteString.EMPTY) {
+          setConsensusValue(other.getConsensusValue());
+        }
+        if (other.getNextValue() != com.google.protobuf.ByteString.EMPTY) {
+          setNextValue(other.getNextValue());
+        }
+        if (other.getNextProof() != com.google.protobuf.ByteString.EMPTY) {
+          setNextProof(other.getNextProof());
+        }
+        if (other.getFees() != com.google.protobuf.ByteString.EMPTY) {
+          setFees(other.getFees());
+        }
+        onChanged();
+        return this;
+      }
+
+      public final boolean isInitialized() {
+        return true;
+      }
+
+      public Builder mergeFrom(
+          com.google.protobuf.CodedInputStream input,
+          com.google.protobuf.ExtensionRegistryLite extensionRegistry)
+          throws java.io.IOException {
+        io.phantom.sdk.core.extend.protobuf.Overlay.AccountTree parsedMessage = null;
+        try {
+          parsedMessage = PARSER.parsePartialFrom(input, extensionRegistry);
+        } catch (com.google.protobuf.InvalidProtocolBufferException e) {
+          parsedMessage = (io.phantom.sdk.core.extend.protobuf.Overlay.AccountTree) e.getUnfinishedMessage();
+          throw e.unwrapIOException();
+        } finally {
+          if (parsedMessage != null) {
+            mergeFrom(parsedMessage);
+          }
+        }
+        return this;
+      }
+      private int bitField0_;
+
+      private int syncCode_ = 0;
+      /**
+       * <code>optional .protocol.AccountTree.SyncCode sync_code = 1;</code>
+       */
+      public int getSyncCodeValue() {
+        return syncCode_;
+      }
+      /**
+       * <code>optional .protocol.AccountTree.SyncCode sync_code = 1;</code>
+       */
+      public Builder setSyncCodeValue(int value) {
+        syncCode_ = value;
+        onChanged();
+        return this;
+      }
+      /**
+       * <code>optional .protocol.AccountTree.SyncCode sync_code = 1;</code>
+       */
+      public io.phantom.sdk.core.extend.protobuf.Overlay.AccountTree.SyncCode getSyncCode() {
+        io.phantom.sdk.core.extend.protobuf.Overlay.AccountTree.SyncCode result = io.phantom.sdk.core.extend.protobuf.Overlay.AccountTree.SyncCode.valueOf(syncCode_);
+        return result == null ? io.phantom.sdk.core.extend.protobuf.Overlay.AccountTree.SyncCode.UNRECOGNIZED : result;
+      }
+      /**
+       * <code>optional .protocol.AccountTree.SyncCode sync_code = 1;</code>
+       */
+      public Builder setSyncCode(io.phantom.sdk.core.extend.protobuf.Overlay.AccountTree.SyncCode value) {
+        if (value == null) {
+          throw new NullPointerException();
+        }
+        
+        syncCode_ = value.getNumber();
+        onChanged();
+        return this;
+      }
+      /**
+       * <code>optional .protocol.AccountTree.SyncCode sync_code = 1;</code>
+       */
+      public Builder clearSyncCode() {
+        
+        syncCode_ = 0;
+        onChanged();
+        return this;
+      }
+
+      private long ledgerSeq_ ;
+      /**
+       * <code>optional int64 ledger_seq = 2;</code>
+       */
+      public long getLedgerSeq() {
+        return ledgerSeq_;
+      }
+      /**
+       * <code>optional int64 ledger_seq = 2;</code>
+       */
+      public Builder setLedgerSeq(long value) {
+        
+        ledgerSeq_ = value;
+        onChanged();
+        return this;
+      }
+      /**
+       * <code>optional int64 ledger_seq = 2;</code>
+       */
+      public Builder clearLedgerSeq() {
+        
+        ledgerSeq_ = 0L;
+        onChanged();
+        return this;
+      }
+
+      private java.util.List<com.google.protobuf.ByteString> values_ = java.util.Collections.emptyList();
+      private void ensureValuesIsMutable() {
+        if (!((bitField0_ & 0x00000004) == 0x00000004)) {
+          values_ = new java.util.ArrayList<com.google.protobuf.ByteString>(values_);
+          bitField0_ |= 0x00000004;
+         }
+      }
+      /**
+       * <pre>
+       *values of the first keys requested, in order
+       * </pre>
+       *
+       * <code>repeated bytes values = 3;</code>
+       */
+      public java.util.List<com.google.protobuf.ByteString>
+          getValuesList() {
+        return java.util.Collections.unmodifiableList(values_);
+      }
+      /**
+       * <pre>
+       *values of the first keys requested, in order
+       * </pre>
+       *
+       * <code>repeated bytes values = 3;</code>
+       */
+      public int getValuesCount() {
+        return values_.size();
+      }
+      /**
+       * <pre>
+       *values of the first keys requested, in order
+       * </pre>
+       *
+       * <code>repeated bytes values = 3;</code>
+       */
+      public com.google.protobuf.ByteString getValues(int index) {
+        return values_.get(index);
+      }
+      /**
+       * <pre>
+       *values of the first keys requested, in order
+       * </pre>
+       *
+       * <code>repeated bytes values = 3;</code>
+       */
+      public Builder setValues(
+          int index, com.google.protobuf.ByteString value) {
+        if (value == null) {
+    throw new NullPointerException();
+  }
+  ensureValuesIsMutable();
+        values_.set(index, value);
+        onChanged();
+        return this;
+      }
+      /**
+       * <pre>
+       *values of the first keys requested, in order
+       * </pre>
+       *
+       * <code>repeated bytes values = 3;</code>
+       */
+      public Builder addValues(com.google.protobuf.ByteString value) {
+        if (value == null) {
+    throw new NullPointerException();
+  }
+  ensureValuesIsMutable();
+        values_.add(value);
+        onChanged();
+        return this;
+      }
+      /**
+       * <pre>
+       *values of the first keys requested, in order
+       * </pre>
+       *
+       * <code>repeated bytes values = 3;</code>
+       */
+      public Builder addAllValues(
+          java.lang.Iterable<? extends com.google.protobuf.ByteString> values) {
+        ensureValuesIsMutable();
+        com.google.protobuf.AbstractMessageLite.Builder.addAll(
+            values, values_);
+        onChanged();
+        return this;
+      }
+      /**
+       * <pre>
+       *values of the first keys requested, in order
+       * </pre>
+       *
+       * <code>repeated bytes values = 3;</code>
+       */
+      public Builder clearValues() {
+        values_ = java.util.Collections.emptyList();
+        bitField0_ = (bitField0_ & ~0x00000004);
+        onChanged();
+        return this;
+      }
+
+      private io.phantom.sdk.core.extend.protobuf.Chain.Ledger ledger_ = null;
+      private com.google.protobuf.SingleFieldBuilderV3<
+          io.phantom.sdk.core.extend.protobuf.Chain.Ledger, io.phantom.sdk.core.extend.protobuf.Chain.Ledger.Builder, io.phantom.sdk.core.extend.protobuf.Chain.LedgerOrBuilder> ledgerBuilder_;
+      /**
+       * <pre>
+       *for a request without keys
+       * </pre>
+       *
+       * <code>optional .protocol.Ledger ledger = 4;</code>
+       */
+      public boolean hasLedger() {
+        return ledgerBuilder_ != null || ledger_ != null;
+      }
+      /**
+       * <pre>
+       *for a request without keys
+       * </pre>
+       *
+       * <code>optional .protocol.Ledger ledger = 4;</code>
+       */
+      public io.phantom.sdk.core.extend.protobuf.Chain.Ledger getLedger() {
+        if (ledgerBuilder_ == null) {
+          return ledger_ == null ? io.phantom.sdk.core.extend.protobuf.Chain.Ledger.getDefaultInstance() : ledger_;
+        } else {
+          return ledgerBuilder_.getMessage();
+        }
+      }
+      /**
+       * <pre>
+       *for a request without keys
+       * </pre>
+       *
+       * <code>optional .protocol.Ledger ledger = 4;</code>
+       */
+      public Builder setLedger(io.phantom.sdk.core.extend.protobuf.Chain.Ledger value) {
+        if (ledgerBuilder_ == null) {
+          if (value == null) {
+            throw new NullPointerException();
+          }
+          ledger_ = value;
+          onChanged();
+        } else {
+          ledgerBuilder_.setMessage(value);
+        }
+
+        return this;
+      }
+      /**
+       * <pre>
+       *for a request without keys
+       * </pre>
+       *
+       * <code>optional .protocol.Ledger ledger = 4;</code>
+       */
+      public Builder setLedger(
+          io.phantom.sdk.core.extend.protobuf.Chain.Ledger.Builder builderForValue) {
+        if (ledgerBuilder_ == null) {
+          ledger_ = builderForValue.build();
+          onChanged();
+        } else {
+          ledgerBuilder_.setMessage(builderForValue.build());
+        }
+
+        return this;
+      }
+      /**
+       * <pre>
+       *for a request without keys
+       * </pre>
+       *
+       * <code>optional .protocol.Ledger ledger = 4;</code>
+       */
+      public Builder mergeLedger(io.phantom.sdk.core.extend.protobuf.Chain.Ledger value) {
+        if (ledgerBuilder_ == null) {
+          if (ledger_ != null) {
+            ledger_ =
+              io.phantom.sdk.core.extend.protobuf.Chain.Ledger.newBuilder(ledger_).mergeFrom(value).buildPartial();
+          } else {
+            ledger_ = value;
+          }
+          onChanged();
+        } else {
+          ledgerBuilder_.mergeFrom(value);
+        }
+
+        return this;
+      }
+      /**
+       * <pre>
+       *for a request without keys
+       * </pre>
+       *
+       * <code>optional .protocol.Ledger ledger = 4;</code>
+       */
+      public Builder clearLedger() {
+        if (ledgerBuilder_ == null) {
+          ledger_ = null;
+          onChanged();
+        } else {
+          ledger_ = null;
+          ledgerBuilder_ = null;
+        }
+
+        return this;
+      }
+      /**
+       * <pre>
+       *for a request without keys
+       * </pre>
+       *
+       * <code>optional .protocol.Ledger ledger = 4;</code>
+       */
+      public io.phantom.sdk.core.extend.protobuf.Chain.Ledger.Builder getLedgerBuilder() {
+        
+        onChanged();
+        return getLedgerFieldBuilder().getBuilder();
       }
       /**
-       * <code>repeated .protocol.ConsensusValue values = 1;</code>
+       * <pre>
+       *for a request without keys
+       * </pre>
+       *
+       * <code>optional .protocol.Ledger ledger = 4;</code>
        */
-      public io.phantom.sdk.core.extend.protobuf.Chain.ConsensusValue.Builder addValuesBuilder(
-          int index) {
-        return getValuesFieldBuilder().addBuilder(
-            index, io.phantom.sdk.core.extend.protobuf.Chain.ConsensusValue.getDefaultInstance());
+      public io.phantom.sdk.core.extend.protobuf.Chain.LedgerOrBuilder getLedgerOrBuilder() {
+        if (ledgerBuilder_ != null) {
+          return ledgerBuilder_.getMessageOrBuilder();
+        } else {
+          return ledger_ == null ?
+              io.phantom.sdk.core.extend.protobuf.Chain.Ledger.getDefaultInstance() : ledger_;
+        }
       }
       /**
-       * <code>repeated .protocol.ConsensusValue values = 1;</code>
+       * <pre>
+       *for a request without keys
+       * </pre>
+       *
+       * <code>optional .protocol.Ledger ledger = 4;</code>
        */
-      public java.util.List<io.phantom.sdk.core.extend.protobuf.Chain.ConsensusValue.Builder> 
-           getValuesBuilderList() {
-        return getValuesFieldBuilder().getBuilderList();
-      }
-      private com.google.protobuf.RepeatedFieldBuilderV3<
-          io.phantom.sdk.core.extend.protobuf.Chain.ConsensusValue, io.phantom.sdk.core.extend.protobuf.Chain.ConsensusValue.Builder, io.phantom.sdk.core.extend.protobuf.Chain.ConsensusValueOrBuilder> 
-          getValuesFieldBuilder() {
-        if (valuesBuilder_ == null) {
-          valuesBuilder_ = new com.google.protobuf.RepeatedFieldBuilderV3<
-              io.phantom.sdk.core.extend.protobuf.Chain.ConsensusValue, io.phantom.sdk.core.extend.protobuf.Chain.ConsensusValue.Builder, io.phantom.sdk.core.extend.protobuf.Chain.ConsensusValueOrBuilder>(
-                  values_,
-                  ((bitField0_ & 0x00000001) == 0x00000001),
+      private com.google.protobuf.SingleFieldBuilderV3<
+          io.phantom.sdk.core.extend.protobuf.Chain.Ledger, io.phantom.sdk.core.extend.protobuf.Chain.Ledger.Builder, io.phantom.sdk.core.extend.protobuf.Chain.LedgerOrBuilder> 
+          getLedgerFieldBuilder() {
+        if (ledgerBuilder_ == null) {
+          ledgerBuilder_ = new com.google.protobuf.SingleFieldBuilderV3<
+              io.phantom.sdk.core.extend.protobuf.Chain.Ledger, io.phantom.sdk.core.extend.protobuf.Chain.Ledger.Builder, io.phantom.sdk.core.extend.protobuf.Chain.LedgerOrBuilder>(
+                  getLedger(),
                   getParentForChildren(),
                   isClean());
-          values_ = null;
+          ledger_ = null;
         }
-        return valuesBuilder_;
+        return ledgerBuilder_;
       }
 
-      private int syncCode_ = 0;
+      private com.google.protobuf.ByteString consensusValue_ = com.google.protobuf.ByteString.EMPTY;
       /**
-       * <code>.protocol.Ledgers.SyncCode sync_code = 2;</code>
+       * <pre>
+       *of the ledger
+       * </pre>
+       *
+       * <code>optional bytes consensus_value = 5;</code>
        */
-      public int getSyncCodeValue() {
-        return syncCode_;
+      public com.google.protobuf.ByteString getConsensusValue() {
+        return consensusValue_;
       }
       /**
-       * <code>.protocol.Ledgers.SyncCode sync_code = 2;</code>
+       * <pre>
+       *of the ledger
+       * </pre>
+       *
+       * <code>optional bytes consensus_value = 5;</code>
        */
-      public Builder setSyncCodeValue(int value) {
-        syncCode_ = value;
+      public Builder setConsensusValue(com.google.protobuf.ByteString value) {
+        if (value == null) {
+    throw new NullPointerException();
+  }
+  
+        consensusValue_ = value;
         onChanged();
         return this;
       }
       /**
-       * <code>.protocol.Ledgers.SyncCode sync_code = 2;</code>
+       * <pre>
+       *of the ledger
+       * </pre>
+       *
+       * <code>optional bytes consensus_value = 5;</code>
        */
-      public io.phantom.sdk.core.extend.protobuf.Overlay.Ledgers.SyncCode getSyncCode() {
-        io.phantom.sdk.core.extend.protobuf.Overlay.Ledgers.SyncCode result = io.phantom.sdk.core.extend.protobuf.Overlay.Ledgers.SyncCode.valueOf(syncCode_);
-        return result == null ? io.phantom.sdk.core.extend.protobuf.Overlay.Ledgers.SyncCode.UNRECOGNIZED : result;
+      public Builder clearConsensusValue() {
+        
+        consensusValue_ = getDefaultInstance().getConsensusValue();
+        onChanged();
+        return this;
       }
+
+      private com.google.protobuf.ByteString nextValue_ = com.google.protobuf.ByteString.EMPTY;
       /**
-       * <code>.protocol.Ledgers.SyncCode sync_code = 2;</code>
+       * <pre>
+       *its previous ledger hash is the ledger hash
+       * </pre>
+       *
+       * <code>optional bytes next_value = 6;</code>
        */
-      public Builder setSyncCode(io.phantom.sdk.core.extend.protobuf.Overlay.Ledgers.SyncCode value) {
+      public com.google.protobuf.ByteString getNextValue() {
+        return nextValue_;
+      }
+      /**
+       * <pre>
+       *its previous ledger hash is the ledger hash
+       * </pre>
+       *
+       * <code>optional bytes next_value = 6;</code>
+       */
+      public Builder setNextValue(com.google.protobuf.ByteString value) {
         if (value == null) {
-          throw new NullPointerException();
-        }
-        
-        syncCode_ = value.getNumber();
+    throw new NullPointerException();
+  }
+  
+        nextValue_ = value;
         onChanged();
         return this;
       }
       /**
-       * <code>.protocol.Ledgers.SyncCode sync_code = 2;</code>
+       * <pre>
+       *its previous ledger hash is the ledger hash
+       * </pre>
+       *
+       * <code>optional bytes next_value = 6;</code>
        */
-      public Builder clearSyncCode() {
+      public Builder clearNextValue() {
         
-        syncCode_ = 0;
+        nextValue_ = getDefaultInstance().getNextValue();
         onChanged();
         return this;
       }
 
-      private long maxSeq_ ;
+      private com.google.protobuf.ByteString nextProof_ = com.google.protobuf.ByteString.EMPTY;
       /**
-       * <code>int64 max_seq = 3;</code>
+       * <code>optional bytes next_proof = 7;</code>
        */
-      public long getMaxSeq() {
-        return maxSeq_;
+      public com.google.protobuf.ByteString getNextProof() {
+        return nextProof_;
       }
       /**
-       * <code>int64 max_seq = 3;</code>
+       * <code>optional bytes next_proof = 7;</code>
        */
-      public Builder setMaxSeq(long value) {
-        
-        maxSeq_ = value;
+      public Builder setNextProof(com.google.protobuf.ByteString value) {
+        if (value == null) {
+    throw new NullPointerException();
+  }
+  
+        nextProof_ = value;
         onChanged();
         return this;
       }
       /**
-       * <code>int64 max_seq = 3;</code>
+       * <code>optional bytes next_proof = 7;</code>
        */
-      public Builder clearMaxSeq() {
+      public Builder clearNextProof() {
         
-        maxSeq_ = 0L;
+        nextProof_ = getDefaultInstance().getNextProof();
         onChanged();
         return this;
       }
 
-      private com.google.protobuf.ByteString proof_ = com.google.protobuf.ByteString.EMPTY;
+      private com.google.protobuf.ByteString fees_ = com.google.protobuf.ByteString.EMPTY;
       /**
-       * <code>bytes proof = 4;</code>
+       * <pre>
+       *fee config of the ledger
+       * </pre>
+       *
+       * <code>optional bytes fees = 8;</code>
        */
-      public com.google.protobuf.ByteString getProof() {
-        return proof_;
+      public com.google.protobuf.ByteString getFees() {
+        return fees_;
       }
       /**
-       * <code>bytes proof = 4;</code>
+       * <pre>
+       *fee config of the ledger
+       * </pre>
+       *
+       * <code>optional bytes fees = 8;</code>
        */
-      public Builder setProof(com.google.protobuf.ByteString value) {
+      public Builder setFees(com.google.protobuf.ByteString value) {
         if (value == null) {
     throw new NullPointerException();
   }
   
-        proof_ = value;
+        fees_ = value;
         onChanged();
         return this;
       }
       /**
-       * <code>bytes proof = 4;</code>
+       * <pre>
+       *fee config of the ledger
+       * </pre>
+       *
+       * <code>optional bytes fees = 8;</code>
        */
-      public Builder clearProof() {
+      public Builder clearFees() {
         
-        proof_ = getDefaultInstance().getProof();
+        fees_ = getDefaultInstance().getFees();
         onChanged();
         return this;
       }
       public final Builder setUnknownFields(
           final com.google.protobuf.UnknownFieldSet unknownFields) {
-        return super.setUnknownFieldsProto3(unknownFields);
+        return this;
       }
 
       public final Builder mergeUnknownFields(
           final com.google.protobuf.UnknownFieldSet unknownFields) {
-        return super.mergeUnknownFields(unknownFields);
+        return this;
       }
 
 
-      // @@protoc_insertion_point(builder_scope:protocol.Ledgers)
+      // @@protoc_insertion_point(builder_scope:protocol.AccountTree)
     }
 
-    // @@protoc_insertion_point(class_scope:protocol.Ledgers)
-    private static final io.phantom.sdk.core.extend.protobuf.Overlay.Ledgers DEFAULT_INSTANCE;
+    // @@protoc_insertion_point(class_scope:protocol.AccountTree)
+    private static final io.phantom.sdk.core.extend.protobuf.Overlay.AccountTree DEFAULT_INSTANCE;
     static {
-      DEFAULT_INSTANCE = new io.phantom.sdk.core.extend.protobuf.Overlay.Ledgers();
+      DEFAULT_INSTANCE = new io.phantom.sdk.core.extend.protobuf.Overlay.AccountTree();
     }
 
-    public static io.phantom.sdk.core.extend.protobuf.Overlay.Ledgers getDefaultInstance() {
+    public static io.phantom.sdk.core.extend.protobuf.Overlay.AccountTree getDefaultInstance() {
       return DEFAULT_INSTANCE;
     }
 
-    private static final com.google.protobuf.Parser<Ledgers>
-        PARSER = new com.google.protobuf.AbstractParser<Ledgers>() {
-      public Ledgers parsePartialFrom(
+    private static final com.google.protobuf.Parser<AccountTree>
+        PARSER = new com.google.protobuf.AbstractParser<AccountTree>() {
+      public AccountTree parsePartialFrom(
           com.google.protobuf.CodedInputStream input,
           com.google.protobuf.ExtensionRegistryLite extensionRegistry)
           throws com.google.protobuf.InvalidProtocolBufferException {
-        return new Ledgers(input, extensionRegistry);
+          return new AccountTree(input, extensionRegistry);
       }
     };
 
-    public static com.google.protobuf.Parser<Ledgers> parser() {
+    public static com.google.protobuf.Parser<AccountTree> parser() {
       return PARSER;
     }
 
     @java.lang.Override
-    public com.google.protobuf.Parser<Ledgers> getParserForType() {
+    public com.google.protobuf.Parser<AccountTree> getParserForType() {
       return PARSER;
     }
 
-    public io.phantom.sdk.core.extend.protobuf.Overlay.Ledgers getDefaultInstanceForType() {
+    public io.phantom.sdk.core.extend.protobuf.Overlay.AccountTree getDefaultInstanceForType() {
       return DEFAULT_INSTANCE;
     }
 
@@ -5419,12 +7480,12 @@ public final class Overlay {
       com.google.protobuf.MessageOrBuilder {
 
     /**
-     * <code>int64 type = 1;</code>
+     * <code>optional int64 type = 1;</code>
      */
     long getType();
 
     /**
-     * <code>bytes hash = 2;</code>
+     * <code>optional bytes hash = 2;</code>
      */
     com.google.protobuf.ByteString getHash();
   }
@@ -5439,7 +7500,6 @@ public final class Overlay {
       com.google.protobuf.GeneratedMessageV3 implements
       // @@protoc_insertion_point(message_implements:protocol.DontHave)
       DontHaveOrBuilder {
-  private static final long serialVersionUID = 0L;
     // Use DontHave.newBuilder() to construct.
     private DontHave(com.google.protobuf.GeneratedMessageV3.Builder<?> builder) {
       super(builder);
@@ -5452,19 +7512,14 @@ public final class Overlay {
     @java.lang.Override
     public final com.google.protobuf.UnknownFieldSet
     getUnknownFields() {
-      return this.unknownFields;
+      return com.google.protobuf.UnknownFieldSet.getDefaultInstance();
     }
     private DontHave(
         com.google.protobuf.CodedInputStream input,
         com.google.protobuf.ExtensionRegistryLite extensionRegistry)
         throws com.google.protobuf.InvalidProtocolBufferException {
       this();
-      if (extensionRegistry == null) {
-        throw new java.lang.NullPointerException();
-      }
       int mutable_bitField0_ = 0;
-      com.google.protobuf.UnknownFieldSet.Builder unknownFields =
-          com.google.protobuf.UnknownFieldSet.newBuilder();
       try {
         boolean done = false;
         while (!done) {
@@ -5474,8 +7529,7 @@ public final class Overlay {
               done = true;
               break;
             default: {
-              if (!parseUnknownFieldProto3(
-                  input, unknownFields, extensionRegistry, tag)) {
+              if (!input.skipField(tag)) {
                 done = true;
               }
               break;
@@ -5498,7 +7552,6 @@ public final class Overlay {
         throw new com.google.protobuf.InvalidProtocolBufferException(
             e).setUnfinishedMessage(this);
       } finally {
-        this.unknownFields = unknownFields.build();
         makeExtensionsImmutable();
       }
     }
@@ -5517,7 +7570,7 @@ public final class Overlay {
     public static final int TYPE_FIELD_NUMBER = 1;
     private long type_;
     /**
-     * <code>int64 type = 1;</code>
+     * <code>optional int64 type = 1;</code>
      */
     public long getType() {
       return type_;
@@ -5526,7 +7579,7 @@ public final class Overlay {
     public static final int HASH_FIELD_NUMBER = 2;
     private com.google.protobuf.ByteString hash_;
     /**
-     * <code>bytes hash = 2;</code>
+     * <code>optional bytes hash = 2;</code>
      */
     public com.google.protobuf.ByteString getHash() {
       return hash_;
@@ -5550,7 +7603,6 @@ public final class Overlay {
       if (!hash_.isEmpty()) {
         output.writeBytes(2, hash_);
       }
-      unknownFields.writeTo(output);
     }
 
     public int getSerializedSize() {
@@ -5566,11 +7618,11 @@ public final class Overlay {
         size += com.google.protobuf.CodedOutputStream
           .computeBytesSize(2, hash_);
       }
-      size += unknownFields.getSerializedSize();
       memoizedSize = size;
       return size;
     }
 
+    private static final long serialVersionUID = 0L;
     @java.lang.Override
     public boolean equals(final java.lang.Object obj) {
       if (obj == this) {
@@ -5586,7 +7638,6 @@ public final class Overlay {
           == other.getType());
       result = result && getHash()
           .equals(other.getHash());
-      result = result && unknownFields.equals(other.unknownFields);
       return result;
     }
 
@@ -5596,7 +7647,7 @@ public final class Overlay {
         return memoizedHashCode;
       }
       int hash = 41;
-      hash = (19 * hash) + getDescriptor().hashCode();
+      hash = (19 * hash) + getDescriptorForType().hashCode();
       hash = (37 * hash) + TYPE_FIELD_NUMBER;
       hash = (53 * hash) + com.google.protobuf.Internal.hashLong(
           getType());
@@ -5607,17 +7658,6 @@ public final class Overlay {
       return hash;
     }
 
-    public static io.phantom.sdk.core.extend.protobuf.Overlay.DontHave parseFrom(
-        java.nio.ByteBuffer data)
-        throws com.google.protobuf.InvalidProtocolBufferException {
-      return PARSER.parseFrom(data);
-    }
-    public static io.phantom.sdk.core.extend.protobuf.Overlay.DontHave parseFrom(
-        java.nio.ByteBuffer data,
-        com.google.protobuf.ExtensionRegistryLite extensionRegistry)
-        throws com.google.protobuf.InvalidProtocolBufferException {
-      return PARSER.parseFrom(data, extensionRegistry);
-    }
     public static io.phantom.sdk.core.extend.protobuf.Overlay.DontHave parseFrom(
         com.google.protobuf.ByteString data)
         throws com.google.protobuf.InvalidProtocolBufferException {
@@ -5772,7 +7812,7 @@ public final class Overlay {
       }
       public Builder setField(
           com.google.protobuf.Descriptors.FieldDescriptor field,
-          java.lang.Object value) {
+          Object value) {
         return (Builder) super.setField(field, value);
       }
       public Builder clearField(
@@ -5785,12 +7825,12 @@ public final class Overlay {
       }
       public Builder setRepeatedField(
           com.google.protobuf.Descriptors.FieldDescriptor field,
-          int index, java.lang.Object value) {
+          int index, Object value) {
         return (Builder) super.setRepeatedField(field, index, value);
       }
       public Builder addRepeatedField(
           com.google.protobuf.Descriptors.FieldDescriptor field,
-          java.lang.Object value) {
+          Object value) {
         return (Builder) super.addRepeatedField(field, value);
       }
       public Builder mergeFrom(com.google.protobuf.Message other) {
@@ -5810,7 +7850,6 @@ public final class Overlay {
         if (other.getHash() != com.google.protobuf.ByteString.EMPTY) {
           setHash(other.getHash());
         }
-        this.mergeUnknownFields(other.unknownFields);
         onChanged();
         return this;
       }
@@ -5839,13 +7878,13 @@ public final class Overlay {
 
       private long type_ ;
       /**
-       * <code>int64 type = 1;</code>
+       * <code>optional int64 type = 1;</code>
        */
       public long getType() {
         return type_;
       }
       /**
-       * <code>int64 type = 1;</code>
+       * <code>optional int64 type = 1;</code>
        */
       public Builder setType(long value) {
         
@@ -5854,7 +7893,7 @@ public final class Overlay {
         return this;
       }
       /**
-       * <code>int64 type = 1;</code>
+       * <code>optional int64 type = 1;</code>
        */
       public Builder clearType() {
         
@@ -5865,13 +7904,13 @@ public final class Overlay {
 
       private com.google.protobuf.ByteString hash_ = com.google.protobuf.ByteString.EMPTY;
       /**
-       * <code>bytes hash = 2;</code>
+       * <code>optional bytes hash = 2;</code>
        */
       public com.google.protobuf.ByteString getHash() {
         return hash_;
       }
       /**
-       * <code>bytes hash = 2;</code>
+       * <code>optional bytes hash = 2;</code>
        */
       public Builder setHash(com.google.protobuf.ByteString value) {
         if (value == null) {
@@ -5883,7 +7922,7 @@ public final class Overlay {
         return this;
       }
       /**
-       * <code>bytes hash = 2;</code>
+       * <code>optional bytes hash = 2;</code>
        */
       public Builder clearHash() {
         
@@ -5893,12 +7932,12 @@ public final class Overlay {
       }
       public final Builder setUnknownFields(
           final com.google.protobuf.UnknownFieldSet unknownFields) {
-        return super.setUnknownFieldsProto3(unknownFields);
+        return this;
       }
 
       public final Builder mergeUnknownFields(
           final com.google.protobuf.UnknownFieldSet unknownFields) {
-        return super.mergeUnknownFields(unknownFields);
+        return this;
       }
 
 
@@ -5921,7 +7960,7 @@ public final class Overlay {
           com.google.protobuf.CodedInputStream input,
           com.google.protobuf.ExtensionRegistryLite extensionRegistry)
           throws com.google.protobuf.InvalidProtocolBufferException {
-        return new DontHave(input, extensionRegistry);
+          return new DontHave(input, extensionRegistry);
       }
     };
 
@@ -5949,20 +7988,20 @@ public final class Overlay {
      *for broadcast
      * </pre>
      *
-     * <code>int64 nonce = 1;</code>
+     * <code>optional int64 nonce = 1;</code>
      */
     long getNonce();
 
     /**
-     * <code>.protocol.LedgerUpgrade upgrade = 2;</code>
+     * <code>optional .protocol.LedgerUpgrade upgrade = 2;</code>
      */
     boolean hasUpgrade();
     /**
-     * <code>.protocol.LedgerUpgrade upgrade = 2;</code>
+     * <code>optional .protocol.LedgerUpgrade upgrade = 2;</code>
      */
     io.phantom.sdk.core.extend.protobuf.Common.LedgerUpgrade getUpgrade();
     /**
-     * <code>.protocol.LedgerUpgrade upgrade = 2;</code>
+     * <code>optional .protocol.LedgerUpgrade upgrade = 2;</code>
      */
     io.phantom.sdk.core.extend.protobuf.Common.LedgerUpgradeOrBuilder getUpgradeOrBuilder();
 
@@ -5971,7 +8010,7 @@ public final class Overlay {
      *consensus sig
      * </pre>
      *
-     * <code>.protocol.Signature signature = 3;</code>
+     * <code>optional .protocol.Signature signature = 3;</code>
      */
     boolean hasSignature();
     /**
@@ -5979,7 +8018,7 @@ public final class Overlay {
      *consensus sig
      * </pre>
      *
-     * <code>.protocol.Signature signature = 3;</code>
+     * <code>optional .protocol.Signature signature = 3;</code>
      */
     io.phantom.sdk.core.extend.protobuf.Common.Signature getSignature();
     /**
@@ -5987,7 +8026,7 @@ public final class Overlay {
      *consensus sig
      * </pre>
      *
-     * <code>.protocol.Signature signature = 3;</code>
+     * <code>optional .protocol.Signature signature = 3;</code>
      */
     io.phantom.sdk.core.extend.protobuf.Common.SignatureOrBuilder getSignatureOrBuilder();
   }
@@ -6002,7 +8041,6 @@ public final class Overlay {
       com.google.protobuf.GeneratedMessageV3 implements
       // @@protoc_insertion_point(message_implements:protocol.LedgerUpgradeNotify)
       LedgerUpgradeNotifyOrBuilder {
-  private static final long serialVersionUID = 0L;
     // Use LedgerUpgradeNotify.newBuilder() to construct.
     private LedgerUpgradeNotify(com.google.protobuf.GeneratedMessageV3.Builder<?> builder) {
       super(builder);
@@ -6014,19 +8052,14 @@ public final class Overlay {
     @java.lang.Override
     public final com.google.protobuf.UnknownFieldSet
     getUnknownFields() {
-      return this.unknownFields;
+      return com.google.protobuf.UnknownFieldSet.getDefaultInstance();
     }
     private LedgerUpgradeNotify(
         com.google.protobuf.CodedInputStream input,
         com.google.protobuf.ExtensionRegistryLite extensionRegistry)
         throws com.google.protobuf.InvalidProtocolBufferException {
       this();
-      if (extensionRegistry == null) {
-        throw new java.lang.NullPointerException();
-      }
       int mutable_bitField0_ = 0;
-      com.google.protobuf.UnknownFieldSet.Builder unknownFields =
-          com.google.protobuf.UnknownFieldSet.newBuilder();
       try {
         boolean done = false;
         while (!done) {
@@ -6036,8 +8069,7 @@ public final class Overlay {
               done = true;
               break;
             default: {
-              if (!parseUnknownFieldProto3(
-                  input, unknownFields, extensionRegistry, tag)) {
+              if (!input.skipField(tag)) {
                 done = true;
               }
               break;
@@ -6081,7 +8113,6 @@ public final class Overlay {
         throw new com.google.protobuf.InvalidProtocolBufferException(
             e).setUnfinishedMessage(this);
       } finally {
-        this.unknownFields = unknownFields.build();
         makeExtensionsImmutable();
       }
     }
@@ -6104,7 +8135,7 @@ public final class Overlay {
      *for broadcast
      * </pre>
      *
-     * <code>int64 nonce = 1;</code>
+     * <code>optional int64 nonce = 1;</code>
      */
     public long getNonce() {
       return nonce_;
@@ -6113,19 +8144,19 @@ public final class Overlay {
     public static final int UPGRADE_FIELD_NUMBER = 2;
     private io.phantom.sdk.core.extend.protobuf.Common.LedgerUpgrade upgrade_;
     /**
-     * <code>.protocol.LedgerUpgrade upgrade = 2;</code>
+     * <code>optional .protocol.LedgerUpgrade upgrade = 2;</code>
      */
     public boolean hasUpgrade() {
       return upgrade_ != null;
     }
     /**
-     * <code>.protocol.LedgerUpgrade upgrade = 2;</code>
+     * <code>optional .protocol.LedgerUpgrade upgrade = 2;</code>
      */
     public io.phantom.sdk.core.extend.protobuf.Common.LedgerUpgrade getUpgrade() {
       return upgrade_ == null ? io.phantom.sdk.core.extend.protobuf.Common.LedgerUpgrade.getDefaultInstance() : upgrade_;
     }
     /**
-     * <code>.protocol.LedgerUpgrade upgrade = 2;</code>
+     * <code>optional .protocol.LedgerUpgrade upgrade = 2;</code>
      */
     public io.phantom.sdk.core.extend.protobuf.Common.LedgerUpgradeOrBuilder getUpgradeOrBuilder() {
       return getUpgrade();
@@ -6138,7 +8169,7 @@ public final class Overlay {
      *consensus sig
      * </pre>
      *
-     * <code>.protocol.Signature signature = 3;</code>
+     * <code>optional .protocol.Signature signature = 3;</code>
      */
     public boolean hasSignature() {
       return signature_ != null;
@@ -6148,7 +8179,7 @@ public final class Overlay {
      *consensus sig
      * </pre>
      *
-     * <code>.protocol.Signature signature = 3;</code>
+     * <code>optional .protocol.Signature signature = 3;</code>
      */
     public io.phantom.sdk.core.extend.protobuf.Common.Signature getSignature() {
       return signature_ == null ? io.phantom.sdk.core.extend.protobuf.Common.Signature.getDefaultInstance() : signature_;
@@ -6158,7 +8189,7 @@ public final class Overlay {
      *consensus sig
      * </pre>
      *
-     * <code>.protocol.Signature signature = 3;</code>
+     * <code>optional .protocol.Signature signature = 3;</code>
      */
     public io.phantom.sdk.core.extend.protobuf.Common.SignatureOrBuilder getSignatureOrBuilder() {
       return getSignature();
@@ -6185,7 +8216,6 @@ public final class Overlay {
       if (signature_ != null) {
         output.writeMessage(3, getSignature());
       }
-      unknownFields.writeTo(output);
     }
 
     public int getSerializedSize() {
@@ -6205,11 +8235,11 @@ public final class Overlay {
         size += com.google.protobuf.CodedOutputStream
           .computeMessageSize(3, getSignature());
       }
-      size += unknownFields.getSerializedSize();
       memoizedSize = size;
       return size;
     }
 
+    private static final long serialVersionUID = 0L;
     @java.lang.Override
     public boolean equals(final java.lang.Object obj) {
       if (obj == this) {
@@ -6233,7 +8263,6 @@ public final class Overlay {
         result = result && getSignature()
             .equals(other.getSignature());
       }
-      result = result && unknownFields.equals(other.unknownFields);
       return result;
     }
 
@@ -6243,7 +8272,7 @@ public final class Overlay {
         return memoizedHashCode;
       }
       int hash = 41;
-      hash = (19 * hash) + getDescriptor().hashCode();
+      hash = (19 * hash) + getDescriptorForType().hashCode();
       hash = (37 * hash) + NONCE_FIELD_NUMBER;
       hash = (53 * hash) + com.google.protobuf.Internal.hashLong(
           getNonce());
@@ -6260,17 +8289,6 @@ public final class Overlay {
       return hash;
     }
 
-    public static io.phantom.sdk.core.extend.protobuf.Overlay.LedgerUpgradeNotify parseFrom(
-        java.nio.ByteBuffer data)
-        throws com.google.protobuf.InvalidProtocolBufferException {
-      return PARSER.parseFrom(data);
-    }
-    public static io.phantom.sdk.core.extend.protobuf.Overlay.LedgerUpgradeNotify parseFrom(
-        java.nio.ByteBuffer data,
-        com.google.protobuf.ExtensionRegistryLite extensionRegistry)
-        throws com.google.protobuf.InvalidProtocolBufferException {
-      return PARSER.parseFrom(data, extensionRegistry);
-    }
     public static io.phantom.sdk.core.extend.protobuf.Overlay.LedgerUpgradeNotify parseFrom(
         com.google.protobuf.ByteString data)
         throws com.google.protobuf.InvalidProtocolBufferException {
@@ -6444,7 +8462,7 @@ public final class Overlay {
       }
       public Builder setField(
           com.google.protobuf.Descriptors.FieldDescriptor field,
-          java.lang.Object value) {
+          Object value) {
         return (Builder) super.setField(field, value);
       }
       public Builder clearField(
@@ -6457,12 +8475,12 @@ public final class Overlay {
       }
       public Builder setRepeatedField(
           com.google.protobuf.Descriptors.FieldDescriptor field,
-          int index, java.lang.Object value) {
+          int index, Object value) {
         return (Builder) super.setRepeatedField(field, index, value);
       }
       public Builder addRepeatedField(
           com.google.protobuf.Descriptors.FieldDescriptor field,
-          java.lang.Object value) {
+          Object value) {
         return (Builder) super.addRepeatedField(field, value);
       }
       public Builder mergeFrom(com.google.protobuf.Message other) {
@@ -6485,7 +8503,6 @@ public final class Overlay {
         if (other.hasSignature()) {
           mergeSignature(other.getSignature());
         }
-        this.mergeUnknownFields(other.unknownFields);
         onChanged();
         return this;
       }
@@ -6518,7 +8535,7 @@ public final class Overlay {
        *for broadcast
        * </pre>
        *
-       * <code>int64 nonce = 1;</code>
+       * <code>optional int64 nonce = 1;</code>
        */
       public long getNonce() {
         return nonce_;
@@ -6528,7 +8545,7 @@ public final class Overlay {
        *for broadcast
        * </pre>
        *
-       * <code>int64 nonce = 1;</code>
+       * <code>optional int64 nonce = 1;</code>
        */
       public Builder setNonce(long value) {
         
@@ -6541,7 +8558,7 @@ public final class Overlay {
        *for broadcast
        * </pre>
        *
-       * <code>int64 nonce = 1;</code>
+       * <code>optional int64 nonce = 1;</code>
        */
       public Builder clearNonce() {
         
@@ -6554,13 +8571,13 @@ public final class Overlay {
       private com.google.protobuf.SingleFieldBuilderV3<
           io.phantom.sdk.core.extend.protobuf.Common.LedgerUpgrade, io.phantom.sdk.core.extend.protobuf.Common.LedgerUpgrade.Builder, io.phantom.sdk.core.extend.protobuf.Common.LedgerUpgradeOrBuilder> upgradeBuilder_;
       /**
-       * <code>.protocol.LedgerUpgrade upgrade = 2;</code>
+       * <code>optional .protocol.LedgerUpgrade upgrade = 2;</code>
        */
       public boolean hasUpgrade() {
         return upgradeBuilder_ != null || upgrade_ != null;
       }
       /**
-       * <code>.protocol.LedgerUpgrade upgrade = 2;</code>
+       * <code>optional .protocol.LedgerUpgrade upgrade = 2;</code>
        */
       public io.phantom.sdk.core.extend.protobuf.Common.LedgerUpgrade getUpgrade() {
         if (upgradeBuilder_ == null) {
@@ -6570,7 +8587,7 @@ public final class Overlay {
         }
       }
       /**
-       * <code>.protocol.LedgerUpgrade upgrade = 2;</code>
+       * <code>optional .protocol.LedgerUpgrade upgrade = 2;</code>
        */
       public Builder setUpgrade(io.phantom.sdk.core.extend.protobuf.Common.LedgerUpgrade value) {
         if (upgradeBuilder_ == null) {
@@ -6586,7 +8603,7 @@ public final class Overlay {
         return this;
       }
       /**
-       * <code>.protocol.LedgerUpgrade upgrade = 2;</code>
+       * <code>optional .protocol.LedgerUpgrade upgrade = 2;</code>
        */
       public Builder setUpgrade(
           io.phantom.sdk.core.extend.protobuf.Common.LedgerUpgrade.Builder builderForValue) {
@@ -6600,7 +8617,7 @@ public final class Overlay {
         return this;
       }
       /**
-       * <code>.protocol.LedgerUpgrade upgrade = 2;</code>
+       * <code>optional .protocol.LedgerUpgrade upgrade = 2;</code>
        */
       public Builder mergeUpgrade(io.phantom.sdk.core.extend.protobuf.Common.LedgerUpgrade value) {
         if (upgradeBuilder_ == null) {
@@ -6618,7 +8635,7 @@ public final class Overlay {
         return this;
       }
       /**
-       * <code>.protocol.LedgerUpgrade upgrade = 2;</code>
+       * <code>optional .protocol.LedgerUpgrade upgrade = 2;</code>
        */
       public Builder clearUpgrade() {
         if (upgradeBuilder_ == null) {
@@ -6632,7 +8649,7 @@ public final class Overlay {
         return this;
       }
       /**
-       * <code>.protocol.LedgerUpgrade upgrade = 2;</code>
+       * <code>optional .protocol.LedgerUpgrade upgrade = 2;</code>
        */
       public io.phantom.sdk.core.extend.protobuf.Common.LedgerUpgrade.Builder getUpgradeBuilder() {
         
@@ -6640,7 +8657,7 @@ public final class Overlay {
         return getUpgradeFieldBuilder().getBuilder();
       }
       /**
-       * <code>.protocol.LedgerUpgrade upgrade = 2;</code>
+       * <code>optional .protocol.LedgerUpgrade upgrade = 2;</code>
        */
       public io.phantom.sdk.core.extend.protobuf.Common.LedgerUpgradeOrBuilder getUpgradeOrBuilder() {
         if (upgradeBuilder_ != null) {
@@ -6651,7 +8668,7 @@ public final class Overlay {
         }
       }
       /**
-       * <code>.protocol.LedgerUpgrade upgrade = 2;</code>
+       * <code>optional .protocol.LedgerUpgrade upgrade = 2;</code>
        */
       private com.google.protobuf.SingleFieldBuilderV3<
           io.phantom.sdk.core.extend.protobuf.Common.LedgerUpgrade, io.phantom.sdk.core.extend.protobuf.Common.LedgerUpgrade.Builder, io.phantom.sdk.core.extend.protobuf.Common.LedgerUpgradeOrBuilder> 
@@ -6675,7 +8692,7 @@ public final class Overlay {
        *consensus sig
        * </pre>
        *
-       * <code>.protocol.Signature signature = 3;</code>
+       * <code>optional .protocol.Signature signature = 3;</code>
        */
       public boolean hasSignature() {
         return signatureBuilder_ != null || signature_ != null;
@@ -6685,7 +8702,7 @@ public final class Overlay {
        *consensus sig
        * </pre>
        *
-       * <code>.protocol.Signature signature = 3;</code>
+       * <code>optional .protocol.Signature signature = 3;</code>
        */
       public io.phantom.sdk.core.extend.protobuf.Common.Signature getSignature() {
         if (signatureBuilder_ == null) {
@@ -6699,7 +8716,7 @@ public final class Overlay {
        *consensus sig
        * </pre>
        *
-       * <code>.protocol.Signature signature = 3;</code>
+       * <code>optional .protocol.Signature signature = 3;</code>
        */
       public Builder setSignature(io.phantom.sdk.core.extend.protobuf.Common.Signature value) {
         if (signatureBuilder_ == null) {
@@ -6719,7 +8736,7 @@ public final class Overlay {
        *consensus sig
        * </pre>
        *
-       * <code>.protocol.Signature signature = 3;</code>
+       * <code>optional .protocol.Signature signature = 3;</code>
        */
       public Builder setSignature(
           io.phantom.sdk.core.extend.protobuf.Common.Signature.Builder builderForValue) {
@@ -6737,7 +8754,7 @@ public final class Overlay {
        *consensus sig
        * </pre>
        *
-       * <code>.protocol.Signature signature = 3;</code>
+       * <code>optional .protocol.Signature signature = 3;</code>
        */
       public Builder mergeSignature(io.phantom.sdk.core.extend.protobuf.Common.Signature value) {
         if (signatureBuilder_ == null) {
@@ -6759,7 +8776,7 @@ public final class Overlay {
        *consensus sig
        * </pre>
        *
-       * <code>.protocol.Signature signature = 3;</code>
+       * <code>optional .protocol.Signature signature = 3;</code>
        */
       public Builder clearSignature() {
         if (signatureBuilder_ == null) {
@@ -6777,7 +8794,7 @@ public final class Overlay {
        *consensus sig
        * </pre>
        *
-       * <code>.protocol.Signature signature = 3;</code>
+       * <code>optional .protocol.Signature signature = 3;</code>
        */
       public io.phantom.sdk.core.extend.protobuf.Common.Signature.Builder getSignatureBuilder() {
         
@@ -6789,7 +8806,7 @@ public final class Overlay {
        *consensus sig
        * </pre>
        *
-       * <code>.protocol.Signature signature = 3;</code>
+       * <code>optional .protocol.Signature signature = 3;</code>
        */
       public io.phantom.sdk.core.extend.protobuf.Common.SignatureOrBuilder getSignatureOrBuilder() {
         if (signatureBuilder_ != null) {
@@ -6804,7 +8821,7 @@ public final class Overlay {
        *consensus sig
        * </pre>
        *
-       * <code>.protocol.Signature signature = 3;</code>
+       * <code>optional .protocol.Signature signature = 3;</code>
        */
       private com.google.protobuf.SingleFieldBuilderV3<
           io.phantom.sdk.core.extend.protobuf.Common.Signature, io.phantom.sdk.core.extend.protobuf.Common.Signature.Builder, io.phantom.sdk.core.extend.protobuf.Common.SignatureOrBuilder> 
@@ -6821,12 +8838,12 @@ public final class Overlay {
       }
       public final Builder setUnknownFields(
           final com.google.protobuf.UnknownFieldSet unknownFields) {
-        return super.setUnknownFieldsProto3(unknownFields);
+        return this;
       }
 
       public final Builder mergeUnknownFields(
           final com.google.protobuf.UnknownFieldSet unknownFields) {
-        return super.mergeUnknownFields(unknownFields);
+        return this;
       }
 
 
@@ -6849,7 +8866,7 @@ public final class Overlay {
           com.google.protobuf.CodedInputStream input,
           com.google.protobuf.ExtensionRegistryLite extensionRegistry)
           throws com.google.protobuf.InvalidProtocolBufferException {
-        return new LedgerUpgradeNotify(input, extensionRegistry);
+          return new LedgerUpgradeNotify(input, extensionRegistry);
       }
     };
 
@@ -6896,7 +8913,6 @@ public final class Overlay {
       com.google.protobuf.GeneratedMessageV3 implements
       // @@protoc_insertion_point(message_implements:protocol.EntryList)
       EntryListOrBuilder {
-  private static final long serialVersionUID = 0L;
     // Use EntryList.newBuilder() to construct.
     private EntryList(com.google.protobuf.GeneratedMessageV3.Builder<?> builder) {
       super(builder);
@@ -6908,19 +8924,14 @@ public final class Overlay {
     @java.lang.Override
     public final com.google.protobuf.UnknownFieldSet
     getUnknownFields() {
-      return this.unknownFields;
+      return com.google.protobuf.UnknownFieldSet.getDefaultInstance();
     }
     private EntryList(
         com.google.protobuf.CodedInputStream input,
         com.google.protobuf.ExtensionRegistryLite extensionRegistry)
         throws com.google.protobuf.InvalidProtocolBufferException {
       this();
-      if (extensionRegistry == null) {
-        throw new java.lang.NullPointerException();
-      }
       int mutable_bitField0_ = 0;
-      com.google.protobuf.UnknownFieldSet.Builder unknownFields =
-          com.google.protobuf.UnknownFieldSet.newBuilder();
       try {
         boolean done = false;
         while (!done) {
@@ -6930,8 +8941,7 @@ public final class Overlay {
               done = true;
               break;
             default: {
-              if (!parseUnknownFieldProto3(
-                  input, unknownFields, extensionRegistry, tag)) {
+              if (!input.skipField(tag)) {
                 done = true;
               }
               break;
@@ -6955,7 +8965,6 @@ public final class Overlay {
         if (((mutable_bitField0_ & 0x00000001) == 0x00000001)) {
           entry_ = java.util.Collections.unmodifiableList(entry_);
         }
-        this.unknownFields = unknownFields.build();
         makeExtensionsImmutable();
       }
     }
@@ -7008,7 +9017,6 @@ public final class Overlay {
       for (int i = 0; i < entry_.size(); i++) {
         output.writeBytes(1, entry_.get(i));
       }
-      unknownFields.writeTo(output);
     }
 
     public int getSerializedSize() {
@@ -7025,11 +9033,11 @@ public final class Overlay {
         size += dataSize;
         size += 1 * getEntryList().size();
       }
-      size += unknownFields.getSerializedSize();
       memoizedSize = size;
       return size;
     }
 
+    private static final long serialVersionUID = 0L;
     @java.lang.Override
     public boolean equals(final java.lang.Object obj) {
       if (obj == this) {
@@ -7043,7 +9051,6 @@ public final class Overlay {
       boolean result = true;
       result = result && getEntryList()
           .equals(other.getEntryList());
-      result = result && unknownFields.equals(other.unknownFields);
       return result;
     }
 
@@ -7053,7 +9060,7 @@ public final class Overlay {
         return memoizedHashCode;
       }
       int hash = 41;
-      hash = (19 * hash) + getDescriptor().hashCode();
+      hash = (19 * hash) + getDescriptorForType().hashCode();
       if (getEntryCount() > 0) {
         hash = (37 * hash) + ENTRY_FIELD_NUMBER;
         hash = (53 * hash) + getEntryList().hashCode();
@@ -7063,17 +9070,6 @@ public final class Overlay {
       return hash;
     }
 
-    public static io.phantom.sdk.core.extend.protobuf.Overlay.EntryList parseFrom(
-        java.nio.ByteBuffer data)
-        throws com.google.protobuf.InvalidProtocolBufferException {
-      return PARSER.parseFrom(data);
-    }
-    public static io.phantom.sdk.core.extend.protobuf.Overlay.EntryList parseFrom(
-        java.nio.ByteBuffer data,
-        com.google.protobuf.ExtensionRegistryLite extensionRegistry)
-        throws com.google.protobuf.InvalidProtocolBufferException {
-      return PARSER.parseFrom(data, extensionRegistry);
-    }
     public static io.phantom.sdk.core.extend.protobuf.Overlay.EntryList parseFrom(
         com.google.protobuf.ByteString data)
         throws com.google.protobuf.InvalidProtocolBufferException {
@@ -7230,7 +9226,7 @@ public final class Overlay {
       }
       public Builder setField(
           com.google.protobuf.Descriptors.FieldDescriptor field,
-          java.lang.Object value) {
+          Object value) {
         return (Builder) super.setField(field, value);
       }
       public Builder clearField(
@@ -7243,12 +9239,12 @@ public final class Overlay {
       }
       public Builder setRepeatedField(
           com.google.protobuf.Descriptors.FieldDescriptor field,
-          int index, java.lang.Object value) {
+          int index, Object value) {
         return (Builder) super.setRepeatedField(field, index, value);
       }
       public Builder addRepeatedField(
           com.google.protobuf.Descriptors.FieldDescriptor field,
-          java.lang.Object value) {
+          Object value) {
         return (Builder) super.addRepeatedField(field, value);
       }
       public Builder mergeFrom(com.google.protobuf.Message other) {
@@ -7272,7 +9268,6 @@ public final class Overlay {
           }
           onChanged();
         }
-        this.mergeUnknownFields(other.unknownFields);
         onChanged();
         return this;
       }
@@ -7373,12 +9368,12 @@ public final class Overlay {
       }
       public final Builder setUnknownFields(
           final com.google.protobuf.UnknownFieldSet unknownFields) {
-        return super.setUnknownFieldsProto3(unknownFields);
+        return this;
       }
 
       public final Builder mergeUnknownFields(
           final com.google.protobuf.UnknownFieldSet unknownFields) {
-        return super.mergeUnknownFields(unknownFields);
+        return this;
       }
 
 
@@ -7401,7 +9396,7 @@ public final class Overlay {
           com.google.protobuf.CodedInputStream input,
           com.google.protobuf.ExtensionRegistryLite extensionRegistry)
           throws com.google.protobuf.InvalidProtocolBufferException {
-        return new EntryList(input, extensionRegistry);
+          return new EntryList(input, extensionRegistry);
       }
     };
 
@@ -7467,7 +9462,7 @@ public final class Overlay {
     int getApiListValue(int index);
 
     /**
-     * <code>int64 timestamp = 2;</code>
+     * <code>optional int64 timestamp = 2;</code>
      */
     long getTimestamp();
   }
@@ -7482,7 +9477,6 @@ public final class Overlay {
       com.google.protobuf.GeneratedMessageV3 implements
       // @@protoc_insertion_point(message_implements:protocol.ChainHello)
       ChainHelloOrBuilder {
-  private static final long serialVersionUID = 0L;
     // Use ChainHello.newBuilder() to construct.
     private ChainHello(com.google.protobuf.GeneratedMessageV3.Builder<?> builder) {
       super(builder);
@@ -7495,19 +9489,14 @@ public final class Overlay {
     @java.lang.Override
     public final com.google.protobuf.UnknownFieldSet
     getUnknownFields() {
-      return this.unknownFields;
+      return com.google.protobuf.UnknownFieldSet.getDefaultInstance();
     }
     private ChainHello(
         com.google.protobuf.CodedInputStream input,
         com.google.protobuf.ExtensionRegistryLite extensionRegistry)
         throws com.google.protobuf.InvalidProtocolBufferException {
       this();
-      if (extensionRegistry == null) {
-        throw new java.lang.NullPointerException();
-      }
       int mutable_bitField0_ = 0;
-      com.google.protobuf.UnknownFieldSet.Builder unknownFields =
-          com.google.protobuf.UnknownFieldSet.newBuilder();
       try {
         boolean done = false;
         while (!done) {
@@ -7517,8 +9506,7 @@ public final class Overlay {
               done = true;
               break;
             default: {
-              if (!parseUnknownFieldProto3(
-                  input, unknownFields, extensionRegistry, tag)) {
+              if (!input.skipField(tag)) {
                 done = true;
               }
               break;
@@ -7562,7 +9550,6 @@ public final class Overlay {
         if (((mutable_bitField0_ & 0x00000001) == 0x00000001)) {
           apiList_ = java.util.Collections.unmodifiableList(apiList_);
         }
-        this.unknownFields = unknownFields.build();
         makeExtensionsImmutable();
       }
     }
@@ -7647,7 +9634,7 @@ public final class Overlay {
     public static final int TIMESTAMP_FIELD_NUMBER = 2;
     private long timestamp_;
     /**
-     * <code>int64 timestamp = 2;</code>
+     * <code>optional int64 timestamp = 2;</code>
      */
     public long getTimestamp() {
       return timestamp_;
@@ -7676,7 +9663,6 @@ public final class Overlay {
       if (timestamp_ != 0L) {
         output.writeInt64(2, timestamp_);
       }
-      unknownFields.writeTo(output);
     }
 
     public int getSerializedSize() {
@@ -7700,11 +9686,11 @@ public final class Overlay {
         size += com.google.protobuf.CodedOutputStream
           .computeInt64Size(2, timestamp_);
       }
-      size += unknownFields.getSerializedSize();
       memoizedSize = size;
       return size;
     }
 
+    private static final long serialVersionUID = 0L;
     @java.lang.Override
     public boolean equals(final java.lang.Object obj) {
       if (obj == this) {
@@ -7719,7 +9705,6 @@ public final class Overlay {
       result = result && apiList_.equals(other.apiList_);
       result = result && (getTimestamp()
           == other.getTimestamp());
-      result = result && unknownFields.equals(other.unknownFields);
       return result;
     }
 
@@ -7729,7 +9714,7 @@ public final class Overlay {
         return memoizedHashCode;
       }
       int hash = 41;
-      hash = (19 * hash) + getDescriptor().hashCode();
+      hash = (19 * hash) + getDescriptorForType().hashCode();
       if (getApiListCount() > 0) {
         hash = (37 * hash) + API_LIST_FIELD_NUMBER;
         hash = (53 * hash) + apiList_.hashCode();
@@ -7742,17 +9727,6 @@ public final class Overlay {
       return hash;
     }
 
-    public static io.phantom.sdk.core.extend.protobuf.Overlay.ChainHello parseFrom(
-        java.nio.ByteBuffer data)
-        throws com.google.protobuf.InvalidProtocolBufferException {
-      return PARSER.parseFrom(data);
-    }
-    public static io.phantom.sdk.core.extend.protobuf.Overlay.ChainHello parseFrom(
-        java.nio.ByteBuffer data,
-        com.google.protobuf.ExtensionRegistryLite extensionRegistry)
-        throws com.google.protobuf.InvalidProtocolBufferException {
-      return PARSER.parseFrom(data, extensionRegistry);
-    }
     public static io.phantom.sdk.core.extend.protobuf.Overlay.ChainHello parseFrom(
         com.google.protobuf.ByteString data)
         throws com.google.protobuf.InvalidProtocolBufferException {
@@ -7914,7 +9888,7 @@ public final class Overlay {
       }
       public Builder setField(
           com.google.protobuf.Descriptors.FieldDescriptor field,
-          java.lang.Object value) {
+          Object value) {
         return (Builder) super.setField(field, value);
       }
       public Builder clearField(
@@ -7927,12 +9901,12 @@ public final class Overlay {
       }
       public Builder setRepeatedField(
           com.google.protobuf.Descriptors.FieldDescriptor field,
-          int index, java.lang.Object value) {
+          int index, Object value) {
         return (Builder) super.setRepeatedField(field, index, value);
       }
       public Builder addRepeatedField(
           com.google.protobuf.Descriptors.FieldDescriptor field,
-          java.lang.Object value) {
+          Object value) {
         return (Builder) super.addRepeatedField(field, value);
       }
       public Builder mergeFrom(com.google.protobuf.Message other) {
@@ -7959,7 +9933,6 @@ public final class Overlay {
         if (other.getTimestamp() != 0L) {
           setTimestamp(other.getTimestamp());
         }
-        this.mergeUnknownFields(other.unknownFields);
         onChanged();
         return this;
       }
@@ -8155,13 +10128,13 @@ public final class Overlay {
 
       private long timestamp_ ;
       /**
-       * <code>int64 timestamp = 2;</code>
+       * <code>optional int64 timestamp = 2;</code>
        */
       public long getTimestamp() {
         return timestamp_;
       }
       /**
-       * <code>int64 timestamp = 2;</code>
+       * <code>optional int64 timestamp = 2;</code>
        */
       public Builder setTimestamp(long value) {
         
@@ -8170,7 +10143,7 @@ public final class Overlay {
         return this;
       }
       /**
-       * <code>int64 timestamp = 2;</code>
+       * <code>optional int64 timestamp = 2;</code>
        */
       public Builder clearTimestamp() {
         
@@ -8180,12 +10153,12 @@ public final class Overlay {
       }
       public final Builder setUnknownFields(
           final com.google.protobuf.UnknownFieldSet unknownFields) {
-        return super.setUnknownFieldsProto3(unknownFields);
+        return this;
       }
 
       public final Builder mergeUnknownFields(
           final com.google.protobuf.UnknownFieldSet unknownFields) {
-        return super.mergeUnknownFields(unknownFields);
+        return this;
       }
 
 
@@ -8208,7 +10181,7 @@ public final class Overlay {
           com.google.protobuf.CodedInputStream input,
           com.google.protobuf.ExtensionRegistryLite extensionRegistry)
           throws com.google.protobuf.InvalidProtocolBufferException {
-        return new ChainHello(input, extensionRegistry);
+          return new ChainHello(input, extensionRegistry);
       }
     };
 
@@ -8232,37 +10205,37 @@ public final class Overlay {
       com.google.protobuf.MessageOrBuilder {
 
     /**
-     * <code>string self_addr = 1;</code>
+     * <code>optional string self_addr = 1;</code>
      */
     java.lang.String getSelfAddr();
     /**
-     * <code>string self_addr = 1;</code>
+     * <code>optional string self_addr = 1;</code>
      */
     com.google.protobuf.ByteString
         getSelfAddrBytes();
 
     /**
-     * <code>int64 ledger_version = 2;</code>
+     * <code>optional int64 ledger_version = 2;</code>
      */
     long getLedgerVersion();
 
     /**
-     * <code>int64 monitor_version = 3;</code>
+     * <code>optional int64 monitor_version = 3;</code>
      */
     long getMonitorVersion();
 
     /**
-     * <code>string phantom_version = 4;</code>
+     * <code>optional string phantom_version = 4;</code>
      */
     java.lang.String getPhantomVersion();
     /**
-     * <code>string phantom_version = 4;</code>
+     * <code>optional string phantom_version = 4;</code>
      */
     com.google.protobuf.ByteString
         getPhantomVersionBytes();
 
     /**
-     * <code>int64 timestamp = 5;</code>
+     * <code>optional int64 timestamp = 5;</code>
      */
     long getTimestamp();
   }
@@ -8278,7 +10251,6 @@ public final class Overlay {
       com.google.protobuf.GeneratedMessageV3 implements
       // @@protoc_insertion_point(message_implements:protocol.ChainStatus)
       ChainStatusOrBuilder {
-  private static final long serialVersionUID = 0L;
     // Use ChainStatus.newBuilder() to construct.
     private ChainStatus(com.google.protobuf.GeneratedMessageV3.Builder<?> builder) {
       super(builder);
@@ -8294,19 +10266,14 @@ public final class Overlay {
     @java.lang.Override
     public final com.google.protobuf.UnknownFieldSet
     getUnknownFields() {
-      return this.unknownFields;
+      return com.google.protobuf.UnknownFieldSet.getDefaultInstance();
     }
     private ChainStatus(
         com.google.protobuf.CodedInputStream input,
         com.google.protobuf.ExtensionRegistryLite extensionRegistry)
         throws com.google.protobuf.InvalidProtocolBufferException {
       this();
-      if (extensionRegistry == null) {
-        throw new java.lang.NullPointerException();
-      }
       int mutable_bitField0_ = 0;
-      com.google.protobuf.UnknownFieldSet.Builder unknownFields =
-          com.google.protobuf.UnknownFieldSet.newBuilder();
       try {
         boolean done = false;
         while (!done) {
@@ -8316,8 +10283,7 @@ public final class Overlay {
               done = true;
               break;
             default: {
-              if (!parseUnknownFieldProto3(
-                  input, unknownFields, extensionRegistry, tag)) {
+              if (!input.skipField(tag)) {
                 done = true;
               }
               break;
@@ -8357,7 +10323,6 @@ public final class Overlay {
         throw new com.google.protobuf.InvalidProtocolBufferException(
             e).setUnfinishedMessage(this);
       } finally {
-        this.unknownFields = unknownFields.build();
         makeExtensionsImmutable();
       }
     }
@@ -8376,7 +10341,7 @@ public final class Overlay {
     public static final int SELF_ADDR_FIELD_NUMBER = 1;
     private volatile java.lang.Object selfAddr_;
     /**
-     * <code>string self_addr = 1;</code>
+     * <code>optional string self_addr = 1;</code>
      */
     public java.lang.String getSelfAddr() {
       java.lang.Object ref = selfAddr_;
@@ -8391,7 +10356,7 @@ public final class Overlay {
       }
     }
     /**
-     * <code>string self_addr = 1;</code>
+     * <code>optional string self_addr = 1;</code>
      */
     public com.google.protobuf.ByteString
         getSelfAddrBytes() {
@@ -8410,7 +10375,7 @@ public final class Overlay {
     public static final int LEDGER_VERSION_FIELD_NUMBER = 2;
     private long ledgerVersion_;
     /**
-     * <code>int64 ledger_version = 2;</code>
+     * <code>optional int64 ledger_version = 2;</code>
      */
     public long getLedgerVersion() {
       return ledgerVersion_;
@@ -8419,7 +10384,7 @@ public final class Overlay {
     public static final int MONITOR_VERSION_FIELD_NUMBER = 3;
     private long monitorVersion_;
     /**
-     * <code>int64 monitor_version = 3;</code>
+     * <code>optional int64 monitor_version = 3;</code>
      */
     public long getMonitorVersion() {
       return monitorVersion_;
@@ -8428,7 +10393,7 @@ public final class Overlay {
     public static final int PHANTOM_VERSION_FIELD_NUMBER = 4;
     private volatile java.lang.Object phantomVersion_;
     /**
-     * <code>string phantom_version = 4;</code>
+     * <code>optional string phantom_version = 4;</code>
      */
     public java.lang.String getPhantomVersion() {
       java.lang.Object ref = phantomVersion_;
@@ -8443,7 +10408,7 @@ public final class Overlay {
       }
     }
     /**
-     * <code>string phantom_version = 4;</code>
+     * <code>optional string phantom_version = 4;</code>
      */
     public com.google.protobuf.ByteString
         getPhantomVersionBytes() {
@@ -8462,7 +10427,7 @@ public final class Overlay {
     public static final int TIMESTAMP_FIELD_NUMBER = 5;
     private long timestamp_;
     /**
-     * <code>int64 timestamp = 5;</code>
+     * <code>optional int64 timestamp = 5;</code>
      */
     public long getTimestamp() {
       return timestamp_;
@@ -8495,7 +10460,6 @@ public final class Overlay {
       if (timestamp_ != 0L) {
         output.writeInt64(5, timestamp_);
       }
-      unknownFields.writeTo(output);
     }
 
     public int getSerializedSize() {
@@ -8521,11 +10485,11 @@ public final class Overlay {
         size += com.google.protobuf.CodedOutputStream
           .computeInt64Size(5, timestamp_);
       }
-      size += unknownFields.getSerializedSize();
       memoizedSize = size;
       return size;
     }
 
+    private static final long serialVersionUID = 0L;
     @java.lang.Override
     public boolean equals(final java.lang.Object obj) {
       if (obj == this) {
@@ -8547,7 +10511,6 @@ public final class Overlay {
           .equals(other.getPhantomVersion());
       result = result && (getTimestamp()
           == other.getTimestamp());
-      result = result && unknownFields.equals(other.unknownFields);
       return result;
     }
 
@@ -8557,7 +10520,7 @@ public final class Overlay {
         return memoizedHashCode;
       }
       int hash = 41;
-      hash = (19 * hash) + getDescriptor().hashCode();
+      hash = (19 * hash) + getDescriptorForType().hashCode();
       hash = (37 * hash) + SELF_ADDR_FIELD_NUMBER;
       hash = (53 * hash) + getSelfAddr().hashCode();
       hash = (37 * hash) + LEDGER_VERSION_FIELD_NUMBER;
@@ -8576,17 +10539,6 @@ public final class Overlay {
       return hash;
     }
 
-    public static io.phantom.sdk.core.extend.protobuf.Overlay.ChainStatus parseFrom(
-        java.nio.ByteBuffer data)
-        throws com.google.protobuf.InvalidProtocolBufferException {
-      return PARSER.parseFrom(data);
-    }
-    public static io.phantom.sdk.core.extend.protobuf.Overlay.ChainStatus parseFrom(
-        java.nio.ByteBuffer data,
-        com.google.protobuf.ExtensionRegistryLite extensionRegistry)
-        throws com.google.protobuf.InvalidProtocolBufferException {
-      return PARSER.parseFrom(data, extensionRegistry);
-    }
     public static io.phantom.sdk.core.extend.protobuf.Overlay.ChainStatus parseFrom(
         com.google.protobuf.ByteString data)
         throws com.google.protobuf.InvalidProtocolBufferException {
@@ -8751,7 +10703,7 @@ public final class Overlay {
       }
       public Builder setField(
           com.google.protobuf.Descriptors.FieldDescriptor field,
-          java.lang.Object value) {
+          Object value) {
         return (Builder) super.setField(field, value);
       }
       public Builder clearField(
@@ -8764,12 +10716,12 @@ public final class Overlay {
       }
       public Builder setRepeatedField(
           com.google.protobuf.Descriptors.FieldDescriptor field,
-          int index, java.lang.Object value) {
+          int index, Object value) {
         return (Builder) super.setRepeatedField(field, index, value);
       }
       public Builder addRepeatedField(
           com.google.protobuf.Descriptors.FieldDescriptor field,
-          java.lang.Object value) {
+          Object value) {
         return (Builder) super.addRepeatedField(field, value);
       }
       public Builder mergeFrom(com.google.protobuf.Message other) {
@@ -8800,7 +10752,6 @@ public final class Overlay {
         if (other.getTimestamp() != 0L) {
           setTimestamp(other.getTimestamp());
         }
-        this.mergeUnknownFields(other.unknownFields);
         onChanged();
         return this;
       }
@@ -8829,7 +10780,7 @@ public final class Overlay {
 
       private java.lang.Object selfAddr_ = "";
       /**
-       * <code>string self_addr = 1;</code>
+       * <code>optional string self_addr = 1;</code>
        */
       public java.lang.String getSelfAddr() {
         java.lang.Object ref = selfAddr_;
@@ -8844,7 +10795,7 @@ public final class Overlay {
         }
       }
       /**
-       * <code>string self_addr = 1;</code>
+       * <code>optional string self_addr = 1;</code>
        */
       public com.google.protobuf.ByteString
           getSelfAddrBytes() {
@@ -8860,7 +10811,7 @@ public final class Overlay {
         }
       }
       /**
-       * <code>string self_addr = 1;</code>
+       * <code>optional string self_addr = 1;</code>
        */
       public Builder setSelfAddr(
           java.lang.String value) {
@@ -8873,7 +10824,7 @@ public final class Overlay {
         return this;
       }
       /**
-       * <code>string self_addr = 1;</code>
+       * <code>optional string self_addr = 1;</code>
        */
       public Builder clearSelfAddr() {
         
@@ -8882,7 +10833,7 @@ public final class Overlay {
         return this;
       }
       /**
-       * <code>string self_addr = 1;</code>
+       * <code>optional string self_addr = 1;</code>
        */
       public Builder setSelfAddrBytes(
           com.google.protobuf.ByteString value) {
@@ -8898,13 +10849,13 @@ public final class Overlay {
 
       private long ledgerVersion_ ;
       /**
-       * <code>int64 ledger_version = 2;</code>
+       * <code>optional int64 ledger_version = 2;</code>
        */
       public long getLedgerVersion() {
         return ledgerVersion_;
       }
       /**
-       * <code>int64 ledger_version = 2;</code>
+       * <code>optional int64 ledger_version = 2;</code>
        */
       public Builder setLedgerVersion(long value) {
         
@@ -8913,7 +10864,7 @@ public final class Overlay {
         return this;
       }
       /**
-       * <code>int64 ledger_version = 2;</code>
+       * <code>optional int64 ledger_version = 2;</code>
        */
       public Builder clearLedgerVersion() {
         
@@ -8924,13 +10875,13 @@ public final class Overlay {
 
       private long monitorVersion_ ;
       /**
-       * <code>int64 monitor_version = 3;</code>
+       * <code>optional int64 monitor_version = 3;</code>
        */
       public long getMonitorVersion() {
         return monitorVersion_;
       }
       /**
-       * <code>int64 monitor_version = 3;</code>
+       * <code>optional int64 monitor_version = 3;</code>
        */
       public Builder setMonitorVersion(long value) {
         
@@ -8939,7 +10890,7 @@ public final class Overlay {
         return this;
       }
       /**
-       * <code>int64 monitor_version = 3;</code>
+       * <code>optional int64 monitor_version = 3;</code>
        */
       public Builder clearMonitorVersion() {
         
@@ -8950,7 +10901,7 @@ public final class Overlay {
 
       private java.lang.Object phantomVersion_ = "";
       /**
-       * <code>string phantom_version = 4;</code>
+       * <code>optional string phantom_version = 4;</code>
        */
       public java.lang.String getPhantomVersion() {
         java.lang.Object ref = phantomVersion_;
@@ -8965,7 +10916,7 @@ public final class Overlay {
         }
       }
       /**
-       * <code>string phantom_version = 4;</code>
+       * <code>optional string phantom_version = 4;</code>
        */
       public com.google.protobuf.ByteString
           getPhantomVersionBytes() {
@@ -8981,7 +10932,7 @@ public final class Overlay {
         }
       }
       /**
-       * <code>string phantom_version = 4;</code>
+       * <code>optional string phantom_version = 4;</code>
        */
       public Builder setPhantomVersion(
           java.lang.String value) {
@@ -8994,7 +10945,7 @@ public final class Overlay {
         return this;
       }
       /**
-       * <code>string phantom_version = 4;</code>
+       * <code>optional string phantom_version = 4;</code>
        */
       public Builder clearPhantomVersion() {
         
@@ -9003,7 +10954,7 @@ public final class Overlay {
         return this;
       }
       /**
-       * <code>string phantom_version = 4;</code>
+       * <code>optional string phantom_version = 4;</code>
        */
       public Builder setPhantomVersionBytes(
           com.google.protobuf.ByteString value) {
@@ -9019,13 +10970,13 @@ public final class Overlay {
 
       private long timestamp_ ;
       /**
-       * <code>int64 timestamp = 5;</code>
+       * <code>optional int64 timestamp = 5;</code>
        */
       public long getTimestamp() {
         return timestamp_;
       }
       /**
-       * <code>int64 timestamp = 5;</code>
+       * <code>optional int64 timestamp = 5;</code>
        */
       public Builder setTimestamp(long value) {
         
@@ -9034,7 +10985,7 @@ public final class Overlay {
         return this;
       }
       /**
-       * <code>int64 timestamp = 5;</code>
+       * <code>optional int64 timestamp = 5;</code>
        */
       public Builder clearTimestamp() {
         
@@ -9044,12 +10995,12 @@ public final class Overlay {
       }
       public final Builder setUnknownFields(
           final com.google.protobuf.UnknownFieldSet unknownFields) {
-        return super.setUnknownFieldsProto3(unknownFields);
+        return this;
       }
 
       public final Builder mergeUnknownFields(
           final com.google.protobuf.UnknownFieldSet unknownFields) {
-        return super.mergeUnknownFields(unknownFields);
+        return this;
       }
 
 
@@ -9072,7 +11023,7 @@ public final class Overlay {
           com.google.protobuf.CodedInputStream input,
           com.google.protobuf.ExtensionRegistryLite extensionRegistry)
           throws com.google.protobuf.InvalidProtocolBufferException {
-        return new ChainStatus(input, extensionRegistry);
+          return new ChainStatus(input, extensionRegistry);
       }
     };
 
@@ -9096,11 +11047,11 @@ public final class Overlay {
       com.google.protobuf.MessageOrBuilder {
 
     /**
-     * <code>string src_peer_addr = 1;</code>
+     * <code>optional string src_peer_addr = 1;</code>
      */
     java.lang.String getSrcPeerAddr();
     /**
-     * <code>string src_peer_addr = 1;</code>
+     * <code>optional string src_peer_addr = 1;</code>
      */
     com.google.protobuf.ByteString
         getSrcPeerAddrBytes();
@@ -9125,7 +11076,7 @@ public final class Overlay {
         getDesPeerAddrsBytes(int index);
 
     /**
-     * <code>bytes data = 3;</code>
+     * <code>optional bytes data = 3;</code>
      */
     com.google.protobuf.ByteString getData();
   }
@@ -9136,7 +11087,6 @@ public final class Overlay {
       com.google.protobuf.GeneratedMessageV3 implements
       // @@protoc_insertion_point(message_implements:protocol.ChainPeerMessage)
       ChainPeerMessageOrBuilder {
-  private static final long serialVersionUID = 0L;
     // Use ChainPeerMessage.newBuilder() to construct.
     private ChainPeerMessage(com.google.protobuf.GeneratedMessageV3.Builder<?> builder) {
       super(builder);
@@ -9150,19 +11100,14 @@ public final class Overlay {
     @java.lang.Override
     public final com.google.protobuf.UnknownFieldSet
     getUnknownFields() {
-      return this.unknownFields;
+      return com.google.protobuf.UnknownFieldSet.getDefaultInstance();
     }
     private ChainPeerMessage(
         com.google.protobuf.CodedInputStream input,
         com.google.protobuf.ExtensionRegistryLite extensionRegistry)
         throws com.google.protobuf.InvalidProtocolBufferException {
       this();
-      if (extensionRegistry == null) {
-        throw new java.lang.NullPointerException();
-      }
       int mutable_bitField0_ = 0;
-      com.google.protobuf.UnknownFieldSet.Builder unknownFields =
-          com.google.protobuf.UnknownFieldSet.newBuilder();
       try {
         boolean done = false;
         while (!done) {
@@ -9172,8 +11117,7 @@ public final class Overlay {
               done = true;
               break;
             default: {
-              if (!parseUnknownFieldProto3(
-                  input, unknownFields, extensionRegistry, tag)) {
+              if (!input.skipField(tag)) {
                 done = true;
               }
               break;
@@ -9209,7 +11153,6 @@ public final class Overlay {
         if (((mutable_bitField0_ & 0x00000002) == 0x00000002)) {
           desPeerAddrs_ = desPeerAddrs_.getUnmodifiableView();
         }
-        this.unknownFields = unknownFields.build();
         makeExtensionsImmutable();
       }
     }
@@ -9229,7 +11172,7 @@ public final class Overlay {
     public static final int SRC_PEER_ADDR_FIELD_NUMBER = 1;
     private volatile java.lang.Object srcPeerAddr_;
     /**
-     * <code>string src_peer_addr = 1;</code>
+     * <code>optional string src_peer_addr = 1;</code>
      */
     public java.lang.String getSrcPeerAddr() {
       java.lang.Object ref = srcPeerAddr_;
@@ -9244,7 +11187,7 @@ public final class Overlay {
       }
     }
     /**
-     * <code>string src_peer_addr = 1;</code>
+     * <code>optional string src_peer_addr = 1;</code>
      */
     public com.google.protobuf.ByteString
         getSrcPeerAddrBytes() {
@@ -9292,7 +11235,7 @@ public final class Overlay {
     public static final int DATA_FIELD_NUMBER = 3;
     private com.google.protobuf.ByteString data_;
     /**
-     * <code>bytes data = 3;</code>
+     * <code>optional bytes data = 3;</code>
      */
     public com.google.protobuf.ByteString getData() {
       return data_;
@@ -9319,7 +11262,6 @@ public final class Overlay {
       if (!data_.isEmpty()) {
         output.writeBytes(3, data_);
       }
-      unknownFields.writeTo(output);
     }
 
     public int getSerializedSize() {
@@ -9342,11 +11284,11 @@ public final class Overlay {
         size += com.google.protobuf.CodedOutputStream
           .computeBytesSize(3, data_);
       }
-      size += unknownFields.getSerializedSize();
       memoizedSize = size;
       return size;
     }
 
+    private static final long serialVersionUID = 0L;
     @java.lang.Override
     public boolean equals(final java.lang.Object obj) {
       if (obj == this) {
@@ -9364,7 +11306,6 @@ public final class Overlay {
           .equals(other.getDesPeerAddrsList());
       result = result && getData()
           .equals(other.getData());
-      result = result && unknownFields.equals(other.unknownFields);
       return result;
     }
 
@@ -9374,7 +11315,7 @@ public final class Overlay {
         return memoizedHashCode;
       }
       int hash = 41;
-      hash = (19 * hash) + getDescriptor().hashCode();
+      hash = (19 * hash) + getDescriptorForType().hashCode();
       hash = (37 * hash) + SRC_PEER_ADDR_FIELD_NUMBER;
       hash = (53 * hash) + getSrcPeerAddr().hashCode();
       if (getDesPeerAddrsCount() > 0) {
@@ -9388,17 +11329,6 @@ public final class Overlay {
       return hash;
     }
 
-    public static io.phantom.sdk.core.extend.protobuf.Overlay.ChainPeerMessage parseFrom(
-        java.nio.ByteBuffer data)
-        throws com.google.protobuf.InvalidProtocolBufferException {
-      return PARSER.parseFrom(data);
-    }
-    public static io.phantom.sdk.core.extend.protobuf.Overlay.ChainPeerMessage parseFrom(
-        java.nio.ByteBuffer data,
-        com.google.protobuf.ExtensionRegistryLite extensionRegistry)
-        throws com.google.protobuf.InvalidProtocolBufferException {
-      return PARSER.parseFrom(data, extensionRegistry);
-    }
     public static io.phantom.sdk.core.extend.protobuf.Overlay.ChainPeerMessage parseFrom(
         com.google.protobuf.ByteString data)
         throws com.google.protobuf.InvalidProtocolBufferException {
@@ -9559,7 +11489,7 @@ public final class Overlay {
       }
       public Builder setField(
           com.google.protobuf.Descriptors.FieldDescriptor field,
-          java.lang.Object value) {
+          Object value) {
         return (Builder) super.setField(field, value);
       }
       public Builder clearField(
@@ -9572,12 +11502,12 @@ public final class Overlay {
       }
       public Builder setRepeatedField(
           com.google.protobuf.Descriptors.FieldDescriptor field,
-          int index, java.lang.Object value) {
+          int index, Object value) {
         return (Builder) super.setRepeatedField(field, index, value);
       }
       public Builder addRepeatedField(
           com.google.protobuf.Descriptors.FieldDescriptor field,
-          java.lang.Object value) {
+          Object value) {
         return (Builder) super.addRepeatedField(field, value);
       }
       public Builder mergeFrom(com.google.protobuf.Message other) {
@@ -9608,7 +11538,6 @@ public final class Overlay {
         if (other.getData() != com.google.protobuf.ByteString.EMPTY) {
           setData(other.getData());
         }
-        this.mergeUnknownFields(other.unknownFields);
         onChanged();
         return this;
       }
@@ -9638,7 +11567,7 @@ public final class Overlay {
 
       private java.lang.Object srcPeerAddr_ = "";
       /**
-       * <code>string src_peer_addr = 1;</code>
+       * <code>optional string src_peer_addr = 1;</code>
        */
       public java.lang.String getSrcPeerAddr() {
         java.lang.Object ref = srcPeerAddr_;
@@ -9653,7 +11582,7 @@ public final class Overlay {
         }
       }
       /**
-       * <code>string src_peer_addr = 1;</code>
+       * <code>optional string src_peer_addr = 1;</code>
        */
       public com.google.protobuf.ByteString
           getSrcPeerAddrBytes() {
@@ -9669,7 +11598,7 @@ public final class Overlay {
         }
       }
       /**
-       * <code>string src_peer_addr = 1;</code>
+       * <code>optional string src_peer_addr = 1;</code>
        */
       public Builder setSrcPeerAddr(
           java.lang.String value) {
@@ -9682,7 +11611,7 @@ public final class Overlay {
         return this;
       }
       /**
-       * <code>string src_peer_addr = 1;</code>
+       * <code>optional string src_peer_addr = 1;</code>
        */
       public Builder clearSrcPeerAddr() {
         
@@ -9691,7 +11620,7 @@ public final class Overlay {
         return this;
       }
       /**
-       * <code>string src_peer_addr = 1;</code>
+       * <code>optional string src_peer_addr = 1;</code>
        */
       public Builder setSrcPeerAddrBytes(
           com.google.protobuf.ByteString value) {
@@ -9801,13 +11730,13 @@ public final class Overlay {
 
       private com.google.protobuf.ByteString data_ = com.google.protobuf.ByteString.EMPTY;
       /**
-       * <code>bytes data = 3;</code>
+       * <code>optional bytes data = 3;</code>
        */
       public com.google.protobuf.ByteString getData() {
         return data_;
       }
       /**
-       * <code>bytes data = 3;</code>
+       * <code>optional bytes data = 3;</code>
        */
       public Builder setData(com.google.protobuf.ByteString value) {
         if (value == null) {
@@ -9819,7 +11748,7 @@ public final class Overlay {
         return this;
       }
       /**
-       * <code>bytes data = 3;</code>
+       * <code>optional bytes data = 3;</code>
        */
       public Builder clearData() {
         
@@ -9829,12 +11758,12 @@ public final class Overlay {
       }
       public final Builder setUnknownFields(
           final com.google.protobuf.UnknownFieldSet unknownFields) {
-        return super.setUnknownFieldsProto3(unknownFields);
+        return this;
       }
 
       public final Builder mergeUnknownFields(
           final com.google.protobuf.UnknownFieldSet unknownFields) {
-        return super.mergeUnknownFields(unknownFields);
+        return this;
       }
 
 
@@ -9857,7 +11786,7 @@ public final class Overlay {
           com.google.protobuf.CodedInputStream input,
           com.google.protobuf.ExtensionRegistryLite extensionRegistry)
           throws com.google.protobuf.InvalidProtocolBufferException {
-        return new ChainPeerMessage(input, extensionRegistry);
+          return new ChainPeerMessage(input, extensionRegistry);
       }
     };
 
@@ -9906,7 +11835,6 @@ public final class Overlay {
       com.google.protobuf.GeneratedMessageV3 implements
       // @@protoc_insertion_point(message_implements:protocol.ChainSubscribeTx)
       ChainSubscribeTxOrBuilder {
-  private static final long serialVersionUID = 0L;
     // Use ChainSubscribeTx.newBuilder() to construct.
     private ChainSubscribeTx(com.google.protobuf.GeneratedMessageV3.Builder<?> builder) {
       super(builder);
@@ -9918,19 +11846,14 @@ public final class Overlay {
     @java.lang.Override
     public final com.google.protobuf.UnknownFieldSet
     getUnknownFields() {
-      return this.unknownFields;
+      return com.google.protobuf.UnknownFieldSet.getDefaultInstance();
     }
     private ChainSubscribeTx(
         com.google.protobuf.CodedInputStream input,
         com.google.protobuf.ExtensionRegistryLite extensionRegistry)
         throws com.google.protobuf.InvalidProtocolBufferException {
       this();
-      if (extensionRegistry == null) {
-        throw new java.lang.NullPointerException();
-      }
       int mutable_bitField0_ = 0;
-      com.google.protobuf.UnknownFieldSet.Builder unknownFields =
-          com.google.protobuf.UnknownFieldSet.newBuilder();
       try {
         boolean done = false;
         while (!done) {
@@ -9940,8 +11863,7 @@ public final class Overlay {
               done = true;
               break;
             default: {
-              if (!parseUnknownFieldProto3(
-                  input, unknownFields, extensionRegistry, tag)) {
+              if (!input.skipField(tag)) {
                 done = true;
               }
               break;
@@ -9966,7 +11888,6 @@ public final class Overlay {
         if (((mutable_bitField0_ & 0x00000001) == 0x00000001)) {
           address_ = address_.getUnmodifiableView();
         }
-        this.unknownFields = unknownFields.build();
         makeExtensionsImmutable();
       }
     }
@@ -10026,7 +11947,6 @@ public final class Overlay {
       for (int i = 0; i < address_.size(); i++) {
         com.google.protobuf.GeneratedMessageV3.writeString(output, 1, address_.getRaw(i));
       }
-      unknownFields.writeTo(output);
     }
 
     public int getSerializedSize() {
@@ -10042,11 +11962,11 @@ public final class Overlay {
         size += dataSize;
         size += 1 * getAddressList().size();
       }
-      size += unknownFields.getSerializedSize();
       memoizedSize = size;
       return size;
     }
 
+    private static final long serialVersionUID = 0L;
     @java.lang.Override
     public boolean equals(final java.lang.Object obj) {
       if (obj == this) {
@@ -10060,7 +11980,6 @@ public final class Overlay {
       boolean result = true;
       result = result && getAddressList()
           .equals(other.getAddressList());
-      result = result && unknownFields.equals(other.unknownFields);
       return result;
     }
 
@@ -10070,7 +11989,7 @@ public final class Overlay {
         return memoizedHashCode;
       }
       int hash = 41;
-      hash = (19 * hash) + getDescriptor().hashCode();
+      hash = (19 * hash) + getDescriptorForType().hashCode();
       if (getAddressCount() > 0) {
         hash = (37 * hash) + ADDRESS_FIELD_NUMBER;
         hash = (53 * hash) + getAddressList().hashCode();
@@ -10080,17 +11999,6 @@ public final class Overlay {
       return hash;
     }
 
-    public static io.phantom.sdk.core.extend.protobuf.Overlay.ChainSubscribeTx parseFrom(
-        java.nio.ByteBuffer data)
-        throws com.google.protobuf.InvalidProtocolBufferException {
-      return PARSER.parseFrom(data);
-    }
-    public static io.phantom.sdk.core.extend.protobuf.Overlay.ChainSubscribeTx parseFrom(
-        java.nio.ByteBuffer data,
-        com.google.protobuf.ExtensionRegistryLite extensionRegistry)
-        throws com.google.protobuf.InvalidProtocolBufferException {
-      return PARSER.parseFrom(data, extensionRegistry);
-    }
     public static io.phantom.sdk.core.extend.protobuf.Overlay.ChainSubscribeTx parseFrom(
         com.google.protobuf.ByteString data)
         throws com.google.protobuf.InvalidProtocolBufferException {
@@ -10243,7 +12151,7 @@ public final class Overlay {
       }
       public Builder setField(
           com.google.protobuf.Descriptors.FieldDescriptor field,
-          java.lang.Object value) {
+          Object value) {
         return (Builder) super.setField(field, value);
       }
       public Builder clearField(
@@ -10256,12 +12164,12 @@ public final class Overlay {
       }
       public Builder setRepeatedField(
           com.google.protobuf.Descriptors.FieldDescriptor field,
-          int index, java.lang.Object value) {
+          int index, Object value) {
         return (Builder) super.setRepeatedField(field, index, value);
       }
       public Builder addRepeatedField(
           com.google.protobuf.Descriptors.FieldDescriptor field,
-          java.lang.Object value) {
+          Object value) {
         return (Builder) super.addRepeatedField(field, value);
       }
       public Builder mergeFrom(com.google.protobuf.Message other) {
@@ -10285,7 +12193,6 @@ public final class Overlay {
           }
           onChanged();
         }
-        this.mergeUnknownFields(other.unknownFields);
         onChanged();
         return this;
       }
@@ -10408,12 +12315,12 @@ public final class Overlay {
       }
       public final Builder setUnknownFields(
           final com.google.protobuf.UnknownFieldSet unknownFields) {
-        return super.setUnknownFieldsProto3(unknownFields);
+        return this;
       }
 
       public final Builder mergeUnknownFields(
           final com.google.protobuf.UnknownFieldSet unknownFields) {
-        return super.mergeUnknownFields(unknownFields);
+        return this;
       }
 
 
@@ -10436,7 +12343,7 @@ public final class Overlay {
           com.google.protobuf.CodedInputStream input,
           com.google.protobuf.ExtensionRegistryLite extensionRegistry)
           throws com.google.protobuf.InvalidProtocolBufferException {
-        return new ChainSubscribeTx(input, extensionRegistry);
+          return new ChainSubscribeTx(input, extensionRegistry);
       }
     };
 
@@ -10460,16 +12367,16 @@ public final class Overlay {
       com.google.protobuf.MessageOrBuilder {
 
     /**
-     * <code>int32 error_code = 1;</code>
+     * <code>optional int32 error_code = 1;</code>
      */
     int getErrorCode();
 
     /**
-     * <code>string error_desc = 2;</code>
+     * <code>optional string error_desc = 2;</code>
      */
     java.lang.String getErrorDesc();
     /**
-     * <code>string error_desc = 2;</code>
+     * <code>optional string error_desc = 2;</code>
      */
     com.google.protobuf.ByteString
         getErrorDescBytes();
@@ -10481,7 +12388,6 @@ public final class Overlay {
       com.google.protobuf.GeneratedMessageV3 implements
       // @@protoc_insertion_point(message_implements:protocol.ChainResponse)
       ChainResponseOrBuilder {
-  private static final long serialVersionUID = 0L;
     // Use ChainResponse.newBuilder() to construct.
     private ChainResponse(com.google.protobuf.GeneratedMessageV3.Builder<?> builder) {
       super(builder);
@@ -10494,19 +12400,14 @@ public final class Overlay {
     @java.lang.Override
     public final com.google.protobuf.UnknownFieldSet
     getUnknownFields() {
-      return this.unknownFields;
+      return com.google.protobuf.UnknownFieldSet.getDefaultInstance();
     }
     private ChainResponse(
         com.google.protobuf.CodedInputStream input,
         com.google.protobuf.ExtensionRegistryLite extensionRegistry)
         throws com.google.protobuf.InvalidProtocolBufferException {
       this();
-      if (extensionRegistry == null) {
-        throw new java.lang.NullPointerException();
-      }
       int mutable_bitField0_ = 0;
-      com.google.protobuf.UnknownFieldSet.Builder unknownFields =
-          com.google.protobuf.UnknownFieldSet.newBuilder();
       try {
         boolean done = false;
         while (!done) {
@@ -10516,8 +12417,7 @@ public final class Overlay {
               done = true;
               break;
             default: {
-              if (!parseUnknownFieldProto3(
-                  input, unknownFields, extensionRegistry, tag)) {
+              if (!input.skipField(tag)) {
                 done = true;
               }
               break;
@@ -10541,7 +12441,6 @@ public final class Overlay {
         throw new com.google.protobuf.InvalidProtocolBufferException(
             e).setUnfinishedMessage(this);
       } finally {
-        this.unknownFields = unknownFields.build();
         makeExtensionsImmutable();
       }
     }
@@ -10560,7 +12459,7 @@ public final class Overlay {
     public static final int ERROR_CODE_FIELD_NUMBER = 1;
     private int errorCode_;
     /**
-     * <code>int32 error_code = 1;</code>
+     * <code>optional int32 error_code = 1;</code>
      */
     public int getErrorCode() {
       return errorCode_;
@@ -10569,7 +12468,7 @@ public final class Overlay {
     public static final int ERROR_DESC_FIELD_NUMBER = 2;
     private volatile java.lang.Object errorDesc_;
     /**
-     * <code>string error_desc = 2;</code>
+     * <code>optional string error_desc = 2;</code>
      */
     public java.lang.String getErrorDesc() {
       java.lang.Object ref = errorDesc_;
@@ -10584,7 +12483,7 @@ public final class Overlay {
       }
     }
     /**
-     * <code>string error_desc = 2;</code>
+     * <code>optional string error_desc = 2;</code>
      */
     public com.google.protobuf.ByteString
         getErrorDescBytes() {
@@ -10618,7 +12517,6 @@ public final class Overlay {
       if (!getErrorDescBytes().isEmpty()) {
         com.google.protobuf.GeneratedMessageV3.writeString(output, 2, errorDesc_);
       }
-      unknownFields.writeTo(output);
     }
 
     public int getSerializedSize() {
@@ -10633,11 +12531,11 @@ public final class Overlay {
       if (!getErrorDescBytes().isEmpty()) {
         size += com.google.protobuf.GeneratedMessageV3.computeStringSize(2, errorDesc_);
       }
-      size += unknownFields.getSerializedSize();
       memoizedSize = size;
       return size;
     }
 
+    private static final long serialVersionUID = 0L;
     @java.lang.Override
     public boolean equals(final java.lang.Object obj) {
       if (obj == this) {
@@ -10653,7 +12551,6 @@ public final class Overlay {
           == other.getErrorCode());
       result = result && getErrorDesc()
           .equals(other.getErrorDesc());
-      result = result && unknownFields.equals(other.unknownFields);
       return result;
     }
 
@@ -10663,7 +12560,7 @@ public final class Overlay {
         return memoizedHashCode;
       }
       int hash = 41;
-      hash = (19 * hash) + getDescriptor().hashCode();
+      hash = (19 * hash) + getDescriptorForType().hashCode();
       hash = (37 * hash) + ERROR_CODE_FIELD_NUMBER;
       hash = (53 * hash) + getErrorCode();
       hash = (37 * hash) + ERROR_DESC_FIELD_NUMBER;
@@ -10673,17 +12570,6 @@ public final class Overlay {
       return hash;
     }
 
-    public static io.phantom.sdk.core.extend.protobuf.Overlay.ChainResponse parseFrom(
-        java.nio.ByteBuffer data)
-        throws com.google.protobuf.InvalidProtocolBufferException {
-      return PARSER.parseFrom(data);
-    }
-    public static io.phantom.sdk.core.extend.protobuf.Overlay.ChainResponse parseFrom(
-        java.nio.ByteBuffer data,
-        com.google.protobuf.ExtensionRegistryLite extensionRegistry)
-        throws com.google.protobuf.InvalidProtocolBufferException {
-      return PARSER.parseFrom(data, extensionRegistry);
-    }
     public static io.phantom.sdk.core.extend.protobuf.Overlay.ChainResponse parseFrom(
         com.google.protobuf.ByteString data)
         throws com.google.protobuf.InvalidProtocolBufferException {
@@ -10834,7 +12720,7 @@ public final class Overlay {
       }
       public Builder setField(
           com.google.protobuf.Descriptors.FieldDescriptor field,
-          java.lang.Object value) {
+          Object value) {
         return (Builder) super.setField(field, value);
       }
       public Builder clearField(
@@ -10847,12 +12733,12 @@ public final class Overlay {
       }
       public Builder setRepeatedField(
           com.google.protobuf.Descriptors.FieldDescriptor field,
-          int index, java.lang.Object value) {
+          int index, Object value) {
         return (Builder) super.setRepeatedField(field, index, value);
       }
       public Builder addRepeatedField(
           com.google.protobuf.Descriptors.FieldDescriptor field,
-          java.lang.Object value) {
+          Object value) {
         return (Builder) super.addRepeatedField(field, value);
       }
       public Builder mergeFrom(com.google.protobuf.Message other) {
@@ -10873,7 +12759,6 @@ public final class Overlay {
           errorDesc_ = other.errorDesc_;
           onChanged();
         }
-        this.mergeUnknownFields(other.unknownFields);
         onChanged();
         return this;
       }
@@ -10902,13 +12787,13 @@ public final class Overlay {
 
       private int errorCode_ ;
       /**
-       * <code>int32 error_code = 1;</code>
+       * <code>optional int32 error_code = 1;</code>
        */
       public int getErrorCode() {
         return errorCode_;
       }
       /**
-       * <code>int32 error_code = 1;</code>
+       * <code>optional int32 error_code = 1;</code>
        */
       public Builder setErrorCode(int value) {
         
@@ -10917,7 +12802,7 @@ public final class Overlay {
         return this;
       }
       /**
-       * <code>int32 error_code = 1;</code>
+       * <code>optional int32 error_code = 1;</code>
        */
       public Builder clearErrorCode() {
         
@@ -10928,7 +12813,7 @@ public final class Overlay {
 
       private java.lang.Object errorDesc_ = "";
       /**
-       * <code>string error_desc = 2;</code>
+       * <code>optional string error_desc = 2;</code>
        */
       public java.lang.String getErrorDesc() {
         java.lang.Object ref = errorDesc_;
@@ -10943,7 +12828,7 @@ public final class Overlay {
         }
       }
       /**
-       * <code>string error_desc = 2;</code>
+       * <code>optional string error_desc = 2;</code>
        */
       public com.google.protobuf.ByteString
           getErrorDescBytes() {
@@ -10959,7 +12844,7 @@ public final class Overlay {
         }
       }
       /**
-       * <code>string error_desc = 2;</code>
+       * <code>optional string error_desc = 2;</code>
        */
       public Builder setErrorDesc(
           java.lang.String value) {
@@ -10972,7 +12857,7 @@ public final class Overlay {
         return this;
       }
       /**
-       * <code>string error_desc = 2;</code>
+       * <code>optional string error_desc = 2;</code>
        */
       public Builder clearErrorDesc() {
         
@@ -10981,7 +12866,7 @@ public final class Overlay {
         return this;
       }
       /**
-       * <code>string error_desc = 2;</code>
+       * <code>optional string error_desc = 2;</code>
        */
       public Builder setErrorDescBytes(
           com.google.protobuf.ByteString value) {
@@ -10996,12 +12881,12 @@ public final class Overlay {
       }
       public final Builder setUnknownFields(
           final com.google.protobuf.UnknownFieldSet unknownFields) {
-        return super.setUnknownFieldsProto3(unknownFields);
+        return this;
       }
 
       public final Builder mergeUnknownFields(
           final com.google.protobuf.UnknownFieldSet unknownFields) {
-        return super.mergeUnknownFields(unknownFields);
+        return this;
       }
 
 
@@ -11024,7 +12909,7 @@ public final class Overlay {
           com.google.protobuf.CodedInputStream input,
           com.google.protobuf.ExtensionRegistryLite extensionRegistry)
           throws com.google.protobuf.InvalidProtocolBufferException {
-        return new ChainResponse(input, extensionRegistry);
+          return new ChainResponse(input, extensionRegistry);
       }
     };
 
@@ -11048,36 +12933,36 @@ public final class Overlay {
       com.google.protobuf.MessageOrBuilder {
 
     /**
-     * <code>.protocol.ChainTxStatus.TxStatus status = 1;</code>
+     * <code>optional .protocol.ChainTxStatus.TxStatus status = 1;</code>
      */
     int getStatusValue();
     /**
-     * <code>.protocol.ChainTxStatus.TxStatus status = 1;</code>
+     * <code>optional .protocol.ChainTxStatus.TxStatus status = 1;</code>
      */
     io.phantom.sdk.core.extend.protobuf.Overlay.ChainTxStatus.TxStatus getStatus();
 
     /**
-     * <code>string tx_hash = 2;</code>
+     * <code>optional string tx_hash = 2;</code>
      */
     java.lang.String getTxHash();
     /**
-     * <code>string tx_hash = 2;</code>
+     * <code>optional string tx_hash = 2;</code>
      */
     com.google.protobuf.ByteString
         getTxHashBytes();
 
     /**
-     * <code>string source_address = 3;</code>
+     * <code>optional string source_address = 3;</code>
      */
     java.lang.String getSourceAddress();
     /**
-     * <code>string source_address = 3;</code>
+     * <code>optional string source_address = 3;</code>
      */
     com.google.protobuf.ByteString
         getSourceAddressBytes();
 
     /**
-     * <code>int64 source_account_seq = 4;</code>
+     * <code>optional int64 source_account_seq = 4;</code>
      */
     long getSourceAccountSeq();
 
@@ -11086,7 +12971,7 @@ public final class Overlay {
      *on which block this tx records
      * </pre>
      *
-     * <code>int64 ledger_seq = 5;</code>
+     * <code>optional int64 ledger_seq = 5;</code>
      */
     long getLedgerSeq();
 
@@ -11095,7 +12980,7 @@ public final class Overlay {
      *new account sequence if COMPLETE
      * </pre>
      *
-     * <code>int64 new_account_seq = 6;</code>
+     * <code>optional int64 new_account_seq = 6;</code>
      */
     long getNewAccountSeq();
 
@@ -11104,7 +12989,7 @@ public final class Overlay {
      *use it if FAIL
      * </pre>
      *
-     * <code>.protocol.ERRORCODE error_code = 7;</code>
+     * <code>optional .protocol.ERRORCODE error_code = 7;</code>
      */
     int getErrorCodeValue();
     /**
@@ -11112,7 +12997,7 @@ public final class Overlay {
      *use it if FAIL
      * </pre>
      *
-     * <code>.protocol.ERRORCODE error_code = 7;</code>
+     * <code>optional .protocol.ERRORCODE error_code = 7;</code>
      */
     io.phantom.sdk.core.extend.protobuf.Common.ERRORCODE getErrorCode();
 
@@ -11121,7 +13006,7 @@ public final class Overlay {
      *error desc
      * </pre>
      *
-     * <code>string error_desc = 8;</code>
+     * <code>optional string error_desc = 8;</code>
      */
     java.lang.String getErrorDesc();
     /**
@@ -11129,13 +13014,13 @@ public final class Overlay {
      *error desc
      * </pre>
      *
-     * <code>string error_desc = 8;</code>
+     * <code>optional string error_desc = 8;</code>
      */
     com.google.protobuf.ByteString
         getErrorDescBytes();
 
     /**
-     * <code>int64 timestamp = 9;</code>
+     * <code>optional int64 timestamp = 9;</code>
      */
     long getTimestamp();
   }
@@ -11146,7 +13031,6 @@ public final class Overlay {
       com.google.protobuf.GeneratedMessageV3 implements
       // @@protoc_insertion_point(message_implements:protocol.ChainTxStatus)
       ChainTxStatusOrBuilder {
-  private static final long serialVersionUID = 0L;
     // Use ChainTxStatus.newBuilder() to construct.
     private ChainTxStatus(com.google.protobuf.GeneratedMessageV3.Builder<?> builder) {
       super(builder);
@@ -11166,19 +13050,14 @@ public final class Overlay {
     @java.lang.Override
     public final com.google.protobuf.UnknownFieldSet
     getUnknownFields() {
-      return this.unknownFields;
+      return com.google.protobuf.UnknownFieldSet.getDefaultInstance();
     }
     private ChainTxStatus(
         com.google.protobuf.CodedInputStream input,
         com.google.protobuf.ExtensionRegistryLite extensionRegistry)
         throws com.google.protobuf.InvalidProtocolBufferException {
       this();
-      if (extensionRegistry == null) {
-        throw new java.lang.NullPointerException();
-      }
       int mutable_bitField0_ = 0;
-      com.google.protobuf.UnknownFieldSet.Builder unknownFields =
-          com.google.protobuf.UnknownFieldSet.newBuilder();
       try {
         boolean done = false;
         while (!done) {
@@ -11188,8 +13067,7 @@ public final class Overlay {
               done = true;
               break;
             default: {
-              if (!parseUnknownFieldProto3(
-                  input, unknownFields, extensionRegistry, tag)) {
+              if (!input.skipField(tag)) {
                 done = true;
               }
               break;
@@ -11252,7 +13130,6 @@ public final class Overlay {
         throw new com.google.protobuf.InvalidProtocolBufferException(
             e).setUnfinishedMessage(this);
       } finally {
-        this.unknownFields = unknownFields.build();
         makeExtensionsImmutable();
       }
     }
@@ -11428,13 +13305,13 @@ public final class Overlay {
     public static final int STATUS_FIELD_NUMBER = 1;
     private int status_;
     /**
-     * <code>.protocol.ChainTxStatus.TxStatus status = 1;</code>
+     * <code>optional .protocol.ChainTxStatus.TxStatus status = 1;</code>
      */
     public int getStatusValue() {
       return status_;
     }
     /**
-     * <code>.protocol.ChainTxStatus.TxStatus status = 1;</code>
+     * <code>optional .protocol.ChainTxStatus.TxStatus status = 1;</code>
      */
     public io.phantom.sdk.core.extend.protobuf.Overlay.ChainTxStatus.TxStatus getStatus() {
       io.phantom.sdk.core.extend.protobuf.Overlay.ChainTxStatus.TxStatus result = io.phantom.sdk.core.extend.protobuf.Overlay.ChainTxStatus.TxStatus.valueOf(status_);
@@ -11444,7 +13321,7 @@ public final class Overlay {
     public static final int TX_HASH_FIELD_NUMBER = 2;
     private volatile java.lang.Object txHash_;
     /**
-     * <code>string tx_hash = 2;</code>
+     * <code>optional string tx_hash = 2;</code>
      */
     public java.lang.String getTxHash() {
       java.lang.Object ref = txHash_;
@@ -11459,7 +13336,7 @@ public final class Overlay {
       }
     }
     /**
-     * <code>string tx_hash = 2;</code>
+     * <code>optional string tx_hash = 2;</code>
      */
     public com.google.protobuf.ByteString
         getTxHashBytes() {
@@ -11478,7 +13355,7 @@ public final class Overlay {
     public static final int SOURCE_ADDRESS_FIELD_NUMBER = 3;
     private volatile java.lang.Object sourceAddress_;
     /**
-     * <code>string source_address = 3;</code>
+     * <code>optional string source_address = 3;</code>
      */
     public java.lang.String getSourceAddress() {
       java.lang.Object ref = sourceAddress_;
@@ -11493,7 +13370,7 @@ public final class Overlay {
       }
     }
     /**
-     * <code>string source_address = 3;</code>
+     * <code>optional string source_address = 3;</code>
      */
     public com.google.protobuf.ByteString
         getSourceAddressBytes() {
@@ -11512,7 +13389,7 @@ public final class Overlay {
     public static final int SOURCE_ACCOUNT_SEQ_FIELD_NUMBER = 4;
     private long sourceAccountSeq_;
     /**
-     * <code>int64 source_account_seq = 4;</code>
+     * <code>optional int64 source_account_seq = 4;</code>
      */
     public long getSourceAccountSeq() {
       return sourceAccountSeq_;
@@ -11525,7 +13402,7 @@ public final class Overlay {
      *on which block this tx records
      * </pre>
      *
-     * <code>int64 ledger_seq = 5;</code>
+     * <code>optional int64 ledger_seq = 5;</code>
      */
     public long getLedgerSeq() {
       return ledgerSeq_;
@@ -11538,7 +13415,7 @@ public final class Overlay {
      *new account sequence if COMPLETE
      * </pre>
      *
-     * <code>int64 new_account_seq = 6;</code>
+     * <code>optional int64 new_account_seq = 6;</code>
      */
     public long getNewAccountSeq() {
       return newAccountSeq_;
@@ -11551,7 +13428,7 @@ public final class Overlay {
      *use it if FAIL
      * </pre>
      *
-     * <code>.protocol.ERRORCODE error_code = 7;</code>
+     * <code>optional .protocol.ERRORCODE error_code = 7;</code>
      */
     public int getErrorCodeValue() {
       return errorCode_;
@@ -11561,7 +13438,7 @@ public final class Overlay {
      *use it if FAIL
      * </pre>
      *
-     * <code>.protocol.ERRORCODE error_code = 7;</code>
+     * <code>optional .protocol.ERRORCODE error_code = 7;</code>
      */
     public io.phantom.sdk.core.extend.protobuf.Common.ERRORCODE getErrorCode() {
       io.phantom.sdk.core.extend.protobuf.Common.ERRORCODE result = io.phantom.sdk.core.extend.protobuf.Common.ERRORCODE.valueOf(errorCode_);
@@ -11575,7 +13452,7 @@ public final class Overlay {
      *error desc
      * </pre>
      *
-     * <code>string error_desc = 8;</code>
+     * <code>optional string error_desc = 8;</code>
      */
     public java.lang.String getErrorDesc() {
       java.lang.Object ref = errorDesc_;
@@ -11594,7 +13471,7 @@ public final class Overlay {
      *error desc
      * </pre>
      *
-     * <code>string error_desc = 8;</code>
+     * <code>optional string error_desc = 8;</code>
      */
     public com.google.protobuf.ByteString
         getErrorDescBytes() {
@@ -11613,7 +13490,7 @@ public final class Overlay {
     public static final int TIMESTAMP_FIELD_NUMBER = 9;
     private long timestamp_;
     /**
-     * <code>int64 timestamp = 9;</code>
+     * <code>optional int64 timestamp = 9;</code>
      */
     public long getTimestamp() {
       return timestamp_;
@@ -11658,7 +13535,6 @@ public final class Overlay {
       if (timestamp_ != 0L) {
         output.writeInt64(9, timestamp_);
       }
-      unknownFields.writeTo(output);
     }
 
     public int getSerializedSize() {
@@ -11699,11 +13575,11 @@ public final class Overlay {
         size += com.google.protobuf.CodedOutputStream
           .computeInt64Size(9, timestamp_);
       }
-      size += unknownFields.getSerializedSize();
       memoizedSize = size;
       return size;
     }
 
+    private static final long serialVersionUID = 0L;
     @java.lang.Override
     public boolean equals(final java.lang.Object obj) {
       if (obj == this) {
@@ -11731,7 +13607,6 @@ public final class Overlay {
           .equals(other.getErrorDesc());
       result = result && (getTimestamp()
           == other.getTimestamp());
-      result = result && unknownFields.equals(other.unknownFields);
       return result;
     }
 
@@ -11741,7 +13616,7 @@ public final class Overlay {
         return memoizedHashCode;
       }
       int hash = 41;
-      hash = (19 * hash) + getDescriptor().hashCode();
+      hash = (19 * hash) + getDescriptorForType().hashCode();
       hash = (37 * hash) + STATUS_FIELD_NUMBER;
       hash = (53 * hash) + status_;
       hash = (37 * hash) + TX_HASH_FIELD_NUMBER;
@@ -11769,17 +13644,6 @@ public final class Overlay {
       return hash;
     }
 
-    public static io.phantom.sdk.core.extend.protobuf.Overlay.ChainTxStatus parseFrom(
-        java.nio.ByteBuffer data)
-        throws com.google.protobuf.InvalidProtocolBufferException {
-      return PARSER.parseFrom(data);
-    }
-    public static io.phantom.sdk.core.extend.protobuf.Overlay.ChainTxStatus parseFrom(
-        java.nio.ByteBuffer data,
-        com.google.protobuf.ExtensionRegistryLite extensionRegistry)
-        throws com.google.protobuf.InvalidProtocolBufferException {
-      return PARSER.parseFrom(data, extensionRegistry);
-    }
     public static io.phantom.sdk.core.extend.protobuf.Overlay.ChainTxStatus parseFrom(
         com.google.protobuf.ByteString data)
         throws com.google.protobuf.InvalidProtocolBufferException {
@@ -11951,7 +13815,7 @@ public final class Overlay {
       }
       public Builder setField(
           com.google.protobuf.Descriptors.FieldDescriptor field,
-          java.lang.Object value) {
+          Object value) {
         return (Builder) super.setField(field, value);
       }
       public Builder clearField(
@@ -11964,12 +13828,12 @@ public final class Overlay {
       }
       public Builder setRepeatedField(
           com.google.protobuf.Descriptors.FieldDescriptor field,
-          int index, java.lang.Object value) {
+          int index, Object value) {
         return (Builder) super.setRepeatedField(field, index, value);
       }
       public Builder addRepeatedField(
           com.google.protobuf.Descriptors.FieldDescriptor field,
-          java.lang.Object value) {
+          Object value) {
         return (Builder) super.addRepeatedField(field, value);
       }
       public Builder mergeFrom(com.google.protobuf.Message other) {
@@ -12013,7 +13877,6 @@ public final class Overlay {
         if (other.getTimestamp() != 0L) {
           setTimestamp(other.getTimestamp());
         }
-        this.mergeUnknownFields(other.unknownFields);
         onChanged();
         return this;
       }
@@ -12042,13 +13905,13 @@ public final class Overlay {
 
       private int status_ = 0;
       /**
-       * <code>.protocol.ChainTxStatus.TxStatus status = 1;</code>
+       * <code>optional .protocol.ChainTxStatus.TxStatus status = 1;</code>
        */
       public int getStatusValue() {
         return status_;
       }
       /**
-       * <code>.protocol.ChainTxStatus.TxStatus status = 1;</code>
+       * <code>optional .protocol.ChainTxStatus.TxStatus status = 1;</code>
        */
       public Builder setStatusValue(int value) {
         status_ = value;
@@ -12056,14 +13919,14 @@ public final class Overlay {
         return this;
       }
       /**
-       * <code>.protocol.ChainTxStatus.TxStatus status = 1;</code>
+       * <code>optional .protocol.ChainTxStatus.TxStatus status = 1;</code>
        */
       public io.phantom.sdk.core.extend.protobuf.Overlay.ChainTxStatus.TxStatus getStatus() {
         io.phantom.sdk.core.extend.protobuf.Overlay.ChainTxStatus.TxStatus result = io.phantom.sdk.core.extend.protobuf.Overlay.ChainTxStatus.TxStatus.valueOf(status_);
         return result == null ? io.phantom.sdk.core.extend.protobuf.Overlay.ChainTxStatus.TxStatus.UNRECOGNIZED : result;
       }
       /**
-       * <code>.protocol.ChainTxStatus.TxStatus status = 1;</code>
+       * <code>optional .protocol.ChainTxStatus.TxStatus status = 1;</code>
        */
       public Builder setStatus(io.phantom.sdk.core.extend.protobuf.Overlay.ChainTxStatus.TxStatus value) {
         if (value == null) {
@@ -12075,7 +13938,7 @@ public final class Overlay {
         return this;
       }
       /**
-       * <code>.protocol.ChainTxStatus.TxStatus status = 1;</code>
+       * <code>optional .protocol.ChainTxStatus.TxStatus status = 1;</code>
        */
       public Builder clearStatus() {
         
@@ -12086,7 +13949,7 @@ public final class Overlay {
 
       private java.lang.Object txHash_ = "";
       /**
-       * <code>string tx_hash = 2;</code>
+       * <code>optional string tx_hash = 2;</code>
        */
       public java.lang.String getTxHash() {
         java.lang.Object ref = txHash_;
@@ -12101,7 +13964,7 @@ public final class Overlay {
         }
       }
       /**
-       * <code>string tx_hash = 2;</code>
+       * <code>optional string tx_hash = 2;</code>
        */
       public com.google.protobuf.ByteString
           getTxHashBytes() {
@@ -12117,7 +13980,7 @@ public final class Overlay {
         }
       }
       /**
-       * <code>string tx_hash = 2;</code>
+       * <code>optional string tx_hash = 2;</code>
        */
       public Builder setTxHash(
           java.lang.String value) {
@@ -12130,7 +13993,7 @@ public final class Overlay {
         return this;
       }
       /**
-       * <code>string tx_hash = 2;</code>
+       * <code>optional string tx_hash = 2;</code>
        */
       public Builder clearTxHash() {
         
@@ -12139,7 +14002,7 @@ public final class Overlay {
         return this;
       }
       /**
-       * <code>string tx_hash = 2;</code>
+       * <code>optional string tx_hash = 2;</code>
        */
       public Builder setTxHashBytes(
           com.google.protobuf.ByteString value) {
@@ -12155,7 +14018,7 @@ public final class Overlay {
 
       private java.lang.Object sourceAddress_ = "";
       /**
-       * <code>string source_address = 3;</code>
+       * <code>optional string source_address = 3;</code>
        */
       public java.lang.String getSourceAddress() {
         java.lang.Object ref = sourceAddress_;
@@ -12170,7 +14033,7 @@ public final class Overlay {
         }
       }
       /**
-       * <code>string source_address = 3;</code>
+       * <code>optional string source_address = 3;</code>
        */
       public com.google.protobuf.ByteString
           getSourceAddressBytes() {
@@ -12186,7 +14049,7 @@ public final class Overlay {
         }
       }
       /**
-       * <code>string source_address = 3;</code>
+       * <code>optional string source_address = 3;</code>
        */
       public Builder setSourceAddress(
           java.lang.String value) {
@@ -12199,7 +14062,7 @@ public final class Overlay {
         return this;
       }
       /**
-       * <code>string source_address = 3;</code>
+       * <code>optional string source_address = 3;</code>
        */
       public Builder clearSourceAddress() {
         
@@ -12208,7 +14071,7 @@ public final class Overlay {
         return this;
       }
       /**
-       * <code>string source_address = 3;</code>
+       * <code>optional string source_address = 3;</code>
        */
       public Builder setSourceAddressBytes(
           com.google.protobuf.ByteString value) {
@@ -12224,13 +14087,13 @@ public final class Overlay {
 
       private long sourceAccountSeq_ ;
       /**
-       * <code>int64 source_account_seq = 4;</code>
+       * <code>optional int64 source_account_seq = 4;</code>
        */
       public long getSourceAccountSeq() {
         return sourceAccountSeq_;
       }
       /**
-       * <code>int64 source_account_seq = 4;</code>
+       * <code>optional int64 source_account_seq = 4;</code>
        */
       public Builder setSourceAccountSeq(long value) {
         
@@ -12239,7 +14102,7 @@ public final class Overlay {
         return this;
       }
       /**
-       * <code>int64 source_account_seq = 4;</code>
+       * <code>optional int64 source_account_seq = 4;</code>
        */
       public Builder clearSourceAccountSeq() {
         
@@ -12254,7 +14117,7 @@ public final class Overlay {
        *on which block this tx records
        * </pre>
        *
-       * <code>int64 ledger_seq = 5;</code>
+       * <code>optional int64 ledger_seq = 5;</code>
        */
       public long getLedgerSeq() {
         return ledgerSeq_;
@@ -12264,7 +14127,7 @@ public final class Overlay {
        *on which block this tx records
        * </pre>
        *
-       * <code>int64 ledger_seq = 5;</code>
+       * <code>optional int64 ledger_seq = 5;</code>
        */
       public Builder setLedgerSeq(long value) {
         
@@ -12277,7 +14140,7 @@ public final class Overlay {
        *on which block this tx records
        * </pre>
        *
-       * <code>int64 ledger_seq = 5;</code>
+       * <code>optional int64 ledger_seq = 5;</code>
        */
       public Builder clearLedgerSeq() {
         
@@ -12292,7 +14155,7 @@ public final class Overlay {
        *new account sequence if COMPLETE
        * </pre>
        *
-       * <code>int64 new_account_seq = 6;</code>
+       * <code>optional int64 new_account_seq = 6;</code>
        */
       public long getNewAccountSeq() {
         return newAccountSeq_;
@@ -12302,7 +14165,7 @@ public final class Overlay {
        *new account sequence if COMPLETE
        * </pre>
        *
-       * <code>int64 new_account_seq = 6;</code>
+       * <code>optional int64 new_account_seq = 6;</code>
        */
       public Builder setNewAccountSeq(long value) {
         
@@ -12315,7 +14178,7 @@ public final class Overlay {
        *new account sequence if COMPLETE
        * </pre>
        *
-       * <code>int64 new_account_seq = 6;</code>
+       * <code>optional int64 new_account_seq = 6;</code>
        */
       public Builder clearNewAccountSeq() {
         
@@ -12330,7 +14193,7 @@ public final class Overlay {
        *use it if FAIL
        * </pre>
        *
-       * <code>.protocol.ERRORCODE error_code = 7;</code>
+       * <code>optional .protocol.ERRORCODE error_code = 7;</code>
        */
       public int getErrorCodeValue() {
         return errorCode_;
@@ -12340,7 +14203,7 @@ public final class Overlay {
        *use it if FAIL
        * </pre>
        *
-       * <code>.protocol.ERRORCODE error_code = 7;</code>
+       * <code>optional .protocol.ERRORCODE error_code = 7;</code>
        */
       public Builder setErrorCodeValue(int value) {
         errorCode_ = value;
@@ -12352,7 +14215,7 @@ public final class Overlay {
        *use it if FAIL
        * </pre>
        *
-       * <code>.protocol.ERRORCODE error_code = 7;</code>
+       * <code>optional .protocol.ERRORCODE error_code = 7;</code>
        */
       public io.phantom.sdk.core.extend.protobuf.Common.ERRORCODE getErrorCode() {
         io.phantom.sdk.core.extend.protobuf.Common.ERRORCODE result = io.phantom.sdk.core.extend.protobuf.Common.ERRORCODE.valueOf(errorCode_);
@@ -12363,7 +14226,7 @@ public final class Overlay {
        *use it if FAIL
        * </pre>
        *
-       * <code>.protocol.ERRORCODE error_code = 7;</code>
+       * <code>optional .protocol.ERRORCODE error_code = 7;</code>
        */
       public Builder setErrorCode(io.phantom.sdk.core.extend.protobuf.Common.ERRORCODE value) {
         if (value == null) {
@@ -12379,7 +14242,7 @@ public final class Overlay {
        *use it if FAIL
        * </pre>
        *
-       * <code>.protocol.ERRORCODE error_code = 7;</code>
+       * <code>optional .protocol.ERRORCODE error_code = 7;</code>
        */
       public Builder clearErrorCode() {
         
@@ -12394,7 +14257,7 @@ public final class Overlay {
        *error desc
        * </pre>
        *
-       * <code>string error_desc = 8;</code>
+       * <code>optional string error_desc = 8;</code>
        */
       public java.lang.String getErrorDesc() {
         java.lang.Object ref = errorDesc_;
@@ -12413,7 +14276,7 @@ public final class Overlay {
        *error desc
        * </pre>
        *
-       * <code>string error_desc = 8;</code>
+       * <code>optional string error_desc = 8;</code>
        */
       public com.google.protobuf.ByteString
           getErrorDescBytes() {
@@ -12433,7 +14296,7 @@ public final class Overlay {
        *error desc
        * </pre>
        *
-       * <code>string error_desc = 8;</code>
+       * <code>optional string error_desc = 8;</code>
        */
       public Builder setErrorDesc(
           java.lang.String value) {
@@ -12450,7 +14313,7 @@ public final class Overlay {
        *error desc
        * </pre>
        *
-       * <code>string error_desc = 8;</code>
+       * <code>optional string error_desc = 8;</code>
        */
       public Builder clearErrorDesc() {
         
@@ -12463,7 +14326,7 @@ public final class Overlay {
        *error desc
        * </pre>
        *
-       * <code>string error_desc = 8;</code>
+       * <code>optional string error_desc = 8;</code>
        */
       public Builder setErrorDescBytes(
           com.google.protobuf.ByteString value) {
@@ -12479,13 +14342,13 @@ public final class Overlay {
 
       private long timestamp_ ;
       /**
-       * <code>int64 timestamp = 9;</code>
+       * <code>optional int64 timestamp = 9;</code>
        */
       public long getTimestamp() {
         return timestamp_;
       }
       /**
-       * <code>int64 timestamp = 9;</code>
+       * <code>optional int64 timestamp = 9;</code>
        */
       public Builder setTimestamp(long value) {
         
@@ -12494,7 +14357,7 @@ public final class Overlay {
         return this;
       }
       /**
-       * <code>int64 timestamp = 9;</code>
+       * <code>optional int64 timestamp = 9;</code>
        */
       public Builder clearTimestamp() {
         
@@ -12504,12 +14367,12 @@ public final class Overlay {
       }
       public final Builder setUnknownFields(
           final com.google.protobuf.UnknownFieldSet unknownFields) {
-        return super.setUnknownFieldsProto3(unknownFields);
+        return this;
       }
 
       public final Builder mergeUnknownFields(
           final com.google.protobuf.UnknownFieldSet unknownFields) {
-        return super.mergeUnknownFields(unknownFields);
+        return this;
       }
 
 
@@ -12532,7 +14395,7 @@ public final class Overlay {
           com.google.protobuf.CodedInputStream input,
           com.google.protobuf.ExtensionRegistryLite extensionRegistry)
           throws com.google.protobuf.InvalidProtocolBufferException {
-        return new ChainTxStatus(input, extensionRegistry);
+          return new ChainTxStatus(input, extensionRegistry);
       }
     };
 
@@ -12581,6 +14444,16 @@ public final class Overlay {
   private static final 
     com.google.protobuf.GeneratedMessageV3.FieldAccessorTable
       internal_static_protocol_Ledgers_fieldAccessorTable;
+  private static final com.google.protobuf.Descriptors.Descriptor
+    internal_static_protocol_GetAccountTree_descriptor;
+  private static final 
+    com.google.protobuf.GeneratedMessageV3.FieldAccessorTable
+      internal_static_protocol_GetAccountTree_fieldAccessorTable;
+  private static final com.google.protobuf.Descriptors.Descriptor
+    internal_static_protocol_AccountTree_descriptor;
+  private static final 
+    com.google.protobuf.GeneratedMessageV3.FieldAccessorTable
+      internal_static_protocol_AccountTree_fieldAccessorTable;
   private static final com.google.protobuf.Descriptors.Descriptor
     internal_static_protocol_DontHave_descriptor;
   private static final 
@@ -12636,61 +14509,71 @@ public final class Overlay {
   static {
     java.lang.String[] descriptorData = {
       "\n\roverlay.proto\022\010protocol\032\014common.proto\032" +
-      "\013chain.proto\"\243\001\n\005Hello\022\022\n\nnetwork_id\030\001 \001" +
+      "\013chain.proto\"\246\001\n\005Hello\022\022\n\nnetwork_id\030\001 \001" +
       "(\003\022\026\n\016ledger_version\030\002 \001(\003\022\027\n\017overlay_ve" +
-      "rsion\030\003 \001(\003\022\024\n\014phantom_version\030\004 \001(\t\022\026\n\016lis" +
-      "tening_port\030\005 \001(\003\022\024\n\014node_address\030\006 \001(\t\022" +
-      "\021\n\tnode_rand\030\007 \001(\t\"L\n\rHelloResponse\022\'\n\ne" +
-      "rror_code\030\001 \001(\0162\023.protocol.ERRORCODE\022\022\n\n" +
-      "error_desc\030\002 \001(\t\"}\n\004Peer\022\n\n\002ip\030\001 \001(\t\022\014\n\004" +
-      "port\030\002 \001(\003\022\024\n\014num_failures\030\003 \001(\003\022\031\n\021next" +
-      "_attempt_time\030\004 \001(\003\022\023\n\013active_time\030\005 \001(\003" +
-      "\022\025\n\rconnection_id\030\006 \001(\003\"&\n\005Peers\022\035\n\005peer" +
-      "s\030\001 \003(\0132\016.protocol.Peer\";\n\nGetLedgers\022\r\n" +
-      "\005begin\030\001 \001(\003\022\013\n\003end\030\002 \001(\003\022\021\n\ttimestamp\030\003" +
-      " \001(\003\"\337\001\n\007Ledgers\022(\n\006values\030\001 \003(\0132\030.proto" +
-      "col.ConsensusValue\022-\n\tsync_code\030\002 \001(\0162\032." +
-      "protocol.Ledgers.SyncCode\022\017\n\007max_seq\030\003 \001" +
-      "(\003\022\r\n\005proof\030\004 \001(\014\"[\n\010SyncCode\022\006\n\002OK\020\000\022\017\n" +
-      "\013OUT_OF_SYNC\020\001\022\022\n\016OUT_OF_LEDGERS\020\002\022\010\n\004BU" +
-      "SY\020\003\022\n\n\006REFUSE\020\004\022\014\n\010INTERNAL\020\005\"&\n\010DontHa" +
-      "ve\022\014\n\004type\030\001 \001(\003\022\014\n\004hash\030\002 \001(\014\"v\n\023Ledger" +
-      "UpgradeNotify\022\r\n\005nonce\030\001 \001(\003\022(\n\007upgrade\030" +
-      "\002 \001(\0132\027.protocol.LedgerUpgrade\022&\n\tsignat" +
-      "ure\030\003 \001(\0132\023.protocol.Signature\"\032\n\tEntryL" +
-      "ist\022\r\n\005entry\030\001 \003(\014\"M\n\nChainHello\022,\n\010api_" +
-      "list\030\001 \003(\0162\032.protocol.ChainMessageType\022\021" +
-      "\n\ttimestamp\030\002 \001(\003\"z\n\013ChainStatus\022\021\n\tself" +
-      "_addr\030\001 \001(\t\022\026\n\016ledger_version\030\002 \001(\003\022\027\n\017m" +
-      "onitor_version\030\003 \001(\003\022\024\n\014phantom_version\030\004 \001" +
-      "(\t\022\021\n\ttimestamp\030\005 \001(\003\"O\n\020ChainPeerMessag" +
-      "e\022\025\n\rsrc_peer_addr\030\001 \001(\t\022\026\n\016des_peer_add" +
-      "rs\030\002 \003(\t\022\014\n\004data\030\003 \001(\014\"#\n\020ChainSubscribe" +
-      "Tx\022\017\n\007address\030\001 \003(\t\"7\n\rChainResponse\022\022\n\n" +
-      "error_code\030\001 \001(\005\022\022\n\nerror_desc\030\002 \001(\t\"\325\002\n" +
-      "\rChainTxStatus\0220\n\006status\030\001 \001(\0162 .protoco" +
-      "l.ChainTxStatus.TxStatus\022\017\n\007tx_hash\030\002 \001(" +
-      "\t\022\026\n\016source_address\030\003 \001(\t\022\032\n\022source_acco" +
-      "unt_seq\030\004 \001(\003\022\022\n\nledger_seq\030\005 \001(\003\022\027\n\017new" +
-      "_account_seq\030\006 \001(\003\022\'\n\nerror_code\030\007 \001(\0162\023" +
-      ".protocol.ERRORCODE\022\022\n\nerror_desc\030\010 \001(\t\022" +
-      "\021\n\ttimestamp\030\t \001(\003\"P\n\010TxStatus\022\r\n\tUNDEFI" +
-      "NED\020\000\022\r\n\tCONFIRMED\020\001\022\013\n\007PENDING\020\002\022\014\n\010COM" +
-      "PLETE\020\003\022\013\n\007FAILURE\020\004*\203\002\n\024OVERLAY_MESSAGE" +
-      "_TYPE\022\030\n\024OVERLAY_MSGTYPE_NONE\020\000\022\030\n\024OVERL" +
-      "AY_MSGTYPE_PING\020\001\022\031\n\025OVERLAY_MSGTYPE_HEL" +
-      "LO\020\002\022\031\n\025OVERLAY_MSGTYPE_PEERS\020\003\022\037\n\033OVERL" +
-      "AY_MSGTYPE_TRANSACTION\020\004\022\033\n\027OVERLAY_MSGT" +
-      "YPE_LEDGERS\020\005\022\030\n\024OVERLAY_MSGTYPE_PBFT\020\006\022" +
-      ")\n%OVERLAY_MSGTYPE_LEDGER_UPGRADE_NOTIFY" +
-      "\020\007*\372\001\n\020ChainMessageType\022\023\n\017CHAIN_TYPE_NO" +
-      "NE\020\000\022\017\n\013CHAIN_HELLO\020\n\022\023\n\017CHAIN_TX_STATUS" +
-      "\020\013\022\025\n\021CHAIN_PEER_ONLINE\020\014\022\026\n\022CHAIN_PEER_" +
-      "OFFLINE\020\r\022\026\n\022CHAIN_PEER_MESSAGE\020\016\022\033\n\027CHA" +
-      "IN_SUBMITTRANSACTION\020\017\022\027\n\023CHAIN_LEDGER_H" +
-      "EADER\020\020\022\026\n\022CHAIN_SUBSCRIBE_TX\020\021\022\026\n\022CHAIN" +
-      "_TX_ENV_STORE\020\022B\"\n io.phantom.sdk.core.exte" +
-      "nd.protobufb\006proto3"
+      "rsion\030\003 \001(\003\022\027\n\017phantom_version\030\004 \001(\t\022\026\n\016" +
+      "listening_port\030\005 \001(\003\022\024\n\014node_address\030\006 \001" +
+      "(\t\022\021\n\tnode_rand\030\007 \001(\t\"L\n\rHelloResponse\022\'" +
+      "\n\nerror_code\030\001 \001(\0162\023.protocol.ERRORCODE\022" +
+      "\022\n\nerror_desc\030\002 \001(\t\"}\n\004Peer\022\n\n\002ip\030\001 \001(\t\022" +
+      "\014\n\004port\030\002 \001(\003\022\024\n\014num_failures\030\003 \001(\003\022\031\n\021n" +
+      "ext_attempt_time\030\004 \001(\003\022\023\n\013active_time\030\005 ",
+      "\001(\003\022\025\n\rconnection_id\030\006 \001(\003\"&\n\005Peers\022\035\n\005p" +
+      "eers\030\001 \003(\0132\016.protocol.Peer\";\n\nGetLedgers" +
+      "\022\r\n\005begin\030\001 \001(\003\022\013\n\003end\030\002 \001(\003\022\021\n\ttimestam" +
+      "p\030\003 \001(\003\"\337\001\n\007Ledgers\022(\n\006values\030\001 \003(\0132\030.pr" +
+      "otocol.ConsensusValue\022-\n\tsync_code\030\002 \001(\016" +
+      "2\032.protocol.Ledgers.SyncCode\022\017\n\007max_seq\030" +
+      "\003 \001(\003\022\r\n\005proof\030\004 \001(\014\"[\n\010SyncCode\022\006\n\002OK\020\000" +
+      "\022\017\n\013OUT_OF_SYNC\020\001\022\022\n\016OUT_OF_LEDGERS\020\002\022\010\n" +
+      "\004BUSY\020\003\022\n\n\006REFUSE\020\004\022\014\n\010INTERNAL\020\005\"E\n\016Get" +
+      "AccountTree\022\022\n\nledger_seq\030\001 \001(\003\022\014\n\004keys\030",
+      "\002 \003(\014\022\021\n\ttimestamp\030\003 \001(\003\"\226\002\n\013AccountTree" +
+      "\0221\n\tsync_code\030\001 \001(\0162\036.protocol.AccountTr" +
+      "ee.SyncCode\022\022\n\nledger_seq\030\002 \001(\003\022\016\n\006value" +
+      "s\030\003 \003(\014\022 \n\006ledger\030\004 \001(\0132\020.protocol.Ledge" +
+      "r\022\027\n\017consensus_value\030\005 \001(\014\022\022\n\nnext_value" +
+      "\030\006 \001(\014\022\022\n\nnext_proof\030\007 \001(\014\022\014\n\004fees\030\010 \001(\014" +
+      "\"?\n\010SyncCode\022\006\n\002OK\020\000\022\r\n\tNOT_READY\020\001\022\016\n\nN" +
+      "OT_PINNED\020\002\022\014\n\010INTERNAL\020\003\"&\n\010DontHave\022\014\n" +
+      "\004type\030\001 \001(\003\022\014\n\004hash\030\002 \001(\014\"v\n\023LedgerUpgra" +
+      "deNotify\022\r\n\005nonce\030\001 \001(\003\022(\n\007upgrade\030\002 \001(\013",
+      "2\027.protocol.LedgerUpgrade\022&\n\tsignature\030\003" +
+      " \001(\0132\023.protocol.Signature\"\032\n\tEntryList\022\r" +
+      "\n\005entry\030\001 \003(\014\"M\n\nChainHello\022,\n\010api_list\030" +
+      "\001 \003(\0162\032.protocol.ChainMessageType\022\021\n\ttim" +
+      "estamp\030\002 \001(\003\"}\n\013ChainStatus\022\021\n\tself_addr" +
+      "\030\001 \001(\t\022\026\n\016ledger_version\030\002 \001(\003\022\027\n\017monito" +
+      "r_version\030\003 \001(\003\022\027\n\017phantom_version\030\004 \001(\t" +
+      "\022\021\n\ttimestamp\030\005 \001(\003\"O\n\020ChainPeerMessage\022" +
+      "\025\n\rsrc_peer_addr\030\001 \001(\t\022\026\n\016des_peer_addrs" +
+      "\030\002 \003(\t\022\014\n\004data\030\003 \001(\014\"#\n\020ChainSubscribeTx",
+      "\022\017\n\007address\030\001 \003(\t\"7\n\rChainResponse\022\022\n\ner" +
+      "ror_code\030\001 \001(\005\022\022\n\nerror_desc\030\002 \001(\t\"\325\002\n\rC" +
+      "hainTxStatus\0220\n\006status\030\001 \001(\0162 .protocol." +
+      "ChainTxStatus.TxStatus\022\017\n\007tx_hash\030\002 \001(\t\022" +
+      "\026\n\016source_address\030\003 \001(\t\022\032\n\022source_accoun" +
+      "t_seq\030\004 \001(\003\022\022\n\nledger_seq\030\005 \001(\003\022\027\n\017new_a" +
+      "ccount_seq\030\006 \001(\003\022\'\n\nerror_code\030\007 \001(\0162\023.p" +
+      "rotocol.ERRORCODE\022\022\n\nerror_desc\030\010 \001(\t\022\021\n" +
+      "\ttimestamp\030\t \001(\003\"P\n\010TxStatus\022\r\n\tUNDEFINE" +
+      "D\020\000\022\r\n\tCONFIRMED\020\001\022\013\n\007PENDING\020\002\022\014\n\010COMPL",
+      "ETE\020\003\022\013\n\007FAILURE\020\004*\245\002\n\024OVERLAY_MESSAGE_T" +
+      "YPE\022\030\n\024OVERLAY_MSGTYPE_NONE\020\000\022\030\n\024OVERLAY" +
+      "_MSGTYPE_PING\020\001\022\031\n\025OVERLAY_MSGTYPE_HELLO" +
+      "\020\002\022\031\n\025OVERLAY_MSGTYPE_PEERS\020\003\022\037\n\033OVERLAY" +
+      "_MSGTYPE_TRANSACTION\020\004\022\033\n\027OVERLAY_MSGTYP" +
+      "E_LEDGERS\020\005\022\030\n\024OVERLAY_MSGTYPE_PBFT\020\006\022)\n" +
+      "%OVERLAY_MSGTYPE_LEDGER_UPGRADE_NOTIFY\020\007" +
+      "\022 \n\034OVERLAY_MSGTYPE_ACCOUNT_TREE\020\010*\372\001\n\020C" +
+      "hainMessageType\022\023\n\017CHAIN_TYPE_NONE\020\000\022\017\n\013" +
+      "CHAIN_HELLO\020\n\022\023\n\017CHAIN_TX_STATUS\020\013\022\025\n\021CH",
+      "AIN_PEER_ONLINE\020\014\022\026\n\022CHAIN_PEER_OFFLINE\020" +
+      "\r\022\026\n\022CHAIN_PEER_MESSAGE\020\016\022\033\n\027CHAIN_SUBMI" +
+      "TTRANSACTION\020\017\022\027\n\023CHAIN_LEDGER_HEADER\020\020\022" +
+      "\026\n\022CHAIN_SUBSCRIBE_TX\020\021\022\026\n\022CHAIN_TX_ENV_" +
+      "STORE\020\022B%\n#io.phantom.sdk.core.extend.pr" +
+      "otobufb\006proto3"
     };
     com.google.protobuf.Descriptors.FileDescriptor.InternalDescriptorAssigner assigner =
         new com.google.protobuf.Descriptors.FileDescriptor.    InternalDescriptorAssigner() {
@@ -12742,56 +14625,68 @@ public final class Overlay {
       com.google.protobuf.GeneratedMessageV3.FieldAccessorTable(
         internal_static_protocol_Ledgers_descriptor,
         new java.lang.String[] { "Values", "SyncCode", "MaxSeq", "Proof", });
-    internal_static_protocol_DontHave_descriptor =
+    internal_static_protocol_GetAccountTree_descriptor =
       getDescriptor().getMessageTypes().get(6);
+    internal_static_protocol_GetAccountTree_fieldAccessorTable = new
+      com.google.protobuf.GeneratedMessageV3.FieldAccessorTable(
+        internal_static_protocol_GetAccountTree_descriptor,
+        new java.lang.String[] { "LedgerSeq", "Keys", "Timestamp", });
+    internal_static_protocol_AccountTree_descriptor =
+      getDescriptor().getMessageTypes().get(7);
+    internal_static_protocol_AccountTree_fieldAccessorTable = new
+      com.google.protobuf.GeneratedMessageV3.FieldAccessorTable(
+        internal_static_protocol_AccountTree_descriptor,
+        new java.lang.String[] { "SyncCode", "LedgerSeq", "Values", "Ledger", "ConsensusValue", "NextValue", "NextProof", "Fees", });
+    internal_static_protocol_DontHave_descriptor =
+      getDescriptor().getMessageTypes().get(8);
     internal_static_protocol_DontHave_fieldAccessorTable = new
       com.google.protobuf.GeneratedMessageV3.FieldAccessorTable(
         internal_static_protocol_DontHave_descriptor,
         new java.lang.String[] { "Type", "Hash", });
     internal_static_protocol_LedgerUpgradeNotify_descriptor =
-      getDescriptor().getMessageTypes().get(7);
+      getDescriptor().getMessageTypes().get(9);
     internal_static_protocol_LedgerUpgradeNotify_fieldAccessorTable = new
       com.google.protobuf.GeneratedMessageV3.FieldAccessorTable(
         internal_static_protocol_LedgerUpgradeNotify_descriptor,
         new java.lang.String[] { "Nonce", "Upgrade", "Signature", });
     internal_static_protocol_EntryList_descriptor =
-      getDescriptor().getMessageTypes().get(8);
+      getDescriptor().getMessageTypes().get(10);
     internal_static_protocol_EntryList_fieldAccessorTable = new
       com.google.protobuf.GeneratedMessageV3.FieldAccessorTable(
         internal_static_protocol_EntryList_descriptor,
         new java.lang.String[] { "Entry", });
     internal_static_protocol_ChainHello_descriptor =
-      getDescriptor().getMessageTypes().get(9);
+      getDescriptor().getMessageTypes().get(11);
     internal_static_protocol_ChainHello_fieldAccessorTable = new
       com.google.protobuf.GeneratedMessageV3.FieldAccessorTable(
         internal_static_protocol_ChainHello_descriptor,
         new java.lang.String[] { "ApiList", "Timestamp", });
     internal_static_protocol_ChainStatus_descriptor =
-      getDescriptor().getMessageTypes().get(10);
+      getDescriptor().getMessageTypes().get(12);
     internal_static_protocol_ChainStatus_fieldAccessorTable = new
       com.google.protobuf.GeneratedMessageV3.FieldAccessorTable(
         internal_static_protocol_ChainStatus_descriptor,
         new java.lang.String[] { "SelfAddr", "LedgerVersion", "MonitorVersion", "PhantomVersion", "Timestamp", });
     internal_static_protocol_ChainPeerMessage_descriptor =
-      getDescriptor().getMessageTypes().get(11);
+      getDescriptor().getMessageTypes().get(13);
     internal_static_protocol_ChainPeerMessage_fieldAccessorTable = new
       com.google.protobuf.GeneratedMessageV3.FieldAccessorTable(
         internal_static_protocol_ChainPeerMessage_descriptor,
         new java.lang.String[] { "SrcPeerAddr", "DesPeerAddrs", "Data", });
     internal_static_protocol_ChainSubscribeTx_descriptor =
-      getDescriptor().getMessageTypes().get(12);
+      getDescriptor().getMessageTypes().get(14);
     internal_static_protocol_ChainSubscribeTx_fieldAccessorTable = new
       com.google.protobuf.GeneratedMessageV3.FieldAccessorTable(
         internal_static_protocol_ChainSubscribeTx_descriptor,
         new java.lang.String[] { "Address", });
     internal_static_protocol_ChainResponse_descriptor =
-      getDescriptor().getMessageTypes().get(13);
+      getDescriptor().getMessageTypes().get(15);
     internal_static_protocol_ChainResponse_fieldAccessorTable = new
       com.google.protobuf.GeneratedMessageV3.FieldAccessorTable(
         internal_static_protocol_ChainResponse_descriptor,
         new java.lang.String[] { "ErrorCode", "ErrorDesc", });
     internal_static_protocol_ChainTxStatus_descriptor =
-      getDescriptor().getMessageTypes().get(14);
+      getDescriptor().getMessageTypes().get(16);
     internal_static_protocol_ChainTxStatus_fieldAccessorTable = new
       com.google.protobuf.GeneratedMessageV3.FieldAccessorTable(
         internal_static_protocol_ChainTxStatus_descriptor,
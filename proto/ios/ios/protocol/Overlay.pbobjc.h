@@ -13,11 +13,8 @@
  #import "GPBProtocolBuffers.h"
 #endif
 
-#if GOOGLE_PROTOBUF_OBJC_VERSION < 30002
-#error This file was generated by a newer version of protoc which is incompatible with your Protocol Buffer library sources.
-#endif
-#if 30002 < GOOGLE_PROTOBUF_OBJC_MIN_SUPPORTED_VERSION
-#error This file was generated by an older version of protoc which is incompatible with your Protocol Buffer library sources.
+#if GOOGLE_PROTOBUF_OBJC_GEN_VERSION != 30001
+#error This file was generated by a different version of protoc which is incompatible with your Protocol Buffer library sources.
 #endif
 
 // @@protoc_insertion_point(imports)
@@ -28,6 +25,7 @@
 CF_EXTERN_C_BEGIN
 
 @class ConsensusValue;
+@class Ledger;
 @class LedgerUpgrade;
 @class Peer;
 @class Signature;
@@ -54,6 +52,9 @@ typedef GPB_ENUM(OVERLAY_MESSAGE_TYPE) {
 
   /** broadcast the ledger upgrade status */
   OVERLAY_MESSAGE_TYPE_OverlayMsgtypeLedgerUpgradeNotify = 7,
+
+  /** state sync, rows of the account trees at a ledger */
+  OVERLAY_MESSAGE_TYPE_OverlayMsgtypeAccountTree = 8,
 };
 
 GPBEnumDescriptor *OVERLAY_MESSAGE_TYPE_EnumDescriptor(void);
@@ -136,6 +137,33 @@ GPBEnumDescriptor *Ledgers_SyncCode_EnumDescriptor(void);
  **/
 BOOL Ledgers_SyncCode_IsValidValue(int32_t value);
 
+#pragma mark - Enum AccountTree_SyncCode
+
+typedef GPB_ENUM(AccountTree_SyncCode) {
+  /**
+   * Value used if any message's field encounters a value that is not defined
+   * by this enum. The message will also have C functions to get/set the rawValue
+   * of the field.
+   **/
+  AccountTree_SyncCode_GPBUnrecognizedEnumeratorValue = kGPBUnrecognizedEnumeratorValue,
+  AccountTree_SyncCode_Ok = 0,
+
+  /** the proof of the ledger is not closed yet, ask again */
+  AccountTree_SyncCode_NotReady = 1,
+
+  /** the ledger is not served any more */
+  AccountTree_SyncCode_NotPinned = 2,
+  AccountTree_SyncCode_Internal = 3,
+};
+
+GPBEnumDescriptor *AccountTree_SyncCode_EnumDescriptor(void);
+
+/**
+ * Checks to see if the given value is defined by the enum or was not known at
+ * the time this source was generated.
+ **/
+BOOL AccountTree_SyncCode_IsValidValue(int32_t value);
+
 #pragma mark - Enum ChainTxStatus_TxStatus
 
 typedef GPB_ENUM(ChainTxStatus_TxStatus) {
@@ -343,6 +371,85 @@ int32_t Ledgers_SyncCode_RawValue(Ledgers *message);
  **/
 void SetLedgers_SyncCode_RawValue(Ledgers *message, int32_t value);
 
+#pragma mark - GetAccountTree
+
+typedef GPB_ENUM(GetAccountTree_FieldNumber) {
+  GetAccountTree_FieldNumber_LedgerSeq = 1,
+  GetAccountTree_FieldNumber_KeysArray = 2,
+  GetAccountTree_FieldNumber_Timestamp = 3,
+};
+
+/**
+ * for state sync, rows of the account tree and of the asset and metadata trees of its accounts
+ **/
+@interface GetAccountTree : GPBMessage
+
+/** 0 for the ledger the peer serves now */
+@property(nonatomic, readwrite) int64_t ledgerSeq;
+
+/** account db keys, none to get the ledger itself */
+@property(nonatomic, readwrite, strong, null_resettable) NSMutableArray<NSData*> *keysArray;
+/** The number of items in @c keysArray without causing the array to be created. */
+@property(nonatomic, readonly) NSUInteger keysArray_Count;
+
+@property(nonatomic, readwrite) int64_t timestamp;
+
+@end
+
+#pragma mark - AccountTree
+
+typedef GPB_ENUM(AccountTree_FieldNumber) {
+  AccountTree_FieldNumber_SyncCode = 1,
+  AccountTree_FieldNumber_LedgerSeq = 2,
+  AccountTree_FieldNumber_ValuesArray = 3,
+  AccountTree_FieldNumber_Ledger = 4,
+  AccountTree_FieldNumber_ConsensusValue = 5,
+  AccountTree_FieldNumber_NextValue = 6,
+  AccountTree_FieldNumber_NextProof = 7,
+  AccountTree_FieldNumber_Fees = 8,
+};
+
+@interface AccountTree : GPBMessage
+
+@property(nonatomic, readwrite) AccountTree_SyncCode syncCode;
+
+@property(nonatomic, readwrite) int64_t ledgerSeq;
+
+/** values of the first keys requested, in order */
+@property(nonatomic, readwrite, strong, null_resettable) NSMutableArray<NSData*> *valuesArray;
+/** The number of items in @c valuesArray without causing the array to be created. */
+@property(nonatomic, readonly) NSUInteger valuesArray_Count;
+
+/** for a request without keys */
+@property(nonatomic, readwrite, strong, null_resettable) Ledger *ledger;
+/** Test to see if @c ledger has been set. */
+@property(nonatomic, readwrite) BOOL hasLedger;
+
+/** of the ledger */
+@property(nonatomic, readwrite, copy, null_resettable) NSData *consensusValue;
+
+/** its previous ledger hash is the ledger hash */
+@property(nonatomic, readwrite, copy, null_resettable) NSData *nextValue;
+
+@property(nonatomic, readwrite, copy, null_resettable) NSData *nextProof;
+
+/** fee config of the ledger */
+@property(nonatomic, readwrite, copy, null_resettable) NSData *fees;
+
+@end
+
+/**
+ * Fetches the raw value of a @c AccountTree's @c syncCode property, even
+ * if the value was not defined by the enum at the time the code was generated.
+ **/
+int32_t AccountTree_SyncCode_RawValue(AccountTree *message);
+/**
+ * Sets the raw value of an @c AccountTree's @c syncCode property, allowing
+ * it to be set to a value that was not defined by the enum at the time the code
+ * was generated.
+ **/
+void SetAccountTree_SyncCode_RawValue(AccountTree *message, int32_t value);
+
 #pragma mark - DontHave
 
 typedef GPB_ENUM(DontHave_FieldNumber) {
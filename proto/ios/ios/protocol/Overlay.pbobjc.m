@@ -25,8 +25,18 @@
 
 @implementation OverlayRoot
 
-// No extensions in the file and none of the imports (direct or indirect)
-// defined extensions, so no need to generate +extensionRegistry.
++ (GPBExtensionRegistry*)extensionRegistry {
+  // This is called by +initialize so there is no need to worry
+  // about thread safety and initialization of registry.
+  static GPBExtensionRegistry* registry = nil;
+  if (!registry) {
+    GPBDebugCheckRuntimeVersion();
+    registry = [[GPBExtensionRegistry alloc] init];
+    [registry addExtensions:[CommonRoot extensionRegistry]];
+    [registry addExtensions:[ChainRoot extensionRegistry]];
+  }
+  return registry;
+}
 
 @end
 
@@ -37,7 +47,7 @@ static GPBFileDescriptor *OverlayRoot_FileDescriptor(void) {
   // about thread safety of the singleton.
   static GPBFileDescriptor *descriptor = NULL;
   if (!descriptor) {
-    GPB_DEBUG_CHECK_RUNTIME_VERSIONS();
+    GPBDebugCheckRuntimeVersion();
     descriptor = [[GPBFileDescriptor alloc] initWithPackage:@"protocol"
                                                      syntax:GPBFileSyntaxProto3];
   }
@@ -54,7 +64,8 @@ GPBEnumDescriptor *OVERLAY_MESSAGE_TYPE_EnumDescriptor(void) {
         "erlayMsgtypeHello\000OverlayMsgtypePeers\000Ov"
         "erlayMsgtypeTransaction\000OverlayMsgtypeLe"
         "dgers\000OverlayMsgtypePbft\000OverlayMsgtypeL"
-        "edgerUpgradeNotify\000";
+        "edgerUpgradeNotify\000OverlayMsgtypeAccount"
+        "Tree\000";
     static const int32_t values[] = {
         OVERLAY_MESSAGE_TYPE_OverlayMsgtypeNone,
         OVERLAY_MESSAGE_TYPE_OverlayMsgtypePing,
@@ -64,6 +75,7 @@ GPBEnumDescriptor *OVERLAY_MESSAGE_TYPE_EnumDescriptor(void) {
         OVERLAY_MESSAGE_TYPE_OverlayMsgtypeLedgers,
         OVERLAY_MESSAGE_TYPE_OverlayMsgtypePbft,
         OVERLAY_MESSAGE_TYPE_OverlayMsgtypeLedgerUpgradeNotify,
+        OVERLAY_MESSAGE_TYPE_OverlayMsgtypeAccountTree,
     };
     GPBEnumDescriptor *worker =
         [GPBEnumDescriptor allocDescriptorForName:GPBNSStringifySymbol(OVERLAY_MESSAGE_TYPE)
@@ -88,6 +100,7 @@ BOOL OVERLAY_MESSAGE_TYPE_IsValidValue(int32_t value__) {
     case OVERLAY_MESSAGE_TYPE_OverlayMsgtypeLedgers:
     case OVERLAY_MESSAGE_TYPE_OverlayMsgtypePbft:
     case OVERLAY_MESSAGE_TYPE_OverlayMsgtypeLedgerUpgradeNotify:
+    case OVERLAY_MESSAGE_TYPE_OverlayMsgtypeAccountTree:
       return YES;
     default:
       return NO;
@@ -248,7 +261,7 @@ typedef struct Hello__storage_ {
                                         fields:fields
                                     fieldCount:(uint32_t)(sizeof(fields) / sizeof(GPBMessageFieldDescription))
                                    storageSize:sizeof(Hello__storage_)
-                                         flags:GPBDescriptorInitializationFlag_None];
+                                         flags:0];
     NSAssert(descriptor == nil, @"Startup recursed!");
     descriptor = localDescriptor;
   }
@@ -282,7 +295,7 @@ typedef struct HelloResponse__storage_ {
         .number = HelloResponse_FieldNumber_ErrorCode,
         .hasIndex = 0,
         .offset = (uint32_t)offsetof(HelloResponse__storage_, errorCode),
-        .flags = (GPBFieldFlags)(GPBFieldOptional | GPBFieldHasEnumDescriptor),
+        .flags = GPBFieldOptional | GPBFieldHasEnumDescriptor,
         .dataType = GPBDataTypeEnum,
       },
       {
@@ -302,7 +315,7 @@ typedef struct HelloResponse__storage_ {
                                         fields:fields
                                     fieldCount:(uint32_t)(sizeof(fields) / sizeof(GPBMessageFieldDescription))
                                    storageSize:sizeof(HelloResponse__storage_)
-                                         flags:GPBDescriptorInitializationFlag_None];
+                                         flags:0];
     NSAssert(descriptor == nil, @"Startup recursed!");
     descriptor = localDescriptor;
   }
@@ -412,7 +425,7 @@ typedef struct Peer__storage_ {
                                         fields:fields
                                     fieldCount:(uint32_t)(sizeof(fields) / sizeof(GPBMessageFieldDescription))
                                    storageSize:sizeof(Peer__storage_)
-                                         flags:GPBDescriptorInitializationFlag_None];
+                                         flags:0];
     NSAssert(descriptor == nil, @"Startup recursed!");
     descriptor = localDescriptor;
   }
@@ -455,7 +468,7 @@ typedef struct Peers__storage_ {
                                         fields:fields
                                     fieldCount:(uint32_t)(sizeof(fields) / sizeof(GPBMessageFieldDescription))
                                    storageSize:sizeof(Peers__storage_)
-                                         flags:GPBDescriptorInitializationFlag_None];
+                                         flags:0];
     NSAssert(descriptor == nil, @"Startup recursed!");
     descriptor = localDescriptor;
   }
@@ -520,7 +533,7 @@ typedef struct GetLedgers__storage_ {
                                         fields:fields
                                     fieldCount:(uint32_t)(sizeof(fields) / sizeof(GPBMessageFieldDescription))
                                    storageSize:sizeof(GetLedgers__storage_)
-                                         flags:GPBDescriptorInitializationFlag_None];
+                                         flags:0];
     NSAssert(descriptor == nil, @"Startup recursed!");
     descriptor = localDescriptor;
   }
@@ -567,7 +580,7 @@ typedef struct Ledgers__storage_ {
         .number = Ledgers_FieldNumber_SyncCode,
         .hasIndex = 0,
         .offset = (uint32_t)offsetof(Ledgers__storage_, syncCode),
-        .flags = (GPBFieldFlags)(GPBFieldOptional | GPBFieldHasEnumDescriptor),
+        .flags = GPBFieldOptional | GPBFieldHasEnumDescriptor,
         .dataType = GPBDataTypeEnum,
       },
       {
@@ -596,7 +609,7 @@ typedef struct Ledgers__storage_ {
                                         fields:fields
                                     fieldCount:(uint32_t)(sizeof(fields) / sizeof(GPBMessageFieldDescription))
                                    storageSize:sizeof(Ledgers__storage_)
-                                         flags:GPBDescriptorInitializationFlag_None];
+                                         flags:0];
     NSAssert(descriptor == nil, @"Startup recursed!");
     descriptor = localDescriptor;
   }
@@ -660,6 +673,241 @@ BOOL Ledgers_SyncCode_IsValidValue(int32_t value__) {
   }
 }
 
+#pragma mark - GetAccountTree
+
+@implementation GetAccountTree
+
+@dynamic ledgerSeq;
+@dynamic keysArray, keysArray_Count;
+@dynamic timestamp;
+
+typedef struct GetAccountTree__storage_ {
+  uint32_t _has_storage_[1];
+  NSMutableArray *keysArray;
+  int64_t ledgerSeq;
+  int64_t timestamp;
+} GetAccountTree__storage_;
+
+// This method is threadsafe because it is initially called
+// in +initialize for each subclass.
++ (GPBDescriptor *)descriptor {
+  static GPBDescriptor *descriptor = nil;
+  if (!descriptor) {
+    static GPBMessageFieldDescription fields[] = {
+      {
+        .name = "ledgerSeq",
+        .dataTypeSpecific.className = NULL,
+        .number = GetAccountTree_FieldNumber_LedgerSeq,
+        .hasIndex = 0,
+        .offset = (uint32_t)offsetof(GetAccountTree__storage_, ledgerSeq),
+        .flags = GPBFieldOptional,
+        .dataType = GPBDataTypeInt64,
+      },
+      {
+        .name = "keysArray",
+        .dataTypeSpecific.className = NULL,
+        .number = GetAccountTree_FieldNumber_KeysArray,
+        .hasIndex = GPBNoHasBit,
+        .offset = (uint32_t)offsetof(GetAccountTree__storage_, keysArray),
+        .flags = GPBFieldRepeated,
+        .dataType = GPBDataTypeBytes,
+      },
+      {
+        .name = "timestamp",
+        .dataTypeSpecific.className = NULL,
+        .number = GetAccountTree_FieldNumber_Timestamp,
+        .hasIndex = 1,
+        .offset = (uint32_t)offsetof(GetAccountTree__storage_, timestamp),
+        .flags = GPBFieldOptional,
+        .dataType = GPBDataTypeInt64,
+      },
+    };
+    GPBDescriptor *localDescriptor =
+        [GPBDescriptor allocDescriptorForClass:[GetAccountTree class]
+                                     rootClass:[OverlayRoot class]
+                                          file:OverlayRoot_FileDescriptor()
+                                        fields:fields
+                                    fieldCount:(uint32_t)(sizeof(fields) / sizeof(GPBMessageFieldDescription))
+                                   storageSize:sizeof(GetAccountTree__storage_)
+                                         flags:0];
+    NSAssert(descriptor == nil, @"Startup recursed!");
+    descriptor = localDescriptor;
+  }
+  return descriptor;
+}
+
+@end
+
+#pragma mark - AccountTree
+
+@implementation AccountTree
+
+@dynamic syncCode;
+@dynamic ledgerSeq;
+@dynamic valuesArray, valuesArray_Count;
+@dynamic hasLedger, ledger;
+@dynamic consensusValue;
+@dynamic nextValue;
+@dynamic nextProof;
+@dynamic fees;
+
+typedef struct AccountTree__storage_ {
+  uint32_t _has_storage_[1];
+  AccountTree_SyncCode syncCode;
+  NSMutableArray *valuesArray;
+  Ledger *ledger;
+  NSData *consensusValue;
+  NSData *nextValue;
+  NSData *nextProof;
+  NSData *fees;
+  int64_t ledgerSeq;
+} AccountTree__storage_;
+
+// This method is threadsafe because it is initially called
+// in +initialize for each subclass.
++ (GPBDescriptor *)descriptor {
+  static GPBDescriptor *descriptor = nil;
+  if (!descriptor) {
+    static GPBMessageFieldDescription fields[] = {
+      {
+        .name = "syncCode",
+        .dataTypeSpecific.enumDescFunc = AccountTree_SyncCode_EnumDescriptor,
+        .number = AccountTree_FieldNumber_SyncCode,
+        .hasIndex = 0,
+        .offset = (uint32_t)offsetof(AccountTree__storage_, syncCode),
+        .flags = GPBFieldOptional | GPBFieldHasEnumDescriptor,
+        .dataType = GPBDataTypeEnum,
+      },
+      {
+        .name = "ledgerSeq",
+        .dataTypeSpecific.className = NULL,
+        .number = AccountTree_FieldNumber_LedgerSeq,
+        .hasIndex = 1,
+        .offset = (uint32_t)offsetof(AccountTree__storage_, ledgerSeq),
+        .flags = GPBFieldOptional,
+        .dataType = GPBDataTypeInt64,
+      },
+      {
+        .name = "valuesArray",
+        .dataTypeSpecific.className = NULL,
+        .number = AccountTree_FieldNumber_ValuesArray,
+        .hasIndex = GPBNoHasBit,
+        .offset = (uint32_t)offsetof(AccountTree__storage_, valuesArray),
+        .flags = GPBFieldRepeated,
+        .dataType = GPBDataTypeBytes,
+      },
+      {
+        .name = "ledger",
+        .dataTypeSpecific.className = GPBStringifySymbol(Ledger),
+        .number = AccountTree_FieldNumber_Ledger,
+        .hasIndex = 2,
+        .offset = (uint32_t)offsetof(AccountTree__storage_, ledger),
+        .flags = GPBFieldOptional,
+        .dataType = GPBDataTypeMessage,
+      },
+      {
+        .name = "consensusValue",
+        .dataTypeSpecific.className = NULL,
+        .number = AccountTree_FieldNumber_ConsensusValue,
+        .hasIndex = 3,
+        .offset = (uint32_t)offsetof(AccountTree__storage_, consensusValue),
+        .flags = GPBFieldOptional,
+        .dataType = GPBDataTypeBytes,
+      },
+      {
+        .name = "nextValue",
+        .dataTypeSpecific.className = NULL,
+        .number = AccountTree_FieldNumber_NextValue,
+        .hasIndex = 4,
+        .offset = (uint32_t)offsetof(AccountTree__storage_, nextValue),
+        .flags = GPBFieldOptional,
+        .dataType = GPBDataTypeBytes,
+      },
+      {
+        .name = "nextProof",
+        .dataTypeSpecific.className = NULL,
+        .number = AccountTree_FieldNumber_NextProof,
+        .hasIndex = 5,
+        .offset = (uint32_t)offsetof(AccountTree__storage_, nextProof),
+        .flags = GPBFieldOptional,
+        .dataType = GPBDataTypeBytes,
+      },
+      {
+        .name = "fees",
+        .dataTypeSpecific.className = NULL,
+        .number = AccountTree_FieldNumber_Fees,
+        .hasIndex = 6,
+        .offset = (uint32_t)offsetof(AccountTree__storage_, fees),
+        .flags = GPBFieldOptional,
+        .dataType = GPBDataTypeBytes,
+      },
+    };
+    GPBDescriptor *localDescriptor =
+        [GPBDescriptor allocDescriptorForClass:[AccountTree class]
+                                     rootClass:[OverlayRoot class]
+                                          file:OverlayRoot_FileDescriptor()
+                                        fields:fields
+                                    fieldCount:(uint32_t)(sizeof(fields) / sizeof(GPBMessageFieldDescription))
+                                   storageSize:sizeof(AccountTree__storage_)
+                                         flags:0];
+    NSAssert(descriptor == nil, @"Startup recursed!");
+    descriptor = localDescriptor;
+  }
+  return descriptor;
+}
+
+@end
+
+int32_t AccountTree_SyncCode_RawValue(AccountTree *message) {
+  GPBDescriptor *descriptor = [AccountTree descriptor];
+  GPBFieldDescriptor *field = [descriptor fieldWithNumber:AccountTree_FieldNumber_SyncCode];
+  return GPBGetMessageInt32Field(message, field);
+}
+
+void SetAccountTree_SyncCode_RawValue(AccountTree *message, int32_t value) {
+  GPBDescriptor *descriptor = [AccountTree descriptor];
+  GPBFieldDescriptor *field = [descriptor fieldWithNumber:AccountTree_FieldNumber_SyncCode];
+  GPBSetInt32IvarWithFieldInternal(message, field, value, descriptor.file.syntax);
+}
+
+#pragma mark - Enum AccountTree_SyncCode
+
+GPBEnumDescriptor *AccountTree_SyncCode_EnumDescriptor(void) {
+  static GPBEnumDescriptor *descriptor = NULL;
+  if (!descriptor) {
+    static const char *valueNames =
+        "Ok\000NotReady\000NotPinned\000Internal\000";
+    static const int32_t values[] = {
+        AccountTree_SyncCode_Ok,
+        AccountTree_SyncCode_NotReady,
+        AccountTree_SyncCode_NotPinned,
+        AccountTree_SyncCode_Internal,
+    };
+    GPBEnumDescriptor *worker =
+        [GPBEnumDescriptor allocDescriptorForName:GPBNSStringifySymbol(AccountTree_SyncCode)
+                                       valueNames:valueNames
+                                           values:values
+                                            count:(uint32_t)(sizeof(values) / sizeof(int32_t))
+                                     enumVerifier:AccountTree_SyncCode_IsValidValue];
+    if (!OSAtomicCompareAndSwapPtrBarrier(nil, worker, (void * volatile *)&descriptor)) {
+      [worker release];
+    }
+  }
+  return descriptor;
+}
+
+BOOL AccountTree_SyncCode_IsValidValue(int32_t value__) {
+  switch (value__) {
+    case AccountTree_SyncCode_Ok:
+    case AccountTree_SyncCode_NotReady:
+    case AccountTree_SyncCode_NotPinned:
+    case AccountTree_SyncCode_Internal:
+      return YES;
+    default:
+      return NO;
+  }
+}
+
 #pragma mark - DontHave
 
 @implementation DontHave
@@ -705,7 +953,7 @@ typedef struct DontHave__storage_ {
                                         fields:fields
                                     fieldCount:(uint32_t)(sizeof(fields) / sizeof(GPBMessageFieldDescription))
                                    storageSize:sizeof(DontHave__storage_)
-                                         flags:GPBDescriptorInitializationFlag_None];
+                                         flags:0];
     NSAssert(descriptor == nil, @"Startup recursed!");
     descriptor = localDescriptor;
   }
@@ -770,7 +1018,7 @@ typedef struct LedgerUpgradeNotify__storage_ {
                                         fields:fields
                                     fieldCount:(uint32_t)(sizeof(fields) / sizeof(GPBMessageFieldDescription))
                                    storageSize:sizeof(LedgerUpgradeNotify__storage_)
-                                         flags:GPBDescriptorInitializationFlag_None];
+                                         flags:0];
     NSAssert(descriptor == nil, @"Startup recursed!");
     descriptor = localDescriptor;
   }
@@ -813,7 +1061,7 @@ typedef struct EntryList__storage_ {
                                         fields:fields
                                     fieldCount:(uint32_t)(sizeof(fields) / sizeof(GPBMessageFieldDescription))
                                    storageSize:sizeof(EntryList__storage_)
-                                         flags:GPBDescriptorInitializationFlag_None];
+                                         flags:0];
     NSAssert(descriptor == nil, @"Startup recursed!");
     descriptor = localDescriptor;
   }
@@ -847,7 +1095,7 @@ typedef struct ChainHello__storage_ {
         .number = ChainHello_FieldNumber_ApiListArray,
         .hasIndex = GPBNoHasBit,
         .offset = (uint32_t)offsetof(ChainHello__storage_, apiListArray),
-        .flags = (GPBFieldFlags)(GPBFieldRepeated | GPBFieldPacked | GPBFieldHasEnumDescriptor),
+        .flags = GPBFieldRepeated | GPBFieldPacked | GPBFieldHasEnumDescriptor,
         .dataType = GPBDataTypeEnum,
       },
       {
@@ -867,7 +1115,7 @@ typedef struct ChainHello__storage_ {
                                         fields:fields
                                     fieldCount:(uint32_t)(sizeof(fields) / sizeof(GPBMessageFieldDescription))
                                    storageSize:sizeof(ChainHello__storage_)
-                                         flags:GPBDescriptorInitializationFlag_None];
+                                         flags:0];
     NSAssert(descriptor == nil, @"Startup recursed!");
     descriptor = localDescriptor;
   }
@@ -954,7 +1202,7 @@ typedef struct ChainStatus__storage_ {
                                         fields:fields
                                     fieldCount:(uint32_t)(sizeof(fields) / sizeof(GPBMessageFieldDescription))
                                    storageSize:sizeof(ChainStatus__storage_)
-                                         flags:GPBDescriptorInitializationFlag_None];
+                                         flags:0];
     NSAssert(descriptor == nil, @"Startup recursed!");
     descriptor = localDescriptor;
   }
@@ -1019,7 +1267,7 @@ typedef struct ChainPeerMessage__storage_ {
                                         fields:fields
                                     fieldCount:(uint32_t)(sizeof(fields) / sizeof(GPBMessageFieldDescription))
                                    storageSize:sizeof(ChainPeerMessage__storage_)
-                                         flags:GPBDescriptorInitializationFlag_None];
+                                         flags:0];
     NSAssert(descriptor == nil, @"Startup recursed!");
     descriptor = localDescriptor;
   }
@@ -1062,7 +1310,7 @@ typedef struct ChainSubscribeTx__storage_ {
                                         fields:fields
                                     fieldCount:(uint32_t)(sizeof(fields) / sizeof(GPBMessageFieldDescription))
                                    storageSize:sizeof(ChainSubscribeTx__storage_)
-                                         flags:GPBDescriptorInitializationFlag_None];
+                                         flags:0];
     NSAssert(descriptor == nil, @"Startup recursed!");
     descriptor = localDescriptor;
   }
@@ -1116,7 +1364,7 @@ typedef struct ChainResponse__storage_ {
                                         fields:fields
                                     fieldCount:(uint32_t)(sizeof(fields) / sizeof(GPBMessageFieldDescription))
                                    storageSize:sizeof(ChainResponse__storage_)
-                                         flags:GPBDescriptorInitializationFlag_None];
+                                         flags:0];
     NSAssert(descriptor == nil, @"Startup recursed!");
     descriptor = localDescriptor;
   }
@@ -1164,7 +1412,7 @@ typedef struct ChainTxStatus__storage_ {
         .number = ChainTxStatus_FieldNumber_Status,
         .hasIndex = 0,
         .offset = (uint32_t)offsetof(ChainTxStatus__storage_, status),
-        .flags = (GPBFieldFlags)(GPBFieldOptional | GPBFieldHasEnumDescriptor),
+        .flags = GPBFieldOptional | GPBFieldHasEnumDescriptor,
         .dataType = GPBDataTypeEnum,
       },
       {
@@ -1218,7 +1466,7 @@ typedef struct ChainTxStatus__storage_ {
         .number = ChainTxStatus_FieldNumber_ErrorCode,
         .hasIndex = 6,
         .offset = (uint32_t)offsetof(ChainTxStatus__storage_, errorCode),
-        .flags = (GPBFieldFlags)(GPBFieldOptional | GPBFieldHasEnumDescriptor),
+        .flags = GPBFieldOptional | GPBFieldHasEnumDescriptor,
         .dataType = GPBDataTypeEnum,
       },
       {
@@ -1247,7 +1495,7 @@ typedef struct ChainTxStatus__storage_ {
                                         fields:fields
                                     fieldCount:(uint32_t)(sizeof(fields) / sizeof(GPBMessageFieldDescription))
                                    storageSize:sizeof(ChainTxStatus__storage_)
-                                         flags:GPBDescriptorInitializationFlag_None];
+                                         flags:0];
     NSAssert(descriptor == nil, @"Startup recursed!");
     descriptor = localDescriptor;
   }
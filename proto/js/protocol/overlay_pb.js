@@ -13,6 +13,8 @@ var global = Function('return this')();
 
 var common_pb = require('./common_pb.js');
 var chain_pb = require('./chain_pb.js');
+goog.exportSymbol('proto.protocol.AccountTree', null, global);
+goog.exportSymbol('proto.protocol.AccountTree.SyncCode', null, global);
 goog.exportSymbol('proto.protocol.ChainHello', null, global);
 goog.exportSymbol('proto.protocol.ChainMessageType', null, global);
 goog.exportSymbol('proto.protocol.ChainPeerMessage', null, global);
@@ -23,6 +25,7 @@ goog.exportSymbol('proto.protocol.ChainTxStatus', null, global);
 goog.exportSymbol('proto.protocol.ChainTxStatus.TxStatus', null, global);
 goog.exportSymbol('proto.protocol.DontHave', null, global);
 goog.exportSymbol('proto.protocol.EntryList', null, global);
+goog.exportSymbol('proto.protocol.GetAccountTree', null, global);
 goog.exportSymbol('proto.protocol.GetLedgers', null, global);
 goog.exportSymbol('proto.protocol.Hello', null, global);
 goog.exportSymbol('proto.protocol.HelloResponse', null, global);
@@ -75,17 +78,16 @@ proto.protocol.Hello.prototype.toObject = function(opt_includeInstance) {
  *     http://goto/soy-param-migration
  * @param {!proto.protocol.Hello} msg The msg instance to transform.
  * @return {!Object}
- * @suppress {unusedLocalVariables} f is only used for nested messages
  */
 proto.protocol.Hello.toObject = function(includeInstance, msg) {
   var f, obj = {
-    networkId: jspb.Message.getFieldWithDefault(msg, 1, 0),
-    ledgerVersion: jspb.Message.getFieldWithDefault(msg, 2, 0),
-    overlayVersion: jspb.Message.getFieldWithDefault(msg, 3, 0),
-    phantomVersion: jspb.Message.getFieldWithDefault(msg, 4, ""),
-    listeningPort: jspb.Message.getFieldWithDefault(msg, 5, 0),
-    nodeAddress: jspb.Message.getFieldWithDefault(msg, 6, ""),
-    nodeRand: jspb.Message.getFieldWithDefault(msg, 7, "")
+    networkId: msg.getNetworkId(),
+    ledgerVersion: msg.getLedgerVersion(),
+    overlayVersion: msg.getOverlayVersion(),
+    phantomVersion: msg.getPhantomVersion(),
+    listeningPort: msg.getListeningPort(),
+    nodeAddress: msg.getNodeAddress(),
+    nodeRand: msg.getNodeRand()
   };
 
   if (includeInstance) {
@@ -159,69 +161,78 @@ proto.protocol.Hello.deserializeBinaryFromReader = function(msg, reader) {
 };
 
 
+/**
+ * Class method variant: serializes the given message to binary data
+ * (in protobuf wire format), writing to the given BinaryWriter.
+ * @param {!proto.protocol.Hello} message
+ * @param {!jspb.BinaryWriter} writer
+ */
+proto.protocol.Hello.serializeBinaryToWriter = function(message, writer) {
+  message.serializeBinaryToWriter(writer);
+};
+
+
 /**
  * Serializes the message to binary data (in protobuf wire format).
  * @return {!Uint8Array}
  */
 proto.protocol.Hello.prototype.serializeBinary = function() {
   var writer = new jspb.BinaryWriter();
-  proto.protocol.Hello.serializeBinaryToWriter(this, writer);
+  this.serializeBinaryToWriter(writer);
   return writer.getResultBuffer();
 };
 
 
 /**
- * Serializes the given message to binary data (in protobuf wire
- * format), writing to the given BinaryWriter.
- * @param {!proto.protocol.Hello} message
+ * Serializes the message to binary data (in protobuf wire format),
+ * writing to the given BinaryWriter.
  * @param {!jspb.BinaryWriter} writer
- * @suppress {unusedLocalVariables} f is only used for nested messages
  */
-proto.protocol.Hello.serializeBinaryToWriter = function(message, writer) {
+proto.protocol.Hello.prototype.serializeBinaryToWriter = function (writer) {
   var f = undefined;
-  f = message.getNetworkId();
+  f = this.getNetworkId();
   if (f !== 0) {
     writer.writeInt64(
       1,
       f
     );
   }
-  f = message.getLedgerVersion();
+  f = this.getLedgerVersion();
   if (f !== 0) {
     writer.writeInt64(
       2,
       f
     );
   }
-  f = message.getOverlayVersion();
+  f = this.getOverlayVersion();
   if (f !== 0) {
     writer.writeInt64(
       3,
       f
     );
   }
-  f = message.getPhantomVersion();
+  f = this.getPhantomVersion();
   if (f.length > 0) {
     writer.writeString(
       4,
       f
     );
   }
-  f = message.getListeningPort();
+  f = this.getListeningPort();
   if (f !== 0) {
     writer.writeInt64(
       5,
       f
     );
   }
-  f = message.getNodeAddress();
+  f = this.getNodeAddress();
   if (f.length > 0) {
     writer.writeString(
       6,
       f
     );
   }
-  f = message.getNodeRand();
+  f = this.getNodeRand();
   if (f.length > 0) {
     writer.writeString(
       7,
@@ -231,18 +242,27 @@ proto.protocol.Hello.serializeBinaryToWriter = function(message, writer) {
 };
 
 
+/**
+ * Creates a deep clone of this proto. No data is shared with the original.
+ * @return {!proto.protocol.Hello} The clone.
+ */
+proto.protocol.Hello.prototype.cloneMessage = function() {
+  return /** @type {!proto.protocol.Hello} */ (jspb.Message.cloneMessage(this));
+};
+
+
 /**
  * optional int64 network_id = 1;
  * @return {number}
  */
 proto.protocol.Hello.prototype.getNetworkId = function() {
-  return /** @type {number} */ (jspb.Message.getFieldWithDefault(this, 1, 0));
+  return /** @type {number} */ (jspb.Message.getFieldProto3(this, 1, 0));
 };
 
 
-/** @param {number} value */
+/** @param {number} value  */
 proto.protocol.Hello.prototype.setNetworkId = function(value) {
-  jspb.Message.setProto3IntField(this, 1, value);
+  jspb.Message.setField(this, 1, value);
 };
 
 
@@ -251,13 +271,13 @@ proto.protocol.Hello.prototype.setNetworkId = function(value) {
  * @return {number}
  */
 proto.protocol.Hello.prototype.getLedgerVersion = function() {
-  return /** @type {number} */ (jspb.Message.getFieldWithDefault(this, 2, 0));
+  return /** @type {number} */ (jspb.Message.getFieldProto3(this, 2, 0));
 };
 
 
-/** @param {number} value */
+/** @param {number} value  */
 proto.protocol.Hello.prototype.setLedgerVersion = function(value) {
-  jspb.Message.setProto3IntField(this, 2, value);
+  jspb.Message.setField(this, 2, value);
 };
 
 
@@ -266,13 +286,13 @@ proto.protocol.Hello.prototype.setLedgerVersion = function(value) {
  * @return {number}
  */
 proto.protocol.Hello.prototype.getOverlayVersion = function() {
-  return /** @type {number} */ (jspb.Message.getFieldWithDefault(this, 3, 0));
+  return /** @type {number} */ (jspb.Message.getFieldProto3(this, 3, 0));
 };
 
 
-/** @param {number} value */
+/** @param {number} value  */
 proto.protocol.Hello.prototype.setOverlayVersion = function(value) {
-  jspb.Message.setProto3IntField(this, 3, value);
+  jspb.Message.setField(this, 3, value);
 };
 
 
@@ -281,13 +301,13 @@ proto.protocol.Hello.prototype.setOverlayVersion = function(value) {
  * @return {string}
  */
 proto.protocol.Hello.prototype.getPhantomVersion = function() {
-  return /** @type {string} */ (jspb.Message.getFieldWithDefault(this, 4, ""));
+  return /** @type {string} */ (jspb.Message.getFieldProto3(this, 4, ""));
 };
 
 
-/** @param {string} value */
+/** @param {string} value  */
 proto.protocol.Hello.prototype.setPhantomVersion = function(value) {
-  jspb.Message.setProto3StringField(this, 4, value);
+  jspb.Message.setField(this, 4, value);
 };
 
 
@@ -296,13 +316,13 @@ proto.protocol.Hello.prototype.setPhantomVersion = function(value) {
  * @return {number}
  */
 proto.protocol.Hello.prototype.getListeningPort = function() {
-  return /** @type {number} */ (jspb.Message.getFieldWithDefault(this, 5, 0));
+  return /** @type {number} */ (jspb.Message.getFieldProto3(this, 5, 0));
 };
 
 
-/** @param {number} value */
+/** @param {number} value  */
 proto.protocol.Hello.prototype.setListeningPort = function(value) {
-  jspb.Message.setProto3IntField(this, 5, value);
+  jspb.Message.setField(this, 5, value);
 };
 
 
@@ -311,13 +331,13 @@ proto.protocol.Hello.prototype.setListeningPort = function(value) {
  * @return {string}
  */
 proto.protocol.Hello.prototype.getNodeAddress = function() {
-  return /** @type {string} */ (jspb.Message.getFieldWithDefault(this, 6, ""));
+  return /** @type {string} */ (jspb.Message.getFieldProto3(this, 6, ""));
 };
 
 
-/** @param {string} value */
+/** @param {string} value  */
 proto.protocol.Hello.prototype.setNodeAddress = function(value) {
-  jspb.Message.setProto3StringField(this, 6, value);
+  jspb.Message.setField(this, 6, value);
 };
 
 
@@ -326,13 +346,13 @@ proto.protocol.Hello.prototype.setNodeAddress = function(value) {
  * @return {string}
  */
 proto.protocol.Hello.prototype.getNodeRand = function() {
-  return /** @type {string} */ (jspb.Message.getFieldWithDefault(this, 7, ""));
+  return /** @type {string} */ (jspb.Message.getFieldProto3(this, 7, ""));
 };
 
 
-/** @param {string} value */
+/** @param {string} value  */
 proto.protocol.Hello.prototype.setNodeRand = function(value) {
-  jspb.Message.setProto3StringField(this, 7, value);
+  jspb.Message.setField(this, 7, value);
 };
 
 
@@ -379,12 +399,11 @@ proto.protocol.HelloResponse.prototype.toObject = function(opt_includeInstance)
  *     http://goto/soy-param-migration
  * @param {!proto.protocol.HelloResponse} msg The msg instance to transform.
  * @return {!Object}
- * @suppress {unusedLocalVariables} f is only used for nested messages
  */
 proto.protocol.HelloResponse.toObject = function(includeInstance, msg) {
   var f, obj = {
-    errorCode: jspb.Message.getFieldWithDefault(msg, 1, 0),
-    errorDesc: jspb.Message.getFieldWithDefault(msg, 2, "")
+    errorCode: msg.getErrorCode(),
+    errorDesc: msg.getErrorDesc()
   };
 
   if (includeInstance) {
@@ -438,34 +457,43 @@ proto.protocol.HelloResponse.deserializeBinaryFromReader = function(msg, reader)
 };
 
 
+/**
+ * Class method variant: serializes the given message to binary data
+ * (in protobuf wire format), writing to the given BinaryWriter.
+ * @param {!proto.protocol.HelloResponse} message
+ * @param {!jspb.BinaryWriter} writer
+ */
+proto.protocol.HelloResponse.serializeBinaryToWriter = function(message, writer) {
+  message.serializeBinaryToWriter(writer);
+};
+
+
 /**
  * Serializes the message to binary data (in protobuf wire format).
  * @return {!Uint8Array}
  */
 proto.protocol.HelloResponse.prototype.serializeBinary = function() {
   var writer = new jspb.BinaryWriter();
-  proto.protocol.HelloResponse.serializeBinaryToWriter(this, writer);
+  this.serializeBinaryToWriter(writer);
   return writer.getResultBuffer();
 };
 
 
 /**
- * Serializes the given message to binary data (in protobuf wire
- * format), writing to the given BinaryWriter.
- * @param {!proto.protocol.HelloResponse} message
+ * Serializes the message to binary data (in protobuf wire format),
+ * writing to the given BinaryWriter.
  * @param {!jspb.BinaryWriter} writer
- * @suppress {unusedLocalVariables} f is only used for nested messages
  */
-proto.protocol.HelloResponse.serializeBinaryToWriter = function(message, writer) {
+proto.protocol.HelloResponse.prototype.serializeBinaryToWriter = function (writer) {
   var f = undefined;
-  f = message.getErrorCode();
+  f = this.getErrorCode();
   if (f !== 0.0) {
     writer.writeEnum(
       1,
       f
     );
   }
-  f = message.getErrorDesc();
+  f = this.getErrorDesc();
   if (f.length > 0) {
     writer.writeString(
       2,
@@ -475,18 +503,27 @@ proto.protocol.HelloResponse.serializeBinaryToWriter = function(message, writer)
 };
 
 
+/**
+ * Creates a deep clone of this proto. No data is shared with the original.
+ * @return {!proto.protocol.HelloResponse} The clone.
+ */
+proto.protocol.HelloResponse.prototype.cloneMessage = function() {
+  return /** @type {!proto.protocol.HelloResponse} */ (jspb.Message.cloneMessage(this));
+};
+
+
 /**
  * optional ERRORCODE error_code = 1;
  * @return {!proto.protocol.ERRORCODE}
  */
 proto.protocol.HelloResponse.prototype.getErrorCode = function() {
-  return /** @type {!proto.protocol.ERRORCODE} */ (jspb.Message.getFieldWithDefault(this, 1, 0));
+  return /** @type {!proto.protocol.ERRORCODE} */ (jspb.Message.getFieldProto3(this, 1, 0));
 };
 
 
-/** @param {!proto.protocol.ERRORCODE} value */
+/** @param {!proto.protocol.ERRORCODE} value  */
 proto.protocol.HelloResponse.prototype.setErrorCode = function(value) {
-  jspb.Message.setProto3EnumField(this, 1, value);
+  jspb.Message.setField(this, 1, value);
 };
 
 
@@ -495,13 +532,13 @@ proto.protocol.HelloResponse.prototype.setErrorCode = function(value) {
  * @return {string}
  */
 proto.protocol.HelloResponse.prototype.getErrorDesc = function() {
-  return /** @type {string} */ (jspb.Message.getFieldWithDefault(this, 2, ""));
+  return /** @type {string} */ (jspb.Message.getFieldProto3(this, 2, ""));
 };
 
 
-/** @param {string} value */
+/** @param {string} value  */
 proto.protocol.HelloResponse.prototype.setErrorDesc = function(value) {
-  jspb.Message.setProto3StringField(this, 2, value);
+  jspb.Message.setField(this, 2, value);
 };
 
 
@@ -548,16 +585,15 @@ proto.protocol.Peer.prototype.toObject = function(opt_includeInstance) {
  *     http://goto/soy-param-migration
  * @param {!proto.protocol.Peer} msg The msg instance to transform.
  * @return {!Object}
- * @suppress {unusedLocalVariables} f is only used for nested messages
  */
 proto.protocol.Peer.toObject = function(includeInstance, msg) {
   var f, obj = {
-    ip: jspb.Message.getFieldWithDefault(msg, 1, ""),
-    port: jspb.Message.getFieldWithDefault(msg, 2, 0),
-    numFailures: jspb.Message.getFieldWithDefault(msg, 3, 0),
-    nextAttemptTime: jspb.Message.getFieldWithDefault(msg, 4, 0),
-    activeTime: jspb.Message.getFieldWithDefault(msg, 5, 0),
-    connectionId: jspb.Message.getFieldWithDefault(msg, 6, 0)
+    ip: msg.getIp(),
+    port: msg.getPort(),
+    numFailures: msg.getNumFailures(),
+    nextAttemptTime: msg.getNextAttemptTime(),
+    activeTime: msg.getActiveTime(),
+    connectionId: msg.getConnectionId()
   };
 
   if (includeInstance) {
@@ -627,62 +663,71 @@ proto.protocol.Peer.deserializeBinaryFromReader = function(msg, reader) {
 };
 
 
+/**
+ * Class method variant: serializes the given message to binary data
+ * (in protobuf wire format), writing to the given BinaryWriter.
+ * @param {!proto.protocol.Peer} message
+ * @param {!jspb.BinaryWriter} writer
+ */
+proto.protocol.Peer.serializeBinaryToWriter = function(message, writer) {
+  message.serializeBinaryToWriter(writer);
+};
+
+
 /**
  * Serializes the message to binary data (in protobuf wire format).
  * @return {!Uint8Array}
  */
 proto.protocol.Peer.prototype.serializeBinary = function() {
   var writer = new jspb.BinaryWriter();
-  proto.protocol.Peer.serializeBinaryToWriter(this, writer);
+  this.serializeBinaryToWriter(writer);
   return writer.getResultBuffer();
 };
 
 
 /**
- * Serializes the given message to binary data (in protobuf wire
- * format), writing to the given BinaryWriter.
- * @param {!proto.protocol.Peer} message
+ * Serializes the message to binary data (in protobuf wire format),
+ * writing to the given BinaryWriter.
  * @param {!jspb.BinaryWriter} writer
- * @suppress {unusedLocalVariables} f is only used for nested messages
  */
-proto.protocol.Peer.serializeBinaryToWriter = function(message, writer) {
+proto.protocol.Peer.prototype.serializeBinaryToWriter = function (writer) {
   var f = undefined;
-  f = message.getIp();
+  f = this.getIp();
   if (f.length > 0) {
     writer.writeString(
       1,
       f
     );
   }
-  f = message.getPort();
+  f = this.getPort();
   if (f !== 0) {
     writer.writeInt64(
       2,
       f
     );
   }
-  f = message.getNumFailures();
+  f = this.getNumFailures();
   if (f !== 0) {
     writer.writeInt64(
       3,
       f
     );
   }
-  f = message.getNextAttemptTime();
+  f = this.getNextAttemptTime();
   if (f !== 0) {
     writer.writeInt64(
       4,
       f
     );
   }
-  f = message.getActiveTime();
+  f = this.getActiveTime();
   if (f !== 0) {
     writer.writeInt64(
       5,
       f
     );
   }
-  f = message.getConnectionId();
+  f = this.getConnectionId();
   if (f !== 0) {
     writer.writeInt64(
       6,
@@ -692,18 +737,27 @@ proto.protocol.Peer.serializeBinaryToWriter = function(message, writer) {
 };
 
 
+/**
+ * Creates a deep clone of this proto. No data is shared with the original.
+ * @return {!proto.protocol.Peer} The clone.
+ */
+proto.protocol.Peer.prototype.cloneMessage = function() {
+  return /** @type {!proto.protocol.Peer} */ (jspb.Message.cloneMessage(this));
+};
+
+
 /**
  * optional string ip = 1;
  * @return {string}
  */
 proto.protocol.Peer.prototype.getIp = function() {
-  return /** @type {string} */ (jspb.Message.getFieldWithDefault(this, 1, ""));
+  return /** @type {string} */ (jspb.Message.getFieldProto3(this, 1, ""));
 };
 
 
-/** @param {string} value */
+/** @param {string} value  */
 proto.protocol.Peer.prototype.setIp = function(value) {
-  jspb.Message.setProto3StringField(this, 1, value);
+  jspb.Message.setField(this, 1, value);
 };
 
 
@@ -712,13 +766,13 @@ proto.protocol.Peer.prototype.setIp = function(value) {
  * @return {number}
  */
 proto.protocol.Peer.prototype.getPort = function() {
-  return /** @type {number} */ (jspb.Message.getFieldWithDefault(this, 2, 0));
+  return /** @type {number} */ (jspb.Message.getFieldProto3(this, 2, 0));
 };
 
 
-/** @param {number} value */
+/** @param {number} value  */
 proto.protocol.Peer.prototype.setPort = function(value) {
-  jspb.Message.setProto3IntField(this, 2, value);
+  jspb.Message.setField(this, 2, value);
 };
 
 
@@ -727,13 +781,13 @@ proto.protocol.Peer.prototype.setPort = function(value) {
  * @return {number}
  */
 proto.protocol.Peer.prototype.getNumFailures = function() {
-  return /** @type {number} */ (jspb.Message.getFieldWithDefault(this, 3, 0));
+  return /** @type {number} */ (jspb.Message.getFieldProto3(this, 3, 0));
 };
 
 
-/** @param {number} value */
+/** @param {number} value  */
 proto.protocol.Peer.prototype.setNumFailures = function(value) {
-  jspb.Message.setProto3IntField(this, 3, value);
+  jspb.Message.setField(this, 3, value);
 };
 
 
@@ -742,13 +796,13 @@ proto.protocol.Peer.prototype.setNumFailures = function(value) {
  * @return {number}
  */
 proto.protocol.Peer.prototype.getNextAttemptTime = function() {
-  return /** @type {number} */ (jspb.Message.getFieldWithDefault(this, 4, 0));
+  return /** @type {number} */ (jspb.Message.getFieldProto3(this, 4, 0));
 };
 
 
-/** @param {number} value */
+/** @param {number} value  */
 proto.protocol.Peer.prototype.setNextAttemptTime = function(value) {
-  jspb.Message.setProto3IntField(this, 4, value);
+  jspb.Message.setField(this, 4, value);
 };
 
 
@@ -757,13 +811,13 @@ proto.protocol.Peer.prototype.setNextAttemptTime = function(value) {
  * @return {number}
  */
 proto.protocol.Peer.prototype.getActiveTime = function() {
-  return /** @type {number} */ (jspb.Message.getFieldWithDefault(this, 5, 0));
+  return /** @type {number} */ (jspb.Message.getFieldProto3(this, 5, 0));
 };
 
 
-/** @param {number} value */
+/** @param {number} value  */
 proto.protocol.Peer.prototype.setActiveTime = function(value) {
-  jspb.Message.setProto3IntField(this, 5, value);
+  jspb.Message.setField(this, 5, value);
 };
 
 
@@ -772,13 +826,13 @@ proto.protocol.Peer.prototype.setActiveTime = function(value) {
  * @return {number}
  */
 proto.protocol.Peer.prototype.getConnectionId = function() {
-  return /** @type {number} */ (jspb.Message.getFieldWithDefault(this, 6, 0));
+  return /** @type {number} */ (jspb.Message.getFieldProto3(this, 6, 0));
 };
 
 
-/** @param {number} value */
+/** @param {number} value  */
 proto.protocol.Peer.prototype.setConnectionId = function(value) {
-  jspb.Message.setProto3IntField(this, 6, value);
+  jspb.Message.setField(this, 6, value);
 };
 
 
@@ -832,7 +886,6 @@ proto.protocol.Peers.prototype.toObject = function(opt_includeInstance) {
  *     http://goto/soy-param-migration
  * @param {!proto.protocol.Peers} msg The msg instance to transform.
  * @return {!Object}
- * @suppress {unusedLocalVariables} f is only used for nested messages
  */
 proto.protocol.Peers.toObject = function(includeInstance, msg) {
   var f, obj = {
@@ -877,7 +930,8 @@ proto.protocol.Peers.deserializeBinaryFromReader = function(msg, reader) {
     case 1:
       var value = new proto.protocol.Peer;
       reader.readMessage(value,proto.protocol.Peer.deserializeBinaryFromReader);
-      msg.addPeers(value);
+      msg.getPeersList().push(value);
+      msg.setPeersList(msg.getPeersList());
       break;
     default:
       reader.skipField();
@@ -888,27 +942,36 @@ proto.protocol.Peers.deserializeBinaryFromReader = function(msg, reader) {
 };
 
 
+/**
+ * Class method variant: serializes the given message to binary data
+ * (in protobuf wire format), writing to the given BinaryWriter.
+ * @param {!proto.protocol.Peers} message
+ * @param {!jspb.BinaryWriter} writer
+ */
+proto.protocol.Peers.serializeBinaryToWriter = function(message, writer) {
+  message.serializeBinaryToWriter(writer);
+};
+
+
 /**
  * Serializes the message to binary data (in protobuf wire format).
  * @return {!Uint8Array}
  */
 proto.protocol.Peers.prototype.serializeBinary = function() {
   var writer = new jspb.BinaryWriter();
-  proto.protocol.Peers.serializeBinaryToWriter(this, writer);
+  this.serializeBinaryToWriter(writer);
   return writer.getResultBuffer();
 };
 
 
 /**
- * Serializes the given message to binary data (in protobuf wire
- * format), writing to the given BinaryWriter.
- * @param {!proto.protocol.Peers} message
+ * Serializes the message to binary data (in protobuf wire format),
+ * writing to the given BinaryWriter.
  * @param {!jspb.BinaryWriter} writer
- * @suppress {unusedLocalVariables} f is only used for nested messages
  */
-proto.protocol.Peers.serializeBinaryToWriter = function(message, writer) {
+proto.protocol.Peers.prototype.serializeBinaryToWriter = function (writer) {
   var f = undefined;
-  f = message.getPeersList();
+  f = this.getPeersList();
   if (f.length > 0) {
     writer.writeRepeatedMessage(
       1,
@@ -919,8 +982,19 @@ proto.protocol.Peers.serializeBinaryToWriter = function(message, writer) {
 };
 
 
+/**
+ * Creates a deep clone of this proto. No data is shared with the original.
+ * @return {!proto.protocol.Peers} The clone.
+ */
+proto.protocol.Peers.prototype.cloneMessage = function() {
+  return /** @type {!proto.protocol.Peers} */ (jspb.Message.cloneMessage(this));
+};
+
+
 /**
  * repeated Peer peers = 1;
+ * If you change this array by adding, removing or replacing elements, or if you
+ * replace the array itself, then you must call the setter to update it.
  * @return {!Array.<!proto.protocol.Peer>}
  */
 proto.protocol.Peers.prototype.getPeersList = function() {
@@ -929,22 +1003,12 @@ proto.protocol.Peers.prototype.getPeersList = function() {
 };
 
 
-/** @param {!Array.<!proto.protocol.Peer>} value */
+/** @param {Array.<!proto.protocol.Peer>} value  */
 proto.protocol.Peers.prototype.setPeersList = function(value) {
   jspb.Message.setRepeatedWrapperField(this, 1, value);
 };
 
 
-/**
- * @param {!proto.protocol.Peer=} opt_value
- * @param {number=} opt_index
- * @return {!proto.protocol.Peer}
- */
-proto.protocol.Peers.prototype.addPeers = function(opt_value, opt_index) {
-  return jspb.Message.addToRepeatedWrapperField(this, 1, opt_value, proto.protocol.Peer, opt_index);
-};
-
-
 proto.protocol.Peers.prototype.clearPeersList = function() {
   this.setPeersList([]);
 };
@@ -993,13 +1057,12 @@ proto.protocol.GetLedgers.prototype.toObject = function(opt_includeInstance) {
  *     http://goto/soy-param-migration
  * @param {!proto.protocol.GetLedgers} msg The msg instance to transform.
  * @return {!Object}
- * @suppress {unusedLocalVariables} f is only used for nested messages
  */
 proto.protocol.GetLedgers.toObject = function(includeInstance, msg) {
   var f, obj = {
-    begin: jspb.Message.getFieldWithDefault(msg, 1, 0),
-    end: jspb.Message.getFieldWithDefault(msg, 2, 0),
-    timestamp: jspb.Message.getFieldWithDefault(msg, 3, 0)
+    begin: msg.getBegin(),
+    end: msg.getEnd(),
+    timestamp: msg.getTimestamp()
   };
 
   if (includeInstance) {
@@ -1057,41 +1120,50 @@ proto.protocol.GetLedgers.deserializeBinaryFromReader = function(msg, reader) {
 };
 
 
+/**
+ * Class method variant: serializes the given message to binary data
+ * (in protobuf wire format), writing to the given BinaryWriter.
+ * @param {!proto.protocol.GetLedgers} message
+ * @param {!jspb.BinaryWriter} writer
+ */
+proto.protocol.GetLedgers.serializeBinaryToWriter = function(message, writer) {
+  message.serializeBinaryToWriter(writer);
+};
+
+
 /**
  * Serializes the message to binary data (in protobuf wire format).
  * @return {!Uint8Array}
  */
 proto.protocol.GetLedgers.prototype.serializeBinary = function() {
   var writer = new jspb.BinaryWriter();
-  proto.protocol.GetLedgers.serializeBinaryToWriter(this, writer);
+  this.serializeBinaryToWriter(writer);
   return writer.getResultBuffer();
 };
 
 
 /**
- * Serializes the given message to binary data (in protobuf wire
- * format), writing to the given BinaryWriter.
- * @param {!proto.protocol.GetLedgers} message
+ * Serializes the message to binary data (in protobuf wire format),
+ * writing to the given BinaryWriter.
  * @param {!jspb.BinaryWriter} writer
- * @suppress {unusedLocalVariables} f is only used for nested messages
  */
-proto.protocol.GetLedgers.serializeBinaryToWriter = function(message, writer) {
+proto.protocol.GetLedgers.prototype.serializeBinaryToWriter = function (writer) {
   var f = undefined;
-  f = message.getBegin();
+  f = this.getBegin();
   if (f !== 0) {
     writer.writeInt64(
       1,
       f
     );
   }
-  f = message.getEnd();
+  f = this.getEnd();
   if (f !== 0) {
     writer.writeInt64(
       2,
       f
     );
   }
-  f = message.getTimestamp();
+  f = this.getTimestamp();
   if (f !== 0) {
     writer.writeInt64(
       3,
@@ -1101,18 +1173,27 @@ proto.protocol.GetLedgers.serializeBinaryToWriter = function(message, writer) {
 };
 
 
+/**
+ * Creates a deep clone of this proto. No data is shared with the original.
+ * @return {!proto.protocol.GetLedgers} The clone.
+ */
+proto.protocol.GetLedgers.prototype.cloneMessage = function() {
+  return /** @type {!proto.protocol.GetLedgers} */ (jspb.Message.cloneMessage(this));
+};
+
+
 /**
  * optional int64 begin = 1;
  * @return {number}
  */
 proto.protocol.GetLedgers.prototype.getBegin = function() {
-  return /** @type {number} */ (jspb.Message.getFieldWithDefault(this, 1, 0));
+  return /** @type {number} */ (jspb.Message.getFieldProto3(this, 1, 0));
 };
 
 
-/** @param {number} value */
+/** @param {number} value  */
 proto.protocol.GetLedgers.prototype.setBegin = function(value) {
-  jspb.Message.setProto3IntField(this, 1, value);
+  jspb.Message.setField(this, 1, value);
 };
 
 
@@ -1121,13 +1202,13 @@ proto.protocol.GetLedgers.prototype.setBegin = function(value) {
  * @return {number}
  */
 proto.protocol.GetLedgers.prototype.getEnd = function() {
-  return /** @type {number} */ (jspb.Message.getFieldWithDefault(this, 2, 0));
+  return /** @type {number} */ (jspb.Message.getFieldProto3(this, 2, 0));
 };
 
 
-/** @param {number} value */
+/** @param {number} value  */
 proto.protocol.GetLedgers.prototype.setEnd = function(value) {
-  jspb.Message.setProto3IntField(this, 2, value);
+  jspb.Message.setField(this, 2, value);
 };
 
 
@@ -1136,13 +1217,13 @@ proto.protocol.GetLedgers.prototype.setEnd = function(value) {
  * @return {number}
  */
 proto.protocol.GetLedgers.prototype.getTimestamp = function() {
-  return /** @type {number} */ (jspb.Message.getFieldWithDefault(this, 3, 0));
+  return /** @type {number} */ (jspb.Message.getFieldProto3(this, 3, 0));
 };
 
 
-/** @param {number} value */
+/** @param {number} value  */
 proto.protocol.GetLedgers.prototype.setTimestamp = function(value) {
-  jspb.Message.setProto3IntField(this, 3, value);
+  jspb.Message.setField(this, 3, value);
 };
 
 
@@ -1196,14 +1277,13 @@ proto.protocol.Ledgers.prototype.toObject = function(opt_includeInstance) {
  *     http://goto/soy-param-migration
  * @param {!proto.protocol.Ledgers} msg The msg instance to transform.
  * @return {!Object}
- * @suppress {unusedLocalVariables} f is only used for nested messages
  */
 proto.protocol.Ledgers.toObject = function(includeInstance, msg) {
   var f, obj = {
     valuesList: jspb.Message.toObjectList(msg.getValuesList(),
     chain_pb.ConsensusValue.toObject, includeInstance),
-    syncCode: jspb.Message.getFieldWithDefault(msg, 2, 0),
-    maxSeq: jspb.Message.getFieldWithDefault(msg, 3, 0),
+    syncCode: msg.getSyncCode(),
+    maxSeq: msg.getMaxSeq(),
     proof: msg.getProof_asB64()
   };
 
@@ -1244,7 +1324,8 @@ proto.protocol.Ledgers.deserializeBinaryFromReader = function(msg, reader) {
     case 1:
       var value = new chain_pb.ConsensusValue;
       reader.readMessage(value,chain_pb.ConsensusValue.deserializeBinaryFromReader);
-      msg.addValues(value);
+      msg.getValuesList().push(value);
+      msg.setValuesList(msg.getValuesList());
       break;
     case 2:
       var value = /** @type {!proto.protocol.Ledgers.SyncCode} */ (reader.readEnum());
@@ -1267,27 +1348,36 @@ proto.protocol.Ledgers.deserializeBinaryFromReader = function(msg, reader) {
 };
 
 
+/**
+ * Class method variant: serializes the given message to binary data
+ * (in protobuf wire format), writing to the given BinaryWriter.
+ * @param {!proto.protocol.Ledgers} message
+ * @param {!jspb.BinaryWriter} writer
+ */
+proto.protocol.Ledgers.serializeBinaryToWriter = function(message, writer) {
+  message.serializeBinaryToWriter(writer);
+};
+
+
 /**
  * Serializes the message to binary data (in protobuf wire format).
  * @return {!Uint8Array}
  */
 proto.protocol.Ledgers.prototype.serializeBinary = function() {
   var writer = new jspb.BinaryWriter();
-  proto.protocol.Ledgers.serializeBinaryToWriter(this, writer);
+  this.serializeBinaryToWriter(writer);
   return writer.getResultBuffer();
 };
 
 
 /**
- * Serializes the given message to binary data (in protobuf wire
- * format), writing to the given BinaryWriter.
- * @param {!proto.protocol.Ledgers} message
+ * Serializes the message to binary data (in protobuf wire format),
+ * writing to the given BinaryWriter.
  * @param {!jspb.BinaryWriter} writer
- * @suppress {unusedLocalVariables} f is only used for nested messages
  */
-proto.protocol.Ledgers.serializeBinaryToWriter = function(message, writer) {
+proto.protocol.Ledgers.prototype.serializeBinaryToWriter = function (writer) {
   var f = undefined;
-  f = message.getValuesList();
+  f = this.getValuesList();
   if (f.length > 0) {
     writer.writeRepeatedMessage(
       1,
@@ -1295,21 +1385,21 @@ proto.protocol.Ledgers.serializeBinaryToWriter = function(message, writer) {
       chain_pb.ConsensusValue.serializeBinaryToWriter
     );
   }
-  f = message.getSyncCode();
+  f = this.getSyncCode();
   if (f !== 0.0) {
     writer.writeEnum(
       2,
       f
     );
   }
-  f = message.getMaxSeq();
+  f = this.getMaxSeq();
   if (f !== 0) {
     writer.writeInt64(
       3,
       f
     );
   }
-  f = message.getProof_asU8();
+  f = this.getProof_asU8();
   if (f.length > 0) {
     writer.writeBytes(
       4,
@@ -1320,117 +1410,888 @@ proto.protocol.Ledgers.serializeBinaryToWriter = function(message, writer) {
 
 
 /**
- * @enum {number}
+ * Creates a deep clone of this proto. No data is shared with the original.
+ * @return {!proto.protocol.Ledgers} The clone.
+ */
+proto.protocol.Ledgers.prototype.cloneMessage = function() {
+  return /** @type {!proto.protocol.Ledgers} */ (jspb.Message.cloneMessage(this));
+};
+
+
+/**
+ * repeated ConsensusValue values = 1;
+ * If you change this array by adding, removing or replacing elements, or if you
+ * replace the array itself, then you must call the setter to update it.
+ * @return {!Array.<!proto.protocol.ConsensusValue>}
+ */
+proto.protocol.Ledgers.prototype.getValuesList = function() {
+  return /** @type{!Array.<!proto.protocol.ConsensusValue>} */ (
+    jspb.Message.getRepeatedWrapperField(this, chain_pb.ConsensusValue, 1));
+};
+
+
+/** @param {Array.<!proto.protocol.ConsensusValue>} value  */
+proto.protocol.Ledgers.prototype.setValuesList = function(value) {
+  jspb.Message.setRepeatedWrapperField(this, 1, value);
+};
+
+
+proto.protocol.Ledgers.prototype.clearValuesList = function() {
+  this.setValuesList([]);
+};
+
+
+/**
+ * optional SyncCode sync_code = 2;
+ * @return {!proto.protocol.Ledgers.SyncCode}
+ */
+proto.protocol.Ledgers.prototype.getSyncCode = function() {
+  return /** @type {!proto.protocol.Ledgers.SyncCode} */ (jspb.Message.getFieldProto3(this, 2, 0));
+};
+
+
+/** @param {!proto.protocol.Ledgers.SyncCode} value  */
+proto.protocol.Ledgers.prototype.setSyncCode = function(value) {
+  jspb.Message.setField(this, 2, value);
+};
+
+
+/**
+ * optional int64 max_seq = 3;
+ * @return {number}
+ */
+proto.protocol.Ledgers.prototype.getMaxSeq = function() {
+  return /** @type {number} */ (jspb.Message.getFieldProto3(this, 3, 0));
+};
+
+
+/** @param {number} value  */
+proto.protocol.Ledgers.prototype.setMaxSeq = function(value) {
+  jspb.Message.setField(this, 3, value);
+};
+
+
+/**
+ * optional bytes proof = 4;
+ * @return {!(string|Uint8Array)}
+ */
+proto.protocol.Ledgers.prototype.getProof = function() {
+  return /** @type {!(string|Uint8Array)} */ (jspb.Message.getFieldProto3(this, 4, ""));
+};
+
+
+/**
+ * optional bytes proof = 4;
+ * This is a type-conversion wrapper around `getProof()`
+ * @return {string}
+ */
+proto.protocol.Ledgers.prototype.getProof_asB64 = function() {
+  return /** @type {string} */ (jspb.Message.bytesAsB64(
+      this.getProof()));
+};
+
+
+/**
+ * optional bytes proof = 4;
+ * Note that Uint8Array is not supported on all browsers.
+ * @see http://caniuse.com/Uint8Array
+ * This is a type-conversion wrapper around `getProof()`
+ * @return {!Uint8Array}
+ */
+proto.protocol.Ledgers.prototype.getProof_asU8 = function() {
+  return /** @type {!Uint8Array} */ (jspb.Message.bytesAsU8(
+      this.getProof()));
+};
+
+
+/** @param {!(string|Uint8Array)} value  */
+proto.protocol.Ledgers.prototype.setProof = function(value) {
+  jspb.Message.setField(this, 4, value);
+};
+
+
+/**
+ * @enum {number}
+ */
+proto.protocol.Ledgers.SyncCode = {
+  OK: 0,
+  OUT_OF_SYNC: 1,
+  OUT_OF_LEDGERS: 2,
+  BUSY: 3,
+  REFUSE: 4,
+  INTERNAL: 5
+};
+
+
+/**
+ * Generated by JsPbCodeGenerator.
+ * @param {Array=} opt_data Optional initial data array, typically from a
+ * server response, or constructed directly in Javascript. The array is used
+ * in place and becomes part of the constructed object. It is not cloned.
+ * If no data is provided, the constructed object will be empty, but still
+ * valid.
+ * @extends {jspb.Message}
+ * @constructor
+ */
+proto.protocol.GetAccountTree = function(opt_data) {
+  jspb.Message.initialize(this, opt_data, 0, -1, proto.protocol.GetAccountTree.repeatedFields_, null);
+};
+goog.inherits(proto.protocol.GetAccountTree, jspb.Message);
+if (goog.DEBUG && !COMPILED) {
+  proto.protocol.GetAccountTree.displayName = 'proto.protocol.GetAccountTree';
+}
+/**
+ * List of repeated fields within this message type.
+ * @private {!Array<number>}
+ * @const
+ */
+proto.protocol.GetAccountTree.repeatedFields_ = [2];
+
+
+
+if (jspb.Message.GENERATE_TO_OBJECT) {
+/**
+ * Creates an object representation of this proto suitable for use in Soy templates.
+ * Field names that are reserved in JavaScript and will be renamed to pb_name.
+ * To access a reserved field use, foo.pb_<name>, eg, foo.pb_default.
+ * For the list of reserved names please see:
+ *     com.google.apps.jspb.JsClassTemplate.JS_RESERVED_WORDS.
+ * @param {boolean=} opt_includeInstance Whether to include the JSPB instance
+ *     for transitional soy proto support: http://goto/soy-param-migration
+ * @return {!Object}
+ */
+proto.protocol.GetAccountTree.prototype.toObject = function(opt_includeInstance) {
+  return proto.protocol.GetAccountTree.toObject(opt_includeInstance, this);
+};
+
+
+/**
+ * Static version of the {@see toObject} method.
+ * @param {boolean|undefined} includeInstance Whether to include the JSPB
+ *     instance for transitional soy proto support:
+ *     http://goto/soy-param-migration
+ * @param {!proto.protocol.GetAccountTree} msg The msg instance to transform.
+ * @return {!Object}
+ */
+proto.protocol.GetAccountTree.toObject = function(includeInstance, msg) {
+  var f, obj = {
+    ledgerSeq: msg.getLedgerSeq(),
+    keysList: msg.getKeysList_asB64(),
+    timestamp: msg.getTimestamp()
+  };
+
+  if (includeInstance) {
+    obj.$jspbMessageInstance = msg;
+  }
+  return obj;
+};
+}
+
+
+/**
+ * Deserializes binary data (in protobuf wire format).
+ * @param {jspb.ByteSource} bytes The bytes to deserialize.
+ * @return {!proto.protocol.GetAccountTree}
+ */
+proto.protocol.GetAccountTree.deserializeBinary = function(bytes) {
+  var reader = new jspb.BinaryReader(bytes);
+  var msg = new proto.protocol.GetAccountTree;
+  return proto.protocol.GetAccountTree.deserializeBinaryFromReader(msg, reader);
+};
+
+
+/**
+ * Deserializes binary data (in protobuf wire format) from the
+ * given reader into the given message object.
+ * @param {!proto.protocol.GetAccountTree} msg The message object to deserialize into.
+ * @param {!jspb.BinaryReader} reader The BinaryReader to use.
+ * @return {!proto.protocol.GetAccountTree}
+ */
+proto.protocol.GetAccountTree.deserializeBinaryFromReader = function(msg, reader) {
+  while (reader.nextField()) {
+    if (reader.isEndGroup()) {
+      break;
+    }
+    var field = reader.getFieldNumber();
+    switch (field) {
+    case 1:
+      var value = /** @type {number} */ (reader.readInt64());
+      msg.setLedgerSeq(value);
+      break;
+    case 2:
+      var value = /** @type {!Uint8Array} */ (reader.readBytes());
+      msg.getKeysList().push(value);
+      msg.setKeysList(msg.getKeysList());
+      break;
+    case 3:
+      var value = /** @type {number} */ (reader.readInt64());
+      msg.setTimestamp(value);
+      break;
+    default:
+      reader.skipField();
+      break;
+    }
+  }
+  return msg;
+};
+
+
+/**
+ * Class method variant: serializes the given message to binary data
+ * (in protobuf wire format), writing to the given BinaryWriter.
+ * @param {!proto.protocol.GetAccountTree} message
+ * @param {!jspb.BinaryWriter} writer
+ */
+proto.protocol.GetAccountTree.serializeBinaryToWriter = function(message, writer) {
+  message.serializeBinaryToWriter(writer);
+};
+
+
+/**
+ * Serializes the message to binary data (in protobuf wire format).
+ * @return {!Uint8Array}
+ */
+proto.protocol.GetAccountTree.prototype.serializeBinary = function() {
+  var writer = new jspb.BinaryWriter();
+  this.serializeBinaryToWriter(writer);
+  return writer.getResultBuffer();
+};
+
+
+/**
+ * Serializes the message to binary data (in protobuf wire format),
+ * writing to the given BinaryWriter.
+ * @param {!jspb.BinaryWriter} writer
+ */
+proto.protocol.GetAccountTree.prototype.serializeBinaryToWriter = function (writer) {
+  var f = undefined;
+  f = this.getLedgerSeq();
+  if (f !== 0) {
+    writer.writeInt64(
+      1,
+      f
+    );
+  }
+  f = this.getKeysList_asU8();
+  if (f.length > 0) {
+    writer.writeRepeatedBytes(
+      2,
+      f
+    );
+  }
+  f = this.getTimestamp();
+  if (f !== 0) {
+    writer.writeInt64(
+      3,
+      f
+    );
+  }
+};
+
+
+/**
+ * Creates a deep clone of this proto. No data is shared with the original.
+ * @return {!proto.protocol.GetAccountTree} The clone.
+ */
+proto.protocol.GetAccountTree.prototype.cloneMessage = function() {
+  return /** @type {!proto.protocol.GetAccountTree} */ (jspb.Message.cloneMessage(this));
+};
+
+
+/**
+ * optional int64 ledger_seq = 1;
+ * @return {number}
+ */
+proto.protocol.GetAccountTree.prototype.getLedgerSeq = function() {
+  return /** @type {number} */ (jspb.Message.getFieldProto3(this, 1, 0));
+};
+
+
+/** @param {number} value  */
+proto.protocol.GetAccountTree.prototype.setLedgerSeq = function(value) {
+  jspb.Message.setField(this, 1, value);
+};
+
+
+/**
+ * repeated bytes keys = 2;
+ * If you change this array by adding, removing or replacing elements, or if you
+ * replace the array itself, then you must call the setter to update it.
+ * @return {!(Array<!Uint8Array>|Array<string>)}
+ */
+proto.protocol.GetAccountTree.prototype.getKeysList = function() {
+  return /** @type {!(Array<!Uint8Array>|Array<string>)} */ (jspb.Message.getField(this, 2));
+};
+
+
+/**
+ * repeated bytes keys = 2;
+ * If you change this array by adding, removing or replacing elements, or if you
+ * replace the array itself, then you must call the setter to update it.
+ * This is a type-conversion wrapper around `getKeysList()`
+ * @return {!Array.<string>}
+ */
+proto.protocol.GetAccountTree.prototype.getKeysList_asB64 = function() {
+  return /** @type {!Array.<string>} */ (jspb.Message.bytesListAsB64(
+      this.getKeysList()));
+};
+
+
+/**
+ * repeated bytes keys = 2;
+ * If you change this array by adding, removing or replacing elements, or if you
+ * replace the array itself, then you must call the setter to update it.
+ * Note that Uint8Array is not supported on all browsers.
+ * @see http://caniuse.com/Uint8Array
+ * This is a type-conversion wrapper around `getKeysList()`
+ * @return {!Array.<!Uint8Array>}
+ */
+proto.protocol.GetAccountTree.prototype.getKeysList_asU8 = function() {
+  return /** @type {!Array.<!Uint8Array>} */ (jspb.Message.bytesListAsU8(
+      this.getKeysList()));
+};
+
+
+/** @param {!(Array<!Uint8Array>|Array<string>)} value  */
+proto.protocol.GetAccountTree.prototype.setKeysList = function(value) {
+  jspb.Message.setField(this, 2, value || []);
+};
+
+
+proto.protocol.GetAccountTree.prototype.clearKeysList = function() {
+  jspb.Message.setField(this, 2, []);
+};
+
+
+/**
+ * optional int64 timestamp = 3;
+ * @return {number}
+ */
+proto.protocol.GetAccountTree.prototype.getTimestamp = function() {
+  return /** @type {number} */ (jspb.Message.getFieldProto3(this, 3, 0));
+};
+
+
+/** @param {number} value  */
+proto.protocol.GetAccountTree.prototype.setTimestamp = function(value) {
+  jspb.Message.setField(this, 3, value);
+};
+
+
+
+/**
+ * Generated by JsPbCodeGenerator.
+ * @param {Array=} opt_data Optional initial data array, typically from a
+ * server response, or constructed directly in Javascript. The array is used
+ * in place and becomes part of the constructed object. It is not cloned.
+ * If no data is provided, the constructed object will be empty, but still
+ * valid.
+ * @extends {jspb.Message}
+ * @constructor
+ */
+proto.protocol.AccountTree = function(opt_data) {
+  jspb.Message.initialize(this, opt_data, 0, -1, proto.protocol.AccountTree.repeatedFields_, null);
+};
+goog.inherits(proto.protocol.AccountTree, jspb.Message);
+if (goog.DEBUG && !COMPILED) {
+  proto.protocol.AccountTree.displayName = 'proto.protocol.AccountTree';
+}
+/**
+ * List of repeated fields within this message type.
+ * @private {!Array<number>}
+ * @const
+ */
+proto.protocol.AccountTree.repeatedFields_ = [3];
+
+
+
+if (jspb.Message.GENERATE_TO_OBJECT) {
+/**
+ * Creates an object representation of this proto suitable for use in Soy templates.
+ * Field names that are reserved in JavaScript and will be renamed to pb_name.
+ * To access a reserved field use, foo.pb_<name>, eg, foo.pb_default.
+ * For the list of reserved names please see:
+ *     com.google.apps.jspb.JsClassTemplate.JS_RESERVED_WORDS.
+ * @param {boolean=} opt_includeInstance Whether to include the JSPB instance
+ *     for transitional soy proto support: http://goto/soy-param-migration
+ * @return {!Object}
+ */
+proto.protocol.AccountTree.prototype.toObject = function(opt_includeInstance) {
+  return proto.protocol.AccountTree.toObject(opt_includeInstance, this);
+};
+
+
+/**
+ * Static version of the {@see toObject} method.
+ * @param {boolean|undefined} includeInstance Whether to include the JSPB
+ *     instance for transitional soy proto support:
+ *     http://goto/soy-param-migration
+ * @param {!proto.protocol.AccountTree} msg The msg instance to transform.
+ * @return {!Object}
+ */
+proto.protocol.AccountTree.toObject = function(includeInstance, msg) {
+  var f, obj = {
+    syncCode: msg.getSyncCode(),
+    ledgerSeq: msg.getLedgerSeq(),
+    valuesList: msg.getValuesList_asB64(),
+    ledger: (f = msg.getLedger()) && chain_pb.Ledger.toObject(includeInstance, f),
+    consensusValue: msg.getConsensusValue_asB64(),
+    nextValue: msg.getNextValue_asB64(),
+    nextProof: msg.getNextProof_asB64(),
+    fees: msg.getFees_asB64()
+  };
+
+  if (includeInstance) {
+    obj.$jspbMessageInstance = msg;
+  }
+  return obj;
+};
+}
+
+
+/**
+ * Deserializes binary data (in protobuf wire format).
+ * @param {jspb.ByteSource} bytes The bytes to deserialize.
+ * @return {!proto.protocol.AccountTree}
+ */
+proto.protocol.AccountTree.deserializeBinary = function(bytes) {
+  var reader = new jspb.BinaryReader(bytes);
+  var msg = new proto.protocol.AccountTree;
+  return proto.protocol.AccountTree.deserializeBinaryFromReader(msg, reader);
+};
+
+
+/**
+ * Deserializes binary data (in protobuf wire format) from the
+ * given reader into the given message object.
+ * @param {!proto.protocol.AccountTree} msg The message object to deserialize into.
+ * @param {!jspb.BinaryReader} reader The BinaryReader to use.
+ * @return {!proto.protocol.AccountTree}
+ */
+proto.protocol.AccountTree.deserializeBinaryFromReader = function(msg, reader) {
+  while (reader.nextField()) {
+    if (reader.isEndGroup()) {
+      break;
+    }
+    var field = reader.getFieldNumber();
+    switch (field) {
+    case 1:
+      var value = /** @type {!proto.protocol.AccountTree.SyncCode} */ (reader.readEnum());
+      msg.setSyncCode(value);
+      break;
+    case 2:
+      var value = /** @type {number} */ (reader.readInt64());
+      msg.setLedgerSeq(value);
+      break;
+    case 3:
+      var value = /** @type {!Uint8Array} */ (reader.readBytes());
+      msg.getValuesList().push(value);
+      msg.setValuesList(msg.getValuesList());
+      break;
+    case 4:
+      var value = new chain_pb.Ledger;
+      reader.readMessage(value,chain_pb.Ledger.deserializeBinaryFromReader);
+      msg.setLedger(value);
+      break;
+    case 5:
+      var value = /** @type {!Uint8Array} */ (reader.readBytes());
+      msg.setConsensusValue(value);
+      break;
+    case 6:
+      var value = /** @type {!Uint8Array} */ (reader.readBytes());
+      msg.setNextValue(value);
+      break;
+    case 7:
+      var value = /** @type {!Uint8Array} */ (reader.readBytes());
+      msg.setNextProof(value);
+      break;
+    case 8:
+      var value = /** @type {!Uint8Array} */ (reader.readBytes());
+      msg.setFees(value);
+      break;
+    default:
+      reader.skipField();
+      break;
+    }
+  }
+  return msg;
+};
+
+
+/**
+ * Class method variant: serializes the given message to binary data
+ * (in protobuf wire format), writing to the given BinaryWriter.
+ * @param {!proto.protocol.AccountTree} message
+ * @param {!jspb.BinaryWriter} writer
+ */
+proto.protocol.AccountTree.serializeBinaryToWriter = function(message, writer) {
+  message.serializeBinaryToWriter(writer);
+};
+
+
+/**
+ * Serializes the message to binary data (in protobuf wire format).
+ * @return {!Uint8Array}
+ */
+proto.protocol.AccountTree.prototype.serializeBinary = function() {
+  var writer = new jspb.BinaryWriter();
+  this.serializeBinaryToWriter(writer);
+  return writer.getResultBuffer();
+};
+
+
+/**
+ * Serializes the message to binary data (in protobuf wire format),
+ * writing to the given BinaryWriter.
+ * @param {!jspb.BinaryWriter} writer
+ */
+proto.protocol.AccountTree.prototype.serializeBinaryToWriter = function (writer) {
+  var f = undefined;
+  f = this.getSyncCode();
+  if (f !== 0.0) {
+    writer.writeEnum(
+      1,
+      f
+    );
+  }
+  f = this.getLedgerSeq();
+  if (f !== 0) {
+    writer.writeInt64(
+      2,
+      f
+    );
+  }
+  f = this.getValuesList_asU8();
+  if (f.length > 0) {
+    writer.writeRepeatedBytes(
+      3,
+      f
+    );
+  }
+  f = this.getLedger();
+  if (f != null) {
+    writer.writeMessage(
+      4,
+      f,
+      chain_pb.Ledger.serializeBinaryToWriter
+    );
+  }
+  f = this.getConsensusValue_asU8();
+  if (f.length > 0) {
+    writer.writeBytes(
+      5,
+      f
+    );
+  }
+  f = this.getNextValue_asU8();
+  if (f.length > 0) {
+    writer.writeBytes(
+      6,
+      f
+    );
+  }
+  f = this.getNextProof_asU8();
+  if (f.length > 0) {
+    writer.writeBytes(
+      7,
+      f
+    );
+  }
+  f = this.getFees_asU8();
+  if (f.length > 0) {
+    writer.writeBytes(
+      8,
+      f
+    );
+  }
+};
+
+
+/**
+ * Creates a deep clone of this proto. No data is shared with the original.
+ * @return {!proto.protocol.AccountTree} The clone.
+ */
+proto.protocol.AccountTree.prototype.cloneMessage = function() {
+  return /** @type {!proto.protocol.AccountTree} */ (jspb.Message.cloneMessage(this));
+};
+
+
+/**
+ * optional SyncCode sync_code = 1;
+ * @return {!proto.protocol.AccountTree.SyncCode}
+ */
+proto.protocol.AccountTree.prototype.getSyncCode = function() {
+  return /** @type {!proto.protocol.AccountTree.SyncCode} */ (jspb.Message.getFieldProto3(this, 1, 0));
+};
+
+
+/** @param {!proto.protocol.AccountTree.SyncCode} value  */
+proto.protocol.AccountTree.prototype.setSyncCode = function(value) {
+  jspb.Message.setField(this, 1, value);
+};
+
+
+/**
+ * optional int64 ledger_seq = 2;
+ * @return {number}
+ */
+proto.protocol.AccountTree.prototype.getLedgerSeq = function() {
+  return /** @type {number} */ (jspb.Message.getFieldProto3(this, 2, 0));
+};
+
+
+/** @param {number} value  */
+proto.protocol.AccountTree.prototype.setLedgerSeq = function(value) {
+  jspb.Message.setField(this, 2, value);
+};
+
+
+/**
+ * repeated bytes values = 3;
+ * If you change this array by adding, removing or replacing elements, or if you
+ * replace the array itself, then you must call the setter to update it.
+ * @return {!(Array<!Uint8Array>|Array<string>)}
+ */
+proto.protocol.AccountTree.prototype.getValuesList = function() {
+  return /** @type {!(Array<!Uint8Array>|Array<string>)} */ (jspb.Message.getField(this, 3));
+};
+
+
+/**
+ * repeated bytes values = 3;
+ * If you change this array by adding, removing or replacing elements, or if you
+ * replace the array itself, then you must call the setter to update it.
+ * This is a type-conversion wrapper around `getValuesList()`
+ * @return {!Array.<string>}
+ */
+proto.protocol.AccountTree.prototype.getValuesList_asB64 = function() {
+  return /** @type {!Array.<string>} */ (jspb.Message.bytesListAsB64(
+      this.getValuesList()));
+};
+
+
+/**
+ * repeated bytes values = 3;
+ * If you change this array by adding, removing or replacing elements, or if you
+ * replace the array itself, then you must call the setter to update it.
+ * Note that Uint8Array is not supported on all browsers.
+ * @see http://caniuse.com/Uint8Array
+ * This is a type-conversion wrapper around `getValuesList()`
+ * @return {!Array.<!Uint8Array>}
+ */
+proto.protocol.AccountTree.prototype.getValuesList_asU8 = function() {
+  return /** @type {!Array.<!Uint8Array>} */ (jspb.Message.bytesListAsU8(
+      this.getValuesList()));
+};
+
+
+/** @param {!(Array<!Uint8Array>|Array<string>)} value  */
+proto.protocol.AccountTree.prototype.setValuesList = function(value) {
+  jspb.Message.setField(this, 3, value || []);
+};
+
+
+proto.protocol.AccountTree.prototype.clearValuesList = function() {
+  jspb.Message.setField(this, 3, []);
+};
+
+
+/**
+ * optional Ledger ledger = 4;
+ * @return {proto.protocol.Ledger}
+ */
+proto.protocol.AccountTree.prototype.getLedger = function() {
+  return /** @type{proto.protocol.Ledger} */ (
+    jspb.Message.getWrapperField(this, chain_pb.Ledger, 4));
+};
+
+
+/** @param {proto.protocol.Ledger|undefined} value  */
+proto.protocol.AccountTree.prototype.setLedger = function(value) {
+  jspb.Message.setWrapperField(this, 4, value);
+};
+
+
+proto.protocol.AccountTree.prototype.clearLedger = function() {
+  this.setLedger(undefined);
+};
+
+
+/**
+ * Returns whether this field is set.
+ * @return{!boolean}
  */
-proto.protocol.Ledgers.SyncCode = {
-  OK: 0,
-  OUT_OF_SYNC: 1,
-  OUT_OF_LEDGERS: 2,
-  BUSY: 3,
-  REFUSE: 4,
-  INTERNAL: 5
+proto.protocol.AccountTree.prototype.hasLedger = function() {
+  return jspb.Message.getField(this, 4) != null;
 };
 
+
 /**
- * repeated ConsensusValue values = 1;
- * @return {!Array.<!proto.protocol.ConsensusValue>}
+ * optional bytes consensus_value = 5;
+ * @return {!(string|Uint8Array)}
  */
-proto.protocol.Ledgers.prototype.getValuesList = function() {
-  return /** @type{!Array.<!proto.protocol.ConsensusValue>} */ (
-    jspb.Message.getRepeatedWrapperField(this, chain_pb.ConsensusValue, 1));
+proto.protocol.AccountTree.prototype.getConsensusValue = function() {
+  return /** @type {!(string|Uint8Array)} */ (jspb.Message.getFieldProto3(this, 5, ""));
 };
 
 
-/** @param {!Array.<!proto.protocol.ConsensusValue>} value */
-proto.protocol.Ledgers.prototype.setValuesList = function(value) {
-  jspb.Message.setRepeatedWrapperField(this, 1, value);
+/**
+ * optional bytes consensus_value = 5;
+ * This is a type-conversion wrapper around `getConsensusValue()`
+ * @return {string}
+ */
+proto.protocol.AccountTree.prototype.getConsensusValue_asB64 = function() {
+  return /** @type {string} */ (jspb.Message.bytesAsB64(
+      this.getConsensusValue()));
 };
 
 
 /**
- * @param {!proto.protocol.ConsensusValue=} opt_value
- * @param {number=} opt_index
- * @return {!proto.protocol.ConsensusValue}
+ * optional bytes consensus_value = 5;
+ * Note that Uint8Array is not supported on all browsers.
+ * @see http://caniuse.com/Uint8Array
+ * This is a type-conversion wrapper around `getConsensusValue()`
+ * @return {!Uint8Array}
  */
-proto.protocol.Ledgers.prototype.addValues = function(opt_value, opt_index) {
-  return jspb.Message.addToRepeatedWrapperField(this, 1, opt_value, proto.protocol.ConsensusValue, opt_index);
+proto.protocol.AccountTree.prototype.getConsensusValue_asU8 = function() {
+  return /** @type {!Uint8Array} */ (jspb.Message.bytesAsU8(
+      this.getConsensusValue()));
 };
 
 
-proto.protocol.Ledgers.prototype.clearValuesList = function() {
-  this.setValuesList([]);
+/** @param {!(string|Uint8Array)} value  */
+proto.protocol.AccountTree.prototype.setConsensusValue = function(value) {
+  jspb.Message.setField(this, 5, value);
 };
 
 
 /**
- * optional SyncCode sync_code = 2;
- * @return {!proto.protocol.Ledgers.SyncCode}
+ * optional bytes next_value = 6;
+ * @return {!(string|Uint8Array)}
  */
-proto.protocol.Ledgers.prototype.getSyncCode = function() {
-  return /** @type {!proto.protocol.Ledgers.SyncCode} */ (jspb.Message.getFieldWithDefault(this, 2, 0));
+proto.protocol.AccountTree.prototype.getNextValue = function() {
+  return /** @type {!(string|Uint8Array)} */ (jspb.Message.getFieldProto3(this, 6, ""));
 };
 
 
-/** @param {!proto.protocol.Ledgers.SyncCode} value */
-proto.protocol.Ledgers.prototype.setSyncCode = function(value) {
-  jspb.Message.setProto3EnumField(this, 2, value);
+/**
+ * optional bytes next_value = 6;
+ * This is a type-conversion wrapper around `getNextValue()`
+ * @return {string}
+ */
+proto.protocol.AccountTree.prototype.getNextValue_asB64 = function() {
+  return /** @type {string} */ (jspb.Message.bytesAsB64(
+      this.getNextValue()));
 };
 
 
 /**
- * optional int64 max_seq = 3;
- * @return {number}
+ * optional bytes next_value = 6;
+ * Note that Uint8Array is not supported on all browsers.
+ * @see http://caniuse.com/Uint8Array
+ * This is a type-conversion wrapper around `getNextValue()`
+ * @return {!Uint8Array}
  */
-proto.protocol.Ledgers.prototype.getMaxSeq = function() {
-  return /** @type {number} */ (jspb.Message.getFieldWithDefault(this, 3, 0));
+proto.protocol.AccountTree.prototype.getNextValue_asU8 = function() {
+  return /** @type {!Uint8Array} */ (jspb.Message.bytesAsU8(
+      this.getNextValue()));
 };
 
 
-/** @param {number} value */
-proto.protocol.Ledgers.prototype.setMaxSeq = function(value) {
-  jspb.Message.setProto3IntField(this, 3, value);
+/** @param {!(string|Uint8Array)} value  */
+proto.protocol.AccountTree.prototype.setNextValue = function(value) {
+  jspb.Message.setField(this, 6, value);
 };
 
 
 /**
- * optional bytes proof = 4;
+ * optional bytes next_proof = 7;
  * @return {!(string|Uint8Array)}
  */
-proto.protocol.Ledgers.prototype.getProof = function() {
-  return /** @type {!(string|Uint8Array)} */ (jspb.Message.getFieldWithDefault(this, 4, ""));
+proto.protocol.AccountTree.prototype.getNextProof = function() {
+  return /** @type {!(string|Uint8Array)} */ (jspb.Message.getFieldProto3(this, 7, ""));
 };
 
 
 /**
- * optional bytes proof = 4;
- * This is a type-conversion wrapper around `getProof()`
+ * optional bytes next_proof = 7;
+ * This is a type-conversion wrapper around `getNextProof()`
  * @return {string}
  */
-proto.protocol.Ledgers.prototype.getProof_asB64 = function() {
+proto.protocol.AccountTree.prototype.getNextProof_asB64 = function() {
   return /** @type {string} */ (jspb.Message.bytesAsB64(
-      this.getProof()));
+      this.getNextProof()));
 };
 
 
 /**
- * optional bytes proof = 4;
+ * optional bytes next_proof = 7;
  * Note that Uint8Array is not supported on all browsers.
  * @see http://caniuse.com/Uint8Array
- * This is a type-conversion wrapper around `getProof()`
+ * This is a type-conversion wrapper around `getNextProof()`
  * @return {!Uint8Array}
  */
-proto.protocol.Ledgers.prototype.getProof_asU8 = function() {
+proto.protocol.AccountTree.prototype.getNextProof_asU8 = function() {
   return /** @type {!Uint8Array} */ (jspb.Message.bytesAsU8(
-      this.getProof()));
+      this.getNextProof()));
 };
 
 
-/** @param {!(string|Uint8Array)} value */
-proto.protocol.Ledgers.prototype.setProof = function(value) {
-  jspb.Message.setProto3BytesField(this, 4, value);
+/** @param {!(string|Uint8Array)} value  */
+proto.protocol.AccountTree.prototype.setNextProof = function(value) {
+  jspb.Message.setField(this, 7, value);
+};
+
+
+/**
+ * optional bytes fees = 8;
+ * @return {!(string|Uint8Array)}
+ */
+proto.protocol.AccountTree.prototype.getFees = function() {
+  return /** @type {!(string|Uint8Array)} */ (jspb.Message.getFieldProto3(this, 8, ""));
+};
+
+
+/**
+ * optional bytes fees = 8;
+ * This is a type-conversion wrapper around `getFees()`
+ * @return {string}
+ */
+proto.protocol.AccountTree.prototype.getFees_asB64 = function() {
+  return /** @type {string} */ (jspb.Message.bytesAsB64(
+      this.getFees()));
+};
+
+
+/**
+ * optional bytes fees = 8;
+ * Note that Uint8Array is not supported on all browsers.
+ * @see http://caniuse.com/Uint8Array
+ * This is a type-conversion wrapper around `getFees()`
+ * @return {!Uint8Array}
+ */
+proto.protocol.AccountTree.prototype.getFees_asU8 = function() {
+  return /** @type {!Uint8Array} */ (jspb.Message.bytesAsU8(
+      this.getFees()));
+};
+
+
+/** @param {!(string|Uint8Array)} value  */
+proto.protocol.AccountTree.prototype.setFees = function(value) {
+  jspb.Message.setField(this, 8, value);
 };
 
 
+/**
+ * @enum {number}
+ */
+proto.protocol.AccountTree.SyncCode = {
+  OK: 0,
+  NOT_READY: 1,
+  NOT_PINNED: 2,
+  INTERNAL: 3
+};
+
 
 /**
  * Generated by JsPbCodeGenerator.
@@ -1474,11 +2335,10 @@ proto.protocol.DontHave.prototype.toObject = function(opt_includeInstance) {
  *     http://goto/soy-param-migration
  * @param {!proto.protocol.DontHave} msg The msg instance to transform.
  * @return {!Object}
- * @suppress {unusedLocalVariables} f is only used for nested messages
  */
 proto.protocol.DontHave.toObject = function(includeInstance, msg) {
   var f, obj = {
-    type: jspb.Message.getFieldWithDefault(msg, 1, 0),
+    type: msg.getType(),
     hash: msg.getHash_asB64()
   };
 
@@ -1533,34 +2393,43 @@ proto.protocol.DontHave.deserializeBinaryFromReader = function(msg, reader) {
 };
 
 
+/**
+ * Class method variant: serializes the given message to binary data
+ * (in protobuf wire format), writing to the given BinaryWriter.
+ * @param {!proto.protocol.DontHave} message
+ * @param {!jspb.BinaryWriter} writer
+ */
+proto.protocol.DontHave.serializeBinaryToWriter = function(message, writer) {
+  message.serializeBinaryToWriter(writer);
+};
+
+
 /**
  * Serializes the message to binary data (in protobuf wire format).
  * @return {!Uint8Array}
  */
 proto.protocol.DontHave.prototype.serializeBinary = function() {
   var writer = new jspb.BinaryWriter();
-  proto.protocol.DontHave.serializeBinaryToWriter(this, writer);
+  this.serializeBinaryToWriter(writer);
   return writer.getResultBuffer();
 };
 
 
 /**
- * Serializes the given message to binary data (in protobuf wire
- * format), writing to the given BinaryWriter.
- * @param {!proto.protocol.DontHave} message
+ * Serializes the message to binary data (in protobuf wire format),
+ * writing to the given BinaryWriter.
  * @param {!jspb.BinaryWriter} writer
- * @suppress {unusedLocalVariables} f is only used for nested messages
  */
-proto.protocol.DontHave.serializeBinaryToWriter = function(message, writer) {
+proto.protocol.DontHave.prototype.serializeBinaryToWriter = function (writer) {
   var f = undefined;
-  f = message.getType();
+  f = this.getType();
   if (f !== 0) {
     writer.writeInt64(
       1,
       f
     );
   }
-  f = message.getHash_asU8();
+  f = this.getHash_asU8();
   if (f.length > 0) {
     writer.writeBytes(
       2,
@@ -1570,18 +2439,27 @@ proto.protocol.DontHave.serializeBinaryToWriter = function(message, writer) {
 };
 
 
+/**
+ * Creates a deep clone of this proto. No data is shared with the original.
+ * @return {!proto.protocol.DontHave} The clone.
+ */
+proto.protocol.DontHave.prototype.cloneMessage = function() {
+  return /** @type {!proto.protocol.DontHave} */ (jspb.Message.cloneMessage(this));
+};
+
+
 /**
  * optional int64 type = 1;
  * @return {number}
  */
 proto.protocol.DontHave.prototype.getType = function() {
-  return /** @type {number} */ (jspb.Message.getFieldWithDefault(this, 1, 0));
+  return /** @type {number} */ (jspb.Message.getFieldProto3(this, 1, 0));
 };
 
 
-/** @param {number} value */
+/** @param {number} value  */
 proto.protocol.DontHave.prototype.setType = function(value) {
-  jspb.Message.setProto3IntField(this, 1, value);
+  jspb.Message.setField(this, 1, value);
 };
 
 
@@ -1590,7 +2468,7 @@ proto.protocol.DontHave.prototype.setType = function(value) {
  * @return {!(string|Uint8Array)}
  */
 proto.protocol.DontHave.prototype.getHash = function() {
-  return /** @type {!(string|Uint8Array)} */ (jspb.Message.getFieldWithDefault(this, 2, ""));
+  return /** @type {!(string|Uint8Array)} */ (jspb.Message.getFieldProto3(this, 2, ""));
 };
 
 
@@ -1618,9 +2496,9 @@ proto.protocol.DontHave.prototype.getHash_asU8 = function() {
 };
 
 
-/** @param {!(string|Uint8Array)} value */
+/** @param {!(string|Uint8Array)} value  */
 proto.protocol.DontHave.prototype.setHash = function(value) {
-  jspb.Message.setProto3BytesField(this, 2, value);
+  jspb.Message.setField(this, 2, value);
 };
 
 
@@ -1667,11 +2545,10 @@ proto.protocol.LedgerUpgradeNotify.prototype.toObject = function(opt_includeInst
  *     http://goto/soy-param-migration
  * @param {!proto.protocol.LedgerUpgradeNotify} msg The msg instance to transform.
  * @return {!Object}
- * @suppress {unusedLocalVariables} f is only used for nested messages
  */
 proto.protocol.LedgerUpgradeNotify.toObject = function(includeInstance, msg) {
   var f, obj = {
-    nonce: jspb.Message.getFieldWithDefault(msg, 1, 0),
+    nonce: msg.getNonce(),
     upgrade: (f = msg.getUpgrade()) && common_pb.LedgerUpgrade.toObject(includeInstance, f),
     signature: (f = msg.getSignature()) && common_pb.Signature.toObject(includeInstance, f)
   };
@@ -1733,34 +2610,43 @@ proto.protocol.LedgerUpgradeNotify.deserializeBinaryFromReader = function(msg, r
 };
 
 
+/**
+ * Class method variant: serializes the given message to binary data
+ * (in protobuf wire format), writing to the given BinaryWriter.
+ * @param {!proto.protocol.LedgerUpgradeNotify} message
+ * @param {!jspb.BinaryWriter} writer
+ */
+proto.protocol.LedgerUpgradeNotify.serializeBinaryToWriter = function(message, writer) {
+  message.serializeBinaryToWriter(writer);
+};
+
+
 /**
  * Serializes the message to binary data (in protobuf wire format).
  * @return {!Uint8Array}
  */
 proto.protocol.LedgerUpgradeNotify.prototype.serializeBinary = function() {
   var writer = new jspb.BinaryWriter();
-  proto.protocol.LedgerUpgradeNotify.serializeBinaryToWriter(this, writer);
+  this.serializeBinaryToWriter(writer);
   return writer.getResultBuffer();
 };
 
 
 /**
- * Serializes the given message to binary data (in protobuf wire
- * format), writing to the given BinaryWriter.
- * @param {!proto.protocol.LedgerUpgradeNotify} message
+ * Serializes the message to binary data (in protobuf wire format),
+ * writing to the given BinaryWriter.
  * @param {!jspb.BinaryWriter} writer
- * @suppress {unusedLocalVariables} f is only used for nested messages
  */
-proto.protocol.LedgerUpgradeNotify.serializeBinaryToWriter = function(message, writer) {
+proto.protocol.LedgerUpgradeNotify.prototype.serializeBinaryToWriter = function (writer) {
   var f = undefined;
-  f = message.getNonce();
+  f = this.getNonce();
   if (f !== 0) {
     writer.writeInt64(
       1,
       f
     );
   }
-  f = message.getUpgrade();
+  f = this.getUpgrade();
   if (f != null) {
     writer.writeMessage(
       2,
@@ -1768,7 +2654,7 @@ proto.protocol.LedgerUpgradeNotify.serializeBinaryToWriter = function(message, w
       common_pb.LedgerUpgrade.serializeBinaryToWriter
     );
   }
-  f = message.getSignature();
+  f = this.getSignature();
   if (f != null) {
     writer.writeMessage(
       3,
@@ -1779,32 +2665,41 @@ proto.protocol.LedgerUpgradeNotify.serializeBinaryToWriter = function(message, w
 };
 
 
+/**
+ * Creates a deep clone of this proto. No data is shared with the original.
+ * @return {!proto.protocol.LedgerUpgradeNotify} The clone.
+ */
+proto.protocol.LedgerUpgradeNotify.prototype.cloneMessage = function() {
+  return /** @type {!proto.protocol.LedgerUpgradeNotify} */ (jspb.Message.cloneMessage(this));
+};
+
+
 /**
  * optional int64 nonce = 1;
  * @return {number}
  */
 proto.protocol.LedgerUpgradeNotify.prototype.getNonce = function() {
-  return /** @type {number} */ (jspb.Message.getFieldWithDefault(this, 1, 0));
+  return /** @type {number} */ (jspb.Message.getFieldProto3(this, 1, 0));
 };
 
 
-/** @param {number} value */
+/** @param {number} value  */
 proto.protocol.LedgerUpgradeNotify.prototype.setNonce = function(value) {
-  jspb.Message.setProto3IntField(this, 1, value);
+  jspb.Message.setField(this, 1, value);
 };
 
 
 /**
  * optional LedgerUpgrade upgrade = 2;
- * @return {?proto.protocol.LedgerUpgrade}
+ * @return {proto.protocol.LedgerUpgrade}
  */
 proto.protocol.LedgerUpgradeNotify.prototype.getUpgrade = function() {
-  return /** @type{?proto.protocol.LedgerUpgrade} */ (
+  return /** @type{proto.protocol.LedgerUpgrade} */ (
     jspb.Message.getWrapperField(this, common_pb.LedgerUpgrade, 2));
 };
 
 
-/** @param {?proto.protocol.LedgerUpgrade|undefined} value */
+/** @param {proto.protocol.LedgerUpgrade|undefined} value  */
 proto.protocol.LedgerUpgradeNotify.prototype.setUpgrade = function(value) {
   jspb.Message.setWrapperField(this, 2, value);
 };
@@ -1817,7 +2712,7 @@ proto.protocol.LedgerUpgradeNotify.prototype.clearUpgrade = function() {
 
 /**
  * Returns whether this field is set.
- * @return {!boolean}
+ * @return{!boolean}
  */
 proto.protocol.LedgerUpgradeNotify.prototype.hasUpgrade = function() {
   return jspb.Message.getField(this, 2) != null;
@@ -1826,15 +2721,15 @@ proto.protocol.LedgerUpgradeNotify.prototype.hasUpgrade = function() {
 
 /**
  * optional Signature signature = 3;
- * @return {?proto.protocol.Signature}
+ * @return {proto.protocol.Signature}
  */
 proto.protocol.LedgerUpgradeNotify.prototype.getSignature = function() {
-  return /** @type{?proto.protocol.Signature} */ (
+  return /** @type{proto.protocol.Signature} */ (
     jspb.Message.getWrapperField(this, common_pb.Signature, 3));
 };
 
 
-/** @param {?proto.protocol.Signature|undefined} value */
+/** @param {proto.protocol.Signature|undefined} value  */
 proto.protocol.LedgerUpgradeNotify.prototype.setSignature = function(value) {
   jspb.Message.setWrapperField(this, 3, value);
 };
@@ -1847,7 +2742,7 @@ proto.protocol.LedgerUpgradeNotify.prototype.clearSignature = function() {
 
 /**
  * Returns whether this field is set.
- * @return {!boolean}
+ * @return{!boolean}
  */
 proto.protocol.LedgerUpgradeNotify.prototype.hasSignature = function() {
   return jspb.Message.getField(this, 3) != null;
@@ -1904,7 +2799,6 @@ proto.protocol.EntryList.prototype.toObject = function(opt_includeInstance) {
  *     http://goto/soy-param-migration
  * @param {!proto.protocol.EntryList} msg The msg instance to transform.
  * @return {!Object}
- * @suppress {unusedLocalVariables} f is only used for nested messages
  */
 proto.protocol.EntryList.toObject = function(includeInstance, msg) {
   var f, obj = {
@@ -1947,7 +2841,8 @@ proto.protocol.EntryList.deserializeBinaryFromReader = function(msg, reader) {
     switch (field) {
     case 1:
       var value = /** @type {!Uint8Array} */ (reader.readBytes());
-      msg.addEntry(value);
+      msg.getEntryList().push(value);
+      msg.setEntryList(msg.getEntryList());
       break;
     default:
       reader.skipField();
@@ -1958,27 +2853,36 @@ proto.protocol.EntryList.deserializeBinaryFromReader = function(msg, reader) {
 };
 
 
+/**
+ * Class method variant: serializes the given message to binary data
+ * (in protobuf wire format), writing to the given BinaryWriter.
+ * @param {!proto.protocol.EntryList} message
+ * @param {!jspb.BinaryWriter} writer
+ */
+proto.protocol.EntryList.serializeBinaryToWriter = function(message, writer) {
+  message.serializeBinaryToWriter(writer);
+};
+
+
 /**
  * Serializes the message to binary data (in protobuf wire format).
  * @return {!Uint8Array}
  */
 proto.protocol.EntryList.prototype.serializeBinary = function() {
   var writer = new jspb.BinaryWriter();
-  proto.protocol.EntryList.serializeBinaryToWriter(this, writer);
+  this.serializeBinaryToWriter(writer);
   return writer.getResultBuffer();
 };
 
 
 /**
- * Serializes the given message to binary data (in protobuf wire
- * format), writing to the given BinaryWriter.
- * @param {!proto.protocol.EntryList} message
+ * Serializes the message to binary data (in protobuf wire format),
+ * writing to the given BinaryWriter.
  * @param {!jspb.BinaryWriter} writer
- * @suppress {unusedLocalVariables} f is only used for nested messages
  */
-proto.protocol.EntryList.serializeBinaryToWriter = function(message, writer) {
+proto.protocol.EntryList.prototype.serializeBinaryToWriter = function (writer) {
   var f = undefined;
-  f = message.getEntryList_asU8();
+  f = this.getEntryList_asU8();
   if (f.length > 0) {
     writer.writeRepeatedBytes(
       1,
@@ -1988,17 +2892,30 @@ proto.protocol.EntryList.serializeBinaryToWriter = function(message, writer) {
 };
 
 
+/**
+ * Creates a deep clone of this proto. No data is shared with the original.
+ * @return {!proto.protocol.EntryList} The clone.
+ */
+proto.protocol.EntryList.prototype.cloneMessage = function() {
+  return /** @type {!proto.protocol.EntryList} */ (jspb.Message.cloneMessage(this));
+};
+
+
 /**
  * repeated bytes entry = 1;
+ * If you change this array by adding, removing or replacing elements, or if you
+ * replace the array itself, then you must call the setter to update it.
  * @return {!(Array<!Uint8Array>|Array<string>)}
  */
 proto.protocol.EntryList.prototype.getEntryList = function() {
-  return /** @type {!(Array<!Uint8Array>|Array<string>)} */ (jspb.Message.getRepeatedField(this, 1));
+  return /** @type {!(Array<!Uint8Array>|Array<string>)} */ (jspb.Message.getField(this, 1));
 };
 
 
 /**
  * repeated bytes entry = 1;
+ * If you change this array by adding, removing or replacing elements, or if you
+ * replace the array itself, then you must call the setter to update it.
  * This is a type-conversion wrapper around `getEntryList()`
  * @return {!Array.<string>}
  */
@@ -2010,6 +2927,8 @@ proto.protocol.EntryList.prototype.getEntryList_asB64 = function() {
 
 /**
  * repeated bytes entry = 1;
+ * If you change this array by adding, removing or replacing elements, or if you
+ * replace the array itself, then you must call the setter to update it.
  * Note that Uint8Array is not supported on all browsers.
  * @see http://caniuse.com/Uint8Array
  * This is a type-conversion wrapper around `getEntryList()`
@@ -2021,23 +2940,14 @@ proto.protocol.EntryList.prototype.getEntryList_asU8 = function() {
 };
 
 
-/** @param {!(Array<!Uint8Array>|Array<string>)} value */
+/** @param {!(Array<!Uint8Array>|Array<string>)} value  */
 proto.protocol.EntryList.prototype.setEntryList = function(value) {
   jspb.Message.setField(this, 1, value || []);
 };
 
 
-/**
- * @param {!(string|Uint8Array)} value
- * @param {number=} opt_index
- */
-proto.protocol.EntryList.prototype.addEntry = function(value, opt_index) {
-  jspb.Message.addToRepeatedField(this, 1, value, opt_index);
-};
-
-
 proto.protocol.EntryList.prototype.clearEntryList = function() {
-  this.setEntryList([]);
+  jspb.Message.setField(this, 1, []);
 };
 
 
@@ -2091,12 +3001,11 @@ proto.protocol.ChainHello.prototype.toObject = function(opt_includeInstance) {
  *     http://goto/soy-param-migration
  * @param {!proto.protocol.ChainHello} msg The msg instance to transform.
  * @return {!Object}
- * @suppress {unusedLocalVariables} f is only used for nested messages
  */
 proto.protocol.ChainHello.toObject = function(includeInstance, msg) {
   var f, obj = {
-    apiListList: jspb.Message.getRepeatedField(msg, 1),
-    timestamp: jspb.Message.getFieldWithDefault(msg, 2, 0)
+    apiListList: jspb.Message.getField(msg, 1),
+    timestamp: msg.getTimestamp()
   };
 
   if (includeInstance) {
@@ -2150,34 +3059,43 @@ proto.protocol.ChainHello.deserializeBinaryFromReader = function(msg, reader) {
 };
 
 
+/**
+ * Class method variant: serializes the given message to binary data
+ * (in protobuf wire format), writing to the given BinaryWriter.
+ * @param {!proto.protocol.ChainHello} message
+ * @param {!jspb.BinaryWriter} writer
+ */
+proto.protocol.ChainHello.serializeBinaryToWriter = function(message, writer) {
+  message.serializeBinaryToWriter(writer);
+};
+
+
 /**
  * Serializes the message to binary data (in protobuf wire format).
  * @return {!Uint8Array}
  */
 proto.protocol.ChainHello.prototype.serializeBinary = function() {
   var writer = new jspb.BinaryWriter();
-  proto.protocol.ChainHello.serializeBinaryToWriter(this, writer);
+  this.serializeBinaryToWriter(writer);
   return writer.getResultBuffer();
 };
 
 
 /**
- * Serializes the given message to binary data (in protobuf wire
- * format), writing to the given BinaryWriter.
- * @param {!proto.protocol.ChainHello} message
+ * Serializes the message to binary data (in protobuf wire format),
+ * writing to the given BinaryWriter.
  * @param {!jspb.BinaryWriter} writer
- * @suppress {unusedLocalVariables} f is only used for nested messages
  */
-proto.protocol.ChainHello.serializeBinaryToWriter = function(message, writer) {
+proto.protocol.ChainHello.prototype.serializeBinaryToWriter = function (writer) {
   var f = undefined;
-  f = message.getApiListList();
+  f = this.getApiListList();
   if (f.length > 0) {
     writer.writePackedEnum(
       1,
       f
     );
   }
-  f = message.getTimestamp();
+  f = this.getTimestamp();
   if (f !== 0) {
     writer.writeInt64(
       2,
@@ -2187,32 +3105,34 @@ proto.protocol.ChainHello.serializeBinaryToWriter = function(message, writer) {
 };
 
 
+/**
+ * Creates a deep clone of this proto. No data is shared with the original.
+ * @return {!proto.protocol.ChainHello} The clone.
+ */
+proto.protocol.ChainHello.prototype.cloneMessage = function() {
+  return /** @type {!proto.protocol.ChainHello} */ (jspb.Message.cloneMessage(this));
+};
+
+
 /**
  * repeated ChainMessageType api_list = 1;
+ * If you change this array by adding, removing or replacing elements, or if you
+ * replace the array itself, then you must call the setter to update it.
  * @return {!Array.<!proto.protocol.ChainMessageType>}
  */
 proto.protocol.ChainHello.prototype.getApiListList = function() {
-  return /** @type {!Array.<!proto.protocol.ChainMessageType>} */ (jspb.Message.getRepeatedField(this, 1));
+  return /** @type {!Array.<!proto.protocol.ChainMessageType>} */ (jspb.Message.getField(this, 1));
 };
 
 
-/** @param {!Array.<!proto.protocol.ChainMessageType>} value */
+/** @param {!Array.<!proto.protocol.ChainMessageType>} value  */
 proto.protocol.ChainHello.prototype.setApiListList = function(value) {
   jspb.Message.setField(this, 1, value || []);
 };
 
 
-/**
- * @param {!proto.protocol.ChainMessageType} value
- * @param {number=} opt_index
- */
-proto.protocol.ChainHello.prototype.addApiList = function(value, opt_index) {
-  jspb.Message.addToRepeatedField(this, 1, value, opt_index);
-};
-
-
 proto.protocol.ChainHello.prototype.clearApiListList = function() {
-  this.setApiListList([]);
+  jspb.Message.setField(this, 1, []);
 };
 
 
@@ -2221,13 +3141,13 @@ proto.protocol.ChainHello.prototype.clearApiListList = function() {
  * @return {number}
  */
 proto.protocol.ChainHello.prototype.getTimestamp = function() {
-  return /** @type {number} */ (jspb.Message.getFieldWithDefault(this, 2, 0));
+  return /** @type {number} */ (jspb.Message.getFieldProto3(this, 2, 0));
 };
 
 
-/** @param {number} value */
+/** @param {number} value  */
 proto.protocol.ChainHello.prototype.setTimestamp = function(value) {
-  jspb.Message.setProto3IntField(this, 2, value);
+  jspb.Message.setField(this, 2, value);
 };
 
 
@@ -2274,15 +3194,14 @@ proto.protocol.ChainStatus.prototype.toObject = function(opt_includeInstance) {
  *     http://goto/soy-param-migration
  * @param {!proto.protocol.ChainStatus} msg The msg instance to transform.
  * @return {!Object}
- * @suppress {unusedLocalVariables} f is only used for nested messages
  */
 proto.protocol.ChainStatus.toObject = function(includeInstance, msg) {
   var f, obj = {
-    selfAddr: jspb.Message.getFieldWithDefault(msg, 1, ""),
-    ledgerVersion: jspb.Message.getFieldWithDefault(msg, 2, 0),
-    monitorVersion: jspb.Message.getFieldWithDefault(msg, 3, 0),
-    phantomVersion: jspb.Message.getFieldWithDefault(msg, 4, ""),
-    timestamp: jspb.Message.getFieldWithDefault(msg, 5, 0)
+    selfAddr: msg.getSelfAddr(),
+    ledgerVersion: msg.getLedgerVersion(),
+    monitorVersion: msg.getMonitorVersion(),
+    phantomVersion: msg.getPhantomVersion(),
+    timestamp: msg.getTimestamp()
   };
 
   if (includeInstance) {
@@ -2348,55 +3267,64 @@ proto.protocol.ChainStatus.deserializeBinaryFromReader = function(msg, reader) {
 };
 
 
+/**
+ * Class method variant: serializes the given message to binary data
+ * (in protobuf wire format), writing to the given BinaryWriter.
+ * @param {!proto.protocol.ChainStatus} message
+ * @param {!jspb.BinaryWriter} writer
+ */
+proto.protocol.ChainStatus.serializeBinaryToWriter = function(message, writer) {
+  message.serializeBinaryToWriter(writer);
+};
+
+
 /**
  * Serializes the message to binary data (in protobuf wire format).
  * @return {!Uint8Array}
  */
 proto.protocol.ChainStatus.prototype.serializeBinary = function() {
   var writer = new jspb.BinaryWriter();
-  proto.protocol.ChainStatus.serializeBinaryToWriter(this, writer);
+  this.serializeBinaryToWriter(writer);
   return writer.getResultBuffer();
 };
 
 
 /**
- * Serializes the given message to binary data (in protobuf wire
- * format), writing to the given BinaryWriter.
- * @param {!proto.protocol.ChainStatus} message
+ * Serializes the message to binary data (in protobuf wire format),
+ * writing to the given BinaryWriter.
  * @param {!jspb.BinaryWriter} writer
- * @suppress {unusedLocalVariables} f is only used for nested messages
  */
-proto.protocol.ChainStatus.serializeBinaryToWriter = function(message, writer) {
+proto.protocol.ChainStatus.prototype.serializeBinaryToWriter = function (writer) {
   var f = undefined;
-  f = message.getSelfAddr();
+  f = this.getSelfAddr();
   if (f.length > 0) {
     writer.writeString(
       1,
       f
     );
   }
-  f = message.getLedgerVersion();
+  f = this.getLedgerVersion();
   if (f !== 0) {
     writer.writeInt64(
       2,
       f
     );
   }
-  f = message.getMonitorVersion();
+  f = this.getMonitorVersion();
   if (f !== 0) {
     writer.writeInt64(
       3,
       f
     );
   }
-  f = message.getPhantomVersion();
+  f = this.getPhantomVersion();
   if (f.length > 0) {
     writer.writeString(
       4,
       f
     );
   }
-  f = message.getTimestamp();
+  f = this.getTimestamp();
   if (f !== 0) {
     writer.writeInt64(
       5,
@@ -2406,18 +3334,27 @@ proto.protocol.ChainStatus.serializeBinaryToWriter = function(message, writer) {
 };
 
 
+/**
+ * Creates a deep clone of this proto. No data is shared with the original.
+ * @return {!proto.protocol.ChainStatus} The clone.
+ */
+proto.protocol.ChainStatus.prototype.cloneMessage = function() {
+  return /** @type {!proto.protocol.ChainStatus} */ (jspb.Message.cloneMessage(this));
+};
+
+
 /**
  * optional string self_addr = 1;
  * @return {string}
  */
 proto.protocol.ChainStatus.prototype.getSelfAddr = function() {
-  return /** @type {string} */ (jspb.Message.getFieldWithDefault(this, 1, ""));
+  return /** @type {string} */ (jspb.Message.getFieldProto3(this, 1, ""));
 };
 
 
-/** @param {string} value */
+/** @param {string} value  */
 proto.protocol.ChainStatus.prototype.setSelfAddr = function(value) {
-  jspb.Message.setProto3StringField(this, 1, value);
+  jspb.Message.setField(this, 1, value);
 };
 
 
@@ -2426,13 +3363,13 @@ proto.protocol.ChainStatus.prototype.setSelfAddr = function(value) {
  * @return {number}
  */
 proto.protocol.ChainStatus.prototype.getLedgerVersion = function() {
-  return /** @type {number} */ (jspb.Message.getFieldWithDefault(this, 2, 0));
+  return /** @type {number} */ (jspb.Message.getFieldProto3(this, 2, 0));
 };
 
 
-/** @param {number} value */
+/** @param {number} value  */
 proto.protocol.ChainStatus.prototype.setLedgerVersion = function(value) {
-  jspb.Message.setProto3IntField(this, 2, value);
+  jspb.Message.setField(this, 2, value);
 };
 
 
@@ -2441,13 +3378,13 @@ proto.protocol.ChainStatus.prototype.setLedgerVersion = function(value) {
  * @return {number}
  */
 proto.protocol.ChainStatus.prototype.getMonitorVersion = function() {
-  return /** @type {number} */ (jspb.Message.getFieldWithDefault(this, 3, 0));
+  return /** @type {number} */ (jspb.Message.getFieldProto3(this, 3, 0));
 };
 
 
-/** @param {number} value */
+/** @param {number} value  */
 proto.protocol.ChainStatus.prototype.setMonitorVersion = function(value) {
-  jspb.Message.setProto3IntField(this, 3, value);
+  jspb.Message.setField(this, 3, value);
 };
 
 
@@ -2456,13 +3393,13 @@ proto.protocol.ChainStatus.prototype.setMonitorVersion = function(value) {
  * @return {string}
  */
 proto.protocol.ChainStatus.prototype.getPhantomVersion = function() {
-  return /** @type {string} */ (jspb.Message.getFieldWithDefault(this, 4, ""));
+  return /** @type {string} */ (jspb.Message.getFieldProto3(this, 4, ""));
 };
 
 
-/** @param {string} value */
+/** @param {string} value  */
 proto.protocol.ChainStatus.prototype.setPhantomVersion = function(value) {
-  jspb.Message.setProto3StringField(this, 4, value);
+  jspb.Message.setField(this, 4, value);
 };
 
 
@@ -2471,13 +3408,13 @@ proto.protocol.ChainStatus.prototype.setPhantomVersion = function(value) {
  * @return {number}
  */
 proto.protocol.ChainStatus.prototype.getTimestamp = function() {
-  return /** @type {number} */ (jspb.Message.getFieldWithDefault(this, 5, 0));
+  return /** @type {number} */ (jspb.Message.getFieldProto3(this, 5, 0));
 };
 
 
-/** @param {number} value */
+/** @param {number} value  */
 proto.protocol.ChainStatus.prototype.setTimestamp = function(value) {
-  jspb.Message.setProto3IntField(this, 5, value);
+  jspb.Message.setField(this, 5, value);
 };
 
 
@@ -2531,12 +3468,11 @@ proto.protocol.ChainPeerMessage.prototype.toObject = function(opt_includeInstanc
  *     http://goto/soy-param-migration
  * @param {!proto.protocol.ChainPeerMessage} msg The msg instance to transform.
  * @return {!Object}
- * @suppress {unusedLocalVariables} f is only used for nested messages
  */
 proto.protocol.ChainPeerMessage.toObject = function(includeInstance, msg) {
   var f, obj = {
-    srcPeerAddr: jspb.Message.getFieldWithDefault(msg, 1, ""),
-    desPeerAddrsList: jspb.Message.getRepeatedField(msg, 2),
+    srcPeerAddr: msg.getSrcPeerAddr(),
+    desPeerAddrsList: jspb.Message.getField(msg, 2),
     data: msg.getData_asB64()
   };
 
@@ -2580,7 +3516,8 @@ proto.protocol.ChainPeerMessage.deserializeBinaryFromReader = function(msg, read
       break;
     case 2:
       var value = /** @type {string} */ (reader.readString());
-      msg.addDesPeerAddrs(value);
+      msg.getDesPeerAddrsList().push(value);
+      msg.setDesPeerAddrsList(msg.getDesPeerAddrsList());
       break;
     case 3:
       var value = /** @type {!Uint8Array} */ (reader.readBytes());
@@ -2595,41 +3532,50 @@ proto.protocol.ChainPeerMessage.deserializeBinaryFromReader = function(msg, read
 };
 
 
+/**
+ * Class method variant: serializes the given message to binary data
+ * (in protobuf wire format), writing to the given BinaryWriter.
+ * @param {!proto.protocol.ChainPeerMessage} message
+ * @param {!jspb.BinaryWriter} writer
+ */
+proto.protocol.ChainPeerMessage.serializeBinaryToWriter = function(message, writer) {
+  message.serializeBinaryToWriter(writer);
+};
+
+
 /**
  * Serializes the message to binary data (in protobuf wire format).
  * @return {!Uint8Array}
  */
 proto.protocol.ChainPeerMessage.prototype.serializeBinary = function() {
   var writer = new jspb.BinaryWriter();
-  proto.protocol.ChainPeerMessage.serializeBinaryToWriter(this, writer);
+  this.serializeBinaryToWriter(writer);
   return writer.getResultBuffer();
 };
 
 
 /**
- * Serializes the given message to binary data (in protobuf wire
- * format), writing to the given BinaryWriter.
- * @param {!proto.protocol.ChainPeerMessage} message
+ * Serializes the message to binary data (in protobuf wire format),
+ * writing to the given BinaryWriter.
  * @param {!jspb.BinaryWriter} writer
- * @suppress {unusedLocalVariables} f is only used for nested messages
  */
-proto.protocol.ChainPeerMessage.serializeBinaryToWriter = function(message, writer) {
+proto.protocol.ChainPeerMessage.prototype.serializeBinaryToWriter = function (writer) {
   var f = undefined;
-  f = message.getSrcPeerAddr();
+  f = this.getSrcPeerAddr();
   if (f.length > 0) {
     writer.writeString(
       1,
       f
     );
   }
-  f = message.getDesPeerAddrsList();
+  f = this.getDesPeerAddrsList();
   if (f.length > 0) {
     writer.writeRepeatedString(
       2,
       f
     );
   }
-  f = message.getData_asU8();
+  f = this.getData_asU8();
   if (f.length > 0) {
     writer.writeBytes(
       3,
@@ -2639,47 +3585,49 @@ proto.protocol.ChainPeerMessage.serializeBinaryToWriter = function(message, writ
 };
 
 
+/**
+ * Creates a deep clone of this proto. No data is shared with the original.
+ * @return {!proto.protocol.ChainPeerMessage} The clone.
+ */
+proto.protocol.ChainPeerMessage.prototype.cloneMessage = function() {
+  return /** @type {!proto.protocol.ChainPeerMessage} */ (jspb.Message.cloneMessage(this));
+};
+
+
 /**
  * optional string src_peer_addr = 1;
  * @return {string}
  */
 proto.protocol.ChainPeerMessage.prototype.getSrcPeerAddr = function() {
-  return /** @type {string} */ (jspb.Message.getFieldWithDefault(this, 1, ""));
+  return /** @type {string} */ (jspb.Message.getFieldProto3(this, 1, ""));
 };
 
 
-/** @param {string} value */
+/** @param {string} value  */
 proto.protocol.ChainPeerMessage.prototype.setSrcPeerAddr = function(value) {
-  jspb.Message.setProto3StringField(this, 1, value);
+  jspb.Message.setField(this, 1, value);
 };
 
 
 /**
  * repeated string des_peer_addrs = 2;
+ * If you change this array by adding, removing or replacing elements, or if you
+ * replace the array itself, then you must call the setter to update it.
  * @return {!Array.<string>}
  */
 proto.protocol.ChainPeerMessage.prototype.getDesPeerAddrsList = function() {
-  return /** @type {!Array.<string>} */ (jspb.Message.getRepeatedField(this, 2));
+  return /** @type {!Array.<string>} */ (jspb.Message.getField(this, 2));
 };
 
 
-/** @param {!Array.<string>} value */
+/** @param {Array.<string>} value  */
 proto.protocol.ChainPeerMessage.prototype.setDesPeerAddrsList = function(value) {
   jspb.Message.setField(this, 2, value || []);
 };
 
 
-/**
- * @param {!string} value
- * @param {number=} opt_index
- */
-proto.protocol.ChainPeerMessage.prototype.addDesPeerAddrs = function(value, opt_index) {
-  jspb.Message.addToRepeatedField(this, 2, value, opt_index);
-};
-
-
 proto.protocol.ChainPeerMessage.prototype.clearDesPeerAddrsList = function() {
-  this.setDesPeerAddrsList([]);
+  jspb.Message.setField(this, 2, []);
 };
 
 
@@ -2688,7 +3636,7 @@ proto.protocol.ChainPeerMessage.prototype.clearDesPeerAddrsList = function() {
  * @return {!(string|Uint8Array)}
  */
 proto.protocol.ChainPeerMessage.prototype.getData = function() {
-  return /** @type {!(string|Uint8Array)} */ (jspb.Message.getFieldWithDefault(this, 3, ""));
+  return /** @type {!(string|Uint8Array)} */ (jspb.Message.getFieldProto3(this, 3, ""));
 };
 
 
@@ -2716,9 +3664,9 @@ proto.protocol.ChainPeerMessage.prototype.getData_asU8 = function() {
 };
 
 
-/** @param {!(string|Uint8Array)} value */
+/** @param {!(string|Uint8Array)} value  */
 proto.protocol.ChainPeerMessage.prototype.setData = function(value) {
-  jspb.Message.setProto3BytesField(this, 3, value);
+  jspb.Message.setField(this, 3, value);
 };
 
 
@@ -2772,11 +3720,10 @@ proto.protocol.ChainSubscribeTx.prototype.toObject = function(opt_includeInstanc
  *     http://goto/soy-param-migration
  * @param {!proto.protocol.ChainSubscribeTx} msg The msg instance to transform.
  * @return {!Object}
- * @suppress {unusedLocalVariables} f is only used for nested messages
  */
 proto.protocol.ChainSubscribeTx.toObject = function(includeInstance, msg) {
   var f, obj = {
-    addressList: jspb.Message.getRepeatedField(msg, 1)
+    addressList: jspb.Message.getField(msg, 1)
   };
 
   if (includeInstance) {
@@ -2815,7 +3762,8 @@ proto.protocol.ChainSubscribeTx.deserializeBinaryFromReader = function(msg, read
     switch (field) {
     case 1:
       var value = /** @type {string} */ (reader.readString());
-      msg.addAddress(value);
+      msg.getAddressList().push(value);
+      msg.setAddressList(msg.getAddressList());
       break;
     default:
       reader.skipField();
@@ -2826,27 +3774,36 @@ proto.protocol.ChainSubscribeTx.deserializeBinaryFromReader = function(msg, read
 };
 
 
+/**
+ * Class method variant: serializes the given message to binary data
+ * (in protobuf wire format), writing to the given BinaryWriter.
+ * @param {!proto.protocol.ChainSubscribeTx} message
+ * @param {!jspb.BinaryWriter} writer
+ */
+proto.protocol.ChainSubscribeTx.serializeBinaryToWriter = function(message, writer) {
+  message.serializeBinaryToWriter(writer);
+};
+
+
 /**
  * Serializes the message to binary data (in protobuf wire format).
  * @return {!Uint8Array}
  */
 proto.protocol.ChainSubscribeTx.prototype.serializeBinary = function() {
   var writer = new jspb.BinaryWriter();
-  proto.protocol.ChainSubscribeTx.serializeBinaryToWriter(this, writer);
+  this.serializeBinaryToWriter(writer);
   return writer.getResultBuffer();
 };
 
 
 /**
- * Serializes the given message to binary data (in protobuf wire
- * format), writing to the given BinaryWriter.
- * @param {!proto.protocol.ChainSubscribeTx} message
+ * Serializes the message to binary data (in protobuf wire format),
+ * writing to the given BinaryWriter.
  * @param {!jspb.BinaryWriter} writer
- * @suppress {unusedLocalVariables} f is only used for nested messages
  */
-proto.protocol.ChainSubscribeTx.serializeBinaryToWriter = function(message, writer) {
+proto.protocol.ChainSubscribeTx.prototype.serializeBinaryToWriter = function (writer) {
   var f = undefined;
-  f = message.getAddressList();
+  f = this.getAddressList();
   if (f.length > 0) {
     writer.writeRepeatedString(
       1,
@@ -2856,32 +3813,34 @@ proto.protocol.ChainSubscribeTx.serializeBinaryToWriter = function(message, writ
 };
 
 
+/**
+ * Creates a deep clone of this proto. No data is shared with the original.
+ * @return {!proto.protocol.ChainSubscribeTx} The clone.
+ */
+proto.protocol.ChainSubscribeTx.prototype.cloneMessage = function() {
+  return /** @type {!proto.protocol.ChainSubscribeTx} */ (jspb.Message.cloneMessage(this));
+};
+
+
 /**
  * repeated string address = 1;
+ * If you change this array by adding, removing or replacing elements, or if you
+ * replace the array itself, then you must call the setter to update it.
  * @return {!Array.<string>}
  */
 proto.protocol.ChainSubscribeTx.prototype.getAddressList = function() {
-  return /** @type {!Array.<string>} */ (jspb.Message.getRepeatedField(this, 1));
+  return /** @type {!Array.<string>} */ (jspb.Message.getField(this, 1));
 };
 
 
-/** @param {!Array.<string>} value */
+/** @param {Array.<string>} value  */
 proto.protocol.ChainSubscribeTx.prototype.setAddressList = function(value) {
   jspb.Message.setField(this, 1, value || []);
 };
 
 
-/**
- * @param {!string} value
- * @param {number=} opt_index
- */
-proto.protocol.ChainSubscribeTx.prototype.addAddress = function(value, opt_index) {
-  jspb.Message.addToRepeatedField(this, 1, value, opt_index);
-};
-
-
 proto.protocol.ChainSubscribeTx.prototype.clearAddressList = function() {
-  this.setAddressList([]);
+  jspb.Message.setField(this, 1, []);
 };
 
 
@@ -2928,12 +3887,11 @@ proto.protocol.ChainResponse.prototype.toObject = function(opt_includeInstance)
  *     http://goto/soy-param-migration
  * @param {!proto.protocol.ChainResponse} msg The msg instance to transform.
  * @return {!Object}
- * @suppress {unusedLocalVariables} f is only used for nested messages
  */
 proto.protocol.ChainResponse.toObject = function(includeInstance, msg) {
   var f, obj = {
-    errorCode: jspb.Message.getFieldWithDefault(msg, 1, 0),
-    errorDesc: jspb.Message.getFieldWithDefault(msg, 2, "")
+    errorCode: msg.getErrorCode(),
+    errorDesc: msg.getErrorDesc()
   };
 
   if (includeInstance) {
@@ -2987,34 +3945,43 @@ proto.protocol.ChainResponse.deserializeBinaryFromReader = function(msg, reader)
 };
 
 
+/**
+ * Class method variant: serializes the given message to binary data
+ * (in protobuf wire format), writing to the given BinaryWriter.
+ * @param {!proto.protocol.ChainResponse} message
+ * @param {!jspb.BinaryWriter} writer
+ */
+proto.protocol.ChainResponse.serializeBinaryToWriter = function(message, writer) {
+  message.serializeBinaryToWriter(writer);
+};
+
+
 /**
  * Serializes the message to binary data (in protobuf wire format).
  * @return {!Uint8Array}
  */
 proto.protocol.ChainResponse.prototype.serializeBinary = function() {
   var writer = new jspb.BinaryWriter();
-  proto.protocol.ChainResponse.serializeBinaryToWriter(this, writer);
+  this.serializeBinaryToWriter(writer);
   return writer.getResultBuffer();
 };
 
 
 /**
- * Serializes the given message to binary data (in protobuf wire
- * format), writing to the given BinaryWriter.
- * @param {!proto.protocol.ChainResponse} message
+ * Serializes the message to binary data (in protobuf wire format),
+ * writing to the given BinaryWriter.
  * @param {!jspb.BinaryWriter} writer
- * @suppress {unusedLocalVariables} f is only used for nested messages
  */
-proto.protocol.ChainResponse.serializeBinaryToWriter = function(message, writer) {
+proto.protocol.ChainResponse.prototype.serializeBinaryToWriter = function (writer) {
   var f = undefined;
-  f = message.getErrorCode();
+  f = this.getErrorCode();
   if (f !== 0) {
     writer.writeInt32(
       1,
       f
     );
   }
-  f = message.getErrorDesc();
+  f = this.getErrorDesc();
   if (f.length > 0) {
     writer.writeString(
       2,
@@ -3024,18 +3991,27 @@ proto.protocol.ChainResponse.serializeBinaryToWriter = function(message, writer)
 };
 
 
+/**
+ * Creates a deep clone of this proto. No data is shared with the original.
+ * @return {!proto.protocol.ChainResponse} The clone.
+ */
+proto.protocol.ChainResponse.prototype.cloneMessage = function() {
+  return /** @type {!proto.protocol.ChainResponse} */ (jspb.Message.cloneMessage(this));
+};
+
+
 /**
  * optional int32 error_code = 1;
  * @return {number}
  */
 proto.protocol.ChainResponse.prototype.getErrorCode = function() {
-  return /** @type {number} */ (jspb.Message.getFieldWithDefault(this, 1, 0));
+  return /** @type {number} */ (jspb.Message.getFieldProto3(this, 1, 0));
 };
 
 
-/** @param {number} value */
+/** @param {number} value  */
 proto.protocol.ChainResponse.prototype.setErrorCode = function(value) {
-  jspb.Message.setProto3IntField(this, 1, value);
+  jspb.Message.setField(this, 1, value);
 };
 
 
@@ -3044,13 +4020,13 @@ proto.protocol.ChainResponse.prototype.setErrorCode = function(value) {
  * @return {string}
  */
 proto.protocol.ChainResponse.prototype.getErrorDesc = function() {
-  return /** @type {string} */ (jspb.Message.getFieldWithDefault(this, 2, ""));
+  return /** @type {string} */ (jspb.Message.getFieldProto3(this, 2, ""));
 };
 
 
-/** @param {string} value */
+/** @param {string} value  */
 proto.protocol.ChainResponse.prototype.setErrorDesc = function(value) {
-  jspb.Message.setProto3StringField(this, 2, value);
+  jspb.Message.setField(this, 2, value);
 };
 
 
@@ -3097,19 +4073,18 @@ proto.protocol.ChainTxStatus.prototype.toObject = function(opt_includeInstance)
  *     http://goto/soy-param-migration
  * @param {!proto.protocol.ChainTxStatus} msg The msg instance to transform.
  * @return {!Object}
- * @suppress {unusedLocalVariables} f is only used for nested messages
  */
 proto.protocol.ChainTxStatus.toObject = function(includeInstance, msg) {
   var f, obj = {
-    status: jspb.Message.getFieldWithDefault(msg, 1, 0),
-    txHash: jspb.Message.getFieldWithDefault(msg, 2, ""),
-    sourceAddress: jspb.Message.getFieldWithDefault(msg, 3, ""),
-    sourceAccountSeq: jspb.Message.getFieldWithDefault(msg, 4, 0),
-    ledgerSeq: jspb.Message.getFieldWithDefault(msg, 5, 0),
-    newAccountSeq: jspb.Message.getFieldWithDefault(msg, 6, 0),
-    errorCode: jspb.Message.getFieldWithDefault(msg, 7, 0),
-    errorDesc: jspb.Message.getFieldWithDefault(msg, 8, ""),
-    timestamp: jspb.Message.getFieldWithDefault(msg, 9, 0)
+    status: msg.getStatus(),
+    txHash: msg.getTxHash(),
+    sourceAddress: msg.getSourceAddress(),
+    sourceAccountSeq: msg.getSourceAccountSeq(),
+    ledgerSeq: msg.getLedgerSeq(),
+    newAccountSeq: msg.getNewAccountSeq(),
+    errorCode: msg.getErrorCode(),
+    errorDesc: msg.getErrorDesc(),
+    timestamp: msg.getTimestamp()
   };
 
   if (includeInstance) {
@@ -3191,83 +4166,92 @@ proto.protocol.ChainTxStatus.deserializeBinaryFromReader = function(msg, reader)
 };
 
 
+/**
+ * Class method variant: serializes the given message to binary data
+ * (in protobuf wire format), writing to the given BinaryWriter.
+ * @param {!proto.protocol.ChainTxStatus} message
+ * @param {!jspb.BinaryWriter} writer
+ */
+proto.protocol.ChainTxStatus.serializeBinaryToWriter = function(message, writer) {
+  message.serializeBinaryToWriter(writer);
+};
+
+
 /**
  * Serializes the message to binary data (in protobuf wire format).
  * @return {!Uint8Array}
  */
 proto.protocol.ChainTxStatus.prototype.serializeBinary = function() {
   var writer = new jspb.BinaryWriter();
-  proto.protocol.ChainTxStatus.serializeBinaryToWriter(this, writer);
+  this.serializeBinaryToWriter(writer);
   return writer.getResultBuffer();
 };
 
 
 /**
- * Serializes the given message to binary data (in protobuf wire
- * format), writing to the given BinaryWriter.
- * @param {!proto.protocol.ChainTxStatus} message
+ * Serializes the message to binary data (in protobuf wire format),
+ * writing to the given BinaryWriter.
  * @param {!jspb.BinaryWriter} writer
- * @suppress {unusedLocalVariables} f is only used for nested messages
  */
-proto.protocol.ChainTxStatus.serializeBinaryToWriter = function(message, writer) {
+proto.protocol.ChainTxStatus.prototype.serializeBinaryToWriter = function (writer) {
   var f = undefined;
-  f = message.getStatus();
+  f = this.getStatus();
   if (f !== 0.0) {
     writer.writeEnum(
       1,
       f
     );
   }
-  f = message.getTxHash();
+  f = this.getTxHash();
   if (f.length > 0) {
     writer.writeString(
       2,
       f
     );
   }
-  f = message.getSourceAddress();
+  f = this.getSourceAddress();
   if (f.length > 0) {
     writer.writeString(
       3,
       f
     );
   }
-  f = message.getSourceAccountSeq();
+  f = this.getSourceAccountSeq();
   if (f !== 0) {
     writer.writeInt64(
       4,
       f
     );
   }
-  f = message.getLedgerSeq();
+  f = this.getLedgerSeq();
   if (f !== 0) {
     writer.writeInt64(
       5,
       f
     );
   }
-  f = message.getNewAccountSeq();
+  f = this.getNewAccountSeq();
   if (f !== 0) {
     writer.writeInt64(
       6,
       f
     );
   }
-  f = message.getErrorCode();
+  f = this.getErrorCode();
   if (f !== 0.0) {
     writer.writeEnum(
       7,
       f
     );
   }
-  f = message.getErrorDesc();
+  f = this.getErrorDesc();
   if (f.length > 0) {
     writer.writeString(
       8,
       f
     );
   }
-  f = message.getTimestamp();
+  f = this.getTimestamp();
   if (f !== 0) {
     writer.writeInt64(
       9,
@@ -3278,28 +4262,26 @@ proto.protocol.ChainTxStatus.serializeBinaryToWriter = function(message, writer)
 
 
 /**
- * @enum {number}
+ * Creates a deep clone of this proto. No data is shared with the original.
+ * @return {!proto.protocol.ChainTxStatus} The clone.
  */
-proto.protocol.ChainTxStatus.TxStatus = {
-  UNDEFINED: 0,
-  CONFIRMED: 1,
-  PENDING: 2,
-  COMPLETE: 3,
-  FAILURE: 4
+proto.protocol.ChainTxStatus.prototype.cloneMessage = function() {
+  return /** @type {!proto.protocol.ChainTxStatus} */ (jspb.Message.cloneMessage(this));
 };
 
+
 /**
  * optional TxStatus status = 1;
  * @return {!proto.protocol.ChainTxStatus.TxStatus}
  */
 proto.protocol.ChainTxStatus.prototype.getStatus = function() {
-  return /** @type {!proto.protocol.ChainTxStatus.TxStatus} */ (jspb.Message.getFieldWithDefault(this, 1, 0));
+  return /** @type {!proto.protocol.ChainTxStatus.TxStatus} */ (jspb.Message.getFieldProto3(this, 1, 0));
 };
 
 
-/** @param {!proto.protocol.ChainTxStatus.TxStatus} value */
+/** @param {!proto.protocol.ChainTxStatus.TxStatus} value  */
 proto.protocol.ChainTxStatus.prototype.setStatus = function(value) {
-  jspb.Message.setProto3EnumField(this, 1, value);
+  jspb.Message.setField(this, 1, value);
 };
 
 
@@ -3308,13 +4290,13 @@ proto.protocol.ChainTxStatus.prototype.setStatus = function(value) {
  * @return {string}
  */
 proto.protocol.ChainTxStatus.prototype.getTxHash = function() {
-  return /** @type {string} */ (jspb.Message.getFieldWithDefault(this, 2, ""));
+  return /** @type {string} */ (jspb.Message.getFieldProto3(this, 2, ""));
 };
 
 
-/** @param {string} value */
+/** @param {string} value  */
 proto.protocol.ChainTxStatus.prototype.setTxHash = function(value) {
-  jspb.Message.setProto3StringField(this, 2, value);
+  jspb.Message.setField(this, 2, value);
 };
 
 
@@ -3323,13 +4305,13 @@ proto.protocol.ChainTxStatus.prototype.setTxHash = function(value) {
  * @return {string}
  */
 proto.protocol.ChainTxStatus.prototype.getSourceAddress = function() {
-  return /** @type {string} */ (jspb.Message.getFieldWithDefault(this, 3, ""));
+  return /** @type {string} */ (jspb.Message.getFieldProto3(this, 3, ""));
 };
 
 
-/** @param {string} value */
+/** @param {string} value  */
 proto.protocol.ChainTxStatus.prototype.setSourceAddress = function(value) {
-  jspb.Message.setProto3StringField(this, 3, value);
+  jspb.Message.setField(this, 3, value);
 };
 
 
@@ -3338,13 +4320,13 @@ proto.protocol.ChainTxStatus.prototype.setSourceAddress = function(value) {
  * @return {number}
  */
 proto.protocol.ChainTxStatus.prototype.getSourceAccountSeq = function() {
-  return /** @type {number} */ (jspb.Message.getFieldWithDefault(this, 4, 0));
+  return /** @type {number} */ (jspb.Message.getFieldProto3(this, 4, 0));
 };
 
 
-/** @param {number} value */
+/** @param {number} value  */
 proto.protocol.ChainTxStatus.prototype.setSourceAccountSeq = function(value) {
-  jspb.Message.setProto3IntField(this, 4, value);
+  jspb.Message.setField(this, 4, value);
 };
 
 
@@ -3353,13 +4335,13 @@ proto.protocol.ChainTxStatus.prototype.setSourceAccountSeq = function(value) {
  * @return {number}
  */
 proto.protocol.ChainTxStatus.prototype.getLedgerSeq = function() {
-  return /** @type {number} */ (jspb.Message.getFieldWithDefault(this, 5, 0));
+  return /** @type {number} */ (jspb.Message.getFieldProto3(this, 5, 0));
 };
 
 
-/** @param {number} value */
+/** @param {number} value  */
 proto.protocol.ChainTxStatus.prototype.setLedgerSeq = function(value) {
-  jspb.Message.setProto3IntField(this, 5, value);
+  jspb.Message.setField(this, 5, value);
 };
 
 
@@ -3368,13 +4350,13 @@ proto.protocol.ChainTxStatus.prototype.setLedgerSeq = function(value) {
  * @return {number}
  */
 proto.protocol.ChainTxStatus.prototype.getNewAccountSeq = function() {
-  return /** @type {number} */ (jspb.Message.getFieldWithDefault(this, 6, 0));
+  return /** @type {number} */ (jspb.Message.getFieldProto3(this, 6, 0));
 };
 
 
-/** @param {number} value */
+/** @param {number} value  */
 proto.protocol.ChainTxStatus.prototype.setNewAccountSeq = function(value) {
-  jspb.Message.setProto3IntField(this, 6, value);
+  jspb.Message.setField(this, 6, value);
 };
 
 
@@ -3383,13 +4365,13 @@ proto.protocol.ChainTxStatus.prototype.setNewAccountSeq = function(value) {
  * @return {!proto.protocol.ERRORCODE}
  */
 proto.protocol.ChainTxStatus.prototype.getErrorCode = function() {
-  return /** @type {!proto.protocol.ERRORCODE} */ (jspb.Message.getFieldWithDefault(this, 7, 0));
+  return /** @type {!proto.protocol.ERRORCODE} */ (jspb.Message.getFieldProto3(this, 7, 0));
 };
 
 
-/** @param {!proto.protocol.ERRORCODE} value */
+/** @param {!proto.protocol.ERRORCODE} value  */
 proto.protocol.ChainTxStatus.prototype.setErrorCode = function(value) {
-  jspb.Message.setProto3EnumField(this, 7, value);
+  jspb.Message.setField(this, 7, value);
 };
 
 
@@ -3398,13 +4380,13 @@ proto.protocol.ChainTxStatus.prototype.setErrorCode = function(value) {
  * @return {string}
  */
 proto.protocol.ChainTxStatus.prototype.getErrorDesc = function() {
-  return /** @type {string} */ (jspb.Message.getFieldWithDefault(this, 8, ""));
+  return /** @type {string} */ (jspb.Message.getFieldProto3(this, 8, ""));
 };
 
 
-/** @param {string} value */
+/** @param {string} value  */
 proto.protocol.ChainTxStatus.prototype.setErrorDesc = function(value) {
-  jspb.Message.setProto3StringField(this, 8, value);
+  jspb.Message.setField(this, 8, value);
 };
 
 
@@ -3413,16 +4395,27 @@ proto.protocol.ChainTxStatus.prototype.setErrorDesc = function(value) {
  * @return {number}
  */
 proto.protocol.ChainTxStatus.prototype.getTimestamp = function() {
-  return /** @type {number} */ (jspb.Message.getFieldWithDefault(this, 9, 0));
+  return /** @type {number} */ (jspb.Message.getFieldProto3(this, 9, 0));
 };
 
 
-/** @param {number} value */
+/** @param {number} value  */
 proto.protocol.ChainTxStatus.prototype.setTimestamp = function(value) {
-  jspb.Message.setProto3IntField(this, 9, value);
+  jspb.Message.setField(this, 9, value);
 };
 
 
+/**
+ * @enum {number}
+ */
+proto.protocol.ChainTxStatus.TxStatus = {
+  UNDEFINED: 0,
+  CONFIRMED: 1,
+  PENDING: 2,
+  COMPLETE: 3,
+  FAILURE: 4
+};
+
 /**
  * @enum {number}
  */
@@ -3434,7 +4427,8 @@ proto.protocol.OVERLAY_MESSAGE_TYPE = {
   OVERLAY_MSGTYPE_TRANSACTION: 4,
   OVERLAY_MSGTYPE_LEDGERS: 5,
   OVERLAY_MSGTYPE_PBFT: 6,
-  OVERLAY_MSGTYPE_LEDGER_UPGRADE_NOTIFY: 7
+  OVERLAY_MSGTYPE_LEDGER_UPGRADE_NOTIFY: 7,
+  OVERLAY_MSGTYPE_ACCOUNT_TREE: 8
 };
 
 /**
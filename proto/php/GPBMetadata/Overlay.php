@@ -17,80 +17,93 @@ class Overlay
         \GPBMetadata\Common::initOnce();
         \GPBMetadata\Chain::initOnce();
         $pool->internalAddGeneratedFile(hex2bin(
-            "0a9d110a0d6f7665726c61792e70726f746f120870726f746f636f6c1a0b" .
-            "636861696e2e70726f746f22a3010a0548656c6c6f12120a0a6e6574776f" .
+            "0aa9140a0d6f7665726c61792e70726f746f120870726f746f636f6c1a0b" .
+            "636861696e2e70726f746f22a6010a0548656c6c6f12120a0a6e6574776f" .
             "726b5f696418012001280312160a0e6c65646765725f76657273696f6e18" .
             "022001280312170a0f6f7665726c61795f76657273696f6e180320012803" .
-            "12140a0c62756d6f5f76657273696f6e18042001280912160a0e6c697374" .
-            "656e696e675f706f727418052001280312140a0c6e6f64655f6164647265" .
-            "737318062001280912110a096e6f64655f72616e64180720012809224c0a" .
-            "0d48656c6c6f526573706f6e736512270a0a6572726f725f636f64651801" .
-            "2001280e32132e70726f746f636f6c2e4552524f52434f444512120a0a65" .
-            "72726f725f64657363180220012809227d0a0450656572120a0a02697018" .
-            "0120012809120c0a04706f727418022001280312140a0c6e756d5f666169" .
-            "6c7572657318032001280312190a116e6578745f617474656d70745f7469" .
-            "6d6518042001280312130a0b6163746976655f74696d6518052001280312" .
-            "150a0d636f6e6e656374696f6e5f696418062001280322260a0550656572" .
-            "73121d0a05706565727318012003280b320e2e70726f746f636f6c2e5065" .
-            "6572223b0a0a4765744c656467657273120d0a05626567696e1801200128" .
-            "03120b0a03656e6418022001280312110a0974696d657374616d70180320" .
-            "01280322df010a074c65646765727312280a0676616c7565731801200328" .
-            "0b32182e70726f746f636f6c2e436f6e73656e73757356616c7565122d0a" .
-            "0973796e635f636f646518022001280e321a2e70726f746f636f6c2e4c65" .
-            "64676572732e53796e63436f6465120f0a076d61785f7365711803200128" .
-            "03120d0a0570726f6f6618042001280c225b0a0853796e63436f64651206" .
-            "0a024f4b1000120f0a0b4f55545f4f465f53594e43100112120a0e4f5554" .
-            "5f4f465f4c454447455253100212080a04425553591003120a0a06524546" .
-            "5553451004120c0a08494e5445524e414c100522260a08446f6e74486176" .
-            "65120c0a0474797065180120012803120c0a046861736818022001280c22" .
-            "760a134c6564676572557067726164654e6f74696679120d0a056e6f6e63" .
-            "6518012001280312280a077570677261646518022001280b32172e70726f" .
-            "746f636f6c2e4c65646765725570677261646512260a097369676e617475" .
-            "726518032001280b32132e70726f746f636f6c2e5369676e617475726522" .
-            "1a0a09456e7472794c697374120d0a05656e74727918012003280c224d0a" .
-            "0a436861696e48656c6c6f122c0a086170695f6c69737418012003280e32" .
-            "1a2e70726f746f636f6c2e436861696e4d6573736167655479706512110a" .
-            "0974696d657374616d70180220012803227a0a0b436861696e5374617475" .
-            "7312110a0973656c665f6164647218012001280912160a0e6c6564676572" .
-            "5f76657273696f6e18022001280312170a0f6d6f6e69746f725f76657273" .
-            "696f6e18032001280312140a0c62756d6f5f76657273696f6e1804200128" .
-            "0912110a0974696d657374616d70180520012803224f0a10436861696e50" .
-            "6565724d65737361676512150a0d7372635f706565725f61646472180120" .
-            "01280912160a0e6465735f706565725f6164647273180220032809120c0a" .
-            "046461746118032001280c22230a10436861696e53756273637269626554" .
-            "78120f0a076164647265737318012003280922370a0d436861696e526573" .
-            "706f6e736512120a0a6572726f725f636f646518012001280512120a0a65" .
-            "72726f725f6465736318022001280922d5020a0d436861696e5478537461" .
-            "74757312300a0673746174757318012001280e32202e70726f746f636f6c" .
-            "2e436861696e54785374617475732e5478537461747573120f0a0774785f" .
-            "6861736818022001280912160a0e736f757263655f616464726573731803" .
-            "20012809121a0a12736f757263655f6163636f756e745f73657118042001" .
-            "280312120a0a6c65646765725f73657118052001280312170a0f6e65775f" .
-            "6163636f756e745f73657118062001280312270a0a6572726f725f636f64" .
-            "6518072001280e32132e70726f746f636f6c2e4552524f52434f44451212" .
-            "0a0a6572726f725f6465736318082001280912110a0974696d657374616d" .
-            "7018092001280322500a085478537461747573120d0a09554e444546494e" .
-            "45441000120d0a09434f4e4649524d45441001120b0a0750454e44494e47" .
-            "1002120c0a08434f4d504c4554451003120b0a074641494c55524510042a" .
-            "83020a144f5645524c41595f4d4553534147455f5459504512180a144f56" .
-            "45524c41595f4d5347545950455f4e4f4e45100012180a144f5645524c41" .
-            "595f4d5347545950455f50494e47100112190a154f5645524c41595f4d53" .
-            "47545950455f48454c4c4f100212190a154f5645524c41595f4d53475459" .
-            "50455f50454552531003121f0a1b4f5645524c41595f4d5347545950455f" .
-            "5452414e53414354494f4e1004121b0a174f5645524c41595f4d53475459" .
-            "50455f4c454447455253100512180a144f5645524c41595f4d5347545950" .
-            "455f50424654100612290a254f5645524c41595f4d5347545950455f4c45" .
-            "444745525f555047524144455f4e4f5449465910072afa010a1043686169" .
-            "6e4d6573736167655479706512130a0f434841494e5f545950455f4e4f4e" .
-            "451000120f0a0b434841494e5f48454c4c4f100a12130a0f434841494e5f" .
-            "54585f535441545553100b12150a11434841494e5f504545525f4f4e4c49" .
-            "4e45100c12160a12434841494e5f504545525f4f46464c494e45100d1216" .
-            "0a12434841494e5f504545525f4d455353414745100e121b0a1743484149" .
-            "4e5f5355424d49545452414e53414354494f4e100f12170a13434841494e" .
-            "5f4c45444745525f484541444552101012160a12434841494e5f53554253" .
-            "43524942455f5458101112160a12434841494e5f54585f454e565f53544f" .
-            "5245101242220a20696f2e62756d6f2e73646b2e636f72652e657874656e" .
-            "642e70726f746f627566620670726f746f33"
+            "12170a0f7068616e746f6d5f76657273696f6e18042001280912160a0e6c" .
+            "697374656e696e675f706f727418052001280312140a0c6e6f64655f6164" .
+            "647265737318062001280912110a096e6f64655f72616e64180720012809" .
+            "224c0a0d48656c6c6f526573706f6e736512270a0a6572726f725f636f64" .
+            "6518012001280e32132e70726f746f636f6c2e4552524f52434f44451212" .
+            "0a0a6572726f725f64657363180220012809227d0a0450656572120a0a02" .
+            "6970180120012809120c0a04706f727418022001280312140a0c6e756d5f" .
+            "6661696c7572657318032001280312190a116e6578745f617474656d7074" .
+            "5f74696d6518042001280312130a0b6163746976655f74696d6518052001" .
+            "280312150a0d636f6e6e656374696f6e5f696418062001280322260a0550" .
+            "65657273121d0a05706565727318012003280b320e2e70726f746f636f6c" .
+            "2e50656572223b0a0a4765744c656467657273120d0a05626567696e1801" .
+            "20012803120b0a03656e6418022001280312110a0974696d657374616d70" .
+            "18032001280322df010a074c65646765727312280a0676616c7565731801" .
+            "2003280b32182e70726f746f636f6c2e436f6e73656e73757356616c7565" .
+            "122d0a0973796e635f636f646518022001280e321a2e70726f746f636f6c" .
+            "2e4c6564676572732e53796e63436f6465120f0a076d61785f7365711803" .
+            "20012803120d0a0570726f6f6618042001280c225b0a0853796e63436f64" .
+            "6512060a024f4b1000120f0a0b4f55545f4f465f53594e43100112120a0e" .
+            "4f55545f4f465f4c454447455253100212080a04425553591003120a0a06" .
+            "5245465553451004120c0a08494e5445524e414c100522450a0e47657441" .
+            "63636f756e745472656512120a0a6c65646765725f736571180120012803" .
+            "120c0a046b65797318022003280c12110a0974696d657374616d70180320" .
+            "0128032296020a0b4163636f756e745472656512310a0973796e635f636f" .
+            "646518012001280e321e2e70726f746f636f6c2e4163636f756e74547265" .
+            "652e53796e63436f646512120a0a6c65646765725f736571180220012803" .
+            "120e0a0676616c75657318032003280c12200a066c656467657218042001" .
+            "280b32102e70726f746f636f6c2e4c656467657212170a0f636f6e73656e" .
+            "7375735f76616c756518052001280c12120a0a6e6578745f76616c756518" .
+            "062001280c12120a0a6e6578745f70726f6f6618072001280c120c0a0466" .
+            "65657318082001280c223f0a0853796e63436f646512060a024f4b100012" .
+            "0d0a094e4f545f52454144591001120e0a0a4e4f545f50494e4e45441002" .
+            "120c0a08494e5445524e414c100322260a08446f6e7448617665120c0a04" .
+            "74797065180120012803120c0a046861736818022001280c22760a134c65" .
+            "64676572557067726164654e6f74696679120d0a056e6f6e636518012001" .
+            "280312280a077570677261646518022001280b32172e70726f746f636f6c" .
+            "2e4c65646765725570677261646512260a097369676e6174757265180320" .
+            "01280b32132e70726f746f636f6c2e5369676e6174757265221a0a09456e" .
+            "7472794c697374120d0a05656e74727918012003280c224d0a0a43686169" .
+            "6e48656c6c6f122c0a086170695f6c69737418012003280e321a2e70726f" .
+            "746f636f6c2e436861696e4d6573736167655479706512110a0974696d65" .
+            "7374616d70180220012803227d0a0b436861696e53746174757312110a09" .
+            "73656c665f6164647218012001280912160a0e6c65646765725f76657273" .
+            "696f6e18022001280312170a0f6d6f6e69746f725f76657273696f6e1803" .
+            "2001280312170a0f7068616e746f6d5f76657273696f6e18042001280912" .
+            "110a0974696d657374616d70180520012803224f0a10436861696e506565" .
+            "724d65737361676512150a0d7372635f706565725f616464721801200128" .
+            "0912160a0e6465735f706565725f6164647273180220032809120c0a0464" .
+            "61746118032001280c22230a10436861696e537562736372696265547812" .
+            "0f0a076164647265737318012003280922370a0d436861696e526573706f" .
+            "6e736512120a0a6572726f725f636f646518012001280512120a0a657272" .
+            "6f725f6465736318022001280922d5020a0d436861696e54785374617475" .
+            "7312300a0673746174757318012001280e32202e70726f746f636f6c2e43" .
+            "6861696e54785374617475732e5478537461747573120f0a0774785f6861" .
+            "736818022001280912160a0e736f757263655f6164647265737318032001" .
+            "2809121a0a12736f757263655f6163636f756e745f736571180420012803" .
+            "12120a0a6c65646765725f73657118052001280312170a0f6e65775f6163" .
+            "636f756e745f73657118062001280312270a0a6572726f725f636f646518" .
+            "072001280e32132e70726f746f636f6c2e4552524f52434f444512120a0a" .
+            "6572726f725f6465736318082001280912110a0974696d657374616d7018" .
+            "092001280322500a085478537461747573120d0a09554e444546494e4544" .
+            "1000120d0a09434f4e4649524d45441001120b0a0750454e44494e471002" .
+            "120c0a08434f4d504c4554451003120b0a074641494c55524510042aa502" .
+            "0a144f5645524c41595f4d4553534147455f5459504512180a144f564552" .
+            "4c41595f4d5347545950455f4e4f4e45100012180a144f5645524c41595f" .
+            "4d5347545950455f50494e47100112190a154f5645524c41595f4d534754" .
+            "5950455f48454c4c4f100212190a154f5645524c41595f4d534754595045" .
+            "5f50454552531003121f0a1b4f5645524c41595f4d5347545950455f5452" .
+            "414e53414354494f4e1004121b0a174f5645524c41595f4d534754595045" .
+            "5f4c454447455253100512180a144f5645524c41595f4d5347545950455f" .
+            "50424654100612290a254f5645524c41595f4d5347545950455f4c454447" .
+            "45525f555047524144455f4e4f54494659100712200a1c4f5645524c4159" .
+            "5f4d5347545950455f4143434f554e545f5452454510082afa010a104368" .
+            "61696e4d6573736167655479706512130a0f434841494e5f545950455f4e" .
+            "4f4e451000120f0a0b434841494e5f48454c4c4f100a12130a0f43484149" .
+            "4e5f54585f535441545553100b12150a11434841494e5f504545525f4f4e" .
+            "4c494e45100c12160a12434841494e5f504545525f4f46464c494e45100d" .
+            "12160a12434841494e5f504545525f4d455353414745100e121b0a174348" .
+            "41494e5f5355424d49545452414e53414354494f4e100f12170a13434841" .
+            "494e5f4c45444745525f484541444552101012160a12434841494e5f5355" .
+            "425343524942455f5458101112160a12434841494e5f54585f454e565f53" .
+            "544f5245101242260a246f72672e7068616e746f6d2e73646b2e636f7265" .
+            "2e657874656e642e70726f746f627566620670726f746f33"
         ));
 
         static::$is_initialized = true;
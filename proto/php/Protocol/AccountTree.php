@@ -0,0 +1,261 @@
+<?php
+# Generated by the protocol buffer compiler.  DO NOT EDIT!
+# source: overlay.proto
+
+namespace Protocol;
+
+use Google\Protobuf\Internal\GPBType;
+use Google\Protobuf\Internal\RepeatedField;
+use Google\Protobuf\Internal\GPBUtil;
+
+/**
+ * Generated from protobuf message <code>protocol.AccountTree</code>
+ */
+class AccountTree extends \Google\Protobuf\Internal\Message
+{
+    /**
+     * Generated from protobuf field <code>.protocol.AccountTree.SyncCode sync_code = 1;</code>
+     */
+    private $sync_code = 0;
+    /**
+     * Generated from protobuf field <code>int64 ledger_seq = 2;</code>
+     */
+    private $ledger_seq = 0;
+    /**
+     *values of the first keys requested, in order
+     *
+     * Generated from protobuf field <code>repeated bytes values = 3;</code>
+     */
+    private $values;
+    /**
+     *for a request without keys
+     *
+     * Generated from protobuf field <code>.protocol.Ledger ledger = 4;</code>
+     */
+    private $ledger = null;
+    /**
+     *of the ledger
+     *
+     * Generated from protobuf field <code>bytes consensus_value = 5;</code>
+     */
+    private $consensus_value = '';
+    /**
+     *its previous ledger hash is the ledger hash
+     *
+     * Generated from protobuf field <code>bytes next_value = 6;</code>
+     */
+    private $next_value = '';
+    /**
+     * Generated from protobuf field <code>bytes next_proof = 7;</code>
+     */
+    private $next_proof = '';
+    /**
+     *fee config of the ledger
+     *
+     * Generated from protobuf field <code>bytes fees = 8;</code>
+     */
+    private $fees = '';
+
+    public function __construct() {
+        \GPBMetadata\Overlay::initOnce();
+        parent::__construct();
+    }
+
+    /**
+     * Generated from protobuf field <code>.protocol.AccountTree.SyncCode sync_code = 1;</code>
+     * @return int
+     */
+    public function getSyncCode()
+    {
+        return $this->sync_code;
+    }
+
+    /**
+     * Generated from protobuf field <code>.protocol.AccountTree.SyncCode sync_code = 1;</code>
+     * @param int $var
+     * @return $this
+     */
+    public function setSyncCode($var)
+    {
+        GPBUtil::checkEnum($var, \Protocol\AccountTree_SyncCode::class);
+        $this->sync_code = $var;
+
+        return $this;
+    }
+
+    /**
+     * Generated from protobuf field <code>int64 ledger_seq = 2;</code>
+     * @return int|string
+     */
+    public function getLedgerSeq()
+    {
+        return $this->ledger_seq;
+    }
+
+    /**
+     * Generated from protobuf field <code>int64 ledger_seq = 2;</code>
+     * @param int|string $var
+     * @return $this
+     */
+    public function setLedgerSeq($var)
+    {
+        GPBUtil::checkInt64($var);
+        $this->ledger_seq = $var;
+
+        return $this;
+    }
+
+    /**
+     *values of the first keys requested, in order
+     *
+     * Generated from protobuf field <code>repeated bytes values = 3;</code>
+     * @return \Google\Protobuf\Internal\RepeatedField
+     */
+    public function getValues()
+    {
+        return $this->values;
+    }
+
+    /**
+     *values of the first keys requested, in order
+     *
+     * Generated from protobuf field <code>repeated bytes values = 3;</code>
+     * @param string[]|\Google\Protobuf\Internal\RepeatedField $var
+     * @return $this
+     */
+    public function setValues($var)
+    {
+        $arr = GPBUtil::checkRepeatedField($var, \Google\Protobuf\Internal\GPBType::BYTES);
+        $this->values = $arr;
+
+        return $this;
+    }
+
+    /**
+     *for a request without keys
+     *
+     * Generated from protobuf field <code>.protocol.Ledger ledger = 4;</code>
+     * @return \Protocol\Ledger
+     */
+    public function getLedger()
+    {
+        return $this->ledger;
+    }
+
+    /**
+     *for a request without keys
+     *
+     * Generated from protobuf field <code>.protocol.Ledger ledger = 4;</code>
+     * @param \Protocol\Ledger $var
+     * @return $this
+     */
+    public function setLedger($var)
+    {
+        GPBUtil::checkMessage($var, \Protocol\Ledger::class);
+        $this->ledger = $var;
+
+        return $this;
+    }
+
+    /**
+     *of the ledger
+     *
+     * Generated from protobuf field <code>bytes consensus_value = 5;</code>
+     * @return string
+     */
+    public function getConsensusValue()
+    {
+        return $this->consensus_value;
+    }
+
+    /**
+     *of the ledger
+     *
+     * Generated from protobuf field <code>bytes consensus_value = 5;</code>
+     * @param string $var
+     * @return $this
+     */
+    public function setConsensusValue($var)
+    {
+        GPBUtil::checkString($var, False);
+        $this->consensus_value = $var;
+
+        return $this;
+    }
+
+    /**
+     *its previous ledger hash is the ledger hash
+     *
+     * Generated from protobuf field <code>bytes next_value = 6;</code>
+     * @return string
+     */
+    public function getNextValue()
+    {
+        return $this->next_value;
+    }
+
+    /**
+     *its previous ledger hash is the ledger hash
+     *
+     * Generated from protobuf field <code>bytes next_value = 6;</code>
+     * @param string $var
+     * @return $this
+     */
+    public function setNextValue($var)
+    {
+        GPBUtil::checkString($var, False);
+        $this->next_value = $var;
+
+        return $this;
+    }
+
+    /**
+     * Generated from protobuf field <code>bytes next_proof = 7;</code>
+     * @return string
+     */
+    public function getNextProof()
+    {
+        return $this->next_proof;
+    }
+
+    /**
+     * Generated from protobuf field <code>bytes next_proof = 7;</code>
+     * @param string $var
+     * @return $this
+     */
+    public function setNextProof($var)
+    {
+        GPBUtil::checkString($var, False);
+        $this->next_proof = $var;
+
+        return $this;
+    }
+
+    /**
+     *fee config of the ledger
+     *
+     * Generated from protobuf field <code>bytes fees = 8;</code>
+     * @return string
+     */
+    public function getFees()
+    {
+        return $this->fees;
+    }
+
+    /**
+     *fee config of the ledger
+     *
+     * Generated from protobuf field <code>bytes fees = 8;</code>
+     * @param string $var
+     * @return $this
+     */
+    public function setFees($var)
+    {
+        GPBUtil::checkString($var, False);
+        $this->fees = $var;
+
+        return $this;
+    }
+
+}
+
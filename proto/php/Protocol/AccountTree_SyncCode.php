@@ -0,0 +1,33 @@
+<?php
+# Generated by the protocol buffer compiler.  DO NOT EDIT!
+# source: overlay.proto
+
+namespace Protocol;
+
+/**
+ * Protobuf enum <code>Protocol\AccountTree\SyncCode</code>
+ */
+class AccountTree_SyncCode
+{
+    /**
+     * Generated from protobuf enum <code>OK = 0;</code>
+     */
+    const OK = 0;
+    /**
+     *the proof of the ledger is not closed yet, ask again
+     *
+     * Generated from protobuf enum <code>NOT_READY = 1;</code>
+     */
+    const NOT_READY = 1;
+    /**
+     *the ledger is not served any more
+     *
+     * Generated from protobuf enum <code>NOT_PINNED = 2;</code>
+     */
+    const NOT_PINNED = 2;
+    /**
+     * Generated from protobuf enum <code>INTERNAL = 3;</code>
+     */
+    const INTERNAL = 3;
+}
+
@@ -0,0 +1,115 @@
+<?php
+# Generated by the protocol buffer compiler.  DO NOT EDIT!
+# source: overlay.proto
+
+namespace Protocol;
+
+use Google\Protobuf\Internal\GPBType;
+use Google\Protobuf\Internal\RepeatedField;
+use Google\Protobuf\Internal\GPBUtil;
+
+/**
+ *for state sync, rows of the account tree and of the asset and metadata trees of its accounts
+ *
+ * Generated from protobuf message <code>protocol.GetAccountTree</code>
+ */
+class GetAccountTree extends \Google\Protobuf\Internal\Message
+{
+    /**
+     *0 for the ledger the peer serves now
+     *
+     * Generated from protobuf field <code>int64 ledger_seq = 1;</code>
+     */
+    private $ledger_seq = 0;
+    /**
+     *account db keys, none to get the ledger itself
+     *
+     * Generated from protobuf field <code>repeated bytes keys = 2;</code>
+     */
+    private $keys;
+    /**
+     * Generated from protobuf field <code>int64 timestamp = 3;</code>
+     */
+    private $timestamp = 0;
+
+    public function __construct() {
+        \GPBMetadata\Overlay::initOnce();
+        parent::__construct();
+    }
+
+    /**
+     *0 for the ledger the peer serves now
+     *
+     * Generated from protobuf field <code>int64 ledger_seq = 1;</code>
+     * @return int|string
+     */
+    public function getLedgerSeq()
+    {
+        return $this->ledger_seq;
+    }
+
+    /**
+     *0 for the ledger the peer serves now
+     *
+     * Generated from protobuf field <code>int64 ledger_seq = 1;</code>
+     * @param int|string $var
+     * @return $this
+     */
+    public function setLedgerSeq($var)
+    {
+        GPBUtil::checkInt64($var);
+        $this->ledger_seq = $var;
+
+        return $this;
+    }
+
+    /**
+     *account db keys, none to get the ledger itself
+     *
+     * Generated from protobuf field <code>repeated bytes keys = 2;</code>
+     * @return \Google\Protobuf\Internal\RepeatedField
+     */
+    public function getKeys()
+    {
+        return $this->keys;
+    }
+
+    /**
+     *account db keys, none to get the ledger itself
+     *
+     * Generated from protobuf field <code>repeated bytes keys = 2;</code>
+     * @param string[]|\Google\Protobuf\Internal\RepeatedField $var
+     * @return $this
+     */
+    public function setKeys($var)
+    {
+        $arr = GPBUtil::checkRepeatedField($var, \Google\Protobuf\Internal\GPBType::BYTES);
+        $this->keys = $arr;
+
+        return $this;
+    }
+
+    /**
+     * Generated from protobuf field <code>int64 timestamp = 3;</code>
+     * @return int|string
+     */
+    public function getTimestamp()
+    {
+        return $this->timestamp;
+    }
+
+    /**
+     * Generated from protobuf field <code>int64 timestamp = 3;</code>
+     * @param int|string $var
+     * @return $this
+     */
+    public function setTimestamp($var)
+    {
+        GPBUtil::checkInt64($var);
+        $this->timestamp = $var;
+
+        return $this;
+    }
+
+}
+
@@ -43,5 +43,11 @@ class OVERLAY_MESSAGE_TYPE
      * Generated from protobuf enum <code>OVERLAY_MSGTYPE_LEDGER_UPGRADE_NOTIFY = 7;</code>
      */
     const OVERLAY_MSGTYPE_LEDGER_UPGRADE_NOTIFY = 7;
+    /**
+     *state sync, rows of the account trees at a ledger
+     *
+     * Generated from protobuf enum <code>OVERLAY_MSGTYPE_ACCOUNT_TREE = 8;</code>
+     */
+    const OVERLAY_MSGTYPE_ACCOUNT_TREE = 8;
 }
 
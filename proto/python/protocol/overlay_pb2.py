@@ -22,9 +22,10 @@ DESCRIPTOR = _descriptor.FileDescriptor(
   name='overlay.proto',
   package='protocol',
   syntax='proto3',
-  serialized_pb=_b('\n\roverlay.proto\x12\x08protocol\x1a\x0c\x63ommon.proto\x1a\x0b\x63hain.proto\"\xa3\x01\n\x05Hello\x12\x12\n\nnetwork_id\x18\x01 \x01(\x03\x12\x16\n\x0eledger_version\x18\x02 \x01(\x03\x12\x17\n\x0foverlay_version\x18\x03 \x01(\x03\x12\x14\n\x0c\x62umo_version\x18\x04 \x01(\t\x12\x16\n\x0elistening_port\x18\x05 \x01(\x03\x12\x14\n\x0cnode_address\x18\x06 \x01(\t\x12\x11\n\tnode_rand\x18\x07 \x01(\t\"L\n\rHelloResponse\x12\'\n\nerror_code\x18\x01 \x01(\x0e\x32\x13.protocol.ERRORCODE\x12\x12\n\nerror_desc\x18\x02 \x01(\t\"}\n\x04Peer\x12\n\n\x02ip\x18\x01 \x01(\t\x12\x0c\n\x04port\x18\x02 \x01(\x03\x12\x14\n\x0cnum_failures\x18\x03 \x01(\x03\x12\x19\n\x11next_attempt_time\x18\x04 \x01(\x03\x12\x13\n\x0b\x61\x63tive_time\x18\x05 \x01(\x03\x12\x15\n\rconnection_id\x18\x06 \x01(\x03\"&\n\x05Peers\x12\x1d\n\x05peers\x18\x01 \x03(\x0b\x32\x0e.protocol.Peer\";\n\nGetLedgers\x12\r\n\x05\x62\x65gin\x18\x01 \x01(\x03\x12\x0b\n\x03\x65nd\x18\x02 \x01(\x03\x12\x11\n\ttimestamp\x18\x03 \x01(\x03\"\xdf\x01\n\x07Ledgers\x12(\n\x06values\x18\x01 \x03(\x0b\x32\x18.protocol.ConsensusValue\x12-\n\tsync_code\x18\x02 \x01(\x0e\x32\x1a.protocol.Ledgers.SyncCode\x12\x0f\n\x07max_seq\x18\x03 \x01(\x03\x12\r\n\x05proof\x18\x04 \x01(\x0c\"[\n\x08SyncCode\x12\x06\n\x02OK\x10\x00\x12\x0f\n\x0bOUT_OF_SYNC\x10\x01\x12\x12\n\x0eOUT_OF_LEDGERS\x10\x02\x12\x08\n\x04\x42USY\x10\x03\x12\n\n\x06REFUSE\x10\x04\x12\x0c\n\x08INTERNAL\x10\x05\"&\n\x08\x44ontHave\x12\x0c\n\x04type\x18\x01 \x01(\x03\x12\x0c\n\x04hash\x18\x02 \x01(\x0c\"v\n\x13LedgerUpgradeNotify\x12\r\n\x05nonce\x18\x01 \x01(\x03\x12(\n\x07upgrade\x18\x02 \x01(\x0b\x32\x17.protocol.LedgerUpgrade\x12&\n\tsignature\x18\x03 \x01(\x0b\x32\x13.protocol.Signature\"\x1a\n\tEntryList\x12\r\n\x05\x65ntry\x18\x01 \x03(\x0c\"M\n\nChainHello\x12,\n\x08\x61pi_list\x18\x01 \x03(\x0e\x32\x1a.protocol.ChainMessageType\x12\x11\n\ttimestamp\x18\x02 \x01(\x03\"z\n\x0b\x43hainStatus\x12\x11\n\tself_addr\x18\x01 \x01(\t\x12\x16\n\x0eledger_version\x18\x02 \x01(\x03\x12\x17\n\x0fmonitor_version\x18\x03 \x01(\x03\x12\x14\n\x0c\x62umo_version\x18\x04 \x01(\t\x12\x11\n\ttimestamp\x18\x05 \x01(\x03\"O\n\x10\x43hainPeerMessage\x12\x15\n\rsrc_peer_addr\x18\x01 \x01(\t\x12\x16\n\x0e\x64\x65s_peer_addrs\x18\x02 \x03(\t\x12\x0c\n\x04\x64\x61ta\x18\x03 \x01(\x0c\"#\n\x10\x43hainSubscribeTx\x12\x0f\n\x07\x61\x64\x64ress\x18\x01 \x03(\t\"7\n\rChainResponse\x12\x12\n\nerror_code\x18\x01 \x01(\x05\x12\x12\n\nerror_desc\x18\x02 \x01(\t\"\xd5\x02\n\rChainTxStatus\x12\x30\n\x06status\x18\x01 \x01(\x0e\x32 .protocol.ChainTxStatus.TxStatus\x12\x0f\n\x07tx_hash\x18\x02 \x01(\t\x12\x16\n\x0esource_address\x18\x03 \x01(\t\x12\x1a\n\x12source_account_seq\x18\x04 \x01(\x03\x12\x12\n\nledger_seq\x18\x05 \x01(\x03\x12\x17\n\x0fnew_account_seq\x18\x06 \x01(\x03\x12\'\n\nerror_code\x18\x07 \x01(\x0e\x32\x13.protocol.ERRORCODE\x12\x12\n\nerror_desc\x18\x08 \x01(\t\x12\x11\n\ttimestamp\x18\t \x01(\x03\"P\n\x08TxStatus\x12\r\n\tUNDEFINED\x10\x00\x12\r\n\tCONFIRMED\x10\x01\x12\x0b\n\x07PENDING\x10\x02\x12\x0c\n\x08\x43OMPLETE\x10\x03\x12\x0b\n\x07\x46\x41ILURE\x10\x04*\x83\x02\n\x14OVERLAY_MESSAGE_TYPE\x12\x18\n\x14OVERLAY_MSGTYPE_NONE\x10\x00\x12\x18\n\x14OVERLAY_MSGTYPE_PING\x10\x01\x12\x19\n\x15OVERLAY_MSGTYPE_HELLO\x10\x02\x12\x19\n\x15OVERLAY_MSGTYPE_PEERS\x10\x03\x12\x1f\n\x1bOVERLAY_MSGTYPE_TRANSACTION\x10\x04\x12\x1b\n\x17OVERLAY_MSGTYPE_LEDGERS\x10\x05\x12\x18\n\x14OVERLAY_MSGTYPE_PBFT\x10\x06\x12)\n%OVERLAY_MSGTYPE_LEDGER_UPGRADE_NOTIFY\x10\x07*\xfa\x01\n\x10\x43hainMessageType\x12\x13\n\x0f\x43HAIN_TYPE_NONE\x10\x00\x12\x0f\n\x0b\x43HAIN_HELLO\x10\n\x12\x13\n\x0f\x43HAIN_TX_STATUS\x10\x0b\x12\x15\n\x11\x43HAIN_PEER_ONLINE\x10\x0c\x12\x16\n\x12\x43HAIN_PEER_OFFLINE\x10\r\x12\x16\n\x12\x43HAIN_PEER_MESSAGE\x10\x0e\x12\x1b\n\x17\x43HAIN_SUBMITTRANSACTION\x10\x0f\x12\x17\n\x13\x43HAIN_LEDGER_HEADER\x10\x10\x12\x16\n\x12\x43HAIN_SUBSCRIBE_TX\x10\x11\x12\x16\n\x12\x43HAIN_TX_ENV_STORE\x10\x12\x42\"\n io.phantom.sdk.core.extend.protobufb\x06proto3')
+  serialized_pb=_b('\n\roverlay.proto\x12\x08protocol\x1a\x0c\x63ommon.proto\x1a\x0b\x63hain.proto\"\xa6\x01\n\x05Hello\x12\x12\n\nnetwork_id\x18\x01 \x01(\x03\x12\x16\n\x0eledger_version\x18\x02 \x01(\x03\x12\x17\n\x0foverlay_version\x18\x03 \x01(\x03\x12\x17\n\x0fphantom_version\x18\x04 \x01(\t\x12\x16\n\x0elistening_port\x18\x05 \x01(\x03\x12\x14\n\x0cnode_address\x18\x06 \x01(\t\x12\x11\n\tnode_rand\x18\x07 \x01(\t\"L\n\rHelloResponse\x12\'\n\nerror_code\x18\x01 \x01(\x0e\x32\x13.protocol.ERRORCODE\x12\x12\n\nerror_desc\x18\x02 \x01(\t\"}\n\x04Peer\x12\n\n\x02ip\x18\x01 \x01(\t\x12\x0c\n\x04port\x18\x02 \x01(\x03\x12\x14\n\x0cnum_failures\x18\x03 \x01(\x03\x12\x19\n\x11next_attempt_time\x18\x04 \x01(\x03\x12\x13\n\x0b\x61\x63tive_time\x18\x05 \x01(\x03\x12\x15\n\rconnection_id\x18\x06 \x01(\x03\"&\n\x05Peers\x12\x1d\n\x05peers\x18\x01 \x03(\x0b\x32\x0e.protocol.Peer\";\n\nGetLedgers\x12\r\n\x05\x62\x65gin\x18\x01 \x01(\x03\x12\x0b\n\x03\x65nd\x18\x02 \x01(\x03\x12\x11\n\ttimestamp\x18\x03 \x01(\x03\"\xdf\x01\n\x07Ledgers\x12(\n\x06values\x18\x01 \x03(\x0b\x32\x18.protocol.ConsensusValue\x12-\n\tsync_code\x18\x02 \x01(\x0e\x32\x1a.protocol.Ledgers.SyncCode\x12\x0f\n\x07max_seq\x18\x03 \x01(\x03\x12\r\n\x05proof\x18\x04 \x01(\x0c\"[\n\x08SyncCode\x12\x06\n\x02OK\x10\x00\x12\x0f\n\x0bOUT_OF_SYNC\x10\x01\x12\x12\n\x0eOUT_OF_LEDGERS\x10\x02\x12\x08\n\x04\x42USY\x10\x03\x12\n\n\x06REFUSE\x10\x04\x12\x0c\n\x08INTERNAL\x10\x05\"E\n\x0eGetAccountTree\x12\x12\n\nledger_seq\x18\x01 \x01(\x03\x12\x0c\n\x04keys\x18\x02 \x03(\x0c\x12\x11\n\ttimestamp\x18\x03 \x01(\x03\"\x96\x02\n\x0b\x41\x63\x63ountTree\x12\x31\n\tsync_code\x18\x01 \x01(\x0e\x32\x1e.protocol.AccountTree.SyncCode\x12\x12\n\nledger_seq\x18\x02 \x01(\x03\x12\x0e\n\x06values\x18\x03 \x03(\x0c\x12 \n\x06ledger\x18\x04 \x01(\x0b\x32\x10.protocol.Ledger\x12\x17\n\x0f\x63onsensus_value\x18\x05 \x01(\x0c\x12\x12\n\nnext_value\x18\x06 \x01(\x0c\x12\x12\n\nnext_proof\x18\x07 \x01(\x0c\x12\x0c\n\x04\x66\x65\x65s\x18\x08 \x01(\x0c\"?\n\x08SyncCode\x12\x06\n\x02OK\x10\x00\x12\r\n\tNOT_READY\x10\x01\x12\x0e\n\nNOT_PINNED\x10\x02\x12\x0c\n\x08INTERNAL\x10\x03\"&\n\x08\x44ontHave\x12\x0c\n\x04type\x18\x01 \x01(\x03\x12\x0c\n\x04hash\x18\x02 \x01(\x0c\"v\n\x13LedgerUpgradeNotify\x12\r\n\x05nonce\x18\x01 \x01(\x03\x12(\n\x07upgrade\x18\x02 \x01(\x0b\x32\x17.protocol.LedgerUpgrade\x12&\n\tsignature\x18\x03 \x01(\x0b\x32\x13.protocol.Signature\"\x1a\n\tEntryList\x12\r\n\x05\x65ntry\x18\x01 \x03(\x0c\"M\n\nChainHello\x12,\n\x08\x61pi_list\x18\x01 \x03(\x0e\x32\x1a.protocol.ChainMessageType\x12\x11\n\ttimestamp\x18\x02 \x01(\x03\"}\n\x0b\x43hainStatus\x12\x11\n\tself_addr\x18\x01 \x01(\t\x12\x16\n\x0eledger_version\x18\x02 \x01(\x03\x12\x17\n\x0fmonitor_version\x18\x03 \x01(\x03\x12\x17\n\x0fphantom_version\x18\x04 \x01(\t\x12\x11\n\ttimestamp\x18\x05 \x01(\x03\"O\n\x10\x43hainPeerMessage\x12\x15\n\rsrc_peer_addr\x18\x01 \x01(\t\x12\x16\n\x0e\x64\x65s_peer_addrs\x18\x02 \x03(\t\x12\x0c\n\x04\x64\x61ta\x18\x03 \x01(\x0c\"#\n\x10\x43hainSubscribeTx\x12\x0f\n\x07\x61\x64\x64ress\x18\x01 \x03(\t\"7\n\rChainResponse\x12\x12\n\nerror_code\x18\x01 \x01(\x05\x12\x12\n\nerror_desc\x18\x02 \x01(\t\"\xd5\x02\n\rChainTxStatus\x12\x30\n\x06status\x18\x01 \x01(\x0e\x32 .protocol.ChainTxStatus.TxStatus\x12\x0f\n\x07tx_hash\x18\x02 \x01(\t\x12\x16\n\x0esource_address\x18\x03 \x01(\t\x12\x1a\n\x12source_account_seq\x18\x04 \x01(\x03\x12\x12\n\nledger_seq\x18\x05 \x01(\x03\x12\x17\n\x0fnew_account_seq\x18\x06 \x01(\x03\x12\'\n\nerror_code\x18\x07 \x01(\x0e\x32\x13.protocol.ERRORCODE\x12\x12\n\nerror_desc\x18\x08 \x01(\t\x12\x11\n\ttimestamp\x18\t \x01(\x03\"P\n\x08TxStatus\x12\r\n\tUNDEFINED\x10\x00\x12\r\n\tCONFIRMED\x10\x01\x12\x0b\n\x07PENDING\x10\x02\x12\x0c\n\x08\x43OMPLETE\x10\x03\x12\x0b\n\x07\x46\x41ILURE\x10\x04*\xa5\x02\n\x14OVERLAY_MESSAGE_TYPE\x12\x18\n\x14OVERLAY_MSGTYPE_NONE\x10\x00\x12\x18\n\x14OVERLAY_MSGTYPE_PING\x10\x01\x12\x19\n\x15OVERLAY_MSGTYPE_HELLO\x10\x02\x12\x19\n\x15OVERLAY_MSGTYPE_PEERS\x10\x03\x12\x1f\n\x1bOVERLAY_MSGTYPE_TRANSACTION\x10\x04\x12\x1b\n\x17OVERLAY_MSGTYPE_LEDGERS\x10\x05\x12\x18\n\x14OVERLAY_MSGTYPE_PBFT\x10\x06\x12)\n%OVERLAY_MSGTYPE_LEDGER_UPGRADE_NOTIFY\x10\x07\x12 \n\x1cOVERLAY_MSGTYPE_ACCOUNT_TREE\x10\x08*\xfa\x01\n\x10\x43hainMessageType\x12\x13\n\x0f\x43HAIN_TYPE_NONE\x10\x00\x12\x0f\n\x0b\x43HAIN_HELLO\x10\n\x12\x13\n\x0f\x43HAIN_TX_STATUS\x10\x0b\x12\x15\n\x11\x43HAIN_PEER_ONLINE\x10\x0c\x12\x16\n\x12\x43HAIN_PEER_OFFLINE\x10\r\x12\x16\n\x12\x43HAIN_PEER_MESSAGE\x10\x0e\x12\x1b\n\x17\x43HAIN_SUBMITTRANSACTION\x10\x0f\x12\x17\n\x13\x43HAIN_LEDGER_HEADER\x10\x10\x12\x16\n\x12\x43HAIN_SUBSCRIBE_TX\x10\x11\x12\x16\n\x12\x43HAIN_TX_ENV_STORE\x10\x12\x42&\n$org.phantom.sdk.core.extend.protobufb\x06proto3')
   ,
   dependencies=[common__pb2.DESCRIPTOR,chain__pb2.DESCRIPTOR,])
+_sym_db.RegisterFileDescriptor(DESCRIPTOR)
 
 _OVERLAY_MESSAGE_TYPE = _descriptor.EnumDescriptor(
   name='OVERLAY_MESSAGE_TYPE',
@@ -64,11 +65,15 @@ _OVERLAY_MESSAGE_TYPE = _descriptor.EnumDescriptor(
       name='OVERLAY_MSGTYPE_LEDGER_UPGRADE_NOTIFY', index=7, number=7,
       options=None,
       type=None),
+    _descriptor.EnumValueDescriptor(
+      name='OVERLAY_MSGTYPE_ACCOUNT_TREE', index=8, number=8,
+      options=None,
+      type=None),
   ],
   containing_type=None,
   options=None,
-  serialized_start=1663,
-  serialized_end=1922,
+  serialized_start=2021,
+  serialized_end=2314,
 )
 _sym_db.RegisterEnumDescriptor(_OVERLAY_MESSAGE_TYPE)
 
@@ -122,8 +127,8 @@ _CHAINMESSAGETYPE = _descriptor.EnumDescriptor(
   ],
   containing_type=None,
   options=None,
-  serialized_start=1925,
-  serialized_end=2175,
+  serialized_start=2317,
+  serialized_end=2567,
 )
 _sym_db.RegisterEnumDescriptor(_CHAINMESSAGETYPE)
 
@@ -136,6 +141,7 @@ OVERLAY_MSGTYPE_TRANSACTION = 4
 OVERLAY_MSGTYPE_LEDGERS = 5
 OVERLAY_MSGTYPE_PBFT = 6
 OVERLAY_MSGTYPE_LEDGER_UPGRADE_NOTIFY = 7
+OVERLAY_MSGTYPE_ACCOUNT_TREE = 8
 CHAIN_TYPE_NONE = 0
 CHAIN_HELLO = 10
 CHAIN_TX_STATUS = 11
@@ -181,11 +187,41 @@ _LEDGERS_SYNCCODE = _descriptor.EnumDescriptor(
   ],
   containing_type=None,
   options=None,
-  serialized_start=659,
-  serialized_end=750,
+  serialized_start=662,
+  serialized_end=753,
 )
 _sym_db.RegisterEnumDescriptor(_LEDGERS_SYNCCODE)
 
+_ACCOUNTTREE_SYNCCODE = _descriptor.EnumDescriptor(
+  name='SyncCode',
+  full_name='protocol.AccountTree.SyncCode',
+  filename=None,
+  file=DESCRIPTOR,
+  values=[
+    _descriptor.EnumValueDescriptor(
+      name='OK', index=0, number=0,
+      options=None,
+      type=None),
+    _descriptor.EnumValueDescriptor(
+      name='NOT_READY', index=1, number=1,
+      options=None,
+      type=None),
+    _descriptor.EnumValueDescriptor(
+      name='NOT_PINNED', index=2, number=2,
+      options=None,
+      type=None),
+    _descriptor.EnumValueDescriptor(
+      name='INTERNAL', index=3, number=3,
+      options=None,
+      type=None),
+  ],
+  containing_type=None,
+  options=None,
+  serialized_start=1042,
+  serialized_end=1105,
+)
+_sym_db.RegisterEnumDescriptor(_ACCOUNTTREE_SYNCCODE)
+
 _CHAINTXSTATUS_TXSTATUS = _descriptor.EnumDescriptor(
   name='TxStatus',
   full_name='protocol.ChainTxStatus.TxStatus',
@@ -215,8 +251,8 @@ _CHAINTXSTATUS_TXSTATUS = _descriptor.EnumDescriptor(
   ],
   containing_type=None,
   options=None,
-  serialized_start=1580,
-  serialized_end=1660,
+  serialized_start=1938,
+  serialized_end=2018,
 )
 _sym_db.RegisterEnumDescriptor(_CHAINTXSTATUS_TXSTATUS)
 
@@ -234,49 +270,49 @@ _HELLO = _descriptor.Descriptor(
       has_default_value=False, default_value=0,
       message_type=None, enum_type=None, containing_type=None,
       is_extension=False, extension_scope=None,
-      options=None, file=DESCRIPTOR),
+      options=None),
     _descriptor.FieldDescriptor(
       name='ledger_version', full_name='protocol.Hello.ledger_version', index=1,
       number=2, type=3, cpp_type=2, label=1,
       has_default_value=False, default_value=0,
       message_type=None, enum_type=None, containing_type=None,
       is_extension=False, extension_scope=None,
-      options=None, file=DESCRIPTOR),
+      options=None),
     _descriptor.FieldDescriptor(
       name='overlay_version', full_name='protocol.Hello.overlay_version', index=2,
       number=3, type=3, cpp_type=2, label=1,
       has_default_value=False, default_value=0,
       message_type=None, enum_type=None, containing_type=None,
       is_extension=False, extension_scope=None,
-      options=None, file=DESCRIPTOR),
+      options=None),
     _descriptor.FieldDescriptor(
       name='phantom_version', full_name='protocol.Hello.phantom_version', index=3,
       number=4, type=9, cpp_type=9, label=1,
       has_default_value=False, default_value=_b("").decode('utf-8'),
       message_type=None, enum_type=None, containing_type=None,
       is_extension=False, extension_scope=None,
-      options=None, file=DESCRIPTOR),
+      options=None),
     _descriptor.FieldDescriptor(
       name='listening_port', full_name='protocol.Hello.listening_port', index=4,
       number=5, type=3, cpp_type=2, label=1,
       has_default_value=False, default_value=0,
       message_type=None, enum_type=None, containing_type=None,
       is_extension=False, extension_scope=None,
-      options=None, file=DESCRIPTOR),
+      options=None),
     _descriptor.FieldDescriptor(
       name='node_address', full_name='protocol.Hello.node_address', index=5,
       number=6, type=9, cpp_type=9, label=1,
       has_default_value=False, default_value=_b("").decode('utf-8'),
       message_type=None, enum_type=None, containing_type=None,
       is_extension=False, extension_scope=None,
-      options=None, file=DESCRIPTOR),
+      options=None),
     _descriptor.FieldDescriptor(
       name='node_rand', full_name='protocol.Hello.node_rand', index=6,
       number=7, type=9, cpp_type=9, label=1,
       has_default_value=False, default_value=_b("").decode('utf-8'),
       message_type=None, enum_type=None, containing_type=None,
       is_extension=False, extension_scope=None,
-      options=None, file=DESCRIPTOR),
+      options=None),
   ],
   extensions=[
   ],
@@ -290,7 +326,7 @@ _HELLO = _descriptor.Descriptor(
   oneofs=[
   ],
   serialized_start=55,
-  serialized_end=218,
+  serialized_end=221,
 )
 
 
@@ -307,14 +343,14 @@ _HELLORESPONSE = _descriptor.Descriptor(
       has_default_value=False, default_value=0,
       message_type=None, enum_type=None, containing_type=None,
       is_extension=False, extension_scope=None,
-      options=None, file=DESCRIPTOR),
+      options=None),
     _descriptor.FieldDescriptor(
       name='error_desc', full_name='protocol.HelloResponse.error_desc', index=1,
       number=2, type=9, cpp_type=9, label=1,
       has_default_value=False, default_value=_b("").decode('utf-8'),
       message_type=None, enum_type=None, containing_type=None,
       is_extension=False, extension_scope=None,
-      options=None, file=DESCRIPTOR),
+      options=None),
   ],
   extensions=[
   ],
@@ -327,8 +363,8 @@ _HELLORESPONSE = _descriptor.Descriptor(
   extension_ranges=[],
   oneofs=[
   ],
-  serialized_start=220,
-  serialized_end=296,
+  serialized_start=223,
+  serialized_end=299,
 )
 
 
@@ -345,42 +381,42 @@ _PEER = _descriptor.Descriptor(
       has_default_value=False, default_value=_b("").decode('utf-8'),
       message_type=None, enum_type=None, containing_type=None,
       is_extension=False, extension_scope=None,
-      options=None, file=DESCRIPTOR),
+      options=None),
     _descriptor.FieldDescriptor(
       name='port', full_name='protocol.Peer.port', index=1,
       number=2, type=3, cpp_type=2, label=1,
       has_default_value=False, default_value=0,
       message_type=None, enum_type=None, containing_type=None,
       is_extension=False, extension_scope=None,
-      options=None, file=DESCRIPTOR),
+      options=None),
     _descriptor.FieldDescriptor(
       name='num_failures', full_name='protocol.Peer.num_failures', index=2,
       number=3, type=3, cpp_type=2, label=1,
       has_default_value=False, default_value=0,
       message_type=None, enum_type=None, containing_type=None,
       is_extension=False, extension_scope=None,
-      options=None, file=DESCRIPTOR),
+      options=None),
     _descriptor.FieldDescriptor(
       name='next_attempt_time', full_name='protocol.Peer.next_attempt_time', index=3,
       number=4, type=3, cpp_type=2, label=1,
       has_default_value=False, default_value=0,
       message_type=None, enum_type=None, containing_type=None,
       is_extension=False, extension_scope=None,
-      options=None, file=DESCRIPTOR),
+      options=None),
     _descriptor.FieldDescriptor(
       name='active_time', full_name='protocol.Peer.active_time', index=4,
       number=5, type=3, cpp_type=2, label=1,
       has_default_value=False, default_value=0,
       message_type=None, enum_type=None, containing_type=None,
       is_extension=False, extension_scope=None,
-      options=None, file=DESCRIPTOR),
+      options=None),
     _descriptor.FieldDescriptor(
       name='connection_id', full_name='protocol.Peer.connection_id', index=5,
       number=6, type=3, cpp_type=2, label=1,
       has_default_value=False, default_value=0,
       message_type=None, enum_type=None, containing_type=None,
       is_extension=False, extension_scope=None,
-      options=None, file=DESCRIPTOR),
+      options=None),
   ],
   extensions=[
   ],
@@ -393,8 +429,8 @@ _PEER = _descriptor.Descriptor(
   extension_ranges=[],
   oneofs=[
   ],
-  serialized_start=298,
-  serialized_end=423,
+  serialized_start=301,
+  serialized_end=426,
 )
 
 
@@ -411,7 +447,7 @@ _PEERS = _descriptor.Descriptor(
       has_default_value=False, default_value=[],
       message_type=None, enum_type=None, containing_type=None,
       is_extension=False, extension_scope=None,
-      options=None, file=DESCRIPTOR),
+      options=None),
   ],
   extensions=[
   ],
@@ -424,8 +460,8 @@ _PEERS = _descriptor.Descriptor(
   extension_ranges=[],
   oneofs=[
   ],
-  serialized_start=425,
-  serialized_end=463,
+  serialized_start=428,
+  serialized_end=466,
 )
 
 
@@ -442,21 +478,21 @@ _GETLEDGERS = _descriptor.Descriptor(
       has_default_value=False, default_value=0,
       message_type=None, enum_type=None, containing_type=None,
       is_extension=False, extension_scope=None,
-      options=None, file=DESCRIPTOR),
+      options=None),
     _descriptor.FieldDescriptor(
       name='end', full_name='protocol.GetLedgers.end', index=1,
       number=2, type=3, cpp_type=2, label=1,
       has_default_value=False, default_value=0,
       message_type=None, enum_type=None, containing_type=None,
       is_extension=False, extension_scope=None,
-      options=None, file=DESCRIPTOR),
+      options=None),
     _descriptor.FieldDescriptor(
       name='timestamp', full_name='protocol.GetLedgers.timestamp', index=2,
       number=3, type=3, cpp_type=2, label=1,
       has_default_value=False, default_value=0,
       message_type=None, enum_type=None, containing_type=None,
       is_extension=False, extension_scope=None,
-      options=None, file=DESCRIPTOR),
+      options=None),
   ],
   extensions=[
   ],
@@ -469,8 +505,8 @@ _GETLEDGERS = _descriptor.Descriptor(
   extension_ranges=[],
   oneofs=[
   ],
-  serialized_start=465,
-  serialized_end=524,
+  serialized_start=468,
+  serialized_end=527,
 )
 
 
@@ -487,28 +523,28 @@ _LEDGERS = _descriptor.Descriptor(
       has_default_value=False, default_value=[],
       message_type=None, enum_type=None, containing_type=None,
       is_extension=False, extension_scope=None,
-      options=None, file=DESCRIPTOR),
+      options=None),
     _descriptor.FieldDescriptor(
       name='sync_code', full_name='protocol.Ledgers.sync_code', index=1,
       number=2, type=14, cpp_type=8, label=1,
       has_default_value=False, default_value=0,
       message_type=None, enum_type=None, containing_type=None,
       is_extension=False, extension_scope=None,
-      options=None, file=DESCRIPTOR),
+      options=None),
     _descriptor.FieldDescriptor(
       name='max_seq', full_name='protocol.Ledgers.max_seq', index=2,
       number=3, type=3, cpp_type=2, label=1,
       has_default_value=False, default_value=0,
       message_type=None, enum_type=None, containing_type=None,
       is_extension=False, extension_scope=None,
-      options=None, file=DESCRIPTOR),
+      options=None),
     _descriptor.FieldDescriptor(
       name='proof', full_name='protocol.Ledgers.proof', index=3,
       number=4, type=12, cpp_type=9, label=1,
       has_default_value=False, default_value=_b(""),
       message_type=None, enum_type=None, containing_type=None,
       is_extension=False, extension_scope=None,
-      options=None, file=DESCRIPTOR),
+      options=None),
   ],
   extensions=[
   ],
@@ -522,8 +558,134 @@ _LEDGERS = _descriptor.Descriptor(
   extension_ranges=[],
   oneofs=[
   ],
-  serialized_start=527,
-  serialized_end=750,
+  serialized_start=530,
+  serialized_end=753,
+)
+
+
+_GETACCOUNTTREE = _descriptor.Descriptor(
+  name='GetAccountTree',
+  full_name='protocol.GetAccountTree',
+  filename=None,
+  file=DESCRIPTOR,
+  containing_type=None,
+  fields=[
+    _descriptor.FieldDescriptor(
+      name='ledger_seq', full_name='protocol.GetAccountTree.ledger_seq', index=0,
+      number=1, type=3, cpp_type=2, label=1,
+      has_default_value=False, default_value=0,
+      message_type=None, enum_type=None, containing_type=None,
+      is_extension=False, extension_scope=None,
+      options=None),
+    _descriptor.FieldDescriptor(
+      name='keys', full_name='protocol.GetAccountTree.keys', index=1,
+      number=2, type=12, cpp_type=9, label=3,
+      has_default_value=False, default_value=[],
+      message_type=None, enum_type=None, containing_type=None,
+      is_extension=False, extension_scope=None,
+      options=None),
+    _descriptor.FieldDescriptor(
+      name='timestamp', full_name='protocol.GetAccountTree.timestamp', index=2,
+      number=3, type=3, cpp_type=2, label=1,
+      has_default_value=False, default_value=0,
+      message_type=None, enum_type=None, containing_type=None,
+      is_extension=False, extension_scope=None,
+      options=None),
+  ],
+  extensions=[
+  ],
+  nested_types=[],
+  enum_types=[
+  ],
+  options=None,
+  is_extendable=False,
+  syntax='proto3',
+  extension_ranges=[],
+  oneofs=[
+  ],
+  serialized_start=755,
+  serialized_end=824,
+)
+
+
+_ACCOUNTTREE = _descriptor.Descriptor(
+  name='AccountTree',
+  full_name='protocol.AccountTree',
+  filename=None,
+  file=DESCRIPTOR,
+  containing_type=None,
+  fields=[
+    _descriptor.FieldDescriptor(
+      name='sync_code', full_name='protocol.AccountTree.sync_code', index=0,
+      number=1, type=14, cpp_type=8, label=1,
+      has_default_value=False, default_value=0,
+      message_type=None, enum_type=None, containing_type=None,
+      is_extension=False, extension_scope=None,
+      options=None),
+    _descriptor.FieldDescriptor(
+      name='ledger_seq', full_name='protocol.AccountTree.ledger_seq', index=1,
+      number=2, type=3, cpp_type=2, label=1,
+      has_default_value=False, default_value=0,
+      message_type=None, enum_type=None, containing_type=None,
+      is_extension=False, extension_scope=None,
+      options=None),
+    _descriptor.FieldDescriptor(
+      name='values', full_name='protocol.AccountTree.values', index=2,
+      number=3, type=12, cpp_type=9, label=3,
+      has_default_value=False, default_value=[],
+      message_type=None, enum_type=None, containing_type=None,
+      is_extension=False, extension_scope=None,
+      options=None),
+    _descriptor.FieldDescriptor(
+      name='ledger', full_name='protocol.AccountTree.ledger', index=3,
+      number=4, type=11, cpp_type=10, label=1,
+      has_default_value=False, default_value=None,
+      message_type=None, enum_type=None, containing_type=None,
+      is_extension=False, extension_scope=None,
+      options=None),
+    _descriptor.FieldDescriptor(
+      name='consensus_value', full_name='protocol.AccountTree.consensus_value', index=4,
+      number=5, type=12, cpp_type=9, label=1,
+      has_default_value=False, default_value=_b(""),
+      message_type=None, enum_type=None, containing_type=None,
+      is_extension=False, extension_scope=None,
+      options=None),
+    _descriptor.FieldDescriptor(
+      name='next_value', full_name='protocol.AccountTree.next_value', index=5,
+      number=6, type=12, cpp_type=9, label=1,
+      has_default_value=False, default_value=_b(""),
+      message_type=None, enum_type=None, containing_type=None,
+      is_extension=False, extension_scope=None,
+      options=None),
+    _descriptor.FieldDescriptor(
+      name='next_proof', full_name='protocol.AccountTree.next_proof', index=6,
+      number=7, type=12, cpp_type=9, label=1,
+      has_default_value=False, default_value=_b(""),
+      message_type=None, enum_type=None, containing_type=None,
+      is_extension=False, extension_scope=None,
+      options=None),
+    _descriptor.FieldDescriptor(
+      name='fees', full_name='protocol.AccountTree.fees', index=7,
+      number=8, type=12, cpp_type=9, label=1,
+      has_default_value=False, default_value=_b(""),
+      message_type=None, enum_type=None, containing_type=None,
+      is_extension=False, extension_scope=None,
+      options=None),
+  ],
+  extensions=[
+  ],
+  nested_types=[],
+  enum_types=[
+    _ACCOUNTTREE_SYNCCODE,
+  ],
+  options=None,
+  is_extendable=False,
+  syntax='proto3',
+  extension_ranges=[],
+  oneofs=[
+  ],
+  serialized_start=827,
+  serialized_end=1105,
 )
 
 
@@ -540,14 +702,14 @@ _DONTHAVE = _descriptor.Descriptor(
       has_default_value=False, default_value=0,
       message_type=None, enum_type=None, containing_type=None,
       is_extension=False, extension_scope=None,
-      options=None, file=DESCRIPTOR),
+      options=None),
     _descriptor.FieldDescriptor(
       name='hash', full_name='protocol.DontHave.hash', index=1,
       number=2, type=12, cpp_type=9, label=1,
       has_default_value=False, default_value=_b(""),
       message_type=None, enum_type=None, containing_type=None,
       is_extension=False, extension_scope=None,
-      options=None, file=DESCRIPTOR),
+      options=None),
   ],
   extensions=[
   ],
@@ -560,8 +722,8 @@ _DONTHAVE = _descriptor.Descriptor(
   extension_ranges=[],
   oneofs=[
   ],
-  serialized_start=752,
-  serialized_end=790,
+  serialized_start=1107,
+  serialized_end=1145,
 )
 
 
@@ -578,21 +740,21 @@ _LEDGERUPGRADENOTIFY = _descriptor.Descriptor(
       has_default_value=False, default_value=0,
       message_type=None, enum_type=None, containing_type=None,
       is_extension=False, extension_scope=None,
-      options=None, file=DESCRIPTOR),
+      options=None),
     _descriptor.FieldDescriptor(
       name='upgrade', full_name='protocol.LedgerUpgradeNotify.upgrade', index=1,
       number=2, type=11, cpp_type=10, label=1,
       has_default_value=False, default_value=None,
       message_type=None, enum_type=None, containing_type=None,
       is_extension=False, extension_scope=None,
-      options=None, file=DESCRIPTOR),
+      options=None),
     _descriptor.FieldDescriptor(
       name='signature', full_name='protocol.LedgerUpgradeNotify.signature', index=2,
       number=3, type=11, cpp_type=10, label=1,
       has_default_value=False, default_value=None,
       message_type=None, enum_type=None, containing_type=None,
       is_extension=False, extension_scope=None,
-      options=None, file=DESCRIPTOR),
+      options=None),
   ],
   extensions=[
   ],
@@ -605,8 +767,8 @@ _LEDGERUPGRADENOTIFY = _descriptor.Descriptor(
   extension_ranges=[],
   oneofs=[
   ],
-  serialized_start=792,
-  serialized_end=910,
+  serialized_start=1147,
+  serialized_end=1265,
 )
 
 
@@ -623,7 +785,7 @@ _ENTRYLIST = _descriptor.Descriptor(
       has_default_value=False, default_value=[],
       message_type=None, enum_type=None, containing_type=None,
       is_extension=False, extension_scope=None,
-      options=None, file=DESCRIPTOR),
+      options=None),
   ],
   extensions=[
   ],
@@ -636,8 +798,8 @@ _ENTRYLIST = _descriptor.Descriptor(
   extension_ranges=[],
   oneofs=[
   ],
-  serialized_start=912,
-  serialized_end=938,
+  serialized_start=1267,
+  serialized_end=1293,
 )
 
 
@@ -654,14 +816,14 @@ _CHAINHELLO = _descriptor.Descriptor(
       has_default_value=False, default_value=[],
       message_type=None, enum_type=None, containing_type=None,
       is_extension=False, extension_scope=None,
-      options=None, file=DESCRIPTOR),
+      options=None),
     _descriptor.FieldDescriptor(
       name='timestamp', full_name='protocol.ChainHello.timestamp', index=1,
       number=2, type=3, cpp_type=2, label=1,
       has_default_value=False, default_value=0,
       message_type=None, enum_type=None, containing_type=None,
       is_extension=False, extension_scope=None,
-      options=None, file=DESCRIPTOR),
+      options=None),
   ],
   extensions=[
   ],
@@ -674,8 +836,8 @@ _CHAINHELLO = _descriptor.Descriptor(
   extension_ranges=[],
   oneofs=[
   ],
-  serialized_start=940,
-  serialized_end=1017,
+  serialized_start=1295,
+  serialized_end=1372,
 )
 
 
@@ -692,35 +854,35 @@ _CHAINSTATUS = _descriptor.Descriptor(
       has_default_value=False, default_value=_b("").decode('utf-8'),
       message_type=None, enum_type=None, containing_type=None,
       is_extension=False, extension_scope=None,
-      options=None, file=DESCRIPTOR),
+      options=None),
     _descriptor.FieldDescriptor(
       name='ledger_version', full_name='protocol.ChainStatus.ledger_version', index=1,
       number=2, type=3, cpp_type=2, label=1,
       has_default_value=False, default_value=0,
       message_type=None, enum_type=None, containing_type=None,
       is_extension=False, extension_scope=None,
-      options=None, file=DESCRIPTOR),
+      options=None),
     _descriptor.FieldDescriptor(
       name='monitor_version', full_name='protocol.ChainStatus.monitor_version', index=2,
       number=3, type=3, cpp_type=2, label=1,
       has_default_value=False, default_value=0,
       message_type=None, enum_type=None, containing_type=None,
       is_extension=False, extension_scope=None,
-      options=None, file=DESCRIPTOR),
+      options=None),
     _descriptor.FieldDescriptor(
       name='phantom_version', full_name='protocol.ChainStatus.phantom_version', index=3,
       number=4, type=9, cpp_type=9, label=1,
       has_default_value=False, default_value=_b("").decode('utf-8'),
       message_type=None, enum_type=None, containing_type=None,
       is_extension=False, extension_scope=None,
-      options=None, file=DESCRIPTOR),
+      options=None),
     _descriptor.FieldDescriptor(
       name='timestamp', full_name='protocol.ChainStatus.timestamp', index=4,
       number=5, type=3, cpp_type=2, label=1,
       has_default_value=False, default_value=0,
       message_type=None, enum_type=None, containing_type=None,
       is_extension=False, extension_scope=None,
-      options=None, file=DESCRIPTOR),
+      options=None),
   ],
   extensions=[
   ],
@@ -733,8 +895,8 @@ _CHAINSTATUS = _descriptor.Descriptor(
   extension_ranges=[],
   oneofs=[
   ],
-  serialized_start=1019,
-  serialized_end=1141,
+  serialized_start=1374,
+  serialized_end=1499,
 )
 
 
@@ -751,21 +913,21 @@ _CHAINPEERMESSAGE = _descriptor.Descriptor(
       has_default_value=False, default_value=_b("").decode('utf-8'),
       message_type=None, enum_type=None, containing_type=None,
       is_extension=False, extension_scope=None,
-      options=None, file=DESCRIPTOR),
+      options=None),
     _descriptor.FieldDescriptor(
       name='des_peer_addrs', full_name='protocol.ChainPeerMessage.des_peer_addrs', index=1,
       number=2, type=9, cpp_type=9, label=3,
       has_default_value=False, default_value=[],
       message_type=None, enum_type=None, containing_type=None,
       is_extension=False, extension_scope=None,
-      options=None, file=DESCRIPTOR),
+      options=None),
     _descriptor.FieldDescriptor(
       name='data', full_name='protocol.ChainPeerMessage.data', index=2,
       number=3, type=12, cpp_type=9, label=1,
       has_default_value=False, default_value=_b(""),
       message_type=None, enum_type=None, containing_type=None,
       is_extension=False, extension_scope=None,
-      options=None, file=DESCRIPTOR),
+      options=None),
   ],
   extensions=[
   ],
@@ -778,8 +940,8 @@ _CHAINPEERMESSAGE = _descriptor.Descriptor(
   extension_ranges=[],
   oneofs=[
   ],
-  serialized_start=1143,
-  serialized_end=1222,
+  serialized_start=1501,
+  serialized_end=1580,
 )
 
 
@@ -796,7 +958,7 @@ _CHAINSUBSCRIBETX = _descriptor.Descriptor(
       has_default_value=False, default_value=[],
       message_type=None, enum_type=None, containing_type=None,
       is_extension=False, extension_scope=None,
-      options=None, file=DESCRIPTOR),
+      options=None),
   ],
   extensions=[
   ],
@@ -809,8 +971,8 @@ _CHAINSUBSCRIBETX = _descriptor.Descriptor(
   extension_ranges=[],
   oneofs=[
   ],
-  serialized_start=1224,
-  serialized_end=1259,
+  serialized_start=1582,
+  serialized_end=1617,
 )
 
 
@@ -827,14 +989,14 @@ _CHAINRESPONSE = _descriptor.Descriptor(
       has_default_value=False, default_value=0,
       message_type=None, enum_type=None, containing_type=None,
       is_extension=False, extension_scope=None,
-      options=None, file=DESCRIPTOR),
+      options=None),
     _descriptor.FieldDescriptor(
       name='error_desc', full_name='protocol.ChainResponse.error_desc', index=1,
       number=2, type=9, cpp_type=9, label=1,
       has_default_value=False, default_value=_b("").decode('utf-8'),
       message_type=None, enum_type=None, containing_type=None,
       is_extension=False, extension_scope=None,
-      options=None, file=DESCRIPTOR),
+      options=None),
   ],
   extensions=[
   ],
@@ -847,8 +1009,8 @@ _CHAINRESPONSE = _descriptor.Descriptor(
   extension_ranges=[],
   oneofs=[
   ],
-  serialized_start=1261,
-  serialized_end=1316,
+  serialized_start=1619,
+  serialized_end=1674,
 )
 
 
@@ -865,63 +1027,63 @@ _CHAINTXSTATUS = _descriptor.Descriptor(
       has_default_value=False, default_value=0,
       message_type=None, enum_type=None, containing_type=None,
       is_extension=False, extension_scope=None,
-      options=None, file=DESCRIPTOR),
+      options=None),
     _descriptor.FieldDescriptor(
       name='tx_hash', full_name='protocol.ChainTxStatus.tx_hash', index=1,
       number=2, type=9, cpp_type=9, label=1,
       has_default_value=False, default_value=_b("").decode('utf-8'),
       message_type=None, enum_type=None, containing_type=None,
       is_extension=False, extension_scope=None,
-      options=None, file=DESCRIPTOR),
+      options=None),
     _descriptor.FieldDescriptor(
       name='source_address', full_name='protocol.ChainTxStatus.source_address', index=2,
       number=3, type=9, cpp_type=9, label=1,
       has_default_value=False, default_value=_b("").decode('utf-8'),
       message_type=None, enum_type=None, containing_type=None,
       is_extension=False, extension_scope=None,
-      options=None, file=DESCRIPTOR),
+      options=None),
     _descriptor.FieldDescriptor(
       name='source_account_seq', full_name='protocol.ChainTxStatus.source_account_seq', index=3,
       number=4, type=3, cpp_type=2, label=1,
       has_default_value=False, default_value=0,
       message_type=None, enum_type=None, containing_type=None,
       is_extension=False, extension_scope=None,
-      options=None, file=DESCRIPTOR),
+      options=None),
     _descriptor.FieldDescriptor(
       name='ledger_seq', full_name='protocol.ChainTxStatus.ledger_seq', index=4,
       number=5, type=3, cpp_type=2, label=1,
       has_default_value=False, default_value=0,
       message_type=None, enum_type=None, containing_type=None,
       is_extension=False, extension_scope=None,
-      options=None, file=DESCRIPTOR),
+      options=None),
     _descriptor.FieldDescriptor(
       name='new_account_seq', full_name='protocol.ChainTxStatus.new_account_seq', index=5,
       number=6, type=3, cpp_type=2, label=1,
       has_default_value=False, default_value=0,
       message_type=None, enum_type=None, containing_type=None,
       is_extension=False, extension_scope=None,
-      options=None, file=DESCRIPTOR),
+      options=None),
     _descriptor.FieldDescriptor(
       name='error_code', full_name='protocol.ChainTxStatus.error_code', index=6,
       number=7, type=14, cpp_type=8, label=1,
       has_default_value=False, default_value=0,
       message_type=None, enum_type=None, containing_type=None,
       is_extension=False, extension_scope=None,
-      options=None, file=DESCRIPTOR),
+      options=None),
     _descriptor.FieldDescriptor(
       name='error_desc', full_name='protocol.ChainTxStatus.error_desc', index=7,
       number=8, type=9, cpp_type=9, label=1,
       has_default_value=False, default_value=_b("").decode('utf-8'),
       message_type=None, enum_type=None, containing_type=None,
       is_extension=False, extension_scope=None,
-      options=None, file=DESCRIPTOR),
+      options=None),
     _descriptor.FieldDescriptor(
       name='timestamp', full_name='protocol.ChainTxStatus.timestamp', index=8,
       number=9, type=3, cpp_type=2, label=1,
       has_default_value=False, default_value=0,
       message_type=None, enum_type=None, containing_type=None,
       is_extension=False, extension_scope=None,
-      options=None, file=DESCRIPTOR),
+      options=None),
   ],
   extensions=[
   ],
@@ -935,8 +1097,8 @@ _CHAINTXSTATUS = _descriptor.Descriptor(
   extension_ranges=[],
   oneofs=[
   ],
-  serialized_start=1319,
-  serialized_end=1660,
+  serialized_start=1677,
+  serialized_end=2018,
 )
 
 _HELLORESPONSE.fields_by_name['error_code'].enum_type = common__pb2._ERRORCODE
@@ -944,6 +1106,9 @@ _PEERS.fields_by_name['peers'].message_type = _PEER
 _LEDGERS.fields_by_name['values'].message_type = chain__pb2._CONSENSUSVALUE
 _LEDGERS.fields_by_name['sync_code'].enum_type = _LEDGERS_SYNCCODE
 _LEDGERS_SYNCCODE.containing_type = _LEDGERS
+_ACCOUNTTREE.fields_by_name['sync_code'].enum_type = _ACCOUNTTREE_SYNCCODE
+_ACCOUNTTREE.fields_by_name['ledger'].message_type = chain__pb2._LEDGER
+_ACCOUNTTREE_SYNCCODE.containing_type = _ACCOUNTTREE
 _LEDGERUPGRADENOTIFY.fields_by_name['upgrade'].message_type = common__pb2._LEDGERUPGRADE
 _LEDGERUPGRADENOTIFY.fields_by_name['signature'].message_type = common__pb2._SIGNATURE
 _CHAINHELLO.fields_by_name['api_list'].enum_type = _CHAINMESSAGETYPE
@@ -956,6 +1121,8 @@ DESCRIPTOR.message_types_by_name['Peer'] = _PEER
 DESCRIPTOR.message_types_by_name['Peers'] = _PEERS
 DESCRIPTOR.message_types_by_name['GetLedgers'] = _GETLEDGERS
 DESCRIPTOR.message_types_by_name['Ledgers'] = _LEDGERS
+DESCRIPTOR.message_types_by_name['GetAccountTree'] = _GETACCOUNTTREE
+DESCRIPTOR.message_types_by_name['AccountTree'] = _ACCOUNTTREE
 DESCRIPTOR.message_types_by_name['DontHave'] = _DONTHAVE
 DESCRIPTOR.message_types_by_name['LedgerUpgradeNotify'] = _LEDGERUPGRADENOTIFY
 DESCRIPTOR.message_types_by_name['EntryList'] = _ENTRYLIST
@@ -967,7 +1134,6 @@ DESCRIPTOR.message_types_by_name['ChainResponse'] = _CHAINRESPONSE
 DESCRIPTOR.message_types_by_name['ChainTxStatus'] = _CHAINTXSTATUS
 DESCRIPTOR.enum_types_by_name['OVERLAY_MESSAGE_TYPE'] = _OVERLAY_MESSAGE_TYPE
 DESCRIPTOR.enum_types_by_name['ChainMessageType'] = _CHAINMESSAGETYPE
-_sym_db.RegisterFileDescriptor(DESCRIPTOR)
 
 Hello = _reflection.GeneratedProtocolMessageType('Hello', (_message.Message,), dict(
   DESCRIPTOR = _HELLO,
@@ -1011,6 +1177,20 @@ Ledgers = _reflection.GeneratedProtocolMessageType('Ledgers', (_message.Message,
   ))
 _sym_db.RegisterMessage(Ledgers)
 
+GetAccountTree = _reflection.GeneratedProtocolMessageType('GetAccountTree', (_message.Message,), dict(
+  DESCRIPTOR = _GETACCOUNTTREE,
+  __module__ = 'overlay_pb2'
+  # @@protoc_insertion_point(class_scope:protocol.GetAccountTree)
+  ))
+_sym_db.RegisterMessage(GetAccountTree)
+
+AccountTree = _reflection.GeneratedProtocolMessageType('AccountTree', (_message.Message,), dict(
+  DESCRIPTOR = _ACCOUNTTREE,
+  __module__ = 'overlay_pb2'
+  # @@protoc_insertion_point(class_scope:protocol.AccountTree)
+  ))
+_sym_db.RegisterMessage(AccountTree)
+
 DontHave = _reflection.GeneratedProtocolMessageType('DontHave', (_message.Message,), dict(
   DESCRIPTOR = _DONTHAVE,
   __module__ = 'overlay_pb2'
@@ -1076,5 +1256,5 @@ _sym_db.RegisterMessage(ChainTxStatus)
 
 
 DESCRIPTOR.has_options = True
-DESCRIPTOR._options = _descriptor._ParseOptions(descriptor_pb2.FileOptions(), _b('\n io.phantom.sdk.core.extend.protobuf'))
+DESCRIPTOR._options = _descriptor._ParseOptions(descriptor_pb2.FileOptions(), _b('\n$org.phantom.sdk.core.extend.protobuf'))
 # @@protoc_insertion_point(module_scope)